@@ -1,4 +1,199 @@
+#include <algorithm>
+#include <filesystem>
 #include <iostream>
+#include <string>
+#include <vector>
+#include "Assembler.h"
+#include "BlockStorage.h"
+#include "CoroutineBench.h"
+#include "CowBus.h"
+#include "CpuCheck.h"
+#include "CpuMonitor.h"
+#include "DiffFuzz.h"
+#include "Dma.h"
+#include "GuestBench.h"
+#include "HostCall.h"
+#include "InputLog.h"
+#include "MemoryImage.h"
+#include "Pacer.h"
+#include "PerfBench.h"
+#include "Recompiler.h"
+#include "RunAhead.h"
 #include "RunNesTest.h"
+#include "StatsSegment.h"
+#include "Uart.h"
+#include "Via.h"
 
-int main() { return RunNestest("6502_65C02_functional_tests/nestest.prg.bin"); }
\ No newline at end of file
+int main(int argc, char** argv)
+{
+    const std::string mode = argc > 1 ? argv[1] : "";
+
+    // fuzz [cases] [seed] [threads] [fusion|idle|all]
+    if (mode == "fuzz") {
+        const uint64_t cases = argc > 2 ? std::stoull(argv[2]) : 100000;
+        const uint64_t seed = argc > 3 ? std::stoull(argv[3]) : 1;
+        const unsigned threads = argc > 4 ? static_cast<unsigned>(std::stoul(argv[4])) : 0;
+        const std::string candidate = argc > 5 ? argv[5] : "all";
+        if (candidate != "fusion" && candidate != "idle" && candidate != "all") {
+            std::cerr << "Unknown fuzz candidate " << candidate << std::endl;
+            return 2;
+        }
+        return RunDiffFuzz(seed, cases, threads, candidate == "fusion" ? FuzzCandidate::Fusion :
+                           candidate == "idle" ? FuzzCandidate::IdleSkip : FuzzCandidate::All) ? 0 : 1;
+    }
+
+    // asm source.s out.bin [variant]
+    if (mode == "asm") {
+        return RunAssembler(argc, argv);
+    }
+
+    // blockdev image [transfers]
+    if (mode == "blockdev" && argc > 2) {
+        const unsigned transfers = argc > 3 ? static_cast<unsigned>(std::stoul(argv[3])) : 20000;
+        return RunBlockDemo(argv[2], transfers);
+    }
+
+    // cobench [cycles] [devices]
+    if (mode == "cobench") {
+        const uint64_t cycles = argc > 2 ? std::stoull(argv[2]) : 100000000;
+        const unsigned devices = argc > 3 ? static_cast<unsigned>(std::stoul(argv[3])) : 64;
+        return RunCoroutineBench(cycles, devices);
+    }
+
+    // forkbench [children] [instructions]
+    if (mode == "forkbench") {
+        const unsigned children = argc > 2 ? static_cast<unsigned>(std::stoul(argv[2])) : 10000;
+        const uint64_t instructions = argc > 3 ? std::stoull(argv[3]) : 2000;
+        return RunForkBench(children, instructions);
+    }
+
+    // dma
+    if (mode == "dma") {
+        return RunDmaDemo();
+    }
+
+    // guestbench [cycles]
+    if (mode == "guestbench") {
+        const uint64_t cycles = argc > 2 ? std::stoull(argv[2]) : 20000000;
+        return RunGuestBench(cycles);
+    }
+
+    // hostcall [dir]
+    if (mode == "hostcall") {
+        return RunHostCallDemo(argc > 2 ? argv[2] : ".");
+    }
+
+    // monitor [cycles] [interval]
+    if (mode == "monitor") {
+        const uint64_t cycles = argc > 2 ? std::stoull(argv[2]) : 100000000;
+        const uint64_t interval = argc > 3 ? std::stoull(argv[3]) : 10000;
+        return RunMonitorDemo(cycles, interval);
+    }
+
+    // pace [ntsc|pal|hz] [seconds] [turbo]
+    if (mode == "pace") {
+        const std::string clock = argc > 2 ? argv[2] : "ntsc";
+        const double seconds = argc > 3 ? std::stod(argv[3]) : 5.0;
+        const bool turbo = argc > 4 && std::string(argv[4]) == "turbo";
+        if (clock == "pal")
+            return RunPaceDemo(PAL_CPU_HZ, PAL_FRAME_HZ, seconds, turbo);
+        if (clock == "ntsc")
+            return RunPaceDemo(NTSC_CPU_HZ, NTSC_FRAME_HZ, seconds, turbo);
+        const double cpuHz = std::stod(clock);
+        if (!(cpuHz > 0)) {
+            std::cerr << "Clock rate must be positive, got " << clock << std::endl;
+            return 2;
+        }
+        return RunPaceDemo(cpuHz, NTSC_FRAME_HZ, seconds, turbo);
+    }
+
+    // perfbench [instructions]
+    if (mode == "perfbench") {
+        const uint64_t instructions = argc > 2 ? std::stoull(argv[2]) : 20000000;
+        return RunPerfBench(instructions);
+    }
+
+    // replay [cycles] [log]
+    if (mode == "replay") {
+        const uint64_t cycles = argc > 2 ? std::stoull(argv[2]) : 10000000;
+        const std::string path = argc > 3 ? argv[3] : (std::filesystem::temp_directory_path() / "6502_replay.log").string();
+        return RunReplayDemo(cycles, path);
+    }
+
+    // runahead [frames]
+    if (mode == "runahead") {
+        const int frames = argc > 2 ? std::stoi(argv[2]) : 3;
+        return RunRunAheadDemo(frames);
+    }
+
+    // statsrun [kernel] [seconds] [name]
+    if (mode == "statsrun") {
+        const std::string kernel = argc > 2 ? argv[2] : "wait";
+        const double seconds = argc > 3 ? std::stod(argv[3]) : 10.0;
+        return RunStatsDemo(kernel, seconds, argc > 4 ? argv[4] : "");
+    }
+
+    // statsview [seconds] [segment...]
+    if (mode == "statsview") {
+        const double seconds = argc > 2 ? std::stod(argv[2]) : 1.0;
+        return RunStatsView(seconds, std::vector<std::string>(argv + std::min(argc, 3), argv + argc));
+    }
+
+    // uart [input|-]
+    if (mode == "uart") {
+        return RunUartDemo(argc > 2 ? argv[2] : "-");
+    }
+
+    // via [cycles]
+    if (mode == "via") {
+        const uint64_t cycles = argc > 2 ? std::stoull(argv[2]) : 10000000;
+        return RunViaDemo(cycles);
+    }
+
+    // cpucheck
+    if (mode == "cpucheck") {
+        return RunCpuCheck();
+    }
+
+    // memhex image.bin
+    if (mode == "memhex" && argc > 2) {
+        return RunMemHex(argv[2]);
+    }
+
+    // memdiff a.bin b.bin
+    if (mode == "memdiff" && argc > 3) {
+        return RunMemDiff(argv[2], argv[3]);
+    }
+
+    // recompile image.bin base out.cpp [symbol] [variant] [entry...]
+    if (mode == "recompile") {
+        return RunRecompile(argc, argv);
+    }
+
+    // nestest-rc - the nestest trace from NestestRecompiled.cpp
+    if (mode == "nestest-rc") {
+        return RunNestestRecompiled("6502_65C02_functional_tests/nestest.prg.bin") ? 0 : 1;
+    }
+
+    // nestest-check - both nestest traces against nestest.log
+    if (mode == "nestest-check") {
+        return RunNestestCheck("6502_65C02_functional_tests/nestest.prg.bin", "6502_65C02_functional_tests/nestest.log");
+    }
+
+    // coverage [out.bin|out.csv] [runs]
+    if (mode == "coverage") {
+        const std::string outPath = argc > 2 ? argv[2] : "";
+        const unsigned runs = argc > 3 ? static_cast<unsigned>(std::stoul(argv[3])) : 500;
+        return RunNestestCoverage("6502_65C02_functional_tests/nestest.prg.bin", outPath, runs);
+    }
+
+    // rcbench [runs]
+    if (mode == "rcbench") {
+        const unsigned runs = argc > 2 ? static_cast<unsigned>(std::stoul(argv[2])) : 2000;
+        return RunRecompiledBench("6502_65C02_functional_tests/nestest.prg.bin", runs);
+    }
+
+    // nestest [image.bin]
+    const std::string imagePath = (mode == "nestest" && argc > 2) ? argv[2] : "";
+    return RunNestest("6502_65C02_functional_tests/nestest.prg.bin", 5003, imagePath) ? 0 : 1;
+}
@@ -15,4 +15,17 @@ enum class AddressingMode : uint8_t {
     IND, // Indirect
     IZX, // Indexed Indirect (X)
     IZY, // Indirect Indexed (Y)
+    ZPI, // Zero Page Indirect (65C02)
+    IAX, // Absolute Indexed Indirect (65C02, JMP only)
 };
+
+// Bytes an instruction takes in memory, opcode included
+constexpr int InstructionLength(AddressingMode mode)
+{
+    switch (mode) {
+    case AddressingMode::IMP: return 1;
+    case AddressingMode::ABS: case AddressingMode::ABX: case AddressingMode::ABY:
+    case AddressingMode::IND: case AddressingMode::IAX: return 3;
+    default: return 2;
+    }
+}
@@ -0,0 +1,675 @@
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <set>
+#include <sstream>
+
+#include "Assembler.h"
+#include "Opcodes.h"
+
+static constexpr int MODES = static_cast<int>(AddressingMode::IAX) + 1;
+
+// Mnemonic -> opcode for each addressing mode, -1 where the mode does not exist
+using OpcodeSet = std::map<std::string, std::array<int, MODES>>;
+
+template <typename Cpu>
+static OpcodeSet BuildOpcodeSet(const std::array<OpcodeEntry<Cpu>, 256>& table)
+{
+    OpcodeSet set;
+    for (int op = 0; op < 256; ++op) {
+        const OpcodeEntry<Cpu>& entry = table[op];
+        if (entry.operate == &Cpu::XXX || std::string(entry.name) == "???")
+            continue;
+        auto [it, added] = set.try_emplace(entry.name);
+        if (added)
+            it->second.fill(-1);
+        // First opcode wins, except that the tables also call undocumented NOPs NOP - $EA is the real one
+        int& slot = it->second[static_cast<int>(AddressingModeOf(entry))];
+        if (slot < 0 || op == 0xEA)
+            slot = op;
+    }
+    return set;
+}
+
+static std::string Hex4(unsigned value)
+{
+    char text[8];
+    std::snprintf(text, sizeof(text), "%04X", value & 0xFFFF);
+    return text;
+}
+
+static std::string Trim(const std::string& text)
+{
+    const size_t first = text.find_first_not_of(" \t\r");
+    if (first == std::string::npos)
+        return "";
+    return text.substr(first, text.find_last_not_of(" \t\r") - first + 1);
+}
+
+static std::string Upper(std::string text)
+{
+    std::transform(text.begin(), text.end(), text.begin(), [](unsigned char c) { return static_cast<char>(std::toupper(c)); });
+    return text;
+}
+
+static bool IsSymbolStart(char c) { return std::isalpha(static_cast<unsigned char>(c)) || c == '_'; }
+static bool IsSymbolChar(char c) { return std::isalnum(static_cast<unsigned char>(c)) || c == '_'; }
+
+// Splits on commas outside quotes and brackets
+static std::vector<std::string> SplitList(const std::string& text)
+{
+    std::vector<std::string> items;
+    std::string item;
+    int depth = 0;
+    char quote = 0;
+    for (size_t i = 0; i < text.size(); ++i) {
+        const char c = text[i];
+        if (quote != 0) {
+            if (c == '\\' && i + 1 < text.size())
+                item += text[i++];
+            else if (c == quote)
+                quote = 0;
+        } else if (c == '"' || c == '\'') {
+            quote = c;
+        } else if (c == '(' || c == '[') {
+            ++depth;
+        } else if (c == ')' || c == ']') {
+            --depth;
+        } else if (c == ',' && depth == 0) {
+            items.push_back(Trim(item));
+            item.clear();
+            continue;
+        }
+        item += c;
+    }
+    items.push_back(Trim(item));
+    return items;
+}
+
+// Recursive descent over one expression. Undefined symbols evaluate to 0 and clear known, so the first pass
+// can size instructions before every label is placed.
+class Expression {
+public:
+    Expression(const std::string& text, const std::map<std::string, uint16_t>& symbols, uint32_t pc)
+        : text(text), symbols(symbols), pc(pc) {}
+
+    bool evaluate(int32_t& value, bool& known, std::string& error) {
+        value = binary(0);
+        skipSpace();
+        if (this->error.empty() && pos < text.size())
+            fail("unexpected '" + text.substr(pos) + "'");
+        if (this->error.empty() && text.find_first_not_of(" \t") == std::string::npos)
+            fail("missing expression");
+        known = undefined.empty();
+        error = this->error;
+        return error.empty();
+    }
+
+    const std::string& firstUndefined() const { return undefined; }
+
+private:
+    void skipSpace() {
+        while (pos < text.size() && (text[pos] == ' ' || text[pos] == '\t'))
+            ++pos;
+    }
+
+    bool accept(const char* token) {
+        skipSpace();
+        const size_t length = std::char_traits<char>::length(token);
+        if (text.compare(pos, length, token) != 0)
+            return false;
+        pos += length;
+        return true;
+    }
+
+    void fail(const std::string& message) {
+        if (error.empty())
+            error = message;
+        pos = text.size();
+    }
+
+    // Precedence levels from loosest: | ^ & shifts additive multiplicative
+    int32_t binary(int level) {
+        if (level == 6)
+            return unary();
+        int32_t left = binary(level + 1);
+        for (;;) {
+            skipSpace();
+            if (level == 0 && accept("|")) left |= binary(1);
+            else if (level == 1 && accept("^")) left ^= binary(2);
+            else if (level == 2 && accept("&")) left &= binary(3);
+            else if (level == 3 && accept("<<")) left = static_cast<int32_t>(static_cast<uint32_t>(left) << (binary(4) & 31));
+            else if (level == 3 && accept(">>")) left >>= (binary(4) & 31);
+            else if (level == 4 && accept("+")) left += binary(5);
+            else if (level == 4 && accept("-")) left -= binary(5);
+            else if (level == 5 && accept("*")) left *= binary(6);
+            else if (level == 5 && (accept("/") || accept("%"))) {
+                const bool divide = text[pos - 1] == '/';
+                const int32_t right = binary(6);
+                if (right == 0) {
+                    if (undefined.empty())
+                        fail("division by zero");
+                    left = 0;
+                } else {
+                    left = divide ? left / right : left % right;
+                }
+            } else {
+                return left;
+            }
+        }
+    }
+
+    int32_t unary() {
+        if (accept("-")) return -unary();
+        if (accept("~")) return ~unary();
+        if (accept("<")) return unary() & 0xFF;
+        if (accept(">")) return (unary() >> 8) & 0xFF;
+        return primary();
+    }
+
+    int32_t primary() {
+        skipSpace();
+        if (pos >= text.size()) {
+            fail("missing operand");
+            return 0;
+        }
+        const char c = text[pos];
+        if (c == '[' || c == '(') {
+            ++pos;
+            const int32_t value = binary(0);
+            if (!accept(c == '[' ? "]" : ")"))
+                fail(std::string("missing '") + (c == '[' ? "]" : ")") + "'");
+            return value;
+        }
+        if (c == '$' || c == '%')
+            return number(c == '$' ? 16 : 2, pos + 1);
+        if (std::isdigit(static_cast<unsigned char>(c)))
+            return number(10, pos);
+        if (c == '\'') {
+            if (pos + 2 < text.size() && text[pos + 2] == '\'') {
+                pos += 3;
+                return static_cast<uint8_t>(text[pos - 2]);
+            }
+            fail("bad character constant");
+            return 0;
+        }
+        if (c == '*') {
+            ++pos;
+            return static_cast<int32_t>(pc);
+        }
+        if (IsSymbolStart(c)) {
+            const size_t begin = pos;
+            while (pos < text.size() && IsSymbolChar(text[pos]))
+                ++pos;
+            const std::string name = text.substr(begin, pos - begin);
+            const auto it = symbols.find(name);
+            if (it != symbols.end())
+                return it->second;
+            if (undefined.empty())
+                undefined = name;
+            return 0;
+        }
+        fail(std::string("unexpected '") + c + "'");
+        return 0;
+    }
+
+    int32_t number(int base, size_t begin) {
+        size_t end = begin;
+        int64_t value = 0;
+        while (end < text.size()) {
+            const char c = static_cast<char>(std::tolower(static_cast<unsigned char>(text[end])));
+            const int digit = std::isdigit(static_cast<unsigned char>(c)) ? c - '0' : (c >= 'a' && c <= 'f') ? c - 'a' + 10 : 99;
+            if (digit >= base)
+                break;
+            value = value * base + digit;
+            if (value > 0xFFFFFFFFll) {
+                fail("number too large");
+                return 0;
+            }
+            ++end;
+        }
+        if (end == begin || (end < text.size() && IsSymbolChar(text[end]))) {
+            fail("bad number '" + text.substr(pos, end + 1 - pos) + "'");
+            return 0;
+        }
+        pos = end;
+        return static_cast<int32_t>(value);
+    }
+
+    const std::string& text;
+    const std::map<std::string, uint16_t>& symbols;
+    const uint32_t pc;
+    size_t pos = 0;
+    std::string error;
+    std::string undefined;
+};
+
+// Operand syntax, before the opcode table says which addressing mode it becomes
+enum class OperandSyntax { NONE, ACCUMULATOR, IMMEDIATE, INDIRECT, INDIRECT_X, INDIRECT_Y, DIRECT, DIRECT_X, DIRECT_Y };
+
+static OperandSyntax ParseOperand(const std::string& operand, std::string& expression)
+{
+    expression = operand;
+    if (operand.empty())
+        return OperandSyntax::NONE;
+    if (Upper(operand) == "A")
+        return OperandSyntax::ACCUMULATOR;
+    if (operand[0] == '#') {
+        expression = operand.substr(1);
+        return OperandSyntax::IMMEDIATE;
+    }
+
+    if (operand[0] == '(') {
+        int depth = 0;
+        size_t close = 0;
+        for (size_t i = 0; i < operand.size() && close == 0; ++i) {
+            if (operand[i] == '(') ++depth;
+            else if (operand[i] == ')' && --depth == 0) close = i;
+        }
+        const std::string inner = operand.substr(1, close > 0 ? close - 1 : std::string::npos);
+        const std::string rest = Trim(operand.substr(close + 1));
+        if (close == operand.size() - 1) {
+            const std::vector<std::string> parts = SplitList(inner);
+            if (parts.size() == 2 && Upper(parts[1]) == "X") {
+                expression = parts[0];
+                return OperandSyntax::INDIRECT_X;
+            }
+            expression = inner;
+            return OperandSyntax::INDIRECT;
+        }
+        if (!rest.empty() && rest[0] == ',' && Upper(Trim(rest.substr(1))) == "Y") {
+            expression = inner;
+            return OperandSyntax::INDIRECT_Y;
+        }
+        // Otherwise the parentheses only group, e.g. (BASE+1)*2
+    }
+
+    const std::vector<std::string> parts = SplitList(operand);
+    if (parts.size() == 2 && (Upper(parts[1]) == "X" || Upper(parts[1]) == "Y")) {
+        expression = parts[0];
+        return Upper(parts[1]) == "X" ? OperandSyntax::DIRECT_X : OperandSyntax::DIRECT_Y;
+    }
+    return OperandSyntax::DIRECT;
+}
+
+class SourceAssembler {
+public:
+    SourceAssembler(const OpcodeSet& opcodes, AssembledProgram& program) : opcodes(opcodes), program(program) {}
+
+    bool run(const std::string& source, std::string& error);
+
+private:
+    struct Line {
+        int number;
+        std::string label;
+        std::string operation; // Upper-case mnemonic or lower-case directive, empty for a label alone
+        std::string operand;
+        bool assignment = false; // label = operand
+        AddressingMode mode = AddressingMode::IMP; // Chosen in the first pass
+    };
+
+    bool split(const std::string& text, Line& line);
+    bool pass(bool final);
+    bool line(Line& line, bool final);
+    bool instruction(Line& line, bool final);
+    bool directive(const Line& line, bool final);
+
+    // Evaluates an expression - in the final pass every symbol must be defined
+    bool evaluate(const std::string& text, bool final, int32_t& value, bool& known);
+    bool evaluate(const std::string& text, bool final, int32_t& value) { bool known; return evaluate(text, final, value, known); }
+    bool emit(int32_t value, int bytes, bool final);
+    bool fail(const std::string& message) { if (error.empty()) error = message; return false; }
+
+    const OpcodeSet& opcodes;
+    AssembledProgram& program;
+    std::vector<Line> lines;
+    std::string error;
+    uint32_t pc = 0;
+    std::set<std::string> defined; // Names defined so far in the first pass, to catch duplicates
+    std::vector<uint8_t> memory = std::vector<uint8_t>(0x10000, 0);
+    std::vector<bool> written = std::vector<bool>(0x10000, false);
+};
+
+bool SourceAssembler::split(const std::string& text, Line& line)
+{
+    // Comment - a ';' outside quotes
+    std::string code;
+    char quote = 0;
+    for (size_t i = 0; i < text.size(); ++i) {
+        const char c = text[i];
+        if (quote == 0 && c == ';')
+            break;
+        if (quote != 0 && c == '\\' && i + 1 < text.size())
+            code += text[i++];
+        else if (c == '"' || c == '\'')
+            quote = quote == 0 ? c : (quote == c ? 0 : quote);
+        code += c;
+    }
+    code = Trim(code);
+
+    size_t pos = 0;
+    while (pos < code.size() && IsSymbolChar(code[pos]))
+        ++pos;
+    const std::string word = code.substr(0, pos);
+    std::string rest = Trim(code.substr(pos));
+
+    if (!word.empty() && IsSymbolStart(word[0]) && !rest.empty() && rest[0] == ':') {
+        line.label = word;
+        code = Trim(rest.substr(1));
+    } else if (!word.empty() && IsSymbolStart(word[0]) && !rest.empty() && rest[0] == '=') {
+        line.label = word;
+        line.assignment = true;
+        line.operand = Trim(rest.substr(1));
+        return true;
+    }
+    if (code.empty())
+        return true;
+
+    pos = code[0] == '.' ? 1 : 0;
+    while (pos < code.size() && IsSymbolChar(code[pos]))
+        ++pos;
+    line.operation = code.substr(0, pos);
+    line.operand = Trim(code.substr(pos));
+    if (code[0] == '.')
+        std::transform(line.operation.begin(), line.operation.end(), line.operation.begin(),
+                       [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+    else
+        line.operation = Upper(line.operation);
+    if (line.operation.empty() || line.operation == ".")
+        return fail("syntax error");
+    return true;
+}
+
+bool SourceAssembler::evaluate(const std::string& text, bool final, int32_t& value, bool& known)
+{
+    Expression expression(text, program.symbols, pc);
+    std::string message;
+    if (!expression.evaluate(value, known, message))
+        return fail(message);
+    if (final && !known)
+        return fail("undefined symbol " + expression.firstUndefined());
+    return true;
+}
+
+bool SourceAssembler::emit(int32_t value, int bytes, bool final)
+{
+    for (int i = 0; i < bytes; ++i) {
+        if (pc > 0xFFFF)
+            return fail("program counter passes $FFFF");
+        if (final) {
+            if (written[pc])
+                return fail("$" + Hex4(pc) + " is written twice");
+            memory[pc] = static_cast<uint8_t>(value >> (8 * i));
+            written[pc] = true;
+        }
+        ++pc;
+    }
+    return true;
+}
+
+bool SourceAssembler::instruction(Line& line, bool final)
+{
+    const auto it = opcodes.find(line.operation);
+    if (it == opcodes.end())
+        return fail("unknown instruction " + line.operation);
+    const std::array<int, MODES>& modes = it->second;
+    auto has = [&](AddressingMode mode) { return modes[static_cast<int>(mode)] >= 0; };
+
+    std::string text;
+    const OperandSyntax syntax = ParseOperand(line.operand, text);
+    int32_t value = 0;
+    bool known = true;
+    if (syntax == OperandSyntax::NONE || syntax == OperandSyntax::ACCUMULATOR)
+        text = "0";
+    if (!evaluate(text, final, value, known))
+        return false;
+
+    if (!final) {
+        const bool zeroPage = known && value >= 0 && value <= 0xFF;
+        auto pick = [&](AddressingMode zp, AddressingMode abs) {
+            return has(zp) && (zeroPage || !has(abs)) ? zp : abs;
+        };
+        AddressingMode mode = AddressingMode::IMP;
+        switch (syntax) {
+        case OperandSyntax::NONE: mode = has(AddressingMode::IMP) ? AddressingMode::IMP : AddressingMode::IMM; break; // BRK takes a signature byte
+        case OperandSyntax::ACCUMULATOR: mode = AddressingMode::IMP; break;
+        case OperandSyntax::IMMEDIATE: mode = AddressingMode::IMM; break;
+        case OperandSyntax::INDIRECT: mode = has(AddressingMode::IND) ? AddressingMode::IND : AddressingMode::ZPI; break;
+        case OperandSyntax::INDIRECT_X: mode = has(AddressingMode::IZX) ? AddressingMode::IZX : AddressingMode::IAX; break;
+        case OperandSyntax::INDIRECT_Y: mode = AddressingMode::IZY; break;
+        case OperandSyntax::DIRECT: mode = has(AddressingMode::REL) ? AddressingMode::REL : pick(AddressingMode::ZP0, AddressingMode::ABS); break;
+        case OperandSyntax::DIRECT_X: mode = pick(AddressingMode::ZPX, AddressingMode::ABX); break;
+        case OperandSyntax::DIRECT_Y: mode = pick(AddressingMode::ZPY, AddressingMode::ABY); break;
+        }
+        if (!has(mode))
+            return fail(line.operation + " has no such addressing mode");
+        line.mode = mode;
+    }
+
+    const int length = InstructionLength(line.mode);
+    if (final) {
+        switch (line.mode) {
+        case AddressingMode::IMP:
+            break;
+        case AddressingMode::REL:
+            value -= static_cast<int32_t>(pc) + 2;
+            if (value < -128 || value > 127)
+                return fail("branch out of range");
+            break;
+        case AddressingMode::IMM:
+            if (value < -128 || value > 0xFF)
+                return fail("immediate value out of range");
+            break;
+        default:
+            if (length == 2 && (value < 0 || value > 0xFF))
+                return fail("zero page address out of range");
+            if (length == 3 && (value < 0 || value > 0xFFFF))
+                return fail("address out of range");
+            break;
+        }
+    }
+    return emit(modes[static_cast<int>(line.mode)] | (value << 8), length, final);
+}
+
+bool SourceAssembler::directive(const Line& line, bool final)
+{
+    const std::vector<std::string> args = line.operand.empty() ? std::vector<std::string>() : SplitList(line.operand);
+    int32_t value = 0;
+    bool known = true;
+
+    if (line.operation == ".org" || line.operation == ".res" || line.operation == ".align") {
+        // Sizes must be settled in the first pass
+        if (args.empty() || args.size() > (line.operation == ".res" ? 2u : 1u))
+            return fail(line.operation + " takes " + (line.operation == ".res" ? "a count and an optional fill" : "one value"));
+        if (!evaluate(args[0], final, value, known))
+            return false;
+        if (!known)
+            return fail(line.operation + " needs a value known where it is used");
+        if (line.operation == ".org") {
+            if (value < 0 || value > 0xFFFF)
+                return fail("origin out of range");
+            pc = static_cast<uint32_t>(value);
+            return true;
+        }
+        if (line.operation == ".align") {
+            if (value <= 0)
+                return fail("bad alignment");
+            pc = (pc + value - 1) / value * value;
+            return true;
+        }
+        if (value < 0)
+            return fail("negative count");
+        if (args.size() == 1) {
+            pc += static_cast<uint32_t>(value); // Space only, left out of the image unless later bytes follow
+            return pc <= 0x10000 || fail("program counter passes $FFFF");
+        }
+        int32_t fill = 0;
+        if (!evaluate(args[1], final, fill))
+            return false;
+        for (int32_t i = 0; i < value; ++i) {
+            if (!emit(fill, 1, final))
+                return false;
+        }
+        return true;
+    }
+
+    if (line.operation == ".byte" || line.operation == ".word") {
+        const int size = line.operation == ".byte" ? 1 : 2;
+        if (args.empty())
+            return fail(line.operation + " needs a value");
+        for (const std::string& arg : args) {
+            if (size == 1 && arg.size() >= 2 && arg.front() == '"' && arg.back() == '"') {
+                for (size_t i = 1; i + 1 < arg.size(); ++i) {
+                    char c = arg[i];
+                    if (c == '\\' && i + 2 < arg.size()) {
+                        c = arg[++i];
+                        c = c == 'n' ? '\n' : c == 'r' ? '\r' : c == 't' ? '\t' : c == '0' ? '\0' : c;
+                    }
+                    if (!emit(static_cast<uint8_t>(c), 1, final))
+                        return false;
+                }
+                continue;
+            }
+            if (!evaluate(arg, final, value))
+                return false;
+            if (final && (value < (size == 1 ? -128 : -32768) || value > (size == 1 ? 0xFF : 0xFFFF)))
+                return fail("value out of range");
+            if (!emit(value, size, final))
+                return false;
+        }
+        return true;
+    }
+
+    return fail("unknown directive " + line.operation);
+}
+
+bool SourceAssembler::line(Line& line, bool final)
+{
+    if (line.assignment) {
+        int32_t value = 0;
+        bool known = true;
+        if (!evaluate(line.operand, final, value, known))
+            return false;
+        if (!final && !defined.insert(line.label).second)
+            return fail(line.label + " is defined twice");
+        if (known && (value < -32768 || value > 0xFFFF))
+            return fail("value out of range");
+        if (known)
+            program.symbols[line.label] = static_cast<uint16_t>(value);
+        return true;
+    }
+
+    if (!line.label.empty() && !final) {
+        if (!defined.insert(line.label).second)
+            return fail(line.label + " is defined twice");
+        if (pc > 0xFFFF)
+            return fail("program counter passes $FFFF");
+        program.symbols[line.label] = static_cast<uint16_t>(pc);
+    }
+    if (line.operation.empty())
+        return true;
+    return line.operation[0] == '.' ? directive(line, final) : instruction(line, final);
+}
+
+bool SourceAssembler::pass(bool final)
+{
+    pc = 0;
+    for (Line& l : lines) {
+        if (!line(l, final)) {
+            error = "line " + std::to_string(l.number) + ": " + error;
+            return false;
+        }
+    }
+    return true;
+}
+
+bool SourceAssembler::run(const std::string& source, std::string& message)
+{
+    std::istringstream in(source);
+    std::string text;
+    for (int number = 1; std::getline(in, text); ++number) {
+        Line line;
+        line.number = number;
+        if (!split(text, line)) {
+            message = "line " + std::to_string(number) + ": " + error;
+            return false;
+        }
+        if (!line.label.empty() || !line.operation.empty())
+            lines.push_back(line);
+    }
+
+    if (!pass(false) || !pass(true)) {
+        message = error;
+        return false;
+    }
+
+    const auto first = std::find(written.begin(), written.end(), true);
+    if (first == written.end()) {
+        program.origin = 0;
+        program.image.clear();
+        return true;
+    }
+    const size_t begin = static_cast<size_t>(first - written.begin());
+    const size_t end = written.size() - static_cast<size_t>(std::find(written.rbegin(), written.rend(), true) - written.rbegin());
+    program.origin = static_cast<uint16_t>(begin);
+    program.image.assign(memory.begin() + begin, memory.begin() + end);
+    return true;
+}
+
+bool Assemble(const std::string& source, AssembledProgram& program, std::string& error, const std::string& variant)
+{
+    static const OpcodeSet nmos = BuildOpcodeSet(opcodeTable(Nmos6502{}));
+    static const OpcodeSet ricoh = BuildOpcodeSet(opcodeTable(Ricoh2A03{}));
+    static const OpcodeSet cmos = BuildOpcodeSet(opcodeTable(Cmos65C02{}));
+
+    const OpcodeSet* opcodes = variant == "6502" ? &nmos : variant == "2a03" ? &ricoh : variant == "65c02" ? &cmos : nullptr;
+    if (opcodes == nullptr) {
+        error = "unknown variant " + variant;
+        return false;
+    }
+    program = AssembledProgram{};
+    SourceAssembler assembler(*opcodes, program);
+    return assembler.run(source, error);
+}
+
+void LoadProgram(Bus& bus, const AssembledProgram& program)
+{
+    for (size_t i = 0; i < program.image.size(); ++i)
+        bus.write(static_cast<uint16_t>(program.origin + i), program.image[i]);
+}
+
+int RunAssembler(int argc, char** argv)
+{
+    if (argc < 4) {
+        std::cerr << "usage: asm source.s out.bin [variant]" << std::endl;
+        return 2;
+    }
+    std::ifstream in(argv[2]);
+    if (!in) {
+        std::cerr << "Failed to open " << argv[2] << std::endl;
+        return 2;
+    }
+    const std::string source((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+
+    AssembledProgram program;
+    std::string error;
+    if (!Assemble(source, program, error, argc > 4 ? argv[4] : "6502")) {
+        std::cerr << argv[2] << ": " << error << std::endl;
+        return 1;
+    }
+
+    std::ofstream out(argv[3], std::ios::binary);
+    out.write(reinterpret_cast<const char*>(program.image.data()), static_cast<std::streamsize>(program.image.size()));
+    if (!out) {
+        std::cerr << "Failed to write " << argv[3] << std::endl;
+        return 2;
+    }
+    std::cout << "$" << Hex4(program.origin) << ", " << program.image.size() << " byte(s)\n";
+    for (const auto& [name, value] : program.symbols)
+        std::cout << "  " << name << " = $" << Hex4(value) << "\n";
+    return 0;
+}
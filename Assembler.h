@@ -0,0 +1,35 @@
+#pragma once
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+#include "Bus.h"
+
+// Two-pass 6502 assembler. The instruction set is the emulator's own opcode table, so every mnemonic and
+// addressing mode the chosen variant decodes (6502, 2a03 or 65c02) can be assembled and nothing else can.
+//
+//   ; comment                  label:                    NAME = expression
+//   .org expr                  .byte expr|"text", ...    .word expr, ...
+//   .res count [, fill]        .align boundary
+//
+// Operands: #imm, A, zp / abs [,X|,Y], (ind), (zp,X), (zp),Y, (zp) and (abs,X) on the 65C02. Zero page forms
+// are chosen for values known in the first pass to be below $100, forward references get the absolute form.
+// Expressions: $hex, %binary, decimal, 'c', *, symbols, unary - ~ < > and the binary operators
+// * / % + - << >> & ^ | with C precedence, grouped with [ ] (or ( ) where it cannot mean indirection).
+// Mnemonics, registers and directives are case-insensitive, symbols are not.
+
+struct AssembledProgram {
+    uint16_t origin = 0;                       // Address of image[0], the lowest address written
+    std::vector<uint8_t> image;                // Up to the highest address written, gaps are zero
+    std::map<std::string, uint16_t> symbols;   // Labels and assignments
+};
+
+// Assembles source, false with error set to "line N: message" on the first error
+bool Assemble(const std::string& source, AssembledProgram& program, std::string& error,
+              const std::string& variant = "6502");
+
+// Copies the image to the bus at its origin
+void LoadProgram(Bus& bus, const AssembledProgram& program);
+
+// asm source.s out.bin [variant] - assembles a file and prints its origin, size and symbols
+int RunAssembler(int argc, char** argv);
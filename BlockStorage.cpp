@@ -0,0 +1,374 @@
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <iostream>
+
+#include "BlockStorage.h"
+#include "Cpu6502.h"
+#include "DeviceBus.h"
+
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// === MappedImage ===
+
+MappedImage::~MappedImage()
+{
+    close();
+}
+
+#if defined(_WIN32)
+
+bool MappedImage::open(const std::string& path, uint64_t minimumSize)
+{
+    close();
+    HANDLE handle = CreateFileA(path.c_str(), GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ, nullptr, OPEN_ALWAYS,
+                                FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (handle == INVALID_HANDLE_VALUE)
+        return false;
+    file = handle;
+
+    LARGE_INTEGER current;
+    if (!GetFileSizeEx(handle, &current)) {
+        close();
+        return false;
+    }
+    // A mapping larger than the file grows the file
+    const uint64_t size = std::max<uint64_t>(static_cast<uint64_t>(current.QuadPart), minimumSize);
+    mapping = CreateFileMappingA(handle, nullptr, PAGE_READWRITE, static_cast<DWORD>(size >> 32), static_cast<DWORD>(size), nullptr);
+    if (mapping == nullptr) {
+        close();
+        return false;
+    }
+    view = static_cast<uint8_t*>(MapViewOfFile(mapping, FILE_MAP_ALL_ACCESS, 0, 0, 0));
+    if (view == nullptr) {
+        close();
+        return false;
+    }
+    length = size;
+    return true;
+}
+
+void MappedImage::close()
+{
+    if (view != nullptr)
+        UnmapViewOfFile(view);
+    if (mapping != nullptr)
+        CloseHandle(mapping);
+    if (file != nullptr)
+        CloseHandle(file);
+    view = nullptr;
+    mapping = nullptr;
+    file = nullptr;
+    length = 0;
+}
+
+bool MappedImage::sync(uint64_t offset, uint64_t bytes, bool wait)
+{
+    if (!FlushViewOfFile(view + offset, static_cast<SIZE_T>(bytes)))
+        return false;
+    return !wait || FlushFileBuffers(file);
+}
+
+#else
+
+bool MappedImage::open(const std::string& path, uint64_t minimumSize)
+{
+    close();
+    fd = ::open(path.c_str(), O_RDWR | O_CREAT, 0644);
+    if (fd < 0)
+        return false;
+
+    struct stat info;
+    if (fstat(fd, &info) != 0) {
+        close();
+        return false;
+    }
+    uint64_t size = static_cast<uint64_t>(info.st_size);
+    if (size < minimumSize) {
+        if (ftruncate(fd, static_cast<off_t>(minimumSize)) != 0) {
+            close();
+            return false;
+        }
+        size = minimumSize;
+    }
+    if (size == 0) {
+        close();
+        return false;
+    }
+
+    void* address = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (address == MAP_FAILED) {
+        close();
+        return false;
+    }
+    view = static_cast<uint8_t*>(address);
+    length = size;
+    return true;
+}
+
+void MappedImage::close()
+{
+    if (view != nullptr)
+        munmap(view, length);
+    if (fd >= 0)
+        ::close(fd);
+    view = nullptr;
+    length = 0;
+    fd = -1;
+}
+
+bool MappedImage::sync(uint64_t offset, uint64_t bytes, bool wait)
+{
+    // msync works on whole host pages
+    const uint64_t page = static_cast<uint64_t>(sysconf(_SC_PAGESIZE));
+    const uint64_t begin = offset / page * page;
+    return msync(view + begin, offset + bytes - begin, wait ? MS_SYNC : MS_ASYNC) == 0;
+}
+
+#endif
+
+// === BlockDevice ===
+
+BlockDevice::~BlockDevice()
+{
+    flush();
+}
+
+bool BlockDevice::open(const std::string& path, uint32_t sectors)
+{
+    if (!image.open(path, static_cast<uint64_t>(sectors) * SECTOR_SIZE))
+        return false;
+    dirty.assign(getSectors(), false);
+    dirtyCount = 0;
+    return true;
+}
+
+uint8_t BlockDevice::readRegister(uint16_t offset)
+{
+    if (offset < sizeof(registers))
+        return registers[offset];
+    if (offset == 7) {
+        const uint8_t value = status;
+        status &= ~STATUS_DONE;
+        return value;
+    }
+    return control;
+}
+
+void BlockDevice::writeRegister(uint16_t offset, uint8_t data)
+{
+    if (offset < sizeof(registers)) {
+        registers[offset] = data;
+        return;
+    }
+    if (offset != 7) {
+        control = data;
+        return;
+    }
+    if ((status & STATUS_BUSY) || data < COMMAND_READ || data > COMMAND_FLUSH)
+        return;
+
+    command = data;
+    commandSector = registers[0] | (registers[1] << 8) | (registers[2] << 16) | (static_cast<uint32_t>(registers[3]) << 24);
+    commandBuffer = registers[4] | (registers[5] << 8);
+    commandCount = registers[6] == 0 ? 256 : registers[6];
+    status = STATUS_BUSY;
+    completion = syncedCycle + COMMAND_CYCLES + (command == COMMAND_FLUSH ? 0 : CYCLES_PER_SECTOR * commandCount);
+}
+
+size_t BlockDevice::stateSize() const
+{
+    return sizeof(registers) + sizeof(command) + sizeof(commandSector) + sizeof(commandBuffer) + sizeof(commandCount) +
+           sizeof(status) + sizeof(control) + sizeof(completion);
+}
+
+void BlockDevice::saveState(uint8_t* out) const
+{
+    out = putState(out, registers);
+    out = putState(out, command);
+    out = putState(out, commandSector);
+    out = putState(out, commandBuffer);
+    out = putState(out, commandCount);
+    out = putState(out, status);
+    out = putState(out, control);
+    putState(out, completion);
+}
+
+void BlockDevice::loadState(const uint8_t* in)
+{
+    in = getState(in, registers);
+    in = getState(in, command);
+    in = getState(in, commandSector);
+    in = getState(in, commandBuffer);
+    in = getState(in, commandCount);
+    in = getState(in, status);
+    in = getState(in, control);
+    getState(in, completion);
+}
+
+void BlockDevice::advance(uint64_t, uint64_t toCycle)
+{
+    if ((status & STATUS_BUSY) && toCycle >= completion) {
+        // No longer due before the transfer, which catches this device up again if the buffer covers its
+        // registers. It stays busy until the end, so commands written by the transfer itself are ignored.
+        completion = NO_DEADLINE;
+        status = static_cast<uint8_t>(STATUS_DONE | (transfer() ? 0 : STATUS_ERROR));
+    }
+}
+
+bool BlockDevice::transfer()
+{
+    if (command == COMMAND_FLUSH) {
+        syncDirty(true);
+        return true;
+    }
+
+    const uint32_t sector = commandSector;
+    const uint32_t buffer = commandBuffer;
+    const uint32_t count = commandCount;
+    const uint32_t bytes = count * SECTOR_SIZE;
+    if (image.data() == nullptr || static_cast<uint64_t>(sector) + count > getSectors() || buffer + bytes > 0x10000)
+        return false;
+
+    uint8_t* disk = image.data() + static_cast<uint64_t>(sector) * SECTOR_SIZE;
+    uint8_t* ram = bus.getRam().data();
+    const bool reading = command == COMMAND_READ;
+
+    // Sectors read are host input - on replay they come from the log, not from the image
+    const uint8_t* sectors = disk;
+    if (reading) {
+        uint32_t logged = bytes;
+        sectors = bus.logBulkInput(static_cast<uint16_t>(buffer), disk, logged);
+        if (logged != bytes)
+            return false;
+    }
+
+    // Straight between the mapping and RAM, page by page, through the bus only where a device is mapped
+    for (uint32_t done = 0; done < bytes;) {
+        const uint32_t addr = buffer + done;
+        const uint32_t chunk = std::min(bytes - done, 0x100 - (addr & 0xFF));
+        if (bus.isPlainPage(static_cast<uint8_t>(addr >> 8))) {
+            if (reading)
+                std::memcpy(ram + addr, sectors + done, chunk);
+            else
+                std::memcpy(disk + done, ram + addr, chunk);
+        } else {
+            for (uint32_t i = 0; i < chunk; ++i) {
+                if (reading)
+                    bus.write(static_cast<uint16_t>(addr + i), sectors[done + i]);
+                else
+                    disk[done + i] = bus.read(static_cast<uint16_t>(addr + i));
+            }
+        }
+        done += chunk;
+    }
+
+    if (reading) {
+        bus.markDirty(static_cast<uint16_t>(buffer), bytes);
+        sectorsRead += count;
+        return true;
+    }
+    for (uint32_t i = 0; i < count; ++i) {
+        if (!dirty[sector + i]) {
+            dirty[sector + i] = true;
+            ++dirtyCount;
+        }
+    }
+    sectorsWritten += count;
+    if (dirtyCount >= FLUSH_BATCH)
+        syncDirty(false);
+    return true;
+}
+
+void BlockDevice::syncDirty(bool wait)
+{
+    if (dirtyCount == 0)
+        return;
+    // One sync per run of consecutive dirty sectors
+    for (uint32_t first = 0; first < dirty.size();) {
+        if (!dirty[first]) {
+            ++first;
+            continue;
+        }
+        uint32_t last = first;
+        while (last < dirty.size() && dirty[last]) {
+            dirty[last] = false;
+            ++last;
+        }
+        image.sync(static_cast<uint64_t>(first) * SECTOR_SIZE, static_cast<uint64_t>(last - first) * SECTOR_SIZE, wait);
+        ++syncs;
+        first = last;
+    }
+    dirtyCount = 0;
+}
+
+int RunBlockDemo(const std::string& path, unsigned transfers)
+{
+    constexpr uint16_t DISK = 0x5100;
+    constexpr uint16_t DONE = 0x022B;
+
+    DeviceBus bus;
+    BlockDevice disk(bus);
+    if (!disk.open(path, 1024)) {
+        std::cerr << "Failed to map " << path << std::endl;
+        return 2;
+    }
+    bus.attach(&disk, DISK, 9);
+
+    // BUFFER = $1000, COUNT = 16, CONTROL = IRQ, CLI, COMMAND = WRITE, wait for the IRQ flag in $10,
+    // then BUFFER = $2000, COMMAND = READ, wait again, JMP *
+    const uint8_t program[] = { 0xA9, 0x10, 0x8D, 0x05, 0x51, 0xA9, 0x10, 0x8D, 0x06, 0x51, 0xA9, 0x01, 0x8D, 0x08, 0x51,
+                                0x58, 0xA9, 0x02, 0x8D, 0x07, 0x51, 0xA5, 0x10, 0xF0, 0xFC, 0xA9, 0x00, 0x85, 0x10,
+                                0xA9, 0x20, 0x8D, 0x05, 0x51, 0xA9, 0x01, 0x8D, 0x07, 0x51, 0xA5, 0x10, 0xF0, 0xFC,
+                                0x4C, 0x2B, 0x02 };
+    // IRQ at $0300: PHA / LDA STATUS (acknowledge) / STA $11 / INC $10 / PLA / RTI
+    const uint8_t handler[] = { 0x48, 0xAD, 0x07, 0x51, 0x85, 0x11, 0xE6, 0x10, 0x68, 0x40 };
+    for (size_t i = 0; i < sizeof(program); ++i)
+        bus.write(static_cast<uint16_t>(0x0200 + i), program[i]);
+    for (size_t i = 0; i < sizeof(handler); ++i)
+        bus.write(static_cast<uint16_t>(0x0300 + i), handler[i]);
+    bus.write(0xFFFE, 0x00);
+    bus.write(0xFFFF, 0x03);
+    for (uint32_t i = 0; i < 4096; ++i)
+        bus.write(static_cast<uint16_t>(0x1000 + i), static_cast<uint8_t>(i * 5 + (i >> 8)));
+
+    Cpu6502 cpu(&bus);
+    cpu.PC = 0x0200;
+    cpu.SP = 0xFD;
+    cpu.status = 0x24;
+    while (cpu.PC != DONE && cpu.totalCycles < 100000)
+        RunSynced(cpu, bus, cpu.totalCycles + 1);
+
+    const uint8_t* ram = bus.getRam().data();
+    const bool match = cpu.PC == DONE && std::memcmp(ram + 0x1000, ram + 0x2000, 4096) == 0 && ram[0x11] == BlockDevice::STATUS_DONE;
+    std::cout << "guest: 16 sectors written and read back in " << cpu.totalCycles << " cycle(s)"
+              << (match ? "" : " - MISMATCH") << "\n";
+
+    // Raw rate - 64 sector (16 KB) commands issued from the host, alternating reads and writes over the image
+    const auto begin = std::chrono::steady_clock::now();
+    uint64_t cycle = cpu.totalCycles;
+    for (unsigned i = 0; i < transfers; ++i) {
+        const uint32_t sector = (i * 64) % (disk.getSectors() - 64 + 1);
+        const uint8_t values[] = { static_cast<uint8_t>(sector), static_cast<uint8_t>(sector >> 8), 0, 0, 0x00, 0x40, 64 };
+        for (uint16_t r = 0; r < sizeof(values); ++r)
+            disk.writeRegister(r, values[r]);
+        disk.writeRegister(7, (i & 1) ? BlockDevice::COMMAND_WRITE : BlockDevice::COMMAND_READ);
+        cycle = disk.nextDeadline();
+        disk.catchUp(cycle);
+        disk.readRegister(7);
+    }
+    disk.flush();
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+    std::cout << transfers << " transfer(s) of 16 KB: " << transfers * 16.0 / 1024.0 / seconds << " MB/s, "
+              << disk.getSyncs() << " msync(s) for " << disk.getSectorsWritten() << " written sector(s)" << std::endl;
+    return match ? 0 : 1;
+}
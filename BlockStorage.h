@@ -0,0 +1,118 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "Device.h"
+
+class DeviceBus;
+
+// Host file mapped into memory (mmap, MapViewOfFile on Windows) - the disk image of BlockDevice
+class MappedImage {
+public:
+    MappedImage() = default;
+    ~MappedImage();
+    MappedImage(const MappedImage&) = delete;
+    MappedImage& operator=(const MappedImage&) = delete;
+
+    // Maps path read/write, creating it or growing it to minimumSize first
+    bool open(const std::string& path, uint64_t minimumSize);
+    void close();
+
+    uint8_t* data() const { return view; }
+    uint64_t size() const { return length; }
+
+    // Writes [offset, offset + bytes) back to the file - waits for the disk if wait is set, else only schedules it
+    bool sync(uint64_t offset, uint64_t bytes, bool wait);
+
+private:
+    uint8_t* view = nullptr;
+    uint64_t length = 0;
+#if defined(_WIN32)
+    void* file = nullptr;
+    void* mapping = nullptr;
+#else
+    int fd = -1;
+#endif
+};
+
+// Block storage on a mapped disk image, 256 byte sectors so a sector is one guest page. A command runs for a
+// fixed number of cycles, then the sectors are copied between the mapping and guest RAM in one go and
+// completion is signalled in STATUS and, if enabled, on IRQ. Written sectors are tracked and written back
+// with msync in batches of FLUSH_BATCH sectors and on the FLUSH command. Sectors read into RAM go through the
+// bus's InputLog (DeviceBus::logBulkInput), so a replay reads what the recording read whatever the image holds.
+//
+// Registers:
+//   +0..+3 SECTOR    first sector, little-endian
+//   +4/+5  BUFFER    guest address, low byte first
+//   +6     COUNT     sectors, 0 means 256
+//   +7     COMMAND   write: COMMAND_READ, COMMAND_WRITE or COMMAND_FLUSH, ignored while busy. SECTOR, BUFFER
+//                    and COUNT are taken when the command is written.
+//                    read: STATUS, reading it acknowledges STATUS_DONE and the IRQ
+//   +8     CONTROL   CONTROL_IRQ - raise IRQ on completion
+class BlockDevice final : public Device {
+public:
+    static constexpr uint32_t SECTOR_SIZE = 256;
+    static constexpr uint64_t COMMAND_CYCLES = 50;
+    static constexpr uint64_t CYCLES_PER_SECTOR = 16;
+    static constexpr uint32_t FLUSH_BATCH = 64;
+
+    static constexpr uint8_t COMMAND_READ = 0x01;
+    static constexpr uint8_t COMMAND_WRITE = 0x02;
+    static constexpr uint8_t COMMAND_FLUSH = 0x03;
+    static constexpr uint8_t STATUS_BUSY = 0x01;
+    static constexpr uint8_t STATUS_ERROR = 0x02; // Sectors past the image or buffer past $FFFF
+    static constexpr uint8_t STATUS_DONE = 0x80;
+    static constexpr uint8_t CONTROL_IRQ = 0x01;
+
+    explicit BlockDevice(DeviceBus& bus) : bus(bus) {}
+    ~BlockDevice() override;
+
+    // Opens the image, created or grown to at least sectors sectors
+    bool open(const std::string& path, uint32_t sectors);
+    uint32_t getSectors() const { return static_cast<uint32_t>(image.size() / SECTOR_SIZE); }
+
+    uint8_t readRegister(uint16_t offset) override;
+    void writeRegister(uint16_t offset, uint8_t data) override;
+    uint64_t nextDeadline() const override { return (status & STATUS_BUSY) ? completion : NO_DEADLINE; }
+    bool irqAsserted() const override { return (control & CONTROL_IRQ) && (status & STATUS_DONE); }
+    // Registers and the command in flight - the image is host storage, a restore does not undo written sectors
+    size_t stateSize() const override;
+    void saveState(uint8_t* out) const override;
+    void loadState(const uint8_t* in) override;
+
+    // Writes every dirty sector back, waiting for the disk
+    void flush() { syncDirty(true); }
+
+    uint64_t getSectorsRead() const { return sectorsRead; }
+    uint64_t getSectorsWritten() const { return sectorsWritten; }
+    uint64_t getSyncs() const { return syncs; }
+
+protected:
+    void advance(uint64_t fromCycle, uint64_t toCycle) override;
+
+private:
+    // Runs the pending command, false if its range does not fit
+    bool transfer();
+    void syncDirty(bool wait);
+
+    DeviceBus& bus;
+    MappedImage image;
+    std::vector<bool> dirty;
+    uint32_t dirtyCount = 0;
+
+    uint8_t registers[7] = {};
+    uint8_t command = 0;
+    uint32_t commandSector = 0; // SECTOR, BUFFER and COUNT as of the command
+    uint32_t commandBuffer = 0;
+    uint32_t commandCount = 0;
+    uint8_t status = 0;
+    uint8_t control = 0;
+    uint64_t completion = NO_DEADLINE;
+
+    uint64_t sectorsRead = 0;
+    uint64_t sectorsWritten = 0;
+    uint64_t syncs = 0;
+};
+
+// blockdev image [transfers] - a guest writes 4 KB and reads it back on IRQ, then the raw transfer rate
+int RunBlockDemo(const std::string& path, unsigned transfers = 20000);
@@ -7,4 +7,23 @@ public:
 
     virtual uint8_t read(uint16_t addr) = 0;
     virtual void write(uint16_t addr, uint8_t data) = 0;
+
+    // Opcode fetch - the first read of every instruction. Buses that tell code from data apart override it,
+    // wrappers forward it to the bus they wrap.
+    virtual uint8_t fetch(uint16_t addr) { return read(addr); }
+
+    // True if reading addr has no side effects and its value only changes through CPU writes or scheduled events.
+    // The CPU only fast-forwards idle loops whose code and polled data are plain memory.
+    virtual bool isPlainMemory(uint16_t) const { return false; }
+
+    // Read of plain memory by the CPU itself (idle loop detection), not by the program. Only called where
+    // isPlainMemory is true; buses that count or trace accesses must not count it.
+    virtual uint8_t peek(uint16_t addr) { return read(addr); }
+
+    // CPU cycle of the instruction being executed - set by the CPU so devices behind the bus can catch up to it
+    void setCycle(uint64_t cycle) { currentCycle = cycle; }
+    uint64_t getCycle() const { return currentCycle; }
+
+protected:
+    uint64_t currentCycle = 0;
 };
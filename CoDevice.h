@@ -0,0 +1,87 @@
+#pragma once
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <utility>
+
+// Coroutine devices - a device is written as straight-line code that co_awaits cycle counts, and the
+// CoScheduler resumes it when the emulated clock reaches that point. Frames come from a per-thread pool,
+// and resuming never allocates.
+
+class CoScheduler;
+
+// Fixed-size block allocator for coroutine frames. Blocks are carved from chunks that are never returned
+// to the heap, so creating and destroying device coroutines in steady state does not touch the heap.
+// One pool per thread - a frame must be destroyed on the thread that created it.
+class FramePool {
+public:
+    static constexpr size_t BLOCK_SIZE = 512;
+    static constexpr size_t BLOCKS_PER_CHUNK = 64;
+
+    static FramePool& local();
+
+    void* allocate(size_t size);
+    void deallocate(void* block, size_t size);
+
+    ~FramePool();
+
+private:
+    struct FreeBlock {
+        FreeBlock* next;
+    };
+
+    FreeBlock* freeList = nullptr;
+    void** chunks = nullptr; // singly linked through the first word of each chunk
+};
+
+class DeviceTask {
+public:
+    struct promise_type {
+        CoScheduler* scheduler = nullptr;
+        uint64_t wakeCycle = 0;
+
+        DeviceTask get_return_object() { return DeviceTask(std::coroutine_handle<promise_type>::from_promise(*this)); }
+        std::suspend_always initial_suspend() noexcept { return {}; }
+        std::suspend_always final_suspend() noexcept { return {}; }
+        void return_void() {}
+        void unhandled_exception() { std::terminate(); }
+
+        static void* operator new(size_t size) { return FramePool::local().allocate(size); }
+        static void operator delete(void* frame, size_t size) { FramePool::local().deallocate(frame, size); }
+    };
+
+    using Handle = std::coroutine_handle<promise_type>;
+
+    DeviceTask() = default;
+    explicit DeviceTask(Handle h) : handle(h) {}
+    DeviceTask(DeviceTask&& other) noexcept : handle(std::exchange(other.handle, nullptr)) {}
+    DeviceTask& operator=(DeviceTask&& other) noexcept {
+        if (this != &other) {
+            if (handle)
+                handle.destroy();
+            handle = std::exchange(other.handle, nullptr);
+        }
+        return *this;
+    }
+    DeviceTask(const DeviceTask&) = delete;
+    DeviceTask& operator=(const DeviceTask&) = delete;
+    ~DeviceTask() {
+        if (handle)
+            handle.destroy();
+    }
+
+    Handle getHandle() const { return handle; }
+
+private:
+    Handle handle = nullptr;
+};
+
+// co_await WaitCycles{n} - suspends the device for n cycles after its current timestamp
+struct WaitCycles {
+    uint64_t cycles;
+
+    bool await_ready() const noexcept { return cycles == 0; }
+    void await_suspend(DeviceTask::Handle h);
+    void await_resume() const noexcept {}
+};
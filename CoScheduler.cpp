@@ -0,0 +1,104 @@
+#include <algorithm>
+#include <cstddef>
+#include <new>
+
+#include "CoScheduler.h"
+
+FramePool& FramePool::local()
+{
+    thread_local FramePool pool;
+    return pool;
+}
+
+void* FramePool::allocate(size_t size)
+{
+    // Unusually large frames (big locals held across a co_await) go to the heap
+    if (size > BLOCK_SIZE) {
+        return ::operator new(size);
+    }
+
+    if (freeList == nullptr) {
+        // Chunk layout: link to the previous chunk, padded to keep the blocks at new's default alignment
+        constexpr size_t header = alignof(std::max_align_t);
+        void** chunk = static_cast<void**>(::operator new(header + BLOCK_SIZE * BLOCKS_PER_CHUNK));
+        *chunk = chunks;
+        chunks = chunk;
+
+        char* blocks = reinterpret_cast<char*>(chunk) + header;
+        for (size_t i = 0; i < BLOCKS_PER_CHUNK; ++i) {
+            FreeBlock* block = reinterpret_cast<FreeBlock*>(blocks + i * BLOCK_SIZE);
+            block->next = freeList;
+            freeList = block;
+        }
+    }
+
+    FreeBlock* block = freeList;
+    freeList = block->next;
+    return block;
+}
+
+void FramePool::deallocate(void* block, size_t size)
+{
+    if (size > BLOCK_SIZE) {
+        ::operator delete(block);
+        return;
+    }
+
+    FreeBlock* freed = static_cast<FreeBlock*>(block);
+    freed->next = freeList;
+    freeList = freed;
+}
+
+FramePool::~FramePool()
+{
+    while (chunks != nullptr) {
+        void** chunk = chunks;
+        chunks = static_cast<void**>(*chunk);
+        ::operator delete(chunk);
+    }
+}
+
+void WaitCycles::await_suspend(DeviceTask::Handle h)
+{
+    DeviceTask::promise_type& promise = h.promise();
+    promise.wakeCycle += cycles;
+    promise.scheduler->schedule(h);
+}
+
+void CoScheduler::spawn(DeviceTask task)
+{
+    DeviceTask::Handle h = task.getHandle();
+    h.promise().scheduler = this;
+    h.promise().wakeCycle = currentCycle;
+    tasks.push_back(std::move(task));
+
+    // Every device has at most one pending wake-up, so this is the only place the queue grows
+    queue.reserve(tasks.size());
+    schedule(h);
+}
+
+void CoScheduler::schedule(DeviceTask::Handle h)
+{
+    queue.push_back({ h.promise().wakeCycle, nextSequence++, h });
+    std::push_heap(queue.begin(), queue.end(), later);
+}
+
+void CoScheduler::runUntil(uint64_t cycle)
+{
+    while (!queue.empty() && queue.front().wakeCycle <= cycle) {
+        std::pop_heap(queue.begin(), queue.end(), later);
+        const Entry due = queue.back();
+        queue.pop_back();
+
+        currentCycle = due.wakeCycle;
+        due.handle.resume();
+    }
+    currentCycle = std::max(currentCycle, cycle);
+}
+
+CoSchedulerDevice::CoSchedulerDevice(CoScheduler& scheduler, CoRegisters& registers)
+    : scheduler(scheduler), registers(registers)
+{
+    // Devices due now start right away, so the deadline is always past the synced cycle
+    scheduler.runUntil(scheduler.now());
+}
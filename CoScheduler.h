@@ -0,0 +1,77 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+#include "CoDevice.h"
+#include "Device.h"
+
+// Runs coroutine devices in cycle timestamp order. Devices run at exactly the cycle they waited for. To
+// interleave them with the CPU, map the scheduler on a DeviceBus through CoSchedulerDevice.
+class CoScheduler {
+public:
+    static constexpr uint64_t NO_WAKE = ~0ull;
+
+    // Takes ownership of a device coroutine and starts it at the current cycle
+    void spawn(DeviceTask task);
+
+    // Timestamp of the device being resumed, or of the last runUntil()
+    uint64_t now() const { return currentCycle; }
+
+    // Earliest pending wake-up, NO_WAKE if every device finished
+    uint64_t nextWake() const { return queue.empty() ? NO_WAKE : queue.front().wakeCycle; }
+
+    // Resumes every device due at or before cycle, in timestamp order
+    void runUntil(uint64_t cycle);
+
+    // Called by WaitCycles
+    void schedule(DeviceTask::Handle h);
+
+private:
+    struct Entry {
+        uint64_t wakeCycle;
+        uint64_t sequence; // keeps devices due at the same cycle in FIFO order
+        DeviceTask::Handle handle;
+    };
+
+    // Min-heap order for std::push_heap/pop_heap
+    static bool later(const Entry& a, const Entry& b) {
+        return a.wakeCycle != b.wakeCycle ? a.wakeCycle > b.wakeCycle : a.sequence > b.sequence;
+    }
+
+    std::vector<DeviceTask> tasks;
+    std::vector<Entry> queue;
+    uint64_t currentCycle = 0;
+    uint64_t nextSequence = 0;
+};
+
+// What the CPU sees of a group of coroutine devices - their registers and IRQ line, kept in state the
+// coroutines update
+class CoRegisters {
+public:
+    virtual ~CoRegisters() = default;
+
+    virtual uint8_t readRegister(uint16_t offset) = 0;
+    virtual void writeRegister(uint16_t offset, uint8_t data) = 0;
+    virtual bool irqAsserted() const { return false; }
+};
+
+// A scheduler's devices as one Device on a DeviceBus. Catching up resumes every coroutine due up to the cycle and
+// the deadline is the next wake-up, so RunSynced runs them at their timestamps, before any register access and
+// before the IRQ line is sampled. Spawn the devices before attaching. Coroutine frames cannot be saved, so a
+// machine with one does not snapshot.
+class CoSchedulerDevice final : public Device {
+public:
+    CoSchedulerDevice(CoScheduler& scheduler, CoRegisters& registers);
+
+    uint8_t readRegister(uint16_t offset) override { return registers.readRegister(offset); }
+    void writeRegister(uint16_t offset, uint8_t data) override { registers.writeRegister(offset, data); }
+    uint64_t nextDeadline() const override { return scheduler.nextWake(); }
+    bool irqAsserted() const override { return registers.irqAsserted(); }
+    bool canSaveState() const override { return false; }
+
+protected:
+    void advance(uint64_t, uint64_t toCycle) override { scheduler.runUntil(toCycle); }
+
+private:
+    CoScheduler& scheduler;
+    CoRegisters& registers;
+};
@@ -0,0 +1,358 @@
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <vector>
+
+#include "Assembler.h"
+#include "CoroutineBench.h"
+#include "CoScheduler.h"
+#include "Cpu6502.h"
+#include "DeviceBus.h"
+#include "StateHash.h"
+
+// Serial receiver model - samples one bit every BIT_CYCLES, and after 8 bits stores the byte and
+// stays idle for GAP_CYCLES before the next start bit
+static constexpr uint64_t BIT_CYCLES = 16;
+static constexpr uint64_t GAP_CYCLES = 100;
+
+// Registers of the receiver: +0 STATUS (1 while a byte is waiting; writing bit 0 enables IRQ while it waits),
+// +1 DATA (reading it clears STATUS). A byte arriving while the previous one is still waiting replaces it and
+// counts as an overrun.
+class SerialPort final : public CoRegisters {
+public:
+    uint8_t data = 0;
+    bool ready = false;
+    bool irqEnable = false;
+    uint64_t overruns = 0;
+
+    void deliver(uint8_t byte) {
+        if (ready)
+            ++overruns;
+        data = byte;
+        ready = true;
+    }
+
+    uint8_t readRegister(uint16_t offset) override {
+        if (offset == 0)
+            return ready ? 1 : 0;
+        ready = false;
+        return data;
+    }
+    void writeRegister(uint16_t offset, uint8_t value) override {
+        if (offset == 0)
+            irqEnable = value & 1;
+    }
+    bool irqAsserted() const override { return irqEnable && ready; }
+};
+
+struct SerialState {
+    SerialPort* port = nullptr; // Receives every byte, if set
+    uint32_t line = 0x12345678; // xorshift32 stands in for the input pin
+    uint8_t shift = 0;
+    uint64_t received = 0;
+    uint32_t checksum = 0;
+    uint64_t events = 0;
+
+    void sampleBit() {
+        line ^= line << 13;
+        line ^= line >> 17;
+        line ^= line << 5;
+        shift = static_cast<uint8_t>((shift >> 1) | ((line & 1) << 7));
+        ++events;
+    }
+
+    void storeByte() {
+        ++received;
+        checksum = checksum * 31 + shift;
+        if (port)
+            port->deliver(shift);
+    }
+};
+
+static DeviceTask SerialReceiver(SerialState& st)
+{
+    for (;;) {
+        for (int bit = 0; bit < 8; ++bit) {
+            co_await WaitCycles{ BIT_CYCLES };
+            st.sampleBit();
+        }
+        st.storeByte();
+        co_await WaitCycles{ GAP_CYCLES };
+    }
+}
+
+// The same device as an explicit state machine - step() runs one event and returns the next wake cycle
+struct SerialStateMachine {
+    enum class Phase : uint8_t { Bits, Gap };
+
+    SerialState st;
+    Phase phase = Phase::Bits;
+    int bit = 0;
+
+    uint64_t step(uint64_t now) {
+        switch (phase) {
+        case Phase::Bits:
+            st.sampleBit();
+            if (++bit == 8) {
+                st.storeByte();
+                bit = 0;
+                phase = Phase::Gap;
+                return now + GAP_CYCLES;
+            }
+            return now + BIT_CYCLES;
+        case Phase::Gap:
+        default:
+            phase = Phase::Bits;
+            return now + BIT_CYCLES;
+        }
+    }
+};
+
+// The state machine on a DeviceBus - catching up runs its events up to the cycle
+class SerialMachineDevice final : public Device {
+public:
+    explicit SerialMachineDevice(SerialPort& port) : port(port) { machine.st.port = &port; }
+
+    uint8_t readRegister(uint16_t offset) override { return port.readRegister(offset); }
+    void writeRegister(uint16_t offset, uint8_t data) override { port.writeRegister(offset, data); }
+    uint64_t nextDeadline() const override { return wake; }
+    bool irqAsserted() const override { return port.irqAsserted(); }
+
+    const SerialState& state() const { return machine.st; }
+
+protected:
+    void advance(uint64_t, uint64_t toCycle) override {
+        while (wake <= toCycle)
+            wake = machine.step(wake);
+    }
+
+private:
+    SerialPort& port;
+    SerialStateMachine machine;
+    uint64_t wake = BIT_CYCLES;
+};
+
+// Polls the receiver and adds up the bytes it reads
+static const char* const POLL_SOURCE = R"(
+STATUS  = $6000
+DATA    = $6001
+sum     = $00
+count   = $02
+polls   = $04   ; Empty polls - when the bytes arrived, not just what they were
+
+        .org $8000
+reset:  ldx #$FF
+        txs
+        lda #0
+        sta sum
+        sta sum+1
+        sta count
+        sta count+1
+        sta polls
+        sta polls+1
+poll:   lda STATUS
+        bne ready
+        inc polls
+        bne poll
+        inc polls+1
+        jmp poll
+ready:  lda DATA
+        clc
+        adc sum
+        sta sum
+        bcc counted
+        inc sum+1
+counted:
+        inc count
+        bne poll
+        inc count+1
+        jmp poll
+
+        .org $FFFA
+        .word reset, reset, reset
+)";
+
+// Waits in a counting loop and takes the bytes in the IRQ handler - only sees them if the device's deadline
+// and IRQ line reach the run loop
+static const char* const IRQ_SOURCE = R"(
+CONTROL = $6000
+DATA    = $6001
+sum     = $00
+count   = $02
+polls   = $04   ; Wait loop iterations
+
+        .org $8000
+reset:  ldx #$FF
+        txs
+        lda #0
+        sta sum
+        sta sum+1
+        sta count
+        sta count+1
+        sta polls
+        sta polls+1
+        lda #1
+        sta CONTROL
+        cli
+wait:   inc polls
+        bne wait
+        inc polls+1
+        jmp wait
+
+irq:    pha
+        lda DATA
+        clc
+        adc sum
+        sta sum
+        bcc counted
+        inc sum+1
+counted:
+        inc count
+        bne done
+        inc count+1
+done:   pla
+        rti
+
+        .org $FFFA
+        .word reset, reset, irq
+)";
+
+constexpr uint16_t SERIAL_PORT = 0x6000;
+
+// What a guest run ends with - the same for both devices if they behave the same
+struct GuestResult {
+    uint16_t sum = 0;
+    uint16_t count = 0;
+    uint16_t polls = 0;
+    uint64_t received = 0;
+    uint32_t checksum = 0;
+    uint64_t overruns = 0;
+    uint64_t machineHash = 0;
+    double seconds = 0;
+
+    bool operator==(const GuestResult& o) const {
+        return sum == o.sum && count == o.count && polls == o.polls && received == o.received &&
+            checksum == o.checksum && overruns == o.overruns && machineHash == o.machineHash;
+    }
+};
+
+// Runs a guest against one receiver, coroutine or state machine
+static GuestResult RunSerialGuest(const AssembledProgram& program, uint64_t cycles, bool coroutine)
+{
+    DeviceBus bus;
+    SerialPort port;
+    SerialState coState;
+    coState.port = &port;
+    CoScheduler scheduler;
+    scheduler.spawn(SerialReceiver(coState));
+    CoSchedulerDevice coDevice(scheduler, port);
+    SerialMachineDevice machineDevice(port);
+    bus.attach(coroutine ? static_cast<Device*>(&coDevice) : &machineDevice, SERIAL_PORT, 2);
+    LoadProgram(bus, program);
+    Cpu6502 cpu(&bus);
+    cpu.reset();
+
+    const auto begin = std::chrono::steady_clock::now();
+    RunSynced(cpu, bus, cycles);
+    GuestResult result;
+    result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+
+    auto word = [&](const char* symbol) {
+        const uint16_t addr = program.symbols.at(symbol);
+        return static_cast<uint16_t>(bus.getRam().read(addr) | (bus.getRam().read(static_cast<uint16_t>(addr + 1)) << 8));
+    };
+    const SerialState& st = coroutine ? coState : machineDevice.state();
+    result.sum = word("sum");
+    result.count = word("count");
+    result.polls = word("polls");
+    result.received = st.received;
+    result.checksum = st.checksum;
+    result.overruns = port.overruns;
+    result.machineHash = bus.hashState(HashCpuRegisters(cpu));
+    return result;
+}
+
+int RunCoroutineBench(uint64_t cycles, unsigned devices)
+{
+    using Clock = std::chrono::steady_clock;
+
+    // Coroutine devices
+    std::vector<SerialState> coStates(devices);
+    CoScheduler scheduler;
+    for (SerialState& st : coStates)
+        scheduler.spawn(SerialReceiver(st));
+
+    auto begin = Clock::now();
+    scheduler.runUntil(cycles);
+    const double coSeconds = std::chrono::duration<double>(Clock::now() - begin).count();
+
+    // State machine devices behind an equivalent timestamp heap - each starts with the wait before its first bit
+    struct Wake {
+        uint64_t cycle;
+        uint64_t sequence;
+        unsigned index;
+    };
+    auto later = [](const Wake& a, const Wake& b) {
+        return a.cycle != b.cycle ? a.cycle > b.cycle : a.sequence > b.sequence;
+    };
+
+    std::vector<SerialStateMachine> machines(devices);
+    std::vector<Wake> heap;
+    heap.reserve(devices);
+    uint64_t sequence = 0;
+    for (unsigned i = 0; i < devices; ++i)
+        heap.push_back({ BIT_CYCLES, sequence++, i });
+    std::make_heap(heap.begin(), heap.end(), later);
+
+    begin = Clock::now();
+    while (!heap.empty() && heap.front().cycle <= cycles) {
+        std::pop_heap(heap.begin(), heap.end(), later);
+        Wake& due = heap.back();
+        due.cycle = machines[due.index].step(due.cycle);
+        due.sequence = sequence++;
+        std::push_heap(heap.begin(), heap.end(), later);
+    }
+    const double smSeconds = std::chrono::duration<double>(Clock::now() - begin).count();
+
+    uint64_t coEvents = 0, smEvents = 0;
+    bool match = true;
+    for (unsigned i = 0; i < devices; ++i) {
+        coEvents += coStates[i].events;
+        smEvents += machines[i].st.events;
+        match = match && coStates[i].checksum == machines[i].st.checksum && coStates[i].received == machines[i].st.received;
+    }
+
+    std::cout << devices << " device(s), " << cycles << " cycle(s)\n";
+    std::cout << "coroutine:     " << coEvents << " events in " << coSeconds << " s ("
+              << coEvents / std::max(coSeconds, 1e-9) / 1e6 << " M events/s)\n";
+    std::cout << "state machine: " << smEvents << " events in " << smSeconds << " s ("
+              << smEvents / std::max(smSeconds, 1e-9) / 1e6 << " M events/s)\n";
+    std::cout << (match ? "results match" : "RESULTS DIFFER") << std::endl;
+
+    // A guest using one receiver of each kind on the bus must end in the same state, having read every byte
+    struct Guest {
+        const char* name;
+        const char* source;
+    };
+    const Guest guests[] = { { "polling", POLL_SOURCE }, { "interrupt", IRQ_SOURCE } };
+    const uint64_t guestCycles = std::max<uint64_t>(cycles / 10, 1);
+    bool guestMatch = true;
+    for (const Guest& guest : guests) {
+        AssembledProgram program;
+        std::string error;
+        if (!Assemble(guest.source, program, error)) {
+            std::cerr << "cobench: " << error << std::endl;
+            return 2;
+        }
+        const GuestResult co = RunSerialGuest(program, guestCycles, true);
+        const GuestResult sm = RunSerialGuest(program, guestCycles, false);
+        // The count is a 16 bit word, the last byte may still be waiting
+        const bool same = co == sm && co.overruns == 0 && static_cast<uint16_t>(co.received - co.count) <= 1;
+        std::cout << guest.name << " guest, " << guestCycles << " cycle(s): " << co.count
+                  << " byte(s) read, coroutine " << guestCycles / std::max(co.seconds, 1e-9) / 1e6
+                  << " MHz, state machine " << guestCycles / std::max(sm.seconds, 1e-9) / 1e6 << " MHz\n";
+        guestMatch = guestMatch && same;
+    }
+    std::cout << (guestMatch ? "guest results match" : "GUEST RESULTS DIFFER") << std::endl;
+    return match && guestMatch ? 0 : 1;
+}
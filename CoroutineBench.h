@@ -0,0 +1,8 @@
+#pragma once
+#include <cstdint>
+
+// Runs the same serial-receiver device written as a coroutine and as a hand-written state machine,
+// checks that both produce the same result and reports device events per second. Then maps each on a
+// DeviceBus (CoSchedulerDevice for the coroutine) under a guest that polls it and one that takes its IRQ, for
+// cycles / 10 cycles each, and checks that both runs end in the same machine state with every byte read.
+int RunCoroutineBench(uint64_t cycles = 100000000, unsigned devices = 64);
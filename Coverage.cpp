@@ -0,0 +1,133 @@
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+#include "Coverage.h"
+
+static constexpr char COVERAGE_MAGIC[8] = { 'C', 'O', 'V', '6', '5', '0', '2', 1 };
+
+CoverageClass Classify(const Coverage& coverage, uint16_t addr)
+{
+    const bool code = coverage.executes[addr] != 0;
+    const bool data = coverage.reads[addr] != 0 || coverage.writes[addr] != 0;
+    if (code)
+        return data ? CoverageClass::CodeData : CoverageClass::Code;
+    return data ? CoverageClass::Data : CoverageClass::Unused;
+}
+
+const char* ClassName(CoverageClass type)
+{
+    switch (type) {
+    case CoverageClass::Code: return "code";
+    case CoverageClass::Data: return "data";
+    case CoverageClass::CodeData: return "code+data";
+    default: return "unused";
+    }
+}
+
+static void WriteCounters(std::ofstream& out, const std::array<uint32_t, Coverage::SIZE>& counters)
+{
+    std::vector<uint8_t> bytes(Coverage::SIZE * 4);
+    for (size_t i = 0; i < Coverage::SIZE; ++i) {
+        for (size_t b = 0; b < 4; ++b)
+            bytes[i * 4 + b] = static_cast<uint8_t>(counters[i] >> (8 * b));
+    }
+    out.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+}
+
+static bool ReadCounters(std::ifstream& in, std::array<uint32_t, Coverage::SIZE>& counters)
+{
+    std::vector<uint8_t> bytes(Coverage::SIZE * 4);
+    if (!in.read(reinterpret_cast<char*>(bytes.data()), static_cast<std::streamsize>(bytes.size())))
+        return false;
+    for (size_t i = 0; i < Coverage::SIZE; ++i) {
+        counters[i] = 0;
+        for (size_t b = 0; b < 4; ++b)
+            counters[i] |= static_cast<uint32_t>(bytes[i * 4 + b]) << (8 * b);
+    }
+    return true;
+}
+
+bool SaveCoverage(const Coverage& coverage, const std::string& path)
+{
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    if (!out)
+        return false;
+    out.write(COVERAGE_MAGIC, sizeof(COVERAGE_MAGIC));
+    WriteCounters(out, coverage.reads);
+    WriteCounters(out, coverage.writes);
+    WriteCounters(out, coverage.executes);
+
+    std::vector<uint8_t> bitmap(Coverage::SIZE / 8);
+    for (size_t i = 0; i < Coverage::SIZE; ++i) {
+        if (coverage.opcodes.test(i))
+            bitmap[i / 8] |= static_cast<uint8_t>(1 << (i % 8));
+    }
+    out.write(reinterpret_cast<const char*>(bitmap.data()), static_cast<std::streamsize>(bitmap.size()));
+    return static_cast<bool>(out);
+}
+
+bool LoadCoverage(const std::string& path, Coverage& coverage)
+{
+    std::ifstream in(path, std::ios::binary);
+    char magic[sizeof(COVERAGE_MAGIC)];
+    if (!in.read(magic, sizeof(magic)) || !std::equal(magic, magic + sizeof(magic), COVERAGE_MAGIC))
+        return false;
+    if (!ReadCounters(in, coverage.reads) || !ReadCounters(in, coverage.writes) || !ReadCounters(in, coverage.executes))
+        return false;
+
+    std::vector<uint8_t> bitmap(Coverage::SIZE / 8);
+    if (!in.read(reinterpret_cast<char*>(bitmap.data()), static_cast<std::streamsize>(bitmap.size())))
+        return false;
+    for (size_t i = 0; i < Coverage::SIZE; ++i)
+        coverage.opcodes.set(i, (bitmap[i / 8] >> (i % 8)) & 1);
+    return true;
+}
+
+bool SaveCoverageCsv(const Coverage& coverage, const std::string& path)
+{
+    std::ofstream out(path, std::ios::trunc);
+    if (!out)
+        return false;
+    out << "address,reads,writes,executes,opcode,class\n";
+    for (size_t i = 0; i < Coverage::SIZE; ++i) {
+        const uint16_t addr = static_cast<uint16_t>(i);
+        const CoverageClass type = Classify(coverage, addr);
+        if (type == CoverageClass::Unused)
+            continue;
+        out << std::hex << std::uppercase << std::setfill('0') << std::setw(4) << i << std::dec << ","
+            << coverage.reads[i] << "," << coverage.writes[i] << "," << coverage.executes[i] << ","
+            << (coverage.opcodes.test(i) ? 1 : 0) << "," << ClassName(type) << "\n";
+    }
+    return static_cast<bool>(out);
+}
+
+void PrintCoverageSummary(const Coverage& coverage, size_t hottest)
+{
+    size_t counts[4] = {};
+    std::vector<uint16_t> data;
+    for (size_t i = 0; i < Coverage::SIZE; ++i) {
+        const CoverageClass type = Classify(coverage, static_cast<uint16_t>(i));
+        ++counts[static_cast<size_t>(type)];
+        if (type == CoverageClass::Data || type == CoverageClass::CodeData)
+            data.push_back(static_cast<uint16_t>(i));
+    }
+
+    std::cout << counts[static_cast<size_t>(CoverageClass::Code)] << " code byte(s), "
+              << counts[static_cast<size_t>(CoverageClass::Data)] << " data byte(s), "
+              << counts[static_cast<size_t>(CoverageClass::CodeData)] << " code+data byte(s), "
+              << coverage.opcodes.count() << " instruction start(s)\n";
+
+    // Hottest by data accesses, ties to the lower address
+    auto accesses = [&](uint16_t addr) { return static_cast<uint64_t>(coverage.reads[addr]) + coverage.writes[addr]; };
+    const size_t shown = std::min(hottest, data.size());
+    std::partial_sort(data.begin(), data.begin() + static_cast<std::ptrdiff_t>(shown), data.end(),
+        [&](uint16_t a, uint16_t b) { return accesses(a) != accesses(b) ? accesses(a) > accesses(b) : a < b; });
+    for (size_t i = 0; i < shown; ++i) {
+        std::cout << "  $" << std::hex << std::uppercase << std::setfill('0') << std::setw(4) << data[i] << std::dec
+                  << "  " << coverage.reads[data[i]] << " read(s), " << coverage.writes[data[i]] << " write(s)\n";
+    }
+    std::cout << std::setfill(' ') << std::flush;
+}
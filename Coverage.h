@@ -0,0 +1,90 @@
+#pragma once
+#include <array>
+#include <bitset>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include "Bus.h"
+
+// Per-address access counters - data reads, writes and instruction fetches for all 64 KB. Operand bytes count
+// as instruction fetches, opcode bytes are also marked as instruction starts. Counters saturate instead of
+// wrapping, so a long run only flattens the hottest addresses.
+struct Coverage {
+    static constexpr size_t SIZE = 0x10000;
+
+    std::array<uint32_t, SIZE> reads{};
+    std::array<uint32_t, SIZE> writes{};
+    std::array<uint32_t, SIZE> executes{};
+    std::bitset<SIZE> opcodes; // Addresses an instruction was fetched from
+
+    void clear() { reads.fill(0); writes.fill(0); executes.fill(0); opcodes.reset(); }
+};
+
+enum class CoverageClass : uint8_t {
+    Unused,
+    Code,     // Fetched as an instruction only
+    Data,     // Read or written, never fetched as an instruction
+    CodeData, // Both - self-modifying code, or tables and operands read as data
+};
+
+CoverageClass Classify(const Coverage& coverage, uint16_t addr);
+const char* ClassName(CoverageClass type);
+
+// Forwards to the machine's bus and counts every access. Coverage is turned on by connecting the CPU to this
+// bus and off by connecting it back to the inner one, so a machine without it pays nothing. Reads of the two
+// bytes after an opcode, before the instruction touches anything else, are its operands and counted as fetches.
+// Peeks are forwarded uncounted, so idle loop detection leaves the counters as the program made them.
+class CoverageBus final : public Bus {
+public:
+    explicit CoverageBus(Bus& inner) : inner(inner), coverage(std::make_unique<Coverage>()) {}
+
+    uint8_t read(uint16_t addr) override {
+        inner.setCycle(currentCycle);
+        const uint16_t offset = static_cast<uint16_t>(addr - opcodeAddr);
+        if (operandWindow && (offset == 1 || offset == 2)) {
+            Bump(coverage->executes[addr]);
+        } else {
+            operandWindow = false;
+            Bump(coverage->reads[addr]);
+        }
+        return inner.read(addr);
+    }
+    void write(uint16_t addr, uint8_t data) override {
+        inner.setCycle(currentCycle);
+        operandWindow = false;
+        Bump(coverage->writes[addr]);
+        inner.write(addr, data);
+    }
+    uint8_t fetch(uint16_t addr) override {
+        inner.setCycle(currentCycle);
+        opcodeAddr = addr;
+        operandWindow = true;
+        Bump(coverage->executes[addr]);
+        coverage->opcodes.set(addr);
+        return inner.fetch(addr);
+    }
+    bool isPlainMemory(uint16_t addr) const override { return inner.isPlainMemory(addr); }
+    uint8_t peek(uint16_t addr) override { return inner.peek(addr); }
+
+    const Coverage& getCoverage() const { return *coverage; }
+    void clear() { coverage->clear(); }
+
+private:
+    static void Bump(uint32_t& counter) { counter += counter != UINT32_MAX; }
+
+    Bus& inner;
+    std::unique_ptr<Coverage> coverage; // 800 KB, kept off the stack
+    uint16_t opcodeAddr = 0;
+    bool operandWindow = false; // Until the first access that is not to the two bytes after the opcode
+};
+
+// Binary heatmap: "COV6502" and a version byte, the reads, writes and executes arrays as little-endian uint32,
+// then the opcode bitmap as 8 KB, lowest address in bit 0 of the first byte
+bool SaveCoverage(const Coverage& coverage, const std::string& path);
+bool LoadCoverage(const std::string& path, Coverage& coverage);
+
+// CSV heatmap of every touched address: address,reads,writes,executes,opcode,class
+bool SaveCoverageCsv(const Coverage& coverage, const std::string& path);
+
+// Byte counts per class, the instruction starts and the hottest data addresses on stdout
+void PrintCoverageSummary(const Coverage& coverage, size_t hottest = 8);
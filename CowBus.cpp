@@ -0,0 +1,152 @@
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <vector>
+
+#include "Cpu6502.h"
+#include "CowBus.h"
+
+CowBus::Page* CowBus::zeroPage()
+{
+    // One reference is held by the static itself, so it never reaches zero
+    static Page page;
+    return &page;
+}
+
+void CowBus::release(Page* page)
+{
+    if (page->refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        delete page;
+    }
+}
+
+CowBus::CowBus()
+{
+    Page* zero = zeroPage();
+    zero->refs.fetch_add(PAGES, std::memory_order_relaxed);
+    pages.fill(zero);
+}
+
+CowBus::~CowBus()
+{
+    for (Page* page : pages) {
+        release(page);
+    }
+}
+
+CowBus::CowBus(const CowBus& other) : Bus(other), pages(other.pages)
+{
+    for (Page* page : pages) {
+        page->refs.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+CowBus& CowBus::operator=(const CowBus& other)
+{
+    if (this != &other) {
+        for (Page* page : other.pages) {
+            page->refs.fetch_add(1, std::memory_order_relaxed);
+        }
+        for (Page* page : pages) {
+            release(page);
+        }
+        pages = other.pages;
+        currentCycle = other.currentCycle;
+    }
+    return *this;
+}
+
+void CowBus::write(uint16_t addr, uint8_t data)
+{
+    Page*& page = pages[addr >> 8];
+    if (page->readOnly) {
+        return;
+    }
+    if (page->refs.load(std::memory_order_acquire) != 1) {
+        // Shared with a parent or sibling - take a private copy first
+        Page* copy = new Page;
+        copy->data = page->data;
+        release(page);
+        page = copy;
+    }
+    page->data[addr & 0xFF] = data;
+}
+
+bool CowBus::mapRom(uint16_t base, const uint8_t* image, size_t size)
+{
+    if ((base & 0xFF) != 0 || size % PAGE_SIZE != 0 || size > PAGES * PAGE_SIZE - base) {
+        return false;
+    }
+    for (size_t offset = 0; offset < size; offset += PAGE_SIZE) {
+        Page* rom = new Page;
+        rom->readOnly = true;
+        std::copy(image + offset, image + offset + PAGE_SIZE, rom->data.begin());
+
+        Page*& page = pages[(base + offset) >> 8];
+        release(page);
+        page = rom;
+    }
+    return true;
+}
+
+size_t CowBus::privatePages() const
+{
+    size_t count = 0;
+    for (const Page* page : pages) {
+        if (page->refs.load(std::memory_order_relaxed) == 1)
+            ++count;
+    }
+    return count;
+}
+
+int RunForkBench(unsigned children, uint64_t instructions)
+{
+    std::ifstream file("6502_65C02_functional_tests/nestest.prg.bin", std::ios::binary);
+    const std::vector<uint8_t> prg((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    if (prg.size() != 0x4000) {
+        std::cerr << "Failed to load nestest.prg.bin" << std::endl;
+        return 2;
+    }
+
+    auto step = [](Cpu2A03& cpu) {
+        do {
+            cpu.clock();
+        } while (!cpu.instructionComplete());
+    };
+
+    // Parent - nestest ROM at $C000, run to a checkpoint
+    ForkMachine<Cpu2A03> parent;
+    parent.bus.mapRom(0xC000, prg.data(), prg.size());
+    parent.cpu.PC = 0xC000;
+    parent.cpu.SP = 0xFD;
+    parent.cpu.status = 0x24;
+    for (int i = 0; i < 1000; ++i)
+        step(parent.cpu);
+
+    const auto begin = std::chrono::steady_clock::now();
+    std::vector<ForkMachine<Cpu2A03>> forks;
+    forks.reserve(children);
+    for (unsigned i = 0; i < children; ++i)
+        forks.push_back(parent.fork());
+    const auto forked = std::chrono::steady_clock::now();
+
+    // Each child sees a different "input" in A and runs on from the checkpoint
+    size_t privatePages = 0;
+    for (unsigned i = 0; i < children; ++i) {
+        forks[i].cpu.A = static_cast<uint8_t>(i);
+        for (uint64_t n = 0; n < instructions; ++n)
+            step(forks[i].cpu);
+        privatePages += forks[i].bus.privatePages();
+    }
+    const auto ran = std::chrono::steady_clock::now();
+
+    const double forkSeconds = std::chrono::duration<double>(forked - begin).count();
+    const double runSeconds = std::chrono::duration<double>(ran - forked).count();
+    std::cout << children << " fork(s) in " << forkSeconds * 1e3 << " ms (" << forkSeconds / children * 1e9 << " ns each), "
+              << instructions << " instruction(s) each in " << runSeconds << " s\n";
+    std::cout << "private memory " << privatePages * CowBus::PAGE_SIZE / 1024 << " KB, "
+              << static_cast<double>(privatePages) / children << " page(s) per fork (full copies: "
+              << static_cast<uint64_t>(children) * 64 << " KB)" << std::endl;
+    return 0;
+}
@@ -0,0 +1,68 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include "Bus.h"
+
+// Forkable 64 KB memory. The address space is a table of 256 byte pages shared between forks and copied on
+// the first write, so a fork costs one page table and afterwards only the pages it writes. ROM pages are
+// shared by every fork and never copied - writes to them are ignored.
+class CowBus : public Bus {
+public:
+    static constexpr size_t PAGE_SIZE = 256;
+    static constexpr size_t PAGES = 256;
+
+    CowBus();
+    ~CowBus() override;
+
+    // Forking - the copy shares every page with the original
+    CowBus(const CowBus& other);
+    CowBus& operator=(const CowBus& other);
+
+    uint8_t read(uint16_t addr) override { return pages[addr >> 8]->data[addr & 0xFF]; }
+    void write(uint16_t addr, uint8_t data) override;
+    bool isPlainMemory(uint16_t) const override { return true; }
+
+    // Copies image into [base, base + size) and makes those pages read-only - call before forking
+    // so every fork shares them. ROM starts and ends on page boundaries.
+    bool mapRom(uint16_t base, const uint8_t* image, size_t size);
+
+    // Pages this instance owns alone, i.e. its private footprint in bytes is privatePages() * PAGE_SIZE
+    size_t privatePages() const;
+
+private:
+    struct Page {
+        std::atomic<uint32_t> refs{ 1 };
+        bool readOnly = false;
+        std::array<uint8_t, PAGE_SIZE> data{};
+    };
+
+    // All-zero page every fresh instance starts with, never freed
+    static Page* zeroPage();
+    static void release(Page* page);
+
+    std::array<Page*, PAGES> pages;
+};
+
+// CPU plus forkable memory. fork() copies the CPU state (a single cache line) and shares all memory pages,
+// so thousands of children branching from one checkpoint cost little more than the pages each one writes.
+template <typename Cpu>
+class ForkMachine {
+public:
+    ForkMachine() { cpu.connectBus(&bus); }
+
+    ForkMachine(const ForkMachine& parent) : bus(parent.bus) {
+        cpu.setState(parent.cpu.getState());
+        cpu.connectBus(&bus);
+    }
+    ForkMachine& operator=(const ForkMachine&) = delete;
+
+    ForkMachine fork() const { return ForkMachine(*this); }
+
+    Cpu cpu;
+    CowBus bus;
+};
+
+// Forks children from a nestest checkpoint, runs each with a different input byte and reports fork cost and footprint
+int RunForkBench(unsigned children = 10000, uint64_t instructions = 2000);
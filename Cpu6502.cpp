@@ -2,6 +2,8 @@
 #include "Opcodes.h"
 #include "Bus.h"
 #include "AddressingMode.h"
+#include <algorithm>
+#include <array>
 #include <iostream>
 
 constexpr uint16_t HIGH_BYTE_MASK = 0xFF00;
@@ -12,34 +14,40 @@ constexpr uint8_t SIGN_BIT_MASK = 0x80;
 
 
 
-byte Cpu6502::read(memAddress addr)
+template <typename Variant>
+byte Cpu6502Core<Variant>::readOperand(Operand op)
 {
-	if( currentAddressingMode == AddressingMode::IMP )
-		return currentByte;
-	return bus->read(addr);
+	if( op.mode == AddressingMode::IMP )
+		return A;
+	return bus->read(op.address);
 }
 
-void Cpu6502::write(memAddress addr, byte data)
+template <typename Variant>
+void Cpu6502Core<Variant>::write(memAddress addr, byte data)
 {
 	bus->write(addr, data);
 }
 
-bool Cpu6502::getFlag(Flags flag)
+template <typename Variant>
+bool Cpu6502Core<Variant>::getFlag(Flags flag)
 {
 	return (status & static_cast<uint8_t>(flag)) != 0;
 }
 
-void Cpu6502::setFlag(uint8_t& status, Flags flag)
+template <typename Variant>
+void Cpu6502Core<Variant>::setFlag(uint8_t& status, Flags flag)
 {
 	status |= static_cast<uint8_t>(flag);
 }
 
-void Cpu6502::clearFlag(uint8_t& status, Flags flag)
+template <typename Variant>
+void Cpu6502Core<Variant>::clearFlag(uint8_t& status, Flags flag)
 {
 	status &= ~static_cast<uint8_t>(flag);
 }
 
-void Cpu6502::updateFlag(bool condition, Flags flag)
+template <typename Variant>
+void Cpu6502Core<Variant>::updateFlag(bool condition, Flags flag)
 {
 	if (condition)
 		setFlag(status, flag);
@@ -47,7 +55,8 @@ void Cpu6502::updateFlag(bool condition, Flags flag)
 		clearFlag(status, flag);
 }
 
-void Cpu6502::reset()
+template <typename Variant>
+void Cpu6502Core<Variant>::reset()
 {
 	// Set Program Counter to the address stored at the Reset vector (0xFFFC and 0xFFFD)
 	PC = static_cast<memAddress>(bus->read(0xFFFC)) | (static_cast<memAddress>(bus->read(0xFFFD)) << 8);
@@ -61,14 +70,13 @@ void Cpu6502::reset()
 
 	status = 0x00 | static_cast<uint8_t>(Flags::U); // Set unused flag
 
-	currentAddress = 0;
-	currentByte = 0;
-	relativeAddress = 0;
-
 	cycles = 8;
 }
 
-void Cpu6502::executeInterrupt() {
+template <typename Variant>
+void Cpu6502Core<Variant>::executeInterrupt(memAddress vector) {
+	bus->setCycle(totalCycles);
+
 	// Push PC and Status onto the stack
 	write(static_cast<memAddress>(STACK_BASE_ADDRESS + SP--), static_cast<byte>((PC >> 8) & LOW_BYTE_MASK)); // Push high byte of PC
 	write(static_cast<memAddress>(STACK_BASE_ADDRESS + SP--), static_cast<byte>(PC & LOW_BYTE_MASK));        // Push low byte of PC
@@ -82,82 +90,94 @@ void Cpu6502::executeInterrupt() {
 	// Set Interrupt Disable flag
 	updateFlag(true, Flags::I);
 
-	// Set PC to the address stored at the IRQ vector (0xFFFE and 0xFFFF)
-	PC = static_cast<memAddress>(bus->read(0xFFFE)) | (static_cast<memAddress>(bus->read(0xFFFF)) << 8);
+	// The 65C02 also leaves decimal mode when entering an interrupt handler
+	if constexpr (Variant::cmosExtensions)
+		updateFlag(false, Flags::D);
+
+	// Set PC to the address stored at the vector
+	PC = static_cast<memAddress>(bus->read(vector)) | (static_cast<memAddress>(bus->read(static_cast<memAddress>(vector + 1))) << 8);
 }
 
-void Cpu6502::interrupt()
+template <typename Variant>
+void Cpu6502Core<Variant>::interrupt()
 {
 	if( !getFlag(Flags::I) ) // Only process IRQ if Interrupt Disable flag is clear
 	{
-		executeInterrupt();
+		executeInterrupt(0xFFFE);
 		cycles = 7; // IRQ takes 7 cycles
 	}
 }
 
-void Cpu6502::nonMaskableInterrupt()
+template <typename Variant>
+void Cpu6502Core<Variant>::nonMaskableInterrupt()
 {
-	executeInterrupt();
+	executeInterrupt(0xFFFA);
 	cycles = 8; // NMI takes 8 cycles
 }
 
-AddressingMode Cpu6502::mapAddressMode(bool (Cpu6502::* addrFn)())
-{
-	if (addrFn == &Cpu6502::IMP) return AddressingMode::IMP;
-	if (addrFn == &Cpu6502::IMM) return AddressingMode::IMM;
-	if (addrFn == &Cpu6502::ZP0) return AddressingMode::ZP0;
-	if (addrFn == &Cpu6502::ZPX) return AddressingMode::ZPX;
-	if (addrFn == &Cpu6502::ZPY) return AddressingMode::ZPY;
-	if (addrFn == &Cpu6502::REL) return AddressingMode::REL;
-	if (addrFn == &Cpu6502::ABS) return AddressingMode::ABS;
-	if (addrFn == &Cpu6502::ABX) return AddressingMode::ABX;
-	if (addrFn == &Cpu6502::ABY) return AddressingMode::ABY;
-	if (addrFn == &Cpu6502::IND) return AddressingMode::IND;
-	if (addrFn == &Cpu6502::IZX) return AddressingMode::IZX;
-	if (addrFn == &Cpu6502::IZY) return AddressingMode::IZY;
-	// Default fallback
-	return AddressingMode::IMP;
-}
-
-void Cpu6502::clock()
+template <typename Variant>
+void Cpu6502Core<Variant>::clock()
 {
 	if (cycles == 0)
 	{
-		// Fetch opcode
-		opcode = bus->read(PC);
+		// Let devices behind the bus catch up to this instruction
+		bus->setCycle(totalCycles);
+
+		// Fetch opcode, unless fusion already fetched it for a pair that did not fuse
+		const bool reuse = prefetched && PC == prefetchedPC && totalCycles == prefetchedCycle;
+		const byte opcode = reuse ? prefetchedOpcode : bus->fetch(PC);
+		prefetched = false;
 		PC++;
 
 		// Set unused flag
 		updateFlag(true, Flags::U);
 
-		// Get the corresponding instruction from the opcode table
-		const Opcode6502& instruction = OPCODES_6502[opcode];
+		// Get the corresponding instruction from the opcode table of this variant
+		const OpcodeEntry<Cpu6502Core>& instruction = opcodeTable(Variant{})[opcode];
 
 		// Calculate total cycles
 		cycles = instruction.cycles;
 
-		// Set the current addressing mode and operation
-		currentAddressingMode = mapAddressMode(instruction.addrmode);
-
-		// Execute addressing mode
-		bool additionalCycleAddressingMode = (this->*instruction.addrmode)();
+		// Execute addressing mode - the operand stays in registers on its way to the operation
+		const Operand operand = (this->*instruction.addrmode)();
 
 		// Execute operation
-		(this->*instruction.operate)();
-
-
-		// Check if the instruction is a store instruction - these do not get additional cycles for page crossing
-		bool isStoreInstruction = (instruction.operate == &Cpu6502::STA) ||
-			(instruction.operate == &Cpu6502::STX) ||
-			(instruction.operate == &Cpu6502::STY);
-
-		if (additionalCycleAddressingMode && !isStoreInstruction)
+		(this->*instruction.operate)(operand);
+
+
+		// Stores and read-modify-write instructions always take the indexed worst case, which is already in their base cycle count
+		bool noPageCrossPenalty = (instruction.operate == &Cpu6502Core::STA) ||
+			(instruction.operate == &Cpu6502Core::STX) ||
+			(instruction.operate == &Cpu6502Core::STY) ||
+			(instruction.operate == &Cpu6502Core::INC) ||
+			(instruction.operate == &Cpu6502Core::DEC);
+
+		if constexpr (Variant::cmosExtensions)
+		{
+			// The 65C02 only charges the page crossing cycle for shifts and rotates
+			noPageCrossPenalty = noPageCrossPenalty || (instruction.operate == &Cpu6502Core::STZ);
+		}
+		else
+		{
+			noPageCrossPenalty = noPageCrossPenalty ||
+				(instruction.operate == &Cpu6502Core::ASL) ||
+				(instruction.operate == &Cpu6502Core::LSR) ||
+				(instruction.operate == &Cpu6502Core::ROL) ||
+				(instruction.operate == &Cpu6502Core::ROR);
+		}
+
+		if (operand.pageCrossed && !noPageCrossPenalty)
 			cycles++;
+
+		if (fusionEnabled)
+			fuseNext(opcode, operand);
 	}
 	cycles--;
+	totalCycles++;
 }
 
-bool Cpu6502::instructionComplete()
+template <typename Variant>
+bool Cpu6502Core<Variant>::instructionComplete()
 {
 	return cycles == 0;
 }
@@ -177,7 +197,8 @@ static constexpr memAddress getAbsolute(byte lowByte, byte highByte)
 }
 
 // Helper function to update Zero and Negative flags based on conditions
-void Cpu6502::updateZeroAndNegativeFlags(bool zeroCondition, bool negativeCondition)
+template <typename Variant>
+void Cpu6502Core<Variant>::updateZeroAndNegativeFlags(bool zeroCondition, bool negativeCondition)
 {
 	// Set or clear Zero Flag
 	updateFlag(zeroCondition, Flags::Z);
@@ -186,322 +207,669 @@ void Cpu6502::updateZeroAndNegativeFlags(bool zeroCondition, bool negativeCondit
 }
 
 // Helper function to check for page crossing and add cycle if needed
-void Cpu6502::checkPageCrossing()
+template <typename Variant>
+void Cpu6502Core<Variant>::checkPageCrossing(memAddress target)
 {
-	if ((currentAddress & HIGH_BYTE_MASK) != (PC & HIGH_BYTE_MASK))
+	if ((target & HIGH_BYTE_MASK) != (PC & HIGH_BYTE_MASK))
 		cycles++;
 }
 
 // Helper function for comparison logic used in CMP, CPX, CPY instructions
-void Cpu6502::CompareLogic(uint16_t registerValue)
+template <typename Variant>
+void Cpu6502Core<Variant>::CompareLogic(uint16_t registerValue, byte value)
 {
-	uint16_t temp = registerValue - static_cast<uint16_t>(currentByte);
+	uint16_t temp = registerValue - static_cast<uint16_t>(value);
 	// Set or clear Carry Flag
-	updateFlag(registerValue >= static_cast<uint16_t>(currentByte), Flags::C);
+	updateFlag(registerValue >= static_cast<uint16_t>(value), Flags::C);
 	// Set or clear Zero and Negative Flags
 	updateZeroAndNegativeFlags((temp & LOW_BYTE_MASK) == 0, (temp & SIGN_BIT_MASK) != 0);
 }
 
+// Decimal mode ADC - NMOS takes Z from the binary sum and N/V from the intermediate high nibble,
+// the 65C02 corrects N/Z from the BCD result and spends one more cycle doing so
+template <typename Variant>
+void Cpu6502Core<Variant>::decimalAdd(byte value)
+{
+	const uint16_t carryIn = getFlag(Flags::C) ? 1 : 0;
+	uint16_t low = (A & 0x0F) + (value & 0x0F) + carryIn;
+	if (low > 0x09)
+		low += 0x06;
+	uint16_t high = (A >> 4) + (value >> 4) + (low > 0x0F ? 1 : 0);
+
+	// Binary sum is only needed for the NMOS zero flag
+	const uint16_t sum = static_cast<uint16_t>(A) + static_cast<uint16_t>(value) + carryIn;
+	updateFlag((sum & LOW_BYTE_MASK) == 0, Flags::Z);
+	updateFlag((high & 0x08) != 0, Flags::N);
+	updateFlag(((~(static_cast<uint16_t>(A) ^ static_cast<uint16_t>(value))) & (static_cast<uint16_t>(A) ^ (high << 4)) & SIGN_BIT_MASK) != 0, Flags::V);
+
+	if (high > 0x09)
+		high += 0x06;
+	updateFlag(high > 0x0F, Flags::C);
+
+	A = static_cast<byte>(((high << 4) | (low & 0x0F)) & LOW_BYTE_MASK);
+
+	if constexpr (Variant::cmosExtensions)
+	{
+		updateZeroAndNegativeFlags(A == 0, (A & SIGN_BIT_MASK) != 0);
+		cycles++;
+	}
+}
+
+// Decimal mode SBC - flags always follow the binary subtraction on NMOS, the 65C02 corrects N/Z from the BCD result
+template <typename Variant>
+void Cpu6502Core<Variant>::decimalSubtract(byte value)
+{
+	const int borrowIn = getFlag(Flags::C) ? 0 : 1;
+	int low = (A & 0x0F) - (value & 0x0F) - borrowIn;
+	int high = (A >> 4) - (value >> 4);
+	if (low < 0)
+	{
+		low -= 0x06;
+		high--;
+	}
+	if (high < 0)
+		high -= 0x06;
+
+	const uint16_t difference = static_cast<uint16_t>(A) - static_cast<uint16_t>(value) - static_cast<uint16_t>(borrowIn);
+	updateFlag((difference & HIGH_BYTE_MASK) == 0, Flags::C);
+	updateZeroAndNegativeFlags((difference & LOW_BYTE_MASK) == 0, (difference & SIGN_BIT_MASK) != 0);
+	updateFlag((((static_cast<uint16_t>(A) ^ value) & (static_cast<uint16_t>(A) ^ difference)) & SIGN_BIT_MASK) != 0, Flags::V);
+
+	A = static_cast<byte>(((high << 4) | (low & 0x0F)) & LOW_BYTE_MASK);
+
+	if constexpr (Variant::cmosExtensions)
+	{
+		updateZeroAndNegativeFlags(A == 0, (A & SIGN_BIT_MASK) != 0);
+		cycles++;
+	}
+}
+
+// === Superinstruction Fusion ===
+
+// Role of an opcode in a fusable pair
+enum FusionRole : uint8_t {
+	FUSE_NONE = 0,
+	FUSE_LOAD = 1 << 0,       // LDA - fuses with a following STA
+	FUSE_SETS_FLAGS = 1 << 1, // CMP/CPX/CPY, DEX/DEY/INX/INY - fuse with a following conditional branch
+	FUSE_CLEAR_CARRY = 1 << 2, // CLC - fuses with a following ADC
+	FUSE_STORE = 1 << 3,
+	FUSE_BRANCH = 1 << 4,
+	FUSE_ADD = 1 << 5,
+};
+
+static constexpr std::array<uint8_t, 256> makeFusionRoles(bool cmos)
+{
+	std::array<uint8_t, 256> roles{};
+	for (byte op : { 0xA9, 0xA5, 0xB5, 0xAD, 0xBD, 0xB9, 0xA1, 0xB1 })
+		roles[op] |= FUSE_LOAD;
+	for (byte op : { 0xC9, 0xC5, 0xD5, 0xCD, 0xDD, 0xD9, 0xC1, 0xD1, 0xE0, 0xE4, 0xEC, 0xC0, 0xC4, 0xCC, 0xCA, 0x88, 0xE8, 0xC8 })
+		roles[op] |= FUSE_SETS_FLAGS;
+	roles[0x18] |= FUSE_CLEAR_CARRY;
+	for (byte op : { 0x85, 0x95, 0x8D, 0x9D, 0x99, 0x81, 0x91 })
+		roles[op] |= FUSE_STORE;
+	for (byte op : { 0x10, 0x30, 0x50, 0x70, 0x90, 0xB0, 0xD0, 0xF0 })
+		roles[op] |= FUSE_BRANCH;
+	for (byte op : { 0x69, 0x65, 0x75, 0x6D, 0x7D, 0x79, 0x61, 0x71 })
+		roles[op] |= FUSE_ADD;
+	if (cmos)
+	{
+		// (zp) forms
+		roles[0xB2] |= FUSE_LOAD;
+		roles[0xD2] |= FUSE_SETS_FLAGS;
+		roles[0x92] |= FUSE_STORE;
+		roles[0x72] |= FUSE_ADD;
+	}
+	return roles;
+}
+
+template <typename Variant>
+static constexpr std::array<uint8_t, 256> FUSION_ROLES = makeFusionRoles(Variant::cmosExtensions);
+
+// Called right after the first instruction of a potential pair executed, with its cycles in `cycles`.
+// Runs the second instruction in the same dispatch if nothing could observe the boundary between them.
+template <typename Variant>
+void Cpu6502Core<Variant>::fuseNext(byte firstOpcode, Operand firstOperand)
+{
+	const uint8_t firstRole = FUSION_ROLES<Variant>[firstOpcode];
+	if (firstRole == FUSE_NONE)
+		return;
+
+	// An interrupt raised at the boundary would be taken after the pair instead of in between
+	if (totalCycles + cycles >= fusionLimit)
+		return;
+	// A device access could raise an interrupt or move a deadline
+	if (firstOperand.mode != AddressingMode::IMP && firstOperand.mode != AddressingMode::IMM &&
+		!bus->isPlainMemory(firstOperand.address))
+		return;
+	if ((breakpoints != nullptr && breakpoints->test(PC)) || !bus->isPlainMemory(PC))
+		return;
+
+	// The second instruction starts where the first one ends. Its opcode is fetched there, if the pair does not
+	// fuse the next clock() takes it from here, so either way every opcode is fetched exactly once.
+	bus->setCycle(totalCycles + cycles);
+	const byte opcode = bus->fetch(PC);
+	const uint8_t role = FUSION_ROLES<Variant>[opcode];
+	const bool fuses = ((firstRole & FUSE_LOAD) && (role & FUSE_STORE)) ||
+		((firstRole & FUSE_SETS_FLAGS) && (role & FUSE_BRANCH)) ||
+		((firstRole & FUSE_CLEAR_CARRY) && (role & FUSE_ADD));
+	if (!fuses)
+	{
+		prefetched = true;
+		prefetchedOpcode = opcode;
+		prefetchedPC = PC;
+		prefetchedCycle = totalCycles + cycles;
+		return;
+	}
+
+	PC++;
+	const OpcodeEntry<Cpu6502Core>& second = opcodeTable(Variant{})[opcode];
+	cycles += second.cycles;
+
+	if (role & FUSE_BRANCH)
+	{
+		const byte offset = bus->read(PC);
+		PC++;
+		if (branchTaken(opcode))
+		{
+			const memAddress target = static_cast<memAddress>(PC + static_cast<int8_t>(offset));
+			cycles++;
+			checkPageCrossing(target);
+			PC = target;
+		}
+	}
+	else if (role & FUSE_STORE)
+	{
+		// Stores never pay the page crossing cycle
+		write((this->*second.addrmode)().address, A);
+	}
+	else
+	{
+		const Operand operand = (this->*second.addrmode)();
+		ADC(operand);
+		if (operand.pageCrossed)
+			cycles++;
+	}
+	++fusedPairs;
+}
+
+// === Idle Loop Fast-Forward ===
+
+// Reads a byte for loop detection, only if the bus guarantees the read has no side effects. Peeked, so wrappers
+// that count accesses do not see the probe.
+template <typename Variant>
+bool Cpu6502Core<Variant>::peekPlain(memAddress addr, byte& value)
+{
+	if (!bus->isPlainMemory(addr))
+		return false;
+	value = bus->peek(addr);
+	return true;
+}
+
+// Branch opcodes are xxy10000 - xx selects N, V, C or Z and y is the flag value that takes the branch
+template <typename Variant>
+bool Cpu6502Core<Variant>::branchTaken(byte branchOpcode) const
+{
+	static constexpr Flags branchFlags[] = { Flags::N, Flags::V, Flags::C, Flags::Z };
+	const bool flagSet = (status & static_cast<uint8_t>(branchFlags[branchOpcode >> 6])) != 0;
+	return flagSet == ((branchOpcode & 0x20) != 0);
+}
+
+// Recognized loops, each of them repeats with no writes and no reads that have side effects:
+//   JMP *             / Bxx * (taken)          - wait for an interrupt
+//   LDA|LDX|LDY|BIT m / Bxx back (taken)       - poll plain memory that only an interrupt or event can change
+//   DEX|DEY|INX|INY   / BNE back               - delay loop, skipped up to the last iteration
+// Only whole iterations that end before the budget runs out are skipped, so the next interrupt or event is
+// seen at exactly the same instruction boundary and with the same state as under full interpretation.
+template <typename Variant>
+uint64_t Cpu6502Core<Variant>::skipIdleLoop(uint64_t cycleBudget)
+{
+	if (cycles != 0)
+		return 0;
+
+	const auto& table = opcodeTable(Variant{});
+
+	byte head = 0;
+	if (!peekPlain(PC, head))
+		return 0;
+
+	// Taken branch cycle cost, including the page crossing cycle
+	auto branchCycles = [&](byte branchOpcode, memAddress branchAddress, memAddress target) -> uint64_t {
+		const memAddress next = static_cast<memAddress>(branchAddress + 2);
+		return table[branchOpcode].cycles + 1 + (((next & HIGH_BYTE_MASK) != (target & HIGH_BYTE_MASK)) ? 1 : 0);
+	};
+	// Target of the branch at branchAddress, if it is a branch
+	auto branchTarget = [&](memAddress branchAddress, byte& branchOpcode, memAddress& target) -> bool {
+		byte offset = 0;
+		if (!peekPlain(branchAddress, branchOpcode) || (branchOpcode & 0x1F) != 0x10 ||
+			!peekPlain(static_cast<memAddress>(branchAddress + 1), offset))
+			return false;
+		target = static_cast<memAddress>(branchAddress + 2 + static_cast<int8_t>(offset));
+		return true;
+	};
+
+	uint64_t iterationCycles = 0;
+	uint64_t iterations = 0;
+
+	if (head == 0x4C) // JMP *
+	{
+		byte low = 0, high = 0;
+		if (!peekPlain(static_cast<memAddress>(PC + 1), low) || !peekPlain(static_cast<memAddress>(PC + 2), high) ||
+			getAbsolute(low, high) != PC)
+			return 0;
+		iterationCycles = table[head].cycles;
+		iterations = cycleBudget / iterationCycles;
+	}
+	else if ((head & 0x1F) == 0x10) // Bxx *
+	{
+		byte branchOpcode = 0;
+		memAddress target = 0;
+		if (!branchTarget(PC, branchOpcode, target) || target != PC || !branchTaken(branchOpcode))
+			return 0;
+		iterationCycles = branchCycles(branchOpcode, PC, target);
+		iterations = cycleBudget / iterationCycles;
+	}
+	else if (head == 0xA5 || head == 0xAD || head == 0xA6 || head == 0xAE || head == 0xA4 || head == 0xAC ||
+		head == 0x24 || head == 0x2C) // Load or BIT from memory, then branch back
+	{
+		const bool absolute = (head & 0x08) != 0;
+		byte low = 0, high = 0;
+		if (!peekPlain(static_cast<memAddress>(PC + 1), low) ||
+			(absolute && !peekPlain(static_cast<memAddress>(PC + 2), high)))
+			return 0;
+
+		const memAddress polled = absolute ? getAbsolute(low, high) : zeroPage(low);
+		const memAddress branchAddress = static_cast<memAddress>(PC + (absolute ? 3 : 2));
+		byte value = 0, branchOpcode = 0;
+		memAddress target = 0;
+		if (!peekPlain(polled, value) || !branchTarget(branchAddress, branchOpcode, target) || target != PC)
+			return 0;
+
+		iterationCycles = table[head].cycles + branchCycles(branchOpcode, branchAddress, target);
+		iterations = cycleBudget / iterationCycles;
+		if (iterations == 0)
+			return 0;
+
+		// The first iteration settles the registers and flags, every later one repeats them
+		const byte savedStatus = status;
+		const bool isBit = (head == 0x24 || head == 0x2C);
+		if (isBit)
+		{
+			updateZeroAndNegativeFlags((A & value) == 0, (value & SIGN_BIT_MASK) != 0);
+			updateFlag((value & (1 << 6)) != 0, Flags::V);
+		}
+		else
+		{
+			updateZeroAndNegativeFlags(value == 0, (value & SIGN_BIT_MASK) != 0);
+		}
+
+		if (!branchTaken(branchOpcode))
+		{
+			status = savedStatus;
+			return 0;
+		}
+
+		if (!isBit)
+		{
+			byte& reg = (head == 0xA6 || head == 0xAE) ? X : (head == 0xA4 || head == 0xAC) ? Y : A;
+			reg = value;
+		}
+	}
+	else if (head == 0xCA || head == 0x88 || head == 0xE8 || head == 0xC8) // DEX/DEY/INX/INY, BNE back
+	{
+		const memAddress branchAddress = static_cast<memAddress>(PC + 1);
+		byte branchOpcode = 0;
+		memAddress target = 0;
+		if (!branchTarget(branchAddress, branchOpcode, target) || branchOpcode != 0xD0 || target != PC)
+			return 0;
+
+		byte& counter = (head == 0xCA || head == 0xE8) ? X : Y;
+		const bool decrement = (head == 0xCA || head == 0x88);
+
+		// Iterations until the counter reaches zero - the last one falls through and is left to the interpreter
+		const uint64_t remaining = decrement ? (counter == 0 ? 256 : counter) : 256 - counter;
+		iterationCycles = table[head].cycles + branchCycles(branchOpcode, branchAddress, target);
+		iterations = std::min<uint64_t>(remaining - 1, cycleBudget / iterationCycles);
+		if (iterations == 0)
+			return 0;
+
+		counter = static_cast<byte>(decrement ? counter - iterations : counter + iterations);
+		updateZeroAndNegativeFlags(false, (counter & SIGN_BIT_MASK) != 0);
+	}
+	else
+	{
+		return 0;
+	}
+
+	if (iterations == 0)
+		return 0;
+
+	// Set by every opcode fetch that was skipped
+	setFlag(status, Flags::U);
+	totalCycles += iterations * iterationCycles;
+	return iterations * iterationCycles;
+}
+
 // === Addressing Modes ===
-// All addressing modes and instructions return true if they require an additional cycle
+// Addressing modes return the effective address and whether indexing crossed a page - clock() charges the extra
+// read cycle for that, operations add any other extra cycles (taken branches) to cycles themselves
 
-bool Cpu6502::IMP()
+template <typename Variant>
+Operand Cpu6502Core<Variant>::IMP()
 {
-	// Implicit addressing mode (with Accumulator included) - save accumulator value to currentByte, no additional cycle needed
-	currentByte = A;
-	return false;
+	// Implicit addressing mode (with Accumulator included) - operations read A through readOperand, no additional cycle needed
+	return { 0x0000, AddressingMode::IMP, false };
 }
 
-bool Cpu6502::IMM()
+template <typename Variant>
+Operand Cpu6502Core<Variant>::IMM()
 {
-	// Immediate addressing mode - set currentAddress to the next byte after the opcode
-	currentAddress = PC++;
-	return false;
+	// Immediate addressing mode - the operand is the next byte after the opcode
+	return { PC++, AddressingMode::IMM, false };
 }
 
-// Zero Page addressing mode - read the zero page address from program counter, increment PC, and set currentAddress
-bool Cpu6502::ZP0()
+// Zero Page addressing mode - read the zero page address from program counter and increment PC
+template <typename Variant>
+Operand Cpu6502Core<Variant>::ZP0()
 {
-	currentAddress = zeroPage(bus->read(PC));
+	const memAddress address = zeroPage(bus->read(PC));
 	PC++;
-	return false;
+	return { address, AddressingMode::ZP0, false };
 }
 
-// Zero Page,X addressing mode - read the zero page address from program counter, add X register offset, set currentAddress, and increment PC
-bool Cpu6502::ZPX()
+// Zero Page,X addressing mode - read the zero page address from program counter, add X register offset and increment PC
+template <typename Variant>
+Operand Cpu6502Core<Variant>::ZPX()
 {
-	currentAddress = zeroPage(bus->read(PC) + X); // Offset is stored in X register
+	const memAddress address = zeroPage(bus->read(PC) + X); // Offset is stored in X register
 	PC++;
-	return false;
+	return { address, AddressingMode::ZPX, false };
 }
 
 // Same as ZPX but with Y register
-bool Cpu6502::ZPY()
+template <typename Variant>
+Operand Cpu6502Core<Variant>::ZPY()
 {
-	currentAddress = zeroPage(bus->read(PC) + Y); // Offset is stored in Y register
+	const memAddress address = zeroPage(bus->read(PC) + Y); // Offset is stored in Y register
 	PC++;
-	return false;
+	return { address, AddressingMode::ZPY, false };
 }
 
-// Relative addressing mode
-bool Cpu6502::REL()
+// Relative addressing mode - the operand is the branch target
+template <typename Variant>
+Operand Cpu6502Core<Variant>::REL()
 {
-	relativeAddress = bus->read(PC);
+	const byte offset = bus->read(PC);
 	PC++;
-	// If the relative address is negative, sign-extend it to 16 bits
-	if (relativeAddress & SIGN_BIT_MASK)
-		relativeAddress |= HIGH_BYTE_MASK;
-	return false;
+	// The offset is signed, relative to the instruction after the branch
+	return { static_cast<memAddress>(PC + static_cast<int8_t>(offset)), AddressingMode::REL, false };
 }
 
 // Absolute addressing mode
-bool Cpu6502::ABS()
+template <typename Variant>
+Operand Cpu6502Core<Variant>::ABS()
 {
-	currentAddress = getAbsolute(bus->read(PC), bus->read(PC + 1));
+	const memAddress address = getAbsolute(bus->read(PC), bus->read(PC + 1));
 	PC += 2;
-	return false;
+	return { address, AddressingMode::ABS, false };
 }
 
 // Absolute,X addressing mode
-bool Cpu6502::ABX()
+template <typename Variant>
+Operand Cpu6502Core<Variant>::ABX()
 {
 	memAddress base = getAbsolute(bus->read(PC), bus->read(PC + 1));
 	PC += 2;
-	currentAddress = base + X;
+	const memAddress address = base + X;
 
 	// Page crossing occurs if high byte changed after indexing
-	if ((base & HIGH_BYTE_MASK) != (currentAddress & HIGH_BYTE_MASK))
-		return true;
-
-	return false;
+	return { address, AddressingMode::ABX, (base & HIGH_BYTE_MASK) != (address & HIGH_BYTE_MASK) };
 }
 
 // Absolute,Y addressing mode - similar to ABX but with Y register
-bool Cpu6502::ABY()
+template <typename Variant>
+Operand Cpu6502Core<Variant>::ABY()
 {
 	memAddress base = getAbsolute(bus->read(PC), bus->read(PC + 1));
 	PC += 2;
-	currentAddress = base + Y;
+	const memAddress address = base + Y;
 
 	// Page crossing occurs if high byte changed after indexing
-	if ((base & HIGH_BYTE_MASK) != (currentAddress & HIGH_BYTE_MASK))
-		return true;
-
-	return false;
+	return { address, AddressingMode::ABY, (base & HIGH_BYTE_MASK) != (address & HIGH_BYTE_MASK) };
 }
 
-// Indirect addressing mode - has a hardware bug when the low byte is 0xFF
-bool Cpu6502::IND()
+// Indirect addressing mode - has a hardware bug when the low byte is 0xFF (fixed on the 65C02)
+template <typename Variant>
+Operand Cpu6502Core<Variant>::IND()
 {
 	memAddress pointer = getAbsolute(bus->read(PC), bus->read(PC + 1));
 	PC += 2;
 	// Simulate the hardware bug
-	if ((pointer & LOW_BYTE_MASK) == ZERO_PAGE_BOUNDARY)
+	if (!Variant::cmosExtensions && (pointer & LOW_BYTE_MASK) == ZERO_PAGE_BOUNDARY)
 	{
-		currentAddress = getAbsolute(bus->read(pointer), bus->read(pointer & HIGH_BYTE_MASK)); // Wrap around to the beginning of the page
+		return { getAbsolute(bus->read(pointer), bus->read(pointer & HIGH_BYTE_MASK)), AddressingMode::IND, false }; // Wrap around to the beginning of the page
 	}
-	else
-	{
-		currentAddress = getAbsolute(bus->read(pointer), bus->read(pointer + 1));
-	}
-	return false;
+	return { getAbsolute(bus->read(pointer), bus->read(pointer + 1)), AddressingMode::IND, false };
 }
 
 // Indexed Indirect addressing mode - using X register
-bool Cpu6502::IZX()
+template <typename Variant>
+Operand Cpu6502Core<Variant>::IZX()
 {
 	byte t = bus->read(PC);
 	PC++;
 
 	t += X; // Add X register to the zero page address
-	currentAddress = getAbsolute(bus->read(zeroPage(t)), bus->read(zeroPage(t + 1)));
-	return false;
+	return { getAbsolute(bus->read(zeroPage(t)), bus->read(zeroPage(t + 1))), AddressingMode::IZX, false };
 }
 
 // Indirect Indexed addressing mode - similar to IZX but with Y register
-bool Cpu6502::IZY()
+template <typename Variant>
+Operand Cpu6502Core<Variant>::IZY()
 {
 	byte t = bus->read(PC);
 	PC++;
 
 	memAddress base = getAbsolute(bus->read(zeroPage(t)), bus->read(zeroPage(t + 1))); // IZY forms address before adding Y
 
-	currentAddress = static_cast<memAddress>(base + Y);
-	if ((base & HIGH_BYTE_MASK) != (currentAddress & HIGH_BYTE_MASK))
-		return true;
-	return false;
+	const memAddress address = static_cast<memAddress>(base + Y);
+	return { address, AddressingMode::IZY, (base & HIGH_BYTE_MASK) != (address & HIGH_BYTE_MASK) };
+}
+
+// Zero Page Indirect addressing mode (65C02) - same as IZY without the Y offset
+template <typename Variant>
+Operand Cpu6502Core<Variant>::ZPI()
+{
+	byte t = bus->read(PC);
+	PC++;
+
+	return { getAbsolute(bus->read(zeroPage(t)), bus->read(zeroPage(t + 1))), AddressingMode::ZPI, false };
+}
+
+// Absolute Indexed Indirect addressing mode (65C02) - only used by JMP ($xxxx,X)
+template <typename Variant>
+Operand Cpu6502Core<Variant>::IAX()
+{
+	memAddress pointer = static_cast<memAddress>(getAbsolute(bus->read(PC), bus->read(PC + 1)) + X);
+	PC += 2;
+
+	return { getAbsolute(bus->read(pointer), bus->read(static_cast<memAddress>(pointer + 1))), AddressingMode::IAX, false };
 }
 
 // === Instructions ===
 
 // ADC - Add with Carry
-bool Cpu6502::ADC()
+template <typename Variant>
+void Cpu6502Core<Variant>::ADC(Operand op)
 {
-	currentByte = read(currentAddress);
+	const byte value = readOperand(op);
+
+	if constexpr (Variant::decimalMode)
+	{
+		if (getFlag(Flags::D))
+		{
+			decimalAdd(value);
+			return;
+		}
+	}
 
-	tempWord = static_cast<uint16_t>(A) + static_cast<uint16_t>(currentByte) + static_cast<uint16_t>(getFlag(Flags::C));
+	const uint16_t result = static_cast<uint16_t>(A) + static_cast<uint16_t>(value) + static_cast<uint16_t>(getFlag(Flags::C));
 
 	// Set or clear Carry Flag
-	updateFlag(tempWord > LOW_BYTE_MASK, Flags::C);
+	updateFlag(result > LOW_BYTE_MASK, Flags::C);
 
 	// Set or clear Zero and Negative Flags
-	updateZeroAndNegativeFlags((tempWord & LOW_BYTE_MASK) == 0, (tempWord & SIGN_BIT_MASK) != 0);
+	updateZeroAndNegativeFlags((result & LOW_BYTE_MASK) == 0, (result & SIGN_BIT_MASK) != 0);
 
 	// Set or clear Overflow Flag
-	updateFlag(((~(static_cast<uint16_t>(A) ^ static_cast<uint16_t>(currentByte))) & (static_cast<uint16_t>(A) ^ tempWord) & SIGN_BIT_MASK) != 0, Flags::V);
+	updateFlag(((~(static_cast<uint16_t>(A) ^ static_cast<uint16_t>(value))) & (static_cast<uint16_t>(A) ^ result) & SIGN_BIT_MASK) != 0, Flags::V);
 
-	A = static_cast<byte>(tempWord & LOW_BYTE_MASK);
+	A = static_cast<byte>(result & LOW_BYTE_MASK);
 
 	// ADC may require an additional cycle if page boundary is crossed
-	return false;
 }
 
 // AND - Logical AND between Accumulator and memory
-bool Cpu6502::AND()
+template <typename Variant>
+void Cpu6502Core<Variant>::AND(Operand op)
 {
-	currentByte = read(currentAddress);
-	A = A & currentByte;
+	const byte value = readOperand(op);
+	A = A & value;
 
 	// Set or clear Zero and Negative Flags
 	updateZeroAndNegativeFlags(A == 0, (A & SIGN_BIT_MASK) != 0);
 
 	// AND may require an additional cycle if page boundary is crossed
-	return false;
 }
 
 // ASL - Arithmetic Shift Left
-bool Cpu6502::ASL()
+template <typename Variant>
+void Cpu6502Core<Variant>::ASL(Operand op)
 {
-	currentByte = read(currentAddress);
+	byte value = readOperand(op);
 
 	// Set or clear Carry Flag based on bit 7
-	updateFlag((currentByte & SIGN_BIT_MASK) != 0, Flags::C);
-	currentByte <<= 1;
+	updateFlag((value & SIGN_BIT_MASK) != 0, Flags::C);
+	value <<= 1;
 
 	// Set or clear Zero and Negative Flags
-	updateZeroAndNegativeFlags(currentByte == 0, (currentByte & SIGN_BIT_MASK) != 0);
+	updateZeroAndNegativeFlags(value == 0, (value & SIGN_BIT_MASK) != 0);
 
-	if (currentAddressingMode == AddressingMode::IMP)
+	if (op.mode == AddressingMode::IMP)
 	{
 		// Accumulator form: write back to A
-		A = static_cast<byte>(currentByte);
+		A = static_cast<byte>(value);
 	}
 	else
 	{
 		// Memory form: write back to addressed memory
-		write(currentAddress, static_cast<byte>(currentByte));
+		write(op.address, static_cast<byte>(value));
 	}
-
-	return false;
 }
 
 // BCC - Branch if Carry Clear
-bool Cpu6502::BCC()
+template <typename Variant>
+void Cpu6502Core<Variant>::BCC(Operand op)
 {
 	if(!getFlag(Flags::C))
 	{
 		cycles++;
-		currentAddress = PC + relativeAddress;
-
-		checkPageCrossing();
+		checkPageCrossing(op.address);
 
-		PC = currentAddress;
+		PC = op.address;
 	}
-
-	return false;
 }
 
 // BCS - Branch if Carry Set
-bool Cpu6502::BCS()
+template <typename Variant>
+void Cpu6502Core<Variant>::BCS(Operand op)
 {
 	if(getFlag(Flags::C))
 	{
 		cycles++;
-		currentAddress = PC + relativeAddress;
-
-		checkPageCrossing();
+		checkPageCrossing(op.address);
 
-		PC = currentAddress;
+		PC = op.address;
 	}
-	return false;
 }
 
 // BEQ - Branch if Equal (Zero Flag Set)
-bool Cpu6502::BEQ()
+template <typename Variant>
+void Cpu6502Core<Variant>::BEQ(Operand op)
 {
 	if(getFlag(Flags::Z))
 	{
 		cycles++;
-		currentAddress = PC + relativeAddress;
-
-		checkPageCrossing();
+		checkPageCrossing(op.address);
 
-		PC = currentAddress;
+		PC = op.address;
 	}
-	return false;
 }
 
 // BIT - Bit Test
-bool Cpu6502::BIT()
+template <typename Variant>
+void Cpu6502Core<Variant>::BIT(Operand op)
 {
-	currentByte = read(currentAddress);
+	const byte value = readOperand(op);
 
-	// Set or clear Zero and Negative Flags based on AND result and bit 7 of currentByte
-	updateZeroAndNegativeFlags((A & currentByte) == 0, (currentByte & (1 << 7)) != 0);
+	// 65C02 BIT #imm only affects the Zero flag
+	if constexpr (Variant::cmosExtensions)
+	{
+		if (op.mode == AddressingMode::IMM)
+		{
+			updateFlag((A & value) == 0, Flags::Z);
+			return;
+		}
+	}
 
-	// Set or clear Overflow Flag based on bit 6 of currentByte
-	updateFlag((currentByte & (1 << 6)) != 0, Flags::V);
+	// Set or clear Zero and Negative Flags based on AND result and bit 7 of value
+	updateZeroAndNegativeFlags((A & value) == 0, (value & (1 << 7)) != 0);
 
-	return false;
+	// Set or clear Overflow Flag based on bit 6 of value
+	updateFlag((value & (1 << 6)) != 0, Flags::V);
 }
 
 // BMI - Branch if Minus (Negative Flag Set)
-bool Cpu6502::BMI()
+template <typename Variant>
+void Cpu6502Core<Variant>::BMI(Operand op)
 {
 	if(getFlag(Flags::N))
 	{
 		cycles++;
-		currentAddress = PC + relativeAddress;
-
-		checkPageCrossing();
+		checkPageCrossing(op.address);
 
-		PC = currentAddress;
+		PC = op.address;
 	}
-	return false;
 }
 
 // BNE - Branch if Not Equal (Zero Flag Clear)
-bool Cpu6502::BNE()
+template <typename Variant>
+void Cpu6502Core<Variant>::BNE(Operand op)
 {
 	if(!getFlag(Flags::Z))
 	{
 		cycles++;
-		currentAddress = PC + relativeAddress;
+		checkPageCrossing(op.address);
 
-		checkPageCrossing();
-
-		PC = currentAddress;
+		PC = op.address;
 	}
-	return false;
 }
 
 // BPL - Branch if Positive (Negative Flag Clear)
-bool Cpu6502::BPL()
+template <typename Variant>
+void Cpu6502Core<Variant>::BPL(Operand op)
 {
 	if(!getFlag(Flags::N))
 	{
 		cycles++;
-		currentAddress = PC + relativeAddress;
-
-		checkPageCrossing();
+		checkPageCrossing(op.address);
 
-		PC = currentAddress;
+		PC = op.address;
 	}
-	return false;
 }
 
 // BRK - Force Interrupt
-bool Cpu6502::BRK()
+template <typename Variant>
+void Cpu6502Core<Variant>::BRK(Operand)
 {
 	PC++;
 	setFlag(status, Flags::I);
@@ -512,315 +880,307 @@ bool Cpu6502::BRK()
 	clearFlag(status, Flags::B);						// Clear Break Flag
 
 	setFlag(status, Flags::I);						// Set Interrupt Disable Flag
+	if constexpr (Variant::cmosExtensions)
+		clearFlag(status, Flags::D);					// 65C02 also clears Decimal Flag
 
 	PC = getAbsolute(bus->read(0xFFFE), bus->read(0xFFFF));		// Set PC to IRQ/BRK vector address
-	return false;
 }
 
 // BVC - Branch if Overflow Clear
-bool Cpu6502::BVC()
+template <typename Variant>
+void Cpu6502Core<Variant>::BVC(Operand op)
 {
 	if(!getFlag(Flags::V))
 	{
 		cycles++;
-		currentAddress = PC + relativeAddress;
+		checkPageCrossing(op.address);
 
-		checkPageCrossing();
-
-		PC = currentAddress;
+		PC = op.address;
 	}
-	return false;
 }
 
 // BVS - Branch if Overflow Set
-bool Cpu6502::BVS()
+template <typename Variant>
+void Cpu6502Core<Variant>::BVS(Operand op)
 {
 	if(getFlag(Flags::V))
 	{
 		cycles++;
-		currentAddress = PC + relativeAddress;
-		
-		checkPageCrossing();
-	
-		PC = currentAddress;
+		checkPageCrossing(op.address);
+
+		PC = op.address;
 	}
-	return false;
 }
 
 // CLC - Clear Carry Flag
-bool Cpu6502::CLC()
+template <typename Variant>
+void Cpu6502Core<Variant>::CLC(Operand)
 {
 	clearFlag(status, Flags::C);
-	return false;
 }
 
 // CLD - Clear Decimal Mode - essentially unused in NES emulation, but implemented for completeness
-bool Cpu6502::CLD()
+template <typename Variant>
+void Cpu6502Core<Variant>::CLD(Operand)
 {
 	clearFlag(status, Flags::D);
-	return false;
 }
 
 // CLI - Clear Interrupt Disable
-bool Cpu6502::CLI()
+template <typename Variant>
+void Cpu6502Core<Variant>::CLI(Operand)
 {
 	clearFlag(status, Flags::I);
-	return false;
 }
 
 // CLV - Clear Overflow Flag
-bool Cpu6502::CLV()
+template <typename Variant>
+void Cpu6502Core<Variant>::CLV(Operand)
 {
 	clearFlag(status, Flags::V);
-	return false;
 }
 
 // CMP - Compare Accumulator
-bool Cpu6502::CMP()
+template <typename Variant>
+void Cpu6502Core<Variant>::CMP(Operand op)
 {
-	currentByte = read(currentAddress);
+	const byte value = readOperand(op);
 	
-	CompareLogic(static_cast<uint16_t>(A));
-
-	return false;
+	CompareLogic(static_cast<uint16_t>(A), value);
 }
 
 // CPX - Compare X Register
-bool Cpu6502::CPX()
+template <typename Variant>
+void Cpu6502Core<Variant>::CPX(Operand op)
 {
-	currentByte = read(currentAddress);
-
-	CompareLogic(static_cast<uint16_t>(X));
+	const byte value = readOperand(op);
 
-	return false;
+	CompareLogic(static_cast<uint16_t>(X), value);
 }
 
 // CPY - Compare Y Register
-bool Cpu6502::CPY()
+template <typename Variant>
+void Cpu6502Core<Variant>::CPY(Operand op)
 {
-	currentByte = read(currentAddress);
-
-	CompareLogic(static_cast<uint16_t>(Y));
+	const byte value = readOperand(op);
 
-	return false;
+	CompareLogic(static_cast<uint16_t>(Y), value);
 }
 
 // DEC - Decrement Memory value
-bool Cpu6502::DEC()
+template <typename Variant>
+void Cpu6502Core<Variant>::DEC(Operand op)
 {
-	currentByte = read(currentAddress);
+	const byte value = readOperand(op);
 
-	tempByte = currentByte - 1;
+	const byte result = value - 1;
 
-	write(currentAddress, tempByte & LOW_BYTE_MASK);
+	// 65C02 DEC A - accumulator form
+	if (Variant::cmosExtensions && op.mode == AddressingMode::IMP)
+		A = result;
+	else
+		write(op.address, result & LOW_BYTE_MASK);
 	// Set or clear Zero and Negative Flags
-	updateZeroAndNegativeFlags((tempByte & LOW_BYTE_MASK) == 0, (tempByte & SIGN_BIT_MASK) != 0);
-
-	return false;
+	updateZeroAndNegativeFlags((result & LOW_BYTE_MASK) == 0, (result & SIGN_BIT_MASK) != 0);
 }
 
 // DEX - Decrement X Register
-bool Cpu6502::DEX()
+template <typename Variant>
+void Cpu6502Core<Variant>::DEX(Operand)
 {
 	X--;
 	// Set or clear Zero and Negative Flags
 	updateZeroAndNegativeFlags(X == 0, (X & SIGN_BIT_MASK) != 0);
-
-	return false;
 }
 
 // DEY - Decrement Y Register
-bool Cpu6502::DEY()
+template <typename Variant>
+void Cpu6502Core<Variant>::DEY(Operand)
 {
 	Y--;
 	// Set or clear Zero and Negative Flags
 	updateZeroAndNegativeFlags(Y == 0, (Y & SIGN_BIT_MASK) != 0);
-
-	return false;
 }
 
 // EOR - Exclusive OR between Accumulator and memory
-bool Cpu6502::EOR()
+template <typename Variant>
+void Cpu6502Core<Variant>::EOR(Operand op)
 {
-	currentByte = read(currentAddress);
+	const byte value = readOperand(op);
 
-	A = A ^ currentByte;
+	A = A ^ value;
 	
 	// Set or clear Zero and Negative Flags
 	updateZeroAndNegativeFlags(A == 0, (A & SIGN_BIT_MASK) != 0);
-
-	return false;
 }
 
 // INC - Increment Memory value
-bool Cpu6502::INC()
+template <typename Variant>
+void Cpu6502Core<Variant>::INC(Operand op)
 {
-	currentByte = read(currentAddress);
+	const byte value = readOperand(op);
 
-	tempByte = currentByte + 1;
-	write(currentAddress, tempByte & LOW_BYTE_MASK);
-	// Set or clear Zero and Negative Flags
-	updateZeroAndNegativeFlags((tempByte & LOW_BYTE_MASK) == 0, (tempByte & SIGN_BIT_MASK) != 0);
+	const byte result = value + 1;
 
-	return false;
+	// 65C02 INC A - accumulator form
+	if (Variant::cmosExtensions && op.mode == AddressingMode::IMP)
+		A = result;
+	else
+		write(op.address, result & LOW_BYTE_MASK);
+	// Set or clear Zero and Negative Flags
+	updateZeroAndNegativeFlags((result & LOW_BYTE_MASK) == 0, (result & SIGN_BIT_MASK) != 0);
 }
 
 // INX - Increment X Register
-bool Cpu6502::INX()
+template <typename Variant>
+void Cpu6502Core<Variant>::INX(Operand)
 {
 	X++;
 	// Set or clear Zero and Negative Flags
 	updateZeroAndNegativeFlags(X == 0, (X & SIGN_BIT_MASK) != 0);
-
-	return false;
 }
 
 // INY - Increment Y Register
-bool Cpu6502::INY()
+template <typename Variant>
+void Cpu6502Core<Variant>::INY(Operand)
 {
 	Y++;
 	// Set or clear Zero and Negative Flags
 	updateZeroAndNegativeFlags(Y == 0, (Y & SIGN_BIT_MASK) != 0);
-
-	return false;
 }
 
 // JMP - Jump to new location in memory
-bool Cpu6502::JMP()
+template <typename Variant>
+void Cpu6502Core<Variant>::JMP(Operand op)
 {
-	PC = currentAddress;
-	return false;
+	PC = op.address;
 }
 
 // JSR - Jump to Subroutine
-bool Cpu6502::JSR()
+template <typename Variant>
+void Cpu6502Core<Variant>::JSR(Operand op)
 {
 	PC--;
 	write(0x0100 + SP--, (PC >> 8) & LOW_BYTE_MASK);	// Push high byte of PC
 	write(0x0100 + SP--, PC & LOW_BYTE_MASK);			// Push low byte of PC
 
-	PC = currentAddress;
-
-	return false;
+	PC = op.address;
 }
 
 // LDA - Load Accumulator
-bool Cpu6502::LDA()
+template <typename Variant>
+void Cpu6502Core<Variant>::LDA(Operand op)
 {
-	currentByte = read(currentAddress);
-	A = currentByte;
+	const byte value = readOperand(op);
+	A = value;
 
 	// Set or clear Zero and Negative Flags
 	updateZeroAndNegativeFlags(A == 0, (A & SIGN_BIT_MASK) != 0);
-
-	return false;
 }
 
 // LDX - Load X Register
-bool Cpu6502::LDX()
+template <typename Variant>
+void Cpu6502Core<Variant>::LDX(Operand op)
 {
-	currentByte = read(currentAddress);
-	X = currentByte;
+	const byte value = readOperand(op);
+	X = value;
 
 	// Set or clear Zero and Negative Flags
 	updateZeroAndNegativeFlags(X == 0, (X & SIGN_BIT_MASK) != 0);
-
-	return false;
 }
 
 // LDY - Load Y Register
-bool Cpu6502::LDY()
+template <typename Variant>
+void Cpu6502Core<Variant>::LDY(Operand op)
 {
-	currentByte = read(currentAddress);
-	Y = currentByte;
+	const byte value = readOperand(op);
+	Y = value;
 
 	// Set or clear Zero and Negative Flags
 	updateZeroAndNegativeFlags(Y == 0, (Y & SIGN_BIT_MASK) != 0);
-
-	return false;
 }
 
 // LSR - Logical Shift Right
-bool Cpu6502::LSR()
+template <typename Variant>
+void Cpu6502Core<Variant>::LSR(Operand op)
 {
-	currentByte = read(currentAddress);
+	const byte value = readOperand(op);
 	// Set or clear Carry Flag based on bit 0
-	updateFlag((currentByte & 0x01) != 0, Flags::C);
+	updateFlag((value & 0x01) != 0, Flags::C);
 
-	tempByte = currentByte >> 1;
+	const byte result = value >> 1;
 
 	// Set or clear Zero and Negative Flags
-	updateZeroAndNegativeFlags((tempByte & LOW_BYTE_MASK) == 0, (tempByte & SIGN_BIT_MASK) != 0);
+	updateZeroAndNegativeFlags((result & LOW_BYTE_MASK) == 0, (result & SIGN_BIT_MASK) != 0);
 
 	// Write result back to Accumulator or memory
-	if (currentAddressingMode == AddressingMode::IMP)
-		A = static_cast<byte>(tempByte & LOW_BYTE_MASK);
+	if (op.mode == AddressingMode::IMP)
+		A = static_cast<byte>(result & LOW_BYTE_MASK);
 	else
-		write(currentAddress, static_cast<byte>(tempByte & LOW_BYTE_MASK));
-
-	return false;
+		write(op.address, static_cast<byte>(result & LOW_BYTE_MASK));
 }
 
 // NOP - No Operation - there are some unofficial NOPs that take additional cycles or have different addressing modes, but this is the standard one
-bool Cpu6502::NOP()
+template <typename Variant>
+void Cpu6502Core<Variant>::NOP(Operand)
 {
-	return false;
+
 }
 
 // ORA - Logical Inclusive OR between Accumulator and memory
-bool Cpu6502::ORA()
+template <typename Variant>
+void Cpu6502Core<Variant>::ORA(Operand op)
 {
-	currentByte = read(currentAddress);
+	const byte value = readOperand(op);
 	
-	A = A | currentByte;
+	A = A | value;
 
 	// Set or clear Zero and Negative Flags
 	updateZeroAndNegativeFlags(A == 0, (A & SIGN_BIT_MASK) != 0);
-
-	return false;
 }
 
 // PHA - Push Accumulator onto Stack
-bool Cpu6502::PHA()
+template <typename Variant>
+void Cpu6502Core<Variant>::PHA(Operand)
 {
 	write(STACK_BASE_ADDRESS + SP--, A);
-	return false;
 }
 
 // PHP - Push Processor Status onto Stack
-bool Cpu6502::PHP()
+template <typename Variant>
+void Cpu6502Core<Variant>::PHP(Operand)
 {
 	write(STACK_BASE_ADDRESS + SP--, status | static_cast<uint8_t>(Flags::B) | static_cast<uint8_t>(Flags::U));
-	return false;
 }
 
 // PLA - Pop Accumulator from Stack
-bool Cpu6502::PLA()
+template <typename Variant>
+void Cpu6502Core<Variant>::PLA(Operand)
 {
 	SP++;
 	A = bus->read(STACK_BASE_ADDRESS + SP);
 	// Set or clear Zero and Negative Flags
 	updateZeroAndNegativeFlags(A == 0, (A & SIGN_BIT_MASK) != 0);
-
-	return false;
 }
 
 // PLP - Pop Processor Status from Stack
-bool Cpu6502::PLP()
+template <typename Variant>
+void Cpu6502Core<Variant>::PLP(Operand)
 {
 	SP++;
 	status = bus->read(STACK_BASE_ADDRESS + SP);
 
+	// B only exists in the pushed copy, as in RTI
+	clearFlag(status, Flags::B);
 	setFlag(status, Flags::U); // Unused flag is always set
-
-	return false;
 }
 
 // ROL - Rotate Left
-bool Cpu6502::ROL()
+template <typename Variant>
+void Cpu6502Core<Variant>::ROL(Operand op)
 {
 	// Use A directly for accumulator form, memory otherwise
-	byte value = (currentAddressingMode == AddressingMode::IMP) ? A : read(currentAddress);
+	byte value = (op.mode == AddressingMode::IMP) ? A : bus->read(op.address);
 
 	const bool oldCarry = getFlag(Flags::C);
 	const bool newCarry = (value & SIGN_BIT_MASK) != 0;
@@ -830,19 +1190,18 @@ bool Cpu6502::ROL()
 	updateFlag(newCarry, Flags::C);
 	updateZeroAndNegativeFlags(value == 0, (value & SIGN_BIT_MASK) != 0);
 
-	if (currentAddressingMode == AddressingMode::IMP)
+	if (op.mode == AddressingMode::IMP)
 		A = value;
 	else
-		write(currentAddress, value);
-
-	return false;
+		write(op.address, value);
 }
 
 // ROR - Rotate Right
-bool Cpu6502::ROR()
+template <typename Variant>
+void Cpu6502Core<Variant>::ROR(Operand op)
 {
 	// Use A directly for accumulator form, memory otherwise
-	byte value = (currentAddressingMode == AddressingMode::IMP) ? A : read(currentAddress);
+	byte value = (op.mode == AddressingMode::IMP) ? A : bus->read(op.address);
 
 	const bool oldCarry = getFlag(Flags::C);
 	const bool newCarry = (value & 0x01) != 0;
@@ -852,16 +1211,15 @@ bool Cpu6502::ROR()
 	updateFlag(newCarry, Flags::C);
 	updateZeroAndNegativeFlags(value == 0, (value & SIGN_BIT_MASK) != 0);
 
-	if (currentAddressingMode == AddressingMode::IMP)
+	if (op.mode == AddressingMode::IMP)
 		A = value;
 	else
-		write(currentAddress, value);
-
-	return false;
+		write(op.address, value);
 }
 
 // RTI - Return from Interrupt
-bool Cpu6502::RTI()
+template <typename Variant>
+void Cpu6502Core<Variant>::RTI(Operand)
 {
 	SP++;
 	status = bus->read(STACK_BASE_ADDRESS + SP);
@@ -871,144 +1229,228 @@ bool Cpu6502::RTI()
 	SP++;
 	PC = getAbsolute(bus->read(STACK_BASE_ADDRESS + SP), bus->read(STACK_BASE_ADDRESS + SP + 1));
 	SP++;
-
-	return false;
 }
 
 // RTS - Return from Subroutine
-bool Cpu6502::RTS()
+template <typename Variant>
+void Cpu6502Core<Variant>::RTS(Operand)
 {
 	SP++;
 	PC = getAbsolute(bus->read(STACK_BASE_ADDRESS + SP), bus->read(STACK_BASE_ADDRESS + SP + 1));
 	SP++;
 
 	PC++; // Increment PC to point to the next instruction after JSR
-
-	return false;
 }
 
 // SBC - Subtract with Carry
-bool Cpu6502::SBC()
+template <typename Variant>
+void Cpu6502Core<Variant>::SBC(Operand op)
 {
-	currentByte = read(currentAddress);
+	const byte value = readOperand(op);
 
-	// Invert currentByte for subtraction
-	uint16_t value_inv = static_cast<uint16_t>(currentByte) ^ LOW_BYTE_MASK;
+	if constexpr (Variant::decimalMode)
+	{
+		if (getFlag(Flags::D))
+		{
+			decimalSubtract(value);
+			return;
+		}
+	}
+
+	// Invert value for subtraction
+	uint16_t value_inv = static_cast<uint16_t>(value) ^ LOW_BYTE_MASK;
 
-	tempWord = static_cast<uint16_t>(A) + static_cast<uint16_t>(value_inv) + static_cast<uint16_t>(getFlag(Flags::C));
+	const uint16_t result = static_cast<uint16_t>(A) + static_cast<uint16_t>(value_inv) + static_cast<uint16_t>(getFlag(Flags::C));
 
 	// Set or clear Carry Flag
-	updateFlag(tempWord & HIGH_BYTE_MASK, Flags::C);
+	updateFlag(result & HIGH_BYTE_MASK, Flags::C);
 
 	// Set or clear Zero and Negative Flags
-	updateZeroAndNegativeFlags((tempWord & LOW_BYTE_MASK) == 0, (tempWord & SIGN_BIT_MASK) != 0);
+	updateZeroAndNegativeFlags((result & LOW_BYTE_MASK) == 0, (result & SIGN_BIT_MASK) != 0);
 
 	// Set or clear Overflow Flag
-	updateFlag((((tempWord ^ static_cast<uint16_t>(A)) & (tempWord ^ value_inv)) & SIGN_BIT_MASK) != 0, Flags::V);
+	updateFlag((((result ^ static_cast<uint16_t>(A)) & (result ^ value_inv)) & SIGN_BIT_MASK) != 0, Flags::V);
 
-	A = static_cast<byte>(tempWord & LOW_BYTE_MASK);
+	A = static_cast<byte>(result & LOW_BYTE_MASK);
 
 	// SBC may require an additional cycle
-	return false;
 }
 
 
 // SEC - Set Carry Flag
-bool Cpu6502::SEC()
+template <typename Variant>
+void Cpu6502Core<Variant>::SEC(Operand)
 {
 	setFlag(status, Flags::C);
-	return false;
 }
 
 // SED - Set Decimal Flag - essentially unused in NES emulation, but implemented for completeness
-bool Cpu6502::SED()
+template <typename Variant>
+void Cpu6502Core<Variant>::SED(Operand)
 {
 	setFlag(status, Flags::D);
-	return false;
 }
 
 // SEI - Set Interrupt Disable
-bool Cpu6502::SEI()
+template <typename Variant>
+void Cpu6502Core<Variant>::SEI(Operand)
 {
 	setFlag(status, Flags::I);
-	return false;
 }
 
 // STA - Store Accumulator in memory
-bool Cpu6502::STA()
+template <typename Variant>
+void Cpu6502Core<Variant>::STA(Operand op)
 {
-	write(currentAddress, A);
-	return false;
+	write(op.address, A);
 }
 
 // STX - Store X Register in memory
-bool Cpu6502::STX()
+template <typename Variant>
+void Cpu6502Core<Variant>::STX(Operand op)
 {
-	write(currentAddress, X);
-	return false;
+	write(op.address, X);
 }
 
 // STY - Store Y Register in memory
-bool Cpu6502::STY()
+template <typename Variant>
+void Cpu6502Core<Variant>::STY(Operand op)
 {
-	write(currentAddress, Y);
-	return false;
+	write(op.address, Y);
 }
 
 // TAX - Transfer Accumulator to X Register
-bool Cpu6502::TAX()
+template <typename Variant>
+void Cpu6502Core<Variant>::TAX(Operand)
 {
 	X = A;
 	// Set or clear Zero and Negative Flags
 	updateZeroAndNegativeFlags(X == 0, (X & SIGN_BIT_MASK) != 0);
-	return false;
 }
 
 // TAY - Transfer Accumulator to Y Register
-bool Cpu6502::TAY()
+template <typename Variant>
+void Cpu6502Core<Variant>::TAY(Operand)
 {
 	Y = A;
 	// Set or clear Zero and Negative Flags
 	updateZeroAndNegativeFlags(Y == 0, (Y & SIGN_BIT_MASK) != 0);
-	return false;
 }
 
 // TSX - Transfer Stack Pointer to X Register
-bool Cpu6502::TSX()
+template <typename Variant>
+void Cpu6502Core<Variant>::TSX(Operand)
 {
 	X = SP;
 	// Set or clear Zero and Negative Flags
 	updateZeroAndNegativeFlags(X == 0, (X & SIGN_BIT_MASK) != 0);
-	return false;
 }
 
 // TXA - Transfer X Register to Accumulator
-bool Cpu6502::TXA()
+template <typename Variant>
+void Cpu6502Core<Variant>::TXA(Operand)
 {
 	A = X;
 	// Set or clear Zero and Negative Flags
 	updateZeroAndNegativeFlags(A == 0, (A & SIGN_BIT_MASK) != 0);
-	return false;
 }
 
 // TXS - Transfer X Register to Stack Pointer
-bool Cpu6502::TXS()
+template <typename Variant>
+void Cpu6502Core<Variant>::TXS(Operand)
 {
 	SP = X;
-	return false;
 }
 
 // TYA - Transfer Y Register to Accumulator
-bool Cpu6502::TYA()
+template <typename Variant>
+void Cpu6502Core<Variant>::TYA(Operand)
 {
 	A = Y;
 	// Set or clear Zero and Negative Flags
 	updateZeroAndNegativeFlags(A == 0, (A & SIGN_BIT_MASK) != 0);
-	return false;
+}
+
+// === 65C02 Instructions ===
+
+// BRA - Branch Always
+template <typename Variant>
+void Cpu6502Core<Variant>::BRA(Operand op)
+{
+	cycles++;
+	checkPageCrossing(op.address);
+
+	PC = op.address;
+}
+
+// PHX - Push X Register onto Stack
+template <typename Variant>
+void Cpu6502Core<Variant>::PHX(Operand)
+{
+	write(STACK_BASE_ADDRESS + SP--, X);
+}
+
+// PHY - Push Y Register onto Stack
+template <typename Variant>
+void Cpu6502Core<Variant>::PHY(Operand)
+{
+	write(STACK_BASE_ADDRESS + SP--, Y);
+}
+
+// PLX - Pop X Register from Stack
+template <typename Variant>
+void Cpu6502Core<Variant>::PLX(Operand)
+{
+	SP++;
+	X = bus->read(STACK_BASE_ADDRESS + SP);
+	// Set or clear Zero and Negative Flags
+	updateZeroAndNegativeFlags(X == 0, (X & SIGN_BIT_MASK) != 0);
+}
+
+// PLY - Pop Y Register from Stack
+template <typename Variant>
+void Cpu6502Core<Variant>::PLY(Operand)
+{
+	SP++;
+	Y = bus->read(STACK_BASE_ADDRESS + SP);
+	// Set or clear Zero and Negative Flags
+	updateZeroAndNegativeFlags(Y == 0, (Y & SIGN_BIT_MASK) != 0);
+}
+
+// STZ - Store Zero in memory
+template <typename Variant>
+void Cpu6502Core<Variant>::STZ(Operand op)
+{
+	write(op.address, 0x00);
+}
+
+// TRB - Test and Reset Bits - Zero flag from A AND memory, then clear the bits of A in memory
+template <typename Variant>
+void Cpu6502Core<Variant>::TRB(Operand op)
+{
+	const byte value = readOperand(op);
+
+	updateFlag((A & value) == 0, Flags::Z);
+	write(op.address, static_cast<byte>(value & ~A));
+}
+
+// TSB - Test and Set Bits - Zero flag from A AND memory, then set the bits of A in memory
+template <typename Variant>
+void Cpu6502Core<Variant>::TSB(Operand op)
+{
+	const byte value = readOperand(op);
+
+	updateFlag((A & value) == 0, Flags::Z);
+	write(op.address, static_cast<byte>(value | A));
 }
 
 // XXX - Illegal/Unknown Instruction
-bool Cpu6502::XXX()
+template <typename Variant>
+void Cpu6502Core<Variant>::XXX(Operand)
 {
-	return false;
+
 }
+
+template class Cpu6502Core<Nmos6502>;
+template class Cpu6502Core<Ricoh2A03>;
+template class Cpu6502Core<Cmos65C02>;
@@ -1,38 +1,45 @@
 #pragma once
+#include <bitset>
 #include <cstdint>
 #include "Flags.h"
 #include "AddressingMode.h"
 #include "Bus.h"
+#include "CpuState.h"
+#include "CpuVariant.h"
+
+// Result of an addressing mode - the effective address (the branch target for REL). Small enough to be passed
+// to the operation in a register instead of going through members.
+struct Operand {
+	memAddress address;
+	AddressingMode mode;
+	bool pageCrossed; // Indexing crossed a page boundary, reads pay one more cycle
+};
 
-using byte = uint8_t;
-using memAddress = uint16_t;
-
-class Cpu6502 {
+// The architectural state lives in the CpuState base (getState/setState), everything else an instruction
+// needs is a local
+template <typename Variant>
+class Cpu6502Core : public CpuState {
 public:
 
-	Cpu6502() {
+	Cpu6502Core() {
 		bus = nullptr;
 	}
 
-	Cpu6502(Bus* n) {
+	Cpu6502Core(Bus* n) {
 		bus = n;
 	}
-	~Cpu6502() = default;
-
-	// Registers
-	byte  A = 0x00;   // Accumulator Register
-	byte  X = 0x00;   // X Register
-	byte  Y = 0x00;   // Y Register
-	byte  SP = 0x00;  // Stack Pointer
-	memAddress PC = 0x0000; // Program Counter Register
-	byte  status = 0x00; // Status Register
+	~Cpu6502Core() = default;
 
 	// General
 	class Bus* bus = nullptr;
 
+	const CpuState& getState() const { return *this; }
+	void setState(const CpuState& state) { static_cast<CpuState&>(*this) = state; }
+
 	void reset();
 
-	void executeInterrupt();
+	// Pushes PC and status and jumps through vector - 0xFFFA for NMI, 0xFFFE for IRQ
+	void executeInterrupt(memAddress vector);
 	void interrupt(); // Maskable Interrupt
 	void nonMaskableInterrupt();
 
@@ -40,95 +47,121 @@ public:
 	void clock();
 	bool instructionComplete();
 
+	// Idle loop fast-forward - call at an instruction boundary with the cycles left until the next interrupt or
+	// scheduled event. Skips whole iterations of a side-effect free wait loop at PC, adds them to totalCycles
+	// and returns the cycles skipped.
+	uint64_t skipIdleLoop(uint64_t cycleBudget);
+
+	// Superinstruction fusion - LDA+STA, CMP/CPX/CPY/DEX/DEY/INX/INY+Bxx and CLC+ADC run in one dispatch with the
+	// same state, bus accesses and cycles as separately. Off by default since the pair has no boundary in between:
+	// a pair is only fused if its first instruction ends before fusionLimit (the next cycle an interrupt could be
+	// raised at), did not touch a device and the second one is not a breakpoint.
+	void setFusion(bool enabled) { fusionEnabled = enabled; }
+	void setFusionLimit(uint64_t cycle) { fusionLimit = cycle; }
+	void setBreakpoints(const std::bitset<0x10000>* map) { breakpoints = map; }
+	uint64_t fusedPairs = 0; // Pairs executed as one dispatch
+
 	void connectBus(class Bus* busPtr) {
 		bus = busPtr;
 	}
 
 	// helpers
 	void updateZeroAndNegativeFlags(bool zeroCondition, bool negativeCondition);
-	void checkPageCrossing();
-	void CompareLogic(uint16_t registerValue);
+	void checkPageCrossing(memAddress target);
+	void CompareLogic(uint16_t registerValue, byte value);
 
 	// addressing modes
-	bool IMP(); //Implicit (with Accumulator included)
-	bool IMM(); //Immediate
-	bool ZP0(); //Zero Page
-	bool ZPX(); //Zero Page,X
-	bool ZPY(); //Zero Page,Y
-	bool REL(); //Relative
-	bool ABS(); //Absolute
-	bool ABX(); //Absolute,X
-	bool ABY(); //Absolute,Y
-	bool IND(); //Indirect
-	bool IZX(); //Indexed Indirect
-	bool IZY(); //Indirect Indexed
+	Operand IMP(); //Implicit (with Accumulator included)
+	Operand IMM(); //Immediate
+	Operand ZP0(); //Zero Page
+	Operand ZPX(); //Zero Page,X
+	Operand ZPY(); //Zero Page,Y
+	Operand REL(); //Relative
+	Operand ABS(); //Absolute
+	Operand ABX(); //Absolute,X
+	Operand ABY(); //Absolute,Y
+	Operand IND(); //Indirect
+	Operand IZX(); //Indexed Indirect
+	Operand IZY(); //Indirect Indexed
+	Operand ZPI(); //Zero Page Indirect (65C02)
+	Operand IAX(); //Absolute Indexed Indirect (65C02)
 
 
 	// instructions
-	bool ADC();
-	bool AND();
-	bool ASL();
-	bool BCC();
-	bool BCS();
-	bool BEQ();
-	bool BIT();
-	bool BMI();
-	bool BNE();
-	bool BPL();
-	bool BRK();
-	bool BVC();
-	bool BVS();
-	bool CLC();
-
-	bool CLD();
-	bool CLI();
-	bool CLV();
-	bool CMP();
-	bool CPX();
-	bool CPY();
-	bool DEC();
-	bool DEX();
-	bool DEY();
-	bool EOR();
-	bool INC();
-	bool INX();
-	bool INY();
-	bool JMP();
-
-	bool JSR();
-	bool LDA();
-	bool LDX();
-	bool LDY();
-	bool LSR();
-	bool NOP();
-	bool ORA();
-	bool PHA();
-	bool PHP();
-	bool PLA();
-	bool PLP();
-	bool ROL();
-	bool ROR();
-	bool RTI();
-
-	bool RTS();
-	bool SBC();
-	bool SEC();
-	bool SED();
-	bool SEI();
-	bool STA();
-	bool STX();
-	bool STY();
-	bool TAX();
-	bool TAY();
-	bool TSX();
-	bool TXA();
-	bool TXS();
-	bool TYA();
-
-	bool XXX(); // Illegal/Unknown Instruction
+	void ADC(Operand op);
+	void AND(Operand op);
+	void ASL(Operand op);
+	void BCC(Operand op);
+	void BCS(Operand op);
+	void BEQ(Operand op);
+	void BIT(Operand op);
+	void BMI(Operand op);
+	void BNE(Operand op);
+	void BPL(Operand op);
+	void BRK(Operand op);
+	void BVC(Operand op);
+	void BVS(Operand op);
+	void CLC(Operand op);
+
+	void CLD(Operand op);
+	void CLI(Operand op);
+	void CLV(Operand op);
+	void CMP(Operand op);
+	void CPX(Operand op);
+	void CPY(Operand op);
+	void DEC(Operand op);
+	void DEX(Operand op);
+	void DEY(Operand op);
+	void EOR(Operand op);
+	void INC(Operand op);
+	void INX(Operand op);
+	void INY(Operand op);
+	void JMP(Operand op);
+
+	void JSR(Operand op);
+	void LDA(Operand op);
+	void LDX(Operand op);
+	void LDY(Operand op);
+	void LSR(Operand op);
+	void NOP(Operand op);
+	void ORA(Operand op);
+	void PHA(Operand op);
+	void PHP(Operand op);
+	void PLA(Operand op);
+	void PLP(Operand op);
+	void ROL(Operand op);
+	void ROR(Operand op);
+	void RTI(Operand op);
+
+	void RTS(Operand op);
+	void SBC(Operand op);
+	void SEC(Operand op);
+	void SED(Operand op);
+	void SEI(Operand op);
+	void STA(Operand op);
+	void STX(Operand op);
+	void STY(Operand op);
+	void TAX(Operand op);
+	void TAY(Operand op);
+	void TSX(Operand op);
+	void TXA(Operand op);
+	void TXS(Operand op);
+	void TYA(Operand op);
+
+	// 65C02 instructions
+	void BRA(Operand op);
+	void PHX(Operand op);
+	void PHY(Operand op);
+	void PLX(Operand op);
+	void PLY(Operand op);
+	void STZ(Operand op);
+	void TRB(Operand op);
+	void TSB(Operand op);
+
+	void XXX(Operand op); // Illegal/Unknown Instruction
 
 private:
-	byte read(memAddress addr);
+	byte readOperand(Operand op); // A for the accumulator form, memory otherwise
 	void write(memAddress addr, byte data);
 
 	bool getFlag(Flags flag);
@@ -136,18 +169,31 @@ private:
 	void clearFlag(uint8_t& status, Flags flag); // Clear flag
 	void updateFlag(bool condition, Flags flag); // Set or clear flag based on condition
 
-	// Map addressing mode function pointer to AddressingMode enum
-	AddressingMode mapAddressMode(bool (Cpu6502::* addrFn)());
+	void fuseNext(byte firstOpcode, Operand firstOperand);
+
+	bool peekPlain(memAddress addr, byte& value);
+	bool branchTaken(byte branchOpcode) const;
+
+	// Decimal mode arithmetic - only reached on variants with decimal mode
+	void decimalAdd(byte value);
+	void decimalSubtract(byte value);
 
-	// Internal helper variables
-	byte currentByte = 0x00; // Current data byte 
-	byte opcode = 0x00; // Current opcode byte
-	AddressingMode currentAddressingMode = AddressingMode::IMP; // Current addressing mode 
-	uint8_t cycles = 0;
-	memAddress currentAddress = 0x0000;
-	memAddress relativeAddress = 0x00;
-	bool readFlag = false;
-	byte tempByte = 0x00;
-	uint16_t tempWord = 0x0000;
+	bool fusionEnabled = false;
+	uint64_t fusionLimit = ~0ull;
+	const std::bitset<0x10000>* breakpoints = nullptr;
 
+	// Opcode fetched by fuseNext() for a pair that did not fuse - only used by the instruction starting at that PC
+	// and cycle, anything else (an interrupt, a restored state) fetches again
+	bool prefetched = false;
+	byte prefetchedOpcode = 0;
+	memAddress prefetchedPC = 0;
+	uint64_t prefetchedCycle = 0;
 };
+
+using Cpu6502 = Cpu6502Core<Nmos6502>;
+using Cpu2A03 = Cpu6502Core<Ricoh2A03>;
+using Cpu65C02 = Cpu6502Core<Cmos65C02>;
+
+extern template class Cpu6502Core<Nmos6502>;
+extern template class Cpu6502Core<Ricoh2A03>;
+extern template class Cpu6502Core<Cmos65C02>;
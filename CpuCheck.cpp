@@ -0,0 +1,230 @@
+#include <iostream>
+#include <string>
+
+#include "Assembler.h"
+#include "Cpu6502.h"
+#include "CpuCheck.h"
+#include "FlatBus.h"
+
+// Runs the CPU to the end of the instruction or interrupt sequence in flight, or through the next one
+template <typename Cpu>
+static void Step(Cpu& cpu)
+{
+    do {
+        cpu.clock();
+    } while (!cpu.instructionComplete());
+}
+
+// Vectors point at separate handlers, so landing on the wrong one shows
+static const char* const INTERRUPT_SOURCE = R"(
+        .org $8000
+reset:  cli
+        sed
+loop:   nop
+        jmp loop
+
+        .org $9000
+nmi:    rti
+        .org $A000
+irq:    rti
+
+        .org $FFFA
+        .word nmi, reset, irq
+)";
+
+// An NMI and an IRQ taken between two instructions push PC and status (B clear) and jump through their own vector
+template <typename Cpu>
+static bool CheckInterrupts(const char* name, const AssembledProgram& program, bool clearsDecimal)
+{
+    FlatBus bus;
+    LoadProgram(bus, program);
+    Cpu cpu(&bus);
+    cpu.reset();
+    Step(cpu);
+    for (int i = 0; i < 3; ++i)
+        Step(cpu);
+
+    bool ok = true;
+    for (const bool nmi : { true, false }) {
+        const uint16_t returnPC = cpu.PC;
+        const uint8_t sp = cpu.SP;
+        const uint64_t start = cpu.totalCycles;
+        if (nmi)
+            cpu.nonMaskableInterrupt();
+        else
+            cpu.interrupt();
+        Step(cpu);
+
+        const uint16_t handler = program.symbols.at(nmi ? "nmi" : "irq");
+        const uint8_t pushed = bus.read(static_cast<uint16_t>(0x0100 + static_cast<uint8_t>(sp - 2)));
+        const uint16_t pushedPC = static_cast<uint16_t>(bus.read(static_cast<uint16_t>(0x0100 + static_cast<uint8_t>(sp - 1))) |
+                                                        (bus.read(static_cast<uint16_t>(0x0100 + sp)) << 8));
+        // The 65C02 leaves decimal mode in the handler, the NMOS parts keep it
+        const bool decimal = (cpu.status & static_cast<uint8_t>(Flags::D)) != 0;
+        const bool pass = cpu.PC == handler && cpu.SP == static_cast<uint8_t>(sp - 3) && pushedPC == returnPC &&
+            (pushed & static_cast<uint8_t>(Flags::B)) == 0 && (cpu.status & static_cast<uint8_t>(Flags::I)) != 0 &&
+            decimal != clearsDecimal && cpu.totalCycles - start == (nmi ? 8u : 7u);
+        std::cout << name << (nmi ? " NMI: " : " IRQ: ") << (pass ? "ok" : "FAILED") << " - PC $" << std::hex << std::uppercase
+                  << cpu.PC << " (handler $" << handler << "), pushed P $" << static_cast<unsigned>(pushed) << std::dec
+                  << ", " << cpu.totalCycles - start << " cycle(s)\n";
+        ok = ok && pass;
+
+        Step(cpu); // RTI
+        if (cpu.PC != returnPC) {
+            std::cout << name << (nmi ? " NMI" : " IRQ") << ": RTI did not return\n";
+            ok = false;
+        }
+    }
+    return ok;
+}
+
+// Known-answer sequences - registers, status and cycle count after running from reset to the instruction at `done`,
+// worked out by hand from the data sheets rather than from this emulator
+struct KnownAnswer {
+    const char* name;
+    const char* variant; // Assembler variant and the CPU that runs it
+    const char* source;
+    uint8_t a, x, y, p;
+    uint64_t cycles;
+};
+
+// $99 + $01 in decimal mode: the NMOS part takes Z from the binary sum and N from the high nibble, the 65C02 fixes
+// both and spends a cycle on it, the 2A03 ignores D and adds in binary
+static const char* const DECIMAL_ADC_SOURCE = R"(
+        .org $8000
+reset:  sed
+        clc
+        lda #$99
+        adc #$01
+done:   jmp done
+        .org $FFFC
+        .word reset
+)";
+
+// $00 - $01 in decimal mode wraps to $99 with a borrow, flags follow the binary $FF on every part
+static const char* const DECIMAL_SBC_SOURCE = R"(
+        .org $8000
+reset:  sed
+        sec
+        lda #$00
+        sbc #$01
+done:   jmp done
+        .org $FFFC
+        .word reset
+)";
+
+// JMP ($10FF) takes the high byte from $1000 on the NMOS parts, the 65C02 reads $1100 and takes a cycle more
+static const char* const JMP_INDIRECT_SOURCE = R"(
+        .org $8000
+reset:  lda #$00
+        sta $10FF
+        lda #$90
+        sta $1100
+        lda #$A0
+        sta $1000
+        jmp ($10FF)
+        .org $9000
+fixed:  ldy #$90
+        jmp done
+        .org $A000
+wrapped: ldy #$A0
+done:   jmp done
+        .org $FFFC
+        .word reset
+)";
+
+// 65C02 additions - PHX/PLY, TSB, STZ, (zp) addressing, INC A and BRA
+static const char* const CMOS_SOURCE = R"(
+        .org $8000
+reset:  ldx #$12
+        phx
+        ply
+        lda #$F0
+        sta $10
+        lda #$0F
+        tsb $10
+        stz $11
+        lda #$10
+        sta $20
+        stz $21
+        lda ($20)
+        inc a
+        bra done
+        ldx #$FF
+done:   jmp done
+        .org $FFFC
+        .word reset
+)";
+
+static const KnownAnswer KNOWN_ANSWERS[] = {
+    { "decimal ADC", "6502", DECIMAL_ADC_SOURCE, 0x00, 0x00, 0x00, 0xA9, 8 },
+    { "decimal ADC", "2a03", DECIMAL_ADC_SOURCE, 0x9A, 0x00, 0x00, 0xA8, 8 },
+    { "decimal ADC", "65c02", DECIMAL_ADC_SOURCE, 0x00, 0x00, 0x00, 0x2B, 9 },
+    { "decimal SBC", "6502", DECIMAL_SBC_SOURCE, 0x99, 0x00, 0x00, 0xA8, 8 },
+    { "decimal SBC", "2a03", DECIMAL_SBC_SOURCE, 0xFF, 0x00, 0x00, 0xA8, 8 },
+    { "decimal SBC", "65c02", DECIMAL_SBC_SOURCE, 0x99, 0x00, 0x00, 0xA8, 9 },
+    { "JMP ($10FF)", "6502", JMP_INDIRECT_SOURCE, 0xA0, 0x00, 0xA0, 0xA0, 25 },
+    { "JMP ($10FF)", "2a03", JMP_INDIRECT_SOURCE, 0xA0, 0x00, 0xA0, 0xA0, 25 },
+    { "JMP ($10FF)", "65c02", JMP_INDIRECT_SOURCE, 0xA0, 0x00, 0x90, 0xA0, 29 },
+    { "CMOS opcodes", "65c02", CMOS_SOURCE, 0x00, 0x12, 0x12, 0x22, 42 },
+};
+
+template <typename Cpu>
+static bool CheckKnownAnswer(const KnownAnswer& check, const AssembledProgram& program)
+{
+    FlatBus bus;
+    LoadProgram(bus, program);
+    Cpu cpu(&bus);
+    cpu.reset();
+    Step(cpu);
+
+    const uint16_t done = program.symbols.at("done");
+    const uint64_t start = cpu.totalCycles;
+    for (int i = 0; i < 100 && cpu.PC != done; ++i)
+        Step(cpu);
+
+    const uint64_t cycles = cpu.totalCycles - start;
+    const bool pass = cpu.PC == done && cpu.A == check.a && cpu.X == check.x && cpu.Y == check.y &&
+        cpu.status == check.p && cycles == check.cycles;
+    std::cout << check.variant << ' ' << check.name << ": " << (pass ? "ok" : "FAILED") << std::hex << std::uppercase
+              << " - A $" << static_cast<unsigned>(cpu.A) << " X $" << static_cast<unsigned>(cpu.X) << " Y $"
+              << static_cast<unsigned>(cpu.Y) << " P $" << static_cast<unsigned>(cpu.status) << std::dec << ", " << cycles
+              << " cycle(s)";
+    if (!pass)
+        std::cout << std::hex << " (expected A $" << static_cast<unsigned>(check.a) << " X $" << static_cast<unsigned>(check.x)
+                  << " Y $" << static_cast<unsigned>(check.y) << " P $" << static_cast<unsigned>(check.p) << std::dec << ", "
+                  << check.cycles << " cycle(s))";
+    std::cout << '\n';
+    return pass;
+}
+
+int RunCpuCheck()
+{
+    AssembledProgram interrupts;
+    std::string error;
+    if (!Assemble(INTERRUPT_SOURCE, interrupts, error)) {
+        std::cerr << "cpucheck: " << error << std::endl;
+        return 2;
+    }
+
+    bool ok = CheckInterrupts<Cpu6502>("6502", interrupts, false);
+    ok = CheckInterrupts<Cpu2A03>("2A03", interrupts, false) && ok;
+    ok = CheckInterrupts<Cpu65C02>("65C02", interrupts, true) && ok;
+
+    for (const KnownAnswer& check : KNOWN_ANSWERS) {
+        AssembledProgram program;
+        if (!Assemble(check.source, program, error, check.variant)) {
+            std::cerr << "cpucheck: " << check.variant << ' ' << check.name << ": " << error << std::endl;
+            return 2;
+        }
+        const std::string variant = check.variant;
+        if (variant == "6502")
+            ok = CheckKnownAnswer<Cpu6502>(check, program) && ok;
+        else if (variant == "2a03")
+            ok = CheckKnownAnswer<Cpu2A03>(check, program) && ok;
+        else
+            ok = CheckKnownAnswer<Cpu65C02>(check, program) && ok;
+    }
+    std::cout << std::flush;
+    return ok ? 0 : 1;
+}
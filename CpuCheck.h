@@ -0,0 +1,6 @@
+#pragma once
+
+// cpucheck - known-answer checks of CPU behaviour the nestest trace does not reach: interrupt vectors and the
+// interrupt sequence on every variant, decimal mode ADC/SBC, the JMP ($xxFF) page wrap and the 65C02 opcodes, each
+// with its expected registers and cycle count. Prints each check, exit code 1 if any fails.
+int RunCpuCheck();
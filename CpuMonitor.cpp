@@ -0,0 +1,140 @@
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Assembler.h"
+#include "Cpu6502.h"
+#include "CpuMonitor.h"
+#include "DeviceBus.h"
+#include "GuestBench.h"
+
+void CpuMonitor::publish(const CpuState& state, uint64_t retired)
+{
+    nextCycle = state.totalCycles + interval;
+
+    // Writer side of the seqlock: odd sequence, fence, data, even sequence. The release fence keeps the data
+    // stores from being seen before the odd sequence, the final release store keeps them before the even one.
+    const uint64_t s = sequence.load(std::memory_order_relaxed);
+    sequence.store(s + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    registers.store(static_cast<uint64_t>(state.PC) | static_cast<uint64_t>(state.A) << 16 | static_cast<uint64_t>(state.X) << 24 |
+                    static_cast<uint64_t>(state.Y) << 32 | static_cast<uint64_t>(state.SP) << 40 |
+                    static_cast<uint64_t>(state.status) << 48, std::memory_order_relaxed);
+    cycleCount.store(state.totalCycles, std::memory_order_relaxed);
+    instructionCount.store(instructions + retired, std::memory_order_relaxed);
+    sequence.store(s + 2, std::memory_order_release);
+}
+
+bool CpuMonitor::tryRead(MonitorSnapshot& snapshot) const
+{
+    const uint64_t before = sequence.load(std::memory_order_acquire);
+    if ((before & 1) != 0)
+        return false;
+    const uint64_t r = registers.load(std::memory_order_relaxed);
+    const uint64_t c = cycleCount.load(std::memory_order_relaxed);
+    const uint64_t n = instructionCount.load(std::memory_order_relaxed);
+    // The data loads may not move below the second sequence load
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (sequence.load(std::memory_order_relaxed) != before)
+        return false;
+
+    snapshot.PC = static_cast<uint16_t>(r);
+    snapshot.A = static_cast<uint8_t>(r >> 16);
+    snapshot.X = static_cast<uint8_t>(r >> 24);
+    snapshot.Y = static_cast<uint8_t>(r >> 32);
+    snapshot.SP = static_cast<uint8_t>(r >> 40);
+    snapshot.status = static_cast<uint8_t>(r >> 48);
+    snapshot.totalCycles = c;
+    snapshot.instructions = n;
+    snapshot.publication = before / 2;
+    return true;
+}
+
+MonitorSnapshot CpuMonitor::read() const
+{
+    MonitorSnapshot snapshot;
+    while (!tryRead(snapshot))
+        std::this_thread::yield();
+    return snapshot;
+}
+
+int RunMonitorDemo(uint64_t cycles, uint64_t interval)
+{
+    const GuestKernel& kernel = GuestKernels()[1]; // crc32 - registers and memory change constantly
+    AssembledProgram program;
+    std::string error;
+    if (!Assemble(kernel.source, program, error)) {
+        std::cerr << kernel.name << ": " << error << std::endl;
+        return 2;
+    }
+
+    // Seconds to run the guest, with or without a monitor attached
+    auto run = [&](CpuMonitor* monitor) {
+        DeviceBus bus;
+        LoadProgram(bus, program);
+        bus.addHook(monitor);
+        Cpu6502 cpu(&bus);
+        cpu.reset();
+        const auto begin = std::chrono::steady_clock::now();
+        RunSynced(cpu, bus, cycles);
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+    };
+
+    const double plain = run(nullptr);
+    CpuMonitor unread(interval);
+    const double published = run(&unread);
+
+    struct Observer {
+        uint64_t reads = 0;
+        uint64_t snapshots = 0; // Distinct publications seen
+        uint64_t errors = 0;    // Snapshots that went backwards or do not belong together
+        std::thread thread;
+    };
+    // Observers poll like a UI or a metrics exporter would, a spinning reader would only compete for a core
+    CpuMonitor monitor(interval);
+    std::atomic<bool> stop{ false };
+    std::vector<Observer> observers(2);
+    for (Observer& observer : observers) {
+        observer.thread = std::thread([&monitor, &stop, &observer, interval] {
+            MonitorSnapshot last;
+            while (!stop.load(std::memory_order_relaxed)) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                const MonitorSnapshot s = monitor.read();
+                ++observer.reads;
+                if (s.publication == last.publication)
+                    continue;
+                ++observer.snapshots;
+                // Publication n is taken at least (n - 1) * interval cycles in, and no instruction is under 2 cycles
+                const bool ordered = s.publication > last.publication && s.totalCycles > last.totalCycles && s.instructions >= last.instructions;
+                const bool whole = s.totalCycles + interval >= s.publication * interval && s.totalCycles >= 2 * s.instructions;
+                if (!ordered || !whole)
+                    ++observer.errors;
+                last = s;
+            }
+        });
+    }
+    const double monitored = run(&monitor);
+    stop = true;
+    uint64_t errors = 0;
+    for (Observer& observer : observers) {
+        observer.thread.join();
+        errors += observer.errors;
+    }
+
+    const MonitorSnapshot final = monitor.read();
+    std::cout << "unmonitored:            " << cycles / plain / 1e6 << " MHz\n";
+    std::cout << "publishing, no readers: " << cycles / published / 1e6 << " MHz (" << (published / plain - 1.0) * 100.0 << "%)\n";
+    std::cout << "publishing, 2 readers:  " << cycles / monitored / 1e6 << " MHz (" << (monitored / plain - 1.0) * 100.0 << "%), "
+              << final.publication << " snapshot(s), one every " << interval << " cycles\n";
+    std::cout << "last snapshot: PC $" << std::hex << std::uppercase << final.PC << " A $" << static_cast<unsigned>(final.A)
+              << " X $" << static_cast<unsigned>(final.X) << " Y $" << static_cast<unsigned>(final.Y) << std::dec << ", cycle "
+              << final.totalCycles << ", " << final.instructions << " instruction(s)\n";
+    for (size_t i = 0; i < observers.size(); ++i) {
+        std::cout << "observer " << i << ": " << observers[i].reads << " read(s), " << observers[i].snapshots
+                  << " distinct snapshot(s), " << observers[i].errors << " inconsistent\n";
+    }
+    std::cout << std::flush;
+    return errors == 0 && final.publication > 0 ? 0 : 1;
+}
@@ -0,0 +1,72 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include "CpuState.h"
+#include "RunHook.h"
+
+// Registers and counters as of one instruction boundary
+struct MonitorSnapshot {
+    uint16_t PC = 0;
+    uint8_t A = 0;
+    uint8_t X = 0;
+    uint8_t Y = 0;
+    uint8_t SP = 0;
+    uint8_t status = 0;
+    uint64_t totalCycles = 0;
+    uint64_t instructions = 0; // Instructions run since the monitor was attached (a fused pair counts as one,
+                               // fast-forwarded idle loop iterations are not counted)
+    uint64_t publication = 0;  // Number of this snapshot, 0 before the first one
+};
+
+// CPU state for threads other than the emulator's, published through a seqlock. As a hook of the machine's bus
+// (DeviceBus::addHook), the emulation thread (the only writer) publishes a snapshot at the first instruction
+// boundary past every interval cycles: three relaxed stores between two sequence updates, no lock and no
+// read-modify-write. Readers retry while a publication is in progress or raced them, so they always see one
+// whole snapshot and never hold up the emulator.
+class CpuMonitor final : public RunHook {
+public:
+    explicit CpuMonitor(uint64_t intervalCycles = 10000) : interval(intervalCycles) {}
+    CpuMonitor(const CpuMonitor&) = delete;
+    CpuMonitor& operator=(const CpuMonitor&) = delete;
+
+    // === Emulation thread ===
+
+    // Takes effect when the monitor is next added to a bus
+    void setInterval(uint64_t cycles) { interval = cycles; nextCycle = 0; }
+
+    // Publishes state, retired is the instructions run so far by the current run call. The next publication is
+    // due interval cycles on.
+    void publish(const CpuState& state, uint64_t retired);
+
+    // End of a run call that retired instructions
+    void endRun(uint64_t retired) { instructions += retired; }
+
+    uint64_t nextHookCycle() const override { return nextCycle; }
+    void runHook(const CpuState& cpu, DeviceBus&, const RunCounts& counts) override {
+        publish(cpu, counts.instructions);
+    }
+    void endRunHook(const CpuState&, const RunCounts& counts) override { endRun(counts.instructions); }
+
+    // === Any thread ===
+
+    // Latest snapshot - consistent, spins only while a publication is being written
+    MonitorSnapshot read() const;
+
+    // One attempt, false if it raced a publication
+    bool tryRead(MonitorSnapshot& snapshot) const;
+
+private:
+    // Written by the emulation thread only, kept off the published line
+    uint64_t interval;
+    uint64_t nextCycle = 0;
+    uint64_t instructions = 0; // Up to the start of the current run call
+
+    // Odd while a publication is being written
+    alignas(64) std::atomic<uint64_t> sequence{ 0 };
+    std::atomic<uint64_t> registers{ 0 }; // PC | A << 16 | X << 24 | Y << 32 | SP << 40 | status << 48
+    std::atomic<uint64_t> cycleCount{ 0 };
+    std::atomic<uint64_t> instructionCount{ 0 };
+};
+
+// monitor [cycles] [interval] - guest speed without a monitor, publishing to one, and with two threads polling it
+int RunMonitorDemo(uint64_t cycles, uint64_t interval);
@@ -0,0 +1,26 @@
+#pragma once
+#include <cstdint>
+#include <type_traits>
+
+using byte = uint8_t;
+using memAddress = uint16_t;
+
+// Architectural state of the CPU - registers, the cycle counter and the cycles left of the current instruction.
+// Trivially copyable and exactly one cache line, so snapshots, save states and arrays of CPUs are plain
+// memcpy and two CPUs never share a line.
+struct alignas(64) CpuState {
+	uint64_t totalCycles = 0; // Cycles elapsed, published to the bus at every instruction start
+
+	// Registers
+	memAddress PC = 0x0000; // Program Counter Register
+	byte  A = 0x00;   // Accumulator Register
+	byte  X = 0x00;   // X Register
+	byte  Y = 0x00;   // Y Register
+	byte  SP = 0x00;  // Stack Pointer
+	byte  status = 0x00; // Status Register
+
+	uint8_t cycles = 0; // Cycles left of the instruction in flight
+};
+
+static_assert(std::is_trivially_copyable_v<CpuState>, "CpuState must stay memcpy-able");
+static_assert(sizeof(CpuState) == 64, "CpuState must fit a single cache line");
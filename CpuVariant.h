@@ -0,0 +1,23 @@
+#pragma once
+
+// CPU variant policies - Cpu6502Core<Variant> reads these constants with `if constexpr`,
+// so each variant only carries the code for its own quirks.
+
+// Original NMOS 6502 - decimal mode, JMP ($xxFF) page wrap bug
+struct Nmos6502 {
+	static constexpr bool decimalMode = true;
+	static constexpr bool cmosExtensions = false;
+};
+
+// Ricoh 2A03 (NES) - NMOS core with the decimal mode circuitry removed, the D flag is stored but ignored
+struct Ricoh2A03 {
+	static constexpr bool decimalMode = false;
+	static constexpr bool cmosExtensions = false;
+};
+
+// CMOS 65C02 - extra opcodes and (zp) addressing, fixed JMP ($xxFF), valid N/Z flags in decimal mode
+// (at the cost of one extra cycle), D flag cleared on interrupts. Rockwell/WDC bit opcodes (RMB/SMB/BBR/BBS) are not included.
+struct Cmos65C02 {
+	static constexpr bool decimalMode = true;
+	static constexpr bool cmosExtensions = true;
+};
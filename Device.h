@@ -0,0 +1,65 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+
+// Memory-mapped peripheral with lazy (catch-up) synchronization. A device is not stepped alongside the CPU -
+// it remembers the cycle it was last brought up to date and runs forward only when the CPU touches one of its
+// registers or when its own deadline (timer expiry, transfer completion...) arrives.
+class Device {
+public:
+    static constexpr uint64_t NO_DEADLINE = std::numeric_limits<uint64_t>::max();
+
+    virtual ~Device() = default;
+
+    // Register access, offset is relative to the address the device is mapped at.
+    // The bus always calls catchUp() with the current cycle first.
+    virtual uint8_t readRegister(uint16_t offset) = 0;
+    virtual void writeRegister(uint16_t offset, uint8_t data) = 0;
+
+    // Next cycle at which the device changes state visibly on its own (e.g. raises IRQ), or NO_DEADLINE.
+    // Once the device has been caught up to it, the deadline must move past the synced cycle.
+    virtual uint64_t nextDeadline() const { return NO_DEADLINE; }
+
+    // Level of the device's IRQ output
+    virtual bool irqAsserted() const { return false; }
+
+    // CPU cycles the device took from the CPU since the last call (bulk transfers, DMA) - the run loop halts the
+    // CPU for them after the current instruction
+    virtual uint64_t takeStallCycles() { return 0; }
+
+    // Snapshots (MachineSnapshot) - the device's state as stateSize() plain bytes, the synced cycle is saved by
+    // the bus. Devices without state keep the defaults, a device that cannot be put back to an earlier state
+    // (input from the host it cannot give back) returns false from canSaveState(). Host side effects (console
+    // output, files) are not undone.
+    virtual bool canSaveState() const { return true; }
+    virtual size_t stateSize() const { return 0; }
+    virtual void saveState(uint8_t*) const {}
+    virtual void loadState(const uint8_t*) {}
+
+    // Brings the device up to cycle
+    void catchUp(uint64_t cycle) {
+        if (cycle > syncedCycle) {
+            advance(syncedCycle, cycle);
+            syncedCycle = cycle;
+        }
+    }
+
+    uint64_t getSyncedCycle() const { return syncedCycle; }
+
+    // Starts counting from cycle without running the cycles before it (attach mid-run, state restore)
+    void setSyncedCycle(uint64_t cycle) { syncedCycle = cycle; }
+
+protected:
+    // Runs the device's internal state from fromCycle to toCycle in one go
+    virtual void advance(uint64_t fromCycle, uint64_t toCycle) = 0;
+
+    // For saveState/loadState - copies a trivially copyable member to or from the state bytes
+    template <typename T>
+    static uint8_t* putState(uint8_t* out, const T& value) { std::memcpy(out, &value, sizeof(T)); return out + sizeof(T); }
+    template <typename T>
+    static const uint8_t* getState(const uint8_t* in, T& value) { std::memcpy(&value, in, sizeof(T)); return in + sizeof(T); }
+
+    uint64_t syncedCycle = 0;
+};
@@ -0,0 +1,257 @@
+#include <cstring>
+
+#include "DeviceBus.h"
+#include "InputLog.h"
+#include "StateHash.h"
+
+DeviceBus::DeviceBus() = default;
+DeviceBus::~DeviceBus() = default;
+
+uint8_t DeviceBus::read(uint16_t addr)
+{
+    if (const Mapping* m = mappingAt(addr)) {
+        m->device->catchUp(currentCycle);
+        uint8_t data = m->device->readRegister(static_cast<uint16_t>(addr - m->base));
+        refreshDevices();
+        if (inputLog != nullptr) {
+            // The device still sees the read (side effects), but replay returns what the recording got
+            if (inputLog->getMode() == InputLog::Mode::Record)
+                inputLog->recordRead(currentCycle, addr, data);
+            else
+                data = inputLog->replayRead(currentCycle, addr);
+        }
+        return data;
+    }
+    return ram.read(addr);
+}
+
+void DeviceBus::write(uint16_t addr, uint8_t data)
+{
+    if (const Mapping* m = mappingAt(addr)) {
+        m->device->catchUp(currentCycle);
+        m->device->writeRegister(static_cast<uint16_t>(addr - m->base), data);
+        refreshDevices();
+        return;
+    }
+    if (hasher)
+        hasher->markDirty(addr);
+    writtenPages[addr >> 14] |= 1ull << ((addr >> 8) & 63);
+    ram.write(addr, data);
+}
+
+void DeviceBus::markDirty(uint16_t begin, uint32_t size)
+{
+    if (hasher)
+        hasher->markDirty(begin, size);
+    if (size == 0)
+        return;
+    const uint32_t last = (begin + size - 1) >> 8;
+    for (uint32_t page = begin >> 8; page <= last; ++page)
+        writtenPages[(page >> 6) & 3] |= 1ull << (page & 63);
+}
+
+bool DeviceBus::isPlainMemory(uint16_t addr) const
+{
+    return mappingAt(addr) == nullptr;
+}
+
+bool DeviceBus::attach(Device* device, uint16_t base, uint32_t size)
+{
+    if (device == nullptr || size == 0 || size > 0x10000u - base || mappings.size() >= MAX_DEVICES) {
+        return false;
+    }
+
+    const uint32_t firstPage = base >> 8;
+    const uint32_t lastPage = (base + size - 1) >> 8;
+    for (uint32_t page = firstPage; page <= lastPage; ++page) {
+        if (pageMapping[page] != 0) {
+            return false;
+        }
+    }
+
+    mappings.push_back({ device, base, size });
+    for (uint32_t page = firstPage; page <= lastPage; ++page) {
+        pageMapping[page] = static_cast<uint8_t>(mappings.size());
+    }
+
+    // A device attached mid-run starts at the current cycle instead of replaying from zero
+    device->setSyncedCycle(currentCycle);
+    refreshDevices();
+    return true;
+}
+
+void DeviceBus::syncDeadlines(uint64_t cycle)
+{
+    currentCycle = cycle;
+    for (const Mapping& m : mappings) {
+        if (m.device->nextDeadline() <= cycle)
+            m.device->catchUp(cycle);
+    }
+    refreshDevices();
+}
+
+void DeviceBus::syncAll(uint64_t cycle)
+{
+    currentCycle = cycle;
+    for (const Mapping& m : mappings) {
+        m.device->catchUp(cycle);
+    }
+    refreshDevices();
+}
+
+void DeviceBus::refreshDevices()
+{
+    earliestDeadline = Device::NO_DEADLINE;
+    irqMask = 0;
+    for (size_t i = 0; i < mappings.size(); ++i) {
+        earliestDeadline = std::min(earliestDeadline, mappings[i].device->nextDeadline());
+        stallCycles += mappings[i].device->takeStallCycles();
+        if (mappings[i].device->irqAsserted())
+            irqMask |= 1u << i;
+    }
+    eventCycle = std::min(earliestDeadline, hookCycle);
+}
+
+void DeviceBus::refreshHooks()
+{
+    hookCycle = Device::NO_DEADLINE;
+    for (const RunHook* hook : hooks)
+        hookCycle = std::min(hookCycle, hook->nextHookCycle());
+    eventCycle = std::min(earliestDeadline, hookCycle);
+}
+
+void DeviceBus::addHook(RunHook* hook)
+{
+    if (hook != nullptr && std::find(hooks.begin(), hooks.end(), hook) == hooks.end())
+        hooks.push_back(hook);
+    refreshHooks();
+}
+
+void DeviceBus::removeHook(RunHook* hook)
+{
+    hooks.erase(std::remove(hooks.begin(), hooks.end(), hook), hooks.end());
+    refreshHooks();
+}
+
+void DeviceBus::runHooks(const CpuState& cpu, const RunCounts& counts)
+{
+    if (cpu.totalCycles < hookCycle)
+        return;
+    for (RunHook* hook : hooks) {
+        if (cpu.totalCycles >= hook->nextHookCycle())
+            hook->runHook(cpu, *this, counts);
+    }
+    refreshHooks();
+}
+
+void DeviceBus::endRunHooks(const CpuState& cpu, const RunCounts& counts)
+{
+    for (RunHook* hook : hooks)
+        hook->endRunHook(cpu, counts);
+}
+
+void DeviceBus::suspendHooks()
+{
+    if (hooksSuspended)
+        return;
+    hooksSuspended = true;
+    hooks.swap(suspendedHooks);
+    suspendedLog = inputLog;
+    inputLog = nullptr;
+    refreshHooks();
+}
+
+void DeviceBus::resumeHooks()
+{
+    if (!hooksSuspended)
+        return;
+    hooksSuspended = false;
+    hooks.swap(suspendedHooks);
+    suspendedHooks.clear();
+    inputLog = suspendedLog;
+    suspendedLog = nullptr;
+    refreshHooks();
+}
+
+void DeviceBus::setInputLog(InputLog* log)
+{
+    removeHook(inputLog);
+    inputLog = log;
+    addHook(log);
+}
+
+uint64_t DeviceBus::hashState(uint64_t registerHash)
+{
+    if (!hasher)
+        hasher = std::make_unique<StateHasher>();
+    return hasher->hash(ram, registerHash);
+}
+
+bool DeviceBus::canSaveDevices() const
+{
+    return std::all_of(mappings.begin(), mappings.end(), [](const Mapping& m) { return m.device->canSaveState(); });
+}
+
+size_t DeviceBus::deviceStateSize() const
+{
+    size_t size = 0;
+    for (const Mapping& m : mappings)
+        size += sizeof(uint64_t) + m.device->stateSize();
+    return size;
+}
+
+void DeviceBus::saveDevices(uint8_t* out) const
+{
+    for (const Mapping& m : mappings) {
+        const uint64_t synced = m.device->getSyncedCycle();
+        std::memcpy(out, &synced, sizeof(synced));
+        m.device->saveState(out + sizeof(synced));
+        out += sizeof(synced) + m.device->stateSize();
+    }
+}
+
+void DeviceBus::loadDevices(const uint8_t* in)
+{
+    for (const Mapping& m : mappings) {
+        uint64_t synced = 0;
+        std::memcpy(&synced, in, sizeof(synced));
+        m.device->setSyncedCycle(synced);
+        m.device->loadState(in + sizeof(synced));
+        in += sizeof(synced) + m.device->stateSize();
+    }
+    refreshDevices();
+    stallCycles = 0;
+}
+
+bool DeviceBus::sampleLoggedIrq(uint64_t cycle)
+{
+    if (inputLog->getMode() == InputLog::Mode::Replay) {
+        // Taking a replayed change moves the log's next hook cycle
+        const uint64_t next = inputLog->nextReplayIrqCycle();
+        const bool level = inputLog->replayIrq(cycle);
+        if (inputLog->nextReplayIrqCycle() != next)
+            refreshHooks();
+        return level;
+    }
+    const bool level = irqMask != 0;
+    if (level != loggedIrq) {
+        inputLog->recordIrq(cycle, level);
+        loggedIrq = level;
+    }
+    return level;
+}
+
+const uint8_t* DeviceBus::logLoggedBulkInput(uint16_t addr, const uint8_t* data, uint32_t& size)
+{
+    if (inputLog->getMode() == InputLog::Mode::Record) {
+        inputLog->recordBulk(currentCycle, addr, data, size);
+        return data;
+    }
+    // A replay without this input keeps the host's, the log is marked diverged
+    uint32_t recordedSize = 0;
+    const uint8_t* recorded = inputLog->replayBulk(currentCycle, addr, recordedSize);
+    if (recorded == nullptr)
+        return data;
+    size = recordedSize;
+    return recorded;
+}
@@ -0,0 +1,189 @@
+#pragma once
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <vector>
+#include "Bus.h"
+#include "Flags.h"
+#include "Device.h"
+#include "Ram.h"
+#include "RunHook.h"
+
+class InputLog;
+class StateHasher;
+
+// Bus with RAM and memory-mapped devices that are synchronized lazily. A device is brought up to the current
+// CPU cycle right before any access to its registers, and when its deadline passes (see RunSynced).
+class DeviceBus : public Bus {
+public:
+    static constexpr size_t MAX_DEVICES = 32;
+
+    DeviceBus();
+    ~DeviceBus();
+
+    uint8_t read(uint16_t addr) override;
+    void write(uint16_t addr, uint8_t data) override;
+    bool isPlainMemory(uint16_t addr) const override;
+
+    // Maps device registers at [base, base + size) - a 256 byte page can hold RAM and at most one device
+    bool attach(Device* device, uint16_t base, uint32_t size);
+
+    // True if no device is mapped anywhere in the 256 byte page - bulk transfers may go straight to RAM
+    bool isPlainPage(uint8_t page) const { return pageMapping[page] == 0; }
+
+    // Earliest deadline over all devices
+    uint64_t nextDeadline() const { return earliestDeadline; }
+
+    // Catches up the devices whose deadline is at or before cycle
+    void syncDeadlines(uint64_t cycle);
+
+    // Catches up every device, e.g. at the end of a run slice
+    void syncAll(uint64_t cycle);
+
+    // Combined IRQ line of all devices
+    bool irqAsserted() const { return irqMask != 0; }
+
+    // Cycles the devices took from the CPU since the last call
+    uint64_t takeStallCycles() { const uint64_t stall = stallCycles; stallCycles = 0; return stall; }
+
+    // IRQ line as the CPU sees it at an instruction boundary - logged when recording, taken from the log on replay
+    bool sampleIrq(uint64_t cycle) { return inputLog == nullptr ? irqMask != 0 : sampleLoggedIrq(cycle); }
+
+    // Record/replay - while a log is attached, device reads and IRQ level changes go through it. The log is
+    // also a hook, for its checkpoints and replayed IRQ changes.
+    void setInputLog(InputLog* log);
+    InputLog* getInputLog() const { return inputLog; }
+
+    // Host input a device copies into RAM in bulk at addr (disk sectors, host files) - logged as one event when
+    // recording, replaced by the recorded bytes and count on replay. Returns the bytes to copy.
+    const uint8_t* logBulkInput(uint16_t addr, const uint8_t* data, uint32_t& size) {
+        return inputLog == nullptr ? data : logLoggedBulkInput(addr, data, size);
+    }
+
+    // Periodic work of the run loop (RunHook.h), run in the order added
+    void addHook(RunHook* hook);
+    void removeHook(RunHook* hook);
+
+    // Runs the hooks due at the CPU's cycle, and ends the run call for all of them (RunSynced)
+    void runHooks(const CpuState& cpu, const RunCounts& counts);
+    void endRunHooks(const CpuState& cpu, const RunCounts& counts);
+
+    // Sets the hooks and the input log aside for runs a snapshot restore will undo (RunAheadFrame), so monitors,
+    // stats and recordings only see the real run. Hooks and the log must not be changed until resumeHooks.
+    void suspendHooks();
+    void resumeHooks();
+
+    // Earliest cycle the run loop must stop at - the next device deadline or hook
+    uint64_t nextEvent() const { return eventCycle; }
+
+    // Hash of RAM (only pages written since the last call are rehashed) combined with registerHash
+    uint64_t hashState(uint64_t registerHash);
+
+    // Writes that bypass write() (bulk loads through getRam(), DMA) must be reported here
+    void markDirty(uint16_t begin, uint32_t size);
+
+    // Snapshots (MachineSnapshot) - every device's synced cycle and state in attach order. Loading also drops
+    // stalls not yet taken and re-reads deadlines and IRQ levels.
+    bool canSaveDevices() const;
+    size_t deviceStateSize() const;
+    void saveDevices(uint8_t* out) const;
+    void loadDevices(const uint8_t* in);
+
+    // RAM pages written since snapshot last saved or restored this bus, a snapshot that still owns the bus only
+    // has to copy these
+    bool isSnapshotOwner(const void* snapshot) const { return snapshotOwner == snapshot; }
+    const std::array<uint64_t, 4>& getWrittenPages() const { return writtenPages; }
+    void setSnapshotOwner(const void* snapshot) { snapshotOwner = snapshot; writtenPages.fill(0); }
+
+    const RAM& getRam() const { return ram; }
+    RAM& getRam() { return ram; }
+
+private:
+    struct Mapping {
+        Device* device;
+        uint16_t base;
+        uint32_t size;
+    };
+
+    const Mapping* mappingAt(uint16_t addr) const {
+        const uint8_t index = pageMapping[addr >> 8];
+        if (index == 0)
+            return nullptr;
+        const Mapping& m = mappings[index - 1];
+        return (addr >= m.base && addr < m.base + m.size) ? &m : nullptr;
+    }
+
+    // Re-reads IRQ levels and deadlines after a device changed state
+    void refreshDevices();
+
+    // Re-reads the hooks' next cycles
+    void refreshHooks();
+
+    bool sampleLoggedIrq(uint64_t cycle);
+    const uint8_t* logLoggedBulkInput(uint16_t addr, const uint8_t* data, uint32_t& size);
+
+    RAM ram;
+    std::vector<Mapping> mappings;
+    std::array<uint8_t, 256> pageMapping{}; // mapping index + 1 per page, 0 = RAM only
+    uint64_t earliestDeadline = Device::NO_DEADLINE;
+    uint64_t hookCycle = Device::NO_DEADLINE;  // Earliest next cycle of the hooks
+    uint64_t eventCycle = Device::NO_DEADLINE; // Earlier of the two
+    uint32_t irqMask = 0;
+    uint64_t stallCycles = 0;
+    InputLog* inputLog = nullptr;
+    std::vector<RunHook*> hooks;
+    std::vector<RunHook*> suspendedHooks;
+    InputLog* suspendedLog = nullptr;
+    bool hooksSuspended = false;
+    bool loggedIrq = false;
+    std::unique_ptr<StateHasher> hasher; // Created by the first hashState, until then every page counts as dirty
+    const void* snapshotOwner = nullptr;
+    std::array<uint64_t, 4> writtenPages{}; // Bit per 256 byte page
+};
+
+// Runs cpu until its cycle counter reaches untilCycle. Device deadlines, hooks (RunHook.h), the IRQ line and CPU
+// stalls are serviced at instruction boundaries, and idle loops are fast-forwarded up to the next event.
+template <typename Cpu>
+void RunSynced(Cpu& cpu, DeviceBus& bus, uint64_t untilCycle)
+{
+    // Counts of this call, kept in registers between hook calls. An interrupt sequence goes through the loop like
+    // an instruction, the instructions are retired - interrupts.
+    uint64_t retired = 0;
+    uint64_t interrupts = 0;
+    uint64_t idleCycles = 0;
+
+    while (cpu.totalCycles < untilCycle) {
+        bus.setCycle(cpu.totalCycles);
+
+        // One compare while no deadline and no hook is due
+        if (cpu.totalCycles >= bus.nextEvent()) {
+            if (cpu.totalCycles >= bus.nextDeadline())
+                bus.syncDeadlines(cpu.totalCycles);
+            bus.runHooks(cpu, { retired - interrupts, interrupts, idleCycles });
+        }
+
+        if (bus.sampleIrq(cpu.totalCycles) && (cpu.status & static_cast<uint8_t>(Flags::I)) == 0) {
+            cpu.interrupt();
+            ++interrupts;
+        }
+
+        const uint64_t limit = std::min(untilCycle, bus.nextEvent());
+        if (cpu.instructionComplete()) {
+            if (const uint64_t skipped = cpu.skipIdleLoop(limit - cpu.totalCycles); skipped != 0) {
+                idleCycles += skipped;
+                continue;
+            }
+        }
+
+        cpu.setFusionLimit(limit);
+
+        do {
+            cpu.clock();
+        } while (!cpu.instructionComplete());
+        ++retired;
+
+        // A device stalled the CPU during the instruction - the cycles pass with the CPU halted
+        cpu.totalCycles += bus.takeStallCycles();
+    }
+    bus.endRunHooks(cpu, { retired - interrupts, interrupts, idleCycles });
+}
@@ -0,0 +1,252 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <sstream>
+#include <thread>
+
+#include "Cpu6502.h"
+#include "DiffFuzz.h"
+#include "Opcodes.h"
+
+// splitmix64 - fast, and good enough to decorrelate neighbouring seeds
+static uint64_t NextRandom(uint64_t& state)
+{
+    uint64_t z = (state += 0x9E3779B97F4A7C15ull);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
+
+// A core with superinstruction fusion, a fused pair is one step. No interrupts, so no fusion limit.
+template <typename Cpu>
+struct Fused : Cpu {};
+
+template <typename Cpu>
+struct FuzzCoreTraits<Fused<Cpu>> : FuzzCoreTraits<Cpu> {
+    static void load(Fused<Cpu>& cpu, Bus* bus, const FuzzCpuState& s) {
+        FuzzCoreTraits<Cpu>::load(cpu, bus, s);
+        cpu.setFusion(true);
+    }
+};
+
+// A core with idle loop fast-forward - a step at a wait loop skips its iterations up to IDLE_BUDGET cycles
+template <typename Cpu>
+struct IdleSkip : Cpu {};
+
+template <typename Cpu>
+struct FuzzCoreTraits<IdleSkip<Cpu>> : FuzzCoreTraits<Cpu> {
+    static constexpr uint64_t IDLE_BUDGET = 200;
+
+    static FuzzStep step(IdleSkip<Cpu>& cpu) {
+        // Loop detection peeks at memory, which TraceBus does not record
+        if (const uint64_t skipped = cpu.skipIdleLoop(IDLE_BUDGET); skipped != 0)
+            return { skipped, true };
+        return FuzzCoreTraits<Cpu>::step(cpu);
+    }
+};
+
+// Variant of a core, so cases use its opcode table
+template <typename Cpu>
+struct FuzzVariant;
+
+template <typename Variant>
+struct FuzzVariant<Cpu6502Core<Variant>> {
+    using type = Variant;
+};
+
+// Writes one of the wait loops skipIdleLoop recognizes at the case's PC and returns the address after it.
+// Operands, polled memory, counters and flags stay random, so loops are skipped, exited or left alone.
+static uint16_t PlantIdleLoop(FuzzCase& c, uint64_t& state, uint64_t shape)
+{
+    const uint16_t pc = c.start.PC;
+    auto put = [&](unsigned offset, uint8_t value) { c.memory[static_cast<uint16_t>(pc + offset)] = value; };
+    const uint64_t r = NextRandom(state);
+    switch (shape % 3) {
+    case 0: // JMP *
+        put(0, 0x4C);
+        put(1, static_cast<uint8_t>(pc));
+        put(2, static_cast<uint8_t>(pc >> 8));
+        return static_cast<uint16_t>(pc + 3);
+    case 1: { // LDA|LDX|LDY|BIT m / Bxx back, any of the eight branches
+        static constexpr uint8_t loads[] = { 0xA5, 0xAD, 0xA6, 0xAE, 0xA4, 0xAC, 0x24, 0x2C };
+        const uint8_t load = loads[r % 8];
+        const unsigned length = (load & 0x08) != 0 ? 3 : 2;
+        put(0, load);
+        put(length, static_cast<uint8_t>(0x10 | ((r >> 8) & 0xE0)));
+        put(length + 1, static_cast<uint8_t>(-static_cast<int>(length + 2)));
+        return static_cast<uint16_t>(pc + length + 2);
+    }
+    default: { // DEX|DEY|INX|INY / BNE back
+        static constexpr uint8_t counters[] = { 0xCA, 0x88, 0xE8, 0xC8 };
+        put(0, counters[r % 4]);
+        put(1, 0xD0);
+        put(2, 0xFD);
+        return static_cast<uint16_t>(pc + 3);
+    }
+    }
+}
+
+template <typename Variant>
+FuzzCase GenerateFuzzCase(uint64_t seed, uint32_t instructions)
+{
+    // Opcodes the variant defines - the 65C02 additions included - illegal slots would mostly test XXX
+    using Cpu = Cpu6502Core<Variant>;
+    const auto& table = opcodeTable(Variant{});
+    static const std::vector<uint8_t> defined = [] {
+        std::vector<uint8_t> ops;
+        for (size_t op = 0; op < 256; ++op) {
+            if (opcodeTable(Variant{})[op].operate != &Cpu::XXX)
+                ops.push_back(static_cast<uint8_t>(op));
+        }
+        return ops;
+    }();
+
+    FuzzCase c;
+    c.seed = seed;
+    c.instructions = instructions;
+
+    uint64_t state = seed;
+    for (size_t i = 0; i < c.memory.size(); i += 8) {
+        const uint64_t r = NextRandom(state);
+        for (size_t b = 0; b < 8; ++b)
+            c.memory[i + b] = static_cast<uint8_t>(r >> (b * 8));
+    }
+
+    const uint64_t regs = NextRandom(state);
+    c.start.A = static_cast<uint8_t>(regs);
+    c.start.X = static_cast<uint8_t>(regs >> 8);
+    c.start.Y = static_cast<uint8_t>(regs >> 16);
+    c.start.SP = static_cast<uint8_t>(regs >> 24);
+    c.start.status = static_cast<uint8_t>(regs >> 32) | static_cast<uint8_t>(Flags::U);
+    c.start.PC = static_cast<uint16_t>(regs >> 40);
+
+    // Random streams almost never form a wait loop, so every IDLE_LOOP_EVERY-th case starts with one
+    uint16_t addr = c.start.PC;
+    if (seed % IDLE_LOOP_EVERY == 0)
+        addr = PlantIdleLoop(c, state, seed / IDLE_LOOP_EVERY);
+
+    // Lay a straight-line instruction stream after it, branches and jumps leave it into random memory
+    for (uint32_t i = 0; i < instructions; ++i) {
+        const uint8_t op = defined[NextRandom(state) % defined.size()];
+        c.memory[addr] = op;
+        addr = static_cast<uint16_t>(addr + InstructionLength(AddressingModeOf(table[op])));
+    }
+    return c;
+}
+
+template FuzzCase GenerateFuzzCase<Nmos6502>(uint64_t seed, uint32_t instructions);
+template FuzzCase GenerateFuzzCase<Ricoh2A03>(uint64_t seed, uint32_t instructions);
+template FuzzCase GenerateFuzzCase<Cmos65C02>(uint64_t seed, uint32_t instructions);
+
+std::string DescribeAccess(const BusAccess& a)
+{
+    std::ostringstream s;
+    s << std::hex << std::uppercase << std::setfill('0')
+      << (a.isWrite ? "W " : "R ") << std::setw(4) << a.addr << "=" << std::setw(2) << static_cast<unsigned>(a.data);
+    return s.str();
+}
+
+std::string DescribeState(const FuzzCpuState& st)
+{
+    std::ostringstream s;
+    s << std::hex << std::uppercase << std::setfill('0')
+      << "A:" << std::setw(2) << static_cast<unsigned>(st.A)
+      << " X:" << std::setw(2) << static_cast<unsigned>(st.X)
+      << " Y:" << std::setw(2) << static_cast<unsigned>(st.Y)
+      << " P:" << std::setw(2) << static_cast<unsigned>(st.status)
+      << " SP:" << std::setw(2) << static_cast<unsigned>(st.SP)
+      << " PC:" << std::setw(4) << st.PC;
+    return s.str();
+}
+
+void PrintFuzzCase(const FuzzCase& c, const FuzzResult& result)
+{
+    std::cout << "seed " << c.seed << ", " << c.instructions << " instruction(s), diverged at instruction "
+              << result.instruction << ": " << result.reason << "\n";
+    std::cout << "start " << DescribeState(c.start) << "\n";
+    std::cout << std::hex << std::uppercase << std::setfill('0');
+    for (size_t addr = 0; addr < c.memory.size(); ++addr) {
+        if (c.memory[addr] != 0)
+            std::cout << std::setw(4) << addr << ": " << std::setw(2) << static_cast<unsigned>(c.memory[addr]) << "\n";
+    }
+    std::cout << std::dec << std::setfill(' ');
+}
+
+template <typename ReferenceCpu, typename CandidateCpu>
+static bool FuzzCores(uint64_t seed, uint64_t cases, unsigned threads)
+{
+    constexpr uint32_t instructionsPerCase = 256;
+
+    if (threads == 0)
+        threads = std::max(1u, std::thread::hardware_concurrency());
+
+    std::atomic<uint64_t> nextCase{ 0 };
+    std::atomic<bool> stop{ false };
+    std::mutex failureMutex;
+    bool failed = false;
+    FuzzCase failure;
+
+    const auto begin = std::chrono::steady_clock::now();
+
+    std::vector<std::thread> workers;
+    for (unsigned t = 0; t < threads; ++t) {
+        workers.emplace_back([&] {
+            while (!stop.load(std::memory_order_relaxed)) {
+                const uint64_t index = nextCase.fetch_add(1, std::memory_order_relaxed);
+                if (index >= cases)
+                    break;
+
+                const FuzzCase c = GenerateFuzzCase<typename FuzzVariant<ReferenceCpu>::type>(seed + index, instructionsPerCase);
+                if (RunFuzzCase<ReferenceCpu, CandidateCpu>(c).diverged) {
+                    std::lock_guard<std::mutex> lock(failureMutex);
+                    if (!failed || c.seed < failure.seed) {
+                        failed = true;
+                        failure = c;
+                    }
+                    stop.store(true, std::memory_order_relaxed);
+                }
+            }
+        });
+    }
+    for (std::thread& w : workers)
+        w.join();
+
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+    const uint64_t ran = std::min<uint64_t>(nextCase.load(), cases);
+    std::cout << ran << " case(s), " << ran * instructionsPerCase << " instruction(s) on " << threads
+              << " thread(s) in " << seconds << " s (" << (ran * instructionsPerCase / std::max(seconds, 1e-9)) / 1e6
+              << " M instructions/s)\n";
+
+    if (failed) {
+        const FuzzCase minimized = MinimizeFuzzCase<ReferenceCpu, CandidateCpu>(failure);
+        PrintFuzzCase(minimized, RunFuzzCase<ReferenceCpu, CandidateCpu>(minimized));
+        return false;
+    }
+    return true;
+}
+
+bool RunDiffFuzz(uint64_t seed, uint64_t cases, unsigned threads, FuzzCandidate candidate)
+{
+    // Each variant against itself without the fast path
+    bool ok = true;
+    if (candidate == FuzzCandidate::Fusion || candidate == FuzzCandidate::All) {
+        std::cout << "fusion, 6502: ";
+        ok = FuzzCores<Cpu6502, Fused<Cpu6502>>(seed, cases, threads) && ok;
+        std::cout << "fusion, 2A03: ";
+        ok = FuzzCores<Cpu2A03, Fused<Cpu2A03>>(seed, cases, threads) && ok;
+        std::cout << "fusion, 65C02: ";
+        ok = FuzzCores<Cpu65C02, Fused<Cpu65C02>>(seed, cases, threads) && ok;
+    }
+    if (candidate == FuzzCandidate::IdleSkip || candidate == FuzzCandidate::All) {
+        std::cout << "idle skip, 6502: ";
+        ok = FuzzCores<Cpu6502, IdleSkip<Cpu6502>>(seed, cases, threads) && ok;
+        std::cout << "idle skip, 2A03: ";
+        ok = FuzzCores<Cpu2A03, IdleSkip<Cpu2A03>>(seed, cases, threads) && ok;
+        std::cout << "idle skip, 65C02: ";
+        ok = FuzzCores<Cpu65C02, IdleSkip<Cpu65C02>>(seed, cases, threads) && ok;
+    }
+    return ok;
+}
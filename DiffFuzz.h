@@ -0,0 +1,255 @@
+#pragma once
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "Bus.h"
+
+// Differential fuzzing - runs random programs on a reference core and a candidate core in lockstep
+// and compares registers, cycle count and the full bus access trace after every instruction. A candidate step may
+// cover several instructions (fused pairs, skipped idle loops), the reference then catches up to its cycle.
+
+struct BusAccess {
+    uint16_t addr;
+    uint8_t data;
+    bool isWrite;
+
+    bool operator==(const BusAccess& other) const {
+        return addr == other.addr && data == other.data && isWrite == other.isWrite;
+    }
+};
+
+// Flat 64 KB memory that records every access made through it
+class TraceBus : public Bus {
+public:
+    static constexpr size_t SIZE = 64 * 1024;
+
+    uint8_t read(uint16_t addr) override {
+        trace.push_back({ addr, memory[addr], false });
+        return memory[addr];
+    }
+
+    void write(uint16_t addr, uint8_t data) override {
+        trace.push_back({ addr, data, true });
+        memory[addr] = data;
+    }
+
+    // Reads have no side effects, so fast paths that need plain memory (idle loops, fusion) run here
+    bool isPlainMemory(uint16_t) const override { return true; }
+    uint8_t peek(uint16_t addr) override { return memory[addr]; }
+
+    std::array<uint8_t, SIZE> memory{};
+    std::vector<BusAccess> trace;
+};
+
+// Registers a core exposes for comparison
+struct FuzzCpuState {
+    uint8_t A, X, Y, SP, status;
+    uint16_t PC;
+
+    bool operator==(const FuzzCpuState& other) const {
+        return A == other.A && X == other.X && Y == other.Y && SP == other.SP && status == other.status && PC == other.PC;
+    }
+};
+
+// A reproducible fuzz case - initial registers and memory, and how many instructions to run
+struct FuzzCase {
+    uint64_t seed = 0;
+    FuzzCpuState start{};
+    std::array<uint8_t, TraceBus::SIZE> memory{};
+    uint32_t instructions = 0;
+};
+
+// Lockstep result of a single case
+struct FuzzResult {
+    bool diverged = false;
+    uint32_t instruction = 0; // index of the first diverging instruction
+    std::string reason;
+};
+
+// One step of a core
+struct FuzzStep {
+    uint64_t cycles = 0;
+    bool elided = false; // Bus accesses of the step were skipped - only allowed for reads of plain memory
+};
+
+// How the harness drives a core - the default runs clock() until the instruction completes.
+// Cores that step whole instructions, or several at once, can specialize this.
+template <typename Cpu>
+struct FuzzCoreTraits {
+    static void load(Cpu& cpu, Bus* bus, const FuzzCpuState& s) {
+        cpu.connectBus(bus);
+        cpu.A = s.A; cpu.X = s.X; cpu.Y = s.Y; cpu.SP = s.SP; cpu.status = s.status; cpu.PC = s.PC;
+    }
+
+    static FuzzCpuState save(const Cpu& cpu) {
+        return { cpu.A, cpu.X, cpu.Y, cpu.SP, cpu.status, cpu.PC };
+    }
+
+    static FuzzStep step(Cpu& cpu) {
+        FuzzStep s;
+        do {
+            cpu.clock();
+            ++s.cycles;
+        } while (!cpu.instructionComplete());
+        return s;
+    }
+};
+
+std::string DescribeAccess(const BusAccess& a);
+std::string DescribeState(const FuzzCpuState& s);
+
+// Runs one case on both cores in lockstep, stopping at the first difference
+template <typename ReferenceCpu, typename CandidateCpu>
+FuzzResult RunFuzzCase(const FuzzCase& fuzzCase)
+{
+    using RefTraits = FuzzCoreTraits<ReferenceCpu>;
+    using CandTraits = FuzzCoreTraits<CandidateCpu>;
+
+    // Both buses are large, keep them off the stack
+    std::vector<TraceBus> buses(2);
+    TraceBus& refBus = buses[0];
+    TraceBus& candBus = buses[1];
+    refBus.memory = fuzzCase.memory;
+    candBus.memory = fuzzCase.memory;
+
+    ReferenceCpu ref;
+    CandidateCpu cand;
+    RefTraits::load(ref, &refBus, fuzzCase.start);
+    CandTraits::load(cand, &candBus, fuzzCase.start);
+
+    // Traces are compared as they grow - a candidate may already have fetched the next opcode
+    FuzzResult result;
+    uint64_t refCycles = 0;
+    uint64_t candCycles = 0;
+    size_t refCompared = 0;
+    size_t candCompared = 0;
+    for (uint32_t i = 0; i < fuzzCase.instructions;) {
+        const FuzzStep candStep = CandTraits::step(cand);
+        candCycles += candStep.cycles;
+        result.instruction = i;
+        while (refCycles < candCycles) {
+            refCycles += RefTraits::step(ref).cycles;
+            ++i;
+        }
+
+        const FuzzCpuState refState = RefTraits::save(ref);
+        const FuzzCpuState candState = CandTraits::save(cand);
+
+        if (refCycles != candCycles) {
+            result.diverged = true;
+            result.reason = "cycles: ref " + std::to_string(refCycles) + " / cand " + std::to_string(candCycles);
+            return result;
+        }
+        if (!(refState == candState)) {
+            result.diverged = true;
+            result.reason = "registers: ref " + DescribeState(refState) + " / cand " + DescribeState(candState);
+            return result;
+        }
+        if (candStep.elided) {
+            auto isWrite = [](const BusAccess& a) { return a.isWrite; };
+            if (std::any_of(refBus.trace.begin() + refCompared, refBus.trace.end(), isWrite) ||
+                std::any_of(candBus.trace.begin() + candCompared, candBus.trace.end(), isWrite)) {
+                result.diverged = true;
+                result.reason = "skipped instructions wrote memory";
+                return result;
+            }
+            refCompared = refBus.trace.size();
+            candCompared = candBus.trace.size();
+            continue;
+        }
+        while (refCompared < refBus.trace.size() && candCompared < candBus.trace.size()) {
+            if (!(refBus.trace[refCompared] == candBus.trace[candCompared])) {
+                result.diverged = true;
+                result.reason = "bus access " + std::to_string(refCompared) + ": ref " + DescribeAccess(refBus.trace[refCompared]) +
+                    " / cand " + DescribeAccess(candBus.trace[candCompared]);
+                return result;
+            }
+            ++refCompared;
+            ++candCompared;
+        }
+        if (refCompared < refBus.trace.size()) {
+            result.diverged = true;
+            result.reason = "bus access " + std::to_string(refCompared) + ": ref " + DescribeAccess(refBus.trace[refCompared]) +
+                " / cand none";
+            return result;
+        }
+    }
+    if (refBus.memory != candBus.memory) {
+        result.diverged = true;
+        result.reason = "memory";
+    }
+    return result;
+}
+
+// Greedy minimizer - cuts the case down to the diverging instruction, clears every byte of memory
+// the reference never read, then tries to zero the remaining bytes and registers one at a time
+template <typename ReferenceCpu, typename CandidateCpu>
+FuzzCase MinimizeFuzzCase(const FuzzCase& failing)
+{
+    auto stillFails = [](const FuzzCase& c) { return RunFuzzCase<ReferenceCpu, CandidateCpu>(c).diverged; };
+
+    FuzzCase best = failing;
+    best.instructions = RunFuzzCase<ReferenceCpu, CandidateCpu>(failing).instruction + 1;
+
+    // Record which addresses the reference core reads while reproducing
+    std::vector<TraceBus> buses(1);
+    TraceBus& bus = buses[0];
+    bus.memory = best.memory;
+    ReferenceCpu ref;
+    FuzzCoreTraits<ReferenceCpu>::load(ref, &bus, best.start);
+    for (uint32_t i = 0; i < best.instructions; ++i)
+        FuzzCoreTraits<ReferenceCpu>::step(ref);
+
+    std::vector<bool> touched(TraceBus::SIZE, false);
+    for (const BusAccess& a : bus.trace)
+        touched[a.addr] = true;
+
+    FuzzCase trimmed = best;
+    for (size_t addr = 0; addr < TraceBus::SIZE; ++addr) {
+        if (!touched[addr])
+            trimmed.memory[addr] = 0;
+    }
+    if (stillFails(trimmed))
+        best = trimmed;
+
+    for (size_t addr = 0; addr < TraceBus::SIZE; ++addr) {
+        if (best.memory[addr] == 0)
+            continue;
+        FuzzCase attempt = best;
+        attempt.memory[addr] = 0;
+        if (stillFails(attempt))
+            best = attempt;
+    }
+
+    uint8_t FuzzCpuState::* registers[] = { &FuzzCpuState::A, &FuzzCpuState::X, &FuzzCpuState::Y, &FuzzCpuState::status };
+    for (auto reg : registers) {
+        FuzzCase attempt = best;
+        attempt.start.*reg = 0;
+        if (stillFails(attempt))
+            best = attempt;
+    }
+    return best;
+}
+
+// Builds the random case for a seed - random registers and memory, with a stream of opcodes the variant
+// defines at PC so most of the run executes real instructions. Every IDLE_LOOP_EVERY-th seed starts the stream
+// with one of the wait loops idle skipping recognizes.
+constexpr uint64_t IDLE_LOOP_EVERY = 4;
+
+template <typename Variant>
+FuzzCase GenerateFuzzCase(uint64_t seed, uint32_t instructions);
+
+// Writes a minimized case as a readable report (registers and non-zero memory)
+void PrintFuzzCase(const FuzzCase& c, const FuzzResult& result);
+
+// Fast paths of Cpu6502 checked against plain interpretation. New cores get wired in here.
+enum class FuzzCandidate {
+    Fusion,   // Superinstruction fusion (Cpu6502Core::setFusion)
+    IdleSkip, // Idle loop fast-forward (Cpu6502Core::skipIdleLoop)
+    All,
+};
+
+// Runs the candidate(s) on every CPU variant against the same variant without them, across all hardware threads
+bool RunDiffFuzz(uint64_t seed, uint64_t cases, unsigned threads = 0, FuzzCandidate candidate = FuzzCandidate::All);
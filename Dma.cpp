@@ -0,0 +1,185 @@
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+
+#include "Cpu6502.h"
+#include "DeviceBus.h"
+#include "Dma.h"
+
+bool DmaCopy(DeviceBus& bus, uint16_t src, uint16_t dst, uint32_t size)
+{
+    if (size > 0x10000u - src || size > 0x10000u - dst)
+        return false;
+
+    uint8_t* ram = bus.getRam().data();
+    // Destination inside the source ahead of the read position - later reads see earlier writes
+    const bool repeats = dst > src && dst < src + size;
+
+    for (uint32_t done = 0; done < size;) {
+        const uint32_t from = src + done;
+        const uint32_t to = dst + done;
+        const uint32_t chunk = std::min({ size - done, 0x100 - (from & 0xFF), 0x100 - (to & 0xFF) });
+
+        if (bus.isPlainPage(static_cast<uint8_t>(from >> 8)) && bus.isPlainPage(static_cast<uint8_t>(to >> 8))) {
+            if (repeats) {
+                for (uint32_t i = 0; i < chunk; ++i)
+                    ram[to + i] = ram[from + i];
+            } else {
+                std::memmove(ram + to, ram + from, chunk);
+            }
+            bus.markDirty(static_cast<uint16_t>(to), chunk);
+        } else {
+            for (uint32_t i = 0; i < chunk; ++i)
+                bus.write(static_cast<uint16_t>(to + i), bus.read(static_cast<uint16_t>(from + i)));
+        }
+        done += chunk;
+    }
+    return true;
+}
+
+void OamDmaDevice::writeRegister(uint16_t, uint8_t data)
+{
+    const uint16_t src = static_cast<uint16_t>(data << 8);
+    if (oamPort != 0) {
+        for (uint16_t i = 0; i < 256; ++i)
+            bus.write(oamPort, bus.read(static_cast<uint16_t>(src + i)));
+    } else if (bus.isPlainPage(data)) {
+        std::memcpy(oam.data(), bus.getRam().data() + src, oam.size());
+    } else {
+        for (uint16_t i = 0; i < 256; ++i)
+            oam[i] = bus.read(static_cast<uint16_t>(src + i));
+    }
+
+    // One more cycle to align with the read/write pattern when the CPU halts on an odd cycle
+    const uint64_t haltCycle = syncedCycle + 4;
+    stallCycles += CYCLES + (haltCycle & 1);
+}
+
+uint8_t MemoryDmaDevice::readRegister(uint16_t offset)
+{
+    return offset < registers.size() ? registers[offset] : status;
+}
+
+void MemoryDmaDevice::writeRegister(uint16_t offset, uint8_t data)
+{
+    if (offset < registers.size()) {
+        registers[offset] = data;
+        return;
+    }
+    if ((data & CONTROL_START) == 0)
+        return;
+
+    const uint16_t src = static_cast<uint16_t>(registers[0] | (registers[1] << 8));
+    const uint16_t dst = static_cast<uint16_t>(registers[2] | (registers[3] << 8));
+    uint32_t size = static_cast<uint32_t>(registers[4] | (registers[5] << 8));
+    if (size == 0)
+        size = 0x10000;
+
+    uint64_t cycles = SETUP_CYCLES;
+    if (DmaCopy(bus, src, dst, size)) {
+        status = 0;
+        cycles += CYCLES_PER_BYTE * size;
+    } else {
+        status = STATUS_ERROR;
+    }
+    ++transfers;
+    stallCycles += cycles;
+    stolenCycles += cycles;
+}
+
+// Runs the guest at $0200 until it reaches its final JMP *, returns the cycles it took
+static uint64_t RunToDone(Cpu6502& cpu, DeviceBus& bus, uint16_t done)
+{
+    cpu.PC = 0x0200;
+    cpu.SP = 0xFD;
+    cpu.status = 0x24;
+    const uint64_t start = cpu.totalCycles;
+    while (cpu.PC != done && cpu.totalCycles - start < 10000000)
+        RunSynced(cpu, bus, cpu.totalCycles + 1);
+    return cpu.totalCycles - start;
+}
+
+int RunDmaDemo()
+{
+    constexpr uint16_t SOURCE = 0x0400;
+    constexpr uint16_t TARGET = 0x2000;
+    constexpr uint32_t SIZE = 4096;
+    bool ok = true;
+
+    auto fill = [&](DeviceBus& bus) {
+        uint8_t* ram = bus.getRam().data();
+        for (uint32_t i = 0; i < SIZE; ++i)
+            ram[SOURCE + i] = static_cast<uint8_t>(i * 13 + (i >> 8));
+        bus.markDirty(SOURCE, SIZE);
+    };
+    auto copied = [&](DeviceBus& bus) {
+        return std::memcmp(bus.getRam().data() + SOURCE, bus.getRam().data() + TARGET, SIZE) == 0;
+    };
+
+    // LDX #$10 / LDY #$00 / loop: LDA ($F0),Y / STA ($F2),Y / INY / BNE loop / INC $F1 / INC $F3 / DEX / BNE loop / JMP *
+    {
+        DeviceBus bus;
+        const uint8_t program[] = { 0xA2, 0x10, 0xA0, 0x00, 0xB1, 0xF0, 0x91, 0xF2, 0xC8, 0xD0, 0xF9, 0xE6, 0xF1, 0xE6, 0xF3,
+                                    0xCA, 0xD0, 0xF2, 0x4C, 0x12, 0x02 };
+        for (size_t i = 0; i < sizeof(program); ++i)
+            bus.write(static_cast<uint16_t>(0x0200 + i), program[i]);
+        const uint8_t pointers[] = { SOURCE & 0xFF, SOURCE >> 8, TARGET & 0xFF, TARGET >> 8 };
+        for (size_t i = 0; i < sizeof(pointers); ++i)
+            bus.write(static_cast<uint16_t>(0xF0 + i), pointers[i]);
+        fill(bus);
+
+        Cpu6502 cpu(&bus);
+        const uint64_t cycles = RunToDone(cpu, bus, 0x0212);
+        ok = ok && copied(bus);
+        std::cout << "LDA/STA loop: 4 KB in " << cycles << " cycle(s)" << (copied(bus) ? "" : " - MISMATCH") << "\n";
+    }
+
+    // Six register writes and START through LDA #imm / STA $41xx, then JMP *
+    {
+        DeviceBus bus;
+        MemoryDmaDevice dma(bus);
+        bus.attach(&dma, 0x4100, 7);
+        const uint8_t values[] = { SOURCE & 0xFF, SOURCE >> 8, TARGET & 0xFF, TARGET >> 8, SIZE & 0xFF, SIZE >> 8,
+                                   MemoryDmaDevice::CONTROL_START };
+        uint16_t pc = 0x0200;
+        for (size_t i = 0; i < sizeof(values); ++i) {
+            const uint8_t store[] = { 0xA9, values[i], 0x8D, static_cast<uint8_t>(i), 0x41 };
+            for (uint8_t b : store)
+                bus.getRam().data()[pc++] = b;
+        }
+        const uint16_t done = pc;
+        const uint8_t jump[] = { 0x4C, static_cast<uint8_t>(done), static_cast<uint8_t>(done >> 8) };
+        for (uint8_t b : jump)
+            bus.getRam().data()[pc++] = b;
+        bus.markDirty(0x0200, pc - 0x0200);
+        fill(bus);
+
+        Cpu6502 cpu(&bus);
+        const uint64_t cycles = RunToDone(cpu, bus, done);
+        ok = ok && copied(bus) && dma.getTransfers() == 1;
+        std::cout << "memory DMA:   4 KB in " << cycles << " cycle(s), " << dma.getStolenCycles() << " stolen"
+                  << (copied(bus) ? "" : " - MISMATCH") << "\n";
+    }
+
+    // LDA #$03 / STA $4014 / JMP *, started on an even and on an odd cycle
+    for (uint64_t startCycle = 0; startCycle < 2; ++startCycle) {
+        DeviceBus bus;
+        OamDmaDevice oam(bus);
+        bus.attach(&oam, OamDmaDevice::DEFAULT_BASE, 1);
+        const uint8_t program[] = { 0xA9, 0x03, 0x8D, 0x14, 0x40, 0x4C, 0x05, 0x02 };
+        for (size_t i = 0; i < sizeof(program); ++i)
+            bus.write(static_cast<uint16_t>(0x0200 + i), program[i]);
+        for (uint16_t i = 0; i < 256; ++i)
+            bus.write(static_cast<uint16_t>(0x0300 + i), static_cast<uint8_t>(255 - i));
+
+        Cpu6502 cpu(&bus);
+        cpu.totalCycles = startCycle;
+        const uint64_t stolen = RunToDone(cpu, bus, 0x0205) - 6;
+        const bool match = std::memcmp(oam.getOam().data(), bus.getRam().data() + 0x0300, 256) == 0;
+        ok = ok && match && stolen == OamDmaDevice::CYCLES + startCycle;
+        std::cout << "OAM DMA from " << (startCycle ? "odd" : "even") << " cycle: " << stolen << " stolen cycle(s)"
+                  << (match ? "" : " - MISMATCH") << "\n";
+    }
+    std::cout << std::flush;
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,86 @@
+#pragma once
+#include <array>
+#include <cstdint>
+#include <string>
+#include "Device.h"
+
+class DeviceBus;
+
+// Copies size bytes from src to dst in ascending order, as a DMA unit that reads and writes one byte at a
+// time would (an overlapping copy to a higher address repeats the pattern). Runs of pages without devices are
+// copied straight in RAM, bytes on device pages go through the bus. Returns false if a range wraps past $FFFF.
+bool DmaCopy(DeviceBus& bus, uint16_t src, uint16_t dst, uint32_t size);
+
+// NES sprite DMA - writing page N to $4014 copies $NN00-$NNFF to OAM and halts the CPU for 513 cycles, 514 if it
+// starts on an odd cycle. OAM is this device's own array unless setOamPort() names the PPU's OAMDATA register.
+// The halt starts after the instruction, taken to be the usual 4 cycle STA/STX/STY absolute.
+class OamDmaDevice final : public Device {
+public:
+    static constexpr uint16_t DEFAULT_BASE = 0x4014;
+    static constexpr uint64_t CYCLES = 513;
+
+    explicit OamDmaDevice(DeviceBus& bus) : bus(bus) {}
+
+    uint8_t readRegister(uint16_t) override { return 0; }
+    void writeRegister(uint16_t offset, uint8_t data) override;
+    uint64_t takeStallCycles() override { const uint64_t stall = stallCycles; stallCycles = 0; return stall; }
+    size_t stateSize() const override { return sizeof(oam); }
+    void saveState(uint8_t* out) const override { putState(out, oam); }
+    void loadState(const uint8_t* in) override { getState(in, oam); }
+
+    // Writes every byte to port instead (e.g. $2004), 0 for the internal array
+    void setOamPort(uint16_t port) { oamPort = port; }
+    const std::array<uint8_t, 256>& getOam() const { return oam; }
+
+protected:
+    void advance(uint64_t, uint64_t) override {}
+
+private:
+    DeviceBus& bus;
+    std::array<uint8_t, 256> oam{};
+    uint16_t oamPort = 0;
+    uint64_t stallCycles = 0;
+};
+
+// Memory-to-memory DMA for OS guests. The transfer runs in one go when CONTROL is written and the CPU is halted
+// for its cost, two cycles per byte (a read and a write) plus SETUP_CYCLES, counted in getStolenCycles().
+//
+// Registers:
+//   +0/+1  SOURCE       start address, low byte first
+//   +2/+3  DESTINATION
+//   +4/+5  LENGTH       bytes, 0 copies 64 KB
+//   +6     CONTROL      write: bit 0 starts the transfer. read: STATUS_ERROR if the last transfer wrapped
+//                       past $FFFF and was not done
+class MemoryDmaDevice final : public Device {
+public:
+    static constexpr uint64_t SETUP_CYCLES = 2;
+    static constexpr uint64_t CYCLES_PER_BYTE = 2;
+    static constexpr uint8_t CONTROL_START = 0x01;
+    static constexpr uint8_t STATUS_ERROR = 0x80;
+
+    explicit MemoryDmaDevice(DeviceBus& bus) : bus(bus) {}
+
+    uint8_t readRegister(uint16_t offset) override;
+    void writeRegister(uint16_t offset, uint8_t data) override;
+    uint64_t takeStallCycles() override { const uint64_t stall = stallCycles; stallCycles = 0; return stall; }
+    size_t stateSize() const override { return sizeof(registers) + sizeof(status); }
+    void saveState(uint8_t* out) const override { putState(putState(out, registers), status); }
+    void loadState(const uint8_t* in) override { getState(getState(in, registers), status); }
+
+    uint64_t getTransfers() const { return transfers; }
+    uint64_t getStolenCycles() const { return stolenCycles; }
+
+protected:
+    void advance(uint64_t, uint64_t) override {}
+
+private:
+    DeviceBus& bus;
+    std::array<uint8_t, 6> registers{};
+    uint8_t status = 0;
+    uint64_t stallCycles = 0;
+    uint64_t transfers = 0;
+    uint64_t stolenCycles = 0;
+};
+
+// dma - copies 4 KB with an LDA/STA loop and with MemoryDmaDevice, and times an OAM DMA on both cycle parities
+int RunDmaDemo();
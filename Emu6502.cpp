@@ -0,0 +1,240 @@
+#include <array>
+#include <cstring>
+#include <new>
+#include <variant>
+
+#include "Cpu6502.h"
+#include "Emu6502.h"
+#include "Ram.h"
+
+// RAM with up to EMU6502_MAX_IO_RANGES callback ranges, decoded per page like DeviceBus
+class CallbackBus : public Bus {
+public:
+    uint8_t read(uint16_t addr) override {
+        if (const IoRange* r = rangeAt(addr); r && r->read)
+            return r->read(r->user, addr);
+        return ram.read(addr);
+    }
+
+    void write(uint16_t addr, uint8_t data) override {
+        if (const IoRange* r = rangeAt(addr); r && r->write) {
+            r->write(r->user, addr, data);
+            return;
+        }
+        ram.write(addr, data);
+    }
+
+    bool isPlainMemory(uint16_t addr) const override { return rangeAt(addr) == nullptr; }
+
+    Emu6502Status map(uint16_t base, uint32_t size, Emu6502ReadCallback readFn, Emu6502WriteCallback writeFn, void* user) {
+        if (size == 0 || size > 0x10000u - base)
+            return EMU6502_INVALID_ARGUMENT;
+        if (rangeCount == ranges.size())
+            return EMU6502_NO_SPACE;
+
+        const uint32_t firstPage = base >> 8;
+        const uint32_t lastPage = (base + size - 1) >> 8;
+        for (uint32_t page = firstPage; page <= lastPage; ++page) {
+            if (pageRange[page] != 0)
+                return EMU6502_OVERLAP;
+        }
+        ranges[rangeCount++] = { base, size, readFn, writeFn, user };
+        for (uint32_t page = firstPage; page <= lastPage; ++page)
+            pageRange[page] = static_cast<uint8_t>(rangeCount);
+        return EMU6502_OK;
+    }
+
+    RAM ram;
+
+private:
+    struct IoRange {
+        uint16_t base;
+        uint32_t size;
+        Emu6502ReadCallback read;
+        Emu6502WriteCallback write;
+        void* user;
+    };
+
+    const IoRange* rangeAt(uint16_t addr) const {
+        const uint8_t index = pageRange[addr >> 8];
+        if (index == 0)
+            return nullptr;
+        const IoRange& r = ranges[index - 1];
+        return (addr >= r.base && addr < r.base + r.size) ? &r : nullptr;
+    }
+
+    std::array<IoRange, EMU6502_MAX_IO_RANGES> ranges{};
+    std::array<uint8_t, 256> pageRange{}; // range index + 1 per page, 0 = RAM only
+    size_t rangeCount = 0;
+};
+
+// The variant is picked once per call, the run loops below are instantiated per core
+struct Emu6502 {
+    CallbackBus bus;
+    std::variant<Cpu6502, Cpu2A03, Cpu65C02> cpu;
+};
+
+template <typename F>
+static auto WithCpu(Emu6502* emu, F f) {
+    return std::visit(f, emu->cpu);
+}
+
+template <typename F>
+static auto WithCpu(const Emu6502* emu, F f) {
+    return std::visit(f, emu->cpu);
+}
+
+// Runs the rest of an instruction emu6502_run_cycles left in flight
+template <typename Cpu>
+static void FinishInstruction(Cpu& cpu)
+{
+    while (!cpu.instructionComplete())
+        cpu.clock();
+}
+
+extern "C" {
+
+uint32_t emu6502_abi_version(void)
+{
+    return EMU6502_ABI_VERSION;
+}
+
+Emu6502* emu6502_create(Emu6502Variant variant)
+{
+    Emu6502* emu = new (std::nothrow) Emu6502;
+    if (emu == nullptr)
+        return nullptr;
+
+    switch (variant) {
+    case EMU6502_VARIANT_NMOS: emu->cpu.emplace<Cpu6502>(); break;
+    case EMU6502_VARIANT_2A03: emu->cpu.emplace<Cpu2A03>(); break;
+    case EMU6502_VARIANT_65C02: emu->cpu.emplace<Cpu65C02>(); break;
+    default:
+        delete emu;
+        return nullptr;
+    }
+    WithCpu(emu, [&](auto& cpu) { cpu.connectBus(&emu->bus); });
+    return emu;
+}
+
+void emu6502_destroy(Emu6502* emu)
+{
+    delete emu;
+}
+
+Emu6502Status emu6502_reset(Emu6502* emu)
+{
+    if (emu == nullptr)
+        return EMU6502_INVALID_ARGUMENT;
+    WithCpu(emu, [](auto& cpu) { cpu.reset(); });
+    return EMU6502_OK;
+}
+
+uint64_t emu6502_run_cycles(Emu6502* emu, uint64_t cycles)
+{
+    if (emu == nullptr)
+        return 0;
+    return WithCpu(emu, [cycles](auto& cpu) {
+        for (uint64_t i = 0; i < cycles; ++i)
+            cpu.clock();
+        return cycles;
+    });
+}
+
+uint64_t emu6502_run_instructions(Emu6502* emu, uint64_t count)
+{
+    if (emu == nullptr)
+        return 0;
+    return WithCpu(emu, [count](auto& cpu) {
+        const uint64_t start = cpu.totalCycles;
+        FinishInstruction(cpu);
+        for (uint64_t i = 0; i < count; ++i) {
+            do {
+                cpu.clock();
+            } while (!cpu.instructionComplete());
+        }
+        return cpu.totalCycles - start;
+    });
+}
+
+Emu6502Status emu6502_irq(Emu6502* emu)
+{
+    if (emu == nullptr)
+        return EMU6502_INVALID_ARGUMENT;
+    WithCpu(emu, [](auto& cpu) {
+        FinishInstruction(cpu);
+        cpu.interrupt();
+    });
+    return EMU6502_OK;
+}
+
+Emu6502Status emu6502_nmi(Emu6502* emu)
+{
+    if (emu == nullptr)
+        return EMU6502_INVALID_ARGUMENT;
+    WithCpu(emu, [](auto& cpu) {
+        FinishInstruction(cpu);
+        cpu.nonMaskableInterrupt();
+    });
+    return EMU6502_OK;
+}
+
+Emu6502Status emu6502_get_registers(const Emu6502* emu, Emu6502Registers* out)
+{
+    if (emu == nullptr || out == nullptr)
+        return EMU6502_INVALID_ARGUMENT;
+    WithCpu(emu, [out](const auto& cpu) {
+        out->cycles = cpu.totalCycles;
+        out->pc = cpu.PC;
+        out->a = cpu.A;
+        out->x = cpu.X;
+        out->y = cpu.Y;
+        out->sp = cpu.SP;
+        out->status = cpu.status;
+    });
+    return EMU6502_OK;
+}
+
+Emu6502Status emu6502_set_registers(Emu6502* emu, const Emu6502Registers* in)
+{
+    if (emu == nullptr || in == nullptr)
+        return EMU6502_INVALID_ARGUMENT;
+    WithCpu(emu, [in](auto& cpu) {
+        cpu.totalCycles = in->cycles;
+        cpu.PC = in->pc;
+        cpu.A = in->a;
+        cpu.X = in->x;
+        cpu.Y = in->y;
+        cpu.SP = in->sp;
+        cpu.status = in->status;
+    });
+    return EMU6502_OK;
+}
+
+Emu6502Status emu6502_read_memory(const Emu6502* emu, uint16_t addr, uint8_t* out, size_t size)
+{
+    if (emu == nullptr || (out == nullptr && size != 0) || size > RAM::SIZE - addr)
+        return EMU6502_INVALID_ARGUMENT;
+    if (size != 0)
+        std::memcpy(out, emu->bus.ram.data() + addr, size);
+    return EMU6502_OK;
+}
+
+Emu6502Status emu6502_write_memory(Emu6502* emu, uint16_t addr, const uint8_t* data, size_t size)
+{
+    if (emu == nullptr || (data == nullptr && size != 0) || size > RAM::SIZE - addr)
+        return EMU6502_INVALID_ARGUMENT;
+    if (size != 0)
+        std::memcpy(emu->bus.ram.data() + addr, data, size);
+    return EMU6502_OK;
+}
+
+Emu6502Status emu6502_map_io(Emu6502* emu, uint16_t base, uint32_t size,
+                             Emu6502ReadCallback read, Emu6502WriteCallback write, void* user)
+{
+    if (emu == nullptr)
+        return EMU6502_INVALID_ARGUMENT;
+    return emu->bus.map(base, size, read, write, user);
+}
+
+}
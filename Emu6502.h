@@ -0,0 +1,97 @@
+#ifndef EMU6502_H
+#define EMU6502_H
+
+/* Embeddable C interface to the emulator core (built by Emu6502.vcxproj). Plain C so any language with a
+ * C FFI can drive it without spawning the executable. Instances are independent; an instance must only be
+ * used by one thread at a time. Nothing on the run path allocates - all state is sized at creation. */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if defined(_WIN32) && !defined(EMU6502_STATIC)
+#  if defined(EMU6502_BUILD)
+#    define EMU6502_API __declspec(dllexport)
+#  else
+#    define EMU6502_API __declspec(dllimport)
+#  endif
+#elif defined(__GNUC__)
+#  define EMU6502_API __attribute__((visibility("default")))
+#else
+#  define EMU6502_API
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Bumped whenever a signature or struct layout changes */
+#define EMU6502_ABI_VERSION 1
+
+#define EMU6502_MAX_IO_RANGES 16
+
+typedef struct Emu6502 Emu6502;
+
+typedef enum Emu6502Variant {
+    EMU6502_VARIANT_NMOS = 0,  /* original 6502 with decimal mode */
+    EMU6502_VARIANT_2A03 = 1,  /* NES, no decimal mode */
+    EMU6502_VARIANT_65C02 = 2  /* CMOS 65C02 */
+} Emu6502Variant;
+
+typedef enum Emu6502Status {
+    EMU6502_OK = 0,
+    EMU6502_INVALID_ARGUMENT = -1, /* null handle, range outside the address space... */
+    EMU6502_NO_SPACE = -2,         /* all I/O ranges in use */
+    EMU6502_OVERLAP = -3           /* I/O range shares a page with another range */
+} Emu6502Status;
+
+typedef struct Emu6502Registers {
+    uint64_t cycles; /* total cycles since creation */
+    uint16_t pc;
+    uint8_t a, x, y, sp, status;
+} Emu6502Registers;
+
+/* I/O callbacks - addr is the full CPU address, user is the pointer given to emu6502_map_io */
+typedef uint8_t (*Emu6502ReadCallback)(void* user, uint16_t addr);
+typedef void (*Emu6502WriteCallback)(void* user, uint16_t addr, uint8_t data);
+
+EMU6502_API uint32_t emu6502_abi_version(void);
+
+/* Returns NULL for an unknown variant or when out of memory. Memory starts zeroed. */
+EMU6502_API Emu6502* emu6502_create(Emu6502Variant variant);
+EMU6502_API void emu6502_destroy(Emu6502* emu);
+
+/* Loads PC from the reset vector, as the hardware does */
+EMU6502_API Emu6502Status emu6502_reset(Emu6502* emu);
+
+/* Runs exactly this many clock cycles (the last instruction may be left in flight).
+ * Returns the cycles run. */
+EMU6502_API uint64_t emu6502_run_cycles(Emu6502* emu, uint64_t cycles);
+
+/* Completes the instruction in flight, then runs count whole instructions. Returns the cycles run. */
+EMU6502_API uint64_t emu6502_run_instructions(Emu6502* emu, uint64_t count);
+
+/* Interrupt sequences - an instruction emu6502_run_cycles left in flight is completed first (its cycles count
+ * in the registers' cycle count), then PC and status are pushed and PC is loaded from the IRQ vector $FFFE or
+ * the NMI vector $FFFA. An IRQ is ignored while the I flag is set. The sequence's cycles run with the next
+ * emu6502_run_cycles or emu6502_run_instructions. */
+EMU6502_API Emu6502Status emu6502_irq(Emu6502* emu);
+EMU6502_API Emu6502Status emu6502_nmi(Emu6502* emu);
+
+EMU6502_API Emu6502Status emu6502_get_registers(const Emu6502* emu, Emu6502Registers* out);
+EMU6502_API Emu6502Status emu6502_set_registers(Emu6502* emu, const Emu6502Registers* in);
+
+/* Bulk copies between RAM and a caller buffer - I/O callbacks are not involved.
+ * [addr, addr + size) must lie within the 64 KB address space. */
+EMU6502_API Emu6502Status emu6502_read_memory(const Emu6502* emu, uint16_t addr, uint8_t* out, size_t size);
+EMU6502_API Emu6502Status emu6502_write_memory(Emu6502* emu, uint16_t addr, const uint8_t* data, size_t size);
+
+/* Routes CPU accesses to [base, base + size) to the callbacks. A 256 byte page holds at most one range,
+ * the rest of the page stays RAM. Either callback may be NULL (reads then return RAM, writes go to RAM). */
+EMU6502_API Emu6502Status emu6502_map_io(Emu6502* emu, uint16_t base, uint32_t size,
+                                         Emu6502ReadCallback read, Emu6502WriteCallback write, void* user);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -8,6 +8,10 @@ public:
 
     uint8_t read(uint16_t addr) override;
     void write(uint16_t addr, uint8_t data) override;
+    bool isPlainMemory(uint16_t) const override { return true; }
+
+    const RAM& getRam() const { return ram; }
+    RAM& getRam() { return ram; }
 
 private:
     RAM ram;
@@ -0,0 +1,682 @@
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+
+#include "Assembler.h"
+#include "Cpu6502.h"
+#include "CpuMonitor.h"
+#include "DeviceBus.h"
+#include "GuestBench.h"
+#include "Via.h"
+
+// Copies 16 pages from $1000 to $2000 with (zp),Y loads and stores
+static const char* const MEMCPY_SOURCE = R"(
+SRC     = $1000
+DST     = $2000
+PAGES   = 16
+passes  = $00
+src     = $02
+dst     = $04
+
+        .org $8000
+reset:  ldx #$FF
+        txs
+        lda #<SRC               ; byte i of page p is i + p
+        sta src
+        lda #>SRC
+        sta src+1
+        ldx #PAGES
+        ldy #0
+fill:   tya
+        clc
+        adc src+1
+        sta (src),y
+        iny
+        bne fill
+        inc src+1
+        dex
+        bne fill
+
+loop:   lda #<SRC
+        sta src
+        lda #>SRC
+        sta src+1
+        lda #<DST
+        sta dst
+        lda #>DST
+        sta dst+1
+        ldx #PAGES
+        ldy #0
+copy:   lda (src),y
+        sta (dst),y
+        iny
+        bne copy
+        inc src+1
+        inc dst+1
+        dex
+        bne copy
+        inc passes
+        bne loop
+        inc passes+1
+        jmp loop
+
+nmi:
+irq:    rti
+
+        .org $FFFA
+        .word nmi, reset, irq
+)";
+
+// Bitwise CRC-32 (reflected, polynomial $EDB88320) of 1 KB of LFSR output
+static const char* const CRC32_SOURCE = R"(
+BUF     = $1000
+PAGES   = 4
+passes  = $00
+ptr     = $02
+lfsr    = $04
+pages   = $05
+crc     = $08
+result  = $0C
+
+        .org $8000
+reset:  ldx #$FF
+        txs
+        lda #<BUF
+        sta ptr
+        lda #>BUF
+        sta ptr+1
+        lda #1
+        sta lfsr
+        ldx #PAGES
+        ldy #0
+fill:   lda lfsr                ; x' = x << 1, ^ $1D when a bit falls out
+        asl a
+        bcc nofb
+        eor #$1D
+nofb:   sta lfsr
+        sta (ptr),y
+        iny
+        bne fill
+        inc ptr+1
+        dex
+        bne fill
+
+loop:   lda #$FF
+        sta crc
+        sta crc+1
+        sta crc+2
+        sta crc+3
+        lda #>BUF
+        sta ptr+1
+        lda #PAGES
+        sta pages
+        ldy #0
+byte:   lda (ptr),y
+        eor crc
+        sta crc
+        ldx #8
+bit:    lsr crc+3
+        ror crc+2
+        ror crc+1
+        ror crc
+        bcc next
+        lda crc+3
+        eor #$ED
+        sta crc+3
+        lda crc+2
+        eor #$B8
+        sta crc+2
+        lda crc+1
+        eor #$83
+        sta crc+1
+        lda crc
+        eor #$20
+        sta crc
+next:   dex
+        bne bit
+        iny
+        bne byte
+        inc ptr+1
+        dec pages
+        bne byte
+
+        ldx #3
+final:  lda crc,x
+        eor #$FF
+        sta result,x
+        dex
+        bpl final
+        inc passes
+        bne loop
+        inc passes+1
+        jmp loop
+
+nmi:
+irq:    rti
+
+        .org $FFFA
+        .word nmi, reset, irq
+)";
+
+// Bubble sort of 256 LFSR bytes, the sorted array is copied out once it is complete
+static const char* const SORT_SOURCE = R"(
+WORK    = $1000
+OUT     = $1100
+passes  = $00
+lfsr    = $02
+swapped = $03
+
+        .org $8000
+reset:  ldx #$FF
+        txs
+loop:   lda #1
+        sta lfsr
+        ldx #0
+fill:   lda lfsr
+        asl a
+        bcc nofb
+        eor #$1D
+nofb:   sta lfsr
+        sta WORK,x
+        inx
+        bne fill
+
+sort:   lda #0
+        sta swapped
+        ldx #0
+pair:   lda WORK,x
+        cmp WORK+1,x
+        bcc ordered
+        beq ordered
+        ldy WORK+1,x
+        sta WORK+1,x
+        tya
+        sta WORK,x
+        inc swapped
+ordered:
+        inx
+        cpx #$FF
+        bne pair
+        lda swapped
+        bne sort
+
+        ldx #0
+copy:   lda WORK,x
+        sta OUT,x
+        inx
+        bne copy
+        inc passes
+        bne loop
+        inc passes+1
+        jmp loop
+
+nmi:
+irq:    rti
+
+        .org $FFFA
+        .word nmi, reset, irq
+)";
+
+// 256 rounds of 16x16 -> 32 bit shift-and-add multiply and 16 / 16 bit restoring divide over two arithmetic
+// sequences, summing every product word, quotient and remainder
+static const char* const MULDIV_SOURCE = R"(
+passes  = $00
+opa     = $02
+opb     = $04
+mb      = $06
+prod    = $08
+dv      = $0C
+rem     = $0E
+sum     = $10
+round   = $12
+result  = $14
+
+        .org $8000
+reset:  ldx #$FF
+        txs
+loop:   lda #$34
+        sta opa
+        lda #$12
+        sta opa+1
+        lda #7
+        sta opb
+        lda #0
+        sta opb+1
+        sta sum
+        sta sum+1
+        sta round
+
+step:   lda opb
+        sta mb
+        lda opb+1
+        sta mb+1
+        jsr mul16
+        clc
+        lda sum
+        adc prod
+        sta sum
+        lda sum+1
+        adc prod+1
+        sta sum+1
+        clc
+        lda sum
+        adc prod+2
+        sta sum
+        lda sum+1
+        adc prod+3
+        sta sum+1
+
+        lda opa
+        sta dv
+        lda opa+1
+        sta dv+1
+        jsr div16
+        clc
+        lda sum
+        adc dv
+        sta sum
+        lda sum+1
+        adc dv+1
+        sta sum+1
+        clc
+        lda sum
+        adc rem
+        sta sum
+        lda sum+1
+        adc rem+1
+        sta sum+1
+
+        clc                     ; opa += $0103, opb += $0061
+        lda opa
+        adc #<$0103
+        sta opa
+        lda opa+1
+        adc #>$0103
+        sta opa+1
+        clc
+        lda opb
+        adc #$61
+        sta opb
+        lda opb+1
+        adc #0
+        sta opb+1
+        inc round
+        beq done
+        jmp step
+
+done:   lda sum
+        sta result
+        lda sum+1
+        sta result+1
+        inc passes
+        bne again
+        inc passes+1
+again:  jmp loop
+
+; prod = opa * mb, mb is shifted out
+mul16:  lda #0
+        sta prod+2
+        sta prod+3
+        ldx #16
+mloop:  lsr mb+1
+        ror mb
+        bcc mshift
+        lda prod+2
+        clc
+        adc opa
+        sta prod+2
+        lda prod+3
+        adc opa+1
+        sta prod+3
+mshift: ror prod+3
+        ror prod+2
+        ror prod+1
+        ror prod
+        dex
+        bne mloop
+        rts
+
+; dv = dv / opb, rem = dv % opb (opb below $8000)
+div16:  lda #0
+        sta rem
+        sta rem+1
+        ldx #16
+dloop:  asl dv
+        rol dv+1
+        rol rem
+        rol rem+1
+        lda rem
+        sec
+        sbc opb
+        tay
+        lda rem+1
+        sbc opb+1
+        bcc dnext
+        sta rem+1
+        sty rem
+        inc dv
+dnext:  dex
+        bne dloop
+        rts
+
+nmi:
+irq:    rti
+
+        .org $FFFA
+        .word nmi, reset, irq
+)";
+
+// Two tasks on their own stacks, switched by the VIA timer interrupt every PERIOD + 2 cycles. Each task keeps
+// a register in step with a memory counter and flags a mismatch, so a context the switch corrupts is caught.
+static const char* const CONTEXT_SOURCE = R"(
+VIA     = $6000
+PERIOD  = 498
+passes  = $00
+current = $02
+stacks  = $03                   ; Saved SP of task 0 and task 1
+counta  = $05
+countb  = $06
+rana    = $07
+ranb    = $08
+failed  = $09
+FRAME   = $0179                 ; Task 1's first frame: Y X A P PCL PCH up to $017F
+
+        .org $8000
+reset:  sei
+        ldx #$FF
+        txs
+        lda #>taskb
+        sta FRAME+6
+        lda #<taskb
+        sta FRAME+5
+        lda #$20                ; I clear
+        sta FRAME+4
+        lda #0
+        sta FRAME+3
+        sta FRAME+2
+        sta FRAME+1
+        sta current
+        lda #<FRAME
+        sta stacks+1
+        lda #$40                ; T1 free-running, interrupt enabled
+        sta VIA+$B
+        lda #<PERIOD
+        sta VIA+4
+        lda #>PERIOD
+        sta VIA+5
+        lda #$C0
+        sta VIA+$E
+        cli
+
+taska:  lda #1
+        sta rana
+        ldx #0
+ta:     cpx counta
+        bne bad
+        inx
+        stx counta
+        jmp ta
+
+taskb:  lda #1
+        sta ranb
+        lda #0
+tb:     cmp countb
+        bne bad
+        cpy countb
+        bne bad
+        clc
+        adc #3
+        tay
+        sta countb
+        jmp tb
+
+bad:    lda #1
+        sta failed
+        jmp bad
+
+irq:    pha
+        txa
+        pha
+        tya
+        pha
+        lda VIA+4               ; Acknowledge T1
+        tsx
+        txa
+        ldy current
+        sta stacks,y
+        tya
+        eor #1
+        sta current
+        tay
+        ldx stacks,y
+        txs
+        inc passes
+        bne resume
+        inc passes+1
+resume: pla
+        tay
+        pla
+        tax
+        pla
+nmi:    rti
+
+        .org $FFFA
+        .word nmi, reset, irq
+)";
+
+// Idle main loop, the work happens in a VIA timer interrupt every PERIOD + 2 cycles - the usual shape of an
+// interrupt-driven program and the case idle loop fast-forward is for
+static const char* const WAIT_SOURCE = R"(
+VIA     = $6000
+PERIOD  = 998
+passes  = $00
+sum     = $02
+
+        .org $8000
+reset:  sei
+        ldx #$FF
+        txs
+        lda #$40                ; T1 free-running, interrupt enabled
+        sta VIA+$B
+        lda #<PERIOD
+        sta VIA+4
+        lda #>PERIOD
+        sta VIA+5
+        lda #$C0
+        sta VIA+$E
+        cli
+idle:   jmp idle
+
+irq:    pha                     ; Sum the first 16 bytes of this code
+        txa
+        pha
+        lda VIA+4
+        lda sum
+        ldx #0
+work:   clc
+        adc $8000,x
+        inx
+        cpx #16
+        bne work
+        sta sum
+        inc passes
+        bne done
+        inc passes+1
+done:   pla
+        tax
+        pla
+nmi:    rti
+
+        .org $FFFA
+        .word nmi, reset, irq
+)";
+
+static uint16_t Peek16(Bus& bus, uint16_t addr)
+{
+    return static_cast<uint16_t>(bus.read(addr) | (bus.read(static_cast<uint16_t>(addr + 1)) << 8));
+}
+
+// The kernels' fill sequence - x' = x << 1, ^ $1D when a bit falls out
+static uint8_t NextLfsr(uint8_t x)
+{
+    return static_cast<uint8_t>((x << 1) ^ ((x & 0x80) != 0 ? 0x1D : 0x00));
+}
+
+// Timer interrupts counted by the guest in 16 bits against the number expected after cycles - the count may be
+// a little short, the first tick comes after the setup code
+static bool TicksMatch(uint16_t ticks, uint64_t expected)
+{
+    return static_cast<uint16_t>(expected - ticks) <= 2;
+}
+
+static bool CheckMemcpy(Bus& bus, const std::map<std::string, uint16_t>& symbols, uint64_t)
+{
+    if (Peek16(bus, symbols.at("passes")) == 0)
+        return false;
+    for (uint32_t i = 0; i < symbols.at("PAGES") * 256u; ++i) {
+        if (bus.read(static_cast<uint16_t>(symbols.at("DST") + i)) != static_cast<uint8_t>(i + (symbols.at("SRC") >> 8) + (i >> 8)))
+            return false;
+    }
+    return true;
+}
+
+static bool CheckCrc32(Bus& bus, const std::map<std::string, uint16_t>& symbols, uint64_t)
+{
+    uint32_t crc = 0xFFFFFFFF;
+    uint8_t x = 1;
+    for (uint32_t i = 0; i < symbols.at("PAGES") * 256u; ++i) {
+        x = NextLfsr(x);
+        crc ^= x;
+        for (int bit = 0; bit < 8; ++bit)
+            crc = (crc >> 1) ^ ((crc & 1) != 0 ? 0xEDB88320u : 0u);
+    }
+    crc = ~crc;
+    const uint16_t result = symbols.at("result");
+    return Peek16(bus, symbols.at("passes")) != 0 && Peek16(bus, result) == (crc & 0xFFFF) &&
+           Peek16(bus, static_cast<uint16_t>(result + 2)) == crc >> 16;
+}
+
+static bool CheckSort(Bus& bus, const std::map<std::string, uint16_t>& symbols, uint64_t)
+{
+    std::vector<uint8_t> expected(256);
+    uint8_t x = 1;
+    for (uint8_t& value : expected)
+        value = x = NextLfsr(x);
+    std::sort(expected.begin(), expected.end());
+    for (int i = 0; i < 256; ++i) {
+        if (bus.read(static_cast<uint16_t>(symbols.at("OUT") + i)) != expected[i])
+            return false;
+    }
+    return Peek16(bus, symbols.at("passes")) != 0;
+}
+
+static bool CheckMulDiv(Bus& bus, const std::map<std::string, uint16_t>& symbols, uint64_t)
+{
+    uint32_t a = 0x1234;
+    uint32_t b = 7;
+    uint16_t sum = 0;
+    for (int round = 0; round < 256; ++round) {
+        const uint32_t product = a * b;
+        sum = static_cast<uint16_t>(sum + (product & 0xFFFF) + (product >> 16) + a / b + a % b);
+        a = (a + 0x0103) & 0xFFFF;
+        b = (b + 0x0061) & 0xFFFF;
+    }
+    return Peek16(bus, symbols.at("passes")) != 0 && Peek16(bus, symbols.at("result")) == sum;
+}
+
+static bool CheckContextSwitch(Bus& bus, const std::map<std::string, uint16_t>& symbols, uint64_t cycles)
+{
+    const uint64_t expected = cycles / (symbols.at("PERIOD") + 2u);
+    return bus.read(symbols.at("failed")) == 0 && bus.read(symbols.at("rana")) == 1 && bus.read(symbols.at("ranb")) == 1 &&
+           TicksMatch(Peek16(bus, symbols.at("passes")), expected);
+}
+
+static bool CheckWait(Bus& bus, const std::map<std::string, uint16_t>& symbols, uint64_t cycles)
+{
+    const uint64_t expected = cycles / (symbols.at("PERIOD") + 2u);
+    const uint16_t ticks = Peek16(bus, symbols.at("passes"));
+    uint8_t code = 0;
+    for (uint16_t i = 0; i < 16; ++i)
+        code = static_cast<uint8_t>(code + bus.read(static_cast<uint16_t>(0x8000 + i)));
+    // A run may end between the store of sum and the count
+    const uint8_t sum = bus.read(symbols.at("sum"));
+    return TicksMatch(ticks, expected) && (sum == static_cast<uint8_t>(ticks * code) || sum == static_cast<uint8_t>((ticks + 1) * code));
+}
+
+const std::vector<GuestKernel>& GuestKernels()
+{
+    static const std::vector<GuestKernel> kernels = {
+        { "memcpy", "4 KB copy", MEMCPY_SOURCE, CheckMemcpy },
+        { "crc32", "1 KB CRC", CRC32_SOURCE, CheckCrc32 },
+        { "sort", "256 byte sort", SORT_SOURCE, CheckSort },
+        { "muldiv", "256 mul+div", MULDIV_SOURCE, CheckMulDiv },
+        { "context", "task switch", CONTEXT_SOURCE, CheckContextSwitch },
+        { "wait", "timer tick", WAIT_SOURCE, CheckWait },
+    };
+    return kernels;
+}
+
+int RunGuestBench(uint64_t cycles)
+{
+    // Build the whole corpus first, so a source error stops the run before anything is measured
+    const auto buildStart = std::chrono::steady_clock::now();
+    std::vector<AssembledProgram> programs(GuestKernels().size());
+    for (size_t i = 0; i < programs.size(); ++i) {
+        std::string error;
+        if (!Assemble(GuestKernels()[i].source, programs[i], error)) {
+            std::cerr << GuestKernels()[i].name << ": " << error << std::endl;
+            return 2;
+        }
+    }
+    const double buildMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - buildStart).count();
+    std::cout << programs.size() << " kernel(s) assembled in " << buildMs << " ms\n";
+
+    struct Run {
+        bool pass = false;
+        uint16_t passes = 0;
+        double mhz = 0;
+        uint64_t dispatches = 0; // Instructions run, a fused pair counts once
+        uint64_t fusedPairs = 0;
+    };
+    // Every kernel runs with and without superinstruction fusion (Cpu6502Core::setFusion), which must not
+    // change its results
+    auto run = [&](size_t i, bool fusion) {
+        DeviceBus bus;
+        ViaDevice via;
+        bus.attach(&via, GUEST_VIA, 16);
+        LoadProgram(bus, programs[i]);
+        CpuMonitor counter(cycles);
+        bus.addHook(&counter);
+
+        Cpu6502 cpu(&bus);
+        cpu.setFusion(fusion);
+        cpu.reset();
+
+        const auto begin = std::chrono::steady_clock::now();
+        RunSynced(cpu, bus, cycles);
+        const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+        counter.publish(cpu, 0);
+
+        Run r;
+        r.pass = GuestKernels()[i].check(bus, programs[i].symbols, cpu.totalCycles);
+        r.passes = Peek16(bus, 0x0000);
+        r.mhz = cpu.totalCycles / seconds / 1e6;
+        r.dispatches = counter.read().instructions;
+        r.fusedPairs = cpu.fusedPairs;
+        return r;
+    };
+
+    bool ok = true;
+    for (size_t i = 0; i < programs.size(); ++i) {
+        const GuestKernel& kernel = GuestKernels()[i];
+        const Run plain = run(i, false);
+        const Run fused = run(i, true);
+        const bool pass = plain.pass && fused.pass && plain.passes == fused.passes;
+        ok = ok && pass;
+        std::cout << kernel.name << ": " << plain.passes << " x " << kernel.unit << ", " << plain.mhz << " MHz, fused "
+                  << fused.mhz << " MHz with " << 100.0 * static_cast<double>(fused.fusedPairs) / static_cast<double>(plain.dispatches)
+                  << "% fewer dispatches" << (pass ? "" : " - FAILED") << "\n";
+    }
+    std::cout << std::flush;
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,27 @@
+#pragma once
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+#include "Bus.h"
+
+// Guest benchmark corpus - small 6502 programs kept as assembly source and built with the in-tree assembler
+// (Assembler.h). Each one starts at its reset vector, loops forever over one unit of work, counts completed
+// passes in the word at $00 and leaves a result the host recomputes independently, so a benchmark run is also
+// a correctness check of the CPU core. A VIA (Via.h) is mapped at GUEST_VIA for the kernels that need a timer.
+
+constexpr uint16_t GUEST_VIA = 0x6000;
+
+struct GuestKernel {
+    const char* name;
+    const char* unit;   // What one pass does
+    const char* source;
+    // Verifies the guest's results after a run of cycles, symbols are the assembled program's
+    bool (*check)(Bus& bus, const std::map<std::string, uint16_t>& symbols, uint64_t cycles);
+};
+
+const std::vector<GuestKernel>& GuestKernels();
+
+// guestbench [cycles] - runs every kernel for cycles with and without instruction fusion, prints its speed and
+// the dispatches fusion saved, and checks its results
+int RunGuestBench(uint64_t cycles);
@@ -0,0 +1,278 @@
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <utility>
+#include <vector>
+
+#include "Cpu6502.h"
+#include "DeviceBus.h"
+#include "HostCall.h"
+
+// Longest file name a guest may pass, without the terminator
+static constexpr size_t MAX_NAME_LENGTH = 64;
+
+// Bytes of the parameter block, up to the end of offset
+static constexpr uint8_t BLOCK_SIZE = 12;
+
+HostCallDevice::HostCallDevice(DeviceBus& bus, std::string directory, std::ostream& console)
+    : bus(bus), directory(std::move(directory)), console(console) {}
+
+uint8_t HostCallDevice::readRegister(uint16_t offset)
+{
+    return offset == 0 ? status : HOST_CALL_ID;
+}
+
+void HostCallDevice::writeRegister(uint16_t offset, uint8_t data)
+{
+    // A transfer over the registers does not start another call
+    if (offset != 0 || inCall)
+        return;
+    uint8_t* zeroPage = bus.getRam().data();
+    auto field = [&](uint8_t offset) -> uint8_t& { return zeroPage[static_cast<uint8_t>(data + offset)]; };
+    const auto function = static_cast<HostCallFunction>(field(0));
+    const uint16_t length = static_cast<uint16_t>(field(4) | (field(5) << 8));
+
+    inCall = true;
+    field(1) = static_cast<uint8_t>(call(data));
+    inCall = false;
+
+    // The results in the block depend on the host - logged, and on replay taken from the log
+    uint8_t results[BLOCK_SIZE];
+    for (uint8_t i = 0; i < BLOCK_SIZE; ++i)
+        results[i] = field(i);
+    uint32_t size = BLOCK_SIZE;
+    const uint8_t* logged = bus.logBulkInput(data, results, size);
+    for (uint8_t i = 0; i < BLOCK_SIZE && i < size; ++i)
+        field(i) = logged[i];
+    bus.markDirty(data, BLOCK_SIZE);
+    status = field(1);
+
+    // Cost, from the block as it now is, so a replay stalls as long as the recording
+    uint32_t transferred = 0;
+    if (status == static_cast<uint8_t>(HostCallStatus::OK)) {
+        if (function == HostCallFunction::CONSOLE_WRITE || function == HostCallFunction::FILE_WRITE)
+            transferred = length;
+        else if (function == HostCallFunction::FILE_READ)
+            transferred = static_cast<uint32_t>(field(4) | (field(5) << 8));
+    }
+    bytesTransferred += transferred;
+    stallCycles += HOST_CALL_CYCLES + (transferred + HOST_CALL_BYTES_PER_CYCLE - 1) / HOST_CALL_BYTES_PER_CYCLE;
+    ++calls;
+}
+
+std::string HostCallDevice::fileName(uint16_t addr) const
+{
+    const uint8_t* ram = bus.getRam().data();
+    std::string name;
+    for (uint32_t a = addr; a < 0x10000 && name.size() <= MAX_NAME_LENGTH; ++a) {
+        const char c = static_cast<char>(ram[a]);
+        if (c == '\0')
+            break;
+        // One flat directory - no separators, drive letters or parent references
+        if (c == '/' || c == '\\' || c == ':' || static_cast<unsigned char>(c) < 0x20)
+            return "";
+        name.push_back(c);
+    }
+    if (name.empty() || name.size() > MAX_NAME_LENGTH || name == "." || name == "..")
+        return "";
+    return directory + "/" + name;
+}
+
+void HostCallDevice::copyToGuest(uint16_t addr, const uint8_t* data, uint32_t size)
+{
+    uint8_t* ram = bus.getRam().data();
+    for (uint32_t done = 0; done < size;) {
+        const uint32_t at = addr + done;
+        const uint32_t chunk = std::min(size - done, 0x100 - (at & 0xFF));
+        if (bus.isPlainPage(static_cast<uint8_t>(at >> 8))) {
+            std::memcpy(ram + at, data + done, chunk);
+            bus.markDirty(static_cast<uint16_t>(at), chunk);
+        } else {
+            for (uint32_t i = 0; i < chunk; ++i)
+                bus.write(static_cast<uint16_t>(at + i), data[done + i]);
+        }
+        done += chunk;
+    }
+}
+
+void HostCallDevice::copyFromGuest(uint16_t addr, uint8_t* data, uint32_t size)
+{
+    const uint8_t* ram = bus.getRam().data();
+    for (uint32_t done = 0; done < size;) {
+        const uint32_t at = addr + done;
+        const uint32_t chunk = std::min(size - done, 0x100 - (at & 0xFF));
+        if (bus.isPlainPage(static_cast<uint8_t>(at >> 8))) {
+            std::memcpy(data + done, ram + at, chunk);
+        } else {
+            for (uint32_t i = 0; i < chunk; ++i)
+                data[done + i] = bus.read(static_cast<uint16_t>(at + i));
+        }
+        done += chunk;
+    }
+}
+
+HostCallStatus HostCallDevice::call(uint8_t block)
+{
+    uint8_t* ram = bus.getRam().data();
+    auto field8 = [&](uint8_t offset) -> uint8_t& { return ram[static_cast<uint8_t>(block + offset)]; };
+    auto get16 = [&](uint8_t offset) { return static_cast<uint16_t>(field8(offset) | (field8(offset + 1) << 8)); };
+    auto set16 = [&](uint8_t offset, uint32_t value) {
+        field8(offset) = static_cast<uint8_t>(value);
+        field8(offset + 1) = static_cast<uint8_t>(value >> 8);
+    };
+    auto get32 = [&](uint8_t offset) { return static_cast<uint32_t>(get16(offset)) | (static_cast<uint32_t>(get16(offset + 2)) << 16); };
+    auto set32 = [&](uint8_t offset, uint32_t value) {
+        set16(offset, value);
+        set16(offset + 2, value >> 16);
+    };
+
+    const uint16_t buffer = get16(2);
+    const uint16_t length = get16(4);
+    HostCallStatus result = HostCallStatus::OK;
+    const bool bufferFits = static_cast<uint32_t>(buffer) + length <= 0x10000;
+
+    switch (static_cast<HostCallFunction>(field8(0))) {
+    case HostCallFunction::CONSOLE_WRITE: {
+        if (!bufferFits) {
+            result = HostCallStatus::BAD_PARAMETER;
+            break;
+        }
+        std::vector<uint8_t> bytes(length);
+        copyFromGuest(buffer, bytes.data(), length);
+        console.write(reinterpret_cast<const char*>(bytes.data()), length);
+        console.flush();
+        break;
+    }
+
+    case HostCallFunction::FILE_READ: {
+        const std::string path = fileName(get16(6));
+        if (path.empty() || !bufferFits) {
+            result = HostCallStatus::BAD_PARAMETER;
+            break;
+        }
+        std::vector<uint8_t> bytes(length);
+        uint32_t size = 0;
+        std::ifstream file(path, std::ios::binary);
+        if (file && file.seekg(get32(8))) {
+            file.read(reinterpret_cast<char*>(bytes.data()), length);
+            size = static_cast<uint32_t>(file.gcount());
+        } else {
+            result = HostCallStatus::IO_ERROR;
+        }
+        // Host input - on replay the bytes come from the log, and the status with the block
+        const uint8_t* read = bus.logBulkInput(buffer, bytes.data(), size);
+        size = std::min<uint32_t>(size, length);
+        copyToGuest(buffer, read, size);
+        set16(4, size);
+        break;
+    }
+
+    case HostCallFunction::FILE_WRITE: {
+        const std::string path = fileName(get16(6));
+        if (path.empty() || !bufferFits) {
+            result = HostCallStatus::BAD_PARAMETER;
+            break;
+        }
+        std::vector<uint8_t> bytes(length);
+        copyFromGuest(buffer, bytes.data(), length);
+        std::fstream file(path, std::ios::binary | std::ios::in | std::ios::out);
+        if (!file) {
+            // Not there yet - create it
+            file.clear();
+            file.open(path, std::ios::binary | std::ios::in | std::ios::out | std::ios::trunc);
+        }
+        if (!file || !file.seekp(get32(8)) || !file.write(reinterpret_cast<const char*>(bytes.data()), length))
+            result = HostCallStatus::IO_ERROR;
+        break;
+    }
+
+    case HostCallFunction::FILE_SIZE: {
+        const std::string path = fileName(get16(6));
+        if (path.empty()) {
+            result = HostCallStatus::BAD_PARAMETER;
+            break;
+        }
+        std::ifstream file(path, std::ios::binary | std::ios::ate);
+        if (!file) {
+            result = HostCallStatus::IO_ERROR;
+            break;
+        }
+        set32(8, static_cast<uint32_t>(file.tellg()));
+        break;
+    }
+
+    case HostCallFunction::TIME: {
+        const auto now = std::chrono::system_clock::now().time_since_epoch();
+        const auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(now).count();
+        set32(8, static_cast<uint32_t>(ms / 1000));
+        set16(4, static_cast<uint32_t>(ms % 1000));
+        break;
+    }
+
+    default:
+        result = HostCallStatus::BAD_FUNCTION;
+        break;
+    }
+
+    return result;
+}
+
+int RunHostCallDemo(const std::string& directory)
+{
+    constexpr uint16_t CALL_REGISTER = 0x4020;
+    constexpr uint16_t NAME = 0x0300;
+    constexpr uint16_t MESSAGE = 0x0310;
+    constexpr uint16_t SOURCE = 0x0400;
+    constexpr uint16_t TARGET = 0x2000;
+    constexpr uint16_t SIZE = 4096;
+    constexpr uint16_t DONE = 0x0214;
+
+    DeviceBus bus;
+    HostCallDevice host(bus, directory, std::cout);
+    bus.attach(&host, CALL_REGISTER, 2);
+
+    // LDA #$10 / STA $4020 / LDA #$20 / STA $4020 / LDA #$30 / STA $4020 / LDA $4020 / STA $08 / JMP *
+    const uint8_t program[] = { 0xA9, 0x10, 0x8D, 0x20, 0x40, 0xA9, 0x20, 0x8D, 0x20, 0x40, 0xA9, 0x30, 0x8D, 0x20, 0x40,
+                                0xAD, 0x20, 0x40, 0x85, 0x08, 0x4C, 0x14, 0x02 };
+    uint8_t* ram = bus.getRam().data();
+    std::memcpy(ram + 0x0200, program, sizeof(program));
+
+    const char name[] = "hostcall.bin";
+    const char message[] = "Hello from the guest\n";
+    std::memcpy(ram + NAME, name, sizeof(name));
+    std::memcpy(ram + MESSAGE, message, sizeof(message) - 1);
+    for (uint32_t i = 0; i < SIZE; ++i)
+        ram[SOURCE + i] = static_cast<uint8_t>(i * 7 + (i >> 8));
+
+    // Parameter blocks at $10 (console), $20 (save $0400) and $30 (load to $2000)
+    auto block = [&](uint8_t at, HostCallFunction function, uint16_t buffer, uint16_t length) {
+        ram[at] = static_cast<uint8_t>(function);
+        ram[at + 1] = 0xFF;
+        ram[at + 2] = static_cast<uint8_t>(buffer);
+        ram[at + 3] = static_cast<uint8_t>(buffer >> 8);
+        ram[at + 4] = static_cast<uint8_t>(length);
+        ram[at + 5] = static_cast<uint8_t>(length >> 8);
+        ram[at + 6] = static_cast<uint8_t>(NAME);
+        ram[at + 7] = static_cast<uint8_t>(NAME >> 8);
+    };
+    block(0x10, HostCallFunction::CONSOLE_WRITE, MESSAGE, sizeof(message) - 1);
+    block(0x20, HostCallFunction::FILE_WRITE, SOURCE, SIZE);
+    block(0x30, HostCallFunction::FILE_READ, TARGET, SIZE);
+    bus.markDirty(0, 0x10000);
+
+    Cpu6502 cpu(&bus);
+    cpu.PC = 0x0200;
+    cpu.SP = 0xFD;
+    cpu.status = 0x24;
+    while (cpu.PC != DONE && cpu.totalCycles < 1000)
+        RunSynced(cpu, bus, cpu.totalCycles + 1);
+
+    const bool match = std::memcmp(ram + SOURCE, ram + TARGET, SIZE) == 0;
+    std::cout << host.getCalls() << " host call(s), " << host.getBytesTransferred() << " byte(s) in " << cpu.totalCycles
+              << " emulated cycle(s), status $" << std::hex << static_cast<unsigned>(ram[0x08]) << std::dec << "\n";
+    std::cout << "4 KB copy " << (match ? "matches" : "DIFFERS") << ", a byte-at-a-time port loop would take about "
+              << 15 * 2 * SIZE << " cycles for the same transfers" << std::endl;
+    return match && ram[0x08] == 0 ? 0 : 1;
+}
@@ -0,0 +1,90 @@
+#pragma once
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include "Device.h"
+
+class DeviceBus;
+
+// Paravirtual host calls - lets guest software reach the host (console, files, time) in a single bus write
+// instead of byte-at-a-time port I/O. The guest fills a parameter block in zero page and writes the block's
+// zero page address to the CALL register. The host performs the whole request directly on guest RAM and
+// halts the CPU for a fixed, documented cost, so a kilobyte of file I/O takes a few dozen emulated cycles.
+//
+// Registers:
+//   +0 CALL    write: zero page address of the parameter block, runs the call. read: status of the last call
+//   +1 ID      read: HOST_CALL_ID, for guests to probe for the interface
+//
+// Parameter block (16 bit and 32 bit fields little-endian):
+//   +0  function  HostCallFunction
+//   +1  status    HostCallStatus, written by the host
+//   +2  buffer    guest buffer address
+//   +4  length    bytes to transfer, replaced by the bytes transferred
+//   +6  name      address of a zero-terminated file name, relative to the host directory
+//   +8  offset    file offset (32 bit), FILE_SIZE and TIME return their result here
+//
+// Transfers go straight to RAM, through the bus on pages where a device is mapped, and may not wrap past $FFFF.
+// What a call returns is host input: the bytes FILE_READ transfers and the parameter block after every call go
+// through the bus's InputLog (DeviceBus::logBulkInput), so a replay gets the recorded results without the host
+// files. Console output and file writes are made again on replay.
+
+constexpr uint8_t HOST_CALL_ID = 0x48;
+
+// Cost of a call in CPU cycles - a fixed part plus one per started 64 bytes transferred
+constexpr uint64_t HOST_CALL_CYCLES = 16;
+constexpr uint64_t HOST_CALL_BYTES_PER_CYCLE = 64;
+
+enum class HostCallFunction : uint8_t {
+    CONSOLE_WRITE = 0x01, // buffer, length -> host console
+    FILE_READ = 0x02,     // name, offset, buffer, length -> length = bytes read
+    FILE_WRITE = 0x03,    // name, offset, buffer, length - creates the file, keeps the bytes past the written range
+    FILE_SIZE = 0x04,     // name -> offset = file size
+    TIME = 0x05,          // offset = seconds since 1970, length = milliseconds
+};
+
+enum class HostCallStatus : uint8_t {
+    OK = 0x00,
+    BAD_FUNCTION = 0x01,
+    BAD_PARAMETER = 0x02, // Unterminated or rejected file name, buffer past $FFFF
+    IO_ERROR = 0x03,      // File missing or not readable/writable
+};
+
+class HostCallDevice final : public Device {
+public:
+    // Files are looked up in directory, console output goes to console
+    HostCallDevice(DeviceBus& bus, std::string directory, std::ostream& console);
+
+    uint8_t readRegister(uint16_t offset) override;
+    void writeRegister(uint16_t offset, uint8_t data) override;
+    uint64_t takeStallCycles() override { const uint64_t stall = stallCycles; stallCycles = 0; return stall; }
+    // Status of the last call - a restore does not undo console output or file writes
+    size_t stateSize() const override { return sizeof(status); }
+    void saveState(uint8_t* out) const override { putState(out, status); }
+    void loadState(const uint8_t* in) override { getState(in, status); }
+
+    uint64_t getCalls() const { return calls; }
+    uint64_t getBytesTransferred() const { return bytesTransferred; }
+
+protected:
+    void advance(uint64_t, uint64_t) override {}
+
+private:
+    HostCallStatus call(uint8_t block);
+    // Guest memory page by page - straight to RAM, through the bus on pages where a device is mapped (like DmaCopy)
+    void copyToGuest(uint16_t addr, const uint8_t* data, uint32_t size);
+    void copyFromGuest(uint16_t addr, uint8_t* data, uint32_t size);
+    // Host path of the name at addr, empty if it is unterminated or leaves the directory
+    std::string fileName(uint16_t addr) const;
+
+    DeviceBus& bus;
+    std::string directory;
+    std::ostream& console;
+    uint8_t status = static_cast<uint8_t>(HostCallStatus::OK);
+    uint64_t stallCycles = 0;
+    bool inCall = false;
+    uint64_t calls = 0;
+    uint64_t bytesTransferred = 0;
+};
+
+// hostcall [dir] - a guest writes to the console, saves 4 KB to a file and loads it back through host calls
+int RunHostCallDemo(const std::string& directory);
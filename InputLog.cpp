@@ -0,0 +1,405 @@
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <random>
+
+#include "Assembler.h"
+#include "Cpu6502.h"
+#include "DeviceBus.h"
+#include "GuestBench.h"
+#include "InputLog.h"
+#include "StateHash.h"
+#include "Via.h"
+
+static const char LOG_MAGIC[8] = { '6', '5', '0', '2', 'R', 'E', 'C', '1' };
+
+enum : uint8_t {
+    EVENT_READ = 0,
+    EVENT_IRQ_LOW = 1,
+    EVENT_IRQ_HIGH = 2,
+    EVENT_BULK = 3,
+};
+
+InputLog::InputLog(Mode mode, uint64_t checkpointInterval)
+    : mode(mode), checkpointInterval(checkpointInterval == 0 ? 1 : checkpointInterval),
+      nextCheckpoint(this->checkpointInterval)
+{
+}
+
+void InputLog::appendVarint(uint64_t value)
+{
+    while (value >= 0x80) {
+        encoded.push_back(static_cast<uint8_t>(value | 0x80));
+        value >>= 7;
+    }
+    encoded.push_back(static_cast<uint8_t>(value));
+}
+
+void InputLog::recordRead(uint64_t cycle, uint16_t addr, uint8_t value)
+{
+    appendVarint((cycle - lastCycle) * 4 + EVENT_READ);
+    encoded.push_back(static_cast<uint8_t>(addr));
+    encoded.push_back(static_cast<uint8_t>(addr >> 8));
+    encoded.push_back(value);
+    lastCycle = cycle;
+}
+
+void InputLog::recordIrq(uint64_t cycle, bool level)
+{
+    appendVarint((cycle - lastCycle) * 4 + (level ? EVENT_IRQ_HIGH : EVENT_IRQ_LOW));
+    lastCycle = cycle;
+}
+
+void InputLog::recordBulk(uint64_t cycle, uint16_t addr, const uint8_t* data, uint32_t size)
+{
+    appendVarint((cycle - lastCycle) * 4 + EVENT_BULK);
+    encoded.push_back(static_cast<uint8_t>(addr));
+    encoded.push_back(static_cast<uint8_t>(addr >> 8));
+    appendVarint(size);
+    encoded.insert(encoded.end(), data, data + size);
+    lastCycle = cycle;
+}
+
+uint8_t InputLog::replayRead(uint64_t cycle, uint16_t addr)
+{
+    if (nextRead >= reads.size() || reads[nextRead].cycle != cycle || reads[nextRead].addr != addr) {
+        diverged = true;
+        return 0;
+    }
+    return reads[nextRead++].value;
+}
+
+const uint8_t* InputLog::replayBulk(uint64_t cycle, uint16_t addr, uint32_t& size)
+{
+    if (nextBulk >= bulks.size() || bulks[nextBulk].cycle != cycle || bulks[nextBulk].addr != addr) {
+        diverged = true;
+        return nullptr;
+    }
+    const BulkEvent& bulk = bulks[nextBulk++];
+    size = bulk.size;
+    return encoded.data() + bulk.offset;
+}
+
+bool InputLog::replayIrq(uint64_t cycle)
+{
+    while (nextIrq < irqs.size() && irqs[nextIrq].cycle <= cycle) {
+        irqLevel = irqs[nextIrq++].level;
+    }
+    return irqLevel;
+}
+
+uint64_t InputLog::nextReplayIrqCycle() const
+{
+    return nextIrq < irqs.size() ? irqs[nextIrq].cycle : ~0ull;
+}
+
+void InputLog::addCheckpoint(uint64_t cycle, uint64_t hash)
+{
+    // Replay compares against the recording as it goes, so divergence is flagged within one interval
+    if (mode == Mode::Replay) {
+        const size_t index = checkpoints.size();
+        if (index < recordedCheckpoints.size() &&
+            (recordedCheckpoints[index].cycle != cycle || recordedCheckpoints[index].hash != hash)) {
+            diverged = true;
+        }
+    }
+    checkpoints.push_back({ cycle, hash });
+    while (nextCheckpoint <= cycle) {
+        nextCheckpoint += checkpointInterval;
+    }
+}
+
+uint64_t InputLog::nextHookCycle() const
+{
+    return mode == Mode::Replay ? std::min(nextCheckpoint, nextReplayIrqCycle()) : nextCheckpoint;
+}
+
+void InputLog::runHook(const CpuState& cpu, DeviceBus& bus, const RunCounts&)
+{
+    if (cpu.totalCycles >= nextCheckpoint)
+        addCheckpoint(cpu.totalCycles, bus.hashState(HashCpuRegisters(cpu)));
+}
+
+static void WriteU64(std::ofstream& out, uint64_t value)
+{
+    uint8_t bytes[8];
+    for (int i = 0; i < 8; ++i)
+        bytes[i] = static_cast<uint8_t>(value >> (i * 8));
+    out.write(reinterpret_cast<const char*>(bytes), 8);
+}
+
+static bool ReadU64(std::ifstream& in, uint64_t& value)
+{
+    uint8_t bytes[8];
+    if (!in.read(reinterpret_cast<char*>(bytes), 8))
+        return false;
+    value = 0;
+    for (int i = 0; i < 8; ++i)
+        value |= static_cast<uint64_t>(bytes[i]) << (i * 8);
+    return true;
+}
+
+bool InputLog::save(const std::string& path) const
+{
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    if (!out) {
+        return false;
+    }
+    out.write(LOG_MAGIC, sizeof(LOG_MAGIC));
+    WriteU64(out, checkpointInterval);
+    WriteU64(out, encoded.size());
+    out.write(reinterpret_cast<const char*>(encoded.data()), static_cast<std::streamsize>(encoded.size()));
+    WriteU64(out, checkpoints.size());
+    for (const StateCheckpoint& c : checkpoints) {
+        WriteU64(out, c.cycle);
+        WriteU64(out, c.hash);
+    }
+    return static_cast<bool>(out);
+}
+
+bool InputLog::load(const std::string& path)
+{
+    std::ifstream in(path, std::ios::binary);
+    char magic[sizeof(LOG_MAGIC)];
+    uint64_t interval, size, count;
+    if (!in || !in.read(magic, sizeof(magic)) || !std::equal(magic, magic + sizeof(magic), LOG_MAGIC) ||
+        !ReadU64(in, interval) || !ReadU64(in, size)) {
+        return false;
+    }
+    encoded.resize(static_cast<size_t>(size));
+    if (!in.read(reinterpret_cast<char*>(encoded.data()), static_cast<std::streamsize>(size)) || !ReadU64(in, count)) {
+        return false;
+    }
+    recordedCheckpoints.clear();
+    for (uint64_t i = 0; i < count; ++i) {
+        StateCheckpoint c;
+        if (!ReadU64(in, c.cycle) || !ReadU64(in, c.hash))
+            return false;
+        recordedCheckpoints.push_back(c);
+    }
+
+    mode = Mode::Replay;
+    checkpointInterval = interval == 0 ? 1 : interval;
+    nextCheckpoint = checkpointInterval;
+    checkpoints.clear();
+    decode();
+    return true;
+}
+
+void InputLog::decode()
+{
+    reads.clear();
+    irqs.clear();
+    bulks.clear();
+    nextRead = nextIrq = nextBulk = 0;
+    irqLevel = diverged = false;
+
+    size_t pos = 0;
+    auto readVarint = [&] {
+        uint64_t value = 0;
+        for (unsigned shift = 0; pos < encoded.size() && shift < 64; shift += 7) {
+            const uint8_t b = encoded[pos++];
+            value |= static_cast<uint64_t>(b & 0x7F) << shift;
+            if ((b & 0x80) == 0)
+                break;
+        }
+        return value;
+    };
+
+    uint64_t cycle = 0;
+    while (pos < encoded.size()) {
+        const uint64_t value = readVarint();
+        cycle += value >> 2;
+        const uint8_t code = static_cast<uint8_t>(value & 3);
+        if (code == EVENT_READ) {
+            if (pos + 3 > encoded.size())
+                break;
+            const uint16_t addr = static_cast<uint16_t>(encoded[pos] | (encoded[pos + 1] << 8));
+            reads.push_back({ cycle, addr, encoded[pos + 2] });
+            pos += 3;
+        } else if (code == EVENT_BULK) {
+            if (pos + 2 > encoded.size())
+                break;
+            const uint16_t addr = static_cast<uint16_t>(encoded[pos] | (encoded[pos + 1] << 8));
+            pos += 2;
+            const uint64_t size = readVarint();
+            if (size > encoded.size() - pos)
+                break;
+            bulks.push_back({ cycle, addr, static_cast<uint32_t>(size), pos });
+            pos += static_cast<size_t>(size);
+        } else {
+            irqs.push_back({ cycle, code == EVENT_IRQ_HIGH });
+        }
+    }
+}
+
+long long FindFirstDivergence(const std::vector<StateCheckpoint>& a, const std::vector<StateCheckpoint>& b)
+{
+    auto same = [&](size_t i) { return a[i].cycle == b[i].cycle && a[i].hash == b[i].hash; };
+
+    const size_t count = std::min(a.size(), b.size());
+    if (count == 0 || same(count - 1)) {
+        return -1;
+    }
+    // Invariant: every checkpoint before lo matches, the one at hi does not
+    size_t lo = 0, hi = count - 1;
+    while (lo < hi) {
+        const size_t mid = lo + (hi - lo) / 2;
+        if (same(mid))
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    return static_cast<long long>(hi);
+}
+
+constexpr uint16_t NOISE = 0x6100;
+
+// Sums a host noise source into sum, the timer interrupt counts ticks and keeps the latest noise byte in last
+static const char* const REPLAY_SOURCE = R"(
+VIA     = $6000
+NOISE   = $6100
+PERIOD  = 997
+sum     = $00
+ticks   = $02
+last    = $04
+
+        .org $8000
+reset:  sei
+        ldx #$FF
+        txs
+        lda #0
+        sta sum
+        sta sum+1
+        sta ticks
+        sta ticks+1
+        lda #$40                ; T1 free-running, interrupt enabled
+        sta VIA+$B
+        lda #<PERIOD
+        sta VIA+4
+        lda #>PERIOD
+        sta VIA+5
+        lda #$C0
+        sta VIA+$E
+        cli
+
+loop:   lda NOISE
+        clc
+        adc sum
+        sta sum
+        bcc loop                ; The path taken depends on the input
+        inc sum+1
+        jmp loop
+
+irq:    pha
+        lda VIA+4
+        lda NOISE
+        sta last
+        inc ticks
+        bne done
+        inc ticks+1
+done:   pla
+nmi:    rti
+
+        .org $FFFA
+        .word nmi, reset, irq
+)";
+
+// Host input the guest cannot compute - a different seed on every machine
+class NoiseDevice final : public Device {
+public:
+    explicit NoiseDevice(uint32_t seed) : random(seed) {}
+
+    uint8_t readRegister(uint16_t) override { return static_cast<uint8_t>(random()); }
+    void writeRegister(uint16_t, uint8_t) override {}
+
+protected:
+    void advance(uint64_t, uint64_t) override {}
+
+private:
+    std::minstd_rand random;
+};
+
+int RunReplayDemo(uint64_t cycles, const std::string& path)
+{
+    AssembledProgram program;
+    std::string error;
+    if (!Assemble(REPLAY_SOURCE, program, error)) {
+        std::cerr << "replay: " << error << std::endl;
+        return 2;
+    }
+    const uint64_t interval = std::max<uint64_t>(cycles / 100, 1);
+
+    struct Run {
+        uint64_t hash = 0; // Machine state at the end
+        double seconds = 0;
+    };
+    // perturbAt - cycle to flip a bit of the guest's tick count at, 0 for none. Only INC changes it, so the
+    // difference stays.
+    auto run = [&](InputLog& log, uint32_t seed, uint64_t perturbAt) {
+        DeviceBus bus;
+        ViaDevice via;
+        NoiseDevice noise(seed);
+        bus.attach(&via, GUEST_VIA, 16);
+        bus.attach(&noise, NOISE, 1);
+        LoadProgram(bus, program);
+        Cpu6502 cpu(&bus);
+        cpu.reset();
+        bus.setInputLog(&log);
+
+        Run result;
+        const auto begin = std::chrono::steady_clock::now();
+        if (perturbAt != 0) {
+            RunSynced(cpu, bus, perturbAt);
+            const uint16_t ticks = program.symbols.at("ticks");
+            bus.getRam().write(ticks, bus.getRam().read(ticks) ^ 0x01);
+            bus.markDirty(ticks, 1);
+        }
+        RunSynced(cpu, bus, cycles);
+        result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+        result.hash = bus.hashState(HashCpuRegisters(cpu));
+        return result;
+    };
+
+    InputLog recording(InputLog::Mode::Record, interval);
+    const Run recorded = run(recording, 1, 0);
+    if (!recording.save(path)) {
+        std::cerr << "Failed to write " << path << std::endl;
+        return 2;
+    }
+    std::cout << "recorded " << cycles << " cycles: " << recording.encodedSize() << " byte(s) of input, "
+              << recording.getCheckpoints().size() << " checkpoint(s), " << cycles / recorded.seconds / 1e6 << " MHz\n";
+
+    // Replays the saved log, the noise source is seeded differently so only the log can reproduce the run.
+    // divergedAt - cycle of the first checkpoint that differs from the recording, 0 if none does.
+    auto replay = [&](uint64_t perturbAt, uint64_t& divergedAt) {
+        InputLog log;
+        if (!log.load(path))
+            return false;
+        const Run replayed = run(log, 2, perturbAt);
+        const std::vector<StateCheckpoint>& expected = log.getRecordedCheckpoints();
+        const std::vector<StateCheckpoint>& actual = log.getCheckpoints();
+        const long long index = FindFirstDivergence(expected, actual);
+        divergedAt = index >= 0 ? expected[static_cast<size_t>(index)].cycle : 0;
+        const bool same = index < 0 && expected.size() == actual.size() && !log.hasDiverged() && replayed.hash == recorded.hash;
+
+        std::cout << (perturbAt != 0 ? "perturbed replay: " : "replay: ") << cycles / replayed.seconds / 1e6 << " MHz, ";
+        if (divergedAt != 0)
+            std::cout << "diverged at checkpoint " << index << " (cycle " << divergedAt << ")\n";
+        else
+            std::cout << (same ? "matches\n" : "final state DIFFERS\n");
+        return same;
+    };
+
+    uint64_t divergedAt = 0;
+    const bool same = replay(0, divergedAt);
+    // The perturbation must be found at the first checkpoint after it, which is at most an interval and an
+    // instruction later
+    const uint64_t perturbAt = cycles / 2;
+    const bool caught = !replay(perturbAt, divergedAt) && divergedAt >= perturbAt && divergedAt < perturbAt + 2 * interval;
+    if (!caught)
+        std::cout << "perturbed replay NOT caught\n";
+    std::cout << std::flush;
+    return same && caught ? 0 : 1;
+}
@@ -0,0 +1,114 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "RunHook.h"
+
+// Deterministic record/replay. Everything the emulated machine cannot compute by itself - values read from
+// device registers, bulk input devices copy into RAM and the times the IRQ line changes level - is recorded into
+// a compact log. Replaying the log
+// against the same program reproduces the run bit-exactly without the devices' host-side inputs.
+//
+// Both modes also store a state hash every checkpointInterval cycles, so a diverging replay can be located by
+// bisecting the two checkpoint lists instead of comparing full traces. DeviceBus::setInputLog adds the log as a
+// hook, which takes the checkpoints.
+
+struct StateCheckpoint {
+    uint64_t cycle;
+    uint64_t hash;
+};
+
+class InputLog final : public RunHook {
+public:
+    enum class Mode { Record, Replay };
+
+    explicit InputLog(Mode mode = Mode::Record, uint64_t checkpointInterval = 1000000);
+
+    Mode getMode() const { return mode; }
+
+    // Recording
+    void recordRead(uint64_t cycle, uint16_t addr, uint8_t value);
+    void recordIrq(uint64_t cycle, bool level);
+    void recordBulk(uint64_t cycle, uint16_t addr, const uint8_t* data, uint32_t size);
+
+    // Replay - the value the device returned at this point of the recorded run
+    uint8_t replayRead(uint64_t cycle, uint16_t addr);
+    // Replay - the bytes a device copied to addr at this point of the recorded run, their count in size. Null, and
+    // diverged, if the recording has no such input here.
+    const uint8_t* replayBulk(uint64_t cycle, uint16_t addr, uint32_t& size);
+    // IRQ level at cycle according to the recording - IRQ changes are logged at the instruction boundary the CPU
+    // sampled them, so replay sees them at exactly the same point
+    bool replayIrq(uint64_t cycle);
+    // Cycle of the next recorded IRQ change, so idle loops are not skipped past it
+    uint64_t nextReplayIrqCycle() const;
+    // Set when the replayed run made a device read the recording does not have at that point
+    bool hasDiverged() const { return diverged; }
+
+    // Checkpoints
+    uint64_t nextCheckpointCycle() const { return nextCheckpoint; }
+    void addCheckpoint(uint64_t cycle, uint64_t hash);
+
+    // Due at the next checkpoint and, on replay, at the next recorded IRQ change so idle loops stop there
+    uint64_t nextHookCycle() const override;
+    void runHook(const CpuState& cpu, DeviceBus& bus, const RunCounts& counts) override;
+    const std::vector<StateCheckpoint>& getCheckpoints() const { return checkpoints; }
+
+    // File format: magic, checkpoint interval, encoded events, checkpoints
+    bool save(const std::string& path) const;
+    // Loads a recording and switches to replay - the recorded checkpoints are kept in recordedCheckpoints
+    bool load(const std::string& path);
+    const std::vector<StateCheckpoint>& getRecordedCheckpoints() const { return recordedCheckpoints; }
+
+    size_t encodedSize() const { return encoded.size(); }
+
+private:
+    struct ReadEvent {
+        uint64_t cycle;
+        uint16_t addr;
+        uint8_t value;
+    };
+    struct IrqEvent {
+        uint64_t cycle;
+        bool level;
+    };
+    struct BulkEvent {
+        uint64_t cycle;
+        uint16_t addr;
+        uint32_t size;
+        size_t offset; // Of the bytes in encoded
+    };
+
+    void appendVarint(uint64_t value);
+    void decode();
+
+    Mode mode;
+    uint64_t checkpointInterval;
+    uint64_t nextCheckpoint;
+
+    // Recording - events as varint(cycle delta * 4 + code), code 0 = read (followed by addr and value),
+    // 1 = IRQ released, 2 = IRQ asserted, 3 = bulk input (followed by addr, varint size and the bytes)
+    std::vector<uint8_t> encoded;
+    uint64_t lastCycle = 0;
+
+    // Replay - decoded once on load
+    std::vector<ReadEvent> reads;
+    std::vector<IrqEvent> irqs;
+    std::vector<BulkEvent> bulks;
+    size_t nextRead = 0;
+    size_t nextIrq = 0;
+    size_t nextBulk = 0;
+    bool irqLevel = false;
+    bool diverged = false;
+
+    std::vector<StateCheckpoint> checkpoints;
+    std::vector<StateCheckpoint> recordedCheckpoints;
+};
+
+// Index of the first checkpoint that differs between two runs, found by bisection (a run that diverged stays
+// diverged), or -1 if all common checkpoints match
+long long FindFirstDivergence(const std::vector<StateCheckpoint>& a, const std::vector<StateCheckpoint>& b);
+
+// replay [cycles] [log] - records a guest that reads a host noise source under timer interrupts, saves the log
+// to path, replays it on a machine whose noise differs and checks that every checkpoint and the final state
+// match. A replay with one RAM byte changed halfway must be caught. Exit code 1 if either check fails.
+int RunReplayDemo(uint64_t cycles, const std::string& path);
@@ -0,0 +1,129 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <tuple>
+#include <utility>
+#include "Bus.h"
+
+// Memory map composed at compile time from a list of regions. Decoding is a chain of constant comparisons
+// the compiler can see through - no virtual calls or tables past the Bus entry point - so a fixed board
+// (e.g. 2 KB RAM mirrored to $1FFF, registers at $2000, ROM at $8000) costs a few instructions per access:
+//
+//   using Board = MappedBus<Region<0x0000, 0x2000, 0x07FF, RamBacking<0x800>>,
+//                           Region<0x2000, 0x4000, 0x0007, PpuRegisters>,
+//                           Region<0x8000, 0x10000, 0x7FFF, RomBacking<0x8000>>>;
+//
+// A backing provides read(offset), write(offset, data) and a plainMemory constant (see Bus::isPlainMemory).
+// Device handlers are ordinary classes with the same three members, called without indirection.
+
+template <size_t Size>
+struct RamBacking {
+    static constexpr size_t SIZE = Size;
+    static constexpr bool plainMemory = true;
+
+    uint8_t read(uint16_t offset) const { return data[offset]; }
+    void write(uint16_t offset, uint8_t value) { data[offset] = value; }
+
+    std::array<uint8_t, Size> data{};
+};
+
+// Writes are ignored, the image is filled through data before the run
+template <size_t Size>
+struct RomBacking {
+    static constexpr size_t SIZE = Size;
+    static constexpr bool plainMemory = true;
+
+    uint8_t read(uint16_t offset) const { return data[offset]; }
+    void write(uint16_t, uint8_t) {}
+
+    std::array<uint8_t, Size> data{};
+};
+
+// [Begin, End) of the address space, mirrored onto the backing with MirrorMask. The offset into the backing is
+// (addr - Begin) & MirrorMask, so a region longer than MirrorMask + 1 wraps around and repeats the backing every
+// MirrorMask + 1 bytes when the mask is 2^n - 1 (2 KB RAM mirrored over $0000-$1FFF).
+template <uint32_t Begin, uint32_t End, uint16_t MirrorMask, typename Backing>
+struct Region {
+    static_assert(Begin < End && End <= 0x10000, "Region must be a non-empty part of the 64 KB address space");
+
+    static constexpr uint32_t BEGIN = Begin;
+    static constexpr uint32_t END = End;
+    static constexpr bool plainMemory = Backing::plainMemory;
+
+    static constexpr bool contains(uint16_t addr) { return addr >= Begin && addr < End; }
+    static constexpr uint16_t offset(uint16_t addr) { return static_cast<uint16_t>((addr - Begin) & MirrorMask); }
+
+    Backing backing;
+
+private:
+    // Backings with a SIZE are bounds checked, device handlers decode the offset themselves
+    static constexpr bool maskFitsBacking() {
+        if constexpr (requires { Backing::SIZE; })
+            return MirrorMask < Backing::SIZE;
+        else
+            return true;
+    }
+    static_assert(maskFitsBacking(), "MirrorMask must not reach past the end of the backing");
+};
+
+template <typename... Regions>
+class MappedBus final : public Bus {
+public:
+    static constexpr uint8_t OPEN_BUS = 0x00; // value of unmapped reads
+
+    uint8_t read(uint16_t addr) override { return decodeRead(addr, std::index_sequence_for<Regions...>{}); }
+    void write(uint16_t addr, uint8_t data) override { decodeWrite(addr, data, std::index_sequence_for<Regions...>{}); }
+    bool isPlainMemory(uint16_t addr) const override { return decodePlain(addr, std::index_sequence_for<Regions...>{}); }
+
+    // Backing of the I-th region, e.g. to load a ROM image or reach a device handler
+    template <size_t I>
+    auto& backing() { return std::get<I>(regions).backing; }
+    template <size_t I>
+    const auto& backing() const { return std::get<I>(regions).backing; }
+
+private:
+    using RegionList = std::tuple<Regions...>;
+
+    static constexpr bool overlapping()
+    {
+        constexpr std::array<uint32_t, sizeof...(Regions)> begins{ Regions::BEGIN... };
+        constexpr std::array<uint32_t, sizeof...(Regions)> ends{ Regions::END... };
+        for (size_t i = 0; i < begins.size(); ++i) {
+            for (size_t j = i + 1; j < begins.size(); ++j) {
+                if (begins[i] < ends[j] && begins[j] < ends[i])
+                    return true;
+            }
+        }
+        return false;
+    }
+    static_assert(!overlapping(), "MappedBus regions must not overlap");
+
+    // First matching region handles the access - the fold short-circuits like an if/else chain
+    template <size_t... I>
+    uint8_t decodeRead(uint16_t addr, std::index_sequence<I...>)
+    {
+        uint8_t value = OPEN_BUS;
+        ((std::tuple_element_t<I, RegionList>::contains(addr) &&
+          (value = std::get<I>(regions).backing.read(std::tuple_element_t<I, RegionList>::offset(addr)), true)) || ...);
+        return value;
+    }
+
+    template <size_t... I>
+    void decodeWrite(uint16_t addr, uint8_t data, std::index_sequence<I...>)
+    {
+        ((std::tuple_element_t<I, RegionList>::contains(addr) &&
+          (std::get<I>(regions).backing.write(std::tuple_element_t<I, RegionList>::offset(addr), data), true)) || ...);
+    }
+
+    template <size_t... I>
+    bool decodePlain(uint16_t addr, std::index_sequence<I...>) const
+    {
+        bool plain = false;
+        ((std::tuple_element_t<I, RegionList>::contains(addr) &&
+          (plain = std::tuple_element_t<I, RegionList>::plainMemory, true)) || ...);
+        return plain;
+    }
+
+    RegionList regions;
+};
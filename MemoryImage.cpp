@@ -0,0 +1,213 @@
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <iomanip>
+#include <string>
+
+#include "MemoryImage.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define MEMORY_IMAGE_SSE2 1
+#endif
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+static const char HEX_DIGITS[] = "0123456789ABCDEF";
+
+static unsigned CountTrailingZeros(uint32_t value)
+{
+#if defined(_MSC_VER)
+    unsigned long index;
+    _BitScanForward(&index, value);
+    return static_cast<unsigned>(index);
+#else
+    return static_cast<unsigned>(__builtin_ctz(value));
+#endif
+}
+
+bool DumpMemoryImage(const RAM& ram, const std::string& path)
+{
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    if (!out) {
+        return false;
+    }
+    out.write(reinterpret_cast<const char*>(ram.data()), RAM::SIZE);
+    return static_cast<bool>(out);
+}
+
+bool LoadMemoryImage(const std::string& path, std::vector<uint8_t>& image)
+{
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file) {
+        return false;
+    }
+    const std::streamsize size = file.tellg();
+    file.seekg(0);
+    image.resize(static_cast<size_t>(size));
+    return static_cast<bool>(file.read(reinterpret_cast<char*>(image.data()), size));
+}
+
+size_t FormatHexDump(const uint8_t* data, size_t size, uint32_t baseAddr, char* out)
+{
+    char* const start = out;
+
+    for (size_t line = 0; line + 16 <= size; line += 16) {
+        const uint32_t addr = static_cast<uint32_t>(baseAddr + line);
+        out[0] = HEX_DIGITS[(addr >> 12) & 0xF];
+        out[1] = HEX_DIGITS[(addr >> 8) & 0xF];
+        out[2] = HEX_DIGITS[(addr >> 4) & 0xF];
+        out[3] = HEX_DIGITS[addr & 0xF];
+        out[4] = ':';
+        out += 5;
+
+        // Two hex digits per byte, high nibble first
+        char pairs[32];
+#if MEMORY_IMAGE_SSE2
+        const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + line));
+        const __m128i nibbleMask = _mm_set1_epi8(0x0F);
+        const __m128i high = _mm_and_si128(_mm_srli_epi16(bytes, 4), nibbleMask);
+        const __m128i low = _mm_and_si128(bytes, nibbleMask);
+
+        // '0' + n, plus the gap to 'A' for n > 9
+        auto toHex = [](__m128i n) {
+            const __m128i letter = _mm_cmpgt_epi8(n, _mm_set1_epi8(9));
+            return _mm_add_epi8(_mm_add_epi8(n, _mm_set1_epi8('0')), _mm_and_si128(letter, _mm_set1_epi8('A' - '0' - 10)));
+        };
+        const __m128i highChars = toHex(high);
+        const __m128i lowChars = toHex(low);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(pairs), _mm_unpacklo_epi8(highChars, lowChars));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(pairs + 16), _mm_unpackhi_epi8(highChars, lowChars));
+#else
+        for (size_t i = 0; i < 16; ++i) {
+            pairs[i * 2] = HEX_DIGITS[data[line + i] >> 4];
+            pairs[i * 2 + 1] = HEX_DIGITS[data[line + i] & 0xF];
+        }
+#endif
+        for (size_t i = 0; i < 16; ++i) {
+            out[0] = ' ';
+            out[1] = pairs[i * 2];
+            out[2] = pairs[i * 2 + 1];
+            out += 3;
+        }
+        *out++ = '\n';
+    }
+    return static_cast<size_t>(out - start);
+}
+
+// Appends the runs of set bits in mask (bit n = byte base + n differs), merging with the last range
+static void AppendChangedRuns(std::vector<MemoryRange>& ranges, uint32_t base, uint32_t mask)
+{
+    while (mask != 0) {
+        const unsigned first = CountTrailingZeros(mask);
+        const uint32_t rest = ~(mask >> first);
+        const unsigned length = rest == 0 ? 32 - first : CountTrailingZeros(rest);
+
+        const uint32_t begin = base + first;
+        const uint32_t end = begin + length;
+        if (!ranges.empty() && ranges.back().end == begin) {
+            ranges.back().end = end;
+        } else {
+            ranges.push_back({ begin, end });
+        }
+
+        if (first + length >= 32) {
+            break;
+        }
+        mask &= ~(((1u << length) - 1) << first);
+    }
+}
+
+std::vector<MemoryRange> DiffMemoryImages(const uint8_t* a, const uint8_t* b, size_t size)
+{
+    std::vector<MemoryRange> ranges;
+    size_t i = 0;
+
+#if MEMORY_IMAGE_SSE2
+    // 64 bytes per iteration, the common all-equal case costs four compares and one movemask
+    for (; i + 64 <= size; i += 64) {
+        __m128i eq[4];
+        for (int k = 0; k < 4; ++k) {
+            eq[k] = _mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i + k * 16)),
+                                   _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + i + k * 16)));
+        }
+        const __m128i all = _mm_and_si128(_mm_and_si128(eq[0], eq[1]), _mm_and_si128(eq[2], eq[3]));
+        if (_mm_movemask_epi8(all) == 0xFFFF) {
+            continue;
+        }
+        for (int k = 0; k < 4; k += 2) {
+            const uint32_t mask = static_cast<uint32_t>(_mm_movemask_epi8(eq[k])) |
+                                  (static_cast<uint32_t>(_mm_movemask_epi8(eq[k + 1])) << 16);
+            AppendChangedRuns(ranges, static_cast<uint32_t>(i + k * 16), ~mask);
+        }
+    }
+#else
+    // Eight bytes per iteration
+    for (; i + 8 <= size; i += 8) {
+        uint64_t wordA, wordB;
+        std::memcpy(&wordA, a + i, 8);
+        std::memcpy(&wordB, b + i, 8);
+        if (wordA == wordB) {
+            continue;
+        }
+        uint32_t mask = 0;
+        for (unsigned k = 0; k < 8; ++k) {
+            if (a[i + k] != b[i + k])
+                mask |= 1u << k;
+        }
+        AppendChangedRuns(ranges, static_cast<uint32_t>(i), mask);
+    }
+#endif
+
+    for (; i < size; ++i) {
+        if (a[i] != b[i]) {
+            AppendChangedRuns(ranges, static_cast<uint32_t>(i), 1);
+        }
+    }
+    return ranges;
+}
+
+int RunMemHex(const std::string& path)
+{
+    std::vector<uint8_t> image;
+    if (!LoadMemoryImage(path, image) || image.size() % 16 != 0) {
+        std::cerr << "Failed to load " << path << " (size must be a multiple of 16)" << std::endl;
+        return 2;
+    }
+
+    std::vector<char> text(image.size() / 16 * HEX_DUMP_LINE_SIZE);
+    const size_t length = FormatHexDump(image.data(), image.size(), 0, text.data());
+    std::fwrite(text.data(), 1, length, stdout);
+    return 0;
+}
+
+int RunMemDiff(const std::string& pathA, const std::string& pathB)
+{
+    std::vector<uint8_t> imageA, imageB;
+    if (!LoadMemoryImage(pathA, imageA) || !LoadMemoryImage(pathB, imageB)) {
+        std::cerr << "Failed to load memory images" << std::endl;
+        return 2;
+    }
+    if (imageA.size() != imageB.size()) {
+        std::cerr << "Image sizes differ: " << imageA.size() << " / " << imageB.size() << std::endl;
+        return 2;
+    }
+
+    const std::vector<MemoryRange> ranges = DiffMemoryImages(imageA.data(), imageB.data(), imageA.size());
+
+    size_t changedBytes = 0;
+    std::cout << std::hex << std::uppercase << std::setfill('0');
+    for (const MemoryRange& r : ranges) {
+        std::cout << std::setw(4) << r.begin << "-" << std::setw(4) << (r.end - 1) << ":";
+        for (uint32_t addr = r.begin; addr < r.end && addr < r.begin + 16; ++addr) {
+            std::cout << " " << std::setw(2) << static_cast<unsigned>(imageA[addr]) << ">" << std::setw(2) << static_cast<unsigned>(imageB[addr]);
+        }
+        std::cout << (r.end - r.begin > 16 ? " ...\n" : "\n");
+        changedBytes += r.end - r.begin;
+    }
+    std::cout << std::dec << ranges.size() << " range(s), " << changedBytes << " byte(s) changed" << std::endl;
+    return ranges.empty() ? 0 : 1;
+}
@@ -0,0 +1,31 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "Ram.h"
+
+// Memory images - raw 64 KB dumps of RAM, a hex formatter and a diff that reports changed ranges.
+
+struct MemoryRange {
+    uint32_t begin; // first changed address
+    uint32_t end;   // one past the last changed address
+};
+
+// Bytes FormatHexDump writes per 16 byte line - "XXXX:" followed by 16 " HH" and a newline
+constexpr size_t HEX_DUMP_LINE_SIZE = 5 + 16 * 3 + 1;
+
+// Raw binary dump straight from the backing storage
+bool DumpMemoryImage(const RAM& ram, const std::string& path);
+bool LoadMemoryImage(const std::string& path, std::vector<uint8_t>& image);
+
+// Formats size bytes (a multiple of 16) as hex lines in the DumpMemoryToLog layout, starting at baseAddr.
+// out must hold size / 16 * HEX_DUMP_LINE_SIZE bytes. Returns the number of bytes written.
+size_t FormatHexDump(const uint8_t* data, size_t size, uint32_t baseAddr, char* out);
+
+// Changed ranges between two images of the same size, in ascending order, adjacent changes merged
+std::vector<MemoryRange> DiffMemoryImages(const uint8_t* a, const uint8_t* b, size_t size);
+
+// Command line front ends - hex dump of an image, and changed ranges between two images
+int RunMemHex(const std::string& path);
+int RunMemDiff(const std::string& pathA, const std::string& pathB);
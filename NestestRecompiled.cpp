@@ -0,0 +1,15809 @@
+// Generated by the static recompiler (Recompiler.h) - 4649 instruction(s) in 890 block(s),
+// translated from a 16384 byte image at $C000. Regenerate instead of editing.
+#include <iterator>
+#include "Recompiled.h"
+
+using Cpu = Cpu2A03;
+using Context = RecompiledContext<Cpu>;
+
+static void Block_C000(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    // C000  JMP $C5F5
+    RecompiledBegin(ctx, 0xC000); cpu.totalCycles += 3; cpu.PC = 0xC5F5; return;
+}
+
+static void Block_C004(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    // C004  SEI
+    RecompiledBegin(ctx, 0xC004); SetFlag(cpu, Flags::I, true); cpu.totalCycles += 2;
+    // C005  CLD
+    RecompiledBegin(ctx, 0xC005); SetFlag(cpu, Flags::D, false); cpu.totalCycles += 2;
+    // C006  LDX #$FF
+    RecompiledBegin(ctx, 0xC006); cpu.X = 0xFF; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // C008  TXS
+    RecompiledBegin(ctx, 0xC008); cpu.SP = cpu.X; cpu.totalCycles += 2;
+    cpu.PC = 0xC009;
+}
+
+static void Block_C009(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // C009  LDA $2002
+    RecompiledBegin(ctx, 0xC009); cpu.A = bus.read(0x2002); SetNZ(cpu, cpu.A); cpu.totalCycles += 4;
+    // C00C  BPL $C009
+    RecompiledBegin(ctx, 0xC00C); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xC009; return; }
+    cpu.PC = 0xC00E;
+}
+
+static void Block_C00E(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // C00E  LDA $2002
+    RecompiledBegin(ctx, 0xC00E); cpu.A = bus.read(0x2002); SetNZ(cpu, cpu.A); cpu.totalCycles += 4;
+    // C011  BPL $C00E
+    RecompiledBegin(ctx, 0xC011); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xC00E; return; }
+    // C013  LDA #$00
+    RecompiledBegin(ctx, 0xC013); cpu.A = 0x00; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // C015  STA $2000
+    RecompiledBegin(ctx, 0xC015); bus.write(0x2000, cpu.A); cpu.totalCycles += 4;
+    // C018  STA $2001
+    RecompiledBegin(ctx, 0xC018); bus.write(0x2001, cpu.A); cpu.totalCycles += 4;
+    // C01B  STA $2005
+    RecompiledBegin(ctx, 0xC01B); bus.write(0x2005, cpu.A); cpu.totalCycles += 4;
+    // C01E  STA $2005
+    RecompiledBegin(ctx, 0xC01E); bus.write(0x2005, cpu.A); cpu.totalCycles += 4;
+    // C021  LDA $2002
+    RecompiledBegin(ctx, 0xC021); cpu.A = bus.read(0x2002); SetNZ(cpu, cpu.A); cpu.totalCycles += 4;
+    // C024  LDX #$20
+    RecompiledBegin(ctx, 0xC024); cpu.X = 0x20; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // C026  STX $2006
+    RecompiledBegin(ctx, 0xC026); bus.write(0x2006, cpu.X); cpu.totalCycles += 4;
+    // C029  LDX #$00
+    RecompiledBegin(ctx, 0xC029); cpu.X = 0x00; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // C02B  STX $2006
+    RecompiledBegin(ctx, 0xC02B); bus.write(0x2006, cpu.X); cpu.totalCycles += 4;
+    // C02E  LDX #$00
+    RecompiledBegin(ctx, 0xC02E); cpu.X = 0x00; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // C030  LDY #$0F
+    RecompiledBegin(ctx, 0xC030); cpu.Y = 0x0F; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // C032  LDA #$00
+    RecompiledBegin(ctx, 0xC032); cpu.A = 0x00; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    cpu.PC = 0xC034;
+}
+
+static void Block_C034(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // C034  STA $2007
+    RecompiledBegin(ctx, 0xC034); bus.write(0x2007, cpu.A); cpu.totalCycles += 4;
+    // C037  DEX
+    RecompiledBegin(ctx, 0xC037); cpu.X--; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // C038  BNE $C034
+    RecompiledBegin(ctx, 0xC038); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xC034; return; }
+    // C03A  DEY
+    RecompiledBegin(ctx, 0xC03A); cpu.Y--; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // C03B  BNE $C034
+    RecompiledBegin(ctx, 0xC03B); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xC034; return; }
+    // C03D  LDA #$3F
+    RecompiledBegin(ctx, 0xC03D); cpu.A = 0x3F; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // C03F  STA $2006
+    RecompiledBegin(ctx, 0xC03F); bus.write(0x2006, cpu.A); cpu.totalCycles += 4;
+    // C042  LDA #$00
+    RecompiledBegin(ctx, 0xC042); cpu.A = 0x00; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // C044  STA $2006
+    RecompiledBegin(ctx, 0xC044); bus.write(0x2006, cpu.A); cpu.totalCycles += 4;
+    // C047  LDX #$00
+    RecompiledBegin(ctx, 0xC047); cpu.X = 0x00; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    cpu.PC = 0xC049;
+}
+
+static void Block_C049(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // C049  LDA $FF78,X
+    { RecompiledBegin(ctx, 0xC049); const memAddress ea = static_cast<memAddress>(0xFF78 + cpu.X); cpu.A = bus.read(ea); SetNZ(cpu, cpu.A); cpu.totalCycles += 4 + (((ea & 0xFF00) != 0xFF00) ? 1 : 0); }
+    // C04C  STA $2007
+    RecompiledBegin(ctx, 0xC04C); bus.write(0x2007, cpu.A); cpu.totalCycles += 4;
+    // C04F  INX
+    RecompiledBegin(ctx, 0xC04F); cpu.X++; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // C050  CPX #$20
+    RecompiledBegin(ctx, 0xC050); Compare(cpu, cpu.X, 0x20); cpu.totalCycles += 2;
+    // C052  BNE $C049
+    RecompiledBegin(ctx, 0xC052); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xC049; return; }
+    // C054  LDA #$C0
+    RecompiledBegin(ctx, 0xC054); cpu.A = 0xC0; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // C056  STA $4017
+    RecompiledBegin(ctx, 0xC056); bus.write(0x4017, cpu.A); cpu.totalCycles += 4;
+    // C059  LDA #$00
+    RecompiledBegin(ctx, 0xC059); cpu.A = 0x00; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // C05B  STA $4015
+    RecompiledBegin(ctx, 0xC05B); bus.write(0x4015, cpu.A); cpu.totalCycles += 4;
+    // C05E  LDA #$78
+    RecompiledBegin(ctx, 0xC05E); cpu.A = 0x78; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // C060  STA $D0
+    RecompiledBegin(ctx, 0xC060); bus.write(0x00D0, cpu.A); cpu.totalCycles += 3;
+    // C062  LDA #$FB
+    RecompiledBegin(ctx, 0xC062); cpu.A = 0xFB; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // C064  STA $D1
+    RecompiledBegin(ctx, 0xC064); bus.write(0x00D1, cpu.A); cpu.totalCycles += 3;
+    // C066  LDA #$7F
+    RecompiledBegin(ctx, 0xC066); cpu.A = 0x7F; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // C068  STA $D3
+    RecompiledBegin(ctx, 0xC068); bus.write(0x00D3, cpu.A); cpu.totalCycles += 3;
+    // C06A  LDY #$00
+    RecompiledBegin(ctx, 0xC06A); cpu.Y = 0x00; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // C06C  STY $2006
+    RecompiledBegin(ctx, 0xC06C); bus.write(0x2006, cpu.Y); cpu.totalCycles += 4;
+    // C06F  STY $2006
+    RecompiledBegin(ctx, 0xC06F); bus.write(0x2006, cpu.Y); cpu.totalCycles += 4;
+    cpu.PC = 0xC072;
+}
+
+static void Block_C072(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // C072  LDA #$00
+    RecompiledBegin(ctx, 0xC072); cpu.A = 0x00; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // C074  STA $D7
+    RecompiledBegin(ctx, 0xC074); bus.write(0x00D7, cpu.A); cpu.totalCycles += 3;
+    // C076  LDA #$07
+    RecompiledBegin(ctx, 0xC076); cpu.A = 0x07; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // C078  STA $D0
+    RecompiledBegin(ctx, 0xC078); bus.write(0x00D0, cpu.A); cpu.totalCycles += 3;
+    // C07A  LDA #$C3
+    RecompiledBegin(ctx, 0xC07A); cpu.A = 0xC3; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // C07C  STA $D1
+    RecompiledBegin(ctx, 0xC07C); bus.write(0x00D1, cpu.A); cpu.totalCycles += 3;
+    // C07E  JSR $C2A7
+    RecompiledBegin(ctx, 0xC07E); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xC0); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x80); cpu.totalCycles += 6; cpu.PC = 0xC2A7; return;
+}
+
+static void Block_C081(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // C081  JSR $C28D
+    RecompiledBegin(ctx, 0xC081); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xC0); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x83); cpu.totalCycles += 6; cpu.PC = 0xC28D; return;
+}
+
+static void Block_C084(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // C084  LDX #$12
+    RecompiledBegin(ctx, 0xC084); cpu.X = 0x12; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // C086  JSR $C261
+    RecompiledBegin(ctx, 0xC086); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xC0); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x88); cpu.totalCycles += 6; cpu.PC = 0xC261; return;
+}
+
+static void Block_C089(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // C089  LDA $D5
+    RecompiledBegin(ctx, 0xC089); cpu.A = bus.read(0x00D5); SetNZ(cpu, cpu.A); cpu.totalCycles += 3;
+    // C08B  LSR
+    RecompiledBegin(ctx, 0xC08B); cpu.A = ShiftRight(cpu, cpu.A); cpu.totalCycles += 2;
+    // C08C  LSR
+    RecompiledBegin(ctx, 0xC08C); cpu.A = ShiftRight(cpu, cpu.A); cpu.totalCycles += 2;
+    // C08D  LSR
+    RecompiledBegin(ctx, 0xC08D); cpu.A = ShiftRight(cpu, cpu.A); cpu.totalCycles += 2;
+    // C08E  BCS $C0AC
+    RecompiledBegin(ctx, 0xC08E); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xC0AC; return; }
+    // C090  LSR
+    RecompiledBegin(ctx, 0xC090); cpu.A = ShiftRight(cpu, cpu.A); cpu.totalCycles += 2;
+    // C091  BCS $C09F
+    RecompiledBegin(ctx, 0xC091); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xC09F; return; }
+    // C093  LSR
+    RecompiledBegin(ctx, 0xC093); cpu.A = ShiftRight(cpu, cpu.A); cpu.totalCycles += 2;
+    // C094  BCS $C0BD
+    RecompiledBegin(ctx, 0xC094); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xC0BD; return; }
+    // C096  LSR
+    RecompiledBegin(ctx, 0xC096); cpu.A = ShiftRight(cpu, cpu.A); cpu.totalCycles += 2;
+    // C097  BCS $C09C
+    RecompiledBegin(ctx, 0xC097); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xC09C; return; }
+    // C099  JMP $C081
+    RecompiledBegin(ctx, 0xC099); cpu.totalCycles += 3; cpu.PC = 0xC081; return;
+}
+
+static void Block_C09C(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    // C09C  JMP $C126
+    RecompiledBegin(ctx, 0xC09C); cpu.totalCycles += 3; cpu.PC = 0xC126; return;
+}
+
+static void Block_C09F(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // C09F  JSR $C66F
+    RecompiledBegin(ctx, 0xC09F); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xC0); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xA1); cpu.totalCycles += 6; cpu.PC = 0xC66F; return;
+}
+
+static void Block_C0A2(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // C0A2  DEC $D7
+    { RecompiledBegin(ctx, 0xC0A2); const byte result = static_cast<byte>(bus.read(0x00D7) - 1); bus.write(0x00D7, result); SetNZ(cpu, result); cpu.totalCycles += 5; }
+    // C0A4  BPL $C081
+    RecompiledBegin(ctx, 0xC0A4); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xC081; return; }
+    // C0A6  LDA #$0D
+    RecompiledBegin(ctx, 0xC0A6); cpu.A = 0x0D; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // C0A8  STA $D7
+    RecompiledBegin(ctx, 0xC0A8); bus.write(0x00D7, cpu.A); cpu.totalCycles += 3;
+    // C0AA  BNE $C081
+    RecompiledBegin(ctx, 0xC0AA); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xC081; return; }
+    cpu.PC = 0xC0AC;
+}
+
+static void Block_C0AC(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // C0AC  JSR $C66F
+    RecompiledBegin(ctx, 0xC0AC); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xC0); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xAE); cpu.totalCycles += 6; cpu.PC = 0xC66F; return;
+}
+
+static void Block_C0AF(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // C0AF  INC $D7
+    { RecompiledBegin(ctx, 0xC0AF); const byte result = static_cast<byte>(bus.read(0x00D7) + 1); bus.write(0x00D7, result); SetNZ(cpu, result); cpu.totalCycles += 5; }
+    // C0B1  LDA $D7
+    RecompiledBegin(ctx, 0xC0B1); cpu.A = bus.read(0x00D7); SetNZ(cpu, cpu.A); cpu.totalCycles += 3;
+    // C0B3  CMP #$0E
+    RecompiledBegin(ctx, 0xC0B3); Compare(cpu, cpu.A, 0x0E); cpu.totalCycles += 2;
+    // C0B5  BCC $C081
+    RecompiledBegin(ctx, 0xC0B5); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xC081; return; }
+    // C0B7  LDA #$00
+    RecompiledBegin(ctx, 0xC0B7); cpu.A = 0x00; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // C0B9  STA $D7
+    RecompiledBegin(ctx, 0xC0B9); bus.write(0x00D7, cpu.A); cpu.totalCycles += 3;
+    // C0BB  BEQ $C081
+    RecompiledBegin(ctx, 0xC0BB); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xC081; return; }
+    cpu.PC = 0xC0BD;
+}
+
+static void Block_C0BD(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // C0BD  JSR $C689
+    RecompiledBegin(ctx, 0xC0BD); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xC0); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xBF); cpu.totalCycles += 6; cpu.PC = 0xC689; return;
+}
+
+static void Block_C0C0(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // C0C0  LDA $D7
+    RecompiledBegin(ctx, 0xC0C0); cpu.A = bus.read(0x00D7); SetNZ(cpu, cpu.A); cpu.totalCycles += 3;
+    // C0C2  BEQ $C0CA
+    RecompiledBegin(ctx, 0xC0C2); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xC0CA; return; }
+    // C0C4  JSR $C0ED
+    RecompiledBegin(ctx, 0xC0C4); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xC0); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xC6); cpu.totalCycles += 6; cpu.PC = 0xC0ED; return;
+}
+
+static void Block_C0C7(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    // C0C7  JMP $C081
+    RecompiledBegin(ctx, 0xC0C7); cpu.totalCycles += 3; cpu.PC = 0xC081; return;
+}
+
+static void Block_C0CA(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // C0CA  LDA #$00
+    RecompiledBegin(ctx, 0xC0CA); cpu.A = 0x00; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // C0CC  STA $D8
+    RecompiledBegin(ctx, 0xC0CC); bus.write(0x00D8, cpu.A); cpu.totalCycles += 3;
+    // C0CE  INC $D7
+    { RecompiledBegin(ctx, 0xC0CE); const byte result = static_cast<byte>(bus.read(0x00D7) + 1); bus.write(0x00D7, result); SetNZ(cpu, result); cpu.totalCycles += 5; }
+    cpu.PC = 0xC0D0;
+}
+
+static void Block_C0D0(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // C0D0  JSR $C0ED
+    RecompiledBegin(ctx, 0xC0D0); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xC0); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD2); cpu.totalCycles += 6; cpu.PC = 0xC0ED; return;
+}
+
+static void Block_C0D3(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // C0D3  INC $D7
+    { RecompiledBegin(ctx, 0xC0D3); const byte result = static_cast<byte>(bus.read(0x00D7) + 1); bus.write(0x00D7, result); SetNZ(cpu, result); cpu.totalCycles += 5; }
+    // C0D5  LDA $D7
+    RecompiledBegin(ctx, 0xC0D5); cpu.A = bus.read(0x00D7); SetNZ(cpu, cpu.A); cpu.totalCycles += 3;
+    // C0D7  CMP #$0E
+    RecompiledBegin(ctx, 0xC0D7); Compare(cpu, cpu.A, 0x0E); cpu.totalCycles += 2;
+    // C0D9  BNE $C0D0
+    RecompiledBegin(ctx, 0xC0D9); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xC0D0; return; }
+    // C0DB  LDA #$00
+    RecompiledBegin(ctx, 0xC0DB); cpu.A = 0x00; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // C0DD  STA $D7
+    RecompiledBegin(ctx, 0xC0DD); bus.write(0x00D7, cpu.A); cpu.totalCycles += 3;
+    // C0DF  LDA $D8
+    RecompiledBegin(ctx, 0xC0DF); cpu.A = bus.read(0x00D8); SetNZ(cpu, cpu.A); cpu.totalCycles += 3;
+    // C0E1  BEQ $C0E5
+    RecompiledBegin(ctx, 0xC0E1); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xC0E5; return; }
+    // C0E3  LDA #$FF
+    RecompiledBegin(ctx, 0xC0E3); cpu.A = 0xFF; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    cpu.PC = 0xC0E5;
+}
+
+static void Block_C0E5(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // C0E5  STA $00
+    RecompiledBegin(ctx, 0xC0E5); bus.write(0x0000, cpu.A); cpu.totalCycles += 3;
+    // C0E7  JSR $C1ED
+    RecompiledBegin(ctx, 0xC0E7); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xC0); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xE9); cpu.totalCycles += 6; cpu.PC = 0xC1ED; return;
+}
+
+static void Block_C0EA(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    // C0EA  JMP $C081
+    RecompiledBegin(ctx, 0xC0EA); cpu.totalCycles += 3; cpu.PC = 0xC081; return;
+}
+
+static void Block_C0ED(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // C0ED  LDA $D7
+    RecompiledBegin(ctx, 0xC0ED); cpu.A = bus.read(0x00D7); SetNZ(cpu, cpu.A); cpu.totalCycles += 3;
+    // C0EF  ASL
+    RecompiledBegin(ctx, 0xC0EF); cpu.A = ShiftLeft(cpu, cpu.A); cpu.totalCycles += 2;
+    // C0F0  TAX
+    RecompiledBegin(ctx, 0xC0F0); cpu.X = cpu.A; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // C0F1  LDA $C10A,X
+    { RecompiledBegin(ctx, 0xC0F1); const memAddress ea = static_cast<memAddress>(0xC10A + cpu.X); cpu.A = bus.read(ea); SetNZ(cpu, cpu.A); cpu.totalCycles += 4 + (((ea & 0xFF00) != 0xC100) ? 1 : 0); }
+    // C0F4  STA $0200
+    RecompiledBegin(ctx, 0xC0F4); bus.write(0x0200, cpu.A); cpu.totalCycles += 4;
+    // C0F7  LDA $C10B,X
+    { RecompiledBegin(ctx, 0xC0F7); const memAddress ea = static_cast<memAddress>(0xC10B + cpu.X); cpu.A = bus.read(ea); SetNZ(cpu, cpu.A); cpu.totalCycles += 4 + (((ea & 0xFF00) != 0xC100) ? 1 : 0); }
+    // C0FA  STA $0201
+    RecompiledBegin(ctx, 0xC0FA); bus.write(0x0201, cpu.A); cpu.totalCycles += 4;
+    // C0FD  LDA #$C1
+    RecompiledBegin(ctx, 0xC0FD); cpu.A = 0xC1; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // C0FF  PHA
+    RecompiledBegin(ctx, 0xC0FF); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), cpu.A); cpu.totalCycles += 3;
+    // C100  LDA #$DE
+    RecompiledBegin(ctx, 0xC100); cpu.A = 0xDE; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // C102  PHA
+    RecompiledBegin(ctx, 0xC102); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), cpu.A); cpu.totalCycles += 3;
+    // C103  LDA #$00
+    RecompiledBegin(ctx, 0xC103); cpu.A = 0x00; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // C105  STA $00
+    RecompiledBegin(ctx, 0xC105); bus.write(0x0000, cpu.A); cpu.totalCycles += 3;
+    // C107  JMP ($0200)
+    RecompiledBegin(ctx, 0xC107); cpu.totalCycles += 5; cpu.PC = RecompiledWord(bus.read(0x0200), bus.read(0x0201)); return;
+}
+
+static void Block_C126(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // C126  LDA #$00
+    RecompiledBegin(ctx, 0xC126); cpu.A = 0x00; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // C128  STA $D7
+    RecompiledBegin(ctx, 0xC128); bus.write(0x00D7, cpu.A); cpu.totalCycles += 3;
+    // C12A  LDA #$92
+    RecompiledBegin(ctx, 0xC12A); cpu.A = 0x92; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // C12C  STA $D0
+    RecompiledBegin(ctx, 0xC12C); bus.write(0x00D0, cpu.A); cpu.totalCycles += 3;
+    // C12E  LDA #$C4
+    RecompiledBegin(ctx, 0xC12E); cpu.A = 0xC4; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // C130  STA $D1
+    RecompiledBegin(ctx, 0xC130); bus.write(0x00D1, cpu.A); cpu.totalCycles += 3;
+    // C132  JSR $C2A7
+    RecompiledBegin(ctx, 0xC132); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xC1); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x34); cpu.totalCycles += 6; cpu.PC = 0xC2A7; return;
+}
+
+static void Block_C135(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // C135  JSR $C28D
+    RecompiledBegin(ctx, 0xC135); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xC1); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x37); cpu.totalCycles += 6; cpu.PC = 0xC28D; return;
+}
+
+static void Block_C138(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // C138  LDX #$0F
+    RecompiledBegin(ctx, 0xC138); cpu.X = 0x0F; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // C13A  JSR $C261
+    RecompiledBegin(ctx, 0xC13A); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xC1); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x3C); cpu.totalCycles += 6; cpu.PC = 0xC261; return;
+}
+
+static void Block_C13D(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // C13D  LDA $D5
+    RecompiledBegin(ctx, 0xC13D); cpu.A = bus.read(0x00D5); SetNZ(cpu, cpu.A); cpu.totalCycles += 3;
+    // C13F  LSR
+    RecompiledBegin(ctx, 0xC13F); cpu.A = ShiftRight(cpu, cpu.A); cpu.totalCycles += 2;
+    // C140  LSR
+    RecompiledBegin(ctx, 0xC140); cpu.A = ShiftRight(cpu, cpu.A); cpu.totalCycles += 2;
+    // C141  LSR
+    RecompiledBegin(ctx, 0xC141); cpu.A = ShiftRight(cpu, cpu.A); cpu.totalCycles += 2;
+    // C142  BCS $C160
+    RecompiledBegin(ctx, 0xC142); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xC160; return; }
+    // C144  LSR
+    RecompiledBegin(ctx, 0xC144); cpu.A = ShiftRight(cpu, cpu.A); cpu.totalCycles += 2;
+    // C145  BCS $C153
+    RecompiledBegin(ctx, 0xC145); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xC153; return; }
+    // C147  LSR
+    RecompiledBegin(ctx, 0xC147); cpu.A = ShiftRight(cpu, cpu.A); cpu.totalCycles += 2;
+    // C148  BCS $C171
+    RecompiledBegin(ctx, 0xC148); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xC171; return; }
+    // C14A  LSR
+    RecompiledBegin(ctx, 0xC14A); cpu.A = ShiftRight(cpu, cpu.A); cpu.totalCycles += 2;
+    // C14B  BCS $C150
+    RecompiledBegin(ctx, 0xC14B); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xC150; return; }
+    // C14D  JMP $C135
+    RecompiledBegin(ctx, 0xC14D); cpu.totalCycles += 3; cpu.PC = 0xC135; return;
+}
+
+static void Block_C150(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    // C150  JMP $C072
+    RecompiledBegin(ctx, 0xC150); cpu.totalCycles += 3; cpu.PC = 0xC072; return;
+}
+
+static void Block_C153(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // C153  JSR $C66F
+    RecompiledBegin(ctx, 0xC153); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xC1); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x55); cpu.totalCycles += 6; cpu.PC = 0xC66F; return;
+}
+
+static void Block_C156(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // C156  DEC $D7
+    { RecompiledBegin(ctx, 0xC156); const byte result = static_cast<byte>(bus.read(0x00D7) - 1); bus.write(0x00D7, result); SetNZ(cpu, result); cpu.totalCycles += 5; }
+    // C158  BPL $C135
+    RecompiledBegin(ctx, 0xC158); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xC135; return; }
+    // C15A  LDA #$0A
+    RecompiledBegin(ctx, 0xC15A); cpu.A = 0x0A; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // C15C  STA $D7
+    RecompiledBegin(ctx, 0xC15C); bus.write(0x00D7, cpu.A); cpu.totalCycles += 3;
+    // C15E  BNE $C135
+    RecompiledBegin(ctx, 0xC15E); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xC135; return; }
+    cpu.PC = 0xC160;
+}
+
+static void Block_C160(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // C160  JSR $C66F
+    RecompiledBegin(ctx, 0xC160); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xC1); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x62); cpu.totalCycles += 6; cpu.PC = 0xC66F; return;
+}
+
+static void Block_C163(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // C163  INC $D7
+    { RecompiledBegin(ctx, 0xC163); const byte result = static_cast<byte>(bus.read(0x00D7) + 1); bus.write(0x00D7, result); SetNZ(cpu, result); cpu.totalCycles += 5; }
+    // C165  LDA $D7
+    RecompiledBegin(ctx, 0xC165); cpu.A = bus.read(0x00D7); SetNZ(cpu, cpu.A); cpu.totalCycles += 3;
+    // C167  CMP #$0B
+    RecompiledBegin(ctx, 0xC167); Compare(cpu, cpu.A, 0x0B); cpu.totalCycles += 2;
+    // C169  BCC $C135
+    RecompiledBegin(ctx, 0xC169); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xC135; return; }
+    // C16B  LDA #$00
+    RecompiledBegin(ctx, 0xC16B); cpu.A = 0x00; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // C16D  STA $D7
+    RecompiledBegin(ctx, 0xC16D); bus.write(0x00D7, cpu.A); cpu.totalCycles += 3;
+    // C16F  BEQ $C135
+    RecompiledBegin(ctx, 0xC16F); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xC135; return; }
+    cpu.PC = 0xC171;
+}
+
+static void Block_C171(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // C171  JSR $C689
+    RecompiledBegin(ctx, 0xC171); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xC1); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x73); cpu.totalCycles += 6; cpu.PC = 0xC689; return;
+}
+
+static void Block_C174(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // C174  LDA $D7
+    RecompiledBegin(ctx, 0xC174); cpu.A = bus.read(0x00D7); SetNZ(cpu, cpu.A); cpu.totalCycles += 3;
+    // C176  BEQ $C17E
+    RecompiledBegin(ctx, 0xC176); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xC17E; return; }
+    // C178  JSR $C1A1
+    RecompiledBegin(ctx, 0xC178); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xC1); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x7A); cpu.totalCycles += 6; cpu.PC = 0xC1A1; return;
+}
+
+static void Block_C17B(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    // C17B  JMP $C135
+    RecompiledBegin(ctx, 0xC17B); cpu.totalCycles += 3; cpu.PC = 0xC135; return;
+}
+
+static void Block_C17E(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // C17E  LDA #$00
+    RecompiledBegin(ctx, 0xC17E); cpu.A = 0x00; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // C180  STA $D8
+    RecompiledBegin(ctx, 0xC180); bus.write(0x00D8, cpu.A); cpu.totalCycles += 3;
+    // C182  INC $D7
+    { RecompiledBegin(ctx, 0xC182); const byte result = static_cast<byte>(bus.read(0x00D7) + 1); bus.write(0x00D7, result); SetNZ(cpu, result); cpu.totalCycles += 5; }
+    cpu.PC = 0xC184;
+}
+
+static void Block_C184(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // C184  JSR $C1A1
+    RecompiledBegin(ctx, 0xC184); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xC1); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x86); cpu.totalCycles += 6; cpu.PC = 0xC1A1; return;
+}
+
+static void Block_C187(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // C187  INC $D7
+    { RecompiledBegin(ctx, 0xC187); const byte result = static_cast<byte>(bus.read(0x00D7) + 1); bus.write(0x00D7, result); SetNZ(cpu, result); cpu.totalCycles += 5; }
+    // C189  LDA $D7
+    RecompiledBegin(ctx, 0xC189); cpu.A = bus.read(0x00D7); SetNZ(cpu, cpu.A); cpu.totalCycles += 3;
+    // C18B  CMP #$0B
+    RecompiledBegin(ctx, 0xC18B); Compare(cpu, cpu.A, 0x0B); cpu.totalCycles += 2;
+    // C18D  BNE $C184
+    RecompiledBegin(ctx, 0xC18D); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xC184; return; }
+    // C18F  LDA #$00
+    RecompiledBegin(ctx, 0xC18F); cpu.A = 0x00; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // C191  STA $D7
+    RecompiledBegin(ctx, 0xC191); bus.write(0x00D7, cpu.A); cpu.totalCycles += 3;
+    // C193  LDA $D8
+    RecompiledBegin(ctx, 0xC193); cpu.A = bus.read(0x00D8); SetNZ(cpu, cpu.A); cpu.totalCycles += 3;
+    // C195  BEQ $C199
+    RecompiledBegin(ctx, 0xC195); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xC199; return; }
+    // C197  LDA #$FF
+    RecompiledBegin(ctx, 0xC197); cpu.A = 0xFF; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    cpu.PC = 0xC199;
+}
+
+static void Block_C199(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // C199  STA $00
+    RecompiledBegin(ctx, 0xC199); bus.write(0x0000, cpu.A); cpu.totalCycles += 3;
+    // C19B  JSR $C1ED
+    RecompiledBegin(ctx, 0xC19B); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xC1); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x9D); cpu.totalCycles += 6; cpu.PC = 0xC1ED; return;
+}
+
+static void Block_C19E(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    // C19E  JMP $C135
+    RecompiledBegin(ctx, 0xC19E); cpu.totalCycles += 3; cpu.PC = 0xC135; return;
+}
+
+static void Block_C1A1(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // C1A1  LDA $D7
+    RecompiledBegin(ctx, 0xC1A1); cpu.A = bus.read(0x00D7); SetNZ(cpu, cpu.A); cpu.totalCycles += 3;
+    // C1A3  ASL
+    RecompiledBegin(ctx, 0xC1A3); cpu.A = ShiftLeft(cpu, cpu.A); cpu.totalCycles += 2;
+    // C1A4  TAX
+    RecompiledBegin(ctx, 0xC1A4); cpu.X = cpu.A; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // C1A5  LDA $C1BE,X
+    { RecompiledBegin(ctx, 0xC1A5); const memAddress ea = static_cast<memAddress>(0xC1BE + cpu.X); cpu.A = bus.read(ea); SetNZ(cpu, cpu.A); cpu.totalCycles += 4 + (((ea & 0xFF00) != 0xC100) ? 1 : 0); }
+    // C1A8  STA $0200
+    RecompiledBegin(ctx, 0xC1A8); bus.write(0x0200, cpu.A); cpu.totalCycles += 4;
+    // C1AB  LDA $C1BF,X
+    { RecompiledBegin(ctx, 0xC1AB); const memAddress ea = static_cast<memAddress>(0xC1BF + cpu.X); cpu.A = bus.read(ea); SetNZ(cpu, cpu.A); cpu.totalCycles += 4 + (((ea & 0xFF00) != 0xC100) ? 1 : 0); }
+    // C1AE  STA $0201
+    RecompiledBegin(ctx, 0xC1AE); bus.write(0x0201, cpu.A); cpu.totalCycles += 4;
+    // C1B1  LDA #$C1
+    RecompiledBegin(ctx, 0xC1B1); cpu.A = 0xC1; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // C1B3  PHA
+    RecompiledBegin(ctx, 0xC1B3); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), cpu.A); cpu.totalCycles += 3;
+    // C1B4  LDA #$DE
+    RecompiledBegin(ctx, 0xC1B4); cpu.A = 0xDE; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // C1B6  PHA
+    RecompiledBegin(ctx, 0xC1B6); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), cpu.A); cpu.totalCycles += 3;
+    // C1B7  LDA #$00
+    RecompiledBegin(ctx, 0xC1B7); cpu.A = 0x00; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // C1B9  STA $00
+    RecompiledBegin(ctx, 0xC1B9); bus.write(0x0000, cpu.A); cpu.totalCycles += 3;
+    // C1BB  JMP ($0200)
+    RecompiledBegin(ctx, 0xC1BB); cpu.totalCycles += 5; cpu.PC = RecompiledWord(bus.read(0x0200), bus.read(0x0201)); return;
+}
+
+static void Block_C1ED(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // C1ED  JSR $C28D
+    RecompiledBegin(ctx, 0xC1ED); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xC1); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xEF); cpu.totalCycles += 6; cpu.PC = 0xC28D; return;
+}
+
+static void Block_C1F0(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // C1F0  LDA #$00
+    RecompiledBegin(ctx, 0xC1F0); cpu.A = 0x00; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // C1F2  STA $D3
+    RecompiledBegin(ctx, 0xC1F2); bus.write(0x00D3, cpu.A); cpu.totalCycles += 3;
+    // C1F4  LDA $D7
+    RecompiledBegin(ctx, 0xC1F4); cpu.A = bus.read(0x00D7); SetNZ(cpu, cpu.A); cpu.totalCycles += 3;
+    // C1F6  CLC
+    RecompiledBegin(ctx, 0xC1F6); SetFlag(cpu, Flags::C, false); cpu.totalCycles += 2;
+    // C1F7  ADC #$04
+    RecompiledBegin(ctx, 0xC1F7); AddBinary(cpu, 0x04); cpu.totalCycles += 2;
+    // C1F9  ASL
+    RecompiledBegin(ctx, 0xC1F9); cpu.A = ShiftLeft(cpu, cpu.A); cpu.totalCycles += 2;
+    // C1FA  ROL $D3
+    RecompiledBegin(ctx, 0xC1FA); bus.write(0x00D3, RotateLeft(cpu, bus.read(0x00D3))); cpu.totalCycles += 5;
+    // C1FC  ASL
+    RecompiledBegin(ctx, 0xC1FC); cpu.A = ShiftLeft(cpu, cpu.A); cpu.totalCycles += 2;
+    // C1FD  ROL $D3
+    RecompiledBegin(ctx, 0xC1FD); bus.write(0x00D3, RotateLeft(cpu, bus.read(0x00D3))); cpu.totalCycles += 5;
+    // C1FF  ASL
+    RecompiledBegin(ctx, 0xC1FF); cpu.A = ShiftLeft(cpu, cpu.A); cpu.totalCycles += 2;
+    // C200  ROL $D3
+    RecompiledBegin(ctx, 0xC200); bus.write(0x00D3, RotateLeft(cpu, bus.read(0x00D3))); cpu.totalCycles += 5;
+    // C202  ASL
+    RecompiledBegin(ctx, 0xC202); cpu.A = ShiftLeft(cpu, cpu.A); cpu.totalCycles += 2;
+    // C203  ROL $D3
+    RecompiledBegin(ctx, 0xC203); bus.write(0x00D3, RotateLeft(cpu, bus.read(0x00D3))); cpu.totalCycles += 5;
+    // C205  ASL
+    RecompiledBegin(ctx, 0xC205); cpu.A = ShiftLeft(cpu, cpu.A); cpu.totalCycles += 2;
+    // C206  ROL $D3
+    RecompiledBegin(ctx, 0xC206); bus.write(0x00D3, RotateLeft(cpu, bus.read(0x00D3))); cpu.totalCycles += 5;
+    // C208  PHA
+    RecompiledBegin(ctx, 0xC208); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), cpu.A); cpu.totalCycles += 3;
+    // C209  LDA $D3
+    RecompiledBegin(ctx, 0xC209); cpu.A = bus.read(0x00D3); SetNZ(cpu, cpu.A); cpu.totalCycles += 3;
+    // C20B  ORA #$20
+    RecompiledBegin(ctx, 0xC20B); cpu.A = static_cast<byte>(cpu.A | 0x20); SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // C20D  STA $2006
+    RecompiledBegin(ctx, 0xC20D); bus.write(0x2006, cpu.A); cpu.totalCycles += 4;
+    // C210  PLA
+    RecompiledBegin(ctx, 0xC210); cpu.SP++; cpu.A = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); SetNZ(cpu, cpu.A); cpu.totalCycles += 4;
+    // C211  ORA #$04
+    RecompiledBegin(ctx, 0xC211); cpu.A = static_cast<byte>(cpu.A | 0x04); SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // C213  STA $2006
+    RecompiledBegin(ctx, 0xC213); bus.write(0x2006, cpu.A); cpu.totalCycles += 4;
+    // C216  LDA $00
+    RecompiledBegin(ctx, 0xC216); cpu.A = bus.read(0x0000); SetNZ(cpu, cpu.A); cpu.totalCycles += 3;
+    // C218  BEQ $C237
+    RecompiledBegin(ctx, 0xC218); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xC237; return; }
+    // C21A  CMP #$FF
+    RecompiledBegin(ctx, 0xC21A); Compare(cpu, cpu.A, 0xFF); cpu.totalCycles += 2;
+    // C21C  BEQ $C244
+    RecompiledBegin(ctx, 0xC21C); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xC244; return; }
+    // C21E  LSR
+    RecompiledBegin(ctx, 0xC21E); cpu.A = ShiftRight(cpu, cpu.A); cpu.totalCycles += 2;
+    // C21F  LSR
+    RecompiledBegin(ctx, 0xC21F); cpu.A = ShiftRight(cpu, cpu.A); cpu.totalCycles += 2;
+    // C220  LSR
+    RecompiledBegin(ctx, 0xC220); cpu.A = ShiftRight(cpu, cpu.A); cpu.totalCycles += 2;
+    // C221  LSR
+    RecompiledBegin(ctx, 0xC221); cpu.A = ShiftRight(cpu, cpu.A); cpu.totalCycles += 2;
+    // C222  TAX
+    RecompiledBegin(ctx, 0xC222); cpu.X = cpu.A; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // C223  LDA $C251,X
+    { RecompiledBegin(ctx, 0xC223); const memAddress ea = static_cast<memAddress>(0xC251 + cpu.X); cpu.A = bus.read(ea); SetNZ(cpu, cpu.A); cpu.totalCycles += 4 + (((ea & 0xFF00) != 0xC200) ? 1 : 0); }
+    // C226  STA $2007
+    RecompiledBegin(ctx, 0xC226); bus.write(0x2007, cpu.A); cpu.totalCycles += 4;
+    // C229  LDA $00
+    RecompiledBegin(ctx, 0xC229); cpu.A = bus.read(0x0000); SetNZ(cpu, cpu.A); cpu.totalCycles += 3;
+    // C22B  AND #$0F
+    RecompiledBegin(ctx, 0xC22B); cpu.A = static_cast<byte>(cpu.A & 0x0F); SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // C22D  TAX
+    RecompiledBegin(ctx, 0xC22D); cpu.X = cpu.A; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // C22E  LDA $C251,X
+    { RecompiledBegin(ctx, 0xC22E); const memAddress ea = static_cast<memAddress>(0xC251 + cpu.X); cpu.A = bus.read(ea); SetNZ(cpu, cpu.A); cpu.totalCycles += 4 + (((ea & 0xFF00) != 0xC200) ? 1 : 0); }
+    // C231  STA $2007
+    RecompiledBegin(ctx, 0xC231); bus.write(0x2007, cpu.A); cpu.totalCycles += 4;
+    // C234  JMP $C294
+    RecompiledBegin(ctx, 0xC234); cpu.totalCycles += 3; cpu.PC = 0xC294; return;
+}
+
+static void Block_C237(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // C237  LDA #$4F
+    RecompiledBegin(ctx, 0xC237); cpu.A = 0x4F; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // C239  STA $2007
+    RecompiledBegin(ctx, 0xC239); bus.write(0x2007, cpu.A); cpu.totalCycles += 4;
+    // C23C  LDA #$4B
+    RecompiledBegin(ctx, 0xC23C); cpu.A = 0x4B; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // C23E  STA $2007
+    RecompiledBegin(ctx, 0xC23E); bus.write(0x2007, cpu.A); cpu.totalCycles += 4;
+    // C241  JMP $C294
+    RecompiledBegin(ctx, 0xC241); cpu.totalCycles += 3; cpu.PC = 0xC294; return;
+}
+
+static void Block_C244(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // C244  LDA #$45
+    RecompiledBegin(ctx, 0xC244); cpu.A = 0x45; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // C246  STA $2007
+    RecompiledBegin(ctx, 0xC246); bus.write(0x2007, cpu.A); cpu.totalCycles += 4;
+    // C249  LDA #$72
+    RecompiledBegin(ctx, 0xC249); cpu.A = 0x72; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // C24B  STA $2007
+    RecompiledBegin(ctx, 0xC24B); bus.write(0x2007, cpu.A); cpu.totalCycles += 4;
+    // C24E  JMP $C294
+    RecompiledBegin(ctx, 0xC24E); cpu.totalCycles += 3; cpu.PC = 0xC294; return;
+}
+
+static void Block_C261(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // C261  LDA $D7
+    RecompiledBegin(ctx, 0xC261); cpu.A = bus.read(0x00D7); SetNZ(cpu, cpu.A); cpu.totalCycles += 3;
+    // C263  CLC
+    RecompiledBegin(ctx, 0xC263); SetFlag(cpu, Flags::C, false); cpu.totalCycles += 2;
+    // C264  ADC #$04
+    RecompiledBegin(ctx, 0xC264); AddBinary(cpu, 0x04); cpu.totalCycles += 2;
+    // C266  TAY
+    RecompiledBegin(ctx, 0xC266); cpu.Y = cpu.A; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // C267  LDA #$84
+    RecompiledBegin(ctx, 0xC267); cpu.A = 0x84; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // C269  STA $2000
+    RecompiledBegin(ctx, 0xC269); bus.write(0x2000, cpu.A); cpu.totalCycles += 4;
+    // C26C  LDA #$20
+    RecompiledBegin(ctx, 0xC26C); cpu.A = 0x20; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // C26E  STA $2006
+    RecompiledBegin(ctx, 0xC26E); bus.write(0x2006, cpu.A); cpu.totalCycles += 4;
+    // C271  LDA #$02
+    RecompiledBegin(ctx, 0xC271); cpu.A = 0x02; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // C273  STA $2006
+    RecompiledBegin(ctx, 0xC273); bus.write(0x2006, cpu.A); cpu.totalCycles += 4;
+    cpu.PC = 0xC276;
+}
+
+static void Block_C276(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    // C276  LDA #$20
+    RecompiledBegin(ctx, 0xC276); cpu.A = 0x20; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // C278  DEY
+    RecompiledBegin(ctx, 0xC278); cpu.Y--; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // C279  INY
+    RecompiledBegin(ctx, 0xC279); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // C27A  BNE $C27E
+    RecompiledBegin(ctx, 0xC27A); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xC27E; return; }
+    // C27C  LDA #$2A
+    RecompiledBegin(ctx, 0xC27C); cpu.A = 0x2A; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    cpu.PC = 0xC27E;
+}
+
+static void Block_C27E(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // C27E  STA $2007
+    RecompiledBegin(ctx, 0xC27E); bus.write(0x2007, cpu.A); cpu.totalCycles += 4;
+    // C281  DEY
+    RecompiledBegin(ctx, 0xC281); cpu.Y--; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // C282  DEX
+    RecompiledBegin(ctx, 0xC282); cpu.X--; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // C283  BNE $C276
+    RecompiledBegin(ctx, 0xC283); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xC276; return; }
+    // C285  LDA #$80
+    RecompiledBegin(ctx, 0xC285); cpu.A = 0x80; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // C287  STA $2000
+    RecompiledBegin(ctx, 0xC287); bus.write(0x2000, cpu.A); cpu.totalCycles += 4;
+    // C28A  JMP $C294
+    RecompiledBegin(ctx, 0xC28A); cpu.totalCycles += 3; cpu.PC = 0xC294; return;
+}
+
+static void Block_C28D(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // C28D  LDA $D2
+    RecompiledBegin(ctx, 0xC28D); cpu.A = bus.read(0x00D2); SetNZ(cpu, cpu.A); cpu.totalCycles += 3;
+    cpu.PC = 0xC28F;
+}
+
+static void Block_C28F(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // C28F  CMP $D2
+    RecompiledBegin(ctx, 0xC28F); Compare(cpu, cpu.A, bus.read(0x00D2)); cpu.totalCycles += 3;
+    // C291  BEQ $C28F
+    RecompiledBegin(ctx, 0xC291); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xC28F; return; }
+    // C293  RTS
+    { RecompiledBegin(ctx, 0xC293); cpu.SP++; const byte low = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); const byte high = bus.read(static_cast<memAddress>(0x0100 + cpu.SP + 1)); cpu.SP++; cpu.totalCycles += 6; cpu.PC = static_cast<memAddress>(RecompiledWord(low, high) + 1); return; }
+}
+
+static void Block_C294(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // C294  LDA #$00
+    RecompiledBegin(ctx, 0xC294); cpu.A = 0x00; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // C296  STA $2005
+    RecompiledBegin(ctx, 0xC296); bus.write(0x2005, cpu.A); cpu.totalCycles += 4;
+    // C299  STA $2005
+    RecompiledBegin(ctx, 0xC299); bus.write(0x2005, cpu.A); cpu.totalCycles += 4;
+    // C29C  LDA #$00
+    RecompiledBegin(ctx, 0xC29C); cpu.A = 0x00; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // C29E  STA $2006
+    RecompiledBegin(ctx, 0xC29E); bus.write(0x2006, cpu.A); cpu.totalCycles += 4;
+    // C2A1  LDA #$00
+    RecompiledBegin(ctx, 0xC2A1); cpu.A = 0x00; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // C2A3  STA $2006
+    RecompiledBegin(ctx, 0xC2A3); bus.write(0x2006, cpu.A); cpu.totalCycles += 4;
+    // C2A6  RTS
+    { RecompiledBegin(ctx, 0xC2A6); cpu.SP++; const byte low = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); const byte high = bus.read(static_cast<memAddress>(0x0100 + cpu.SP + 1)); cpu.SP++; cpu.totalCycles += 6; cpu.PC = static_cast<memAddress>(RecompiledWord(low, high) + 1); return; }
+}
+
+static void Block_C2A7(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // C2A7  LDA #$00
+    RecompiledBegin(ctx, 0xC2A7); cpu.A = 0x00; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // C2A9  STA $2000
+    RecompiledBegin(ctx, 0xC2A9); bus.write(0x2000, cpu.A); cpu.totalCycles += 4;
+    // C2AC  STA $2001
+    RecompiledBegin(ctx, 0xC2AC); bus.write(0x2001, cpu.A); cpu.totalCycles += 4;
+    // C2AF  JSR $C2ED
+    RecompiledBegin(ctx, 0xC2AF); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xC2); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xB1); cpu.totalCycles += 6; cpu.PC = 0xC2ED; return;
+}
+
+static void Block_C2B2(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // C2B2  LDA #$20
+    RecompiledBegin(ctx, 0xC2B2); cpu.A = 0x20; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // C2B4  STA $2006
+    RecompiledBegin(ctx, 0xC2B4); bus.write(0x2006, cpu.A); cpu.totalCycles += 4;
+    // C2B7  LDY #$00
+    RecompiledBegin(ctx, 0xC2B7); cpu.Y = 0x00; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // C2B9  STY $2006
+    RecompiledBegin(ctx, 0xC2B9); bus.write(0x2006, cpu.Y); cpu.totalCycles += 4;
+    cpu.PC = 0xC2BC;
+}
+
+static void Block_C2BC(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    // C2BC  LDX #$20
+    RecompiledBegin(ctx, 0xC2BC); cpu.X = 0x20; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    cpu.PC = 0xC2BE;
+}
+
+static void Block_C2BE(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // C2BE  LDA ($D0),Y
+    { RecompiledBegin(ctx, 0xC2BE); const memAddress pointer = RecompiledWord(bus.read(0xD0), bus.read(0xD1)); const memAddress ea = static_cast<memAddress>(pointer + cpu.Y); cpu.A = bus.read(ea); SetNZ(cpu, cpu.A); cpu.totalCycles += 5 + (((ea & 0xFF00) != (pointer & 0xFF00)) ? 1 : 0); }
+    // C2C0  BEQ $C2E2
+    RecompiledBegin(ctx, 0xC2C0); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xC2E2; return; }
+    // C2C2  CMP #$FF
+    RecompiledBegin(ctx, 0xC2C2); Compare(cpu, cpu.A, 0xFF); cpu.totalCycles += 2;
+    // C2C4  BEQ $C2D3
+    RecompiledBegin(ctx, 0xC2C4); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xC2D3; return; }
+    // C2C6  STA $2007
+    RecompiledBegin(ctx, 0xC2C6); bus.write(0x2007, cpu.A); cpu.totalCycles += 4;
+    // C2C9  INY
+    RecompiledBegin(ctx, 0xC2C9); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // C2CA  BNE $C2CE
+    RecompiledBegin(ctx, 0xC2CA); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xC2CE; return; }
+    // C2CC  INC $D1
+    { RecompiledBegin(ctx, 0xC2CC); const byte result = static_cast<byte>(bus.read(0x00D1) + 1); bus.write(0x00D1, result); SetNZ(cpu, result); cpu.totalCycles += 5; }
+    cpu.PC = 0xC2CE;
+}
+
+static void Block_C2CE(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    // C2CE  DEX
+    RecompiledBegin(ctx, 0xC2CE); cpu.X--; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // C2CF  BNE $C2BE
+    RecompiledBegin(ctx, 0xC2CF); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xC2BE; return; }
+    // C2D1  BEQ $C2BC
+    RecompiledBegin(ctx, 0xC2D1); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xC2BC; return; }
+    cpu.PC = 0xC2D3;
+}
+
+static void Block_C2D3(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // C2D3  INY
+    RecompiledBegin(ctx, 0xC2D3); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // C2D4  BNE $C2D8
+    RecompiledBegin(ctx, 0xC2D4); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xC2D8; return; }
+    // C2D6  INC $D1
+    { RecompiledBegin(ctx, 0xC2D6); const byte result = static_cast<byte>(bus.read(0x00D1) + 1); bus.write(0x00D1, result); SetNZ(cpu, result); cpu.totalCycles += 5; }
+    cpu.PC = 0xC2D8;
+}
+
+static void Block_C2D8(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // C2D8  LDA #$20
+    RecompiledBegin(ctx, 0xC2D8); cpu.A = 0x20; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // C2DA  STA $2007
+    RecompiledBegin(ctx, 0xC2DA); bus.write(0x2007, cpu.A); cpu.totalCycles += 4;
+    // C2DD  DEX
+    RecompiledBegin(ctx, 0xC2DD); cpu.X--; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // C2DE  BNE $C2D8
+    RecompiledBegin(ctx, 0xC2DE); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xC2D8; return; }
+    // C2E0  BEQ $C2BC
+    RecompiledBegin(ctx, 0xC2E0); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xC2BC; return; }
+    cpu.PC = 0xC2E2;
+}
+
+static void Block_C2E2(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // C2E2  LDA #$80
+    RecompiledBegin(ctx, 0xC2E2); cpu.A = 0x80; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // C2E4  STA $2000
+    RecompiledBegin(ctx, 0xC2E4); bus.write(0x2000, cpu.A); cpu.totalCycles += 4;
+    // C2E7  LDA #$0E
+    RecompiledBegin(ctx, 0xC2E7); cpu.A = 0x0E; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // C2E9  STA $2001
+    RecompiledBegin(ctx, 0xC2E9); bus.write(0x2001, cpu.A); cpu.totalCycles += 4;
+    // C2EC  RTS
+    { RecompiledBegin(ctx, 0xC2EC); cpu.SP++; const byte low = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); const byte high = bus.read(static_cast<memAddress>(0x0100 + cpu.SP + 1)); cpu.SP++; cpu.totalCycles += 6; cpu.PC = static_cast<memAddress>(RecompiledWord(low, high) + 1); return; }
+}
+
+static void Block_C2ED(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // C2ED  LDA #$20
+    RecompiledBegin(ctx, 0xC2ED); cpu.A = 0x20; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // C2EF  STA $2006
+    RecompiledBegin(ctx, 0xC2EF); bus.write(0x2006, cpu.A); cpu.totalCycles += 4;
+    // C2F2  LDA #$00
+    RecompiledBegin(ctx, 0xC2F2); cpu.A = 0x00; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // C2F4  STA $2006
+    RecompiledBegin(ctx, 0xC2F4); bus.write(0x2006, cpu.A); cpu.totalCycles += 4;
+    // C2F7  LDX #$1E
+    RecompiledBegin(ctx, 0xC2F7); cpu.X = 0x1E; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // C2F9  LDA #$20
+    RecompiledBegin(ctx, 0xC2F9); cpu.A = 0x20; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    cpu.PC = 0xC2FB;
+}
+
+static void Block_C2FB(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    // C2FB  LDY #$20
+    RecompiledBegin(ctx, 0xC2FB); cpu.Y = 0x20; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    cpu.PC = 0xC2FD;
+}
+
+static void Block_C2FD(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // C2FD  STA $2007
+    RecompiledBegin(ctx, 0xC2FD); bus.write(0x2007, cpu.A); cpu.totalCycles += 4;
+    // C300  DEY
+    RecompiledBegin(ctx, 0xC300); cpu.Y--; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // C301  BNE $C2FD
+    RecompiledBegin(ctx, 0xC301); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 2; cpu.PC = 0xC2FD; return; }
+    // C303  DEX
+    RecompiledBegin(ctx, 0xC303); cpu.X--; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // C304  BNE $C2FB
+    RecompiledBegin(ctx, 0xC304); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 2; cpu.PC = 0xC2FB; return; }
+    // C306  RTS
+    { RecompiledBegin(ctx, 0xC306); cpu.SP++; const byte low = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); const byte high = bus.read(static_cast<memAddress>(0x0100 + cpu.SP + 1)); cpu.SP++; cpu.totalCycles += 6; cpu.PC = static_cast<memAddress>(RecompiledWord(low, high) + 1); return; }
+}
+
+static void Block_C5AF(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // C5AF  PHA
+    RecompiledBegin(ctx, 0xC5AF); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), cpu.A); cpu.totalCycles += 3;
+    // C5B0  TXA
+    RecompiledBegin(ctx, 0xC5B0); cpu.A = cpu.X; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // C5B1  PHA
+    RecompiledBegin(ctx, 0xC5B1); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), cpu.A); cpu.totalCycles += 3;
+    // C5B2  LDA $2002
+    RecompiledBegin(ctx, 0xC5B2); cpu.A = bus.read(0x2002); SetNZ(cpu, cpu.A); cpu.totalCycles += 4;
+    // C5B5  LDA #$20
+    RecompiledBegin(ctx, 0xC5B5); cpu.A = 0x20; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // C5B7  STA $2006
+    RecompiledBegin(ctx, 0xC5B7); bus.write(0x2006, cpu.A); cpu.totalCycles += 4;
+    // C5BA  LDA #$40
+    RecompiledBegin(ctx, 0xC5BA); cpu.A = 0x40; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // C5BC  STA $2006
+    RecompiledBegin(ctx, 0xC5BC); bus.write(0x2006, cpu.A); cpu.totalCycles += 4;
+    // C5BF  INC $D2
+    { RecompiledBegin(ctx, 0xC5BF); const byte result = static_cast<byte>(bus.read(0x00D2) + 1); bus.write(0x00D2, result); SetNZ(cpu, result); cpu.totalCycles += 5; }
+    // C5C1  LDA #$00
+    RecompiledBegin(ctx, 0xC5C1); cpu.A = 0x00; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // C5C3  STA $2005
+    RecompiledBegin(ctx, 0xC5C3); bus.write(0x2005, cpu.A); cpu.totalCycles += 4;
+    // C5C6  STA $2005
+    RecompiledBegin(ctx, 0xC5C6); bus.write(0x2005, cpu.A); cpu.totalCycles += 4;
+    // C5C9  LDA #$00
+    RecompiledBegin(ctx, 0xC5C9); cpu.A = 0x00; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // C5CB  STA $2006
+    RecompiledBegin(ctx, 0xC5CB); bus.write(0x2006, cpu.A); cpu.totalCycles += 4;
+    // C5CE  LDA #$00
+    RecompiledBegin(ctx, 0xC5CE); cpu.A = 0x00; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // C5D0  STA $2006
+    RecompiledBegin(ctx, 0xC5D0); bus.write(0x2006, cpu.A); cpu.totalCycles += 4;
+    // C5D3  LDX #$09
+    RecompiledBegin(ctx, 0xC5D3); cpu.X = 0x09; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // C5D5  STX $4016
+    RecompiledBegin(ctx, 0xC5D5); bus.write(0x4016, cpu.X); cpu.totalCycles += 4;
+    // C5D8  DEX
+    RecompiledBegin(ctx, 0xC5D8); cpu.X--; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // C5D9  STX $4016
+    RecompiledBegin(ctx, 0xC5D9); bus.write(0x4016, cpu.X); cpu.totalCycles += 4;
+    cpu.PC = 0xC5DC;
+}
+
+static void Block_C5DC(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // C5DC  LDA $4016
+    RecompiledBegin(ctx, 0xC5DC); cpu.A = bus.read(0x4016); SetNZ(cpu, cpu.A); cpu.totalCycles += 4;
+    // C5DF  LSR
+    RecompiledBegin(ctx, 0xC5DF); cpu.A = ShiftRight(cpu, cpu.A); cpu.totalCycles += 2;
+    // C5E0  ROL $D4
+    RecompiledBegin(ctx, 0xC5E0); bus.write(0x00D4, RotateLeft(cpu, bus.read(0x00D4))); cpu.totalCycles += 5;
+    // C5E2  DEX
+    RecompiledBegin(ctx, 0xC5E2); cpu.X--; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // C5E3  BNE $C5DC
+    RecompiledBegin(ctx, 0xC5E3); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xC5DC; return; }
+    // C5E5  LDA $D4
+    RecompiledBegin(ctx, 0xC5E5); cpu.A = bus.read(0x00D4); SetNZ(cpu, cpu.A); cpu.totalCycles += 3;
+    // C5E7  TAX
+    RecompiledBegin(ctx, 0xC5E7); cpu.X = cpu.A; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // C5E8  EOR $D6
+    RecompiledBegin(ctx, 0xC5E8); cpu.A = static_cast<byte>(cpu.A ^ bus.read(0x00D6)); SetNZ(cpu, cpu.A); cpu.totalCycles += 3;
+    // C5EA  AND $D4
+    RecompiledBegin(ctx, 0xC5EA); cpu.A = static_cast<byte>(cpu.A & bus.read(0x00D4)); SetNZ(cpu, cpu.A); cpu.totalCycles += 3;
+    // C5EC  STA $D5
+    RecompiledBegin(ctx, 0xC5EC); bus.write(0x00D5, cpu.A); cpu.totalCycles += 3;
+    // C5EE  STX $D6
+    RecompiledBegin(ctx, 0xC5EE); bus.write(0x00D6, cpu.X); cpu.totalCycles += 3;
+    // C5F0  PLA
+    RecompiledBegin(ctx, 0xC5F0); cpu.SP++; cpu.A = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); SetNZ(cpu, cpu.A); cpu.totalCycles += 4;
+    // C5F1  TAX
+    RecompiledBegin(ctx, 0xC5F1); cpu.X = cpu.A; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // C5F2  PLA
+    RecompiledBegin(ctx, 0xC5F2); cpu.SP++; cpu.A = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); SetNZ(cpu, cpu.A); cpu.totalCycles += 4;
+    // C5F3  RTI
+    RecompiledBegin(ctx, 0xC5F3); cpu.PC = 0xC5F4; cpu.RTI({ 0x0000, AddressingMode::IMP, false }); cpu.totalCycles += 6 + cpu.cycles; cpu.cycles = 0; return;
+}
+
+static void Block_C5F4(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    // C5F4  RTI
+    RecompiledBegin(ctx, 0xC5F4); cpu.PC = 0xC5F5; cpu.RTI({ 0x0000, AddressingMode::IMP, false }); cpu.totalCycles += 6 + cpu.cycles; cpu.cycles = 0; return;
+}
+
+static void Block_C5F5(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // C5F5  LDX #$00
+    RecompiledBegin(ctx, 0xC5F5); cpu.X = 0x00; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // C5F7  STX $00
+    RecompiledBegin(ctx, 0xC5F7); bus.write(0x0000, cpu.X); cpu.totalCycles += 3;
+    // C5F9  STX $10
+    RecompiledBegin(ctx, 0xC5F9); bus.write(0x0010, cpu.X); cpu.totalCycles += 3;
+    // C5FB  STX $11
+    RecompiledBegin(ctx, 0xC5FB); bus.write(0x0011, cpu.X); cpu.totalCycles += 3;
+    // C5FD  JSR $C72D
+    RecompiledBegin(ctx, 0xC5FD); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xC5); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xFF); cpu.totalCycles += 6; cpu.PC = 0xC72D; return;
+}
+
+static void Block_C600(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // C600  JSR $C7DB
+    RecompiledBegin(ctx, 0xC600); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xC6); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x02); cpu.totalCycles += 6; cpu.PC = 0xC7DB; return;
+}
+
+static void Block_C603(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // C603  JSR $C885
+    RecompiledBegin(ctx, 0xC603); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xC6); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x05); cpu.totalCycles += 6; cpu.PC = 0xC885; return;
+}
+
+static void Block_C606(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // C606  JSR $CBDE
+    RecompiledBegin(ctx, 0xC606); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xC6); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x08); cpu.totalCycles += 6; cpu.PC = 0xCBDE; return;
+}
+
+static void Block_C609(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // C609  JSR $CDF8
+    RecompiledBegin(ctx, 0xC609); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xC6); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x0B); cpu.totalCycles += 6; cpu.PC = 0xCDF8; return;
+}
+
+static void Block_C60C(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // C60C  JSR $CEEE
+    RecompiledBegin(ctx, 0xC60C); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xC6); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x0E); cpu.totalCycles += 6; cpu.PC = 0xCEEE; return;
+}
+
+static void Block_C60F(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // C60F  JSR $CFA2
+    RecompiledBegin(ctx, 0xC60F); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xC6); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x11); cpu.totalCycles += 6; cpu.PC = 0xCFA2; return;
+}
+
+static void Block_C612(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // C612  JSR $D174
+    RecompiledBegin(ctx, 0xC612); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xC6); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x14); cpu.totalCycles += 6; cpu.PC = 0xD174; return;
+}
+
+static void Block_C615(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // C615  JSR $D4FB
+    RecompiledBegin(ctx, 0xC615); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xC6); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x17); cpu.totalCycles += 6; cpu.PC = 0xD4FB; return;
+}
+
+static void Block_C618(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // C618  JSR $D900
+    RecompiledBegin(ctx, 0xC618); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xC6); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x1A); cpu.totalCycles += 6; cpu.PC = 0xD900; return;
+}
+
+static void Block_C61B(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // C61B  LDA $00
+    RecompiledBegin(ctx, 0xC61B); cpu.A = bus.read(0x0000); SetNZ(cpu, cpu.A); cpu.totalCycles += 3;
+    // C61D  STA $10
+    RecompiledBegin(ctx, 0xC61D); bus.write(0x0010, cpu.A); cpu.totalCycles += 3;
+    // C61F  LDA #$00
+    RecompiledBegin(ctx, 0xC61F); cpu.A = 0x00; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // C621  STA $00
+    RecompiledBegin(ctx, 0xC621); bus.write(0x0000, cpu.A); cpu.totalCycles += 3;
+    // C623  JSR $DAE0
+    RecompiledBegin(ctx, 0xC623); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xC6); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x25); cpu.totalCycles += 6; cpu.PC = 0xDAE0; return;
+}
+
+static void Block_C626(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // C626  JSR $DF4A
+    RecompiledBegin(ctx, 0xC626); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xC6); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x28); cpu.totalCycles += 6; cpu.PC = 0xDF4A; return;
+}
+
+static void Block_C629(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // C629  JSR $DBB8
+    RecompiledBegin(ctx, 0xC629); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xC6); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x2B); cpu.totalCycles += 6; cpu.PC = 0xDBB8; return;
+}
+
+static void Block_C62C(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // C62C  JSR $E1AA
+    RecompiledBegin(ctx, 0xC62C); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xC6); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x2E); cpu.totalCycles += 6; cpu.PC = 0xE1AA; return;
+}
+
+static void Block_C62F(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // C62F  JSR $C6A3
+    RecompiledBegin(ctx, 0xC62F); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xC6); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x31); cpu.totalCycles += 6; cpu.PC = 0xC6A3; return;
+}
+
+static void Block_C632(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // C632  JSR $E51E
+    RecompiledBegin(ctx, 0xC632); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xC6); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x34); cpu.totalCycles += 6; cpu.PC = 0xE51E; return;
+}
+
+static void Block_C635(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // C635  JSR $E73D
+    RecompiledBegin(ctx, 0xC635); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xC6); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x37); cpu.totalCycles += 6; cpu.PC = 0xE73D; return;
+}
+
+static void Block_C638(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // C638  JSR $E8D3
+    RecompiledBegin(ctx, 0xC638); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xC6); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x3A); cpu.totalCycles += 6; cpu.PC = 0xE8D3; return;
+}
+
+static void Block_C63B(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // C63B  JSR $E916
+    RecompiledBegin(ctx, 0xC63B); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xC6); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x3D); cpu.totalCycles += 6; cpu.PC = 0xE916; return;
+}
+
+static void Block_C63E(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // C63E  JSR $EB86
+    RecompiledBegin(ctx, 0xC63E); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xC6); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x40); cpu.totalCycles += 6; cpu.PC = 0xEB86; return;
+}
+
+static void Block_C641(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // C641  JSR $EDF6
+    RecompiledBegin(ctx, 0xC641); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xC6); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x43); cpu.totalCycles += 6; cpu.PC = 0xEDF6; return;
+}
+
+static void Block_C644(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // C644  JSR $F066
+    RecompiledBegin(ctx, 0xC644); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xC6); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x46); cpu.totalCycles += 6; cpu.PC = 0xF066; return;
+}
+
+static void Block_C647(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // C647  JSR $F2D6
+    RecompiledBegin(ctx, 0xC647); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xC6); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x49); cpu.totalCycles += 6; cpu.PC = 0xF2D6; return;
+}
+
+static void Block_C64A(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // C64A  LDA $00
+    RecompiledBegin(ctx, 0xC64A); cpu.A = bus.read(0x0000); SetNZ(cpu, cpu.A); cpu.totalCycles += 3;
+    // C64C  STA $11
+    RecompiledBegin(ctx, 0xC64C); bus.write(0x0011, cpu.A); cpu.totalCycles += 3;
+    // C64E  LDA #$00
+    RecompiledBegin(ctx, 0xC64E); cpu.A = 0x00; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // C650  STA $00
+    RecompiledBegin(ctx, 0xC650); bus.write(0x0000, cpu.A); cpu.totalCycles += 3;
+    // C652  JSR $F546
+    RecompiledBegin(ctx, 0xC652); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xC6); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x54); cpu.totalCycles += 6; cpu.PC = 0xF546; return;
+}
+
+static void Block_C655(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // C655  LDA $00
+    RecompiledBegin(ctx, 0xC655); cpu.A = bus.read(0x0000); SetNZ(cpu, cpu.A); cpu.totalCycles += 3;
+    // C657  ORA $10
+    RecompiledBegin(ctx, 0xC657); cpu.A = static_cast<byte>(cpu.A | bus.read(0x0010)); SetNZ(cpu, cpu.A); cpu.totalCycles += 3;
+    // C659  ORA $11
+    RecompiledBegin(ctx, 0xC659); cpu.A = static_cast<byte>(cpu.A | bus.read(0x0011)); SetNZ(cpu, cpu.A); cpu.totalCycles += 3;
+    // C65B  BEQ $C66B
+    RecompiledBegin(ctx, 0xC65B); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xC66B; return; }
+    // C65D  JSR $C66F
+    RecompiledBegin(ctx, 0xC65D); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xC6); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x5F); cpu.totalCycles += 6; cpu.PC = 0xC66F; return;
+}
+
+static void Block_C660(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // C660  LDX $00
+    RecompiledBegin(ctx, 0xC660); cpu.X = bus.read(0x0000); SetNZ(cpu, cpu.X); cpu.totalCycles += 3;
+    // C662  STX $02
+    RecompiledBegin(ctx, 0xC662); bus.write(0x0002, cpu.X); cpu.totalCycles += 3;
+    // C664  LDX $10
+    RecompiledBegin(ctx, 0xC664); cpu.X = bus.read(0x0010); SetNZ(cpu, cpu.X); cpu.totalCycles += 3;
+    // C666  STX $03
+    RecompiledBegin(ctx, 0xC666); bus.write(0x0003, cpu.X); cpu.totalCycles += 3;
+    // C668  JMP $C66E
+    RecompiledBegin(ctx, 0xC668); cpu.totalCycles += 3; cpu.PC = 0xC66E; return;
+}
+
+static void Block_C66B(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // C66B  JSR $C689
+    RecompiledBegin(ctx, 0xC66B); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xC6); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x6D); cpu.totalCycles += 6; cpu.PC = 0xC689; return;
+}
+
+static void Block_C66E(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // C66E  RTS
+    { RecompiledBegin(ctx, 0xC66E); cpu.SP++; const byte low = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); const byte high = bus.read(static_cast<memAddress>(0x0100 + cpu.SP + 1)); cpu.SP++; cpu.totalCycles += 6; cpu.PC = static_cast<memAddress>(RecompiledWord(low, high) + 1); return; }
+}
+
+static void Block_C66F(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // C66F  LDA #$03
+    RecompiledBegin(ctx, 0xC66F); cpu.A = 0x03; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // C671  STA $4015
+    RecompiledBegin(ctx, 0xC671); bus.write(0x4015, cpu.A); cpu.totalCycles += 4;
+    // C674  LDA #$87
+    RecompiledBegin(ctx, 0xC674); cpu.A = 0x87; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // C676  STA $4000
+    RecompiledBegin(ctx, 0xC676); bus.write(0x4000, cpu.A); cpu.totalCycles += 4;
+    // C679  LDA #$89
+    RecompiledBegin(ctx, 0xC679); cpu.A = 0x89; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // C67B  STA $4001
+    RecompiledBegin(ctx, 0xC67B); bus.write(0x4001, cpu.A); cpu.totalCycles += 4;
+    // C67E  LDA #$F0
+    RecompiledBegin(ctx, 0xC67E); cpu.A = 0xF0; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // C680  STA $4002
+    RecompiledBegin(ctx, 0xC680); bus.write(0x4002, cpu.A); cpu.totalCycles += 4;
+    // C683  LDA #$00
+    RecompiledBegin(ctx, 0xC683); cpu.A = 0x00; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // C685  STA $4003
+    RecompiledBegin(ctx, 0xC685); bus.write(0x4003, cpu.A); cpu.totalCycles += 4;
+    // C688  RTS
+    { RecompiledBegin(ctx, 0xC688); cpu.SP++; const byte low = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); const byte high = bus.read(static_cast<memAddress>(0x0100 + cpu.SP + 1)); cpu.SP++; cpu.totalCycles += 6; cpu.PC = static_cast<memAddress>(RecompiledWord(low, high) + 1); return; }
+}
+
+static void Block_C689(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // C689  LDA #$02
+    RecompiledBegin(ctx, 0xC689); cpu.A = 0x02; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // C68B  STA $4015
+    RecompiledBegin(ctx, 0xC68B); bus.write(0x4015, cpu.A); cpu.totalCycles += 4;
+    // C68E  LDA #$3F
+    RecompiledBegin(ctx, 0xC68E); cpu.A = 0x3F; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // C690  STA $4004
+    RecompiledBegin(ctx, 0xC690); bus.write(0x4004, cpu.A); cpu.totalCycles += 4;
+    // C693  LDA #$9A
+    RecompiledBegin(ctx, 0xC693); cpu.A = 0x9A; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // C695  STA $4005
+    RecompiledBegin(ctx, 0xC695); bus.write(0x4005, cpu.A); cpu.totalCycles += 4;
+    // C698  LDA #$FF
+    RecompiledBegin(ctx, 0xC698); cpu.A = 0xFF; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // C69A  STA $4006
+    RecompiledBegin(ctx, 0xC69A); bus.write(0x4006, cpu.A); cpu.totalCycles += 4;
+    // C69D  LDA #$00
+    RecompiledBegin(ctx, 0xC69D); cpu.A = 0x00; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // C69F  STA $4007
+    RecompiledBegin(ctx, 0xC69F); bus.write(0x4007, cpu.A); cpu.totalCycles += 4;
+    // C6A2  RTS
+    { RecompiledBegin(ctx, 0xC6A2); cpu.SP++; const byte low = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); const byte high = bus.read(static_cast<memAddress>(0x0100 + cpu.SP + 1)); cpu.SP++; cpu.totalCycles += 6; cpu.PC = static_cast<memAddress>(RecompiledWord(low, high) + 1); return; }
+}
+
+static void Block_C6A3(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // C6A3  LDY #$4E
+    RecompiledBegin(ctx, 0xC6A3); cpu.Y = 0x4E; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // C6A5  LDA #$FF
+    RecompiledBegin(ctx, 0xC6A5); cpu.A = 0xFF; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // C6A7  STA $01
+    RecompiledBegin(ctx, 0xC6A7); bus.write(0x0001, cpu.A); cpu.totalCycles += 3;
+    // C6A9  JSR $C6B0
+    RecompiledBegin(ctx, 0xC6A9); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xC6); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xAB); cpu.totalCycles += 6; cpu.PC = 0xC6B0; return;
+}
+
+static void Block_C6AC(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // C6AC  JSR $C6B7
+    RecompiledBegin(ctx, 0xC6AC); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xC6); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xAE); cpu.totalCycles += 6; cpu.PC = 0xC6B7; return;
+}
+
+static void Block_C6AF(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // C6AF  RTS
+    { RecompiledBegin(ctx, 0xC6AF); cpu.SP++; const byte low = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); const byte high = bus.read(static_cast<memAddress>(0x0100 + cpu.SP + 1)); cpu.SP++; cpu.totalCycles += 6; cpu.PC = static_cast<memAddress>(RecompiledWord(low, high) + 1); return; }
+}
+
+static void Block_C6B0(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // C6B0  LDA #$FF
+    RecompiledBegin(ctx, 0xC6B0); cpu.A = 0xFF; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // C6B2  PHA
+    RecompiledBegin(ctx, 0xC6B2); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), cpu.A); cpu.totalCycles += 3;
+    // C6B3  LDA #$AA
+    RecompiledBegin(ctx, 0xC6B3); cpu.A = 0xAA; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // C6B5  BNE $C6BC
+    RecompiledBegin(ctx, 0xC6B5); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xC6BC; return; }
+    cpu.PC = 0xC6B7;
+}
+
+static void Block_C6B7(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // C6B7  LDA #$34
+    RecompiledBegin(ctx, 0xC6B7); cpu.A = 0x34; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // C6B9  PHA
+    RecompiledBegin(ctx, 0xC6B9); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), cpu.A); cpu.totalCycles += 3;
+    // C6BA  LDA #$55
+    RecompiledBegin(ctx, 0xC6BA); cpu.A = 0x55; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    cpu.PC = 0xC6BC;
+}
+
+static void Block_C6BC(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // C6BC  PLP
+    RecompiledBegin(ctx, 0xC6BC); cpu.SP++; cpu.status = static_cast<byte>((bus.read(static_cast<memAddress>(0x0100 + cpu.SP)) & 0xEF) | 0x20); cpu.totalCycles += 4;
+    cpu.PC = 0xC6BD;
+}
+
+static void Block_C72D(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // C72D  NOP
+    RecompiledBegin(ctx, 0xC72D); cpu.totalCycles += 2;
+    // C72E  SEC
+    RecompiledBegin(ctx, 0xC72E); SetFlag(cpu, Flags::C, true); cpu.totalCycles += 2;
+    // C72F  BCS $C735
+    RecompiledBegin(ctx, 0xC72F); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xC735; return; }
+    // C731  LDX #$01
+    RecompiledBegin(ctx, 0xC731); cpu.X = 0x01; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // C733  STX $00
+    RecompiledBegin(ctx, 0xC733); bus.write(0x0000, cpu.X); cpu.totalCycles += 3;
+    cpu.PC = 0xC735;
+}
+
+static void Block_C735(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    // C735  NOP
+    RecompiledBegin(ctx, 0xC735); cpu.totalCycles += 2;
+    // C736  CLC
+    RecompiledBegin(ctx, 0xC736); SetFlag(cpu, Flags::C, false); cpu.totalCycles += 2;
+    // C737  BCS $C73C
+    RecompiledBegin(ctx, 0xC737); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xC73C; return; }
+    // C739  JMP $C740
+    RecompiledBegin(ctx, 0xC739); cpu.totalCycles += 3; cpu.PC = 0xC740; return;
+}
+
+static void Block_C73C(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // C73C  LDX #$02
+    RecompiledBegin(ctx, 0xC73C); cpu.X = 0x02; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // C73E  STX $00
+    RecompiledBegin(ctx, 0xC73E); bus.write(0x0000, cpu.X); cpu.totalCycles += 3;
+    cpu.PC = 0xC740;
+}
+
+static void Block_C740(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    // C740  NOP
+    RecompiledBegin(ctx, 0xC740); cpu.totalCycles += 2;
+    // C741  SEC
+    RecompiledBegin(ctx, 0xC741); SetFlag(cpu, Flags::C, true); cpu.totalCycles += 2;
+    // C742  BCC $C747
+    RecompiledBegin(ctx, 0xC742); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xC747; return; }
+    // C744  JMP $C74B
+    RecompiledBegin(ctx, 0xC744); cpu.totalCycles += 3; cpu.PC = 0xC74B; return;
+}
+
+static void Block_C747(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // C747  LDX #$03
+    RecompiledBegin(ctx, 0xC747); cpu.X = 0x03; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // C749  STX $00
+    RecompiledBegin(ctx, 0xC749); bus.write(0x0000, cpu.X); cpu.totalCycles += 3;
+    cpu.PC = 0xC74B;
+}
+
+static void Block_C74B(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // C74B  NOP
+    RecompiledBegin(ctx, 0xC74B); cpu.totalCycles += 2;
+    // C74C  CLC
+    RecompiledBegin(ctx, 0xC74C); SetFlag(cpu, Flags::C, false); cpu.totalCycles += 2;
+    // C74D  BCC $C753
+    RecompiledBegin(ctx, 0xC74D); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xC753; return; }
+    // C74F  LDX #$04
+    RecompiledBegin(ctx, 0xC74F); cpu.X = 0x04; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // C751  STX $00
+    RecompiledBegin(ctx, 0xC751); bus.write(0x0000, cpu.X); cpu.totalCycles += 3;
+    cpu.PC = 0xC753;
+}
+
+static void Block_C753(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // C753  NOP
+    RecompiledBegin(ctx, 0xC753); cpu.totalCycles += 2;
+    // C754  LDA #$00
+    RecompiledBegin(ctx, 0xC754); cpu.A = 0x00; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // C756  BEQ $C75C
+    RecompiledBegin(ctx, 0xC756); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xC75C; return; }
+    // C758  LDX #$05
+    RecompiledBegin(ctx, 0xC758); cpu.X = 0x05; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // C75A  STX $00
+    RecompiledBegin(ctx, 0xC75A); bus.write(0x0000, cpu.X); cpu.totalCycles += 3;
+    cpu.PC = 0xC75C;
+}
+
+static void Block_C75C(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    // C75C  NOP
+    RecompiledBegin(ctx, 0xC75C); cpu.totalCycles += 2;
+    // C75D  LDA #$40
+    RecompiledBegin(ctx, 0xC75D); cpu.A = 0x40; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // C75F  BEQ $C764
+    RecompiledBegin(ctx, 0xC75F); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xC764; return; }
+    // C761  JMP $C768
+    RecompiledBegin(ctx, 0xC761); cpu.totalCycles += 3; cpu.PC = 0xC768; return;
+}
+
+static void Block_C764(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // C764  LDX #$06
+    RecompiledBegin(ctx, 0xC764); cpu.X = 0x06; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // C766  STX $00
+    RecompiledBegin(ctx, 0xC766); bus.write(0x0000, cpu.X); cpu.totalCycles += 3;
+    cpu.PC = 0xC768;
+}
+
+static void Block_C768(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // C768  NOP
+    RecompiledBegin(ctx, 0xC768); cpu.totalCycles += 2;
+    // C769  LDA #$40
+    RecompiledBegin(ctx, 0xC769); cpu.A = 0x40; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // C76B  BNE $C771
+    RecompiledBegin(ctx, 0xC76B); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xC771; return; }
+    // C76D  LDX #$07
+    RecompiledBegin(ctx, 0xC76D); cpu.X = 0x07; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // C76F  STX $00
+    RecompiledBegin(ctx, 0xC76F); bus.write(0x0000, cpu.X); cpu.totalCycles += 3;
+    cpu.PC = 0xC771;
+}
+
+static void Block_C771(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    // C771  NOP
+    RecompiledBegin(ctx, 0xC771); cpu.totalCycles += 2;
+    // C772  LDA #$00
+    RecompiledBegin(ctx, 0xC772); cpu.A = 0x00; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // C774  BNE $C779
+    RecompiledBegin(ctx, 0xC774); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xC779; return; }
+    // C776  JMP $C77D
+    RecompiledBegin(ctx, 0xC776); cpu.totalCycles += 3; cpu.PC = 0xC77D; return;
+}
+
+static void Block_C779(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // C779  LDX #$08
+    RecompiledBegin(ctx, 0xC779); cpu.X = 0x08; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // C77B  STX $00
+    RecompiledBegin(ctx, 0xC77B); bus.write(0x0000, cpu.X); cpu.totalCycles += 3;
+    cpu.PC = 0xC77D;
+}
+
+static void Block_C77D(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // C77D  NOP
+    RecompiledBegin(ctx, 0xC77D); cpu.totalCycles += 2;
+    // C77E  LDA #$FF
+    RecompiledBegin(ctx, 0xC77E); cpu.A = 0xFF; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // C780  STA $01
+    RecompiledBegin(ctx, 0xC780); bus.write(0x0001, cpu.A); cpu.totalCycles += 3;
+    // C782  BIT $01
+    RecompiledBegin(ctx, 0xC782); BitTest(cpu, bus.read(0x0001)); cpu.totalCycles += 3;
+    // C784  BVS $C78A
+    RecompiledBegin(ctx, 0xC784); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xC78A; return; }
+    // C786  LDX #$09
+    RecompiledBegin(ctx, 0xC786); cpu.X = 0x09; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // C788  STX $00
+    RecompiledBegin(ctx, 0xC788); bus.write(0x0000, cpu.X); cpu.totalCycles += 3;
+    cpu.PC = 0xC78A;
+}
+
+static void Block_C78A(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // C78A  NOP
+    RecompiledBegin(ctx, 0xC78A); cpu.totalCycles += 2;
+    // C78B  BIT $01
+    RecompiledBegin(ctx, 0xC78B); BitTest(cpu, bus.read(0x0001)); cpu.totalCycles += 3;
+    // C78D  BVC $C792
+    RecompiledBegin(ctx, 0xC78D); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xC792; return; }
+    // C78F  JMP $C796
+    RecompiledBegin(ctx, 0xC78F); cpu.totalCycles += 3; cpu.PC = 0xC796; return;
+}
+
+static void Block_C792(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // C792  LDX #$0A
+    RecompiledBegin(ctx, 0xC792); cpu.X = 0x0A; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // C794  STX $00
+    RecompiledBegin(ctx, 0xC794); bus.write(0x0000, cpu.X); cpu.totalCycles += 3;
+    cpu.PC = 0xC796;
+}
+
+static void Block_C796(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // C796  NOP
+    RecompiledBegin(ctx, 0xC796); cpu.totalCycles += 2;
+    // C797  LDA #$00
+    RecompiledBegin(ctx, 0xC797); cpu.A = 0x00; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // C799  STA $01
+    RecompiledBegin(ctx, 0xC799); bus.write(0x0001, cpu.A); cpu.totalCycles += 3;
+    // C79B  BIT $01
+    RecompiledBegin(ctx, 0xC79B); BitTest(cpu, bus.read(0x0001)); cpu.totalCycles += 3;
+    // C79D  BVC $C7A3
+    RecompiledBegin(ctx, 0xC79D); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xC7A3; return; }
+    // C79F  LDX #$0B
+    RecompiledBegin(ctx, 0xC79F); cpu.X = 0x0B; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // C7A1  STX $00
+    RecompiledBegin(ctx, 0xC7A1); bus.write(0x0000, cpu.X); cpu.totalCycles += 3;
+    cpu.PC = 0xC7A3;
+}
+
+static void Block_C7A3(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // C7A3  NOP
+    RecompiledBegin(ctx, 0xC7A3); cpu.totalCycles += 2;
+    // C7A4  BIT $01
+    RecompiledBegin(ctx, 0xC7A4); BitTest(cpu, bus.read(0x0001)); cpu.totalCycles += 3;
+    // C7A6  BVS $C7AB
+    RecompiledBegin(ctx, 0xC7A6); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xC7AB; return; }
+    // C7A8  JMP $C7AF
+    RecompiledBegin(ctx, 0xC7A8); cpu.totalCycles += 3; cpu.PC = 0xC7AF; return;
+}
+
+static void Block_C7AB(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // C7AB  LDX #$0C
+    RecompiledBegin(ctx, 0xC7AB); cpu.X = 0x0C; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // C7AD  STX $00
+    RecompiledBegin(ctx, 0xC7AD); bus.write(0x0000, cpu.X); cpu.totalCycles += 3;
+    cpu.PC = 0xC7AF;
+}
+
+static void Block_C7AF(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // C7AF  NOP
+    RecompiledBegin(ctx, 0xC7AF); cpu.totalCycles += 2;
+    // C7B0  LDA #$00
+    RecompiledBegin(ctx, 0xC7B0); cpu.A = 0x00; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // C7B2  BPL $C7B8
+    RecompiledBegin(ctx, 0xC7B2); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xC7B8; return; }
+    // C7B4  LDX #$0D
+    RecompiledBegin(ctx, 0xC7B4); cpu.X = 0x0D; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // C7B6  STX $00
+    RecompiledBegin(ctx, 0xC7B6); bus.write(0x0000, cpu.X); cpu.totalCycles += 3;
+    cpu.PC = 0xC7B8;
+}
+
+static void Block_C7B8(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    // C7B8  NOP
+    RecompiledBegin(ctx, 0xC7B8); cpu.totalCycles += 2;
+    // C7B9  LDA #$80
+    RecompiledBegin(ctx, 0xC7B9); cpu.A = 0x80; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // C7BB  BPL $C7C0
+    RecompiledBegin(ctx, 0xC7BB); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xC7C0; return; }
+    // C7BD  JMP $C7D9
+    RecompiledBegin(ctx, 0xC7BD); cpu.totalCycles += 3; cpu.PC = 0xC7D9; return;
+}
+
+static void Block_C7C0(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // C7C0  LDX #$0E
+    RecompiledBegin(ctx, 0xC7C0); cpu.X = 0x0E; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // C7C2  STX $00
+    RecompiledBegin(ctx, 0xC7C2); bus.write(0x0000, cpu.X); cpu.totalCycles += 3;
+    // C7C4  NOP
+    RecompiledBegin(ctx, 0xC7C4); cpu.totalCycles += 2;
+    // C7C5  LDA #$80
+    RecompiledBegin(ctx, 0xC7C5); cpu.A = 0x80; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // C7C7  BMI $C7CD
+    RecompiledBegin(ctx, 0xC7C7); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xC7CD; return; }
+    // C7C9  LDX #$0F
+    RecompiledBegin(ctx, 0xC7C9); cpu.X = 0x0F; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // C7CB  STX $00
+    RecompiledBegin(ctx, 0xC7CB); bus.write(0x0000, cpu.X); cpu.totalCycles += 3;
+    cpu.PC = 0xC7CD;
+}
+
+static void Block_C7CD(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    // C7CD  NOP
+    RecompiledBegin(ctx, 0xC7CD); cpu.totalCycles += 2;
+    // C7CE  LDA #$00
+    RecompiledBegin(ctx, 0xC7CE); cpu.A = 0x00; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // C7D0  BMI $C7D5
+    RecompiledBegin(ctx, 0xC7D0); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xC7D5; return; }
+    // C7D2  JMP $C7D9
+    RecompiledBegin(ctx, 0xC7D2); cpu.totalCycles += 3; cpu.PC = 0xC7D9; return;
+}
+
+static void Block_C7D5(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // C7D5  LDX #$10
+    RecompiledBegin(ctx, 0xC7D5); cpu.X = 0x10; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // C7D7  STX $00
+    RecompiledBegin(ctx, 0xC7D7); bus.write(0x0000, cpu.X); cpu.totalCycles += 3;
+    cpu.PC = 0xC7D9;
+}
+
+static void Block_C7D9(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // C7D9  NOP
+    RecompiledBegin(ctx, 0xC7D9); cpu.totalCycles += 2;
+    // C7DA  RTS
+    { RecompiledBegin(ctx, 0xC7DA); cpu.SP++; const byte low = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); const byte high = bus.read(static_cast<memAddress>(0x0100 + cpu.SP + 1)); cpu.SP++; cpu.totalCycles += 6; cpu.PC = static_cast<memAddress>(RecompiledWord(low, high) + 1); return; }
+}
+
+static void Block_C7DB(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // C7DB  NOP
+    RecompiledBegin(ctx, 0xC7DB); cpu.totalCycles += 2;
+    // C7DC  LDA #$FF
+    RecompiledBegin(ctx, 0xC7DC); cpu.A = 0xFF; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // C7DE  STA $01
+    RecompiledBegin(ctx, 0xC7DE); bus.write(0x0001, cpu.A); cpu.totalCycles += 3;
+    // C7E0  BIT $01
+    RecompiledBegin(ctx, 0xC7E0); BitTest(cpu, bus.read(0x0001)); cpu.totalCycles += 3;
+    // C7E2  LDA #$00
+    RecompiledBegin(ctx, 0xC7E2); cpu.A = 0x00; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // C7E4  SEC
+    RecompiledBegin(ctx, 0xC7E4); SetFlag(cpu, Flags::C, true); cpu.totalCycles += 2;
+    // C7E5  SEI
+    RecompiledBegin(ctx, 0xC7E5); SetFlag(cpu, Flags::I, true); cpu.totalCycles += 2;
+    // C7E6  SED
+    RecompiledBegin(ctx, 0xC7E6); SetFlag(cpu, Flags::D, true); cpu.totalCycles += 2;
+    // C7E7  PHP
+    RecompiledBegin(ctx, 0xC7E7); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), static_cast<byte>(cpu.status | 0x30)); cpu.totalCycles += 3;
+    // C7E8  PLA
+    RecompiledBegin(ctx, 0xC7E8); cpu.SP++; cpu.A = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); SetNZ(cpu, cpu.A); cpu.totalCycles += 4;
+    // C7E9  AND #$EF
+    RecompiledBegin(ctx, 0xC7E9); cpu.A = static_cast<byte>(cpu.A & 0xEF); SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // C7EB  CMP #$6F
+    RecompiledBegin(ctx, 0xC7EB); Compare(cpu, cpu.A, 0x6F); cpu.totalCycles += 2;
+    // C7ED  BEQ $C7F3
+    RecompiledBegin(ctx, 0xC7ED); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xC7F3; return; }
+    // C7EF  LDX #$11
+    RecompiledBegin(ctx, 0xC7EF); cpu.X = 0x11; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // C7F1  STX $00
+    RecompiledBegin(ctx, 0xC7F1); bus.write(0x0000, cpu.X); cpu.totalCycles += 3;
+    cpu.PC = 0xC7F3;
+}
+
+static void Block_C7F3(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // C7F3  NOP
+    RecompiledBegin(ctx, 0xC7F3); cpu.totalCycles += 2;
+    // C7F4  LDA #$40
+    RecompiledBegin(ctx, 0xC7F4); cpu.A = 0x40; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // C7F6  STA $01
+    RecompiledBegin(ctx, 0xC7F6); bus.write(0x0001, cpu.A); cpu.totalCycles += 3;
+    // C7F8  BIT $01
+    RecompiledBegin(ctx, 0xC7F8); BitTest(cpu, bus.read(0x0001)); cpu.totalCycles += 3;
+    // C7FA  CLD
+    RecompiledBegin(ctx, 0xC7FA); SetFlag(cpu, Flags::D, false); cpu.totalCycles += 2;
+    // C7FB  LDA #$10
+    RecompiledBegin(ctx, 0xC7FB); cpu.A = 0x10; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // C7FD  CLC
+    RecompiledBegin(ctx, 0xC7FD); SetFlag(cpu, Flags::C, false); cpu.totalCycles += 2;
+    // C7FE  PHP
+    RecompiledBegin(ctx, 0xC7FE); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), static_cast<byte>(cpu.status | 0x30)); cpu.totalCycles += 3;
+    // C7FF  PLA
+    RecompiledBegin(ctx, 0xC7FF); cpu.SP++; cpu.A = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); SetNZ(cpu, cpu.A); cpu.totalCycles += 4;
+    // C800  AND #$EF
+    RecompiledBegin(ctx, 0xC800); cpu.A = static_cast<byte>(cpu.A & 0xEF); SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // C802  CMP #$64
+    RecompiledBegin(ctx, 0xC802); Compare(cpu, cpu.A, 0x64); cpu.totalCycles += 2;
+    // C804  BEQ $C80A
+    RecompiledBegin(ctx, 0xC804); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xC80A; return; }
+    // C806  LDX #$12
+    RecompiledBegin(ctx, 0xC806); cpu.X = 0x12; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // C808  STX $00
+    RecompiledBegin(ctx, 0xC808); bus.write(0x0000, cpu.X); cpu.totalCycles += 3;
+    cpu.PC = 0xC80A;
+}
+
+static void Block_C80A(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // C80A  NOP
+    RecompiledBegin(ctx, 0xC80A); cpu.totalCycles += 2;
+    // C80B  LDA #$80
+    RecompiledBegin(ctx, 0xC80B); cpu.A = 0x80; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // C80D  STA $01
+    RecompiledBegin(ctx, 0xC80D); bus.write(0x0001, cpu.A); cpu.totalCycles += 3;
+    // C80F  BIT $01
+    RecompiledBegin(ctx, 0xC80F); BitTest(cpu, bus.read(0x0001)); cpu.totalCycles += 3;
+    // C811  SED
+    RecompiledBegin(ctx, 0xC811); SetFlag(cpu, Flags::D, true); cpu.totalCycles += 2;
+    // C812  LDA #$00
+    RecompiledBegin(ctx, 0xC812); cpu.A = 0x00; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // C814  SEC
+    RecompiledBegin(ctx, 0xC814); SetFlag(cpu, Flags::C, true); cpu.totalCycles += 2;
+    // C815  PHP
+    RecompiledBegin(ctx, 0xC815); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), static_cast<byte>(cpu.status | 0x30)); cpu.totalCycles += 3;
+    // C816  PLA
+    RecompiledBegin(ctx, 0xC816); cpu.SP++; cpu.A = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); SetNZ(cpu, cpu.A); cpu.totalCycles += 4;
+    // C817  AND #$EF
+    RecompiledBegin(ctx, 0xC817); cpu.A = static_cast<byte>(cpu.A & 0xEF); SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // C819  CMP #$2F
+    RecompiledBegin(ctx, 0xC819); Compare(cpu, cpu.A, 0x2F); cpu.totalCycles += 2;
+    // C81B  BEQ $C821
+    RecompiledBegin(ctx, 0xC81B); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xC821; return; }
+    // C81D  LDX #$13
+    RecompiledBegin(ctx, 0xC81D); cpu.X = 0x13; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // C81F  STX $00
+    RecompiledBegin(ctx, 0xC81F); bus.write(0x0000, cpu.X); cpu.totalCycles += 3;
+    cpu.PC = 0xC821;
+}
+
+static void Block_C821(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // C821  NOP
+    RecompiledBegin(ctx, 0xC821); cpu.totalCycles += 2;
+    // C822  LDA #$FF
+    RecompiledBegin(ctx, 0xC822); cpu.A = 0xFF; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // C824  PHA
+    RecompiledBegin(ctx, 0xC824); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), cpu.A); cpu.totalCycles += 3;
+    // C825  PLP
+    RecompiledBegin(ctx, 0xC825); cpu.SP++; cpu.status = static_cast<byte>((bus.read(static_cast<memAddress>(0x0100 + cpu.SP)) & 0xEF) | 0x20); cpu.totalCycles += 4;
+    // C826  BNE $C831
+    RecompiledBegin(ctx, 0xC826); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xC831; return; }
+    // C828  BPL $C831
+    RecompiledBegin(ctx, 0xC828); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xC831; return; }
+    // C82A  BVC $C831
+    RecompiledBegin(ctx, 0xC82A); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xC831; return; }
+    // C82C  BCC $C831
+    RecompiledBegin(ctx, 0xC82C); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xC831; return; }
+    // C82E  JMP $C835
+    RecompiledBegin(ctx, 0xC82E); cpu.totalCycles += 3; cpu.PC = 0xC835; return;
+}
+
+static void Block_C831(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // C831  LDX #$14
+    RecompiledBegin(ctx, 0xC831); cpu.X = 0x14; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // C833  STX $00
+    RecompiledBegin(ctx, 0xC833); bus.write(0x0000, cpu.X); cpu.totalCycles += 3;
+    cpu.PC = 0xC835;
+}
+
+static void Block_C835(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // C835  NOP
+    RecompiledBegin(ctx, 0xC835); cpu.totalCycles += 2;
+    // C836  LDA #$04
+    RecompiledBegin(ctx, 0xC836); cpu.A = 0x04; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // C838  PHA
+    RecompiledBegin(ctx, 0xC838); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), cpu.A); cpu.totalCycles += 3;
+    // C839  PLP
+    RecompiledBegin(ctx, 0xC839); cpu.SP++; cpu.status = static_cast<byte>((bus.read(static_cast<memAddress>(0x0100 + cpu.SP)) & 0xEF) | 0x20); cpu.totalCycles += 4;
+    // C83A  BEQ $C845
+    RecompiledBegin(ctx, 0xC83A); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xC845; return; }
+    // C83C  BMI $C845
+    RecompiledBegin(ctx, 0xC83C); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xC845; return; }
+    // C83E  BVS $C845
+    RecompiledBegin(ctx, 0xC83E); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xC845; return; }
+    // C840  BCS $C845
+    RecompiledBegin(ctx, 0xC840); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xC845; return; }
+    // C842  JMP $C849
+    RecompiledBegin(ctx, 0xC842); cpu.totalCycles += 3; cpu.PC = 0xC849; return;
+}
+
+static void Block_C845(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // C845  LDX #$15
+    RecompiledBegin(ctx, 0xC845); cpu.X = 0x15; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // C847  STX $00
+    RecompiledBegin(ctx, 0xC847); bus.write(0x0000, cpu.X); cpu.totalCycles += 3;
+    cpu.PC = 0xC849;
+}
+
+static void Block_C849(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // C849  NOP
+    RecompiledBegin(ctx, 0xC849); cpu.totalCycles += 2;
+    // C84A  SED
+    RecompiledBegin(ctx, 0xC84A); SetFlag(cpu, Flags::D, true); cpu.totalCycles += 2;
+    // C84B  LDA #$FF
+    RecompiledBegin(ctx, 0xC84B); cpu.A = 0xFF; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // C84D  STA $01
+    RecompiledBegin(ctx, 0xC84D); bus.write(0x0001, cpu.A); cpu.totalCycles += 3;
+    // C84F  BIT $01
+    RecompiledBegin(ctx, 0xC84F); BitTest(cpu, bus.read(0x0001)); cpu.totalCycles += 3;
+    // C851  CLC
+    RecompiledBegin(ctx, 0xC851); SetFlag(cpu, Flags::C, false); cpu.totalCycles += 2;
+    // C852  LDA #$00
+    RecompiledBegin(ctx, 0xC852); cpu.A = 0x00; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // C854  PHA
+    RecompiledBegin(ctx, 0xC854); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), cpu.A); cpu.totalCycles += 3;
+    // C855  LDA #$FF
+    RecompiledBegin(ctx, 0xC855); cpu.A = 0xFF; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // C857  PLA
+    RecompiledBegin(ctx, 0xC857); cpu.SP++; cpu.A = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); SetNZ(cpu, cpu.A); cpu.totalCycles += 4;
+    // C858  BNE $C863
+    RecompiledBegin(ctx, 0xC858); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xC863; return; }
+    // C85A  BMI $C863
+    RecompiledBegin(ctx, 0xC85A); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xC863; return; }
+    // C85C  BVC $C863
+    RecompiledBegin(ctx, 0xC85C); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xC863; return; }
+    // C85E  BCS $C863
+    RecompiledBegin(ctx, 0xC85E); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xC863; return; }
+    // C860  JMP $C867
+    RecompiledBegin(ctx, 0xC860); cpu.totalCycles += 3; cpu.PC = 0xC867; return;
+}
+
+static void Block_C863(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // C863  LDX #$16
+    RecompiledBegin(ctx, 0xC863); cpu.X = 0x16; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // C865  STX $00
+    RecompiledBegin(ctx, 0xC865); bus.write(0x0000, cpu.X); cpu.totalCycles += 3;
+    cpu.PC = 0xC867;
+}
+
+static void Block_C867(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // C867  NOP
+    RecompiledBegin(ctx, 0xC867); cpu.totalCycles += 2;
+    // C868  LDA #$00
+    RecompiledBegin(ctx, 0xC868); cpu.A = 0x00; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // C86A  STA $01
+    RecompiledBegin(ctx, 0xC86A); bus.write(0x0001, cpu.A); cpu.totalCycles += 3;
+    // C86C  BIT $01
+    RecompiledBegin(ctx, 0xC86C); BitTest(cpu, bus.read(0x0001)); cpu.totalCycles += 3;
+    // C86E  SEC
+    RecompiledBegin(ctx, 0xC86E); SetFlag(cpu, Flags::C, true); cpu.totalCycles += 2;
+    // C86F  LDA #$FF
+    RecompiledBegin(ctx, 0xC86F); cpu.A = 0xFF; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // C871  PHA
+    RecompiledBegin(ctx, 0xC871); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), cpu.A); cpu.totalCycles += 3;
+    // C872  LDA #$00
+    RecompiledBegin(ctx, 0xC872); cpu.A = 0x00; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // C874  PLA
+    RecompiledBegin(ctx, 0xC874); cpu.SP++; cpu.A = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); SetNZ(cpu, cpu.A); cpu.totalCycles += 4;
+    // C875  BEQ $C880
+    RecompiledBegin(ctx, 0xC875); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xC880; return; }
+    // C877  BPL $C880
+    RecompiledBegin(ctx, 0xC877); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xC880; return; }
+    // C879  BVS $C880
+    RecompiledBegin(ctx, 0xC879); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xC880; return; }
+    // C87B  BCC $C880
+    RecompiledBegin(ctx, 0xC87B); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xC880; return; }
+    // C87D  JMP $C884
+    RecompiledBegin(ctx, 0xC87D); cpu.totalCycles += 3; cpu.PC = 0xC884; return;
+}
+
+static void Block_C880(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // C880  LDX #$17
+    RecompiledBegin(ctx, 0xC880); cpu.X = 0x17; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // C882  STX $00
+    RecompiledBegin(ctx, 0xC882); bus.write(0x0000, cpu.X); cpu.totalCycles += 3;
+    cpu.PC = 0xC884;
+}
+
+static void Block_C884(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // C884  RTS
+    { RecompiledBegin(ctx, 0xC884); cpu.SP++; const byte low = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); const byte high = bus.read(static_cast<memAddress>(0x0100 + cpu.SP + 1)); cpu.SP++; cpu.totalCycles += 6; cpu.PC = static_cast<memAddress>(RecompiledWord(low, high) + 1); return; }
+}
+
+static void Block_C885(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // C885  NOP
+    RecompiledBegin(ctx, 0xC885); cpu.totalCycles += 2;
+    // C886  CLC
+    RecompiledBegin(ctx, 0xC886); SetFlag(cpu, Flags::C, false); cpu.totalCycles += 2;
+    // C887  LDA #$FF
+    RecompiledBegin(ctx, 0xC887); cpu.A = 0xFF; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // C889  STA $01
+    RecompiledBegin(ctx, 0xC889); bus.write(0x0001, cpu.A); cpu.totalCycles += 3;
+    // C88B  BIT $01
+    RecompiledBegin(ctx, 0xC88B); BitTest(cpu, bus.read(0x0001)); cpu.totalCycles += 3;
+    // C88D  LDA #$55
+    RecompiledBegin(ctx, 0xC88D); cpu.A = 0x55; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // C88F  ORA #$AA
+    RecompiledBegin(ctx, 0xC88F); cpu.A = static_cast<byte>(cpu.A | 0xAA); SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // C891  BCS $C89E
+    RecompiledBegin(ctx, 0xC891); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xC89E; return; }
+    // C893  BPL $C89E
+    RecompiledBegin(ctx, 0xC893); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xC89E; return; }
+    // C895  CMP #$FF
+    RecompiledBegin(ctx, 0xC895); Compare(cpu, cpu.A, 0xFF); cpu.totalCycles += 2;
+    // C897  BNE $C89E
+    RecompiledBegin(ctx, 0xC897); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xC89E; return; }
+    // C899  BVC $C89E
+    RecompiledBegin(ctx, 0xC899); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xC89E; return; }
+    // C89B  JMP $C8A2
+    RecompiledBegin(ctx, 0xC89B); cpu.totalCycles += 3; cpu.PC = 0xC8A2; return;
+}
+
+static void Block_C89E(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // C89E  LDX #$18
+    RecompiledBegin(ctx, 0xC89E); cpu.X = 0x18; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // C8A0  STX $00
+    RecompiledBegin(ctx, 0xC8A0); bus.write(0x0000, cpu.X); cpu.totalCycles += 3;
+    cpu.PC = 0xC8A2;
+}
+
+static void Block_C8A2(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    // C8A2  NOP
+    RecompiledBegin(ctx, 0xC8A2); cpu.totalCycles += 2;
+    // C8A3  SEC
+    RecompiledBegin(ctx, 0xC8A3); SetFlag(cpu, Flags::C, true); cpu.totalCycles += 2;
+    // C8A4  CLV
+    RecompiledBegin(ctx, 0xC8A4); SetFlag(cpu, Flags::V, false); cpu.totalCycles += 2;
+    // C8A5  LDA #$00
+    RecompiledBegin(ctx, 0xC8A5); cpu.A = 0x00; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // C8A7  ORA #$00
+    RecompiledBegin(ctx, 0xC8A7); cpu.A = static_cast<byte>(cpu.A | 0x00); SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // C8A9  BNE $C8B4
+    RecompiledBegin(ctx, 0xC8A9); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xC8B4; return; }
+    // C8AB  BVS $C8B4
+    RecompiledBegin(ctx, 0xC8AB); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xC8B4; return; }
+    // C8AD  BCC $C8B4
+    RecompiledBegin(ctx, 0xC8AD); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xC8B4; return; }
+    // C8AF  BMI $C8B4
+    RecompiledBegin(ctx, 0xC8AF); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xC8B4; return; }
+    // C8B1  JMP $C8B8
+    RecompiledBegin(ctx, 0xC8B1); cpu.totalCycles += 3; cpu.PC = 0xC8B8; return;
+}
+
+static void Block_C8B4(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // C8B4  LDX #$19
+    RecompiledBegin(ctx, 0xC8B4); cpu.X = 0x19; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // C8B6  STX $00
+    RecompiledBegin(ctx, 0xC8B6); bus.write(0x0000, cpu.X); cpu.totalCycles += 3;
+    cpu.PC = 0xC8B8;
+}
+
+static void Block_C8B8(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // C8B8  NOP
+    RecompiledBegin(ctx, 0xC8B8); cpu.totalCycles += 2;
+    // C8B9  CLC
+    RecompiledBegin(ctx, 0xC8B9); SetFlag(cpu, Flags::C, false); cpu.totalCycles += 2;
+    // C8BA  BIT $01
+    RecompiledBegin(ctx, 0xC8BA); BitTest(cpu, bus.read(0x0001)); cpu.totalCycles += 3;
+    // C8BC  LDA #$55
+    RecompiledBegin(ctx, 0xC8BC); cpu.A = 0x55; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // C8BE  AND #$AA
+    RecompiledBegin(ctx, 0xC8BE); cpu.A = static_cast<byte>(cpu.A & 0xAA); SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // C8C0  BNE $C8CB
+    RecompiledBegin(ctx, 0xC8C0); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xC8CB; return; }
+    // C8C2  BVC $C8CB
+    RecompiledBegin(ctx, 0xC8C2); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xC8CB; return; }
+    // C8C4  BCS $C8CB
+    RecompiledBegin(ctx, 0xC8C4); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xC8CB; return; }
+    // C8C6  BMI $C8CB
+    RecompiledBegin(ctx, 0xC8C6); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xC8CB; return; }
+    // C8C8  JMP $C8CF
+    RecompiledBegin(ctx, 0xC8C8); cpu.totalCycles += 3; cpu.PC = 0xC8CF; return;
+}
+
+static void Block_C8CB(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // C8CB  LDX #$1A
+    RecompiledBegin(ctx, 0xC8CB); cpu.X = 0x1A; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // C8CD  STX $00
+    RecompiledBegin(ctx, 0xC8CD); bus.write(0x0000, cpu.X); cpu.totalCycles += 3;
+    cpu.PC = 0xC8CF;
+}
+
+static void Block_C8CF(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    // C8CF  NOP
+    RecompiledBegin(ctx, 0xC8CF); cpu.totalCycles += 2;
+    // C8D0  SEC
+    RecompiledBegin(ctx, 0xC8D0); SetFlag(cpu, Flags::C, true); cpu.totalCycles += 2;
+    // C8D1  CLV
+    RecompiledBegin(ctx, 0xC8D1); SetFlag(cpu, Flags::V, false); cpu.totalCycles += 2;
+    // C8D2  LDA #$F8
+    RecompiledBegin(ctx, 0xC8D2); cpu.A = 0xF8; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // C8D4  AND #$EF
+    RecompiledBegin(ctx, 0xC8D4); cpu.A = static_cast<byte>(cpu.A & 0xEF); SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // C8D6  BCC $C8E3
+    RecompiledBegin(ctx, 0xC8D6); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xC8E3; return; }
+    // C8D8  BPL $C8E3
+    RecompiledBegin(ctx, 0xC8D8); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xC8E3; return; }
+    // C8DA  CMP #$E8
+    RecompiledBegin(ctx, 0xC8DA); Compare(cpu, cpu.A, 0xE8); cpu.totalCycles += 2;
+    // C8DC  BNE $C8E3
+    RecompiledBegin(ctx, 0xC8DC); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xC8E3; return; }
+    // C8DE  BVS $C8E3
+    RecompiledBegin(ctx, 0xC8DE); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xC8E3; return; }
+    // C8E0  JMP $C8E7
+    RecompiledBegin(ctx, 0xC8E0); cpu.totalCycles += 3; cpu.PC = 0xC8E7; return;
+}
+
+static void Block_C8E3(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // C8E3  LDX #$1B
+    RecompiledBegin(ctx, 0xC8E3); cpu.X = 0x1B; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // C8E5  STX $00
+    RecompiledBegin(ctx, 0xC8E5); bus.write(0x0000, cpu.X); cpu.totalCycles += 3;
+    cpu.PC = 0xC8E7;
+}
+
+static void Block_C8E7(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // C8E7  NOP
+    RecompiledBegin(ctx, 0xC8E7); cpu.totalCycles += 2;
+    // C8E8  CLC
+    RecompiledBegin(ctx, 0xC8E8); SetFlag(cpu, Flags::C, false); cpu.totalCycles += 2;
+    // C8E9  BIT $01
+    RecompiledBegin(ctx, 0xC8E9); BitTest(cpu, bus.read(0x0001)); cpu.totalCycles += 3;
+    // C8EB  LDA #$5F
+    RecompiledBegin(ctx, 0xC8EB); cpu.A = 0x5F; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // C8ED  EOR #$AA
+    RecompiledBegin(ctx, 0xC8ED); cpu.A = static_cast<byte>(cpu.A ^ 0xAA); SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // C8EF  BCS $C8FC
+    RecompiledBegin(ctx, 0xC8EF); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xC8FC; return; }
+    // C8F1  BPL $C8FC
+    RecompiledBegin(ctx, 0xC8F1); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xC8FC; return; }
+    // C8F3  CMP #$F5
+    RecompiledBegin(ctx, 0xC8F3); Compare(cpu, cpu.A, 0xF5); cpu.totalCycles += 2;
+    // C8F5  BNE $C8FC
+    RecompiledBegin(ctx, 0xC8F5); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xC8FC; return; }
+    // C8F7  BVC $C8FC
+    RecompiledBegin(ctx, 0xC8F7); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xC8FC; return; }
+    // C8F9  JMP $C900
+    RecompiledBegin(ctx, 0xC8F9); cpu.totalCycles += 3; cpu.PC = 0xC900; return;
+}
+
+static void Block_C8FC(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // C8FC  LDX #$1C
+    RecompiledBegin(ctx, 0xC8FC); cpu.X = 0x1C; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // C8FE  STX $00
+    RecompiledBegin(ctx, 0xC8FE); bus.write(0x0000, cpu.X); cpu.totalCycles += 3;
+    cpu.PC = 0xC900;
+}
+
+static void Block_C900(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    // C900  NOP
+    RecompiledBegin(ctx, 0xC900); cpu.totalCycles += 2;
+    // C901  SEC
+    RecompiledBegin(ctx, 0xC901); SetFlag(cpu, Flags::C, true); cpu.totalCycles += 2;
+    // C902  CLV
+    RecompiledBegin(ctx, 0xC902); SetFlag(cpu, Flags::V, false); cpu.totalCycles += 2;
+    // C903  LDA #$70
+    RecompiledBegin(ctx, 0xC903); cpu.A = 0x70; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // C905  EOR #$70
+    RecompiledBegin(ctx, 0xC905); cpu.A = static_cast<byte>(cpu.A ^ 0x70); SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // C907  BNE $C912
+    RecompiledBegin(ctx, 0xC907); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xC912; return; }
+    // C909  BVS $C912
+    RecompiledBegin(ctx, 0xC909); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xC912; return; }
+    // C90B  BCC $C912
+    RecompiledBegin(ctx, 0xC90B); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xC912; return; }
+    // C90D  BMI $C912
+    RecompiledBegin(ctx, 0xC90D); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xC912; return; }
+    // C90F  JMP $C916
+    RecompiledBegin(ctx, 0xC90F); cpu.totalCycles += 3; cpu.PC = 0xC916; return;
+}
+
+static void Block_C912(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // C912  LDX #$1D
+    RecompiledBegin(ctx, 0xC912); cpu.X = 0x1D; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // C914  STX $00
+    RecompiledBegin(ctx, 0xC914); bus.write(0x0000, cpu.X); cpu.totalCycles += 3;
+    cpu.PC = 0xC916;
+}
+
+static void Block_C916(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // C916  NOP
+    RecompiledBegin(ctx, 0xC916); cpu.totalCycles += 2;
+    // C917  CLC
+    RecompiledBegin(ctx, 0xC917); SetFlag(cpu, Flags::C, false); cpu.totalCycles += 2;
+    // C918  BIT $01
+    RecompiledBegin(ctx, 0xC918); BitTest(cpu, bus.read(0x0001)); cpu.totalCycles += 3;
+    // C91A  LDA #$00
+    RecompiledBegin(ctx, 0xC91A); cpu.A = 0x00; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // C91C  ADC #$69
+    RecompiledBegin(ctx, 0xC91C); AddBinary(cpu, 0x69); cpu.totalCycles += 2;
+    // C91E  BMI $C92B
+    RecompiledBegin(ctx, 0xC91E); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xC92B; return; }
+    // C920  BCS $C92B
+    RecompiledBegin(ctx, 0xC920); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xC92B; return; }
+    // C922  CMP #$69
+    RecompiledBegin(ctx, 0xC922); Compare(cpu, cpu.A, 0x69); cpu.totalCycles += 2;
+    // C924  BNE $C92B
+    RecompiledBegin(ctx, 0xC924); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xC92B; return; }
+    // C926  BVS $C92B
+    RecompiledBegin(ctx, 0xC926); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xC92B; return; }
+    // C928  JMP $C92F
+    RecompiledBegin(ctx, 0xC928); cpu.totalCycles += 3; cpu.PC = 0xC92F; return;
+}
+
+static void Block_C92B(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // C92B  LDX #$1E
+    RecompiledBegin(ctx, 0xC92B); cpu.X = 0x1E; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // C92D  STX $00
+    RecompiledBegin(ctx, 0xC92D); bus.write(0x0000, cpu.X); cpu.totalCycles += 3;
+    cpu.PC = 0xC92F;
+}
+
+static void Block_C92F(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // C92F  NOP
+    RecompiledBegin(ctx, 0xC92F); cpu.totalCycles += 2;
+    // C930  SEC
+    RecompiledBegin(ctx, 0xC930); SetFlag(cpu, Flags::C, true); cpu.totalCycles += 2;
+    // C931  SED
+    RecompiledBegin(ctx, 0xC931); SetFlag(cpu, Flags::D, true); cpu.totalCycles += 2;
+    // C932  BIT $01
+    RecompiledBegin(ctx, 0xC932); BitTest(cpu, bus.read(0x0001)); cpu.totalCycles += 3;
+    // C934  LDA #$01
+    RecompiledBegin(ctx, 0xC934); cpu.A = 0x01; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // C936  ADC #$69
+    RecompiledBegin(ctx, 0xC936); AddBinary(cpu, 0x69); cpu.totalCycles += 2;
+    // C938  BMI $C945
+    RecompiledBegin(ctx, 0xC938); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xC945; return; }
+    // C93A  BCS $C945
+    RecompiledBegin(ctx, 0xC93A); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xC945; return; }
+    // C93C  CMP #$6B
+    RecompiledBegin(ctx, 0xC93C); Compare(cpu, cpu.A, 0x6B); cpu.totalCycles += 2;
+    // C93E  BNE $C945
+    RecompiledBegin(ctx, 0xC93E); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xC945; return; }
+    // C940  BVS $C945
+    RecompiledBegin(ctx, 0xC940); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xC945; return; }
+    // C942  JMP $C949
+    RecompiledBegin(ctx, 0xC942); cpu.totalCycles += 3; cpu.PC = 0xC949; return;
+}
+
+static void Block_C945(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // C945  LDX #$1F
+    RecompiledBegin(ctx, 0xC945); cpu.X = 0x1F; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // C947  STX $00
+    RecompiledBegin(ctx, 0xC947); bus.write(0x0000, cpu.X); cpu.totalCycles += 3;
+    cpu.PC = 0xC949;
+}
+
+static void Block_C949(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    // C949  NOP
+    RecompiledBegin(ctx, 0xC949); cpu.totalCycles += 2;
+    // C94A  CLD
+    RecompiledBegin(ctx, 0xC94A); SetFlag(cpu, Flags::D, false); cpu.totalCycles += 2;
+    // C94B  SEC
+    RecompiledBegin(ctx, 0xC94B); SetFlag(cpu, Flags::C, true); cpu.totalCycles += 2;
+    // C94C  CLV
+    RecompiledBegin(ctx, 0xC94C); SetFlag(cpu, Flags::V, false); cpu.totalCycles += 2;
+    // C94D  LDA #$7F
+    RecompiledBegin(ctx, 0xC94D); cpu.A = 0x7F; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // C94F  ADC #$7F
+    RecompiledBegin(ctx, 0xC94F); AddBinary(cpu, 0x7F); cpu.totalCycles += 2;
+    // C951  BPL $C95E
+    RecompiledBegin(ctx, 0xC951); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xC95E; return; }
+    // C953  BCS $C95E
+    RecompiledBegin(ctx, 0xC953); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xC95E; return; }
+    // C955  CMP #$FF
+    RecompiledBegin(ctx, 0xC955); Compare(cpu, cpu.A, 0xFF); cpu.totalCycles += 2;
+    // C957  BNE $C95E
+    RecompiledBegin(ctx, 0xC957); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xC95E; return; }
+    // C959  BVC $C95E
+    RecompiledBegin(ctx, 0xC959); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xC95E; return; }
+    // C95B  JMP $C962
+    RecompiledBegin(ctx, 0xC95B); cpu.totalCycles += 3; cpu.PC = 0xC962; return;
+}
+
+static void Block_C95E(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // C95E  LDX #$20
+    RecompiledBegin(ctx, 0xC95E); cpu.X = 0x20; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // C960  STX $00
+    RecompiledBegin(ctx, 0xC960); bus.write(0x0000, cpu.X); cpu.totalCycles += 3;
+    cpu.PC = 0xC962;
+}
+
+static void Block_C962(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // C962  NOP
+    RecompiledBegin(ctx, 0xC962); cpu.totalCycles += 2;
+    // C963  CLC
+    RecompiledBegin(ctx, 0xC963); SetFlag(cpu, Flags::C, false); cpu.totalCycles += 2;
+    // C964  BIT $01
+    RecompiledBegin(ctx, 0xC964); BitTest(cpu, bus.read(0x0001)); cpu.totalCycles += 3;
+    // C966  LDA #$7F
+    RecompiledBegin(ctx, 0xC966); cpu.A = 0x7F; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // C968  ADC #$80
+    RecompiledBegin(ctx, 0xC968); AddBinary(cpu, 0x80); cpu.totalCycles += 2;
+    // C96A  BPL $C977
+    RecompiledBegin(ctx, 0xC96A); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xC977; return; }
+    // C96C  BCS $C977
+    RecompiledBegin(ctx, 0xC96C); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xC977; return; }
+    // C96E  CMP #$FF
+    RecompiledBegin(ctx, 0xC96E); Compare(cpu, cpu.A, 0xFF); cpu.totalCycles += 2;
+    // C970  BNE $C977
+    RecompiledBegin(ctx, 0xC970); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xC977; return; }
+    // C972  BVS $C977
+    RecompiledBegin(ctx, 0xC972); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xC977; return; }
+    // C974  JMP $C97B
+    RecompiledBegin(ctx, 0xC974); cpu.totalCycles += 3; cpu.PC = 0xC97B; return;
+}
+
+static void Block_C977(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // C977  LDX #$21
+    RecompiledBegin(ctx, 0xC977); cpu.X = 0x21; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // C979  STX $00
+    RecompiledBegin(ctx, 0xC979); bus.write(0x0000, cpu.X); cpu.totalCycles += 3;
+    cpu.PC = 0xC97B;
+}
+
+static void Block_C97B(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    // C97B  NOP
+    RecompiledBegin(ctx, 0xC97B); cpu.totalCycles += 2;
+    // C97C  SEC
+    RecompiledBegin(ctx, 0xC97C); SetFlag(cpu, Flags::C, true); cpu.totalCycles += 2;
+    // C97D  CLV
+    RecompiledBegin(ctx, 0xC97D); SetFlag(cpu, Flags::V, false); cpu.totalCycles += 2;
+    // C97E  LDA #$7F
+    RecompiledBegin(ctx, 0xC97E); cpu.A = 0x7F; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // C980  ADC #$80
+    RecompiledBegin(ctx, 0xC980); AddBinary(cpu, 0x80); cpu.totalCycles += 2;
+    // C982  BNE $C98D
+    RecompiledBegin(ctx, 0xC982); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xC98D; return; }
+    // C984  BMI $C98D
+    RecompiledBegin(ctx, 0xC984); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xC98D; return; }
+    // C986  BVS $C98D
+    RecompiledBegin(ctx, 0xC986); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xC98D; return; }
+    // C988  BCC $C98D
+    RecompiledBegin(ctx, 0xC988); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xC98D; return; }
+    // C98A  JMP $C991
+    RecompiledBegin(ctx, 0xC98A); cpu.totalCycles += 3; cpu.PC = 0xC991; return;
+}
+
+static void Block_C98D(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // C98D  LDX #$22
+    RecompiledBegin(ctx, 0xC98D); cpu.X = 0x22; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // C98F  STX $00
+    RecompiledBegin(ctx, 0xC98F); bus.write(0x0000, cpu.X); cpu.totalCycles += 3;
+    cpu.PC = 0xC991;
+}
+
+static void Block_C991(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    // C991  NOP
+    RecompiledBegin(ctx, 0xC991); cpu.totalCycles += 2;
+    // C992  SEC
+    RecompiledBegin(ctx, 0xC992); SetFlag(cpu, Flags::C, true); cpu.totalCycles += 2;
+    // C993  CLV
+    RecompiledBegin(ctx, 0xC993); SetFlag(cpu, Flags::V, false); cpu.totalCycles += 2;
+    // C994  LDA #$9F
+    RecompiledBegin(ctx, 0xC994); cpu.A = 0x9F; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // C996  BEQ $C9A1
+    RecompiledBegin(ctx, 0xC996); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xC9A1; return; }
+    // C998  BPL $C9A1
+    RecompiledBegin(ctx, 0xC998); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xC9A1; return; }
+    // C99A  BVS $C9A1
+    RecompiledBegin(ctx, 0xC99A); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xC9A1; return; }
+    // C99C  BCC $C9A1
+    RecompiledBegin(ctx, 0xC99C); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xC9A1; return; }
+    // C99E  JMP $C9A5
+    RecompiledBegin(ctx, 0xC99E); cpu.totalCycles += 3; cpu.PC = 0xC9A5; return;
+}
+
+static void Block_C9A1(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // C9A1  LDX #$23
+    RecompiledBegin(ctx, 0xC9A1); cpu.X = 0x23; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // C9A3  STX $00
+    RecompiledBegin(ctx, 0xC9A3); bus.write(0x0000, cpu.X); cpu.totalCycles += 3;
+    cpu.PC = 0xC9A5;
+}
+
+static void Block_C9A5(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // C9A5  NOP
+    RecompiledBegin(ctx, 0xC9A5); cpu.totalCycles += 2;
+    // C9A6  CLC
+    RecompiledBegin(ctx, 0xC9A6); SetFlag(cpu, Flags::C, false); cpu.totalCycles += 2;
+    // C9A7  BIT $01
+    RecompiledBegin(ctx, 0xC9A7); BitTest(cpu, bus.read(0x0001)); cpu.totalCycles += 3;
+    // C9A9  LDA #$00
+    RecompiledBegin(ctx, 0xC9A9); cpu.A = 0x00; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // C9AB  BNE $C9B6
+    RecompiledBegin(ctx, 0xC9AB); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xC9B6; return; }
+    // C9AD  BMI $C9B6
+    RecompiledBegin(ctx, 0xC9AD); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xC9B6; return; }
+    // C9AF  BVC $C9B6
+    RecompiledBegin(ctx, 0xC9AF); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xC9B6; return; }
+    // C9B1  BCS $C9B6
+    RecompiledBegin(ctx, 0xC9B1); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xC9B6; return; }
+    // C9B3  JMP $C9BA
+    RecompiledBegin(ctx, 0xC9B3); cpu.totalCycles += 3; cpu.PC = 0xC9BA; return;
+}
+
+static void Block_C9B6(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // C9B6  LDX #$23
+    RecompiledBegin(ctx, 0xC9B6); cpu.X = 0x23; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // C9B8  STX $00
+    RecompiledBegin(ctx, 0xC9B8); bus.write(0x0000, cpu.X); cpu.totalCycles += 3;
+    cpu.PC = 0xC9BA;
+}
+
+static void Block_C9BA(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // C9BA  NOP
+    RecompiledBegin(ctx, 0xC9BA); cpu.totalCycles += 2;
+    // C9BB  BIT $01
+    RecompiledBegin(ctx, 0xC9BB); BitTest(cpu, bus.read(0x0001)); cpu.totalCycles += 3;
+    // C9BD  LDA #$40
+    RecompiledBegin(ctx, 0xC9BD); cpu.A = 0x40; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // C9BF  CMP #$40
+    RecompiledBegin(ctx, 0xC9BF); Compare(cpu, cpu.A, 0x40); cpu.totalCycles += 2;
+    // C9C1  BMI $C9CC
+    RecompiledBegin(ctx, 0xC9C1); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xC9CC; return; }
+    // C9C3  BCC $C9CC
+    RecompiledBegin(ctx, 0xC9C3); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xC9CC; return; }
+    // C9C5  BNE $C9CC
+    RecompiledBegin(ctx, 0xC9C5); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xC9CC; return; }
+    // C9C7  BVC $C9CC
+    RecompiledBegin(ctx, 0xC9C7); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xC9CC; return; }
+    // C9C9  JMP $C9D0
+    RecompiledBegin(ctx, 0xC9C9); cpu.totalCycles += 3; cpu.PC = 0xC9D0; return;
+}
+
+static void Block_C9CC(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // C9CC  LDX #$24
+    RecompiledBegin(ctx, 0xC9CC); cpu.X = 0x24; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // C9CE  STX $00
+    RecompiledBegin(ctx, 0xC9CE); bus.write(0x0000, cpu.X); cpu.totalCycles += 3;
+    cpu.PC = 0xC9D0;
+}
+
+static void Block_C9D0(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    // C9D0  NOP
+    RecompiledBegin(ctx, 0xC9D0); cpu.totalCycles += 2;
+    // C9D1  CLV
+    RecompiledBegin(ctx, 0xC9D1); SetFlag(cpu, Flags::V, false); cpu.totalCycles += 2;
+    // C9D2  CMP #$3F
+    RecompiledBegin(ctx, 0xC9D2); Compare(cpu, cpu.A, 0x3F); cpu.totalCycles += 2;
+    // C9D4  BEQ $C9DF
+    RecompiledBegin(ctx, 0xC9D4); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xC9DF; return; }
+    // C9D6  BMI $C9DF
+    RecompiledBegin(ctx, 0xC9D6); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xC9DF; return; }
+    // C9D8  BCC $C9DF
+    RecompiledBegin(ctx, 0xC9D8); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xC9DF; return; }
+    // C9DA  BVS $C9DF
+    RecompiledBegin(ctx, 0xC9DA); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xC9DF; return; }
+    // C9DC  JMP $C9E3
+    RecompiledBegin(ctx, 0xC9DC); cpu.totalCycles += 3; cpu.PC = 0xC9E3; return;
+}
+
+static void Block_C9DF(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // C9DF  LDX #$25
+    RecompiledBegin(ctx, 0xC9DF); cpu.X = 0x25; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // C9E1  STX $00
+    RecompiledBegin(ctx, 0xC9E1); bus.write(0x0000, cpu.X); cpu.totalCycles += 3;
+    cpu.PC = 0xC9E3;
+}
+
+static void Block_C9E3(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    // C9E3  NOP
+    RecompiledBegin(ctx, 0xC9E3); cpu.totalCycles += 2;
+    // C9E4  CMP #$41
+    RecompiledBegin(ctx, 0xC9E4); Compare(cpu, cpu.A, 0x41); cpu.totalCycles += 2;
+    // C9E6  BEQ $C9EF
+    RecompiledBegin(ctx, 0xC9E6); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xC9EF; return; }
+    // C9E8  BPL $C9EF
+    RecompiledBegin(ctx, 0xC9E8); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xC9EF; return; }
+    // C9EA  BPL $C9EF
+    RecompiledBegin(ctx, 0xC9EA); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xC9EF; return; }
+    // C9EC  JMP $C9F3
+    RecompiledBegin(ctx, 0xC9EC); cpu.totalCycles += 3; cpu.PC = 0xC9F3; return;
+}
+
+static void Block_C9EF(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // C9EF  LDX #$26
+    RecompiledBegin(ctx, 0xC9EF); cpu.X = 0x26; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // C9F1  STX $00
+    RecompiledBegin(ctx, 0xC9F1); bus.write(0x0000, cpu.X); cpu.totalCycles += 3;
+    cpu.PC = 0xC9F3;
+}
+
+static void Block_C9F3(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    // C9F3  NOP
+    RecompiledBegin(ctx, 0xC9F3); cpu.totalCycles += 2;
+    // C9F4  LDA #$80
+    RecompiledBegin(ctx, 0xC9F4); cpu.A = 0x80; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // C9F6  CMP #$00
+    RecompiledBegin(ctx, 0xC9F6); Compare(cpu, cpu.A, 0x00); cpu.totalCycles += 2;
+    // C9F8  BEQ $CA01
+    RecompiledBegin(ctx, 0xC9F8); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 2; cpu.PC = 0xCA01; return; }
+    // C9FA  BPL $CA01
+    RecompiledBegin(ctx, 0xC9FA); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::N)) { cpu.totalCycles += 2; cpu.PC = 0xCA01; return; }
+    // C9FC  BCC $CA01
+    RecompiledBegin(ctx, 0xC9FC); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::C)) { cpu.totalCycles += 2; cpu.PC = 0xCA01; return; }
+    // C9FE  JMP $CA05
+    RecompiledBegin(ctx, 0xC9FE); cpu.totalCycles += 3; cpu.PC = 0xCA05; return;
+}
+
+static void Block_CA01(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // CA01  LDX #$27
+    RecompiledBegin(ctx, 0xCA01); cpu.X = 0x27; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // CA03  STX $00
+    RecompiledBegin(ctx, 0xCA03); bus.write(0x0000, cpu.X); cpu.totalCycles += 3;
+    cpu.PC = 0xCA05;
+}
+
+static void Block_CA05(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    // CA05  NOP
+    RecompiledBegin(ctx, 0xCA05); cpu.totalCycles += 2;
+    // CA06  CMP #$80
+    RecompiledBegin(ctx, 0xCA06); Compare(cpu, cpu.A, 0x80); cpu.totalCycles += 2;
+    // CA08  BNE $CA11
+    RecompiledBegin(ctx, 0xCA08); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xCA11; return; }
+    // CA0A  BMI $CA11
+    RecompiledBegin(ctx, 0xCA0A); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xCA11; return; }
+    // CA0C  BCC $CA11
+    RecompiledBegin(ctx, 0xCA0C); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xCA11; return; }
+    // CA0E  JMP $CA15
+    RecompiledBegin(ctx, 0xCA0E); cpu.totalCycles += 3; cpu.PC = 0xCA15; return;
+}
+
+static void Block_CA11(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // CA11  LDX #$28
+    RecompiledBegin(ctx, 0xCA11); cpu.X = 0x28; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // CA13  STX $00
+    RecompiledBegin(ctx, 0xCA13); bus.write(0x0000, cpu.X); cpu.totalCycles += 3;
+    cpu.PC = 0xCA15;
+}
+
+static void Block_CA15(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    // CA15  NOP
+    RecompiledBegin(ctx, 0xCA15); cpu.totalCycles += 2;
+    // CA16  CMP #$81
+    RecompiledBegin(ctx, 0xCA16); Compare(cpu, cpu.A, 0x81); cpu.totalCycles += 2;
+    // CA18  BCS $CA21
+    RecompiledBegin(ctx, 0xCA18); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xCA21; return; }
+    // CA1A  BEQ $CA21
+    RecompiledBegin(ctx, 0xCA1A); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xCA21; return; }
+    // CA1C  BPL $CA21
+    RecompiledBegin(ctx, 0xCA1C); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xCA21; return; }
+    // CA1E  JMP $CA25
+    RecompiledBegin(ctx, 0xCA1E); cpu.totalCycles += 3; cpu.PC = 0xCA25; return;
+}
+
+static void Block_CA21(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // CA21  LDX #$29
+    RecompiledBegin(ctx, 0xCA21); cpu.X = 0x29; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // CA23  STX $00
+    RecompiledBegin(ctx, 0xCA23); bus.write(0x0000, cpu.X); cpu.totalCycles += 3;
+    cpu.PC = 0xCA25;
+}
+
+static void Block_CA25(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    // CA25  NOP
+    RecompiledBegin(ctx, 0xCA25); cpu.totalCycles += 2;
+    // CA26  CMP #$7F
+    RecompiledBegin(ctx, 0xCA26); Compare(cpu, cpu.A, 0x7F); cpu.totalCycles += 2;
+    // CA28  BCC $CA31
+    RecompiledBegin(ctx, 0xCA28); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xCA31; return; }
+    // CA2A  BEQ $CA31
+    RecompiledBegin(ctx, 0xCA2A); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xCA31; return; }
+    // CA2C  BMI $CA31
+    RecompiledBegin(ctx, 0xCA2C); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xCA31; return; }
+    // CA2E  JMP $CA35
+    RecompiledBegin(ctx, 0xCA2E); cpu.totalCycles += 3; cpu.PC = 0xCA35; return;
+}
+
+static void Block_CA31(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // CA31  LDX #$2A
+    RecompiledBegin(ctx, 0xCA31); cpu.X = 0x2A; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // CA33  STX $00
+    RecompiledBegin(ctx, 0xCA33); bus.write(0x0000, cpu.X); cpu.totalCycles += 3;
+    cpu.PC = 0xCA35;
+}
+
+static void Block_CA35(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // CA35  NOP
+    RecompiledBegin(ctx, 0xCA35); cpu.totalCycles += 2;
+    // CA36  BIT $01
+    RecompiledBegin(ctx, 0xCA36); BitTest(cpu, bus.read(0x0001)); cpu.totalCycles += 3;
+    // CA38  LDY #$40
+    RecompiledBegin(ctx, 0xCA38); cpu.Y = 0x40; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // CA3A  CPY #$40
+    RecompiledBegin(ctx, 0xCA3A); Compare(cpu, cpu.Y, 0x40); cpu.totalCycles += 2;
+    // CA3C  BNE $CA47
+    RecompiledBegin(ctx, 0xCA3C); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xCA47; return; }
+    // CA3E  BMI $CA47
+    RecompiledBegin(ctx, 0xCA3E); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xCA47; return; }
+    // CA40  BCC $CA47
+    RecompiledBegin(ctx, 0xCA40); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xCA47; return; }
+    // CA42  BVC $CA47
+    RecompiledBegin(ctx, 0xCA42); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xCA47; return; }
+    // CA44  JMP $CA4B
+    RecompiledBegin(ctx, 0xCA44); cpu.totalCycles += 3; cpu.PC = 0xCA4B; return;
+}
+
+static void Block_CA47(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // CA47  LDX #$2B
+    RecompiledBegin(ctx, 0xCA47); cpu.X = 0x2B; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // CA49  STX $00
+    RecompiledBegin(ctx, 0xCA49); bus.write(0x0000, cpu.X); cpu.totalCycles += 3;
+    cpu.PC = 0xCA4B;
+}
+
+static void Block_CA4B(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    // CA4B  NOP
+    RecompiledBegin(ctx, 0xCA4B); cpu.totalCycles += 2;
+    // CA4C  CLV
+    RecompiledBegin(ctx, 0xCA4C); SetFlag(cpu, Flags::V, false); cpu.totalCycles += 2;
+    // CA4D  CPY #$3F
+    RecompiledBegin(ctx, 0xCA4D); Compare(cpu, cpu.Y, 0x3F); cpu.totalCycles += 2;
+    // CA4F  BEQ $CA5A
+    RecompiledBegin(ctx, 0xCA4F); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xCA5A; return; }
+    // CA51  BMI $CA5A
+    RecompiledBegin(ctx, 0xCA51); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xCA5A; return; }
+    // CA53  BCC $CA5A
+    RecompiledBegin(ctx, 0xCA53); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xCA5A; return; }
+    // CA55  BVS $CA5A
+    RecompiledBegin(ctx, 0xCA55); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xCA5A; return; }
+    // CA57  JMP $CA5E
+    RecompiledBegin(ctx, 0xCA57); cpu.totalCycles += 3; cpu.PC = 0xCA5E; return;
+}
+
+static void Block_CA5A(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // CA5A  LDX #$2C
+    RecompiledBegin(ctx, 0xCA5A); cpu.X = 0x2C; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // CA5C  STX $00
+    RecompiledBegin(ctx, 0xCA5C); bus.write(0x0000, cpu.X); cpu.totalCycles += 3;
+    cpu.PC = 0xCA5E;
+}
+
+static void Block_CA5E(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    // CA5E  NOP
+    RecompiledBegin(ctx, 0xCA5E); cpu.totalCycles += 2;
+    // CA5F  CPY #$41
+    RecompiledBegin(ctx, 0xCA5F); Compare(cpu, cpu.Y, 0x41); cpu.totalCycles += 2;
+    // CA61  BEQ $CA6A
+    RecompiledBegin(ctx, 0xCA61); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xCA6A; return; }
+    // CA63  BPL $CA6A
+    RecompiledBegin(ctx, 0xCA63); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xCA6A; return; }
+    // CA65  BPL $CA6A
+    RecompiledBegin(ctx, 0xCA65); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xCA6A; return; }
+    // CA67  JMP $CA6E
+    RecompiledBegin(ctx, 0xCA67); cpu.totalCycles += 3; cpu.PC = 0xCA6E; return;
+}
+
+static void Block_CA6A(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // CA6A  LDX #$2D
+    RecompiledBegin(ctx, 0xCA6A); cpu.X = 0x2D; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // CA6C  STX $00
+    RecompiledBegin(ctx, 0xCA6C); bus.write(0x0000, cpu.X); cpu.totalCycles += 3;
+    cpu.PC = 0xCA6E;
+}
+
+static void Block_CA6E(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    // CA6E  NOP
+    RecompiledBegin(ctx, 0xCA6E); cpu.totalCycles += 2;
+    // CA6F  LDY #$80
+    RecompiledBegin(ctx, 0xCA6F); cpu.Y = 0x80; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // CA71  CPY #$00
+    RecompiledBegin(ctx, 0xCA71); Compare(cpu, cpu.Y, 0x00); cpu.totalCycles += 2;
+    // CA73  BEQ $CA7C
+    RecompiledBegin(ctx, 0xCA73); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xCA7C; return; }
+    // CA75  BPL $CA7C
+    RecompiledBegin(ctx, 0xCA75); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xCA7C; return; }
+    // CA77  BCC $CA7C
+    RecompiledBegin(ctx, 0xCA77); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xCA7C; return; }
+    // CA79  JMP $CA80
+    RecompiledBegin(ctx, 0xCA79); cpu.totalCycles += 3; cpu.PC = 0xCA80; return;
+}
+
+static void Block_CA7C(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // CA7C  LDX #$2E
+    RecompiledBegin(ctx, 0xCA7C); cpu.X = 0x2E; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // CA7E  STX $00
+    RecompiledBegin(ctx, 0xCA7E); bus.write(0x0000, cpu.X); cpu.totalCycles += 3;
+    cpu.PC = 0xCA80;
+}
+
+static void Block_CA80(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    // CA80  NOP
+    RecompiledBegin(ctx, 0xCA80); cpu.totalCycles += 2;
+    // CA81  CPY #$80
+    RecompiledBegin(ctx, 0xCA81); Compare(cpu, cpu.Y, 0x80); cpu.totalCycles += 2;
+    // CA83  BNE $CA8C
+    RecompiledBegin(ctx, 0xCA83); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xCA8C; return; }
+    // CA85  BMI $CA8C
+    RecompiledBegin(ctx, 0xCA85); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xCA8C; return; }
+    // CA87  BCC $CA8C
+    RecompiledBegin(ctx, 0xCA87); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xCA8C; return; }
+    // CA89  JMP $CA90
+    RecompiledBegin(ctx, 0xCA89); cpu.totalCycles += 3; cpu.PC = 0xCA90; return;
+}
+
+static void Block_CA8C(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // CA8C  LDX #$2F
+    RecompiledBegin(ctx, 0xCA8C); cpu.X = 0x2F; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // CA8E  STX $00
+    RecompiledBegin(ctx, 0xCA8E); bus.write(0x0000, cpu.X); cpu.totalCycles += 3;
+    cpu.PC = 0xCA90;
+}
+
+static void Block_CA90(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    // CA90  NOP
+    RecompiledBegin(ctx, 0xCA90); cpu.totalCycles += 2;
+    // CA91  CPY #$81
+    RecompiledBegin(ctx, 0xCA91); Compare(cpu, cpu.Y, 0x81); cpu.totalCycles += 2;
+    // CA93  BCS $CA9C
+    RecompiledBegin(ctx, 0xCA93); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xCA9C; return; }
+    // CA95  BEQ $CA9C
+    RecompiledBegin(ctx, 0xCA95); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xCA9C; return; }
+    // CA97  BPL $CA9C
+    RecompiledBegin(ctx, 0xCA97); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xCA9C; return; }
+    // CA99  JMP $CAA0
+    RecompiledBegin(ctx, 0xCA99); cpu.totalCycles += 3; cpu.PC = 0xCAA0; return;
+}
+
+static void Block_CA9C(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // CA9C  LDX #$30
+    RecompiledBegin(ctx, 0xCA9C); cpu.X = 0x30; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // CA9E  STX $00
+    RecompiledBegin(ctx, 0xCA9E); bus.write(0x0000, cpu.X); cpu.totalCycles += 3;
+    cpu.PC = 0xCAA0;
+}
+
+static void Block_CAA0(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    // CAA0  NOP
+    RecompiledBegin(ctx, 0xCAA0); cpu.totalCycles += 2;
+    // CAA1  CPY #$7F
+    RecompiledBegin(ctx, 0xCAA1); Compare(cpu, cpu.Y, 0x7F); cpu.totalCycles += 2;
+    // CAA3  BCC $CAAC
+    RecompiledBegin(ctx, 0xCAA3); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xCAAC; return; }
+    // CAA5  BEQ $CAAC
+    RecompiledBegin(ctx, 0xCAA5); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xCAAC; return; }
+    // CAA7  BMI $CAAC
+    RecompiledBegin(ctx, 0xCAA7); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xCAAC; return; }
+    // CAA9  JMP $CAB0
+    RecompiledBegin(ctx, 0xCAA9); cpu.totalCycles += 3; cpu.PC = 0xCAB0; return;
+}
+
+static void Block_CAAC(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // CAAC  LDX #$31
+    RecompiledBegin(ctx, 0xCAAC); cpu.X = 0x31; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // CAAE  STX $00
+    RecompiledBegin(ctx, 0xCAAE); bus.write(0x0000, cpu.X); cpu.totalCycles += 3;
+    cpu.PC = 0xCAB0;
+}
+
+static void Block_CAB0(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // CAB0  NOP
+    RecompiledBegin(ctx, 0xCAB0); cpu.totalCycles += 2;
+    // CAB1  BIT $01
+    RecompiledBegin(ctx, 0xCAB1); BitTest(cpu, bus.read(0x0001)); cpu.totalCycles += 3;
+    // CAB3  LDX #$40
+    RecompiledBegin(ctx, 0xCAB3); cpu.X = 0x40; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // CAB5  CPX #$40
+    RecompiledBegin(ctx, 0xCAB5); Compare(cpu, cpu.X, 0x40); cpu.totalCycles += 2;
+    // CAB7  BNE $CAC2
+    RecompiledBegin(ctx, 0xCAB7); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xCAC2; return; }
+    // CAB9  BMI $CAC2
+    RecompiledBegin(ctx, 0xCAB9); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xCAC2; return; }
+    // CABB  BCC $CAC2
+    RecompiledBegin(ctx, 0xCABB); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xCAC2; return; }
+    // CABD  BVC $CAC2
+    RecompiledBegin(ctx, 0xCABD); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xCAC2; return; }
+    // CABF  JMP $CAC6
+    RecompiledBegin(ctx, 0xCABF); cpu.totalCycles += 3; cpu.PC = 0xCAC6; return;
+}
+
+static void Block_CAC2(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // CAC2  LDA #$32
+    RecompiledBegin(ctx, 0xCAC2); cpu.A = 0x32; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // CAC4  STA $00
+    RecompiledBegin(ctx, 0xCAC4); bus.write(0x0000, cpu.A); cpu.totalCycles += 3;
+    cpu.PC = 0xCAC6;
+}
+
+static void Block_CAC6(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    // CAC6  NOP
+    RecompiledBegin(ctx, 0xCAC6); cpu.totalCycles += 2;
+    // CAC7  CLV
+    RecompiledBegin(ctx, 0xCAC7); SetFlag(cpu, Flags::V, false); cpu.totalCycles += 2;
+    // CAC8  CPX #$3F
+    RecompiledBegin(ctx, 0xCAC8); Compare(cpu, cpu.X, 0x3F); cpu.totalCycles += 2;
+    // CACA  BEQ $CAD5
+    RecompiledBegin(ctx, 0xCACA); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xCAD5; return; }
+    // CACC  BMI $CAD5
+    RecompiledBegin(ctx, 0xCACC); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xCAD5; return; }
+    // CACE  BCC $CAD5
+    RecompiledBegin(ctx, 0xCACE); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xCAD5; return; }
+    // CAD0  BVS $CAD5
+    RecompiledBegin(ctx, 0xCAD0); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xCAD5; return; }
+    // CAD2  JMP $CAD9
+    RecompiledBegin(ctx, 0xCAD2); cpu.totalCycles += 3; cpu.PC = 0xCAD9; return;
+}
+
+static void Block_CAD5(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // CAD5  LDA #$33
+    RecompiledBegin(ctx, 0xCAD5); cpu.A = 0x33; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // CAD7  STA $00
+    RecompiledBegin(ctx, 0xCAD7); bus.write(0x0000, cpu.A); cpu.totalCycles += 3;
+    cpu.PC = 0xCAD9;
+}
+
+static void Block_CAD9(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    // CAD9  NOP
+    RecompiledBegin(ctx, 0xCAD9); cpu.totalCycles += 2;
+    // CADA  CPX #$41
+    RecompiledBegin(ctx, 0xCADA); Compare(cpu, cpu.X, 0x41); cpu.totalCycles += 2;
+    // CADC  BEQ $CAE5
+    RecompiledBegin(ctx, 0xCADC); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xCAE5; return; }
+    // CADE  BPL $CAE5
+    RecompiledBegin(ctx, 0xCADE); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xCAE5; return; }
+    // CAE0  BPL $CAE5
+    RecompiledBegin(ctx, 0xCAE0); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xCAE5; return; }
+    // CAE2  JMP $CAE9
+    RecompiledBegin(ctx, 0xCAE2); cpu.totalCycles += 3; cpu.PC = 0xCAE9; return;
+}
+
+static void Block_CAE5(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // CAE5  LDA #$34
+    RecompiledBegin(ctx, 0xCAE5); cpu.A = 0x34; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // CAE7  STA $00
+    RecompiledBegin(ctx, 0xCAE7); bus.write(0x0000, cpu.A); cpu.totalCycles += 3;
+    cpu.PC = 0xCAE9;
+}
+
+static void Block_CAE9(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    // CAE9  NOP
+    RecompiledBegin(ctx, 0xCAE9); cpu.totalCycles += 2;
+    // CAEA  LDX #$80
+    RecompiledBegin(ctx, 0xCAEA); cpu.X = 0x80; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // CAEC  CPX #$00
+    RecompiledBegin(ctx, 0xCAEC); Compare(cpu, cpu.X, 0x00); cpu.totalCycles += 2;
+    // CAEE  BEQ $CAF7
+    RecompiledBegin(ctx, 0xCAEE); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xCAF7; return; }
+    // CAF0  BPL $CAF7
+    RecompiledBegin(ctx, 0xCAF0); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xCAF7; return; }
+    // CAF2  BCC $CAF7
+    RecompiledBegin(ctx, 0xCAF2); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xCAF7; return; }
+    // CAF4  JMP $CAFB
+    RecompiledBegin(ctx, 0xCAF4); cpu.totalCycles += 3; cpu.PC = 0xCAFB; return;
+}
+
+static void Block_CAF7(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // CAF7  LDA #$35
+    RecompiledBegin(ctx, 0xCAF7); cpu.A = 0x35; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // CAF9  STA $00
+    RecompiledBegin(ctx, 0xCAF9); bus.write(0x0000, cpu.A); cpu.totalCycles += 3;
+    cpu.PC = 0xCAFB;
+}
+
+static void Block_CAFB(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    // CAFB  NOP
+    RecompiledBegin(ctx, 0xCAFB); cpu.totalCycles += 2;
+    // CAFC  CPX #$80
+    RecompiledBegin(ctx, 0xCAFC); Compare(cpu, cpu.X, 0x80); cpu.totalCycles += 2;
+    // CAFE  BNE $CB07
+    RecompiledBegin(ctx, 0xCAFE); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xCB07; return; }
+    // CB00  BMI $CB07
+    RecompiledBegin(ctx, 0xCB00); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xCB07; return; }
+    // CB02  BCC $CB07
+    RecompiledBegin(ctx, 0xCB02); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xCB07; return; }
+    // CB04  JMP $CB0B
+    RecompiledBegin(ctx, 0xCB04); cpu.totalCycles += 3; cpu.PC = 0xCB0B; return;
+}
+
+static void Block_CB07(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // CB07  LDA #$36
+    RecompiledBegin(ctx, 0xCB07); cpu.A = 0x36; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // CB09  STA $00
+    RecompiledBegin(ctx, 0xCB09); bus.write(0x0000, cpu.A); cpu.totalCycles += 3;
+    cpu.PC = 0xCB0B;
+}
+
+static void Block_CB0B(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    // CB0B  NOP
+    RecompiledBegin(ctx, 0xCB0B); cpu.totalCycles += 2;
+    // CB0C  CPX #$81
+    RecompiledBegin(ctx, 0xCB0C); Compare(cpu, cpu.X, 0x81); cpu.totalCycles += 2;
+    // CB0E  BCS $CB17
+    RecompiledBegin(ctx, 0xCB0E); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xCB17; return; }
+    // CB10  BEQ $CB17
+    RecompiledBegin(ctx, 0xCB10); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xCB17; return; }
+    // CB12  BPL $CB17
+    RecompiledBegin(ctx, 0xCB12); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xCB17; return; }
+    // CB14  JMP $CB1B
+    RecompiledBegin(ctx, 0xCB14); cpu.totalCycles += 3; cpu.PC = 0xCB1B; return;
+}
+
+static void Block_CB17(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // CB17  LDA #$37
+    RecompiledBegin(ctx, 0xCB17); cpu.A = 0x37; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // CB19  STA $00
+    RecompiledBegin(ctx, 0xCB19); bus.write(0x0000, cpu.A); cpu.totalCycles += 3;
+    cpu.PC = 0xCB1B;
+}
+
+static void Block_CB1B(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    // CB1B  NOP
+    RecompiledBegin(ctx, 0xCB1B); cpu.totalCycles += 2;
+    // CB1C  CPX #$7F
+    RecompiledBegin(ctx, 0xCB1C); Compare(cpu, cpu.X, 0x7F); cpu.totalCycles += 2;
+    // CB1E  BCC $CB27
+    RecompiledBegin(ctx, 0xCB1E); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xCB27; return; }
+    // CB20  BEQ $CB27
+    RecompiledBegin(ctx, 0xCB20); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xCB27; return; }
+    // CB22  BMI $CB27
+    RecompiledBegin(ctx, 0xCB22); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xCB27; return; }
+    // CB24  JMP $CB2B
+    RecompiledBegin(ctx, 0xCB24); cpu.totalCycles += 3; cpu.PC = 0xCB2B; return;
+}
+
+static void Block_CB27(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // CB27  LDA #$38
+    RecompiledBegin(ctx, 0xCB27); cpu.A = 0x38; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // CB29  STA $00
+    RecompiledBegin(ctx, 0xCB29); bus.write(0x0000, cpu.A); cpu.totalCycles += 3;
+    cpu.PC = 0xCB2B;
+}
+
+static void Block_CB2B(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    // CB2B  NOP
+    RecompiledBegin(ctx, 0xCB2B); cpu.totalCycles += 2;
+    // CB2C  SEC
+    RecompiledBegin(ctx, 0xCB2C); SetFlag(cpu, Flags::C, true); cpu.totalCycles += 2;
+    // CB2D  CLV
+    RecompiledBegin(ctx, 0xCB2D); SetFlag(cpu, Flags::V, false); cpu.totalCycles += 2;
+    // CB2E  LDX #$9F
+    RecompiledBegin(ctx, 0xCB2E); cpu.X = 0x9F; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // CB30  BEQ $CB3B
+    RecompiledBegin(ctx, 0xCB30); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xCB3B; return; }
+    // CB32  BPL $CB3B
+    RecompiledBegin(ctx, 0xCB32); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xCB3B; return; }
+    // CB34  BVS $CB3B
+    RecompiledBegin(ctx, 0xCB34); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xCB3B; return; }
+    // CB36  BCC $CB3B
+    RecompiledBegin(ctx, 0xCB36); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xCB3B; return; }
+    // CB38  JMP $CB3F
+    RecompiledBegin(ctx, 0xCB38); cpu.totalCycles += 3; cpu.PC = 0xCB3F; return;
+}
+
+static void Block_CB3B(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // CB3B  LDX #$39
+    RecompiledBegin(ctx, 0xCB3B); cpu.X = 0x39; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // CB3D  STX $00
+    RecompiledBegin(ctx, 0xCB3D); bus.write(0x0000, cpu.X); cpu.totalCycles += 3;
+    cpu.PC = 0xCB3F;
+}
+
+static void Block_CB3F(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // CB3F  NOP
+    RecompiledBegin(ctx, 0xCB3F); cpu.totalCycles += 2;
+    // CB40  CLC
+    RecompiledBegin(ctx, 0xCB40); SetFlag(cpu, Flags::C, false); cpu.totalCycles += 2;
+    // CB41  BIT $01
+    RecompiledBegin(ctx, 0xCB41); BitTest(cpu, bus.read(0x0001)); cpu.totalCycles += 3;
+    // CB43  LDX #$00
+    RecompiledBegin(ctx, 0xCB43); cpu.X = 0x00; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // CB45  BNE $CB50
+    RecompiledBegin(ctx, 0xCB45); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xCB50; return; }
+    // CB47  BMI $CB50
+    RecompiledBegin(ctx, 0xCB47); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xCB50; return; }
+    // CB49  BVC $CB50
+    RecompiledBegin(ctx, 0xCB49); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xCB50; return; }
+    // CB4B  BCS $CB50
+    RecompiledBegin(ctx, 0xCB4B); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xCB50; return; }
+    // CB4D  JMP $CB54
+    RecompiledBegin(ctx, 0xCB4D); cpu.totalCycles += 3; cpu.PC = 0xCB54; return;
+}
+
+static void Block_CB50(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // CB50  LDX #$3A
+    RecompiledBegin(ctx, 0xCB50); cpu.X = 0x3A; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // CB52  STX $00
+    RecompiledBegin(ctx, 0xCB52); bus.write(0x0000, cpu.X); cpu.totalCycles += 3;
+    cpu.PC = 0xCB54;
+}
+
+static void Block_CB54(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    // CB54  NOP
+    RecompiledBegin(ctx, 0xCB54); cpu.totalCycles += 2;
+    // CB55  SEC
+    RecompiledBegin(ctx, 0xCB55); SetFlag(cpu, Flags::C, true); cpu.totalCycles += 2;
+    // CB56  CLV
+    RecompiledBegin(ctx, 0xCB56); SetFlag(cpu, Flags::V, false); cpu.totalCycles += 2;
+    // CB57  LDY #$9F
+    RecompiledBegin(ctx, 0xCB57); cpu.Y = 0x9F; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // CB59  BEQ $CB64
+    RecompiledBegin(ctx, 0xCB59); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xCB64; return; }
+    // CB5B  BPL $CB64
+    RecompiledBegin(ctx, 0xCB5B); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xCB64; return; }
+    // CB5D  BVS $CB64
+    RecompiledBegin(ctx, 0xCB5D); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xCB64; return; }
+    // CB5F  BCC $CB64
+    RecompiledBegin(ctx, 0xCB5F); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xCB64; return; }
+    // CB61  JMP $CB68
+    RecompiledBegin(ctx, 0xCB61); cpu.totalCycles += 3; cpu.PC = 0xCB68; return;
+}
+
+static void Block_CB64(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // CB64  LDX #$3B
+    RecompiledBegin(ctx, 0xCB64); cpu.X = 0x3B; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // CB66  STX $00
+    RecompiledBegin(ctx, 0xCB66); bus.write(0x0000, cpu.X); cpu.totalCycles += 3;
+    cpu.PC = 0xCB68;
+}
+
+static void Block_CB68(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // CB68  NOP
+    RecompiledBegin(ctx, 0xCB68); cpu.totalCycles += 2;
+    // CB69  CLC
+    RecompiledBegin(ctx, 0xCB69); SetFlag(cpu, Flags::C, false); cpu.totalCycles += 2;
+    // CB6A  BIT $01
+    RecompiledBegin(ctx, 0xCB6A); BitTest(cpu, bus.read(0x0001)); cpu.totalCycles += 3;
+    // CB6C  LDY #$00
+    RecompiledBegin(ctx, 0xCB6C); cpu.Y = 0x00; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // CB6E  BNE $CB79
+    RecompiledBegin(ctx, 0xCB6E); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xCB79; return; }
+    // CB70  BMI $CB79
+    RecompiledBegin(ctx, 0xCB70); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xCB79; return; }
+    // CB72  BVC $CB79
+    RecompiledBegin(ctx, 0xCB72); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xCB79; return; }
+    // CB74  BCS $CB79
+    RecompiledBegin(ctx, 0xCB74); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xCB79; return; }
+    // CB76  JMP $CB7D
+    RecompiledBegin(ctx, 0xCB76); cpu.totalCycles += 3; cpu.PC = 0xCB7D; return;
+}
+
+static void Block_CB79(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // CB79  LDX #$3C
+    RecompiledBegin(ctx, 0xCB79); cpu.X = 0x3C; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // CB7B  STX $00
+    RecompiledBegin(ctx, 0xCB7B); bus.write(0x0000, cpu.X); cpu.totalCycles += 3;
+    cpu.PC = 0xCB7D;
+}
+
+static void Block_CB7D(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    // CB7D  NOP
+    RecompiledBegin(ctx, 0xCB7D); cpu.totalCycles += 2;
+    // CB7E  LDA #$55
+    RecompiledBegin(ctx, 0xCB7E); cpu.A = 0x55; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // CB80  LDX #$AA
+    RecompiledBegin(ctx, 0xCB80); cpu.X = 0xAA; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // CB82  LDY #$33
+    RecompiledBegin(ctx, 0xCB82); cpu.Y = 0x33; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // CB84  CMP #$55
+    RecompiledBegin(ctx, 0xCB84); Compare(cpu, cpu.A, 0x55); cpu.totalCycles += 2;
+    // CB86  BNE $CBAB
+    RecompiledBegin(ctx, 0xCB86); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xCBAB; return; }
+    // CB88  CPX #$AA
+    RecompiledBegin(ctx, 0xCB88); Compare(cpu, cpu.X, 0xAA); cpu.totalCycles += 2;
+    // CB8A  BNE $CBAB
+    RecompiledBegin(ctx, 0xCB8A); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xCBAB; return; }
+    // CB8C  CPY #$33
+    RecompiledBegin(ctx, 0xCB8C); Compare(cpu, cpu.Y, 0x33); cpu.totalCycles += 2;
+    // CB8E  BNE $CBAB
+    RecompiledBegin(ctx, 0xCB8E); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xCBAB; return; }
+    // CB90  CMP #$55
+    RecompiledBegin(ctx, 0xCB90); Compare(cpu, cpu.A, 0x55); cpu.totalCycles += 2;
+    // CB92  BNE $CBAB
+    RecompiledBegin(ctx, 0xCB92); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xCBAB; return; }
+    // CB94  CPX #$AA
+    RecompiledBegin(ctx, 0xCB94); Compare(cpu, cpu.X, 0xAA); cpu.totalCycles += 2;
+    // CB96  BNE $CBAB
+    RecompiledBegin(ctx, 0xCB96); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xCBAB; return; }
+    // CB98  CPY #$33
+    RecompiledBegin(ctx, 0xCB98); Compare(cpu, cpu.Y, 0x33); cpu.totalCycles += 2;
+    // CB9A  BNE $CBAB
+    RecompiledBegin(ctx, 0xCB9A); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xCBAB; return; }
+    // CB9C  CMP #$56
+    RecompiledBegin(ctx, 0xCB9C); Compare(cpu, cpu.A, 0x56); cpu.totalCycles += 2;
+    // CB9E  BEQ $CBAB
+    RecompiledBegin(ctx, 0xCB9E); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xCBAB; return; }
+    // CBA0  CPX #$AB
+    RecompiledBegin(ctx, 0xCBA0); Compare(cpu, cpu.X, 0xAB); cpu.totalCycles += 2;
+    // CBA2  BEQ $CBAB
+    RecompiledBegin(ctx, 0xCBA2); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xCBAB; return; }
+    // CBA4  CPY #$34
+    RecompiledBegin(ctx, 0xCBA4); Compare(cpu, cpu.Y, 0x34); cpu.totalCycles += 2;
+    // CBA6  BEQ $CBAB
+    RecompiledBegin(ctx, 0xCBA6); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xCBAB; return; }
+    // CBA8  JMP $CBAF
+    RecompiledBegin(ctx, 0xCBA8); cpu.totalCycles += 3; cpu.PC = 0xCBAF; return;
+}
+
+static void Block_CBAB(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // CBAB  LDX #$3D
+    RecompiledBegin(ctx, 0xCBAB); cpu.X = 0x3D; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // CBAD  STX $00
+    RecompiledBegin(ctx, 0xCBAD); bus.write(0x0000, cpu.X); cpu.totalCycles += 3;
+    cpu.PC = 0xCBAF;
+}
+
+static void Block_CBAF(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // CBAF  LDY #$71
+    RecompiledBegin(ctx, 0xCBAF); cpu.Y = 0x71; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // CBB1  JSR $F931
+    RecompiledBegin(ctx, 0xCBB1); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xCB); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xB3); cpu.totalCycles += 6; cpu.PC = 0xF931; return;
+}
+
+static void Block_CBB4(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // CBB4  SBC #$40
+    RecompiledBegin(ctx, 0xCBB4); SubtractBinary(cpu, 0x40); cpu.totalCycles += 2;
+    // CBB6  JSR $F937
+    RecompiledBegin(ctx, 0xCBB6); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xCB); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xB8); cpu.totalCycles += 6; cpu.PC = 0xF937; return;
+}
+
+static void Block_CBB9(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // CBB9  INY
+    RecompiledBegin(ctx, 0xCBB9); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // CBBA  JSR $F947
+    RecompiledBegin(ctx, 0xCBBA); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xCB); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xBC); cpu.totalCycles += 6; cpu.PC = 0xF947; return;
+}
+
+static void Block_CBBD(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // CBBD  SBC #$3F
+    RecompiledBegin(ctx, 0xCBBD); SubtractBinary(cpu, 0x3F); cpu.totalCycles += 2;
+    // CBBF  JSR $F94C
+    RecompiledBegin(ctx, 0xCBBF); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xCB); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xC1); cpu.totalCycles += 6; cpu.PC = 0xF94C; return;
+}
+
+static void Block_CBC2(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // CBC2  INY
+    RecompiledBegin(ctx, 0xCBC2); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // CBC3  JSR $F95C
+    RecompiledBegin(ctx, 0xCBC3); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xCB); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xC5); cpu.totalCycles += 6; cpu.PC = 0xF95C; return;
+}
+
+static void Block_CBC6(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // CBC6  SBC #$41
+    RecompiledBegin(ctx, 0xCBC6); SubtractBinary(cpu, 0x41); cpu.totalCycles += 2;
+    // CBC8  JSR $F962
+    RecompiledBegin(ctx, 0xCBC8); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xCB); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xCA); cpu.totalCycles += 6; cpu.PC = 0xF962; return;
+}
+
+static void Block_CBCB(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // CBCB  INY
+    RecompiledBegin(ctx, 0xCBCB); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // CBCC  JSR $F972
+    RecompiledBegin(ctx, 0xCBCC); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xCB); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xCE); cpu.totalCycles += 6; cpu.PC = 0xF972; return;
+}
+
+static void Block_CBCF(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // CBCF  SBC #$00
+    RecompiledBegin(ctx, 0xCBCF); SubtractBinary(cpu, 0x00); cpu.totalCycles += 2;
+    // CBD1  JSR $F976
+    RecompiledBegin(ctx, 0xCBD1); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xCB); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD3); cpu.totalCycles += 6; cpu.PC = 0xF976; return;
+}
+
+static void Block_CBD4(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // CBD4  INY
+    RecompiledBegin(ctx, 0xCBD4); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // CBD5  JSR $F980
+    RecompiledBegin(ctx, 0xCBD5); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xCB); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD7); cpu.totalCycles += 6; cpu.PC = 0xF980; return;
+}
+
+static void Block_CBD8(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // CBD8  SBC #$7F
+    RecompiledBegin(ctx, 0xCBD8); SubtractBinary(cpu, 0x7F); cpu.totalCycles += 2;
+    // CBDA  JSR $F984
+    RecompiledBegin(ctx, 0xCBDA); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xCB); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xDC); cpu.totalCycles += 6; cpu.PC = 0xF984; return;
+}
+
+static void Block_CBDD(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // CBDD  RTS
+    { RecompiledBegin(ctx, 0xCBDD); cpu.SP++; const byte low = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); const byte high = bus.read(static_cast<memAddress>(0x0100 + cpu.SP + 1)); cpu.SP++; cpu.totalCycles += 6; cpu.PC = static_cast<memAddress>(RecompiledWord(low, high) + 1); return; }
+}
+
+static void Block_CBDE(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // CBDE  NOP
+    RecompiledBegin(ctx, 0xCBDE); cpu.totalCycles += 2;
+    // CBDF  LDA #$FF
+    RecompiledBegin(ctx, 0xCBDF); cpu.A = 0xFF; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // CBE1  STA $01
+    RecompiledBegin(ctx, 0xCBE1); bus.write(0x0001, cpu.A); cpu.totalCycles += 3;
+    // CBE3  LDA #$44
+    RecompiledBegin(ctx, 0xCBE3); cpu.A = 0x44; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // CBE5  LDX #$55
+    RecompiledBegin(ctx, 0xCBE5); cpu.X = 0x55; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // CBE7  LDY #$66
+    RecompiledBegin(ctx, 0xCBE7); cpu.Y = 0x66; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // CBE9  INX
+    RecompiledBegin(ctx, 0xCBE9); cpu.X++; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // CBEA  DEY
+    RecompiledBegin(ctx, 0xCBEA); cpu.Y--; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // CBEB  CPX #$56
+    RecompiledBegin(ctx, 0xCBEB); Compare(cpu, cpu.X, 0x56); cpu.totalCycles += 2;
+    // CBED  BNE $CC10
+    RecompiledBegin(ctx, 0xCBED); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 2; cpu.PC = 0xCC10; return; }
+    // CBEF  CPY #$65
+    RecompiledBegin(ctx, 0xCBEF); Compare(cpu, cpu.Y, 0x65); cpu.totalCycles += 2;
+    // CBF1  BNE $CC10
+    RecompiledBegin(ctx, 0xCBF1); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 2; cpu.PC = 0xCC10; return; }
+    // CBF3  INX
+    RecompiledBegin(ctx, 0xCBF3); cpu.X++; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // CBF4  INX
+    RecompiledBegin(ctx, 0xCBF4); cpu.X++; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // CBF5  DEY
+    RecompiledBegin(ctx, 0xCBF5); cpu.Y--; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // CBF6  DEY
+    RecompiledBegin(ctx, 0xCBF6); cpu.Y--; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // CBF7  CPX #$58
+    RecompiledBegin(ctx, 0xCBF7); Compare(cpu, cpu.X, 0x58); cpu.totalCycles += 2;
+    // CBF9  BNE $CC10
+    RecompiledBegin(ctx, 0xCBF9); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 2; cpu.PC = 0xCC10; return; }
+    // CBFB  CPY #$63
+    RecompiledBegin(ctx, 0xCBFB); Compare(cpu, cpu.Y, 0x63); cpu.totalCycles += 2;
+    // CBFD  BNE $CC10
+    RecompiledBegin(ctx, 0xCBFD); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 2; cpu.PC = 0xCC10; return; }
+    // CBFF  DEX
+    RecompiledBegin(ctx, 0xCBFF); cpu.X--; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // CC00  INY
+    RecompiledBegin(ctx, 0xCC00); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // CC01  CPX #$57
+    RecompiledBegin(ctx, 0xCC01); Compare(cpu, cpu.X, 0x57); cpu.totalCycles += 2;
+    // CC03  BNE $CC10
+    RecompiledBegin(ctx, 0xCC03); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xCC10; return; }
+    // CC05  CPY #$64
+    RecompiledBegin(ctx, 0xCC05); Compare(cpu, cpu.Y, 0x64); cpu.totalCycles += 2;
+    // CC07  BNE $CC10
+    RecompiledBegin(ctx, 0xCC07); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xCC10; return; }
+    // CC09  CMP #$44
+    RecompiledBegin(ctx, 0xCC09); Compare(cpu, cpu.A, 0x44); cpu.totalCycles += 2;
+    // CC0B  BNE $CC10
+    RecompiledBegin(ctx, 0xCC0B); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xCC10; return; }
+    // CC0D  JMP $CC14
+    RecompiledBegin(ctx, 0xCC0D); cpu.totalCycles += 3; cpu.PC = 0xCC14; return;
+}
+
+static void Block_CC10(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // CC10  LDX #$3E
+    RecompiledBegin(ctx, 0xCC10); cpu.X = 0x3E; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // CC12  STX $00
+    RecompiledBegin(ctx, 0xCC12); bus.write(0x0000, cpu.X); cpu.totalCycles += 3;
+    cpu.PC = 0xCC14;
+}
+
+static void Block_CC14(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // CC14  NOP
+    RecompiledBegin(ctx, 0xCC14); cpu.totalCycles += 2;
+    // CC15  SEC
+    RecompiledBegin(ctx, 0xCC15); SetFlag(cpu, Flags::C, true); cpu.totalCycles += 2;
+    // CC16  LDX #$69
+    RecompiledBegin(ctx, 0xCC16); cpu.X = 0x69; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // CC18  LDA #$96
+    RecompiledBegin(ctx, 0xCC18); cpu.A = 0x96; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // CC1A  BIT $01
+    RecompiledBegin(ctx, 0xCC1A); BitTest(cpu, bus.read(0x0001)); cpu.totalCycles += 3;
+    // CC1C  LDY #$FF
+    RecompiledBegin(ctx, 0xCC1C); cpu.Y = 0xFF; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // CC1E  INY
+    RecompiledBegin(ctx, 0xCC1E); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // CC1F  BNE $CC5E
+    RecompiledBegin(ctx, 0xCC1F); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xCC5E; return; }
+    // CC21  BMI $CC5E
+    RecompiledBegin(ctx, 0xCC21); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xCC5E; return; }
+    // CC23  BCC $CC5E
+    RecompiledBegin(ctx, 0xCC23); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xCC5E; return; }
+    // CC25  BVC $CC5E
+    RecompiledBegin(ctx, 0xCC25); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xCC5E; return; }
+    // CC27  CPY #$00
+    RecompiledBegin(ctx, 0xCC27); Compare(cpu, cpu.Y, 0x00); cpu.totalCycles += 2;
+    // CC29  BNE $CC5E
+    RecompiledBegin(ctx, 0xCC29); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xCC5E; return; }
+    // CC2B  INY
+    RecompiledBegin(ctx, 0xCC2B); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // CC2C  BEQ $CC5E
+    RecompiledBegin(ctx, 0xCC2C); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xCC5E; return; }
+    // CC2E  BMI $CC5E
+    RecompiledBegin(ctx, 0xCC2E); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xCC5E; return; }
+    // CC30  BCC $CC5E
+    RecompiledBegin(ctx, 0xCC30); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xCC5E; return; }
+    // CC32  BVC $CC5E
+    RecompiledBegin(ctx, 0xCC32); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xCC5E; return; }
+    // CC34  CLC
+    RecompiledBegin(ctx, 0xCC34); SetFlag(cpu, Flags::C, false); cpu.totalCycles += 2;
+    // CC35  CLV
+    RecompiledBegin(ctx, 0xCC35); SetFlag(cpu, Flags::V, false); cpu.totalCycles += 2;
+    // CC36  LDY #$00
+    RecompiledBegin(ctx, 0xCC36); cpu.Y = 0x00; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // CC38  DEY
+    RecompiledBegin(ctx, 0xCC38); cpu.Y--; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // CC39  BEQ $CC5E
+    RecompiledBegin(ctx, 0xCC39); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xCC5E; return; }
+    // CC3B  BPL $CC5E
+    RecompiledBegin(ctx, 0xCC3B); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xCC5E; return; }
+    // CC3D  BCS $CC5E
+    RecompiledBegin(ctx, 0xCC3D); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xCC5E; return; }
+    // CC3F  BVS $CC5E
+    RecompiledBegin(ctx, 0xCC3F); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xCC5E; return; }
+    // CC41  CPY #$FF
+    RecompiledBegin(ctx, 0xCC41); Compare(cpu, cpu.Y, 0xFF); cpu.totalCycles += 2;
+    // CC43  BNE $CC5E
+    RecompiledBegin(ctx, 0xCC43); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xCC5E; return; }
+    // CC45  CLC
+    RecompiledBegin(ctx, 0xCC45); SetFlag(cpu, Flags::C, false); cpu.totalCycles += 2;
+    // CC46  DEY
+    RecompiledBegin(ctx, 0xCC46); cpu.Y--; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // CC47  BEQ $CC5E
+    RecompiledBegin(ctx, 0xCC47); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xCC5E; return; }
+    // CC49  BPL $CC5E
+    RecompiledBegin(ctx, 0xCC49); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xCC5E; return; }
+    // CC4B  BCS $CC5E
+    RecompiledBegin(ctx, 0xCC4B); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xCC5E; return; }
+    // CC4D  BVS $CC5E
+    RecompiledBegin(ctx, 0xCC4D); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xCC5E; return; }
+    // CC4F  CPY #$FE
+    RecompiledBegin(ctx, 0xCC4F); Compare(cpu, cpu.Y, 0xFE); cpu.totalCycles += 2;
+    // CC51  BNE $CC5E
+    RecompiledBegin(ctx, 0xCC51); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xCC5E; return; }
+    // CC53  CMP #$96
+    RecompiledBegin(ctx, 0xCC53); Compare(cpu, cpu.A, 0x96); cpu.totalCycles += 2;
+    // CC55  BNE $CC5E
+    RecompiledBegin(ctx, 0xCC55); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xCC5E; return; }
+    // CC57  CPX #$69
+    RecompiledBegin(ctx, 0xCC57); Compare(cpu, cpu.X, 0x69); cpu.totalCycles += 2;
+    // CC59  BNE $CC5E
+    RecompiledBegin(ctx, 0xCC59); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xCC5E; return; }
+    // CC5B  JMP $CC62
+    RecompiledBegin(ctx, 0xCC5B); cpu.totalCycles += 3; cpu.PC = 0xCC62; return;
+}
+
+static void Block_CC5E(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // CC5E  LDX #$3F
+    RecompiledBegin(ctx, 0xCC5E); cpu.X = 0x3F; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // CC60  STX $00
+    RecompiledBegin(ctx, 0xCC60); bus.write(0x0000, cpu.X); cpu.totalCycles += 3;
+    cpu.PC = 0xCC62;
+}
+
+static void Block_CC62(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // CC62  NOP
+    RecompiledBegin(ctx, 0xCC62); cpu.totalCycles += 2;
+    // CC63  SEC
+    RecompiledBegin(ctx, 0xCC63); SetFlag(cpu, Flags::C, true); cpu.totalCycles += 2;
+    // CC64  LDY #$69
+    RecompiledBegin(ctx, 0xCC64); cpu.Y = 0x69; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // CC66  LDA #$96
+    RecompiledBegin(ctx, 0xCC66); cpu.A = 0x96; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // CC68  BIT $01
+    RecompiledBegin(ctx, 0xCC68); BitTest(cpu, bus.read(0x0001)); cpu.totalCycles += 3;
+    // CC6A  LDX #$FF
+    RecompiledBegin(ctx, 0xCC6A); cpu.X = 0xFF; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // CC6C  INX
+    RecompiledBegin(ctx, 0xCC6C); cpu.X++; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // CC6D  BNE $CCAC
+    RecompiledBegin(ctx, 0xCC6D); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xCCAC; return; }
+    // CC6F  BMI $CCAC
+    RecompiledBegin(ctx, 0xCC6F); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xCCAC; return; }
+    // CC71  BCC $CCAC
+    RecompiledBegin(ctx, 0xCC71); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xCCAC; return; }
+    // CC73  BVC $CCAC
+    RecompiledBegin(ctx, 0xCC73); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xCCAC; return; }
+    // CC75  CPX #$00
+    RecompiledBegin(ctx, 0xCC75); Compare(cpu, cpu.X, 0x00); cpu.totalCycles += 2;
+    // CC77  BNE $CCAC
+    RecompiledBegin(ctx, 0xCC77); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xCCAC; return; }
+    // CC79  INX
+    RecompiledBegin(ctx, 0xCC79); cpu.X++; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // CC7A  BEQ $CCAC
+    RecompiledBegin(ctx, 0xCC7A); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xCCAC; return; }
+    // CC7C  BMI $CCAC
+    RecompiledBegin(ctx, 0xCC7C); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xCCAC; return; }
+    // CC7E  BCC $CCAC
+    RecompiledBegin(ctx, 0xCC7E); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xCCAC; return; }
+    // CC80  BVC $CCAC
+    RecompiledBegin(ctx, 0xCC80); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xCCAC; return; }
+    // CC82  CLC
+    RecompiledBegin(ctx, 0xCC82); SetFlag(cpu, Flags::C, false); cpu.totalCycles += 2;
+    // CC83  CLV
+    RecompiledBegin(ctx, 0xCC83); SetFlag(cpu, Flags::V, false); cpu.totalCycles += 2;
+    // CC84  LDX #$00
+    RecompiledBegin(ctx, 0xCC84); cpu.X = 0x00; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // CC86  DEX
+    RecompiledBegin(ctx, 0xCC86); cpu.X--; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // CC87  BEQ $CCAC
+    RecompiledBegin(ctx, 0xCC87); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xCCAC; return; }
+    // CC89  BPL $CCAC
+    RecompiledBegin(ctx, 0xCC89); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xCCAC; return; }
+    // CC8B  BCS $CCAC
+    RecompiledBegin(ctx, 0xCC8B); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xCCAC; return; }
+    // CC8D  BVS $CCAC
+    RecompiledBegin(ctx, 0xCC8D); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xCCAC; return; }
+    // CC8F  CPX #$FF
+    RecompiledBegin(ctx, 0xCC8F); Compare(cpu, cpu.X, 0xFF); cpu.totalCycles += 2;
+    // CC91  BNE $CCAC
+    RecompiledBegin(ctx, 0xCC91); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xCCAC; return; }
+    // CC93  CLC
+    RecompiledBegin(ctx, 0xCC93); SetFlag(cpu, Flags::C, false); cpu.totalCycles += 2;
+    // CC94  DEX
+    RecompiledBegin(ctx, 0xCC94); cpu.X--; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // CC95  BEQ $CCAC
+    RecompiledBegin(ctx, 0xCC95); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xCCAC; return; }
+    // CC97  BPL $CCAC
+    RecompiledBegin(ctx, 0xCC97); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xCCAC; return; }
+    // CC99  BCS $CCAC
+    RecompiledBegin(ctx, 0xCC99); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xCCAC; return; }
+    // CC9B  BVS $CCAC
+    RecompiledBegin(ctx, 0xCC9B); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xCCAC; return; }
+    // CC9D  CPX #$FE
+    RecompiledBegin(ctx, 0xCC9D); Compare(cpu, cpu.X, 0xFE); cpu.totalCycles += 2;
+    // CC9F  BNE $CCAC
+    RecompiledBegin(ctx, 0xCC9F); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xCCAC; return; }
+    // CCA1  CMP #$96
+    RecompiledBegin(ctx, 0xCCA1); Compare(cpu, cpu.A, 0x96); cpu.totalCycles += 2;
+    // CCA3  BNE $CCAC
+    RecompiledBegin(ctx, 0xCCA3); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xCCAC; return; }
+    // CCA5  CPY #$69
+    RecompiledBegin(ctx, 0xCCA5); Compare(cpu, cpu.Y, 0x69); cpu.totalCycles += 2;
+    // CCA7  BNE $CCAC
+    RecompiledBegin(ctx, 0xCCA7); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xCCAC; return; }
+    // CCA9  JMP $CCB0
+    RecompiledBegin(ctx, 0xCCA9); cpu.totalCycles += 3; cpu.PC = 0xCCB0; return;
+}
+
+static void Block_CCAC(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // CCAC  LDX #$40
+    RecompiledBegin(ctx, 0xCCAC); cpu.X = 0x40; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // CCAE  STX $00
+    RecompiledBegin(ctx, 0xCCAE); bus.write(0x0000, cpu.X); cpu.totalCycles += 3;
+    cpu.PC = 0xCCB0;
+}
+
+static void Block_CCB0(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // CCB0  NOP
+    RecompiledBegin(ctx, 0xCCB0); cpu.totalCycles += 2;
+    // CCB1  LDA #$85
+    RecompiledBegin(ctx, 0xCCB1); cpu.A = 0x85; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // CCB3  LDX #$34
+    RecompiledBegin(ctx, 0xCCB3); cpu.X = 0x34; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // CCB5  LDY #$99
+    RecompiledBegin(ctx, 0xCCB5); cpu.Y = 0x99; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // CCB7  CLC
+    RecompiledBegin(ctx, 0xCCB7); SetFlag(cpu, Flags::C, false); cpu.totalCycles += 2;
+    // CCB8  BIT $01
+    RecompiledBegin(ctx, 0xCCB8); BitTest(cpu, bus.read(0x0001)); cpu.totalCycles += 3;
+    // CCBA  TAY
+    RecompiledBegin(ctx, 0xCCBA); cpu.Y = cpu.A; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // CCBB  BEQ $CCEB
+    RecompiledBegin(ctx, 0xCCBB); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xCCEB; return; }
+    // CCBD  BCS $CCEB
+    RecompiledBegin(ctx, 0xCCBD); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xCCEB; return; }
+    // CCBF  BVC $CCEB
+    RecompiledBegin(ctx, 0xCCBF); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xCCEB; return; }
+    // CCC1  BPL $CCEB
+    RecompiledBegin(ctx, 0xCCC1); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xCCEB; return; }
+    // CCC3  CMP #$85
+    RecompiledBegin(ctx, 0xCCC3); Compare(cpu, cpu.A, 0x85); cpu.totalCycles += 2;
+    // CCC5  BNE $CCEB
+    RecompiledBegin(ctx, 0xCCC5); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xCCEB; return; }
+    // CCC7  CPX #$34
+    RecompiledBegin(ctx, 0xCCC7); Compare(cpu, cpu.X, 0x34); cpu.totalCycles += 2;
+    // CCC9  BNE $CCEB
+    RecompiledBegin(ctx, 0xCCC9); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xCCEB; return; }
+    // CCCB  CPY #$85
+    RecompiledBegin(ctx, 0xCCCB); Compare(cpu, cpu.Y, 0x85); cpu.totalCycles += 2;
+    // CCCD  BNE $CCEB
+    RecompiledBegin(ctx, 0xCCCD); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xCCEB; return; }
+    // CCCF  LDA #$00
+    RecompiledBegin(ctx, 0xCCCF); cpu.A = 0x00; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // CCD1  SEC
+    RecompiledBegin(ctx, 0xCCD1); SetFlag(cpu, Flags::C, true); cpu.totalCycles += 2;
+    // CCD2  CLV
+    RecompiledBegin(ctx, 0xCCD2); SetFlag(cpu, Flags::V, false); cpu.totalCycles += 2;
+    // CCD3  TAY
+    RecompiledBegin(ctx, 0xCCD3); cpu.Y = cpu.A; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // CCD4  BNE $CCEB
+    RecompiledBegin(ctx, 0xCCD4); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xCCEB; return; }
+    // CCD6  BCC $CCEB
+    RecompiledBegin(ctx, 0xCCD6); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xCCEB; return; }
+    // CCD8  BVS $CCEB
+    RecompiledBegin(ctx, 0xCCD8); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xCCEB; return; }
+    // CCDA  BMI $CCEB
+    RecompiledBegin(ctx, 0xCCDA); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xCCEB; return; }
+    // CCDC  CMP #$00
+    RecompiledBegin(ctx, 0xCCDC); Compare(cpu, cpu.A, 0x00); cpu.totalCycles += 2;
+    // CCDE  BNE $CCEB
+    RecompiledBegin(ctx, 0xCCDE); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xCCEB; return; }
+    // CCE0  CPX #$34
+    RecompiledBegin(ctx, 0xCCE0); Compare(cpu, cpu.X, 0x34); cpu.totalCycles += 2;
+    // CCE2  BNE $CCEB
+    RecompiledBegin(ctx, 0xCCE2); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xCCEB; return; }
+    // CCE4  CPY #$00
+    RecompiledBegin(ctx, 0xCCE4); Compare(cpu, cpu.Y, 0x00); cpu.totalCycles += 2;
+    // CCE6  BNE $CCEB
+    RecompiledBegin(ctx, 0xCCE6); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xCCEB; return; }
+    // CCE8  JMP $CCEF
+    RecompiledBegin(ctx, 0xCCE8); cpu.totalCycles += 3; cpu.PC = 0xCCEF; return;
+}
+
+static void Block_CCEB(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // CCEB  LDX #$41
+    RecompiledBegin(ctx, 0xCCEB); cpu.X = 0x41; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // CCED  STX $00
+    RecompiledBegin(ctx, 0xCCED); bus.write(0x0000, cpu.X); cpu.totalCycles += 3;
+    cpu.PC = 0xCCEF;
+}
+
+static void Block_CCEF(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // CCEF  NOP
+    RecompiledBegin(ctx, 0xCCEF); cpu.totalCycles += 2;
+    // CCF0  LDA #$85
+    RecompiledBegin(ctx, 0xCCF0); cpu.A = 0x85; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // CCF2  LDX #$34
+    RecompiledBegin(ctx, 0xCCF2); cpu.X = 0x34; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // CCF4  LDY #$99
+    RecompiledBegin(ctx, 0xCCF4); cpu.Y = 0x99; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // CCF6  CLC
+    RecompiledBegin(ctx, 0xCCF6); SetFlag(cpu, Flags::C, false); cpu.totalCycles += 2;
+    // CCF7  BIT $01
+    RecompiledBegin(ctx, 0xCCF7); BitTest(cpu, bus.read(0x0001)); cpu.totalCycles += 3;
+    // CCF9  TAX
+    RecompiledBegin(ctx, 0xCCF9); cpu.X = cpu.A; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // CCFA  BEQ $CD2A
+    RecompiledBegin(ctx, 0xCCFA); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 2; cpu.PC = 0xCD2A; return; }
+    // CCFC  BCS $CD2A
+    RecompiledBegin(ctx, 0xCCFC); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::C)) { cpu.totalCycles += 2; cpu.PC = 0xCD2A; return; }
+    // CCFE  BVC $CD2A
+    RecompiledBegin(ctx, 0xCCFE); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xCD2A; return; }
+    // CD00  BPL $CD2A
+    RecompiledBegin(ctx, 0xCD00); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xCD2A; return; }
+    // CD02  CMP #$85
+    RecompiledBegin(ctx, 0xCD02); Compare(cpu, cpu.A, 0x85); cpu.totalCycles += 2;
+    // CD04  BNE $CD2A
+    RecompiledBegin(ctx, 0xCD04); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xCD2A; return; }
+    // CD06  CPX #$85
+    RecompiledBegin(ctx, 0xCD06); Compare(cpu, cpu.X, 0x85); cpu.totalCycles += 2;
+    // CD08  BNE $CD2A
+    RecompiledBegin(ctx, 0xCD08); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xCD2A; return; }
+    // CD0A  CPY #$99
+    RecompiledBegin(ctx, 0xCD0A); Compare(cpu, cpu.Y, 0x99); cpu.totalCycles += 2;
+    // CD0C  BNE $CD2A
+    RecompiledBegin(ctx, 0xCD0C); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xCD2A; return; }
+    // CD0E  LDA #$00
+    RecompiledBegin(ctx, 0xCD0E); cpu.A = 0x00; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // CD10  SEC
+    RecompiledBegin(ctx, 0xCD10); SetFlag(cpu, Flags::C, true); cpu.totalCycles += 2;
+    // CD11  CLV
+    RecompiledBegin(ctx, 0xCD11); SetFlag(cpu, Flags::V, false); cpu.totalCycles += 2;
+    // CD12  TAX
+    RecompiledBegin(ctx, 0xCD12); cpu.X = cpu.A; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // CD13  BNE $CD2A
+    RecompiledBegin(ctx, 0xCD13); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xCD2A; return; }
+    // CD15  BCC $CD2A
+    RecompiledBegin(ctx, 0xCD15); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xCD2A; return; }
+    // CD17  BVS $CD2A
+    RecompiledBegin(ctx, 0xCD17); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xCD2A; return; }
+    // CD19  BMI $CD2A
+    RecompiledBegin(ctx, 0xCD19); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xCD2A; return; }
+    // CD1B  CMP #$00
+    RecompiledBegin(ctx, 0xCD1B); Compare(cpu, cpu.A, 0x00); cpu.totalCycles += 2;
+    // CD1D  BNE $CD2A
+    RecompiledBegin(ctx, 0xCD1D); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xCD2A; return; }
+    // CD1F  CPX #$00
+    RecompiledBegin(ctx, 0xCD1F); Compare(cpu, cpu.X, 0x00); cpu.totalCycles += 2;
+    // CD21  BNE $CD2A
+    RecompiledBegin(ctx, 0xCD21); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xCD2A; return; }
+    // CD23  CPY #$99
+    RecompiledBegin(ctx, 0xCD23); Compare(cpu, cpu.Y, 0x99); cpu.totalCycles += 2;
+    // CD25  BNE $CD2A
+    RecompiledBegin(ctx, 0xCD25); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xCD2A; return; }
+    // CD27  JMP $CD2E
+    RecompiledBegin(ctx, 0xCD27); cpu.totalCycles += 3; cpu.PC = 0xCD2E; return;
+}
+
+static void Block_CD2A(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // CD2A  LDX #$42
+    RecompiledBegin(ctx, 0xCD2A); cpu.X = 0x42; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // CD2C  STX $00
+    RecompiledBegin(ctx, 0xCD2C); bus.write(0x0000, cpu.X); cpu.totalCycles += 3;
+    cpu.PC = 0xCD2E;
+}
+
+static void Block_CD2E(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // CD2E  NOP
+    RecompiledBegin(ctx, 0xCD2E); cpu.totalCycles += 2;
+    // CD2F  LDA #$85
+    RecompiledBegin(ctx, 0xCD2F); cpu.A = 0x85; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // CD31  LDX #$34
+    RecompiledBegin(ctx, 0xCD31); cpu.X = 0x34; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // CD33  LDY #$99
+    RecompiledBegin(ctx, 0xCD33); cpu.Y = 0x99; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // CD35  CLC
+    RecompiledBegin(ctx, 0xCD35); SetFlag(cpu, Flags::C, false); cpu.totalCycles += 2;
+    // CD36  BIT $01
+    RecompiledBegin(ctx, 0xCD36); BitTest(cpu, bus.read(0x0001)); cpu.totalCycles += 3;
+    // CD38  TYA
+    RecompiledBegin(ctx, 0xCD38); cpu.A = cpu.Y; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // CD39  BEQ $CD69
+    RecompiledBegin(ctx, 0xCD39); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xCD69; return; }
+    // CD3B  BCS $CD69
+    RecompiledBegin(ctx, 0xCD3B); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xCD69; return; }
+    // CD3D  BVC $CD69
+    RecompiledBegin(ctx, 0xCD3D); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xCD69; return; }
+    // CD3F  BPL $CD69
+    RecompiledBegin(ctx, 0xCD3F); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xCD69; return; }
+    // CD41  CMP #$99
+    RecompiledBegin(ctx, 0xCD41); Compare(cpu, cpu.A, 0x99); cpu.totalCycles += 2;
+    // CD43  BNE $CD69
+    RecompiledBegin(ctx, 0xCD43); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xCD69; return; }
+    // CD45  CPX #$34
+    RecompiledBegin(ctx, 0xCD45); Compare(cpu, cpu.X, 0x34); cpu.totalCycles += 2;
+    // CD47  BNE $CD69
+    RecompiledBegin(ctx, 0xCD47); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xCD69; return; }
+    // CD49  CPY #$99
+    RecompiledBegin(ctx, 0xCD49); Compare(cpu, cpu.Y, 0x99); cpu.totalCycles += 2;
+    // CD4B  BNE $CD69
+    RecompiledBegin(ctx, 0xCD4B); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xCD69; return; }
+    // CD4D  LDY #$00
+    RecompiledBegin(ctx, 0xCD4D); cpu.Y = 0x00; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // CD4F  SEC
+    RecompiledBegin(ctx, 0xCD4F); SetFlag(cpu, Flags::C, true); cpu.totalCycles += 2;
+    // CD50  CLV
+    RecompiledBegin(ctx, 0xCD50); SetFlag(cpu, Flags::V, false); cpu.totalCycles += 2;
+    // CD51  TYA
+    RecompiledBegin(ctx, 0xCD51); cpu.A = cpu.Y; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // CD52  BNE $CD69
+    RecompiledBegin(ctx, 0xCD52); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xCD69; return; }
+    // CD54  BCC $CD69
+    RecompiledBegin(ctx, 0xCD54); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xCD69; return; }
+    // CD56  BVS $CD69
+    RecompiledBegin(ctx, 0xCD56); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xCD69; return; }
+    // CD58  BMI $CD69
+    RecompiledBegin(ctx, 0xCD58); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xCD69; return; }
+    // CD5A  CMP #$00
+    RecompiledBegin(ctx, 0xCD5A); Compare(cpu, cpu.A, 0x00); cpu.totalCycles += 2;
+    // CD5C  BNE $CD69
+    RecompiledBegin(ctx, 0xCD5C); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xCD69; return; }
+    // CD5E  CPX #$34
+    RecompiledBegin(ctx, 0xCD5E); Compare(cpu, cpu.X, 0x34); cpu.totalCycles += 2;
+    // CD60  BNE $CD69
+    RecompiledBegin(ctx, 0xCD60); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xCD69; return; }
+    // CD62  CPY #$00
+    RecompiledBegin(ctx, 0xCD62); Compare(cpu, cpu.Y, 0x00); cpu.totalCycles += 2;
+    // CD64  BNE $CD69
+    RecompiledBegin(ctx, 0xCD64); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xCD69; return; }
+    // CD66  JMP $CD6D
+    RecompiledBegin(ctx, 0xCD66); cpu.totalCycles += 3; cpu.PC = 0xCD6D; return;
+}
+
+static void Block_CD69(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // CD69  LDX #$43
+    RecompiledBegin(ctx, 0xCD69); cpu.X = 0x43; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // CD6B  STX $00
+    RecompiledBegin(ctx, 0xCD6B); bus.write(0x0000, cpu.X); cpu.totalCycles += 3;
+    cpu.PC = 0xCD6D;
+}
+
+static void Block_CD6D(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // CD6D  NOP
+    RecompiledBegin(ctx, 0xCD6D); cpu.totalCycles += 2;
+    // CD6E  LDA #$85
+    RecompiledBegin(ctx, 0xCD6E); cpu.A = 0x85; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // CD70  LDX #$34
+    RecompiledBegin(ctx, 0xCD70); cpu.X = 0x34; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // CD72  LDY #$99
+    RecompiledBegin(ctx, 0xCD72); cpu.Y = 0x99; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // CD74  CLC
+    RecompiledBegin(ctx, 0xCD74); SetFlag(cpu, Flags::C, false); cpu.totalCycles += 2;
+    // CD75  BIT $01
+    RecompiledBegin(ctx, 0xCD75); BitTest(cpu, bus.read(0x0001)); cpu.totalCycles += 3;
+    // CD77  TXA
+    RecompiledBegin(ctx, 0xCD77); cpu.A = cpu.X; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // CD78  BEQ $CDA8
+    RecompiledBegin(ctx, 0xCD78); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xCDA8; return; }
+    // CD7A  BCS $CDA8
+    RecompiledBegin(ctx, 0xCD7A); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xCDA8; return; }
+    // CD7C  BVC $CDA8
+    RecompiledBegin(ctx, 0xCD7C); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xCDA8; return; }
+    // CD7E  BMI $CDA8
+    RecompiledBegin(ctx, 0xCD7E); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xCDA8; return; }
+    // CD80  CMP #$34
+    RecompiledBegin(ctx, 0xCD80); Compare(cpu, cpu.A, 0x34); cpu.totalCycles += 2;
+    // CD82  BNE $CDA8
+    RecompiledBegin(ctx, 0xCD82); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xCDA8; return; }
+    // CD84  CPX #$34
+    RecompiledBegin(ctx, 0xCD84); Compare(cpu, cpu.X, 0x34); cpu.totalCycles += 2;
+    // CD86  BNE $CDA8
+    RecompiledBegin(ctx, 0xCD86); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xCDA8; return; }
+    // CD88  CPY #$99
+    RecompiledBegin(ctx, 0xCD88); Compare(cpu, cpu.Y, 0x99); cpu.totalCycles += 2;
+    // CD8A  BNE $CDA8
+    RecompiledBegin(ctx, 0xCD8A); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xCDA8; return; }
+    // CD8C  LDX #$00
+    RecompiledBegin(ctx, 0xCD8C); cpu.X = 0x00; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // CD8E  SEC
+    RecompiledBegin(ctx, 0xCD8E); SetFlag(cpu, Flags::C, true); cpu.totalCycles += 2;
+    // CD8F  CLV
+    RecompiledBegin(ctx, 0xCD8F); SetFlag(cpu, Flags::V, false); cpu.totalCycles += 2;
+    // CD90  TXA
+    RecompiledBegin(ctx, 0xCD90); cpu.A = cpu.X; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // CD91  BNE $CDA8
+    RecompiledBegin(ctx, 0xCD91); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xCDA8; return; }
+    // CD93  BCC $CDA8
+    RecompiledBegin(ctx, 0xCD93); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xCDA8; return; }
+    // CD95  BVS $CDA8
+    RecompiledBegin(ctx, 0xCD95); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xCDA8; return; }
+    // CD97  BMI $CDA8
+    RecompiledBegin(ctx, 0xCD97); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xCDA8; return; }
+    // CD99  CMP #$00
+    RecompiledBegin(ctx, 0xCD99); Compare(cpu, cpu.A, 0x00); cpu.totalCycles += 2;
+    // CD9B  BNE $CDA8
+    RecompiledBegin(ctx, 0xCD9B); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xCDA8; return; }
+    // CD9D  CPX #$00
+    RecompiledBegin(ctx, 0xCD9D); Compare(cpu, cpu.X, 0x00); cpu.totalCycles += 2;
+    // CD9F  BNE $CDA8
+    RecompiledBegin(ctx, 0xCD9F); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xCDA8; return; }
+    // CDA1  CPY #$99
+    RecompiledBegin(ctx, 0xCDA1); Compare(cpu, cpu.Y, 0x99); cpu.totalCycles += 2;
+    // CDA3  BNE $CDA8
+    RecompiledBegin(ctx, 0xCDA3); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xCDA8; return; }
+    // CDA5  JMP $CDAC
+    RecompiledBegin(ctx, 0xCDA5); cpu.totalCycles += 3; cpu.PC = 0xCDAC; return;
+}
+
+static void Block_CDA8(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // CDA8  LDX #$44
+    RecompiledBegin(ctx, 0xCDA8); cpu.X = 0x44; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // CDAA  STX $00
+    RecompiledBegin(ctx, 0xCDAA); bus.write(0x0000, cpu.X); cpu.totalCycles += 3;
+    cpu.PC = 0xCDAC;
+}
+
+static void Block_CDAC(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // CDAC  NOP
+    RecompiledBegin(ctx, 0xCDAC); cpu.totalCycles += 2;
+    // CDAD  TSX
+    RecompiledBegin(ctx, 0xCDAD); cpu.X = cpu.SP; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // CDAE  STX $07FF
+    RecompiledBegin(ctx, 0xCDAE); bus.write(0x07FF, cpu.X); cpu.totalCycles += 4;
+    // CDB1  LDY #$33
+    RecompiledBegin(ctx, 0xCDB1); cpu.Y = 0x33; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // CDB3  LDX #$69
+    RecompiledBegin(ctx, 0xCDB3); cpu.X = 0x69; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // CDB5  LDA #$84
+    RecompiledBegin(ctx, 0xCDB5); cpu.A = 0x84; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // CDB7  CLC
+    RecompiledBegin(ctx, 0xCDB7); SetFlag(cpu, Flags::C, false); cpu.totalCycles += 2;
+    // CDB8  BIT $01
+    RecompiledBegin(ctx, 0xCDB8); BitTest(cpu, bus.read(0x0001)); cpu.totalCycles += 3;
+    // CDBA  TXS
+    RecompiledBegin(ctx, 0xCDBA); cpu.SP = cpu.X; cpu.totalCycles += 2;
+    // CDBB  BEQ $CDEF
+    RecompiledBegin(ctx, 0xCDBB); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xCDEF; return; }
+    // CDBD  BPL $CDEF
+    RecompiledBegin(ctx, 0xCDBD); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xCDEF; return; }
+    // CDBF  BCS $CDEF
+    RecompiledBegin(ctx, 0xCDBF); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xCDEF; return; }
+    // CDC1  BVC $CDEF
+    RecompiledBegin(ctx, 0xCDC1); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xCDEF; return; }
+    // CDC3  CMP #$84
+    RecompiledBegin(ctx, 0xCDC3); Compare(cpu, cpu.A, 0x84); cpu.totalCycles += 2;
+    // CDC5  BNE $CDEF
+    RecompiledBegin(ctx, 0xCDC5); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xCDEF; return; }
+    // CDC7  CPX #$69
+    RecompiledBegin(ctx, 0xCDC7); Compare(cpu, cpu.X, 0x69); cpu.totalCycles += 2;
+    // CDC9  BNE $CDEF
+    RecompiledBegin(ctx, 0xCDC9); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xCDEF; return; }
+    // CDCB  CPY #$33
+    RecompiledBegin(ctx, 0xCDCB); Compare(cpu, cpu.Y, 0x33); cpu.totalCycles += 2;
+    // CDCD  BNE $CDEF
+    RecompiledBegin(ctx, 0xCDCD); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xCDEF; return; }
+    // CDCF  LDY #$01
+    RecompiledBegin(ctx, 0xCDCF); cpu.Y = 0x01; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // CDD1  LDA #$04
+    RecompiledBegin(ctx, 0xCDD1); cpu.A = 0x04; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // CDD3  SEC
+    RecompiledBegin(ctx, 0xCDD3); SetFlag(cpu, Flags::C, true); cpu.totalCycles += 2;
+    // CDD4  CLV
+    RecompiledBegin(ctx, 0xCDD4); SetFlag(cpu, Flags::V, false); cpu.totalCycles += 2;
+    // CDD5  LDX #$00
+    RecompiledBegin(ctx, 0xCDD5); cpu.X = 0x00; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // CDD7  TSX
+    RecompiledBegin(ctx, 0xCDD7); cpu.X = cpu.SP; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // CDD8  BEQ $CDEF
+    RecompiledBegin(ctx, 0xCDD8); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xCDEF; return; }
+    // CDDA  BMI $CDEF
+    RecompiledBegin(ctx, 0xCDDA); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xCDEF; return; }
+    // CDDC  BCC $CDEF
+    RecompiledBegin(ctx, 0xCDDC); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xCDEF; return; }
+    // CDDE  BVS $CDEF
+    RecompiledBegin(ctx, 0xCDDE); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xCDEF; return; }
+    // CDE0  CPX #$69
+    RecompiledBegin(ctx, 0xCDE0); Compare(cpu, cpu.X, 0x69); cpu.totalCycles += 2;
+    // CDE2  BNE $CDEF
+    RecompiledBegin(ctx, 0xCDE2); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xCDEF; return; }
+    // CDE4  CMP #$04
+    RecompiledBegin(ctx, 0xCDE4); Compare(cpu, cpu.A, 0x04); cpu.totalCycles += 2;
+    // CDE6  BNE $CDEF
+    RecompiledBegin(ctx, 0xCDE6); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xCDEF; return; }
+    // CDE8  CPY #$01
+    RecompiledBegin(ctx, 0xCDE8); Compare(cpu, cpu.Y, 0x01); cpu.totalCycles += 2;
+    // CDEA  BNE $CDEF
+    RecompiledBegin(ctx, 0xCDEA); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xCDEF; return; }
+    // CDEC  JMP $CDF3
+    RecompiledBegin(ctx, 0xCDEC); cpu.totalCycles += 3; cpu.PC = 0xCDF3; return;
+}
+
+static void Block_CDEF(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // CDEF  LDX #$45
+    RecompiledBegin(ctx, 0xCDEF); cpu.X = 0x45; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // CDF1  STX $00
+    RecompiledBegin(ctx, 0xCDF1); bus.write(0x0000, cpu.X); cpu.totalCycles += 3;
+    cpu.PC = 0xCDF3;
+}
+
+static void Block_CDF3(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // CDF3  LDX $07FF
+    RecompiledBegin(ctx, 0xCDF3); cpu.X = bus.read(0x07FF); SetNZ(cpu, cpu.X); cpu.totalCycles += 4;
+    // CDF6  TXS
+    RecompiledBegin(ctx, 0xCDF6); cpu.SP = cpu.X; cpu.totalCycles += 2;
+    // CDF7  RTS
+    { RecompiledBegin(ctx, 0xCDF7); cpu.SP++; const byte low = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); const byte high = bus.read(static_cast<memAddress>(0x0100 + cpu.SP + 1)); cpu.SP++; cpu.totalCycles += 6; cpu.PC = static_cast<memAddress>(RecompiledWord(low, high) + 1); return; }
+}
+
+static void Block_CDF8(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // CDF8  LDA #$FF
+    RecompiledBegin(ctx, 0xCDF8); cpu.A = 0xFF; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // CDFA  STA $01
+    RecompiledBegin(ctx, 0xCDFA); bus.write(0x0001, cpu.A); cpu.totalCycles += 3;
+    // CDFC  TSX
+    RecompiledBegin(ctx, 0xCDFC); cpu.X = cpu.SP; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // CDFD  STX $07FF
+    RecompiledBegin(ctx, 0xCDFD); bus.write(0x07FF, cpu.X); cpu.totalCycles += 4;
+    // CE00  NOP
+    RecompiledBegin(ctx, 0xCE00); cpu.totalCycles += 2;
+    // CE01  LDX #$80
+    RecompiledBegin(ctx, 0xCE01); cpu.X = 0x80; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // CE03  TXS
+    RecompiledBegin(ctx, 0xCE03); cpu.SP = cpu.X; cpu.totalCycles += 2;
+    // CE04  LDA #$33
+    RecompiledBegin(ctx, 0xCE04); cpu.A = 0x33; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // CE06  PHA
+    RecompiledBegin(ctx, 0xCE06); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), cpu.A); cpu.totalCycles += 3;
+    // CE07  LDA #$69
+    RecompiledBegin(ctx, 0xCE07); cpu.A = 0x69; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // CE09  PHA
+    RecompiledBegin(ctx, 0xCE09); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), cpu.A); cpu.totalCycles += 3;
+    // CE0A  TSX
+    RecompiledBegin(ctx, 0xCE0A); cpu.X = cpu.SP; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // CE0B  CPX #$7E
+    RecompiledBegin(ctx, 0xCE0B); Compare(cpu, cpu.X, 0x7E); cpu.totalCycles += 2;
+    // CE0D  BNE $CE2F
+    RecompiledBegin(ctx, 0xCE0D); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xCE2F; return; }
+    // CE0F  PLA
+    RecompiledBegin(ctx, 0xCE0F); cpu.SP++; cpu.A = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); SetNZ(cpu, cpu.A); cpu.totalCycles += 4;
+    // CE10  CMP #$69
+    RecompiledBegin(ctx, 0xCE10); Compare(cpu, cpu.A, 0x69); cpu.totalCycles += 2;
+    // CE12  BNE $CE2F
+    RecompiledBegin(ctx, 0xCE12); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xCE2F; return; }
+    // CE14  PLA
+    RecompiledBegin(ctx, 0xCE14); cpu.SP++; cpu.A = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); SetNZ(cpu, cpu.A); cpu.totalCycles += 4;
+    // CE15  CMP #$33
+    RecompiledBegin(ctx, 0xCE15); Compare(cpu, cpu.A, 0x33); cpu.totalCycles += 2;
+    // CE17  BNE $CE2F
+    RecompiledBegin(ctx, 0xCE17); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xCE2F; return; }
+    // CE19  TSX
+    RecompiledBegin(ctx, 0xCE19); cpu.X = cpu.SP; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // CE1A  CPX #$80
+    RecompiledBegin(ctx, 0xCE1A); Compare(cpu, cpu.X, 0x80); cpu.totalCycles += 2;
+    // CE1C  BNE $CE2F
+    RecompiledBegin(ctx, 0xCE1C); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xCE2F; return; }
+    // CE1E  LDA $0180
+    RecompiledBegin(ctx, 0xCE1E); cpu.A = bus.read(0x0180); SetNZ(cpu, cpu.A); cpu.totalCycles += 4;
+    // CE21  CMP #$33
+    RecompiledBegin(ctx, 0xCE21); Compare(cpu, cpu.A, 0x33); cpu.totalCycles += 2;
+    // CE23  BNE $CE2F
+    RecompiledBegin(ctx, 0xCE23); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xCE2F; return; }
+    // CE25  LDA $017F
+    RecompiledBegin(ctx, 0xCE25); cpu.A = bus.read(0x017F); SetNZ(cpu, cpu.A); cpu.totalCycles += 4;
+    // CE28  CMP #$69
+    RecompiledBegin(ctx, 0xCE28); Compare(cpu, cpu.A, 0x69); cpu.totalCycles += 2;
+    // CE2A  BNE $CE2F
+    RecompiledBegin(ctx, 0xCE2A); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xCE2F; return; }
+    // CE2C  JMP $CE33
+    RecompiledBegin(ctx, 0xCE2C); cpu.totalCycles += 3; cpu.PC = 0xCE33; return;
+}
+
+static void Block_CE2F(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // CE2F  LDX #$46
+    RecompiledBegin(ctx, 0xCE2F); cpu.X = 0x46; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // CE31  STX $00
+    RecompiledBegin(ctx, 0xCE31); bus.write(0x0000, cpu.X); cpu.totalCycles += 3;
+    cpu.PC = 0xCE33;
+}
+
+static void Block_CE33(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // CE33  NOP
+    RecompiledBegin(ctx, 0xCE33); cpu.totalCycles += 2;
+    // CE34  LDX #$80
+    RecompiledBegin(ctx, 0xCE34); cpu.X = 0x80; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // CE36  TXS
+    RecompiledBegin(ctx, 0xCE36); cpu.SP = cpu.X; cpu.totalCycles += 2;
+    // CE37  JSR $CE3D
+    RecompiledBegin(ctx, 0xCE37); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xCE); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x39); cpu.totalCycles += 6; cpu.PC = 0xCE3D; return;
+}
+
+static void Block_CE3A(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    // CE3A  JMP $CE5B
+    RecompiledBegin(ctx, 0xCE3A); cpu.totalCycles += 3; cpu.PC = 0xCE5B; return;
+}
+
+static void Block_CE3D(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // CE3D  TSX
+    RecompiledBegin(ctx, 0xCE3D); cpu.X = cpu.SP; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // CE3E  CPX #$7E
+    RecompiledBegin(ctx, 0xCE3E); Compare(cpu, cpu.X, 0x7E); cpu.totalCycles += 2;
+    // CE40  BNE $CE5B
+    RecompiledBegin(ctx, 0xCE40); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xCE5B; return; }
+    // CE42  PLA
+    RecompiledBegin(ctx, 0xCE42); cpu.SP++; cpu.A = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); SetNZ(cpu, cpu.A); cpu.totalCycles += 4;
+    // CE43  PLA
+    RecompiledBegin(ctx, 0xCE43); cpu.SP++; cpu.A = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); SetNZ(cpu, cpu.A); cpu.totalCycles += 4;
+    // CE44  TSX
+    RecompiledBegin(ctx, 0xCE44); cpu.X = cpu.SP; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // CE45  CPX #$80
+    RecompiledBegin(ctx, 0xCE45); Compare(cpu, cpu.X, 0x80); cpu.totalCycles += 2;
+    // CE47  BNE $CE5B
+    RecompiledBegin(ctx, 0xCE47); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xCE5B; return; }
+    // CE49  LDA #$00
+    RecompiledBegin(ctx, 0xCE49); cpu.A = 0x00; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // CE4B  JSR $CE4E
+    RecompiledBegin(ctx, 0xCE4B); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xCE); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x4D); cpu.totalCycles += 6; cpu.PC = 0xCE4E; return;
+}
+
+static void Block_CE4E(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // CE4E  PLA
+    RecompiledBegin(ctx, 0xCE4E); cpu.SP++; cpu.A = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); SetNZ(cpu, cpu.A); cpu.totalCycles += 4;
+    // CE4F  CMP #$4D
+    RecompiledBegin(ctx, 0xCE4F); Compare(cpu, cpu.A, 0x4D); cpu.totalCycles += 2;
+    // CE51  BNE $CE5B
+    RecompiledBegin(ctx, 0xCE51); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xCE5B; return; }
+    // CE53  PLA
+    RecompiledBegin(ctx, 0xCE53); cpu.SP++; cpu.A = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); SetNZ(cpu, cpu.A); cpu.totalCycles += 4;
+    // CE54  CMP #$CE
+    RecompiledBegin(ctx, 0xCE54); Compare(cpu, cpu.A, 0xCE); cpu.totalCycles += 2;
+    // CE56  BNE $CE5B
+    RecompiledBegin(ctx, 0xCE56); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xCE5B; return; }
+    // CE58  JMP $CE5F
+    RecompiledBegin(ctx, 0xCE58); cpu.totalCycles += 3; cpu.PC = 0xCE5F; return;
+}
+
+static void Block_CE5B(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // CE5B  LDX #$47
+    RecompiledBegin(ctx, 0xCE5B); cpu.X = 0x47; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // CE5D  STX $00
+    RecompiledBegin(ctx, 0xCE5D); bus.write(0x0000, cpu.X); cpu.totalCycles += 3;
+    cpu.PC = 0xCE5F;
+}
+
+static void Block_CE5F(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // CE5F  NOP
+    RecompiledBegin(ctx, 0xCE5F); cpu.totalCycles += 2;
+    // CE60  LDA #$CE
+    RecompiledBegin(ctx, 0xCE60); cpu.A = 0xCE; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // CE62  PHA
+    RecompiledBegin(ctx, 0xCE62); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), cpu.A); cpu.totalCycles += 3;
+    // CE63  LDA #$66
+    RecompiledBegin(ctx, 0xCE63); cpu.A = 0x66; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // CE65  PHA
+    RecompiledBegin(ctx, 0xCE65); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), cpu.A); cpu.totalCycles += 3;
+    // CE66  RTS
+    { RecompiledBegin(ctx, 0xCE66); cpu.SP++; const byte low = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); const byte high = bus.read(static_cast<memAddress>(0x0100 + cpu.SP + 1)); cpu.SP++; cpu.totalCycles += 6; cpu.PC = static_cast<memAddress>(RecompiledWord(low, high) + 1); return; }
+}
+
+static void Block_CEEE(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // CEEE  LDX #$55
+    RecompiledBegin(ctx, 0xCEEE); cpu.X = 0x55; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // CEF0  LDY #$69
+    RecompiledBegin(ctx, 0xCEF0); cpu.Y = 0x69; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // CEF2  LDA #$FF
+    RecompiledBegin(ctx, 0xCEF2); cpu.A = 0xFF; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // CEF4  STA $01
+    RecompiledBegin(ctx, 0xCEF4); bus.write(0x0001, cpu.A); cpu.totalCycles += 3;
+    // CEF6  NOP
+    RecompiledBegin(ctx, 0xCEF6); cpu.totalCycles += 2;
+    // CEF7  BIT $01
+    RecompiledBegin(ctx, 0xCEF7); BitTest(cpu, bus.read(0x0001)); cpu.totalCycles += 3;
+    // CEF9  SEC
+    RecompiledBegin(ctx, 0xCEF9); SetFlag(cpu, Flags::C, true); cpu.totalCycles += 2;
+    // CEFA  LDA #$01
+    RecompiledBegin(ctx, 0xCEFA); cpu.A = 0x01; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // CEFC  LSR
+    RecompiledBegin(ctx, 0xCEFC); cpu.A = ShiftRight(cpu, cpu.A); cpu.totalCycles += 2;
+    // CEFD  BCC $CF1C
+    RecompiledBegin(ctx, 0xCEFD); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::C)) { cpu.totalCycles += 2; cpu.PC = 0xCF1C; return; }
+    // CEFF  BNE $CF1C
+    RecompiledBegin(ctx, 0xCEFF); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xCF1C; return; }
+    // CF01  BMI $CF1C
+    RecompiledBegin(ctx, 0xCF01); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xCF1C; return; }
+    // CF03  BVC $CF1C
+    RecompiledBegin(ctx, 0xCF03); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xCF1C; return; }
+    // CF05  CMP #$00
+    RecompiledBegin(ctx, 0xCF05); Compare(cpu, cpu.A, 0x00); cpu.totalCycles += 2;
+    // CF07  BNE $CF1C
+    RecompiledBegin(ctx, 0xCF07); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xCF1C; return; }
+    // CF09  CLV
+    RecompiledBegin(ctx, 0xCF09); SetFlag(cpu, Flags::V, false); cpu.totalCycles += 2;
+    // CF0A  LDA #$AA
+    RecompiledBegin(ctx, 0xCF0A); cpu.A = 0xAA; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // CF0C  LSR
+    RecompiledBegin(ctx, 0xCF0C); cpu.A = ShiftRight(cpu, cpu.A); cpu.totalCycles += 2;
+    // CF0D  BCS $CF1C
+    RecompiledBegin(ctx, 0xCF0D); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xCF1C; return; }
+    // CF0F  BEQ $CF1C
+    RecompiledBegin(ctx, 0xCF0F); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xCF1C; return; }
+    // CF11  BMI $CF1C
+    RecompiledBegin(ctx, 0xCF11); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xCF1C; return; }
+    // CF13  BVS $CF1C
+    RecompiledBegin(ctx, 0xCF13); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xCF1C; return; }
+    // CF15  CMP #$55
+    RecompiledBegin(ctx, 0xCF15); Compare(cpu, cpu.A, 0x55); cpu.totalCycles += 2;
+    // CF17  BNE $CF1C
+    RecompiledBegin(ctx, 0xCF17); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xCF1C; return; }
+    // CF19  JMP $CF20
+    RecompiledBegin(ctx, 0xCF19); cpu.totalCycles += 3; cpu.PC = 0xCF20; return;
+}
+
+static void Block_CF1C(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // CF1C  LDX #$4A
+    RecompiledBegin(ctx, 0xCF1C); cpu.X = 0x4A; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // CF1E  STX $00
+    RecompiledBegin(ctx, 0xCF1E); bus.write(0x0000, cpu.X); cpu.totalCycles += 3;
+    cpu.PC = 0xCF20;
+}
+
+static void Block_CF20(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // CF20  NOP
+    RecompiledBegin(ctx, 0xCF20); cpu.totalCycles += 2;
+    // CF21  BIT $01
+    RecompiledBegin(ctx, 0xCF21); BitTest(cpu, bus.read(0x0001)); cpu.totalCycles += 3;
+    // CF23  SEC
+    RecompiledBegin(ctx, 0xCF23); SetFlag(cpu, Flags::C, true); cpu.totalCycles += 2;
+    // CF24  LDA #$80
+    RecompiledBegin(ctx, 0xCF24); cpu.A = 0x80; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // CF26  ASL
+    RecompiledBegin(ctx, 0xCF26); cpu.A = ShiftLeft(cpu, cpu.A); cpu.totalCycles += 2;
+    // CF27  BCC $CF47
+    RecompiledBegin(ctx, 0xCF27); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xCF47; return; }
+    // CF29  BNE $CF47
+    RecompiledBegin(ctx, 0xCF29); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xCF47; return; }
+    // CF2B  BMI $CF47
+    RecompiledBegin(ctx, 0xCF2B); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xCF47; return; }
+    // CF2D  BVC $CF47
+    RecompiledBegin(ctx, 0xCF2D); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xCF47; return; }
+    // CF2F  CMP #$00
+    RecompiledBegin(ctx, 0xCF2F); Compare(cpu, cpu.A, 0x00); cpu.totalCycles += 2;
+    // CF31  BNE $CF47
+    RecompiledBegin(ctx, 0xCF31); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xCF47; return; }
+    // CF33  CLV
+    RecompiledBegin(ctx, 0xCF33); SetFlag(cpu, Flags::V, false); cpu.totalCycles += 2;
+    // CF34  SEC
+    RecompiledBegin(ctx, 0xCF34); SetFlag(cpu, Flags::C, true); cpu.totalCycles += 2;
+    // CF35  LDA #$55
+    RecompiledBegin(ctx, 0xCF35); cpu.A = 0x55; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // CF37  ASL
+    RecompiledBegin(ctx, 0xCF37); cpu.A = ShiftLeft(cpu, cpu.A); cpu.totalCycles += 2;
+    // CF38  BCS $CF47
+    RecompiledBegin(ctx, 0xCF38); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xCF47; return; }
+    // CF3A  BEQ $CF47
+    RecompiledBegin(ctx, 0xCF3A); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xCF47; return; }
+    // CF3C  BPL $CF47
+    RecompiledBegin(ctx, 0xCF3C); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xCF47; return; }
+    // CF3E  BVS $CF47
+    RecompiledBegin(ctx, 0xCF3E); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xCF47; return; }
+    // CF40  CMP #$AA
+    RecompiledBegin(ctx, 0xCF40); Compare(cpu, cpu.A, 0xAA); cpu.totalCycles += 2;
+    // CF42  BNE $CF47
+    RecompiledBegin(ctx, 0xCF42); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xCF47; return; }
+    // CF44  JMP $CF4B
+    RecompiledBegin(ctx, 0xCF44); cpu.totalCycles += 3; cpu.PC = 0xCF4B; return;
+}
+
+static void Block_CF47(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // CF47  LDX #$4B
+    RecompiledBegin(ctx, 0xCF47); cpu.X = 0x4B; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // CF49  STX $00
+    RecompiledBegin(ctx, 0xCF49); bus.write(0x0000, cpu.X); cpu.totalCycles += 3;
+    cpu.PC = 0xCF4B;
+}
+
+static void Block_CF4B(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // CF4B  NOP
+    RecompiledBegin(ctx, 0xCF4B); cpu.totalCycles += 2;
+    // CF4C  BIT $01
+    RecompiledBegin(ctx, 0xCF4C); BitTest(cpu, bus.read(0x0001)); cpu.totalCycles += 3;
+    // CF4E  SEC
+    RecompiledBegin(ctx, 0xCF4E); SetFlag(cpu, Flags::C, true); cpu.totalCycles += 2;
+    // CF4F  LDA #$01
+    RecompiledBegin(ctx, 0xCF4F); cpu.A = 0x01; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // CF51  ROR
+    RecompiledBegin(ctx, 0xCF51); cpu.A = RotateRight(cpu, cpu.A); cpu.totalCycles += 2;
+    // CF52  BCC $CF72
+    RecompiledBegin(ctx, 0xCF52); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xCF72; return; }
+    // CF54  BEQ $CF72
+    RecompiledBegin(ctx, 0xCF54); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xCF72; return; }
+    // CF56  BPL $CF72
+    RecompiledBegin(ctx, 0xCF56); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xCF72; return; }
+    // CF58  BVC $CF72
+    RecompiledBegin(ctx, 0xCF58); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xCF72; return; }
+    // CF5A  CMP #$80
+    RecompiledBegin(ctx, 0xCF5A); Compare(cpu, cpu.A, 0x80); cpu.totalCycles += 2;
+    // CF5C  BNE $CF72
+    RecompiledBegin(ctx, 0xCF5C); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xCF72; return; }
+    // CF5E  CLV
+    RecompiledBegin(ctx, 0xCF5E); SetFlag(cpu, Flags::V, false); cpu.totalCycles += 2;
+    // CF5F  CLC
+    RecompiledBegin(ctx, 0xCF5F); SetFlag(cpu, Flags::C, false); cpu.totalCycles += 2;
+    // CF60  LDA #$55
+    RecompiledBegin(ctx, 0xCF60); cpu.A = 0x55; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // CF62  ROR
+    RecompiledBegin(ctx, 0xCF62); cpu.A = RotateRight(cpu, cpu.A); cpu.totalCycles += 2;
+    // CF63  BCC $CF72
+    RecompiledBegin(ctx, 0xCF63); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xCF72; return; }
+    // CF65  BEQ $CF72
+    RecompiledBegin(ctx, 0xCF65); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xCF72; return; }
+    // CF67  BMI $CF72
+    RecompiledBegin(ctx, 0xCF67); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xCF72; return; }
+    // CF69  BVS $CF72
+    RecompiledBegin(ctx, 0xCF69); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xCF72; return; }
+    // CF6B  CMP #$2A
+    RecompiledBegin(ctx, 0xCF6B); Compare(cpu, cpu.A, 0x2A); cpu.totalCycles += 2;
+    // CF6D  BNE $CF72
+    RecompiledBegin(ctx, 0xCF6D); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xCF72; return; }
+    // CF6F  JMP $CF76
+    RecompiledBegin(ctx, 0xCF6F); cpu.totalCycles += 3; cpu.PC = 0xCF76; return;
+}
+
+static void Block_CF72(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // CF72  LDX #$4C
+    RecompiledBegin(ctx, 0xCF72); cpu.X = 0x4C; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // CF74  STX $00
+    RecompiledBegin(ctx, 0xCF74); bus.write(0x0000, cpu.X); cpu.totalCycles += 3;
+    cpu.PC = 0xCF76;
+}
+
+static void Block_CF76(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // CF76  NOP
+    RecompiledBegin(ctx, 0xCF76); cpu.totalCycles += 2;
+    // CF77  BIT $01
+    RecompiledBegin(ctx, 0xCF77); BitTest(cpu, bus.read(0x0001)); cpu.totalCycles += 3;
+    // CF79  SEC
+    RecompiledBegin(ctx, 0xCF79); SetFlag(cpu, Flags::C, true); cpu.totalCycles += 2;
+    // CF7A  LDA #$80
+    RecompiledBegin(ctx, 0xCF7A); cpu.A = 0x80; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // CF7C  ROL
+    RecompiledBegin(ctx, 0xCF7C); cpu.A = RotateLeft(cpu, cpu.A); cpu.totalCycles += 2;
+    // CF7D  BCC $CF9D
+    RecompiledBegin(ctx, 0xCF7D); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xCF9D; return; }
+    // CF7F  BEQ $CF9D
+    RecompiledBegin(ctx, 0xCF7F); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xCF9D; return; }
+    // CF81  BMI $CF9D
+    RecompiledBegin(ctx, 0xCF81); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xCF9D; return; }
+    // CF83  BVC $CF9D
+    RecompiledBegin(ctx, 0xCF83); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xCF9D; return; }
+    // CF85  CMP #$01
+    RecompiledBegin(ctx, 0xCF85); Compare(cpu, cpu.A, 0x01); cpu.totalCycles += 2;
+    // CF87  BNE $CF9D
+    RecompiledBegin(ctx, 0xCF87); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xCF9D; return; }
+    // CF89  CLV
+    RecompiledBegin(ctx, 0xCF89); SetFlag(cpu, Flags::V, false); cpu.totalCycles += 2;
+    // CF8A  CLC
+    RecompiledBegin(ctx, 0xCF8A); SetFlag(cpu, Flags::C, false); cpu.totalCycles += 2;
+    // CF8B  LDA #$55
+    RecompiledBegin(ctx, 0xCF8B); cpu.A = 0x55; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // CF8D  ROL
+    RecompiledBegin(ctx, 0xCF8D); cpu.A = RotateLeft(cpu, cpu.A); cpu.totalCycles += 2;
+    // CF8E  BCS $CF9D
+    RecompiledBegin(ctx, 0xCF8E); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xCF9D; return; }
+    // CF90  BEQ $CF9D
+    RecompiledBegin(ctx, 0xCF90); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xCF9D; return; }
+    // CF92  BPL $CF9D
+    RecompiledBegin(ctx, 0xCF92); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xCF9D; return; }
+    // CF94  BVS $CF9D
+    RecompiledBegin(ctx, 0xCF94); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xCF9D; return; }
+    // CF96  CMP #$AA
+    RecompiledBegin(ctx, 0xCF96); Compare(cpu, cpu.A, 0xAA); cpu.totalCycles += 2;
+    // CF98  BNE $CF9D
+    RecompiledBegin(ctx, 0xCF98); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xCF9D; return; }
+    // CF9A  JMP $CFA1
+    RecompiledBegin(ctx, 0xCF9A); cpu.totalCycles += 3; cpu.PC = 0xCFA1; return;
+}
+
+static void Block_CF9D(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // CF9D  LDX #$4D
+    RecompiledBegin(ctx, 0xCF9D); cpu.X = 0x4D; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // CF9F  STX $00
+    RecompiledBegin(ctx, 0xCF9F); bus.write(0x0000, cpu.X); cpu.totalCycles += 3;
+    cpu.PC = 0xCFA1;
+}
+
+static void Block_CFA1(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // CFA1  RTS
+    { RecompiledBegin(ctx, 0xCFA1); cpu.SP++; const byte low = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); const byte high = bus.read(static_cast<memAddress>(0x0100 + cpu.SP + 1)); cpu.SP++; cpu.totalCycles += 6; cpu.PC = static_cast<memAddress>(RecompiledWord(low, high) + 1); return; }
+}
+
+static void Block_CFA2(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // CFA2  LDA $00
+    RecompiledBegin(ctx, 0xCFA2); cpu.A = bus.read(0x0000); SetNZ(cpu, cpu.A); cpu.totalCycles += 3;
+    // CFA4  STA $07FF
+    RecompiledBegin(ctx, 0xCFA4); bus.write(0x07FF, cpu.A); cpu.totalCycles += 4;
+    // CFA7  LDA #$00
+    RecompiledBegin(ctx, 0xCFA7); cpu.A = 0x00; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // CFA9  STA $80
+    RecompiledBegin(ctx, 0xCFA9); bus.write(0x0080, cpu.A); cpu.totalCycles += 3;
+    // CFAB  LDA #$02
+    RecompiledBegin(ctx, 0xCFAB); cpu.A = 0x02; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // CFAD  STA $81
+    RecompiledBegin(ctx, 0xCFAD); bus.write(0x0081, cpu.A); cpu.totalCycles += 3;
+    // CFAF  LDA #$FF
+    RecompiledBegin(ctx, 0xCFAF); cpu.A = 0xFF; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // CFB1  STA $01
+    RecompiledBegin(ctx, 0xCFB1); bus.write(0x0001, cpu.A); cpu.totalCycles += 3;
+    // CFB3  LDA #$00
+    RecompiledBegin(ctx, 0xCFB3); cpu.A = 0x00; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // CFB5  STA $82
+    RecompiledBegin(ctx, 0xCFB5); bus.write(0x0082, cpu.A); cpu.totalCycles += 3;
+    // CFB7  LDA #$03
+    RecompiledBegin(ctx, 0xCFB7); cpu.A = 0x03; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // CFB9  STA $83
+    RecompiledBegin(ctx, 0xCFB9); bus.write(0x0083, cpu.A); cpu.totalCycles += 3;
+    // CFBB  STA $84
+    RecompiledBegin(ctx, 0xCFBB); bus.write(0x0084, cpu.A); cpu.totalCycles += 3;
+    // CFBD  LDA #$00
+    RecompiledBegin(ctx, 0xCFBD); cpu.A = 0x00; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // CFBF  STA $FF
+    RecompiledBegin(ctx, 0xCFBF); bus.write(0x00FF, cpu.A); cpu.totalCycles += 3;
+    // CFC1  LDA #$04
+    RecompiledBegin(ctx, 0xCFC1); cpu.A = 0x04; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // CFC3  STA $00
+    RecompiledBegin(ctx, 0xCFC3); bus.write(0x0000, cpu.A); cpu.totalCycles += 3;
+    // CFC5  LDA #$5A
+    RecompiledBegin(ctx, 0xCFC5); cpu.A = 0x5A; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // CFC7  STA $0200
+    RecompiledBegin(ctx, 0xCFC7); bus.write(0x0200, cpu.A); cpu.totalCycles += 4;
+    // CFCA  LDA #$5B
+    RecompiledBegin(ctx, 0xCFCA); cpu.A = 0x5B; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // CFCC  STA $0300
+    RecompiledBegin(ctx, 0xCFCC); bus.write(0x0300, cpu.A); cpu.totalCycles += 4;
+    // CFCF  LDA #$5C
+    RecompiledBegin(ctx, 0xCFCF); cpu.A = 0x5C; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // CFD1  STA $0303
+    RecompiledBegin(ctx, 0xCFD1); bus.write(0x0303, cpu.A); cpu.totalCycles += 4;
+    // CFD4  LDA #$5D
+    RecompiledBegin(ctx, 0xCFD4); cpu.A = 0x5D; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // CFD6  STA $0400
+    RecompiledBegin(ctx, 0xCFD6); bus.write(0x0400, cpu.A); cpu.totalCycles += 4;
+    // CFD9  LDX #$00
+    RecompiledBegin(ctx, 0xCFD9); cpu.X = 0x00; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // CFDB  LDA ($80,X)
+    { RecompiledBegin(ctx, 0xCFDB); const byte pointer = static_cast<byte>(0x80 + cpu.X); const memAddress ea = RecompiledWord(bus.read(pointer), bus.read(static_cast<byte>(pointer + 1))); cpu.A = bus.read(ea); SetNZ(cpu, cpu.A); cpu.totalCycles += 6; }
+    // CFDD  CMP #$5A
+    RecompiledBegin(ctx, 0xCFDD); Compare(cpu, cpu.A, 0x5A); cpu.totalCycles += 2;
+    // CFDF  BNE $D000
+    RecompiledBegin(ctx, 0xCFDF); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 2; cpu.PC = 0xD000; return; }
+    // CFE1  INX
+    RecompiledBegin(ctx, 0xCFE1); cpu.X++; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // CFE2  INX
+    RecompiledBegin(ctx, 0xCFE2); cpu.X++; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // CFE3  LDA ($80,X)
+    { RecompiledBegin(ctx, 0xCFE3); const byte pointer = static_cast<byte>(0x80 + cpu.X); const memAddress ea = RecompiledWord(bus.read(pointer), bus.read(static_cast<byte>(pointer + 1))); cpu.A = bus.read(ea); SetNZ(cpu, cpu.A); cpu.totalCycles += 6; }
+    // CFE5  CMP #$5B
+    RecompiledBegin(ctx, 0xCFE5); Compare(cpu, cpu.A, 0x5B); cpu.totalCycles += 2;
+    // CFE7  BNE $D000
+    RecompiledBegin(ctx, 0xCFE7); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 2; cpu.PC = 0xD000; return; }
+    // CFE9  INX
+    RecompiledBegin(ctx, 0xCFE9); cpu.X++; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // CFEA  LDA ($80,X)
+    { RecompiledBegin(ctx, 0xCFEA); const byte pointer = static_cast<byte>(0x80 + cpu.X); const memAddress ea = RecompiledWord(bus.read(pointer), bus.read(static_cast<byte>(pointer + 1))); cpu.A = bus.read(ea); SetNZ(cpu, cpu.A); cpu.totalCycles += 6; }
+    // CFEC  CMP #$5C
+    RecompiledBegin(ctx, 0xCFEC); Compare(cpu, cpu.A, 0x5C); cpu.totalCycles += 2;
+    // CFEE  BNE $D000
+    RecompiledBegin(ctx, 0xCFEE); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 2; cpu.PC = 0xD000; return; }
+    // CFF0  LDX #$00
+    RecompiledBegin(ctx, 0xCFF0); cpu.X = 0x00; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // CFF2  LDA ($FF,X)
+    { RecompiledBegin(ctx, 0xCFF2); const byte pointer = static_cast<byte>(0xFF + cpu.X); const memAddress ea = RecompiledWord(bus.read(pointer), bus.read(static_cast<byte>(pointer + 1))); cpu.A = bus.read(ea); SetNZ(cpu, cpu.A); cpu.totalCycles += 6; }
+    // CFF4  CMP #$5D
+    RecompiledBegin(ctx, 0xCFF4); Compare(cpu, cpu.A, 0x5D); cpu.totalCycles += 2;
+    // CFF6  BNE $D000
+    RecompiledBegin(ctx, 0xCFF6); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 2; cpu.PC = 0xD000; return; }
+    // CFF8  LDX #$81
+    RecompiledBegin(ctx, 0xCFF8); cpu.X = 0x81; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // CFFA  LDA ($FF,X)
+    { RecompiledBegin(ctx, 0xCFFA); const byte pointer = static_cast<byte>(0xFF + cpu.X); const memAddress ea = RecompiledWord(bus.read(pointer), bus.read(static_cast<byte>(pointer + 1))); cpu.A = bus.read(ea); SetNZ(cpu, cpu.A); cpu.totalCycles += 6; }
+    // CFFC  CMP #$5A
+    RecompiledBegin(ctx, 0xCFFC); Compare(cpu, cpu.A, 0x5A); cpu.totalCycles += 2;
+    // CFFE  BEQ $D005
+    RecompiledBegin(ctx, 0xCFFE); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xD005; return; }
+    cpu.PC = 0xD000;
+}
+
+static void Block_D000(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D000  LDA #$58
+    RecompiledBegin(ctx, 0xD000); cpu.A = 0x58; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D002  STA $07FF
+    RecompiledBegin(ctx, 0xD002); bus.write(0x07FF, cpu.A); cpu.totalCycles += 4;
+    cpu.PC = 0xD005;
+}
+
+static void Block_D005(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D005  LDA #$AA
+    RecompiledBegin(ctx, 0xD005); cpu.A = 0xAA; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D007  LDX #$00
+    RecompiledBegin(ctx, 0xD007); cpu.X = 0x00; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // D009  STA ($80,X)
+    { RecompiledBegin(ctx, 0xD009); const byte pointer = static_cast<byte>(0x80 + cpu.X); const memAddress ea = RecompiledWord(bus.read(pointer), bus.read(static_cast<byte>(pointer + 1))); bus.write(ea, cpu.A); cpu.totalCycles += 6; if (ctx.bus.codeWritten) { cpu.PC = 0xD00B; return; } }
+    // D00B  INX
+    RecompiledBegin(ctx, 0xD00B); cpu.X++; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // D00C  INX
+    RecompiledBegin(ctx, 0xD00C); cpu.X++; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // D00D  LDA #$AB
+    RecompiledBegin(ctx, 0xD00D); cpu.A = 0xAB; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D00F  STA ($80,X)
+    { RecompiledBegin(ctx, 0xD00F); const byte pointer = static_cast<byte>(0x80 + cpu.X); const memAddress ea = RecompiledWord(bus.read(pointer), bus.read(static_cast<byte>(pointer + 1))); bus.write(ea, cpu.A); cpu.totalCycles += 6; if (ctx.bus.codeWritten) { cpu.PC = 0xD011; return; } }
+    // D011  INX
+    RecompiledBegin(ctx, 0xD011); cpu.X++; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // D012  LDA #$AC
+    RecompiledBegin(ctx, 0xD012); cpu.A = 0xAC; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D014  STA ($80,X)
+    { RecompiledBegin(ctx, 0xD014); const byte pointer = static_cast<byte>(0x80 + cpu.X); const memAddress ea = RecompiledWord(bus.read(pointer), bus.read(static_cast<byte>(pointer + 1))); bus.write(ea, cpu.A); cpu.totalCycles += 6; if (ctx.bus.codeWritten) { cpu.PC = 0xD016; return; } }
+    // D016  LDX #$00
+    RecompiledBegin(ctx, 0xD016); cpu.X = 0x00; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // D018  LDA #$AD
+    RecompiledBegin(ctx, 0xD018); cpu.A = 0xAD; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D01A  STA ($FF,X)
+    { RecompiledBegin(ctx, 0xD01A); const byte pointer = static_cast<byte>(0xFF + cpu.X); const memAddress ea = RecompiledWord(bus.read(pointer), bus.read(static_cast<byte>(pointer + 1))); bus.write(ea, cpu.A); cpu.totalCycles += 6; if (ctx.bus.codeWritten) { cpu.PC = 0xD01C; return; } }
+    // D01C  LDA $0200
+    RecompiledBegin(ctx, 0xD01C); cpu.A = bus.read(0x0200); SetNZ(cpu, cpu.A); cpu.totalCycles += 4;
+    // D01F  CMP #$AA
+    RecompiledBegin(ctx, 0xD01F); Compare(cpu, cpu.A, 0xAA); cpu.totalCycles += 2;
+    // D021  BNE $D038
+    RecompiledBegin(ctx, 0xD021); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xD038; return; }
+    // D023  LDA $0300
+    RecompiledBegin(ctx, 0xD023); cpu.A = bus.read(0x0300); SetNZ(cpu, cpu.A); cpu.totalCycles += 4;
+    // D026  CMP #$AB
+    RecompiledBegin(ctx, 0xD026); Compare(cpu, cpu.A, 0xAB); cpu.totalCycles += 2;
+    // D028  BNE $D038
+    RecompiledBegin(ctx, 0xD028); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xD038; return; }
+    // D02A  LDA $0303
+    RecompiledBegin(ctx, 0xD02A); cpu.A = bus.read(0x0303); SetNZ(cpu, cpu.A); cpu.totalCycles += 4;
+    // D02D  CMP #$AC
+    RecompiledBegin(ctx, 0xD02D); Compare(cpu, cpu.A, 0xAC); cpu.totalCycles += 2;
+    // D02F  BNE $D038
+    RecompiledBegin(ctx, 0xD02F); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xD038; return; }
+    // D031  LDA $0400
+    RecompiledBegin(ctx, 0xD031); cpu.A = bus.read(0x0400); SetNZ(cpu, cpu.A); cpu.totalCycles += 4;
+    // D034  CMP #$AD
+    RecompiledBegin(ctx, 0xD034); Compare(cpu, cpu.A, 0xAD); cpu.totalCycles += 2;
+    // D036  BEQ $D03D
+    RecompiledBegin(ctx, 0xD036); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xD03D; return; }
+    cpu.PC = 0xD038;
+}
+
+static void Block_D038(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D038  LDA #$59
+    RecompiledBegin(ctx, 0xD038); cpu.A = 0x59; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D03A  STA $07FF
+    RecompiledBegin(ctx, 0xD03A); bus.write(0x07FF, cpu.A); cpu.totalCycles += 4;
+    cpu.PC = 0xD03D;
+}
+
+static void Block_D03D(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D03D  LDA $07FF
+    RecompiledBegin(ctx, 0xD03D); cpu.A = bus.read(0x07FF); SetNZ(cpu, cpu.A); cpu.totalCycles += 4;
+    // D040  STA $00
+    RecompiledBegin(ctx, 0xD040); bus.write(0x0000, cpu.A); cpu.totalCycles += 3;
+    // D042  LDA #$00
+    RecompiledBegin(ctx, 0xD042); cpu.A = 0x00; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D044  STA $0300
+    RecompiledBegin(ctx, 0xD044); bus.write(0x0300, cpu.A); cpu.totalCycles += 4;
+    // D047  LDA #$AA
+    RecompiledBegin(ctx, 0xD047); cpu.A = 0xAA; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D049  STA $0200
+    RecompiledBegin(ctx, 0xD049); bus.write(0x0200, cpu.A); cpu.totalCycles += 4;
+    // D04C  LDX #$00
+    RecompiledBegin(ctx, 0xD04C); cpu.X = 0x00; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // D04E  LDY #$5A
+    RecompiledBegin(ctx, 0xD04E); cpu.Y = 0x5A; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // D050  JSR $F7B6
+    RecompiledBegin(ctx, 0xD050); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD0); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x52); cpu.totalCycles += 6; cpu.PC = 0xF7B6; return;
+}
+
+static void Block_D053(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D053  ORA ($80,X)
+    { RecompiledBegin(ctx, 0xD053); const byte pointer = static_cast<byte>(0x80 + cpu.X); const memAddress ea = RecompiledWord(bus.read(pointer), bus.read(static_cast<byte>(pointer + 1))); cpu.A = static_cast<byte>(cpu.A | bus.read(ea)); SetNZ(cpu, cpu.A); cpu.totalCycles += 6; }
+    // D055  JSR $F7C0
+    RecompiledBegin(ctx, 0xD055); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD0); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x57); cpu.totalCycles += 6; cpu.PC = 0xF7C0; return;
+}
+
+static void Block_D058(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D058  INY
+    RecompiledBegin(ctx, 0xD058); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // D059  JSR $F7CE
+    RecompiledBegin(ctx, 0xD059); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD0); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x5B); cpu.totalCycles += 6; cpu.PC = 0xF7CE; return;
+}
+
+static void Block_D05C(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D05C  ORA ($82,X)
+    { RecompiledBegin(ctx, 0xD05C); const byte pointer = static_cast<byte>(0x82 + cpu.X); const memAddress ea = RecompiledWord(bus.read(pointer), bus.read(static_cast<byte>(pointer + 1))); cpu.A = static_cast<byte>(cpu.A | bus.read(ea)); SetNZ(cpu, cpu.A); cpu.totalCycles += 6; }
+    // D05E  JSR $F7D3
+    RecompiledBegin(ctx, 0xD05E); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD0); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x60); cpu.totalCycles += 6; cpu.PC = 0xF7D3; return;
+}
+
+static void Block_D061(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D061  INY
+    RecompiledBegin(ctx, 0xD061); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // D062  JSR $F7DF
+    RecompiledBegin(ctx, 0xD062); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD0); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x64); cpu.totalCycles += 6; cpu.PC = 0xF7DF; return;
+}
+
+static void Block_D065(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D065  AND ($80,X)
+    { RecompiledBegin(ctx, 0xD065); const byte pointer = static_cast<byte>(0x80 + cpu.X); const memAddress ea = RecompiledWord(bus.read(pointer), bus.read(static_cast<byte>(pointer + 1))); cpu.A = static_cast<byte>(cpu.A & bus.read(ea)); SetNZ(cpu, cpu.A); cpu.totalCycles += 6; }
+    // D067  JSR $F7E5
+    RecompiledBegin(ctx, 0xD067); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD0); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x69); cpu.totalCycles += 6; cpu.PC = 0xF7E5; return;
+}
+
+static void Block_D06A(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D06A  INY
+    RecompiledBegin(ctx, 0xD06A); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // D06B  LDA #$EF
+    RecompiledBegin(ctx, 0xD06B); cpu.A = 0xEF; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D06D  STA $0300
+    RecompiledBegin(ctx, 0xD06D); bus.write(0x0300, cpu.A); cpu.totalCycles += 4;
+    // D070  JSR $F7F1
+    RecompiledBegin(ctx, 0xD070); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD0); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x72); cpu.totalCycles += 6; cpu.PC = 0xF7F1; return;
+}
+
+static void Block_D073(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D073  AND ($82,X)
+    { RecompiledBegin(ctx, 0xD073); const byte pointer = static_cast<byte>(0x82 + cpu.X); const memAddress ea = RecompiledWord(bus.read(pointer), bus.read(static_cast<byte>(pointer + 1))); cpu.A = static_cast<byte>(cpu.A & bus.read(ea)); SetNZ(cpu, cpu.A); cpu.totalCycles += 6; }
+    // D075  JSR $F7F6
+    RecompiledBegin(ctx, 0xD075); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD0); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x77); cpu.totalCycles += 6; cpu.PC = 0xF7F6; return;
+}
+
+static void Block_D078(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D078  INY
+    RecompiledBegin(ctx, 0xD078); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // D079  JSR $F804
+    RecompiledBegin(ctx, 0xD079); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD0); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x7B); cpu.totalCycles += 6; cpu.PC = 0xF804; return;
+}
+
+static void Block_D07C(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D07C  EOR ($80,X)
+    { RecompiledBegin(ctx, 0xD07C); const byte pointer = static_cast<byte>(0x80 + cpu.X); const memAddress ea = RecompiledWord(bus.read(pointer), bus.read(static_cast<byte>(pointer + 1))); cpu.A = static_cast<byte>(cpu.A ^ bus.read(ea)); SetNZ(cpu, cpu.A); cpu.totalCycles += 6; }
+    // D07E  JSR $F80A
+    RecompiledBegin(ctx, 0xD07E); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD0); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x80); cpu.totalCycles += 6; cpu.PC = 0xF80A; return;
+}
+
+static void Block_D081(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D081  INY
+    RecompiledBegin(ctx, 0xD081); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // D082  LDA #$70
+    RecompiledBegin(ctx, 0xD082); cpu.A = 0x70; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D084  STA $0300
+    RecompiledBegin(ctx, 0xD084); bus.write(0x0300, cpu.A); cpu.totalCycles += 4;
+    // D087  JSR $F818
+    RecompiledBegin(ctx, 0xD087); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD0); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x89); cpu.totalCycles += 6; cpu.PC = 0xF818; return;
+}
+
+static void Block_D08A(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D08A  EOR ($82,X)
+    { RecompiledBegin(ctx, 0xD08A); const byte pointer = static_cast<byte>(0x82 + cpu.X); const memAddress ea = RecompiledWord(bus.read(pointer), bus.read(static_cast<byte>(pointer + 1))); cpu.A = static_cast<byte>(cpu.A ^ bus.read(ea)); SetNZ(cpu, cpu.A); cpu.totalCycles += 6; }
+    // D08C  JSR $F81D
+    RecompiledBegin(ctx, 0xD08C); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD0); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x8E); cpu.totalCycles += 6; cpu.PC = 0xF81D; return;
+}
+
+static void Block_D08F(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D08F  INY
+    RecompiledBegin(ctx, 0xD08F); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // D090  LDA #$69
+    RecompiledBegin(ctx, 0xD090); cpu.A = 0x69; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D092  STA $0200
+    RecompiledBegin(ctx, 0xD092); bus.write(0x0200, cpu.A); cpu.totalCycles += 4;
+    // D095  JSR $F829
+    RecompiledBegin(ctx, 0xD095); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD0); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x97); cpu.totalCycles += 6; cpu.PC = 0xF829; return;
+}
+
+static void Block_D098(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D098  ADC ($80,X)
+    { RecompiledBegin(ctx, 0xD098); const byte pointer = static_cast<byte>(0x80 + cpu.X); const memAddress ea = RecompiledWord(bus.read(pointer), bus.read(static_cast<byte>(pointer + 1))); AddBinary(cpu, bus.read(ea)); cpu.totalCycles += 6; }
+    // D09A  JSR $F82F
+    RecompiledBegin(ctx, 0xD09A); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD0); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x9C); cpu.totalCycles += 6; cpu.PC = 0xF82F; return;
+}
+
+static void Block_D09D(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D09D  INY
+    RecompiledBegin(ctx, 0xD09D); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // D09E  JSR $F83D
+    RecompiledBegin(ctx, 0xD09E); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD0); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xA0); cpu.totalCycles += 6; cpu.PC = 0xF83D; return;
+}
+
+static void Block_D0A1(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D0A1  ADC ($80,X)
+    { RecompiledBegin(ctx, 0xD0A1); const byte pointer = static_cast<byte>(0x80 + cpu.X); const memAddress ea = RecompiledWord(bus.read(pointer), bus.read(static_cast<byte>(pointer + 1))); AddBinary(cpu, bus.read(ea)); cpu.totalCycles += 6; }
+    // D0A3  JSR $F843
+    RecompiledBegin(ctx, 0xD0A3); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD0); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xA5); cpu.totalCycles += 6; cpu.PC = 0xF843; return;
+}
+
+static void Block_D0A6(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D0A6  INY
+    RecompiledBegin(ctx, 0xD0A6); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // D0A7  LDA #$7F
+    RecompiledBegin(ctx, 0xD0A7); cpu.A = 0x7F; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D0A9  STA $0200
+    RecompiledBegin(ctx, 0xD0A9); bus.write(0x0200, cpu.A); cpu.totalCycles += 4;
+    // D0AC  JSR $F851
+    RecompiledBegin(ctx, 0xD0AC); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD0); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xAE); cpu.totalCycles += 6; cpu.PC = 0xF851; return;
+}
+
+static void Block_D0AF(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D0AF  ADC ($80,X)
+    { RecompiledBegin(ctx, 0xD0AF); const byte pointer = static_cast<byte>(0x80 + cpu.X); const memAddress ea = RecompiledWord(bus.read(pointer), bus.read(static_cast<byte>(pointer + 1))); AddBinary(cpu, bus.read(ea)); cpu.totalCycles += 6; }
+    // D0B1  JSR $F856
+    RecompiledBegin(ctx, 0xD0B1); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD0); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xB3); cpu.totalCycles += 6; cpu.PC = 0xF856; return;
+}
+
+static void Block_D0B4(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D0B4  INY
+    RecompiledBegin(ctx, 0xD0B4); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // D0B5  LDA #$80
+    RecompiledBegin(ctx, 0xD0B5); cpu.A = 0x80; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D0B7  STA $0200
+    RecompiledBegin(ctx, 0xD0B7); bus.write(0x0200, cpu.A); cpu.totalCycles += 4;
+    // D0BA  JSR $F864
+    RecompiledBegin(ctx, 0xD0BA); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD0); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xBC); cpu.totalCycles += 6; cpu.PC = 0xF864; return;
+}
+
+static void Block_D0BD(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D0BD  ADC ($80,X)
+    { RecompiledBegin(ctx, 0xD0BD); const byte pointer = static_cast<byte>(0x80 + cpu.X); const memAddress ea = RecompiledWord(bus.read(pointer), bus.read(static_cast<byte>(pointer + 1))); AddBinary(cpu, bus.read(ea)); cpu.totalCycles += 6; }
+    // D0BF  JSR $F86A
+    RecompiledBegin(ctx, 0xD0BF); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD0); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xC1); cpu.totalCycles += 6; cpu.PC = 0xF86A; return;
+}
+
+static void Block_D0C2(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D0C2  INY
+    RecompiledBegin(ctx, 0xD0C2); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // D0C3  JSR $F878
+    RecompiledBegin(ctx, 0xD0C3); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD0); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xC5); cpu.totalCycles += 6; cpu.PC = 0xF878; return;
+}
+
+static void Block_D0C6(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D0C6  ADC ($80,X)
+    { RecompiledBegin(ctx, 0xD0C6); const byte pointer = static_cast<byte>(0x80 + cpu.X); const memAddress ea = RecompiledWord(bus.read(pointer), bus.read(static_cast<byte>(pointer + 1))); AddBinary(cpu, bus.read(ea)); cpu.totalCycles += 6; }
+    // D0C8  JSR $F87D
+    RecompiledBegin(ctx, 0xD0C8); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD0); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xCA); cpu.totalCycles += 6; cpu.PC = 0xF87D; return;
+}
+
+static void Block_D0CB(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D0CB  INY
+    RecompiledBegin(ctx, 0xD0CB); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // D0CC  LDA #$40
+    RecompiledBegin(ctx, 0xD0CC); cpu.A = 0x40; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D0CE  STA $0200
+    RecompiledBegin(ctx, 0xD0CE); bus.write(0x0200, cpu.A); cpu.totalCycles += 4;
+    // D0D1  JSR $F889
+    RecompiledBegin(ctx, 0xD0D1); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD0); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD3); cpu.totalCycles += 6; cpu.PC = 0xF889; return;
+}
+
+static void Block_D0D4(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D0D4  CMP ($80,X)
+    { RecompiledBegin(ctx, 0xD0D4); const byte pointer = static_cast<byte>(0x80 + cpu.X); const memAddress ea = RecompiledWord(bus.read(pointer), bus.read(static_cast<byte>(pointer + 1))); Compare(cpu, cpu.A, bus.read(ea)); cpu.totalCycles += 6; }
+    // D0D6  JSR $F88E
+    RecompiledBegin(ctx, 0xD0D6); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD0); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD8); cpu.totalCycles += 6; cpu.PC = 0xF88E; return;
+}
+
+static void Block_D0D9(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D0D9  INY
+    RecompiledBegin(ctx, 0xD0D9); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // D0DA  PHA
+    RecompiledBegin(ctx, 0xD0DA); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), cpu.A); cpu.totalCycles += 3;
+    // D0DB  LDA #$3F
+    RecompiledBegin(ctx, 0xD0DB); cpu.A = 0x3F; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D0DD  STA $0200
+    RecompiledBegin(ctx, 0xD0DD); bus.write(0x0200, cpu.A); cpu.totalCycles += 4;
+    // D0E0  PLA
+    RecompiledBegin(ctx, 0xD0E0); cpu.SP++; cpu.A = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); SetNZ(cpu, cpu.A); cpu.totalCycles += 4;
+    // D0E1  JSR $F89A
+    RecompiledBegin(ctx, 0xD0E1); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD0); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xE3); cpu.totalCycles += 6; cpu.PC = 0xF89A; return;
+}
+
+static void Block_D0E4(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D0E4  CMP ($80,X)
+    { RecompiledBegin(ctx, 0xD0E4); const byte pointer = static_cast<byte>(0x80 + cpu.X); const memAddress ea = RecompiledWord(bus.read(pointer), bus.read(static_cast<byte>(pointer + 1))); Compare(cpu, cpu.A, bus.read(ea)); cpu.totalCycles += 6; }
+    // D0E6  JSR $F89C
+    RecompiledBegin(ctx, 0xD0E6); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD0); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xE8); cpu.totalCycles += 6; cpu.PC = 0xF89C; return;
+}
+
+static void Block_D0E9(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D0E9  INY
+    RecompiledBegin(ctx, 0xD0E9); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // D0EA  PHA
+    RecompiledBegin(ctx, 0xD0EA); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), cpu.A); cpu.totalCycles += 3;
+    // D0EB  LDA #$41
+    RecompiledBegin(ctx, 0xD0EB); cpu.A = 0x41; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D0ED  STA $0200
+    RecompiledBegin(ctx, 0xD0ED); bus.write(0x0200, cpu.A); cpu.totalCycles += 4;
+    // D0F0  PLA
+    RecompiledBegin(ctx, 0xD0F0); cpu.SP++; cpu.A = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); SetNZ(cpu, cpu.A); cpu.totalCycles += 4;
+    // D0F1  CMP ($80,X)
+    { RecompiledBegin(ctx, 0xD0F1); const byte pointer = static_cast<byte>(0x80 + cpu.X); const memAddress ea = RecompiledWord(bus.read(pointer), bus.read(static_cast<byte>(pointer + 1))); Compare(cpu, cpu.A, bus.read(ea)); cpu.totalCycles += 6; }
+    // D0F3  JSR $F8A8
+    RecompiledBegin(ctx, 0xD0F3); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD0); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xF5); cpu.totalCycles += 6; cpu.PC = 0xF8A8; return;
+}
+
+static void Block_D0F6(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D0F6  INY
+    RecompiledBegin(ctx, 0xD0F6); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // D0F7  PHA
+    RecompiledBegin(ctx, 0xD0F7); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), cpu.A); cpu.totalCycles += 3;
+    // D0F8  LDA #$00
+    RecompiledBegin(ctx, 0xD0F8); cpu.A = 0x00; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D0FA  STA $0200
+    RecompiledBegin(ctx, 0xD0FA); bus.write(0x0200, cpu.A); cpu.totalCycles += 4;
+    // D0FD  PLA
+    RecompiledBegin(ctx, 0xD0FD); cpu.SP++; cpu.A = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); SetNZ(cpu, cpu.A); cpu.totalCycles += 4;
+    // D0FE  JSR $F8B2
+    RecompiledBegin(ctx, 0xD0FE); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD1); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x00); cpu.totalCycles += 6; cpu.PC = 0xF8B2; return;
+}
+
+static void Block_D101(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D101  CMP ($80,X)
+    { RecompiledBegin(ctx, 0xD101); const byte pointer = static_cast<byte>(0x80 + cpu.X); const memAddress ea = RecompiledWord(bus.read(pointer), bus.read(static_cast<byte>(pointer + 1))); Compare(cpu, cpu.A, bus.read(ea)); cpu.totalCycles += 6; }
+    // D103  JSR $F8B5
+    RecompiledBegin(ctx, 0xD103); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD1); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x05); cpu.totalCycles += 6; cpu.PC = 0xF8B5; return;
+}
+
+static void Block_D106(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D106  INY
+    RecompiledBegin(ctx, 0xD106); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // D107  PHA
+    RecompiledBegin(ctx, 0xD107); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), cpu.A); cpu.totalCycles += 3;
+    // D108  LDA #$80
+    RecompiledBegin(ctx, 0xD108); cpu.A = 0x80; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D10A  STA $0200
+    RecompiledBegin(ctx, 0xD10A); bus.write(0x0200, cpu.A); cpu.totalCycles += 4;
+    // D10D  PLA
+    RecompiledBegin(ctx, 0xD10D); cpu.SP++; cpu.A = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); SetNZ(cpu, cpu.A); cpu.totalCycles += 4;
+    // D10E  CMP ($80,X)
+    { RecompiledBegin(ctx, 0xD10E); const byte pointer = static_cast<byte>(0x80 + cpu.X); const memAddress ea = RecompiledWord(bus.read(pointer), bus.read(static_cast<byte>(pointer + 1))); Compare(cpu, cpu.A, bus.read(ea)); cpu.totalCycles += 6; }
+    // D110  JSR $F8BF
+    RecompiledBegin(ctx, 0xD110); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD1); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x12); cpu.totalCycles += 6; cpu.PC = 0xF8BF; return;
+}
+
+static void Block_D113(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D113  INY
+    RecompiledBegin(ctx, 0xD113); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // D114  PHA
+    RecompiledBegin(ctx, 0xD114); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), cpu.A); cpu.totalCycles += 3;
+    // D115  LDA #$81
+    RecompiledBegin(ctx, 0xD115); cpu.A = 0x81; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D117  STA $0200
+    RecompiledBegin(ctx, 0xD117); bus.write(0x0200, cpu.A); cpu.totalCycles += 4;
+    // D11A  PLA
+    RecompiledBegin(ctx, 0xD11A); cpu.SP++; cpu.A = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); SetNZ(cpu, cpu.A); cpu.totalCycles += 4;
+    // D11B  CMP ($80,X)
+    { RecompiledBegin(ctx, 0xD11B); const byte pointer = static_cast<byte>(0x80 + cpu.X); const memAddress ea = RecompiledWord(bus.read(pointer), bus.read(static_cast<byte>(pointer + 1))); Compare(cpu, cpu.A, bus.read(ea)); cpu.totalCycles += 6; }
+    // D11D  JSR $F8C9
+    RecompiledBegin(ctx, 0xD11D); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD1); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x1F); cpu.totalCycles += 6; cpu.PC = 0xF8C9; return;
+}
+
+static void Block_D120(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D120  INY
+    RecompiledBegin(ctx, 0xD120); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // D121  PHA
+    RecompiledBegin(ctx, 0xD121); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), cpu.A); cpu.totalCycles += 3;
+    // D122  LDA #$7F
+    RecompiledBegin(ctx, 0xD122); cpu.A = 0x7F; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D124  STA $0200
+    RecompiledBegin(ctx, 0xD124); bus.write(0x0200, cpu.A); cpu.totalCycles += 4;
+    // D127  PLA
+    RecompiledBegin(ctx, 0xD127); cpu.SP++; cpu.A = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); SetNZ(cpu, cpu.A); cpu.totalCycles += 4;
+    // D128  CMP ($80,X)
+    { RecompiledBegin(ctx, 0xD128); const byte pointer = static_cast<byte>(0x80 + cpu.X); const memAddress ea = RecompiledWord(bus.read(pointer), bus.read(static_cast<byte>(pointer + 1))); Compare(cpu, cpu.A, bus.read(ea)); cpu.totalCycles += 6; }
+    // D12A  JSR $F8D3
+    RecompiledBegin(ctx, 0xD12A); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD1); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x2C); cpu.totalCycles += 6; cpu.PC = 0xF8D3; return;
+}
+
+static void Block_D12D(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D12D  INY
+    RecompiledBegin(ctx, 0xD12D); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // D12E  LDA #$40
+    RecompiledBegin(ctx, 0xD12E); cpu.A = 0x40; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D130  STA $0200
+    RecompiledBegin(ctx, 0xD130); bus.write(0x0200, cpu.A); cpu.totalCycles += 4;
+    // D133  JSR $F931
+    RecompiledBegin(ctx, 0xD133); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD1); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x35); cpu.totalCycles += 6; cpu.PC = 0xF931; return;
+}
+
+static void Block_D136(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D136  SBC ($80,X)
+    { RecompiledBegin(ctx, 0xD136); const byte pointer = static_cast<byte>(0x80 + cpu.X); const memAddress ea = RecompiledWord(bus.read(pointer), bus.read(static_cast<byte>(pointer + 1))); SubtractBinary(cpu, bus.read(ea)); cpu.totalCycles += 6; }
+    // D138  JSR $F937
+    RecompiledBegin(ctx, 0xD138); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD1); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x3A); cpu.totalCycles += 6; cpu.PC = 0xF937; return;
+}
+
+static void Block_D13B(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D13B  INY
+    RecompiledBegin(ctx, 0xD13B); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // D13C  LDA #$3F
+    RecompiledBegin(ctx, 0xD13C); cpu.A = 0x3F; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D13E  STA $0200
+    RecompiledBegin(ctx, 0xD13E); bus.write(0x0200, cpu.A); cpu.totalCycles += 4;
+    // D141  JSR $F947
+    RecompiledBegin(ctx, 0xD141); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD1); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x43); cpu.totalCycles += 6; cpu.PC = 0xF947; return;
+}
+
+static void Block_D144(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D144  SBC ($80,X)
+    { RecompiledBegin(ctx, 0xD144); const byte pointer = static_cast<byte>(0x80 + cpu.X); const memAddress ea = RecompiledWord(bus.read(pointer), bus.read(static_cast<byte>(pointer + 1))); SubtractBinary(cpu, bus.read(ea)); cpu.totalCycles += 6; }
+    // D146  JSR $F94C
+    RecompiledBegin(ctx, 0xD146); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD1); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x48); cpu.totalCycles += 6; cpu.PC = 0xF94C; return;
+}
+
+static void Block_D149(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D149  INY
+    RecompiledBegin(ctx, 0xD149); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // D14A  LDA #$41
+    RecompiledBegin(ctx, 0xD14A); cpu.A = 0x41; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D14C  STA $0200
+    RecompiledBegin(ctx, 0xD14C); bus.write(0x0200, cpu.A); cpu.totalCycles += 4;
+    // D14F  JSR $F95C
+    RecompiledBegin(ctx, 0xD14F); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD1); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x51); cpu.totalCycles += 6; cpu.PC = 0xF95C; return;
+}
+
+static void Block_D152(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D152  SBC ($80,X)
+    { RecompiledBegin(ctx, 0xD152); const byte pointer = static_cast<byte>(0x80 + cpu.X); const memAddress ea = RecompiledWord(bus.read(pointer), bus.read(static_cast<byte>(pointer + 1))); SubtractBinary(cpu, bus.read(ea)); cpu.totalCycles += 6; }
+    // D154  JSR $F962
+    RecompiledBegin(ctx, 0xD154); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD1); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x56); cpu.totalCycles += 6; cpu.PC = 0xF962; return;
+}
+
+static void Block_D157(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D157  INY
+    RecompiledBegin(ctx, 0xD157); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // D158  LDA #$00
+    RecompiledBegin(ctx, 0xD158); cpu.A = 0x00; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D15A  STA $0200
+    RecompiledBegin(ctx, 0xD15A); bus.write(0x0200, cpu.A); cpu.totalCycles += 4;
+    // D15D  JSR $F972
+    RecompiledBegin(ctx, 0xD15D); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD1); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x5F); cpu.totalCycles += 6; cpu.PC = 0xF972; return;
+}
+
+static void Block_D160(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D160  SBC ($80,X)
+    { RecompiledBegin(ctx, 0xD160); const byte pointer = static_cast<byte>(0x80 + cpu.X); const memAddress ea = RecompiledWord(bus.read(pointer), bus.read(static_cast<byte>(pointer + 1))); SubtractBinary(cpu, bus.read(ea)); cpu.totalCycles += 6; }
+    // D162  JSR $F976
+    RecompiledBegin(ctx, 0xD162); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD1); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x64); cpu.totalCycles += 6; cpu.PC = 0xF976; return;
+}
+
+static void Block_D165(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D165  INY
+    RecompiledBegin(ctx, 0xD165); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // D166  LDA #$7F
+    RecompiledBegin(ctx, 0xD166); cpu.A = 0x7F; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D168  STA $0200
+    RecompiledBegin(ctx, 0xD168); bus.write(0x0200, cpu.A); cpu.totalCycles += 4;
+    // D16B  JSR $F980
+    RecompiledBegin(ctx, 0xD16B); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD1); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x6D); cpu.totalCycles += 6; cpu.PC = 0xF980; return;
+}
+
+static void Block_D16E(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D16E  SBC ($80,X)
+    { RecompiledBegin(ctx, 0xD16E); const byte pointer = static_cast<byte>(0x80 + cpu.X); const memAddress ea = RecompiledWord(bus.read(pointer), bus.read(static_cast<byte>(pointer + 1))); SubtractBinary(cpu, bus.read(ea)); cpu.totalCycles += 6; }
+    // D170  JSR $F984
+    RecompiledBegin(ctx, 0xD170); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD1); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x72); cpu.totalCycles += 6; cpu.PC = 0xF984; return;
+}
+
+static void Block_D173(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D173  RTS
+    { RecompiledBegin(ctx, 0xD173); cpu.SP++; const byte low = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); const byte high = bus.read(static_cast<memAddress>(0x0100 + cpu.SP + 1)); cpu.SP++; cpu.totalCycles += 6; cpu.PC = static_cast<memAddress>(RecompiledWord(low, high) + 1); return; }
+}
+
+static void Block_D174(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D174  LDA #$55
+    RecompiledBegin(ctx, 0xD174); cpu.A = 0x55; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D176  STA $78
+    RecompiledBegin(ctx, 0xD176); bus.write(0x0078, cpu.A); cpu.totalCycles += 3;
+    // D178  LDA #$FF
+    RecompiledBegin(ctx, 0xD178); cpu.A = 0xFF; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D17A  STA $01
+    RecompiledBegin(ctx, 0xD17A); bus.write(0x0001, cpu.A); cpu.totalCycles += 3;
+    // D17C  BIT $01
+    RecompiledBegin(ctx, 0xD17C); BitTest(cpu, bus.read(0x0001)); cpu.totalCycles += 3;
+    // D17E  LDY #$11
+    RecompiledBegin(ctx, 0xD17E); cpu.Y = 0x11; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // D180  LDX #$23
+    RecompiledBegin(ctx, 0xD180); cpu.X = 0x23; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // D182  LDA #$00
+    RecompiledBegin(ctx, 0xD182); cpu.A = 0x00; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D184  LDA $78
+    RecompiledBegin(ctx, 0xD184); cpu.A = bus.read(0x0078); SetNZ(cpu, cpu.A); cpu.totalCycles += 3;
+    // D186  BEQ $D198
+    RecompiledBegin(ctx, 0xD186); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xD198; return; }
+    // D188  BMI $D198
+    RecompiledBegin(ctx, 0xD188); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xD198; return; }
+    // D18A  CMP #$55
+    RecompiledBegin(ctx, 0xD18A); Compare(cpu, cpu.A, 0x55); cpu.totalCycles += 2;
+    // D18C  BNE $D198
+    RecompiledBegin(ctx, 0xD18C); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xD198; return; }
+    // D18E  CPY #$11
+    RecompiledBegin(ctx, 0xD18E); Compare(cpu, cpu.Y, 0x11); cpu.totalCycles += 2;
+    // D190  BNE $D198
+    RecompiledBegin(ctx, 0xD190); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xD198; return; }
+    // D192  CPX #$23
+    RecompiledBegin(ctx, 0xD192); Compare(cpu, cpu.X, 0x23); cpu.totalCycles += 2;
+    // D194  BVC $D198
+    RecompiledBegin(ctx, 0xD194); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xD198; return; }
+    // D196  BEQ $D19C
+    RecompiledBegin(ctx, 0xD196); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xD19C; return; }
+    cpu.PC = 0xD198;
+}
+
+static void Block_D198(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D198  LDA #$76
+    RecompiledBegin(ctx, 0xD198); cpu.A = 0x76; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D19A  STA $00
+    RecompiledBegin(ctx, 0xD19A); bus.write(0x0000, cpu.A); cpu.totalCycles += 3;
+    cpu.PC = 0xD19C;
+}
+
+static void Block_D19C(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D19C  LDA #$46
+    RecompiledBegin(ctx, 0xD19C); cpu.A = 0x46; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D19E  BIT $01
+    RecompiledBegin(ctx, 0xD19E); BitTest(cpu, bus.read(0x0001)); cpu.totalCycles += 3;
+    // D1A0  STA $78
+    RecompiledBegin(ctx, 0xD1A0); bus.write(0x0078, cpu.A); cpu.totalCycles += 3;
+    // D1A2  BEQ $D1AE
+    RecompiledBegin(ctx, 0xD1A2); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xD1AE; return; }
+    // D1A4  BPL $D1AE
+    RecompiledBegin(ctx, 0xD1A4); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xD1AE; return; }
+    // D1A6  BVC $D1AE
+    RecompiledBegin(ctx, 0xD1A6); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xD1AE; return; }
+    // D1A8  LDA $78
+    RecompiledBegin(ctx, 0xD1A8); cpu.A = bus.read(0x0078); SetNZ(cpu, cpu.A); cpu.totalCycles += 3;
+    // D1AA  CMP #$46
+    RecompiledBegin(ctx, 0xD1AA); Compare(cpu, cpu.A, 0x46); cpu.totalCycles += 2;
+    // D1AC  BEQ $D1B2
+    RecompiledBegin(ctx, 0xD1AC); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xD1B2; return; }
+    cpu.PC = 0xD1AE;
+}
+
+static void Block_D1AE(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D1AE  LDA #$77
+    RecompiledBegin(ctx, 0xD1AE); cpu.A = 0x77; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D1B0  STA $00
+    RecompiledBegin(ctx, 0xD1B0); bus.write(0x0000, cpu.A); cpu.totalCycles += 3;
+    cpu.PC = 0xD1B2;
+}
+
+static void Block_D1B2(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D1B2  LDA #$55
+    RecompiledBegin(ctx, 0xD1B2); cpu.A = 0x55; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D1B4  STA $78
+    RecompiledBegin(ctx, 0xD1B4); bus.write(0x0078, cpu.A); cpu.totalCycles += 3;
+    // D1B6  BIT $01
+    RecompiledBegin(ctx, 0xD1B6); BitTest(cpu, bus.read(0x0001)); cpu.totalCycles += 3;
+    // D1B8  LDA #$11
+    RecompiledBegin(ctx, 0xD1B8); cpu.A = 0x11; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D1BA  LDX #$23
+    RecompiledBegin(ctx, 0xD1BA); cpu.X = 0x23; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // D1BC  LDY #$00
+    RecompiledBegin(ctx, 0xD1BC); cpu.Y = 0x00; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // D1BE  LDY $78
+    RecompiledBegin(ctx, 0xD1BE); cpu.Y = bus.read(0x0078); SetNZ(cpu, cpu.Y); cpu.totalCycles += 3;
+    // D1C0  BEQ $D1D2
+    RecompiledBegin(ctx, 0xD1C0); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xD1D2; return; }
+    // D1C2  BMI $D1D2
+    RecompiledBegin(ctx, 0xD1C2); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xD1D2; return; }
+    // D1C4  CPY #$55
+    RecompiledBegin(ctx, 0xD1C4); Compare(cpu, cpu.Y, 0x55); cpu.totalCycles += 2;
+    // D1C6  BNE $D1D2
+    RecompiledBegin(ctx, 0xD1C6); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xD1D2; return; }
+    // D1C8  CMP #$11
+    RecompiledBegin(ctx, 0xD1C8); Compare(cpu, cpu.A, 0x11); cpu.totalCycles += 2;
+    // D1CA  BNE $D1D2
+    RecompiledBegin(ctx, 0xD1CA); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xD1D2; return; }
+    // D1CC  CPX #$23
+    RecompiledBegin(ctx, 0xD1CC); Compare(cpu, cpu.X, 0x23); cpu.totalCycles += 2;
+    // D1CE  BVC $D1D2
+    RecompiledBegin(ctx, 0xD1CE); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xD1D2; return; }
+    // D1D0  BEQ $D1D6
+    RecompiledBegin(ctx, 0xD1D0); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xD1D6; return; }
+    cpu.PC = 0xD1D2;
+}
+
+static void Block_D1D2(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D1D2  LDA #$78
+    RecompiledBegin(ctx, 0xD1D2); cpu.A = 0x78; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D1D4  STA $00
+    RecompiledBegin(ctx, 0xD1D4); bus.write(0x0000, cpu.A); cpu.totalCycles += 3;
+    cpu.PC = 0xD1D6;
+}
+
+static void Block_D1D6(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D1D6  LDY #$46
+    RecompiledBegin(ctx, 0xD1D6); cpu.Y = 0x46; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // D1D8  BIT $01
+    RecompiledBegin(ctx, 0xD1D8); BitTest(cpu, bus.read(0x0001)); cpu.totalCycles += 3;
+    // D1DA  STY $78
+    RecompiledBegin(ctx, 0xD1DA); bus.write(0x0078, cpu.Y); cpu.totalCycles += 3;
+    // D1DC  BEQ $D1E8
+    RecompiledBegin(ctx, 0xD1DC); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xD1E8; return; }
+    // D1DE  BPL $D1E8
+    RecompiledBegin(ctx, 0xD1DE); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xD1E8; return; }
+    // D1E0  BVC $D1E8
+    RecompiledBegin(ctx, 0xD1E0); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xD1E8; return; }
+    // D1E2  LDY $78
+    RecompiledBegin(ctx, 0xD1E2); cpu.Y = bus.read(0x0078); SetNZ(cpu, cpu.Y); cpu.totalCycles += 3;
+    // D1E4  CPY #$46
+    RecompiledBegin(ctx, 0xD1E4); Compare(cpu, cpu.Y, 0x46); cpu.totalCycles += 2;
+    // D1E6  BEQ $D1EC
+    RecompiledBegin(ctx, 0xD1E6); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xD1EC; return; }
+    cpu.PC = 0xD1E8;
+}
+
+static void Block_D1E8(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D1E8  LDA #$79
+    RecompiledBegin(ctx, 0xD1E8); cpu.A = 0x79; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D1EA  STA $00
+    RecompiledBegin(ctx, 0xD1EA); bus.write(0x0000, cpu.A); cpu.totalCycles += 3;
+    cpu.PC = 0xD1EC;
+}
+
+static void Block_D1EC(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D1EC  BIT $01
+    RecompiledBegin(ctx, 0xD1EC); BitTest(cpu, bus.read(0x0001)); cpu.totalCycles += 3;
+    // D1EE  LDA #$55
+    RecompiledBegin(ctx, 0xD1EE); cpu.A = 0x55; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D1F0  STA $78
+    RecompiledBegin(ctx, 0xD1F0); bus.write(0x0078, cpu.A); cpu.totalCycles += 3;
+    // D1F2  LDY #$11
+    RecompiledBegin(ctx, 0xD1F2); cpu.Y = 0x11; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // D1F4  LDA #$23
+    RecompiledBegin(ctx, 0xD1F4); cpu.A = 0x23; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D1F6  LDX #$00
+    RecompiledBegin(ctx, 0xD1F6); cpu.X = 0x00; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // D1F8  LDX $78
+    RecompiledBegin(ctx, 0xD1F8); cpu.X = bus.read(0x0078); SetNZ(cpu, cpu.X); cpu.totalCycles += 3;
+    // D1FA  BEQ $D20C
+    RecompiledBegin(ctx, 0xD1FA); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 2; cpu.PC = 0xD20C; return; }
+    // D1FC  BMI $D20C
+    RecompiledBegin(ctx, 0xD1FC); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::N)) { cpu.totalCycles += 2; cpu.PC = 0xD20C; return; }
+    // D1FE  CPX #$55
+    RecompiledBegin(ctx, 0xD1FE); Compare(cpu, cpu.X, 0x55); cpu.totalCycles += 2;
+    // D200  BNE $D20C
+    RecompiledBegin(ctx, 0xD200); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xD20C; return; }
+    // D202  CPY #$11
+    RecompiledBegin(ctx, 0xD202); Compare(cpu, cpu.Y, 0x11); cpu.totalCycles += 2;
+    // D204  BNE $D20C
+    RecompiledBegin(ctx, 0xD204); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xD20C; return; }
+    // D206  CMP #$23
+    RecompiledBegin(ctx, 0xD206); Compare(cpu, cpu.A, 0x23); cpu.totalCycles += 2;
+    // D208  BVC $D20C
+    RecompiledBegin(ctx, 0xD208); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xD20C; return; }
+    // D20A  BEQ $D210
+    RecompiledBegin(ctx, 0xD20A); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xD210; return; }
+    cpu.PC = 0xD20C;
+}
+
+static void Block_D20C(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D20C  LDA #$7A
+    RecompiledBegin(ctx, 0xD20C); cpu.A = 0x7A; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D20E  STA $00
+    RecompiledBegin(ctx, 0xD20E); bus.write(0x0000, cpu.A); cpu.totalCycles += 3;
+    cpu.PC = 0xD210;
+}
+
+static void Block_D210(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D210  LDX #$46
+    RecompiledBegin(ctx, 0xD210); cpu.X = 0x46; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // D212  BIT $01
+    RecompiledBegin(ctx, 0xD212); BitTest(cpu, bus.read(0x0001)); cpu.totalCycles += 3;
+    // D214  STX $78
+    RecompiledBegin(ctx, 0xD214); bus.write(0x0078, cpu.X); cpu.totalCycles += 3;
+    // D216  BEQ $D222
+    RecompiledBegin(ctx, 0xD216); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xD222; return; }
+    // D218  BPL $D222
+    RecompiledBegin(ctx, 0xD218); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xD222; return; }
+    // D21A  BVC $D222
+    RecompiledBegin(ctx, 0xD21A); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xD222; return; }
+    // D21C  LDX $78
+    RecompiledBegin(ctx, 0xD21C); cpu.X = bus.read(0x0078); SetNZ(cpu, cpu.X); cpu.totalCycles += 3;
+    // D21E  CPX #$46
+    RecompiledBegin(ctx, 0xD21E); Compare(cpu, cpu.X, 0x46); cpu.totalCycles += 2;
+    // D220  BEQ $D226
+    RecompiledBegin(ctx, 0xD220); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xD226; return; }
+    cpu.PC = 0xD222;
+}
+
+static void Block_D222(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D222  LDA #$7B
+    RecompiledBegin(ctx, 0xD222); cpu.A = 0x7B; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D224  STA $00
+    RecompiledBegin(ctx, 0xD224); bus.write(0x0000, cpu.A); cpu.totalCycles += 3;
+    cpu.PC = 0xD226;
+}
+
+static void Block_D226(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D226  LDA #$C0
+    RecompiledBegin(ctx, 0xD226); cpu.A = 0xC0; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D228  STA $78
+    RecompiledBegin(ctx, 0xD228); bus.write(0x0078, cpu.A); cpu.totalCycles += 3;
+    // D22A  LDX #$33
+    RecompiledBegin(ctx, 0xD22A); cpu.X = 0x33; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // D22C  LDY #$88
+    RecompiledBegin(ctx, 0xD22C); cpu.Y = 0x88; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // D22E  LDA #$05
+    RecompiledBegin(ctx, 0xD22E); cpu.A = 0x05; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D230  BIT $78
+    RecompiledBegin(ctx, 0xD230); BitTest(cpu, bus.read(0x0078)); cpu.totalCycles += 3;
+    // D232  BPL $D244
+    RecompiledBegin(ctx, 0xD232); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xD244; return; }
+    // D234  BVC $D244
+    RecompiledBegin(ctx, 0xD234); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xD244; return; }
+    // D236  BNE $D244
+    RecompiledBegin(ctx, 0xD236); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xD244; return; }
+    // D238  CMP #$05
+    RecompiledBegin(ctx, 0xD238); Compare(cpu, cpu.A, 0x05); cpu.totalCycles += 2;
+    // D23A  BNE $D244
+    RecompiledBegin(ctx, 0xD23A); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xD244; return; }
+    // D23C  CPX #$33
+    RecompiledBegin(ctx, 0xD23C); Compare(cpu, cpu.X, 0x33); cpu.totalCycles += 2;
+    // D23E  BNE $D244
+    RecompiledBegin(ctx, 0xD23E); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xD244; return; }
+    // D240  CPY #$88
+    RecompiledBegin(ctx, 0xD240); Compare(cpu, cpu.Y, 0x88); cpu.totalCycles += 2;
+    // D242  BEQ $D248
+    RecompiledBegin(ctx, 0xD242); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xD248; return; }
+    cpu.PC = 0xD244;
+}
+
+static void Block_D244(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D244  LDA #$7C
+    RecompiledBegin(ctx, 0xD244); cpu.A = 0x7C; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D246  STA $00
+    RecompiledBegin(ctx, 0xD246); bus.write(0x0000, cpu.A); cpu.totalCycles += 3;
+    cpu.PC = 0xD248;
+}
+
+static void Block_D248(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D248  LDA #$03
+    RecompiledBegin(ctx, 0xD248); cpu.A = 0x03; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D24A  STA $78
+    RecompiledBegin(ctx, 0xD24A); bus.write(0x0078, cpu.A); cpu.totalCycles += 3;
+    // D24C  LDA #$01
+    RecompiledBegin(ctx, 0xD24C); cpu.A = 0x01; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D24E  BIT $78
+    RecompiledBegin(ctx, 0xD24E); BitTest(cpu, bus.read(0x0078)); cpu.totalCycles += 3;
+    // D250  BMI $D25A
+    RecompiledBegin(ctx, 0xD250); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xD25A; return; }
+    // D252  BVS $D25A
+    RecompiledBegin(ctx, 0xD252); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xD25A; return; }
+    // D254  BEQ $D25A
+    RecompiledBegin(ctx, 0xD254); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xD25A; return; }
+    // D256  CMP #$01
+    RecompiledBegin(ctx, 0xD256); Compare(cpu, cpu.A, 0x01); cpu.totalCycles += 2;
+    // D258  BEQ $D25E
+    RecompiledBegin(ctx, 0xD258); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xD25E; return; }
+    cpu.PC = 0xD25A;
+}
+
+static void Block_D25A(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D25A  LDA #$7D
+    RecompiledBegin(ctx, 0xD25A); cpu.A = 0x7D; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D25C  STA $00
+    RecompiledBegin(ctx, 0xD25C); bus.write(0x0000, cpu.A); cpu.totalCycles += 3;
+    cpu.PC = 0xD25E;
+}
+
+static void Block_D25E(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D25E  LDY #$7E
+    RecompiledBegin(ctx, 0xD25E); cpu.Y = 0x7E; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // D260  LDA #$AA
+    RecompiledBegin(ctx, 0xD260); cpu.A = 0xAA; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D262  STA $78
+    RecompiledBegin(ctx, 0xD262); bus.write(0x0078, cpu.A); cpu.totalCycles += 3;
+    // D264  JSR $F7B6
+    RecompiledBegin(ctx, 0xD264); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD2); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x66); cpu.totalCycles += 6; cpu.PC = 0xF7B6; return;
+}
+
+static void Block_D267(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D267  ORA $78
+    RecompiledBegin(ctx, 0xD267); cpu.A = static_cast<byte>(cpu.A | bus.read(0x0078)); SetNZ(cpu, cpu.A); cpu.totalCycles += 3;
+    // D269  JSR $F7C0
+    RecompiledBegin(ctx, 0xD269); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD2); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x6B); cpu.totalCycles += 6; cpu.PC = 0xF7C0; return;
+}
+
+static void Block_D26C(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D26C  INY
+    RecompiledBegin(ctx, 0xD26C); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // D26D  LDA #$00
+    RecompiledBegin(ctx, 0xD26D); cpu.A = 0x00; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D26F  STA $78
+    RecompiledBegin(ctx, 0xD26F); bus.write(0x0078, cpu.A); cpu.totalCycles += 3;
+    // D271  JSR $F7CE
+    RecompiledBegin(ctx, 0xD271); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD2); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x73); cpu.totalCycles += 6; cpu.PC = 0xF7CE; return;
+}
+
+static void Block_D274(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D274  ORA $78
+    RecompiledBegin(ctx, 0xD274); cpu.A = static_cast<byte>(cpu.A | bus.read(0x0078)); SetNZ(cpu, cpu.A); cpu.totalCycles += 3;
+    // D276  JSR $F7D3
+    RecompiledBegin(ctx, 0xD276); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD2); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x78); cpu.totalCycles += 6; cpu.PC = 0xF7D3; return;
+}
+
+static void Block_D279(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D279  INY
+    RecompiledBegin(ctx, 0xD279); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // D27A  LDA #$AA
+    RecompiledBegin(ctx, 0xD27A); cpu.A = 0xAA; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D27C  STA $78
+    RecompiledBegin(ctx, 0xD27C); bus.write(0x0078, cpu.A); cpu.totalCycles += 3;
+    // D27E  JSR $F7DF
+    RecompiledBegin(ctx, 0xD27E); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD2); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x80); cpu.totalCycles += 6; cpu.PC = 0xF7DF; return;
+}
+
+static void Block_D281(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D281  AND $78
+    RecompiledBegin(ctx, 0xD281); cpu.A = static_cast<byte>(cpu.A & bus.read(0x0078)); SetNZ(cpu, cpu.A); cpu.totalCycles += 3;
+    // D283  JSR $F7E5
+    RecompiledBegin(ctx, 0xD283); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD2); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x85); cpu.totalCycles += 6; cpu.PC = 0xF7E5; return;
+}
+
+static void Block_D286(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D286  INY
+    RecompiledBegin(ctx, 0xD286); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // D287  LDA #$EF
+    RecompiledBegin(ctx, 0xD287); cpu.A = 0xEF; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D289  STA $78
+    RecompiledBegin(ctx, 0xD289); bus.write(0x0078, cpu.A); cpu.totalCycles += 3;
+    // D28B  JSR $F7F1
+    RecompiledBegin(ctx, 0xD28B); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD2); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x8D); cpu.totalCycles += 6; cpu.PC = 0xF7F1; return;
+}
+
+static void Block_D28E(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D28E  AND $78
+    RecompiledBegin(ctx, 0xD28E); cpu.A = static_cast<byte>(cpu.A & bus.read(0x0078)); SetNZ(cpu, cpu.A); cpu.totalCycles += 3;
+    // D290  JSR $F7F6
+    RecompiledBegin(ctx, 0xD290); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD2); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x92); cpu.totalCycles += 6; cpu.PC = 0xF7F6; return;
+}
+
+static void Block_D293(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D293  INY
+    RecompiledBegin(ctx, 0xD293); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // D294  LDA #$AA
+    RecompiledBegin(ctx, 0xD294); cpu.A = 0xAA; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D296  STA $78
+    RecompiledBegin(ctx, 0xD296); bus.write(0x0078, cpu.A); cpu.totalCycles += 3;
+    // D298  JSR $F804
+    RecompiledBegin(ctx, 0xD298); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD2); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x9A); cpu.totalCycles += 6; cpu.PC = 0xF804; return;
+}
+
+static void Block_D29B(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D29B  EOR $78
+    RecompiledBegin(ctx, 0xD29B); cpu.A = static_cast<byte>(cpu.A ^ bus.read(0x0078)); SetNZ(cpu, cpu.A); cpu.totalCycles += 3;
+    // D29D  JSR $F80A
+    RecompiledBegin(ctx, 0xD29D); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD2); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x9F); cpu.totalCycles += 6; cpu.PC = 0xF80A; return;
+}
+
+static void Block_D2A0(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D2A0  INY
+    RecompiledBegin(ctx, 0xD2A0); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // D2A1  LDA #$70
+    RecompiledBegin(ctx, 0xD2A1); cpu.A = 0x70; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D2A3  STA $78
+    RecompiledBegin(ctx, 0xD2A3); bus.write(0x0078, cpu.A); cpu.totalCycles += 3;
+    // D2A5  JSR $F818
+    RecompiledBegin(ctx, 0xD2A5); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD2); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xA7); cpu.totalCycles += 6; cpu.PC = 0xF818; return;
+}
+
+static void Block_D2A8(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D2A8  EOR $78
+    RecompiledBegin(ctx, 0xD2A8); cpu.A = static_cast<byte>(cpu.A ^ bus.read(0x0078)); SetNZ(cpu, cpu.A); cpu.totalCycles += 3;
+    // D2AA  JSR $F81D
+    RecompiledBegin(ctx, 0xD2AA); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD2); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xAC); cpu.totalCycles += 6; cpu.PC = 0xF81D; return;
+}
+
+static void Block_D2AD(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D2AD  INY
+    RecompiledBegin(ctx, 0xD2AD); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // D2AE  LDA #$69
+    RecompiledBegin(ctx, 0xD2AE); cpu.A = 0x69; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D2B0  STA $78
+    RecompiledBegin(ctx, 0xD2B0); bus.write(0x0078, cpu.A); cpu.totalCycles += 3;
+    // D2B2  JSR $F829
+    RecompiledBegin(ctx, 0xD2B2); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD2); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xB4); cpu.totalCycles += 6; cpu.PC = 0xF829; return;
+}
+
+static void Block_D2B5(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D2B5  ADC $78
+    RecompiledBegin(ctx, 0xD2B5); AddBinary(cpu, bus.read(0x0078)); cpu.totalCycles += 3;
+    // D2B7  JSR $F82F
+    RecompiledBegin(ctx, 0xD2B7); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD2); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xB9); cpu.totalCycles += 6; cpu.PC = 0xF82F; return;
+}
+
+static void Block_D2BA(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D2BA  INY
+    RecompiledBegin(ctx, 0xD2BA); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // D2BB  JSR $F83D
+    RecompiledBegin(ctx, 0xD2BB); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD2); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xBD); cpu.totalCycles += 6; cpu.PC = 0xF83D; return;
+}
+
+static void Block_D2BE(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D2BE  ADC $78
+    RecompiledBegin(ctx, 0xD2BE); AddBinary(cpu, bus.read(0x0078)); cpu.totalCycles += 3;
+    // D2C0  JSR $F843
+    RecompiledBegin(ctx, 0xD2C0); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD2); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xC2); cpu.totalCycles += 6; cpu.PC = 0xF843; return;
+}
+
+static void Block_D2C3(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D2C3  INY
+    RecompiledBegin(ctx, 0xD2C3); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // D2C4  LDA #$7F
+    RecompiledBegin(ctx, 0xD2C4); cpu.A = 0x7F; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D2C6  STA $78
+    RecompiledBegin(ctx, 0xD2C6); bus.write(0x0078, cpu.A); cpu.totalCycles += 3;
+    // D2C8  JSR $F851
+    RecompiledBegin(ctx, 0xD2C8); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD2); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xCA); cpu.totalCycles += 6; cpu.PC = 0xF851; return;
+}
+
+static void Block_D2CB(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D2CB  ADC $78
+    RecompiledBegin(ctx, 0xD2CB); AddBinary(cpu, bus.read(0x0078)); cpu.totalCycles += 3;
+    // D2CD  JSR $F856
+    RecompiledBegin(ctx, 0xD2CD); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD2); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xCF); cpu.totalCycles += 6; cpu.PC = 0xF856; return;
+}
+
+static void Block_D2D0(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D2D0  INY
+    RecompiledBegin(ctx, 0xD2D0); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // D2D1  LDA #$80
+    RecompiledBegin(ctx, 0xD2D1); cpu.A = 0x80; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D2D3  STA $78
+    RecompiledBegin(ctx, 0xD2D3); bus.write(0x0078, cpu.A); cpu.totalCycles += 3;
+    // D2D5  JSR $F864
+    RecompiledBegin(ctx, 0xD2D5); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD2); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD7); cpu.totalCycles += 6; cpu.PC = 0xF864; return;
+}
+
+static void Block_D2D8(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D2D8  ADC $78
+    RecompiledBegin(ctx, 0xD2D8); AddBinary(cpu, bus.read(0x0078)); cpu.totalCycles += 3;
+    // D2DA  JSR $F86A
+    RecompiledBegin(ctx, 0xD2DA); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD2); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xDC); cpu.totalCycles += 6; cpu.PC = 0xF86A; return;
+}
+
+static void Block_D2DD(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D2DD  INY
+    RecompiledBegin(ctx, 0xD2DD); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // D2DE  JSR $F878
+    RecompiledBegin(ctx, 0xD2DE); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD2); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xE0); cpu.totalCycles += 6; cpu.PC = 0xF878; return;
+}
+
+static void Block_D2E1(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D2E1  ADC $78
+    RecompiledBegin(ctx, 0xD2E1); AddBinary(cpu, bus.read(0x0078)); cpu.totalCycles += 3;
+    // D2E3  JSR $F87D
+    RecompiledBegin(ctx, 0xD2E3); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD2); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xE5); cpu.totalCycles += 6; cpu.PC = 0xF87D; return;
+}
+
+static void Block_D2E6(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D2E6  INY
+    RecompiledBegin(ctx, 0xD2E6); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // D2E7  LDA #$40
+    RecompiledBegin(ctx, 0xD2E7); cpu.A = 0x40; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D2E9  STA $78
+    RecompiledBegin(ctx, 0xD2E9); bus.write(0x0078, cpu.A); cpu.totalCycles += 3;
+    // D2EB  JSR $F889
+    RecompiledBegin(ctx, 0xD2EB); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD2); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xED); cpu.totalCycles += 6; cpu.PC = 0xF889; return;
+}
+
+static void Block_D2EE(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D2EE  CMP $78
+    RecompiledBegin(ctx, 0xD2EE); Compare(cpu, cpu.A, bus.read(0x0078)); cpu.totalCycles += 3;
+    // D2F0  JSR $F88E
+    RecompiledBegin(ctx, 0xD2F0); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD2); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xF2); cpu.totalCycles += 6; cpu.PC = 0xF88E; return;
+}
+
+static void Block_D2F3(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D2F3  INY
+    RecompiledBegin(ctx, 0xD2F3); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // D2F4  PHA
+    RecompiledBegin(ctx, 0xD2F4); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), cpu.A); cpu.totalCycles += 3;
+    // D2F5  LDA #$3F
+    RecompiledBegin(ctx, 0xD2F5); cpu.A = 0x3F; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D2F7  STA $78
+    RecompiledBegin(ctx, 0xD2F7); bus.write(0x0078, cpu.A); cpu.totalCycles += 3;
+    // D2F9  PLA
+    RecompiledBegin(ctx, 0xD2F9); cpu.SP++; cpu.A = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); SetNZ(cpu, cpu.A); cpu.totalCycles += 4;
+    // D2FA  JSR $F89A
+    RecompiledBegin(ctx, 0xD2FA); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD2); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xFC); cpu.totalCycles += 6; cpu.PC = 0xF89A; return;
+}
+
+static void Block_D2FD(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D2FD  CMP $78
+    RecompiledBegin(ctx, 0xD2FD); Compare(cpu, cpu.A, bus.read(0x0078)); cpu.totalCycles += 3;
+    // D2FF  JSR $F89C
+    RecompiledBegin(ctx, 0xD2FF); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD3); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x01); cpu.totalCycles += 6; cpu.PC = 0xF89C; return;
+}
+
+static void Block_D302(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D302  INY
+    RecompiledBegin(ctx, 0xD302); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // D303  PHA
+    RecompiledBegin(ctx, 0xD303); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), cpu.A); cpu.totalCycles += 3;
+    // D304  LDA #$41
+    RecompiledBegin(ctx, 0xD304); cpu.A = 0x41; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D306  STA $78
+    RecompiledBegin(ctx, 0xD306); bus.write(0x0078, cpu.A); cpu.totalCycles += 3;
+    // D308  PLA
+    RecompiledBegin(ctx, 0xD308); cpu.SP++; cpu.A = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); SetNZ(cpu, cpu.A); cpu.totalCycles += 4;
+    // D309  CMP $78
+    RecompiledBegin(ctx, 0xD309); Compare(cpu, cpu.A, bus.read(0x0078)); cpu.totalCycles += 3;
+    // D30B  JSR $F8A8
+    RecompiledBegin(ctx, 0xD30B); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD3); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x0D); cpu.totalCycles += 6; cpu.PC = 0xF8A8; return;
+}
+
+static void Block_D30E(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D30E  INY
+    RecompiledBegin(ctx, 0xD30E); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // D30F  PHA
+    RecompiledBegin(ctx, 0xD30F); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), cpu.A); cpu.totalCycles += 3;
+    // D310  LDA #$00
+    RecompiledBegin(ctx, 0xD310); cpu.A = 0x00; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D312  STA $78
+    RecompiledBegin(ctx, 0xD312); bus.write(0x0078, cpu.A); cpu.totalCycles += 3;
+    // D314  PLA
+    RecompiledBegin(ctx, 0xD314); cpu.SP++; cpu.A = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); SetNZ(cpu, cpu.A); cpu.totalCycles += 4;
+    // D315  JSR $F8B2
+    RecompiledBegin(ctx, 0xD315); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD3); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x17); cpu.totalCycles += 6; cpu.PC = 0xF8B2; return;
+}
+
+static void Block_D318(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D318  CMP $78
+    RecompiledBegin(ctx, 0xD318); Compare(cpu, cpu.A, bus.read(0x0078)); cpu.totalCycles += 3;
+    // D31A  JSR $F8B5
+    RecompiledBegin(ctx, 0xD31A); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD3); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x1C); cpu.totalCycles += 6; cpu.PC = 0xF8B5; return;
+}
+
+static void Block_D31D(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D31D  INY
+    RecompiledBegin(ctx, 0xD31D); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // D31E  PHA
+    RecompiledBegin(ctx, 0xD31E); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), cpu.A); cpu.totalCycles += 3;
+    // D31F  LDA #$80
+    RecompiledBegin(ctx, 0xD31F); cpu.A = 0x80; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D321  STA $78
+    RecompiledBegin(ctx, 0xD321); bus.write(0x0078, cpu.A); cpu.totalCycles += 3;
+    // D323  PLA
+    RecompiledBegin(ctx, 0xD323); cpu.SP++; cpu.A = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); SetNZ(cpu, cpu.A); cpu.totalCycles += 4;
+    // D324  CMP $78
+    RecompiledBegin(ctx, 0xD324); Compare(cpu, cpu.A, bus.read(0x0078)); cpu.totalCycles += 3;
+    // D326  JSR $F8BF
+    RecompiledBegin(ctx, 0xD326); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD3); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x28); cpu.totalCycles += 6; cpu.PC = 0xF8BF; return;
+}
+
+static void Block_D329(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D329  INY
+    RecompiledBegin(ctx, 0xD329); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // D32A  PHA
+    RecompiledBegin(ctx, 0xD32A); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), cpu.A); cpu.totalCycles += 3;
+    // D32B  LDA #$81
+    RecompiledBegin(ctx, 0xD32B); cpu.A = 0x81; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D32D  STA $78
+    RecompiledBegin(ctx, 0xD32D); bus.write(0x0078, cpu.A); cpu.totalCycles += 3;
+    // D32F  PLA
+    RecompiledBegin(ctx, 0xD32F); cpu.SP++; cpu.A = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); SetNZ(cpu, cpu.A); cpu.totalCycles += 4;
+    // D330  CMP $78
+    RecompiledBegin(ctx, 0xD330); Compare(cpu, cpu.A, bus.read(0x0078)); cpu.totalCycles += 3;
+    // D332  JSR $F8C9
+    RecompiledBegin(ctx, 0xD332); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD3); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x34); cpu.totalCycles += 6; cpu.PC = 0xF8C9; return;
+}
+
+static void Block_D335(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D335  INY
+    RecompiledBegin(ctx, 0xD335); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // D336  PHA
+    RecompiledBegin(ctx, 0xD336); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), cpu.A); cpu.totalCycles += 3;
+    // D337  LDA #$7F
+    RecompiledBegin(ctx, 0xD337); cpu.A = 0x7F; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D339  STA $78
+    RecompiledBegin(ctx, 0xD339); bus.write(0x0078, cpu.A); cpu.totalCycles += 3;
+    // D33B  PLA
+    RecompiledBegin(ctx, 0xD33B); cpu.SP++; cpu.A = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); SetNZ(cpu, cpu.A); cpu.totalCycles += 4;
+    // D33C  CMP $78
+    RecompiledBegin(ctx, 0xD33C); Compare(cpu, cpu.A, bus.read(0x0078)); cpu.totalCycles += 3;
+    // D33E  JSR $F8D3
+    RecompiledBegin(ctx, 0xD33E); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD3); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x40); cpu.totalCycles += 6; cpu.PC = 0xF8D3; return;
+}
+
+static void Block_D341(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D341  INY
+    RecompiledBegin(ctx, 0xD341); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // D342  LDA #$40
+    RecompiledBegin(ctx, 0xD342); cpu.A = 0x40; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D344  STA $78
+    RecompiledBegin(ctx, 0xD344); bus.write(0x0078, cpu.A); cpu.totalCycles += 3;
+    // D346  JSR $F931
+    RecompiledBegin(ctx, 0xD346); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD3); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x48); cpu.totalCycles += 6; cpu.PC = 0xF931; return;
+}
+
+static void Block_D349(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D349  SBC $78
+    RecompiledBegin(ctx, 0xD349); SubtractBinary(cpu, bus.read(0x0078)); cpu.totalCycles += 3;
+    // D34B  JSR $F937
+    RecompiledBegin(ctx, 0xD34B); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD3); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x4D); cpu.totalCycles += 6; cpu.PC = 0xF937; return;
+}
+
+static void Block_D34E(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D34E  INY
+    RecompiledBegin(ctx, 0xD34E); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // D34F  LDA #$3F
+    RecompiledBegin(ctx, 0xD34F); cpu.A = 0x3F; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D351  STA $78
+    RecompiledBegin(ctx, 0xD351); bus.write(0x0078, cpu.A); cpu.totalCycles += 3;
+    // D353  JSR $F947
+    RecompiledBegin(ctx, 0xD353); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD3); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x55); cpu.totalCycles += 6; cpu.PC = 0xF947; return;
+}
+
+static void Block_D356(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D356  SBC $78
+    RecompiledBegin(ctx, 0xD356); SubtractBinary(cpu, bus.read(0x0078)); cpu.totalCycles += 3;
+    // D358  JSR $F94C
+    RecompiledBegin(ctx, 0xD358); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD3); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x5A); cpu.totalCycles += 6; cpu.PC = 0xF94C; return;
+}
+
+static void Block_D35B(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D35B  INY
+    RecompiledBegin(ctx, 0xD35B); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // D35C  LDA #$41
+    RecompiledBegin(ctx, 0xD35C); cpu.A = 0x41; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D35E  STA $78
+    RecompiledBegin(ctx, 0xD35E); bus.write(0x0078, cpu.A); cpu.totalCycles += 3;
+    // D360  JSR $F95C
+    RecompiledBegin(ctx, 0xD360); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD3); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x62); cpu.totalCycles += 6; cpu.PC = 0xF95C; return;
+}
+
+static void Block_D363(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D363  SBC $78
+    RecompiledBegin(ctx, 0xD363); SubtractBinary(cpu, bus.read(0x0078)); cpu.totalCycles += 3;
+    // D365  JSR $F962
+    RecompiledBegin(ctx, 0xD365); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD3); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x67); cpu.totalCycles += 6; cpu.PC = 0xF962; return;
+}
+
+static void Block_D368(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D368  INY
+    RecompiledBegin(ctx, 0xD368); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // D369  LDA #$00
+    RecompiledBegin(ctx, 0xD369); cpu.A = 0x00; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D36B  STA $78
+    RecompiledBegin(ctx, 0xD36B); bus.write(0x0078, cpu.A); cpu.totalCycles += 3;
+    // D36D  JSR $F972
+    RecompiledBegin(ctx, 0xD36D); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD3); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x6F); cpu.totalCycles += 6; cpu.PC = 0xF972; return;
+}
+
+static void Block_D370(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D370  SBC $78
+    RecompiledBegin(ctx, 0xD370); SubtractBinary(cpu, bus.read(0x0078)); cpu.totalCycles += 3;
+    // D372  JSR $F976
+    RecompiledBegin(ctx, 0xD372); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD3); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x74); cpu.totalCycles += 6; cpu.PC = 0xF976; return;
+}
+
+static void Block_D375(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D375  INY
+    RecompiledBegin(ctx, 0xD375); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // D376  LDA #$7F
+    RecompiledBegin(ctx, 0xD376); cpu.A = 0x7F; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D378  STA $78
+    RecompiledBegin(ctx, 0xD378); bus.write(0x0078, cpu.A); cpu.totalCycles += 3;
+    // D37A  JSR $F980
+    RecompiledBegin(ctx, 0xD37A); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD3); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x7C); cpu.totalCycles += 6; cpu.PC = 0xF980; return;
+}
+
+static void Block_D37D(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D37D  SBC $78
+    RecompiledBegin(ctx, 0xD37D); SubtractBinary(cpu, bus.read(0x0078)); cpu.totalCycles += 3;
+    // D37F  JSR $F984
+    RecompiledBegin(ctx, 0xD37F); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD3); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x81); cpu.totalCycles += 6; cpu.PC = 0xF984; return;
+}
+
+static void Block_D382(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D382  INY
+    RecompiledBegin(ctx, 0xD382); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // D383  LDA #$40
+    RecompiledBegin(ctx, 0xD383); cpu.A = 0x40; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D385  STA $78
+    RecompiledBegin(ctx, 0xD385); bus.write(0x0078, cpu.A); cpu.totalCycles += 3;
+    // D387  JSR $F889
+    RecompiledBegin(ctx, 0xD387); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD3); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x89); cpu.totalCycles += 6; cpu.PC = 0xF889; return;
+}
+
+static void Block_D38A(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D38A  TAX
+    RecompiledBegin(ctx, 0xD38A); cpu.X = cpu.A; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // D38B  CPX $78
+    RecompiledBegin(ctx, 0xD38B); Compare(cpu, cpu.X, bus.read(0x0078)); cpu.totalCycles += 3;
+    // D38D  JSR $F88E
+    RecompiledBegin(ctx, 0xD38D); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD3); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x8F); cpu.totalCycles += 6; cpu.PC = 0xF88E; return;
+}
+
+static void Block_D390(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D390  INY
+    RecompiledBegin(ctx, 0xD390); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // D391  LDA #$3F
+    RecompiledBegin(ctx, 0xD391); cpu.A = 0x3F; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D393  STA $78
+    RecompiledBegin(ctx, 0xD393); bus.write(0x0078, cpu.A); cpu.totalCycles += 3;
+    // D395  JSR $F89A
+    RecompiledBegin(ctx, 0xD395); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD3); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x97); cpu.totalCycles += 6; cpu.PC = 0xF89A; return;
+}
+
+static void Block_D398(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D398  CPX $78
+    RecompiledBegin(ctx, 0xD398); Compare(cpu, cpu.X, bus.read(0x0078)); cpu.totalCycles += 3;
+    // D39A  JSR $F89C
+    RecompiledBegin(ctx, 0xD39A); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD3); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x9C); cpu.totalCycles += 6; cpu.PC = 0xF89C; return;
+}
+
+static void Block_D39D(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D39D  INY
+    RecompiledBegin(ctx, 0xD39D); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // D39E  LDA #$41
+    RecompiledBegin(ctx, 0xD39E); cpu.A = 0x41; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D3A0  STA $78
+    RecompiledBegin(ctx, 0xD3A0); bus.write(0x0078, cpu.A); cpu.totalCycles += 3;
+    // D3A2  CPX $78
+    RecompiledBegin(ctx, 0xD3A2); Compare(cpu, cpu.X, bus.read(0x0078)); cpu.totalCycles += 3;
+    // D3A4  JSR $F8A8
+    RecompiledBegin(ctx, 0xD3A4); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD3); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xA6); cpu.totalCycles += 6; cpu.PC = 0xF8A8; return;
+}
+
+static void Block_D3A7(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D3A7  INY
+    RecompiledBegin(ctx, 0xD3A7); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // D3A8  LDA #$00
+    RecompiledBegin(ctx, 0xD3A8); cpu.A = 0x00; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D3AA  STA $78
+    RecompiledBegin(ctx, 0xD3AA); bus.write(0x0078, cpu.A); cpu.totalCycles += 3;
+    // D3AC  JSR $F8B2
+    RecompiledBegin(ctx, 0xD3AC); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD3); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xAE); cpu.totalCycles += 6; cpu.PC = 0xF8B2; return;
+}
+
+static void Block_D3AF(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D3AF  TAX
+    RecompiledBegin(ctx, 0xD3AF); cpu.X = cpu.A; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // D3B0  CPX $78
+    RecompiledBegin(ctx, 0xD3B0); Compare(cpu, cpu.X, bus.read(0x0078)); cpu.totalCycles += 3;
+    // D3B2  JSR $F8B5
+    RecompiledBegin(ctx, 0xD3B2); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD3); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xB4); cpu.totalCycles += 6; cpu.PC = 0xF8B5; return;
+}
+
+static void Block_D3B5(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D3B5  INY
+    RecompiledBegin(ctx, 0xD3B5); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // D3B6  LDA #$80
+    RecompiledBegin(ctx, 0xD3B6); cpu.A = 0x80; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D3B8  STA $78
+    RecompiledBegin(ctx, 0xD3B8); bus.write(0x0078, cpu.A); cpu.totalCycles += 3;
+    // D3BA  CPX $78
+    RecompiledBegin(ctx, 0xD3BA); Compare(cpu, cpu.X, bus.read(0x0078)); cpu.totalCycles += 3;
+    // D3BC  JSR $F8BF
+    RecompiledBegin(ctx, 0xD3BC); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD3); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xBE); cpu.totalCycles += 6; cpu.PC = 0xF8BF; return;
+}
+
+static void Block_D3BF(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D3BF  INY
+    RecompiledBegin(ctx, 0xD3BF); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // D3C0  LDA #$81
+    RecompiledBegin(ctx, 0xD3C0); cpu.A = 0x81; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D3C2  STA $78
+    RecompiledBegin(ctx, 0xD3C2); bus.write(0x0078, cpu.A); cpu.totalCycles += 3;
+    // D3C4  CPX $78
+    RecompiledBegin(ctx, 0xD3C4); Compare(cpu, cpu.X, bus.read(0x0078)); cpu.totalCycles += 3;
+    // D3C6  JSR $F8C9
+    RecompiledBegin(ctx, 0xD3C6); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD3); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xC8); cpu.totalCycles += 6; cpu.PC = 0xF8C9; return;
+}
+
+static void Block_D3C9(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D3C9  INY
+    RecompiledBegin(ctx, 0xD3C9); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // D3CA  LDA #$7F
+    RecompiledBegin(ctx, 0xD3CA); cpu.A = 0x7F; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D3CC  STA $78
+    RecompiledBegin(ctx, 0xD3CC); bus.write(0x0078, cpu.A); cpu.totalCycles += 3;
+    // D3CE  CPX $78
+    RecompiledBegin(ctx, 0xD3CE); Compare(cpu, cpu.X, bus.read(0x0078)); cpu.totalCycles += 3;
+    // D3D0  JSR $F8D3
+    RecompiledBegin(ctx, 0xD3D0); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD3); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD2); cpu.totalCycles += 6; cpu.PC = 0xF8D3; return;
+}
+
+static void Block_D3D3(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D3D3  INY
+    RecompiledBegin(ctx, 0xD3D3); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // D3D4  TYA
+    RecompiledBegin(ctx, 0xD3D4); cpu.A = cpu.Y; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D3D5  TAX
+    RecompiledBegin(ctx, 0xD3D5); cpu.X = cpu.A; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // D3D6  LDA #$40
+    RecompiledBegin(ctx, 0xD3D6); cpu.A = 0x40; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D3D8  STA $78
+    RecompiledBegin(ctx, 0xD3D8); bus.write(0x0078, cpu.A); cpu.totalCycles += 3;
+    // D3DA  JSR $F8DD
+    RecompiledBegin(ctx, 0xD3DA); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD3); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xDC); cpu.totalCycles += 6; cpu.PC = 0xF8DD; return;
+}
+
+static void Block_D3DD(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D3DD  CPY $78
+    RecompiledBegin(ctx, 0xD3DD); Compare(cpu, cpu.Y, bus.read(0x0078)); cpu.totalCycles += 3;
+    // D3DF  JSR $F8E2
+    RecompiledBegin(ctx, 0xD3DF); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD3); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xE1); cpu.totalCycles += 6; cpu.PC = 0xF8E2; return;
+}
+
+static void Block_D3E2(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D3E2  INX
+    RecompiledBegin(ctx, 0xD3E2); cpu.X++; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // D3E3  LDA #$3F
+    RecompiledBegin(ctx, 0xD3E3); cpu.A = 0x3F; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D3E5  STA $78
+    RecompiledBegin(ctx, 0xD3E5); bus.write(0x0078, cpu.A); cpu.totalCycles += 3;
+    // D3E7  JSR $F8EE
+    RecompiledBegin(ctx, 0xD3E7); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD3); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xE9); cpu.totalCycles += 6; cpu.PC = 0xF8EE; return;
+}
+
+static void Block_D3EA(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D3EA  CPY $78
+    RecompiledBegin(ctx, 0xD3EA); Compare(cpu, cpu.Y, bus.read(0x0078)); cpu.totalCycles += 3;
+    // D3EC  JSR $F8F0
+    RecompiledBegin(ctx, 0xD3EC); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD3); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xEE); cpu.totalCycles += 6; cpu.PC = 0xF8F0; return;
+}
+
+static void Block_D3EF(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D3EF  INX
+    RecompiledBegin(ctx, 0xD3EF); cpu.X++; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // D3F0  LDA #$41
+    RecompiledBegin(ctx, 0xD3F0); cpu.A = 0x41; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D3F2  STA $78
+    RecompiledBegin(ctx, 0xD3F2); bus.write(0x0078, cpu.A); cpu.totalCycles += 3;
+    // D3F4  CPY $78
+    RecompiledBegin(ctx, 0xD3F4); Compare(cpu, cpu.Y, bus.read(0x0078)); cpu.totalCycles += 3;
+    // D3F6  JSR $F8FC
+    RecompiledBegin(ctx, 0xD3F6); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD3); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xF8); cpu.totalCycles += 6; cpu.PC = 0xF8FC; return;
+}
+
+static void Block_D3F9(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D3F9  INX
+    RecompiledBegin(ctx, 0xD3F9); cpu.X++; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // D3FA  LDA #$00
+    RecompiledBegin(ctx, 0xD3FA); cpu.A = 0x00; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D3FC  STA $78
+    RecompiledBegin(ctx, 0xD3FC); bus.write(0x0078, cpu.A); cpu.totalCycles += 3;
+    // D3FE  JSR $F906
+    RecompiledBegin(ctx, 0xD3FE); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD4); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x00); cpu.totalCycles += 6; cpu.PC = 0xF906; return;
+}
+
+static void Block_D401(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D401  CPY $78
+    RecompiledBegin(ctx, 0xD401); Compare(cpu, cpu.Y, bus.read(0x0078)); cpu.totalCycles += 3;
+    // D403  JSR $F909
+    RecompiledBegin(ctx, 0xD403); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD4); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x05); cpu.totalCycles += 6; cpu.PC = 0xF909; return;
+}
+
+static void Block_D406(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D406  INX
+    RecompiledBegin(ctx, 0xD406); cpu.X++; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // D407  LDA #$80
+    RecompiledBegin(ctx, 0xD407); cpu.A = 0x80; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D409  STA $78
+    RecompiledBegin(ctx, 0xD409); bus.write(0x0078, cpu.A); cpu.totalCycles += 3;
+    // D40B  CPY $78
+    RecompiledBegin(ctx, 0xD40B); Compare(cpu, cpu.Y, bus.read(0x0078)); cpu.totalCycles += 3;
+    // D40D  JSR $F913
+    RecompiledBegin(ctx, 0xD40D); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD4); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x0F); cpu.totalCycles += 6; cpu.PC = 0xF913; return;
+}
+
+static void Block_D410(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D410  INX
+    RecompiledBegin(ctx, 0xD410); cpu.X++; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // D411  LDA #$81
+    RecompiledBegin(ctx, 0xD411); cpu.A = 0x81; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D413  STA $78
+    RecompiledBegin(ctx, 0xD413); bus.write(0x0078, cpu.A); cpu.totalCycles += 3;
+    // D415  CPY $78
+    RecompiledBegin(ctx, 0xD415); Compare(cpu, cpu.Y, bus.read(0x0078)); cpu.totalCycles += 3;
+    // D417  JSR $F91D
+    RecompiledBegin(ctx, 0xD417); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD4); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x19); cpu.totalCycles += 6; cpu.PC = 0xF91D; return;
+}
+
+static void Block_D41A(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D41A  INX
+    RecompiledBegin(ctx, 0xD41A); cpu.X++; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // D41B  LDA #$7F
+    RecompiledBegin(ctx, 0xD41B); cpu.A = 0x7F; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D41D  STA $78
+    RecompiledBegin(ctx, 0xD41D); bus.write(0x0078, cpu.A); cpu.totalCycles += 3;
+    // D41F  CPY $78
+    RecompiledBegin(ctx, 0xD41F); Compare(cpu, cpu.Y, bus.read(0x0078)); cpu.totalCycles += 3;
+    // D421  JSR $F927
+    RecompiledBegin(ctx, 0xD421); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD4); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x23); cpu.totalCycles += 6; cpu.PC = 0xF927; return;
+}
+
+static void Block_D424(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D424  INX
+    RecompiledBegin(ctx, 0xD424); cpu.X++; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // D425  TXA
+    RecompiledBegin(ctx, 0xD425); cpu.A = cpu.X; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D426  TAY
+    RecompiledBegin(ctx, 0xD426); cpu.Y = cpu.A; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // D427  JSR $F990
+    RecompiledBegin(ctx, 0xD427); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD4); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x29); cpu.totalCycles += 6; cpu.PC = 0xF990; return;
+}
+
+static void Block_D42A(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D42A  STA $78
+    RecompiledBegin(ctx, 0xD42A); bus.write(0x0078, cpu.A); cpu.totalCycles += 3;
+    // D42C  LSR $78
+    RecompiledBegin(ctx, 0xD42C); bus.write(0x0078, ShiftRight(cpu, bus.read(0x0078))); cpu.totalCycles += 5;
+    // D42E  LDA $78
+    RecompiledBegin(ctx, 0xD42E); cpu.A = bus.read(0x0078); SetNZ(cpu, cpu.A); cpu.totalCycles += 3;
+    // D430  JSR $F99D
+    RecompiledBegin(ctx, 0xD430); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD4); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x32); cpu.totalCycles += 6; cpu.PC = 0xF99D; return;
+}
+
+static void Block_D433(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D433  INY
+    RecompiledBegin(ctx, 0xD433); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // D434  STA $78
+    RecompiledBegin(ctx, 0xD434); bus.write(0x0078, cpu.A); cpu.totalCycles += 3;
+    // D436  LSR $78
+    RecompiledBegin(ctx, 0xD436); bus.write(0x0078, ShiftRight(cpu, bus.read(0x0078))); cpu.totalCycles += 5;
+    // D438  LDA $78
+    RecompiledBegin(ctx, 0xD438); cpu.A = bus.read(0x0078); SetNZ(cpu, cpu.A); cpu.totalCycles += 3;
+    // D43A  JSR $F9AD
+    RecompiledBegin(ctx, 0xD43A); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD4); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x3C); cpu.totalCycles += 6; cpu.PC = 0xF9AD; return;
+}
+
+static void Block_D43D(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D43D  INY
+    RecompiledBegin(ctx, 0xD43D); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // D43E  JSR $F9BD
+    RecompiledBegin(ctx, 0xD43E); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD4); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x40); cpu.totalCycles += 6; cpu.PC = 0xF9BD; return;
+}
+
+static void Block_D441(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D441  STA $78
+    RecompiledBegin(ctx, 0xD441); bus.write(0x0078, cpu.A); cpu.totalCycles += 3;
+    // D443  ASL $78
+    RecompiledBegin(ctx, 0xD443); bus.write(0x0078, ShiftLeft(cpu, bus.read(0x0078))); cpu.totalCycles += 5;
+    // D445  LDA $78
+    RecompiledBegin(ctx, 0xD445); cpu.A = bus.read(0x0078); SetNZ(cpu, cpu.A); cpu.totalCycles += 3;
+    // D447  JSR $F9C3
+    RecompiledBegin(ctx, 0xD447); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD4); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x49); cpu.totalCycles += 6; cpu.PC = 0xF9C3; return;
+}
+
+static void Block_D44A(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D44A  INY
+    RecompiledBegin(ctx, 0xD44A); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // D44B  STA $78
+    RecompiledBegin(ctx, 0xD44B); bus.write(0x0078, cpu.A); cpu.totalCycles += 3;
+    // D44D  ASL $78
+    RecompiledBegin(ctx, 0xD44D); bus.write(0x0078, ShiftLeft(cpu, bus.read(0x0078))); cpu.totalCycles += 5;
+    // D44F  LDA $78
+    RecompiledBegin(ctx, 0xD44F); cpu.A = bus.read(0x0078); SetNZ(cpu, cpu.A); cpu.totalCycles += 3;
+    // D451  JSR $F9D4
+    RecompiledBegin(ctx, 0xD451); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD4); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x53); cpu.totalCycles += 6; cpu.PC = 0xF9D4; return;
+}
+
+static void Block_D454(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D454  INY
+    RecompiledBegin(ctx, 0xD454); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // D455  JSR $F9E4
+    RecompiledBegin(ctx, 0xD455); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD4); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x57); cpu.totalCycles += 6; cpu.PC = 0xF9E4; return;
+}
+
+static void Block_D458(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D458  STA $78
+    RecompiledBegin(ctx, 0xD458); bus.write(0x0078, cpu.A); cpu.totalCycles += 3;
+    // D45A  ROR $78
+    RecompiledBegin(ctx, 0xD45A); bus.write(0x0078, RotateRight(cpu, bus.read(0x0078))); cpu.totalCycles += 5;
+    // D45C  LDA $78
+    RecompiledBegin(ctx, 0xD45C); cpu.A = bus.read(0x0078); SetNZ(cpu, cpu.A); cpu.totalCycles += 3;
+    // D45E  JSR $F9EA
+    RecompiledBegin(ctx, 0xD45E); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD4); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x60); cpu.totalCycles += 6; cpu.PC = 0xF9EA; return;
+}
+
+static void Block_D461(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D461  INY
+    RecompiledBegin(ctx, 0xD461); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // D462  STA $78
+    RecompiledBegin(ctx, 0xD462); bus.write(0x0078, cpu.A); cpu.totalCycles += 3;
+    // D464  ROR $78
+    RecompiledBegin(ctx, 0xD464); bus.write(0x0078, RotateRight(cpu, bus.read(0x0078))); cpu.totalCycles += 5;
+    // D466  LDA $78
+    RecompiledBegin(ctx, 0xD466); cpu.A = bus.read(0x0078); SetNZ(cpu, cpu.A); cpu.totalCycles += 3;
+    // D468  JSR $F9FB
+    RecompiledBegin(ctx, 0xD468); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD4); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x6A); cpu.totalCycles += 6; cpu.PC = 0xF9FB; return;
+}
+
+static void Block_D46B(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D46B  INY
+    RecompiledBegin(ctx, 0xD46B); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // D46C  JSR $FA0A
+    RecompiledBegin(ctx, 0xD46C); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD4); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x6E); cpu.totalCycles += 6; cpu.PC = 0xFA0A; return;
+}
+
+static void Block_D46F(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D46F  STA $78
+    RecompiledBegin(ctx, 0xD46F); bus.write(0x0078, cpu.A); cpu.totalCycles += 3;
+    // D471  ROL $78
+    RecompiledBegin(ctx, 0xD471); bus.write(0x0078, RotateLeft(cpu, bus.read(0x0078))); cpu.totalCycles += 5;
+    // D473  LDA $78
+    RecompiledBegin(ctx, 0xD473); cpu.A = bus.read(0x0078); SetNZ(cpu, cpu.A); cpu.totalCycles += 3;
+    // D475  JSR $FA10
+    RecompiledBegin(ctx, 0xD475); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD4); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x77); cpu.totalCycles += 6; cpu.PC = 0xFA10; return;
+}
+
+static void Block_D478(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D478  INY
+    RecompiledBegin(ctx, 0xD478); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // D479  STA $78
+    RecompiledBegin(ctx, 0xD479); bus.write(0x0078, cpu.A); cpu.totalCycles += 3;
+    // D47B  ROL $78
+    RecompiledBegin(ctx, 0xD47B); bus.write(0x0078, RotateLeft(cpu, bus.read(0x0078))); cpu.totalCycles += 5;
+    // D47D  LDA $78
+    RecompiledBegin(ctx, 0xD47D); cpu.A = bus.read(0x0078); SetNZ(cpu, cpu.A); cpu.totalCycles += 3;
+    // D47F  JSR $FA21
+    RecompiledBegin(ctx, 0xD47F); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD4); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x81); cpu.totalCycles += 6; cpu.PC = 0xFA21; return;
+}
+
+static void Block_D482(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D482  LDA #$FF
+    RecompiledBegin(ctx, 0xD482); cpu.A = 0xFF; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D484  STA $78
+    RecompiledBegin(ctx, 0xD484); bus.write(0x0078, cpu.A); cpu.totalCycles += 3;
+    // D486  STA $01
+    RecompiledBegin(ctx, 0xD486); bus.write(0x0001, cpu.A); cpu.totalCycles += 3;
+    // D488  BIT $01
+    RecompiledBegin(ctx, 0xD488); BitTest(cpu, bus.read(0x0001)); cpu.totalCycles += 3;
+    // D48A  SEC
+    RecompiledBegin(ctx, 0xD48A); SetFlag(cpu, Flags::C, true); cpu.totalCycles += 2;
+    // D48B  INC $78
+    { RecompiledBegin(ctx, 0xD48B); const byte result = static_cast<byte>(bus.read(0x0078) + 1); bus.write(0x0078, result); SetNZ(cpu, result); cpu.totalCycles += 5; }
+    // D48D  BNE $D49B
+    RecompiledBegin(ctx, 0xD48D); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xD49B; return; }
+    // D48F  BMI $D49B
+    RecompiledBegin(ctx, 0xD48F); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xD49B; return; }
+    // D491  BVC $D49B
+    RecompiledBegin(ctx, 0xD491); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xD49B; return; }
+    // D493  BCC $D49B
+    RecompiledBegin(ctx, 0xD493); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xD49B; return; }
+    // D495  LDA $78
+    RecompiledBegin(ctx, 0xD495); cpu.A = bus.read(0x0078); SetNZ(cpu, cpu.A); cpu.totalCycles += 3;
+    // D497  CMP #$00
+    RecompiledBegin(ctx, 0xD497); Compare(cpu, cpu.A, 0x00); cpu.totalCycles += 2;
+    // D499  BEQ $D49F
+    RecompiledBegin(ctx, 0xD499); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xD49F; return; }
+    cpu.PC = 0xD49B;
+}
+
+static void Block_D49B(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D49B  LDA #$AB
+    RecompiledBegin(ctx, 0xD49B); cpu.A = 0xAB; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D49D  STA $00
+    RecompiledBegin(ctx, 0xD49D); bus.write(0x0000, cpu.A); cpu.totalCycles += 3;
+    cpu.PC = 0xD49F;
+}
+
+static void Block_D49F(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D49F  LDA #$7F
+    RecompiledBegin(ctx, 0xD49F); cpu.A = 0x7F; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D4A1  STA $78
+    RecompiledBegin(ctx, 0xD4A1); bus.write(0x0078, cpu.A); cpu.totalCycles += 3;
+    // D4A3  CLV
+    RecompiledBegin(ctx, 0xD4A3); SetFlag(cpu, Flags::V, false); cpu.totalCycles += 2;
+    // D4A4  CLC
+    RecompiledBegin(ctx, 0xD4A4); SetFlag(cpu, Flags::C, false); cpu.totalCycles += 2;
+    // D4A5  INC $78
+    { RecompiledBegin(ctx, 0xD4A5); const byte result = static_cast<byte>(bus.read(0x0078) + 1); bus.write(0x0078, result); SetNZ(cpu, result); cpu.totalCycles += 5; }
+    // D4A7  BEQ $D4B5
+    RecompiledBegin(ctx, 0xD4A7); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xD4B5; return; }
+    // D4A9  BPL $D4B5
+    RecompiledBegin(ctx, 0xD4A9); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xD4B5; return; }
+    // D4AB  BVS $D4B5
+    RecompiledBegin(ctx, 0xD4AB); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xD4B5; return; }
+    // D4AD  BCS $D4B5
+    RecompiledBegin(ctx, 0xD4AD); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xD4B5; return; }
+    // D4AF  LDA $78
+    RecompiledBegin(ctx, 0xD4AF); cpu.A = bus.read(0x0078); SetNZ(cpu, cpu.A); cpu.totalCycles += 3;
+    // D4B1  CMP #$80
+    RecompiledBegin(ctx, 0xD4B1); Compare(cpu, cpu.A, 0x80); cpu.totalCycles += 2;
+    // D4B3  BEQ $D4B9
+    RecompiledBegin(ctx, 0xD4B3); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xD4B9; return; }
+    cpu.PC = 0xD4B5;
+}
+
+static void Block_D4B5(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D4B5  LDA #$AC
+    RecompiledBegin(ctx, 0xD4B5); cpu.A = 0xAC; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D4B7  STA $00
+    RecompiledBegin(ctx, 0xD4B7); bus.write(0x0000, cpu.A); cpu.totalCycles += 3;
+    cpu.PC = 0xD4B9;
+}
+
+static void Block_D4B9(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D4B9  LDA #$00
+    RecompiledBegin(ctx, 0xD4B9); cpu.A = 0x00; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D4BB  STA $78
+    RecompiledBegin(ctx, 0xD4BB); bus.write(0x0078, cpu.A); cpu.totalCycles += 3;
+    // D4BD  BIT $01
+    RecompiledBegin(ctx, 0xD4BD); BitTest(cpu, bus.read(0x0001)); cpu.totalCycles += 3;
+    // D4BF  SEC
+    RecompiledBegin(ctx, 0xD4BF); SetFlag(cpu, Flags::C, true); cpu.totalCycles += 2;
+    // D4C0  DEC $78
+    { RecompiledBegin(ctx, 0xD4C0); const byte result = static_cast<byte>(bus.read(0x0078) - 1); bus.write(0x0078, result); SetNZ(cpu, result); cpu.totalCycles += 5; }
+    // D4C2  BEQ $D4D0
+    RecompiledBegin(ctx, 0xD4C2); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xD4D0; return; }
+    // D4C4  BPL $D4D0
+    RecompiledBegin(ctx, 0xD4C4); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xD4D0; return; }
+    // D4C6  BVC $D4D0
+    RecompiledBegin(ctx, 0xD4C6); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xD4D0; return; }
+    // D4C8  BCC $D4D0
+    RecompiledBegin(ctx, 0xD4C8); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xD4D0; return; }
+    // D4CA  LDA $78
+    RecompiledBegin(ctx, 0xD4CA); cpu.A = bus.read(0x0078); SetNZ(cpu, cpu.A); cpu.totalCycles += 3;
+    // D4CC  CMP #$FF
+    RecompiledBegin(ctx, 0xD4CC); Compare(cpu, cpu.A, 0xFF); cpu.totalCycles += 2;
+    // D4CE  BEQ $D4D4
+    RecompiledBegin(ctx, 0xD4CE); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xD4D4; return; }
+    cpu.PC = 0xD4D0;
+}
+
+static void Block_D4D0(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D4D0  LDA #$AD
+    RecompiledBegin(ctx, 0xD4D0); cpu.A = 0xAD; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D4D2  STA $00
+    RecompiledBegin(ctx, 0xD4D2); bus.write(0x0000, cpu.A); cpu.totalCycles += 3;
+    cpu.PC = 0xD4D4;
+}
+
+static void Block_D4D4(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D4D4  LDA #$80
+    RecompiledBegin(ctx, 0xD4D4); cpu.A = 0x80; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D4D6  STA $78
+    RecompiledBegin(ctx, 0xD4D6); bus.write(0x0078, cpu.A); cpu.totalCycles += 3;
+    // D4D8  CLV
+    RecompiledBegin(ctx, 0xD4D8); SetFlag(cpu, Flags::V, false); cpu.totalCycles += 2;
+    // D4D9  CLC
+    RecompiledBegin(ctx, 0xD4D9); SetFlag(cpu, Flags::C, false); cpu.totalCycles += 2;
+    // D4DA  DEC $78
+    { RecompiledBegin(ctx, 0xD4DA); const byte result = static_cast<byte>(bus.read(0x0078) - 1); bus.write(0x0078, result); SetNZ(cpu, result); cpu.totalCycles += 5; }
+    // D4DC  BEQ $D4EA
+    RecompiledBegin(ctx, 0xD4DC); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xD4EA; return; }
+    // D4DE  BMI $D4EA
+    RecompiledBegin(ctx, 0xD4DE); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xD4EA; return; }
+    // D4E0  BVS $D4EA
+    RecompiledBegin(ctx, 0xD4E0); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xD4EA; return; }
+    // D4E2  BCS $D4EA
+    RecompiledBegin(ctx, 0xD4E2); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xD4EA; return; }
+    // D4E4  LDA $78
+    RecompiledBegin(ctx, 0xD4E4); cpu.A = bus.read(0x0078); SetNZ(cpu, cpu.A); cpu.totalCycles += 3;
+    // D4E6  CMP #$7F
+    RecompiledBegin(ctx, 0xD4E6); Compare(cpu, cpu.A, 0x7F); cpu.totalCycles += 2;
+    // D4E8  BEQ $D4EE
+    RecompiledBegin(ctx, 0xD4E8); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xD4EE; return; }
+    cpu.PC = 0xD4EA;
+}
+
+static void Block_D4EA(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D4EA  LDA #$AE
+    RecompiledBegin(ctx, 0xD4EA); cpu.A = 0xAE; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D4EC  STA $00
+    RecompiledBegin(ctx, 0xD4EC); bus.write(0x0000, cpu.A); cpu.totalCycles += 3;
+    cpu.PC = 0xD4EE;
+}
+
+static void Block_D4EE(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D4EE  LDA #$01
+    RecompiledBegin(ctx, 0xD4EE); cpu.A = 0x01; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D4F0  STA $78
+    RecompiledBegin(ctx, 0xD4F0); bus.write(0x0078, cpu.A); cpu.totalCycles += 3;
+    // D4F2  DEC $78
+    { RecompiledBegin(ctx, 0xD4F2); const byte result = static_cast<byte>(bus.read(0x0078) - 1); bus.write(0x0078, result); SetNZ(cpu, result); cpu.totalCycles += 5; }
+    // D4F4  BEQ $D4FA
+    RecompiledBegin(ctx, 0xD4F4); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xD4FA; return; }
+    // D4F6  LDA #$AF
+    RecompiledBegin(ctx, 0xD4F6); cpu.A = 0xAF; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D4F8  STA $00
+    RecompiledBegin(ctx, 0xD4F8); bus.write(0x0000, cpu.A); cpu.totalCycles += 3;
+    cpu.PC = 0xD4FA;
+}
+
+static void Block_D4FA(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D4FA  RTS
+    { RecompiledBegin(ctx, 0xD4FA); cpu.SP++; const byte low = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); const byte high = bus.read(static_cast<memAddress>(0x0100 + cpu.SP + 1)); cpu.SP++; cpu.totalCycles += 6; cpu.PC = static_cast<memAddress>(RecompiledWord(low, high) + 1); return; }
+}
+
+static void Block_D4FB(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D4FB  LDA #$55
+    RecompiledBegin(ctx, 0xD4FB); cpu.A = 0x55; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D4FD  STA $0678
+    RecompiledBegin(ctx, 0xD4FD); bus.write(0x0678, cpu.A); cpu.totalCycles += 4;
+    // D500  LDA #$FF
+    RecompiledBegin(ctx, 0xD500); cpu.A = 0xFF; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D502  STA $01
+    RecompiledBegin(ctx, 0xD502); bus.write(0x0001, cpu.A); cpu.totalCycles += 3;
+    // D504  BIT $01
+    RecompiledBegin(ctx, 0xD504); BitTest(cpu, bus.read(0x0001)); cpu.totalCycles += 3;
+    // D506  LDY #$11
+    RecompiledBegin(ctx, 0xD506); cpu.Y = 0x11; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // D508  LDX #$23
+    RecompiledBegin(ctx, 0xD508); cpu.X = 0x23; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // D50A  LDA #$00
+    RecompiledBegin(ctx, 0xD50A); cpu.A = 0x00; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D50C  LDA $0678
+    RecompiledBegin(ctx, 0xD50C); cpu.A = bus.read(0x0678); SetNZ(cpu, cpu.A); cpu.totalCycles += 4;
+    // D50F  BEQ $D521
+    RecompiledBegin(ctx, 0xD50F); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xD521; return; }
+    // D511  BMI $D521
+    RecompiledBegin(ctx, 0xD511); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xD521; return; }
+    // D513  CMP #$55
+    RecompiledBegin(ctx, 0xD513); Compare(cpu, cpu.A, 0x55); cpu.totalCycles += 2;
+    // D515  BNE $D521
+    RecompiledBegin(ctx, 0xD515); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xD521; return; }
+    // D517  CPY #$11
+    RecompiledBegin(ctx, 0xD517); Compare(cpu, cpu.Y, 0x11); cpu.totalCycles += 2;
+    // D519  BNE $D521
+    RecompiledBegin(ctx, 0xD519); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xD521; return; }
+    // D51B  CPX #$23
+    RecompiledBegin(ctx, 0xD51B); Compare(cpu, cpu.X, 0x23); cpu.totalCycles += 2;
+    // D51D  BVC $D521
+    RecompiledBegin(ctx, 0xD51D); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xD521; return; }
+    // D51F  BEQ $D525
+    RecompiledBegin(ctx, 0xD51F); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xD525; return; }
+    cpu.PC = 0xD521;
+}
+
+static void Block_D521(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D521  LDA #$B0
+    RecompiledBegin(ctx, 0xD521); cpu.A = 0xB0; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D523  STA $00
+    RecompiledBegin(ctx, 0xD523); bus.write(0x0000, cpu.A); cpu.totalCycles += 3;
+    cpu.PC = 0xD525;
+}
+
+static void Block_D525(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D525  LDA #$46
+    RecompiledBegin(ctx, 0xD525); cpu.A = 0x46; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D527  BIT $01
+    RecompiledBegin(ctx, 0xD527); BitTest(cpu, bus.read(0x0001)); cpu.totalCycles += 3;
+    // D529  STA $0678
+    RecompiledBegin(ctx, 0xD529); bus.write(0x0678, cpu.A); cpu.totalCycles += 4;
+    // D52C  BEQ $D539
+    RecompiledBegin(ctx, 0xD52C); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xD539; return; }
+    // D52E  BPL $D539
+    RecompiledBegin(ctx, 0xD52E); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xD539; return; }
+    // D530  BVC $D539
+    RecompiledBegin(ctx, 0xD530); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xD539; return; }
+    // D532  LDA $0678
+    RecompiledBegin(ctx, 0xD532); cpu.A = bus.read(0x0678); SetNZ(cpu, cpu.A); cpu.totalCycles += 4;
+    // D535  CMP #$46
+    RecompiledBegin(ctx, 0xD535); Compare(cpu, cpu.A, 0x46); cpu.totalCycles += 2;
+    // D537  BEQ $D53D
+    RecompiledBegin(ctx, 0xD537); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xD53D; return; }
+    cpu.PC = 0xD539;
+}
+
+static void Block_D539(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D539  LDA #$B1
+    RecompiledBegin(ctx, 0xD539); cpu.A = 0xB1; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D53B  STA $00
+    RecompiledBegin(ctx, 0xD53B); bus.write(0x0000, cpu.A); cpu.totalCycles += 3;
+    cpu.PC = 0xD53D;
+}
+
+static void Block_D53D(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D53D  LDA #$55
+    RecompiledBegin(ctx, 0xD53D); cpu.A = 0x55; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D53F  STA $0678
+    RecompiledBegin(ctx, 0xD53F); bus.write(0x0678, cpu.A); cpu.totalCycles += 4;
+    // D542  BIT $01
+    RecompiledBegin(ctx, 0xD542); BitTest(cpu, bus.read(0x0001)); cpu.totalCycles += 3;
+    // D544  LDA #$11
+    RecompiledBegin(ctx, 0xD544); cpu.A = 0x11; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D546  LDX #$23
+    RecompiledBegin(ctx, 0xD546); cpu.X = 0x23; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // D548  LDY #$00
+    RecompiledBegin(ctx, 0xD548); cpu.Y = 0x00; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // D54A  LDY $0678
+    RecompiledBegin(ctx, 0xD54A); cpu.Y = bus.read(0x0678); SetNZ(cpu, cpu.Y); cpu.totalCycles += 4;
+    // D54D  BEQ $D55F
+    RecompiledBegin(ctx, 0xD54D); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xD55F; return; }
+    // D54F  BMI $D55F
+    RecompiledBegin(ctx, 0xD54F); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xD55F; return; }
+    // D551  CPY #$55
+    RecompiledBegin(ctx, 0xD551); Compare(cpu, cpu.Y, 0x55); cpu.totalCycles += 2;
+    // D553  BNE $D55F
+    RecompiledBegin(ctx, 0xD553); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xD55F; return; }
+    // D555  CMP #$11
+    RecompiledBegin(ctx, 0xD555); Compare(cpu, cpu.A, 0x11); cpu.totalCycles += 2;
+    // D557  BNE $D55F
+    RecompiledBegin(ctx, 0xD557); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xD55F; return; }
+    // D559  CPX #$23
+    RecompiledBegin(ctx, 0xD559); Compare(cpu, cpu.X, 0x23); cpu.totalCycles += 2;
+    // D55B  BVC $D55F
+    RecompiledBegin(ctx, 0xD55B); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xD55F; return; }
+    // D55D  BEQ $D563
+    RecompiledBegin(ctx, 0xD55D); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xD563; return; }
+    cpu.PC = 0xD55F;
+}
+
+static void Block_D55F(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D55F  LDA #$B2
+    RecompiledBegin(ctx, 0xD55F); cpu.A = 0xB2; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D561  STA $00
+    RecompiledBegin(ctx, 0xD561); bus.write(0x0000, cpu.A); cpu.totalCycles += 3;
+    cpu.PC = 0xD563;
+}
+
+static void Block_D563(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D563  LDY #$46
+    RecompiledBegin(ctx, 0xD563); cpu.Y = 0x46; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // D565  BIT $01
+    RecompiledBegin(ctx, 0xD565); BitTest(cpu, bus.read(0x0001)); cpu.totalCycles += 3;
+    // D567  STY $0678
+    RecompiledBegin(ctx, 0xD567); bus.write(0x0678, cpu.Y); cpu.totalCycles += 4;
+    // D56A  BEQ $D577
+    RecompiledBegin(ctx, 0xD56A); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xD577; return; }
+    // D56C  BPL $D577
+    RecompiledBegin(ctx, 0xD56C); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xD577; return; }
+    // D56E  BVC $D577
+    RecompiledBegin(ctx, 0xD56E); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xD577; return; }
+    // D570  LDY $0678
+    RecompiledBegin(ctx, 0xD570); cpu.Y = bus.read(0x0678); SetNZ(cpu, cpu.Y); cpu.totalCycles += 4;
+    // D573  CPY #$46
+    RecompiledBegin(ctx, 0xD573); Compare(cpu, cpu.Y, 0x46); cpu.totalCycles += 2;
+    // D575  BEQ $D57B
+    RecompiledBegin(ctx, 0xD575); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xD57B; return; }
+    cpu.PC = 0xD577;
+}
+
+static void Block_D577(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D577  LDA #$B3
+    RecompiledBegin(ctx, 0xD577); cpu.A = 0xB3; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D579  STA $00
+    RecompiledBegin(ctx, 0xD579); bus.write(0x0000, cpu.A); cpu.totalCycles += 3;
+    cpu.PC = 0xD57B;
+}
+
+static void Block_D57B(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D57B  BIT $01
+    RecompiledBegin(ctx, 0xD57B); BitTest(cpu, bus.read(0x0001)); cpu.totalCycles += 3;
+    // D57D  LDA #$55
+    RecompiledBegin(ctx, 0xD57D); cpu.A = 0x55; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D57F  STA $0678
+    RecompiledBegin(ctx, 0xD57F); bus.write(0x0678, cpu.A); cpu.totalCycles += 4;
+    // D582  LDY #$11
+    RecompiledBegin(ctx, 0xD582); cpu.Y = 0x11; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // D584  LDA #$23
+    RecompiledBegin(ctx, 0xD584); cpu.A = 0x23; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D586  LDX #$00
+    RecompiledBegin(ctx, 0xD586); cpu.X = 0x00; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // D588  LDX $0678
+    RecompiledBegin(ctx, 0xD588); cpu.X = bus.read(0x0678); SetNZ(cpu, cpu.X); cpu.totalCycles += 4;
+    // D58B  BEQ $D59D
+    RecompiledBegin(ctx, 0xD58B); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xD59D; return; }
+    // D58D  BMI $D59D
+    RecompiledBegin(ctx, 0xD58D); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xD59D; return; }
+    // D58F  CPX #$55
+    RecompiledBegin(ctx, 0xD58F); Compare(cpu, cpu.X, 0x55); cpu.totalCycles += 2;
+    // D591  BNE $D59D
+    RecompiledBegin(ctx, 0xD591); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xD59D; return; }
+    // D593  CPY #$11
+    RecompiledBegin(ctx, 0xD593); Compare(cpu, cpu.Y, 0x11); cpu.totalCycles += 2;
+    // D595  BNE $D59D
+    RecompiledBegin(ctx, 0xD595); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xD59D; return; }
+    // D597  CMP #$23
+    RecompiledBegin(ctx, 0xD597); Compare(cpu, cpu.A, 0x23); cpu.totalCycles += 2;
+    // D599  BVC $D59D
+    RecompiledBegin(ctx, 0xD599); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xD59D; return; }
+    // D59B  BEQ $D5A1
+    RecompiledBegin(ctx, 0xD59B); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xD5A1; return; }
+    cpu.PC = 0xD59D;
+}
+
+static void Block_D59D(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D59D  LDA #$B4
+    RecompiledBegin(ctx, 0xD59D); cpu.A = 0xB4; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D59F  STA $00
+    RecompiledBegin(ctx, 0xD59F); bus.write(0x0000, cpu.A); cpu.totalCycles += 3;
+    cpu.PC = 0xD5A1;
+}
+
+static void Block_D5A1(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D5A1  LDX #$46
+    RecompiledBegin(ctx, 0xD5A1); cpu.X = 0x46; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // D5A3  BIT $01
+    RecompiledBegin(ctx, 0xD5A3); BitTest(cpu, bus.read(0x0001)); cpu.totalCycles += 3;
+    // D5A5  STX $0678
+    RecompiledBegin(ctx, 0xD5A5); bus.write(0x0678, cpu.X); cpu.totalCycles += 4;
+    // D5A8  BEQ $D5B5
+    RecompiledBegin(ctx, 0xD5A8); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xD5B5; return; }
+    // D5AA  BPL $D5B5
+    RecompiledBegin(ctx, 0xD5AA); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xD5B5; return; }
+    // D5AC  BVC $D5B5
+    RecompiledBegin(ctx, 0xD5AC); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xD5B5; return; }
+    // D5AE  LDX $0678
+    RecompiledBegin(ctx, 0xD5AE); cpu.X = bus.read(0x0678); SetNZ(cpu, cpu.X); cpu.totalCycles += 4;
+    // D5B1  CPX #$46
+    RecompiledBegin(ctx, 0xD5B1); Compare(cpu, cpu.X, 0x46); cpu.totalCycles += 2;
+    // D5B3  BEQ $D5B9
+    RecompiledBegin(ctx, 0xD5B3); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xD5B9; return; }
+    cpu.PC = 0xD5B5;
+}
+
+static void Block_D5B5(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D5B5  LDA #$B5
+    RecompiledBegin(ctx, 0xD5B5); cpu.A = 0xB5; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D5B7  STA $00
+    RecompiledBegin(ctx, 0xD5B7); bus.write(0x0000, cpu.A); cpu.totalCycles += 3;
+    cpu.PC = 0xD5B9;
+}
+
+static void Block_D5B9(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D5B9  LDA #$C0
+    RecompiledBegin(ctx, 0xD5B9); cpu.A = 0xC0; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D5BB  STA $0678
+    RecompiledBegin(ctx, 0xD5BB); bus.write(0x0678, cpu.A); cpu.totalCycles += 4;
+    // D5BE  LDX #$33
+    RecompiledBegin(ctx, 0xD5BE); cpu.X = 0x33; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // D5C0  LDY #$88
+    RecompiledBegin(ctx, 0xD5C0); cpu.Y = 0x88; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // D5C2  LDA #$05
+    RecompiledBegin(ctx, 0xD5C2); cpu.A = 0x05; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D5C4  BIT $0678
+    RecompiledBegin(ctx, 0xD5C4); BitTest(cpu, bus.read(0x0678)); cpu.totalCycles += 4;
+    // D5C7  BPL $D5D9
+    RecompiledBegin(ctx, 0xD5C7); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xD5D9; return; }
+    // D5C9  BVC $D5D9
+    RecompiledBegin(ctx, 0xD5C9); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xD5D9; return; }
+    // D5CB  BNE $D5D9
+    RecompiledBegin(ctx, 0xD5CB); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xD5D9; return; }
+    // D5CD  CMP #$05
+    RecompiledBegin(ctx, 0xD5CD); Compare(cpu, cpu.A, 0x05); cpu.totalCycles += 2;
+    // D5CF  BNE $D5D9
+    RecompiledBegin(ctx, 0xD5CF); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xD5D9; return; }
+    // D5D1  CPX #$33
+    RecompiledBegin(ctx, 0xD5D1); Compare(cpu, cpu.X, 0x33); cpu.totalCycles += 2;
+    // D5D3  BNE $D5D9
+    RecompiledBegin(ctx, 0xD5D3); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xD5D9; return; }
+    // D5D5  CPY #$88
+    RecompiledBegin(ctx, 0xD5D5); Compare(cpu, cpu.Y, 0x88); cpu.totalCycles += 2;
+    // D5D7  BEQ $D5DD
+    RecompiledBegin(ctx, 0xD5D7); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xD5DD; return; }
+    cpu.PC = 0xD5D9;
+}
+
+static void Block_D5D9(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D5D9  LDA #$B6
+    RecompiledBegin(ctx, 0xD5D9); cpu.A = 0xB6; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D5DB  STA $00
+    RecompiledBegin(ctx, 0xD5DB); bus.write(0x0000, cpu.A); cpu.totalCycles += 3;
+    cpu.PC = 0xD5DD;
+}
+
+static void Block_D5DD(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D5DD  LDA #$03
+    RecompiledBegin(ctx, 0xD5DD); cpu.A = 0x03; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D5DF  STA $0678
+    RecompiledBegin(ctx, 0xD5DF); bus.write(0x0678, cpu.A); cpu.totalCycles += 4;
+    // D5E2  LDA #$01
+    RecompiledBegin(ctx, 0xD5E2); cpu.A = 0x01; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D5E4  BIT $0678
+    RecompiledBegin(ctx, 0xD5E4); BitTest(cpu, bus.read(0x0678)); cpu.totalCycles += 4;
+    // D5E7  BMI $D5F1
+    RecompiledBegin(ctx, 0xD5E7); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xD5F1; return; }
+    // D5E9  BVS $D5F1
+    RecompiledBegin(ctx, 0xD5E9); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xD5F1; return; }
+    // D5EB  BEQ $D5F1
+    RecompiledBegin(ctx, 0xD5EB); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xD5F1; return; }
+    // D5ED  CMP #$01
+    RecompiledBegin(ctx, 0xD5ED); Compare(cpu, cpu.A, 0x01); cpu.totalCycles += 2;
+    // D5EF  BEQ $D5F5
+    RecompiledBegin(ctx, 0xD5EF); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xD5F5; return; }
+    cpu.PC = 0xD5F1;
+}
+
+static void Block_D5F1(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D5F1  LDA #$B7
+    RecompiledBegin(ctx, 0xD5F1); cpu.A = 0xB7; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D5F3  STA $00
+    RecompiledBegin(ctx, 0xD5F3); bus.write(0x0000, cpu.A); cpu.totalCycles += 3;
+    cpu.PC = 0xD5F5;
+}
+
+static void Block_D5F5(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D5F5  LDY #$B8
+    RecompiledBegin(ctx, 0xD5F5); cpu.Y = 0xB8; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // D5F7  LDA #$AA
+    RecompiledBegin(ctx, 0xD5F7); cpu.A = 0xAA; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D5F9  STA $0678
+    RecompiledBegin(ctx, 0xD5F9); bus.write(0x0678, cpu.A); cpu.totalCycles += 4;
+    // D5FC  JSR $F7B6
+    RecompiledBegin(ctx, 0xD5FC); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD5); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xFE); cpu.totalCycles += 6; cpu.PC = 0xF7B6; return;
+}
+
+static void Block_D5FF(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D5FF  ORA $0678
+    RecompiledBegin(ctx, 0xD5FF); cpu.A = static_cast<byte>(cpu.A | bus.read(0x0678)); SetNZ(cpu, cpu.A); cpu.totalCycles += 4;
+    // D602  JSR $F7C0
+    RecompiledBegin(ctx, 0xD602); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD6); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x04); cpu.totalCycles += 6; cpu.PC = 0xF7C0; return;
+}
+
+static void Block_D605(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D605  INY
+    RecompiledBegin(ctx, 0xD605); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // D606  LDA #$00
+    RecompiledBegin(ctx, 0xD606); cpu.A = 0x00; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D608  STA $0678
+    RecompiledBegin(ctx, 0xD608); bus.write(0x0678, cpu.A); cpu.totalCycles += 4;
+    // D60B  JSR $F7CE
+    RecompiledBegin(ctx, 0xD60B); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD6); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x0D); cpu.totalCycles += 6; cpu.PC = 0xF7CE; return;
+}
+
+static void Block_D60E(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D60E  ORA $0678
+    RecompiledBegin(ctx, 0xD60E); cpu.A = static_cast<byte>(cpu.A | bus.read(0x0678)); SetNZ(cpu, cpu.A); cpu.totalCycles += 4;
+    // D611  JSR $F7D3
+    RecompiledBegin(ctx, 0xD611); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD6); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x13); cpu.totalCycles += 6; cpu.PC = 0xF7D3; return;
+}
+
+static void Block_D614(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D614  INY
+    RecompiledBegin(ctx, 0xD614); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // D615  LDA #$AA
+    RecompiledBegin(ctx, 0xD615); cpu.A = 0xAA; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D617  STA $0678
+    RecompiledBegin(ctx, 0xD617); bus.write(0x0678, cpu.A); cpu.totalCycles += 4;
+    // D61A  JSR $F7DF
+    RecompiledBegin(ctx, 0xD61A); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD6); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x1C); cpu.totalCycles += 6; cpu.PC = 0xF7DF; return;
+}
+
+static void Block_D61D(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D61D  AND $0678
+    RecompiledBegin(ctx, 0xD61D); cpu.A = static_cast<byte>(cpu.A & bus.read(0x0678)); SetNZ(cpu, cpu.A); cpu.totalCycles += 4;
+    // D620  JSR $F7E5
+    RecompiledBegin(ctx, 0xD620); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD6); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x22); cpu.totalCycles += 6; cpu.PC = 0xF7E5; return;
+}
+
+static void Block_D623(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D623  INY
+    RecompiledBegin(ctx, 0xD623); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // D624  LDA #$EF
+    RecompiledBegin(ctx, 0xD624); cpu.A = 0xEF; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D626  STA $0678
+    RecompiledBegin(ctx, 0xD626); bus.write(0x0678, cpu.A); cpu.totalCycles += 4;
+    // D629  JSR $F7F1
+    RecompiledBegin(ctx, 0xD629); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD6); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x2B); cpu.totalCycles += 6; cpu.PC = 0xF7F1; return;
+}
+
+static void Block_D62C(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D62C  AND $0678
+    RecompiledBegin(ctx, 0xD62C); cpu.A = static_cast<byte>(cpu.A & bus.read(0x0678)); SetNZ(cpu, cpu.A); cpu.totalCycles += 4;
+    // D62F  JSR $F7F6
+    RecompiledBegin(ctx, 0xD62F); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD6); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x31); cpu.totalCycles += 6; cpu.PC = 0xF7F6; return;
+}
+
+static void Block_D632(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D632  INY
+    RecompiledBegin(ctx, 0xD632); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // D633  LDA #$AA
+    RecompiledBegin(ctx, 0xD633); cpu.A = 0xAA; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D635  STA $0678
+    RecompiledBegin(ctx, 0xD635); bus.write(0x0678, cpu.A); cpu.totalCycles += 4;
+    // D638  JSR $F804
+    RecompiledBegin(ctx, 0xD638); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD6); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x3A); cpu.totalCycles += 6; cpu.PC = 0xF804; return;
+}
+
+static void Block_D63B(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D63B  EOR $0678
+    RecompiledBegin(ctx, 0xD63B); cpu.A = static_cast<byte>(cpu.A ^ bus.read(0x0678)); SetNZ(cpu, cpu.A); cpu.totalCycles += 4;
+    // D63E  JSR $F80A
+    RecompiledBegin(ctx, 0xD63E); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD6); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x40); cpu.totalCycles += 6; cpu.PC = 0xF80A; return;
+}
+
+static void Block_D641(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D641  INY
+    RecompiledBegin(ctx, 0xD641); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // D642  LDA #$70
+    RecompiledBegin(ctx, 0xD642); cpu.A = 0x70; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D644  STA $0678
+    RecompiledBegin(ctx, 0xD644); bus.write(0x0678, cpu.A); cpu.totalCycles += 4;
+    // D647  JSR $F818
+    RecompiledBegin(ctx, 0xD647); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD6); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x49); cpu.totalCycles += 6; cpu.PC = 0xF818; return;
+}
+
+static void Block_D64A(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D64A  EOR $0678
+    RecompiledBegin(ctx, 0xD64A); cpu.A = static_cast<byte>(cpu.A ^ bus.read(0x0678)); SetNZ(cpu, cpu.A); cpu.totalCycles += 4;
+    // D64D  JSR $F81D
+    RecompiledBegin(ctx, 0xD64D); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD6); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x4F); cpu.totalCycles += 6; cpu.PC = 0xF81D; return;
+}
+
+static void Block_D650(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D650  INY
+    RecompiledBegin(ctx, 0xD650); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // D651  LDA #$69
+    RecompiledBegin(ctx, 0xD651); cpu.A = 0x69; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D653  STA $0678
+    RecompiledBegin(ctx, 0xD653); bus.write(0x0678, cpu.A); cpu.totalCycles += 4;
+    // D656  JSR $F829
+    RecompiledBegin(ctx, 0xD656); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD6); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x58); cpu.totalCycles += 6; cpu.PC = 0xF829; return;
+}
+
+static void Block_D659(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D659  ADC $0678
+    RecompiledBegin(ctx, 0xD659); AddBinary(cpu, bus.read(0x0678)); cpu.totalCycles += 4;
+    // D65C  JSR $F82F
+    RecompiledBegin(ctx, 0xD65C); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD6); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x5E); cpu.totalCycles += 6; cpu.PC = 0xF82F; return;
+}
+
+static void Block_D65F(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D65F  INY
+    RecompiledBegin(ctx, 0xD65F); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // D660  JSR $F83D
+    RecompiledBegin(ctx, 0xD660); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD6); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x62); cpu.totalCycles += 6; cpu.PC = 0xF83D; return;
+}
+
+static void Block_D663(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D663  ADC $0678
+    RecompiledBegin(ctx, 0xD663); AddBinary(cpu, bus.read(0x0678)); cpu.totalCycles += 4;
+    // D666  JSR $F843
+    RecompiledBegin(ctx, 0xD666); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD6); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x68); cpu.totalCycles += 6; cpu.PC = 0xF843; return;
+}
+
+static void Block_D669(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D669  INY
+    RecompiledBegin(ctx, 0xD669); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // D66A  LDA #$7F
+    RecompiledBegin(ctx, 0xD66A); cpu.A = 0x7F; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D66C  STA $0678
+    RecompiledBegin(ctx, 0xD66C); bus.write(0x0678, cpu.A); cpu.totalCycles += 4;
+    // D66F  JSR $F851
+    RecompiledBegin(ctx, 0xD66F); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD6); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x71); cpu.totalCycles += 6; cpu.PC = 0xF851; return;
+}
+
+static void Block_D672(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D672  ADC $0678
+    RecompiledBegin(ctx, 0xD672); AddBinary(cpu, bus.read(0x0678)); cpu.totalCycles += 4;
+    // D675  JSR $F856
+    RecompiledBegin(ctx, 0xD675); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD6); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x77); cpu.totalCycles += 6; cpu.PC = 0xF856; return;
+}
+
+static void Block_D678(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D678  INY
+    RecompiledBegin(ctx, 0xD678); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // D679  LDA #$80
+    RecompiledBegin(ctx, 0xD679); cpu.A = 0x80; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D67B  STA $0678
+    RecompiledBegin(ctx, 0xD67B); bus.write(0x0678, cpu.A); cpu.totalCycles += 4;
+    // D67E  JSR $F864
+    RecompiledBegin(ctx, 0xD67E); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD6); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x80); cpu.totalCycles += 6; cpu.PC = 0xF864; return;
+}
+
+static void Block_D681(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D681  ADC $0678
+    RecompiledBegin(ctx, 0xD681); AddBinary(cpu, bus.read(0x0678)); cpu.totalCycles += 4;
+    // D684  JSR $F86A
+    RecompiledBegin(ctx, 0xD684); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD6); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x86); cpu.totalCycles += 6; cpu.PC = 0xF86A; return;
+}
+
+static void Block_D687(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D687  INY
+    RecompiledBegin(ctx, 0xD687); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // D688  JSR $F878
+    RecompiledBegin(ctx, 0xD688); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD6); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x8A); cpu.totalCycles += 6; cpu.PC = 0xF878; return;
+}
+
+static void Block_D68B(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D68B  ADC $0678
+    RecompiledBegin(ctx, 0xD68B); AddBinary(cpu, bus.read(0x0678)); cpu.totalCycles += 4;
+    // D68E  JSR $F87D
+    RecompiledBegin(ctx, 0xD68E); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD6); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x90); cpu.totalCycles += 6; cpu.PC = 0xF87D; return;
+}
+
+static void Block_D691(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D691  INY
+    RecompiledBegin(ctx, 0xD691); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // D692  LDA #$40
+    RecompiledBegin(ctx, 0xD692); cpu.A = 0x40; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D694  STA $0678
+    RecompiledBegin(ctx, 0xD694); bus.write(0x0678, cpu.A); cpu.totalCycles += 4;
+    // D697  JSR $F889
+    RecompiledBegin(ctx, 0xD697); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD6); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x99); cpu.totalCycles += 6; cpu.PC = 0xF889; return;
+}
+
+static void Block_D69A(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D69A  CMP $0678
+    RecompiledBegin(ctx, 0xD69A); Compare(cpu, cpu.A, bus.read(0x0678)); cpu.totalCycles += 4;
+    // D69D  JSR $F88E
+    RecompiledBegin(ctx, 0xD69D); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD6); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x9F); cpu.totalCycles += 6; cpu.PC = 0xF88E; return;
+}
+
+static void Block_D6A0(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D6A0  INY
+    RecompiledBegin(ctx, 0xD6A0); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // D6A1  PHA
+    RecompiledBegin(ctx, 0xD6A1); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), cpu.A); cpu.totalCycles += 3;
+    // D6A2  LDA #$3F
+    RecompiledBegin(ctx, 0xD6A2); cpu.A = 0x3F; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D6A4  STA $0678
+    RecompiledBegin(ctx, 0xD6A4); bus.write(0x0678, cpu.A); cpu.totalCycles += 4;
+    // D6A7  PLA
+    RecompiledBegin(ctx, 0xD6A7); cpu.SP++; cpu.A = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); SetNZ(cpu, cpu.A); cpu.totalCycles += 4;
+    // D6A8  JSR $F89A
+    RecompiledBegin(ctx, 0xD6A8); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD6); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xAA); cpu.totalCycles += 6; cpu.PC = 0xF89A; return;
+}
+
+static void Block_D6AB(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D6AB  CMP $0678
+    RecompiledBegin(ctx, 0xD6AB); Compare(cpu, cpu.A, bus.read(0x0678)); cpu.totalCycles += 4;
+    // D6AE  JSR $F89C
+    RecompiledBegin(ctx, 0xD6AE); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD6); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xB0); cpu.totalCycles += 6; cpu.PC = 0xF89C; return;
+}
+
+static void Block_D6B1(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D6B1  INY
+    RecompiledBegin(ctx, 0xD6B1); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // D6B2  PHA
+    RecompiledBegin(ctx, 0xD6B2); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), cpu.A); cpu.totalCycles += 3;
+    // D6B3  LDA #$41
+    RecompiledBegin(ctx, 0xD6B3); cpu.A = 0x41; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D6B5  STA $0678
+    RecompiledBegin(ctx, 0xD6B5); bus.write(0x0678, cpu.A); cpu.totalCycles += 4;
+    // D6B8  PLA
+    RecompiledBegin(ctx, 0xD6B8); cpu.SP++; cpu.A = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); SetNZ(cpu, cpu.A); cpu.totalCycles += 4;
+    // D6B9  CMP $0678
+    RecompiledBegin(ctx, 0xD6B9); Compare(cpu, cpu.A, bus.read(0x0678)); cpu.totalCycles += 4;
+    // D6BC  JSR $F8A8
+    RecompiledBegin(ctx, 0xD6BC); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD6); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xBE); cpu.totalCycles += 6; cpu.PC = 0xF8A8; return;
+}
+
+static void Block_D6BF(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D6BF  INY
+    RecompiledBegin(ctx, 0xD6BF); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // D6C0  PHA
+    RecompiledBegin(ctx, 0xD6C0); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), cpu.A); cpu.totalCycles += 3;
+    // D6C1  LDA #$00
+    RecompiledBegin(ctx, 0xD6C1); cpu.A = 0x00; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D6C3  STA $0678
+    RecompiledBegin(ctx, 0xD6C3); bus.write(0x0678, cpu.A); cpu.totalCycles += 4;
+    // D6C6  PLA
+    RecompiledBegin(ctx, 0xD6C6); cpu.SP++; cpu.A = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); SetNZ(cpu, cpu.A); cpu.totalCycles += 4;
+    // D6C7  JSR $F8B2
+    RecompiledBegin(ctx, 0xD6C7); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD6); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xC9); cpu.totalCycles += 6; cpu.PC = 0xF8B2; return;
+}
+
+static void Block_D6CA(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D6CA  CMP $0678
+    RecompiledBegin(ctx, 0xD6CA); Compare(cpu, cpu.A, bus.read(0x0678)); cpu.totalCycles += 4;
+    // D6CD  JSR $F8B5
+    RecompiledBegin(ctx, 0xD6CD); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD6); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xCF); cpu.totalCycles += 6; cpu.PC = 0xF8B5; return;
+}
+
+static void Block_D6D0(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D6D0  INY
+    RecompiledBegin(ctx, 0xD6D0); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // D6D1  PHA
+    RecompiledBegin(ctx, 0xD6D1); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), cpu.A); cpu.totalCycles += 3;
+    // D6D2  LDA #$80
+    RecompiledBegin(ctx, 0xD6D2); cpu.A = 0x80; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D6D4  STA $0678
+    RecompiledBegin(ctx, 0xD6D4); bus.write(0x0678, cpu.A); cpu.totalCycles += 4;
+    // D6D7  PLA
+    RecompiledBegin(ctx, 0xD6D7); cpu.SP++; cpu.A = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); SetNZ(cpu, cpu.A); cpu.totalCycles += 4;
+    // D6D8  CMP $0678
+    RecompiledBegin(ctx, 0xD6D8); Compare(cpu, cpu.A, bus.read(0x0678)); cpu.totalCycles += 4;
+    // D6DB  JSR $F8BF
+    RecompiledBegin(ctx, 0xD6DB); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD6); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xDD); cpu.totalCycles += 6; cpu.PC = 0xF8BF; return;
+}
+
+static void Block_D6DE(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D6DE  INY
+    RecompiledBegin(ctx, 0xD6DE); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // D6DF  PHA
+    RecompiledBegin(ctx, 0xD6DF); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), cpu.A); cpu.totalCycles += 3;
+    // D6E0  LDA #$81
+    RecompiledBegin(ctx, 0xD6E0); cpu.A = 0x81; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D6E2  STA $0678
+    RecompiledBegin(ctx, 0xD6E2); bus.write(0x0678, cpu.A); cpu.totalCycles += 4;
+    // D6E5  PLA
+    RecompiledBegin(ctx, 0xD6E5); cpu.SP++; cpu.A = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); SetNZ(cpu, cpu.A); cpu.totalCycles += 4;
+    // D6E6  CMP $0678
+    RecompiledBegin(ctx, 0xD6E6); Compare(cpu, cpu.A, bus.read(0x0678)); cpu.totalCycles += 4;
+    // D6E9  JSR $F8C9
+    RecompiledBegin(ctx, 0xD6E9); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD6); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xEB); cpu.totalCycles += 6; cpu.PC = 0xF8C9; return;
+}
+
+static void Block_D6EC(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D6EC  INY
+    RecompiledBegin(ctx, 0xD6EC); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // D6ED  PHA
+    RecompiledBegin(ctx, 0xD6ED); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), cpu.A); cpu.totalCycles += 3;
+    // D6EE  LDA #$7F
+    RecompiledBegin(ctx, 0xD6EE); cpu.A = 0x7F; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D6F0  STA $0678
+    RecompiledBegin(ctx, 0xD6F0); bus.write(0x0678, cpu.A); cpu.totalCycles += 4;
+    // D6F3  PLA
+    RecompiledBegin(ctx, 0xD6F3); cpu.SP++; cpu.A = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); SetNZ(cpu, cpu.A); cpu.totalCycles += 4;
+    // D6F4  CMP $0678
+    RecompiledBegin(ctx, 0xD6F4); Compare(cpu, cpu.A, bus.read(0x0678)); cpu.totalCycles += 4;
+    // D6F7  JSR $F8D3
+    RecompiledBegin(ctx, 0xD6F7); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD6); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xF9); cpu.totalCycles += 6; cpu.PC = 0xF8D3; return;
+}
+
+static void Block_D6FA(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D6FA  INY
+    RecompiledBegin(ctx, 0xD6FA); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // D6FB  LDA #$40
+    RecompiledBegin(ctx, 0xD6FB); cpu.A = 0x40; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D6FD  STA $0678
+    RecompiledBegin(ctx, 0xD6FD); bus.write(0x0678, cpu.A); cpu.totalCycles += 4;
+    // D700  JSR $F931
+    RecompiledBegin(ctx, 0xD700); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD7); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x02); cpu.totalCycles += 6; cpu.PC = 0xF931; return;
+}
+
+static void Block_D703(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D703  SBC $0678
+    RecompiledBegin(ctx, 0xD703); SubtractBinary(cpu, bus.read(0x0678)); cpu.totalCycles += 4;
+    // D706  JSR $F937
+    RecompiledBegin(ctx, 0xD706); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD7); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x08); cpu.totalCycles += 6; cpu.PC = 0xF937; return;
+}
+
+static void Block_D709(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D709  INY
+    RecompiledBegin(ctx, 0xD709); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // D70A  LDA #$3F
+    RecompiledBegin(ctx, 0xD70A); cpu.A = 0x3F; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D70C  STA $0678
+    RecompiledBegin(ctx, 0xD70C); bus.write(0x0678, cpu.A); cpu.totalCycles += 4;
+    // D70F  JSR $F947
+    RecompiledBegin(ctx, 0xD70F); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD7); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x11); cpu.totalCycles += 6; cpu.PC = 0xF947; return;
+}
+
+static void Block_D712(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D712  SBC $0678
+    RecompiledBegin(ctx, 0xD712); SubtractBinary(cpu, bus.read(0x0678)); cpu.totalCycles += 4;
+    // D715  JSR $F94C
+    RecompiledBegin(ctx, 0xD715); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD7); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x17); cpu.totalCycles += 6; cpu.PC = 0xF94C; return;
+}
+
+static void Block_D718(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D718  INY
+    RecompiledBegin(ctx, 0xD718); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // D719  LDA #$41
+    RecompiledBegin(ctx, 0xD719); cpu.A = 0x41; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D71B  STA $0678
+    RecompiledBegin(ctx, 0xD71B); bus.write(0x0678, cpu.A); cpu.totalCycles += 4;
+    // D71E  JSR $F95C
+    RecompiledBegin(ctx, 0xD71E); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD7); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x20); cpu.totalCycles += 6; cpu.PC = 0xF95C; return;
+}
+
+static void Block_D721(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D721  SBC $0678
+    RecompiledBegin(ctx, 0xD721); SubtractBinary(cpu, bus.read(0x0678)); cpu.totalCycles += 4;
+    // D724  JSR $F962
+    RecompiledBegin(ctx, 0xD724); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD7); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x26); cpu.totalCycles += 6; cpu.PC = 0xF962; return;
+}
+
+static void Block_D727(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D727  INY
+    RecompiledBegin(ctx, 0xD727); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // D728  LDA #$00
+    RecompiledBegin(ctx, 0xD728); cpu.A = 0x00; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D72A  STA $0678
+    RecompiledBegin(ctx, 0xD72A); bus.write(0x0678, cpu.A); cpu.totalCycles += 4;
+    // D72D  JSR $F972
+    RecompiledBegin(ctx, 0xD72D); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD7); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x2F); cpu.totalCycles += 6; cpu.PC = 0xF972; return;
+}
+
+static void Block_D730(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D730  SBC $0678
+    RecompiledBegin(ctx, 0xD730); SubtractBinary(cpu, bus.read(0x0678)); cpu.totalCycles += 4;
+    // D733  JSR $F976
+    RecompiledBegin(ctx, 0xD733); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD7); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x35); cpu.totalCycles += 6; cpu.PC = 0xF976; return;
+}
+
+static void Block_D736(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D736  INY
+    RecompiledBegin(ctx, 0xD736); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // D737  LDA #$7F
+    RecompiledBegin(ctx, 0xD737); cpu.A = 0x7F; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D739  STA $0678
+    RecompiledBegin(ctx, 0xD739); bus.write(0x0678, cpu.A); cpu.totalCycles += 4;
+    // D73C  JSR $F980
+    RecompiledBegin(ctx, 0xD73C); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD7); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x3E); cpu.totalCycles += 6; cpu.PC = 0xF980; return;
+}
+
+static void Block_D73F(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D73F  SBC $0678
+    RecompiledBegin(ctx, 0xD73F); SubtractBinary(cpu, bus.read(0x0678)); cpu.totalCycles += 4;
+    // D742  JSR $F984
+    RecompiledBegin(ctx, 0xD742); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD7); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x44); cpu.totalCycles += 6; cpu.PC = 0xF984; return;
+}
+
+static void Block_D745(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D745  INY
+    RecompiledBegin(ctx, 0xD745); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // D746  LDA #$40
+    RecompiledBegin(ctx, 0xD746); cpu.A = 0x40; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D748  STA $0678
+    RecompiledBegin(ctx, 0xD748); bus.write(0x0678, cpu.A); cpu.totalCycles += 4;
+    // D74B  JSR $F889
+    RecompiledBegin(ctx, 0xD74B); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD7); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x4D); cpu.totalCycles += 6; cpu.PC = 0xF889; return;
+}
+
+static void Block_D74E(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D74E  TAX
+    RecompiledBegin(ctx, 0xD74E); cpu.X = cpu.A; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // D74F  CPX $0678
+    RecompiledBegin(ctx, 0xD74F); Compare(cpu, cpu.X, bus.read(0x0678)); cpu.totalCycles += 4;
+    // D752  JSR $F88E
+    RecompiledBegin(ctx, 0xD752); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD7); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x54); cpu.totalCycles += 6; cpu.PC = 0xF88E; return;
+}
+
+static void Block_D755(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D755  INY
+    RecompiledBegin(ctx, 0xD755); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // D756  LDA #$3F
+    RecompiledBegin(ctx, 0xD756); cpu.A = 0x3F; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D758  STA $0678
+    RecompiledBegin(ctx, 0xD758); bus.write(0x0678, cpu.A); cpu.totalCycles += 4;
+    // D75B  JSR $F89A
+    RecompiledBegin(ctx, 0xD75B); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD7); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x5D); cpu.totalCycles += 6; cpu.PC = 0xF89A; return;
+}
+
+static void Block_D75E(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D75E  CPX $0678
+    RecompiledBegin(ctx, 0xD75E); Compare(cpu, cpu.X, bus.read(0x0678)); cpu.totalCycles += 4;
+    // D761  JSR $F89C
+    RecompiledBegin(ctx, 0xD761); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD7); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x63); cpu.totalCycles += 6; cpu.PC = 0xF89C; return;
+}
+
+static void Block_D764(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D764  INY
+    RecompiledBegin(ctx, 0xD764); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // D765  LDA #$41
+    RecompiledBegin(ctx, 0xD765); cpu.A = 0x41; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D767  STA $0678
+    RecompiledBegin(ctx, 0xD767); bus.write(0x0678, cpu.A); cpu.totalCycles += 4;
+    // D76A  CPX $0678
+    RecompiledBegin(ctx, 0xD76A); Compare(cpu, cpu.X, bus.read(0x0678)); cpu.totalCycles += 4;
+    // D76D  JSR $F8A8
+    RecompiledBegin(ctx, 0xD76D); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD7); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x6F); cpu.totalCycles += 6; cpu.PC = 0xF8A8; return;
+}
+
+static void Block_D770(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D770  INY
+    RecompiledBegin(ctx, 0xD770); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // D771  LDA #$00
+    RecompiledBegin(ctx, 0xD771); cpu.A = 0x00; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D773  STA $0678
+    RecompiledBegin(ctx, 0xD773); bus.write(0x0678, cpu.A); cpu.totalCycles += 4;
+    // D776  JSR $F8B2
+    RecompiledBegin(ctx, 0xD776); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD7); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x78); cpu.totalCycles += 6; cpu.PC = 0xF8B2; return;
+}
+
+static void Block_D779(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D779  TAX
+    RecompiledBegin(ctx, 0xD779); cpu.X = cpu.A; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // D77A  CPX $0678
+    RecompiledBegin(ctx, 0xD77A); Compare(cpu, cpu.X, bus.read(0x0678)); cpu.totalCycles += 4;
+    // D77D  JSR $F8B5
+    RecompiledBegin(ctx, 0xD77D); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD7); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x7F); cpu.totalCycles += 6; cpu.PC = 0xF8B5; return;
+}
+
+static void Block_D780(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D780  INY
+    RecompiledBegin(ctx, 0xD780); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // D781  LDA #$80
+    RecompiledBegin(ctx, 0xD781); cpu.A = 0x80; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D783  STA $0678
+    RecompiledBegin(ctx, 0xD783); bus.write(0x0678, cpu.A); cpu.totalCycles += 4;
+    // D786  CPX $0678
+    RecompiledBegin(ctx, 0xD786); Compare(cpu, cpu.X, bus.read(0x0678)); cpu.totalCycles += 4;
+    // D789  JSR $F8BF
+    RecompiledBegin(ctx, 0xD789); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD7); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x8B); cpu.totalCycles += 6; cpu.PC = 0xF8BF; return;
+}
+
+static void Block_D78C(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D78C  INY
+    RecompiledBegin(ctx, 0xD78C); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // D78D  LDA #$81
+    RecompiledBegin(ctx, 0xD78D); cpu.A = 0x81; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D78F  STA $0678
+    RecompiledBegin(ctx, 0xD78F); bus.write(0x0678, cpu.A); cpu.totalCycles += 4;
+    // D792  CPX $0678
+    RecompiledBegin(ctx, 0xD792); Compare(cpu, cpu.X, bus.read(0x0678)); cpu.totalCycles += 4;
+    // D795  JSR $F8C9
+    RecompiledBegin(ctx, 0xD795); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD7); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x97); cpu.totalCycles += 6; cpu.PC = 0xF8C9; return;
+}
+
+static void Block_D798(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D798  INY
+    RecompiledBegin(ctx, 0xD798); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // D799  LDA #$7F
+    RecompiledBegin(ctx, 0xD799); cpu.A = 0x7F; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D79B  STA $0678
+    RecompiledBegin(ctx, 0xD79B); bus.write(0x0678, cpu.A); cpu.totalCycles += 4;
+    // D79E  CPX $0678
+    RecompiledBegin(ctx, 0xD79E); Compare(cpu, cpu.X, bus.read(0x0678)); cpu.totalCycles += 4;
+    // D7A1  JSR $F8D3
+    RecompiledBegin(ctx, 0xD7A1); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD7); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xA3); cpu.totalCycles += 6; cpu.PC = 0xF8D3; return;
+}
+
+static void Block_D7A4(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D7A4  INY
+    RecompiledBegin(ctx, 0xD7A4); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // D7A5  TYA
+    RecompiledBegin(ctx, 0xD7A5); cpu.A = cpu.Y; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D7A6  TAX
+    RecompiledBegin(ctx, 0xD7A6); cpu.X = cpu.A; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // D7A7  LDA #$40
+    RecompiledBegin(ctx, 0xD7A7); cpu.A = 0x40; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D7A9  STA $0678
+    RecompiledBegin(ctx, 0xD7A9); bus.write(0x0678, cpu.A); cpu.totalCycles += 4;
+    // D7AC  JSR $F8DD
+    RecompiledBegin(ctx, 0xD7AC); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD7); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xAE); cpu.totalCycles += 6; cpu.PC = 0xF8DD; return;
+}
+
+static void Block_D7AF(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D7AF  CPY $0678
+    RecompiledBegin(ctx, 0xD7AF); Compare(cpu, cpu.Y, bus.read(0x0678)); cpu.totalCycles += 4;
+    // D7B2  JSR $F8E2
+    RecompiledBegin(ctx, 0xD7B2); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD7); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xB4); cpu.totalCycles += 6; cpu.PC = 0xF8E2; return;
+}
+
+static void Block_D7B5(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D7B5  INX
+    RecompiledBegin(ctx, 0xD7B5); cpu.X++; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // D7B6  LDA #$3F
+    RecompiledBegin(ctx, 0xD7B6); cpu.A = 0x3F; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D7B8  STA $0678
+    RecompiledBegin(ctx, 0xD7B8); bus.write(0x0678, cpu.A); cpu.totalCycles += 4;
+    // D7BB  JSR $F8EE
+    RecompiledBegin(ctx, 0xD7BB); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD7); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xBD); cpu.totalCycles += 6; cpu.PC = 0xF8EE; return;
+}
+
+static void Block_D7BE(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D7BE  CPY $0678
+    RecompiledBegin(ctx, 0xD7BE); Compare(cpu, cpu.Y, bus.read(0x0678)); cpu.totalCycles += 4;
+    // D7C1  JSR $F8F0
+    RecompiledBegin(ctx, 0xD7C1); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD7); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xC3); cpu.totalCycles += 6; cpu.PC = 0xF8F0; return;
+}
+
+static void Block_D7C4(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D7C4  INX
+    RecompiledBegin(ctx, 0xD7C4); cpu.X++; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // D7C5  LDA #$41
+    RecompiledBegin(ctx, 0xD7C5); cpu.A = 0x41; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D7C7  STA $0678
+    RecompiledBegin(ctx, 0xD7C7); bus.write(0x0678, cpu.A); cpu.totalCycles += 4;
+    // D7CA  CPY $0678
+    RecompiledBegin(ctx, 0xD7CA); Compare(cpu, cpu.Y, bus.read(0x0678)); cpu.totalCycles += 4;
+    // D7CD  JSR $F8FC
+    RecompiledBegin(ctx, 0xD7CD); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD7); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xCF); cpu.totalCycles += 6; cpu.PC = 0xF8FC; return;
+}
+
+static void Block_D7D0(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D7D0  INX
+    RecompiledBegin(ctx, 0xD7D0); cpu.X++; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // D7D1  LDA #$00
+    RecompiledBegin(ctx, 0xD7D1); cpu.A = 0x00; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D7D3  STA $0678
+    RecompiledBegin(ctx, 0xD7D3); bus.write(0x0678, cpu.A); cpu.totalCycles += 4;
+    // D7D6  JSR $F906
+    RecompiledBegin(ctx, 0xD7D6); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD7); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD8); cpu.totalCycles += 6; cpu.PC = 0xF906; return;
+}
+
+static void Block_D7D9(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D7D9  CPY $0678
+    RecompiledBegin(ctx, 0xD7D9); Compare(cpu, cpu.Y, bus.read(0x0678)); cpu.totalCycles += 4;
+    // D7DC  JSR $F909
+    RecompiledBegin(ctx, 0xD7DC); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD7); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xDE); cpu.totalCycles += 6; cpu.PC = 0xF909; return;
+}
+
+static void Block_D7DF(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D7DF  INX
+    RecompiledBegin(ctx, 0xD7DF); cpu.X++; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // D7E0  LDA #$80
+    RecompiledBegin(ctx, 0xD7E0); cpu.A = 0x80; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D7E2  STA $0678
+    RecompiledBegin(ctx, 0xD7E2); bus.write(0x0678, cpu.A); cpu.totalCycles += 4;
+    // D7E5  CPY $0678
+    RecompiledBegin(ctx, 0xD7E5); Compare(cpu, cpu.Y, bus.read(0x0678)); cpu.totalCycles += 4;
+    // D7E8  JSR $F913
+    RecompiledBegin(ctx, 0xD7E8); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD7); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xEA); cpu.totalCycles += 6; cpu.PC = 0xF913; return;
+}
+
+static void Block_D7EB(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D7EB  INX
+    RecompiledBegin(ctx, 0xD7EB); cpu.X++; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // D7EC  LDA #$81
+    RecompiledBegin(ctx, 0xD7EC); cpu.A = 0x81; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D7EE  STA $0678
+    RecompiledBegin(ctx, 0xD7EE); bus.write(0x0678, cpu.A); cpu.totalCycles += 4;
+    // D7F1  CPY $0678
+    RecompiledBegin(ctx, 0xD7F1); Compare(cpu, cpu.Y, bus.read(0x0678)); cpu.totalCycles += 4;
+    // D7F4  JSR $F91D
+    RecompiledBegin(ctx, 0xD7F4); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD7); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xF6); cpu.totalCycles += 6; cpu.PC = 0xF91D; return;
+}
+
+static void Block_D7F7(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D7F7  INX
+    RecompiledBegin(ctx, 0xD7F7); cpu.X++; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // D7F8  LDA #$7F
+    RecompiledBegin(ctx, 0xD7F8); cpu.A = 0x7F; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D7FA  STA $0678
+    RecompiledBegin(ctx, 0xD7FA); bus.write(0x0678, cpu.A); cpu.totalCycles += 4;
+    // D7FD  CPY $0678
+    RecompiledBegin(ctx, 0xD7FD); Compare(cpu, cpu.Y, bus.read(0x0678)); cpu.totalCycles += 4;
+    // D800  JSR $F927
+    RecompiledBegin(ctx, 0xD800); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD8); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x02); cpu.totalCycles += 6; cpu.PC = 0xF927; return;
+}
+
+static void Block_D803(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D803  INX
+    RecompiledBegin(ctx, 0xD803); cpu.X++; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // D804  TXA
+    RecompiledBegin(ctx, 0xD804); cpu.A = cpu.X; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D805  TAY
+    RecompiledBegin(ctx, 0xD805); cpu.Y = cpu.A; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // D806  JSR $F990
+    RecompiledBegin(ctx, 0xD806); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD8); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x08); cpu.totalCycles += 6; cpu.PC = 0xF990; return;
+}
+
+static void Block_D809(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D809  STA $0678
+    RecompiledBegin(ctx, 0xD809); bus.write(0x0678, cpu.A); cpu.totalCycles += 4;
+    // D80C  LSR $0678
+    RecompiledBegin(ctx, 0xD80C); bus.write(0x0678, ShiftRight(cpu, bus.read(0x0678))); cpu.totalCycles += 6;
+    // D80F  LDA $0678
+    RecompiledBegin(ctx, 0xD80F); cpu.A = bus.read(0x0678); SetNZ(cpu, cpu.A); cpu.totalCycles += 4;
+    // D812  JSR $F99D
+    RecompiledBegin(ctx, 0xD812); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD8); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x14); cpu.totalCycles += 6; cpu.PC = 0xF99D; return;
+}
+
+static void Block_D815(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D815  INY
+    RecompiledBegin(ctx, 0xD815); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // D816  STA $0678
+    RecompiledBegin(ctx, 0xD816); bus.write(0x0678, cpu.A); cpu.totalCycles += 4;
+    // D819  LSR $0678
+    RecompiledBegin(ctx, 0xD819); bus.write(0x0678, ShiftRight(cpu, bus.read(0x0678))); cpu.totalCycles += 6;
+    // D81C  LDA $0678
+    RecompiledBegin(ctx, 0xD81C); cpu.A = bus.read(0x0678); SetNZ(cpu, cpu.A); cpu.totalCycles += 4;
+    // D81F  JSR $F9AD
+    RecompiledBegin(ctx, 0xD81F); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD8); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x21); cpu.totalCycles += 6; cpu.PC = 0xF9AD; return;
+}
+
+static void Block_D822(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D822  INY
+    RecompiledBegin(ctx, 0xD822); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // D823  JSR $F9BD
+    RecompiledBegin(ctx, 0xD823); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD8); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x25); cpu.totalCycles += 6; cpu.PC = 0xF9BD; return;
+}
+
+static void Block_D826(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D826  STA $0678
+    RecompiledBegin(ctx, 0xD826); bus.write(0x0678, cpu.A); cpu.totalCycles += 4;
+    // D829  ASL $0678
+    RecompiledBegin(ctx, 0xD829); bus.write(0x0678, ShiftLeft(cpu, bus.read(0x0678))); cpu.totalCycles += 6;
+    // D82C  LDA $0678
+    RecompiledBegin(ctx, 0xD82C); cpu.A = bus.read(0x0678); SetNZ(cpu, cpu.A); cpu.totalCycles += 4;
+    // D82F  JSR $F9C3
+    RecompiledBegin(ctx, 0xD82F); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD8); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x31); cpu.totalCycles += 6; cpu.PC = 0xF9C3; return;
+}
+
+static void Block_D832(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D832  INY
+    RecompiledBegin(ctx, 0xD832); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // D833  STA $0678
+    RecompiledBegin(ctx, 0xD833); bus.write(0x0678, cpu.A); cpu.totalCycles += 4;
+    // D836  ASL $0678
+    RecompiledBegin(ctx, 0xD836); bus.write(0x0678, ShiftLeft(cpu, bus.read(0x0678))); cpu.totalCycles += 6;
+    // D839  LDA $0678
+    RecompiledBegin(ctx, 0xD839); cpu.A = bus.read(0x0678); SetNZ(cpu, cpu.A); cpu.totalCycles += 4;
+    // D83C  JSR $F9D4
+    RecompiledBegin(ctx, 0xD83C); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD8); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x3E); cpu.totalCycles += 6; cpu.PC = 0xF9D4; return;
+}
+
+static void Block_D83F(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D83F  INY
+    RecompiledBegin(ctx, 0xD83F); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // D840  JSR $F9E4
+    RecompiledBegin(ctx, 0xD840); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD8); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x42); cpu.totalCycles += 6; cpu.PC = 0xF9E4; return;
+}
+
+static void Block_D843(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D843  STA $0678
+    RecompiledBegin(ctx, 0xD843); bus.write(0x0678, cpu.A); cpu.totalCycles += 4;
+    // D846  ROR $0678
+    RecompiledBegin(ctx, 0xD846); bus.write(0x0678, RotateRight(cpu, bus.read(0x0678))); cpu.totalCycles += 6;
+    // D849  LDA $0678
+    RecompiledBegin(ctx, 0xD849); cpu.A = bus.read(0x0678); SetNZ(cpu, cpu.A); cpu.totalCycles += 4;
+    // D84C  JSR $F9EA
+    RecompiledBegin(ctx, 0xD84C); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD8); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x4E); cpu.totalCycles += 6; cpu.PC = 0xF9EA; return;
+}
+
+static void Block_D84F(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D84F  INY
+    RecompiledBegin(ctx, 0xD84F); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // D850  STA $0678
+    RecompiledBegin(ctx, 0xD850); bus.write(0x0678, cpu.A); cpu.totalCycles += 4;
+    // D853  ROR $0678
+    RecompiledBegin(ctx, 0xD853); bus.write(0x0678, RotateRight(cpu, bus.read(0x0678))); cpu.totalCycles += 6;
+    // D856  LDA $0678
+    RecompiledBegin(ctx, 0xD856); cpu.A = bus.read(0x0678); SetNZ(cpu, cpu.A); cpu.totalCycles += 4;
+    // D859  JSR $F9FB
+    RecompiledBegin(ctx, 0xD859); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD8); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x5B); cpu.totalCycles += 6; cpu.PC = 0xF9FB; return;
+}
+
+static void Block_D85C(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D85C  INY
+    RecompiledBegin(ctx, 0xD85C); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // D85D  JSR $FA0A
+    RecompiledBegin(ctx, 0xD85D); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD8); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x5F); cpu.totalCycles += 6; cpu.PC = 0xFA0A; return;
+}
+
+static void Block_D860(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D860  STA $0678
+    RecompiledBegin(ctx, 0xD860); bus.write(0x0678, cpu.A); cpu.totalCycles += 4;
+    // D863  ROL $0678
+    RecompiledBegin(ctx, 0xD863); bus.write(0x0678, RotateLeft(cpu, bus.read(0x0678))); cpu.totalCycles += 6;
+    // D866  LDA $0678
+    RecompiledBegin(ctx, 0xD866); cpu.A = bus.read(0x0678); SetNZ(cpu, cpu.A); cpu.totalCycles += 4;
+    // D869  JSR $FA10
+    RecompiledBegin(ctx, 0xD869); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD8); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x6B); cpu.totalCycles += 6; cpu.PC = 0xFA10; return;
+}
+
+static void Block_D86C(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D86C  INY
+    RecompiledBegin(ctx, 0xD86C); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // D86D  STA $0678
+    RecompiledBegin(ctx, 0xD86D); bus.write(0x0678, cpu.A); cpu.totalCycles += 4;
+    // D870  ROL $0678
+    RecompiledBegin(ctx, 0xD870); bus.write(0x0678, RotateLeft(cpu, bus.read(0x0678))); cpu.totalCycles += 6;
+    // D873  LDA $0678
+    RecompiledBegin(ctx, 0xD873); cpu.A = bus.read(0x0678); SetNZ(cpu, cpu.A); cpu.totalCycles += 4;
+    // D876  JSR $FA21
+    RecompiledBegin(ctx, 0xD876); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD8); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x78); cpu.totalCycles += 6; cpu.PC = 0xFA21; return;
+}
+
+static void Block_D879(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D879  LDA #$FF
+    RecompiledBegin(ctx, 0xD879); cpu.A = 0xFF; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D87B  STA $0678
+    RecompiledBegin(ctx, 0xD87B); bus.write(0x0678, cpu.A); cpu.totalCycles += 4;
+    // D87E  STA $01
+    RecompiledBegin(ctx, 0xD87E); bus.write(0x0001, cpu.A); cpu.totalCycles += 3;
+    // D880  BIT $01
+    RecompiledBegin(ctx, 0xD880); BitTest(cpu, bus.read(0x0001)); cpu.totalCycles += 3;
+    // D882  SEC
+    RecompiledBegin(ctx, 0xD882); SetFlag(cpu, Flags::C, true); cpu.totalCycles += 2;
+    // D883  INC $0678
+    { RecompiledBegin(ctx, 0xD883); const byte result = static_cast<byte>(bus.read(0x0678) + 1); bus.write(0x0678, result); SetNZ(cpu, result); cpu.totalCycles += 6; }
+    // D886  BNE $D895
+    RecompiledBegin(ctx, 0xD886); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xD895; return; }
+    // D888  BMI $D895
+    RecompiledBegin(ctx, 0xD888); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xD895; return; }
+    // D88A  BVC $D895
+    RecompiledBegin(ctx, 0xD88A); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xD895; return; }
+    // D88C  BCC $D895
+    RecompiledBegin(ctx, 0xD88C); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xD895; return; }
+    // D88E  LDA $0678
+    RecompiledBegin(ctx, 0xD88E); cpu.A = bus.read(0x0678); SetNZ(cpu, cpu.A); cpu.totalCycles += 4;
+    // D891  CMP #$00
+    RecompiledBegin(ctx, 0xD891); Compare(cpu, cpu.A, 0x00); cpu.totalCycles += 2;
+    // D893  BEQ $D899
+    RecompiledBegin(ctx, 0xD893); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xD899; return; }
+    cpu.PC = 0xD895;
+}
+
+static void Block_D895(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D895  LDA #$E5
+    RecompiledBegin(ctx, 0xD895); cpu.A = 0xE5; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D897  STA $00
+    RecompiledBegin(ctx, 0xD897); bus.write(0x0000, cpu.A); cpu.totalCycles += 3;
+    cpu.PC = 0xD899;
+}
+
+static void Block_D899(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D899  LDA #$7F
+    RecompiledBegin(ctx, 0xD899); cpu.A = 0x7F; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D89B  STA $0678
+    RecompiledBegin(ctx, 0xD89B); bus.write(0x0678, cpu.A); cpu.totalCycles += 4;
+    // D89E  CLV
+    RecompiledBegin(ctx, 0xD89E); SetFlag(cpu, Flags::V, false); cpu.totalCycles += 2;
+    // D89F  CLC
+    RecompiledBegin(ctx, 0xD89F); SetFlag(cpu, Flags::C, false); cpu.totalCycles += 2;
+    // D8A0  INC $0678
+    { RecompiledBegin(ctx, 0xD8A0); const byte result = static_cast<byte>(bus.read(0x0678) + 1); bus.write(0x0678, result); SetNZ(cpu, result); cpu.totalCycles += 6; }
+    // D8A3  BEQ $D8B2
+    RecompiledBegin(ctx, 0xD8A3); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xD8B2; return; }
+    // D8A5  BPL $D8B2
+    RecompiledBegin(ctx, 0xD8A5); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xD8B2; return; }
+    // D8A7  BVS $D8B2
+    RecompiledBegin(ctx, 0xD8A7); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xD8B2; return; }
+    // D8A9  BCS $D8B2
+    RecompiledBegin(ctx, 0xD8A9); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xD8B2; return; }
+    // D8AB  LDA $0678
+    RecompiledBegin(ctx, 0xD8AB); cpu.A = bus.read(0x0678); SetNZ(cpu, cpu.A); cpu.totalCycles += 4;
+    // D8AE  CMP #$80
+    RecompiledBegin(ctx, 0xD8AE); Compare(cpu, cpu.A, 0x80); cpu.totalCycles += 2;
+    // D8B0  BEQ $D8B6
+    RecompiledBegin(ctx, 0xD8B0); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xD8B6; return; }
+    cpu.PC = 0xD8B2;
+}
+
+static void Block_D8B2(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D8B2  LDA #$E6
+    RecompiledBegin(ctx, 0xD8B2); cpu.A = 0xE6; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D8B4  STA $00
+    RecompiledBegin(ctx, 0xD8B4); bus.write(0x0000, cpu.A); cpu.totalCycles += 3;
+    cpu.PC = 0xD8B6;
+}
+
+static void Block_D8B6(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D8B6  LDA #$00
+    RecompiledBegin(ctx, 0xD8B6); cpu.A = 0x00; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D8B8  STA $0678
+    RecompiledBegin(ctx, 0xD8B8); bus.write(0x0678, cpu.A); cpu.totalCycles += 4;
+    // D8BB  BIT $01
+    RecompiledBegin(ctx, 0xD8BB); BitTest(cpu, bus.read(0x0001)); cpu.totalCycles += 3;
+    // D8BD  SEC
+    RecompiledBegin(ctx, 0xD8BD); SetFlag(cpu, Flags::C, true); cpu.totalCycles += 2;
+    // D8BE  DEC $0678
+    { RecompiledBegin(ctx, 0xD8BE); const byte result = static_cast<byte>(bus.read(0x0678) - 1); bus.write(0x0678, result); SetNZ(cpu, result); cpu.totalCycles += 6; }
+    // D8C1  BEQ $D8D0
+    RecompiledBegin(ctx, 0xD8C1); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xD8D0; return; }
+    // D8C3  BPL $D8D0
+    RecompiledBegin(ctx, 0xD8C3); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xD8D0; return; }
+    // D8C5  BVC $D8D0
+    RecompiledBegin(ctx, 0xD8C5); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xD8D0; return; }
+    // D8C7  BCC $D8D0
+    RecompiledBegin(ctx, 0xD8C7); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xD8D0; return; }
+    // D8C9  LDA $0678
+    RecompiledBegin(ctx, 0xD8C9); cpu.A = bus.read(0x0678); SetNZ(cpu, cpu.A); cpu.totalCycles += 4;
+    // D8CC  CMP #$FF
+    RecompiledBegin(ctx, 0xD8CC); Compare(cpu, cpu.A, 0xFF); cpu.totalCycles += 2;
+    // D8CE  BEQ $D8D4
+    RecompiledBegin(ctx, 0xD8CE); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xD8D4; return; }
+    cpu.PC = 0xD8D0;
+}
+
+static void Block_D8D0(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D8D0  LDA #$E7
+    RecompiledBegin(ctx, 0xD8D0); cpu.A = 0xE7; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D8D2  STA $00
+    RecompiledBegin(ctx, 0xD8D2); bus.write(0x0000, cpu.A); cpu.totalCycles += 3;
+    cpu.PC = 0xD8D4;
+}
+
+static void Block_D8D4(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D8D4  LDA #$80
+    RecompiledBegin(ctx, 0xD8D4); cpu.A = 0x80; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D8D6  STA $0678
+    RecompiledBegin(ctx, 0xD8D6); bus.write(0x0678, cpu.A); cpu.totalCycles += 4;
+    // D8D9  CLV
+    RecompiledBegin(ctx, 0xD8D9); SetFlag(cpu, Flags::V, false); cpu.totalCycles += 2;
+    // D8DA  CLC
+    RecompiledBegin(ctx, 0xD8DA); SetFlag(cpu, Flags::C, false); cpu.totalCycles += 2;
+    // D8DB  DEC $0678
+    { RecompiledBegin(ctx, 0xD8DB); const byte result = static_cast<byte>(bus.read(0x0678) - 1); bus.write(0x0678, result); SetNZ(cpu, result); cpu.totalCycles += 6; }
+    // D8DE  BEQ $D8ED
+    RecompiledBegin(ctx, 0xD8DE); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xD8ED; return; }
+    // D8E0  BMI $D8ED
+    RecompiledBegin(ctx, 0xD8E0); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xD8ED; return; }
+    // D8E2  BVS $D8ED
+    RecompiledBegin(ctx, 0xD8E2); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xD8ED; return; }
+    // D8E4  BCS $D8ED
+    RecompiledBegin(ctx, 0xD8E4); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xD8ED; return; }
+    // D8E6  LDA $0678
+    RecompiledBegin(ctx, 0xD8E6); cpu.A = bus.read(0x0678); SetNZ(cpu, cpu.A); cpu.totalCycles += 4;
+    // D8E9  CMP #$7F
+    RecompiledBegin(ctx, 0xD8E9); Compare(cpu, cpu.A, 0x7F); cpu.totalCycles += 2;
+    // D8EB  BEQ $D8F1
+    RecompiledBegin(ctx, 0xD8EB); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xD8F1; return; }
+    cpu.PC = 0xD8ED;
+}
+
+static void Block_D8ED(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D8ED  LDA #$E8
+    RecompiledBegin(ctx, 0xD8ED); cpu.A = 0xE8; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D8EF  STA $00
+    RecompiledBegin(ctx, 0xD8EF); bus.write(0x0000, cpu.A); cpu.totalCycles += 3;
+    cpu.PC = 0xD8F1;
+}
+
+static void Block_D8F1(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D8F1  LDA #$01
+    RecompiledBegin(ctx, 0xD8F1); cpu.A = 0x01; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D8F3  STA $0678
+    RecompiledBegin(ctx, 0xD8F3); bus.write(0x0678, cpu.A); cpu.totalCycles += 4;
+    // D8F6  DEC $0678
+    { RecompiledBegin(ctx, 0xD8F6); const byte result = static_cast<byte>(bus.read(0x0678) - 1); bus.write(0x0678, result); SetNZ(cpu, result); cpu.totalCycles += 6; }
+    // D8F9  BEQ $D8FF
+    RecompiledBegin(ctx, 0xD8F9); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xD8FF; return; }
+    // D8FB  LDA #$E9
+    RecompiledBegin(ctx, 0xD8FB); cpu.A = 0xE9; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D8FD  STA $00
+    RecompiledBegin(ctx, 0xD8FD); bus.write(0x0000, cpu.A); cpu.totalCycles += 3;
+    cpu.PC = 0xD8FF;
+}
+
+static void Block_D8FF(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D8FF  RTS
+    { RecompiledBegin(ctx, 0xD8FF); cpu.SP++; const byte low = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); const byte high = bus.read(static_cast<memAddress>(0x0100 + cpu.SP + 1)); cpu.SP++; cpu.totalCycles += 6; cpu.PC = static_cast<memAddress>(RecompiledWord(low, high) + 1); return; }
+}
+
+static void Block_D900(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D900  LDA #$A3
+    RecompiledBegin(ctx, 0xD900); cpu.A = 0xA3; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D902  STA $33
+    RecompiledBegin(ctx, 0xD902); bus.write(0x0033, cpu.A); cpu.totalCycles += 3;
+    // D904  LDA #$89
+    RecompiledBegin(ctx, 0xD904); cpu.A = 0x89; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D906  STA $0300
+    RecompiledBegin(ctx, 0xD906); bus.write(0x0300, cpu.A); cpu.totalCycles += 4;
+    // D909  LDA #$12
+    RecompiledBegin(ctx, 0xD909); cpu.A = 0x12; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D90B  STA $0245
+    RecompiledBegin(ctx, 0xD90B); bus.write(0x0245, cpu.A); cpu.totalCycles += 4;
+    // D90E  LDA #$FF
+    RecompiledBegin(ctx, 0xD90E); cpu.A = 0xFF; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D910  STA $01
+    RecompiledBegin(ctx, 0xD910); bus.write(0x0001, cpu.A); cpu.totalCycles += 3;
+    // D912  LDX #$65
+    RecompiledBegin(ctx, 0xD912); cpu.X = 0x65; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // D914  LDA #$00
+    RecompiledBegin(ctx, 0xD914); cpu.A = 0x00; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D916  STA $89
+    RecompiledBegin(ctx, 0xD916); bus.write(0x0089, cpu.A); cpu.totalCycles += 3;
+    // D918  LDA #$03
+    RecompiledBegin(ctx, 0xD918); cpu.A = 0x03; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D91A  STA $8A
+    RecompiledBegin(ctx, 0xD91A); bus.write(0x008A, cpu.A); cpu.totalCycles += 3;
+    // D91C  LDY #$00
+    RecompiledBegin(ctx, 0xD91C); cpu.Y = 0x00; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // D91E  SEC
+    RecompiledBegin(ctx, 0xD91E); SetFlag(cpu, Flags::C, true); cpu.totalCycles += 2;
+    // D91F  LDA #$00
+    RecompiledBegin(ctx, 0xD91F); cpu.A = 0x00; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D921  CLV
+    RecompiledBegin(ctx, 0xD921); SetFlag(cpu, Flags::V, false); cpu.totalCycles += 2;
+    // D922  LDA ($89),Y
+    { RecompiledBegin(ctx, 0xD922); const memAddress pointer = RecompiledWord(bus.read(0x89), bus.read(0x8A)); const memAddress ea = static_cast<memAddress>(pointer + cpu.Y); cpu.A = bus.read(ea); SetNZ(cpu, cpu.A); cpu.totalCycles += 5 + (((ea & 0xFF00) != (pointer & 0xFF00)) ? 1 : 0); }
+    // D924  BEQ $D932
+    RecompiledBegin(ctx, 0xD924); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xD932; return; }
+    // D926  BCC $D932
+    RecompiledBegin(ctx, 0xD926); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xD932; return; }
+    // D928  BVS $D932
+    RecompiledBegin(ctx, 0xD928); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xD932; return; }
+    // D92A  CMP #$89
+    RecompiledBegin(ctx, 0xD92A); Compare(cpu, cpu.A, 0x89); cpu.totalCycles += 2;
+    // D92C  BNE $D932
+    RecompiledBegin(ctx, 0xD92C); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xD932; return; }
+    // D92E  CPX #$65
+    RecompiledBegin(ctx, 0xD92E); Compare(cpu, cpu.X, 0x65); cpu.totalCycles += 2;
+    // D930  BEQ $D936
+    RecompiledBegin(ctx, 0xD930); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xD936; return; }
+    cpu.PC = 0xD932;
+}
+
+static void Block_D932(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D932  LDA #$EA
+    RecompiledBegin(ctx, 0xD932); cpu.A = 0xEA; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D934  STA $00
+    RecompiledBegin(ctx, 0xD934); bus.write(0x0000, cpu.A); cpu.totalCycles += 3;
+    cpu.PC = 0xD936;
+}
+
+static void Block_D936(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D936  LDA #$FF
+    RecompiledBegin(ctx, 0xD936); cpu.A = 0xFF; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D938  STA $97
+    RecompiledBegin(ctx, 0xD938); bus.write(0x0097, cpu.A); cpu.totalCycles += 3;
+    // D93A  STA $98
+    RecompiledBegin(ctx, 0xD93A); bus.write(0x0098, cpu.A); cpu.totalCycles += 3;
+    // D93C  BIT $98
+    RecompiledBegin(ctx, 0xD93C); BitTest(cpu, bus.read(0x0098)); cpu.totalCycles += 3;
+    // D93E  LDY #$34
+    RecompiledBegin(ctx, 0xD93E); cpu.Y = 0x34; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // D940  LDA ($97),Y
+    { RecompiledBegin(ctx, 0xD940); const memAddress pointer = RecompiledWord(bus.read(0x97), bus.read(0x98)); const memAddress ea = static_cast<memAddress>(pointer + cpu.Y); cpu.A = bus.read(ea); SetNZ(cpu, cpu.A); cpu.totalCycles += 5 + (((ea & 0xFF00) != (pointer & 0xFF00)) ? 1 : 0); }
+    // D942  CMP #$A3
+    RecompiledBegin(ctx, 0xD942); Compare(cpu, cpu.A, 0xA3); cpu.totalCycles += 2;
+    // D944  BNE $D948
+    RecompiledBegin(ctx, 0xD944); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xD948; return; }
+    // D946  BCS $D94C
+    RecompiledBegin(ctx, 0xD946); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xD94C; return; }
+    cpu.PC = 0xD948;
+}
+
+static void Block_D948(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D948  LDA #$EB
+    RecompiledBegin(ctx, 0xD948); cpu.A = 0xEB; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D94A  STA $00
+    RecompiledBegin(ctx, 0xD94A); bus.write(0x0000, cpu.A); cpu.totalCycles += 3;
+    cpu.PC = 0xD94C;
+}
+
+static void Block_D94C(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D94C  LDA $00
+    RecompiledBegin(ctx, 0xD94C); cpu.A = bus.read(0x0000); SetNZ(cpu, cpu.A); cpu.totalCycles += 3;
+    // D94E  PHA
+    RecompiledBegin(ctx, 0xD94E); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), cpu.A); cpu.totalCycles += 3;
+    // D94F  LDA #$46
+    RecompiledBegin(ctx, 0xD94F); cpu.A = 0x46; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D951  STA $FF
+    RecompiledBegin(ctx, 0xD951); bus.write(0x00FF, cpu.A); cpu.totalCycles += 3;
+    // D953  LDA #$01
+    RecompiledBegin(ctx, 0xD953); cpu.A = 0x01; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D955  STA $00
+    RecompiledBegin(ctx, 0xD955); bus.write(0x0000, cpu.A); cpu.totalCycles += 3;
+    // D957  LDY #$FF
+    RecompiledBegin(ctx, 0xD957); cpu.Y = 0xFF; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // D959  LDA ($FF),Y
+    { RecompiledBegin(ctx, 0xD959); const memAddress pointer = RecompiledWord(bus.read(0xFF), bus.read(0x00)); const memAddress ea = static_cast<memAddress>(pointer + cpu.Y); cpu.A = bus.read(ea); SetNZ(cpu, cpu.A); cpu.totalCycles += 5 + (((ea & 0xFF00) != (pointer & 0xFF00)) ? 1 : 0); }
+    // D95B  CMP #$12
+    RecompiledBegin(ctx, 0xD95B); Compare(cpu, cpu.A, 0x12); cpu.totalCycles += 2;
+    // D95D  BEQ $D963
+    RecompiledBegin(ctx, 0xD95D); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xD963; return; }
+    // D95F  PLA
+    RecompiledBegin(ctx, 0xD95F); cpu.SP++; cpu.A = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); SetNZ(cpu, cpu.A); cpu.totalCycles += 4;
+    // D960  LDA #$EC
+    RecompiledBegin(ctx, 0xD960); cpu.A = 0xEC; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D962  PHA
+    RecompiledBegin(ctx, 0xD962); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), cpu.A); cpu.totalCycles += 3;
+    cpu.PC = 0xD963;
+}
+
+static void Block_D963(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D963  PLA
+    RecompiledBegin(ctx, 0xD963); cpu.SP++; cpu.A = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); SetNZ(cpu, cpu.A); cpu.totalCycles += 4;
+    // D964  STA $00
+    RecompiledBegin(ctx, 0xD964); bus.write(0x0000, cpu.A); cpu.totalCycles += 3;
+    // D966  LDX #$ED
+    RecompiledBegin(ctx, 0xD966); cpu.X = 0xED; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // D968  LDA #$00
+    RecompiledBegin(ctx, 0xD968); cpu.A = 0x00; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D96A  STA $33
+    RecompiledBegin(ctx, 0xD96A); bus.write(0x0033, cpu.A); cpu.totalCycles += 3;
+    // D96C  LDA #$04
+    RecompiledBegin(ctx, 0xD96C); cpu.A = 0x04; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D96E  STA $34
+    RecompiledBegin(ctx, 0xD96E); bus.write(0x0034, cpu.A); cpu.totalCycles += 3;
+    // D970  LDY #$00
+    RecompiledBegin(ctx, 0xD970); cpu.Y = 0x00; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // D972  CLC
+    RecompiledBegin(ctx, 0xD972); SetFlag(cpu, Flags::C, false); cpu.totalCycles += 2;
+    // D973  LDA #$FF
+    RecompiledBegin(ctx, 0xD973); cpu.A = 0xFF; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D975  STA $01
+    RecompiledBegin(ctx, 0xD975); bus.write(0x0001, cpu.A); cpu.totalCycles += 3;
+    // D977  BIT $01
+    RecompiledBegin(ctx, 0xD977); BitTest(cpu, bus.read(0x0001)); cpu.totalCycles += 3;
+    // D979  LDA #$AA
+    RecompiledBegin(ctx, 0xD979); cpu.A = 0xAA; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D97B  STA $0400
+    RecompiledBegin(ctx, 0xD97B); bus.write(0x0400, cpu.A); cpu.totalCycles += 4;
+    // D97E  LDA #$55
+    RecompiledBegin(ctx, 0xD97E); cpu.A = 0x55; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D980  ORA ($33),Y
+    { RecompiledBegin(ctx, 0xD980); const memAddress pointer = RecompiledWord(bus.read(0x33), bus.read(0x34)); const memAddress ea = static_cast<memAddress>(pointer + cpu.Y); cpu.A = static_cast<byte>(cpu.A | bus.read(ea)); SetNZ(cpu, cpu.A); cpu.totalCycles += 5 + (((ea & 0xFF00) != (pointer & 0xFF00)) ? 1 : 0); }
+    // D982  BCS $D98C
+    RecompiledBegin(ctx, 0xD982); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xD98C; return; }
+    // D984  BPL $D98C
+    RecompiledBegin(ctx, 0xD984); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xD98C; return; }
+    // D986  CMP #$FF
+    RecompiledBegin(ctx, 0xD986); Compare(cpu, cpu.A, 0xFF); cpu.totalCycles += 2;
+    // D988  BNE $D98C
+    RecompiledBegin(ctx, 0xD988); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xD98C; return; }
+    // D98A  BVS $D98E
+    RecompiledBegin(ctx, 0xD98A); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xD98E; return; }
+    cpu.PC = 0xD98C;
+}
+
+static void Block_D98C(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D98C  STX $00
+    RecompiledBegin(ctx, 0xD98C); bus.write(0x0000, cpu.X); cpu.totalCycles += 3;
+    cpu.PC = 0xD98E;
+}
+
+static void Block_D98E(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D98E  INX
+    RecompiledBegin(ctx, 0xD98E); cpu.X++; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // D98F  SEC
+    RecompiledBegin(ctx, 0xD98F); SetFlag(cpu, Flags::C, true); cpu.totalCycles += 2;
+    // D990  CLV
+    RecompiledBegin(ctx, 0xD990); SetFlag(cpu, Flags::V, false); cpu.totalCycles += 2;
+    // D991  LDA #$00
+    RecompiledBegin(ctx, 0xD991); cpu.A = 0x00; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D993  ORA ($33),Y
+    { RecompiledBegin(ctx, 0xD993); const memAddress pointer = RecompiledWord(bus.read(0x33), bus.read(0x34)); const memAddress ea = static_cast<memAddress>(pointer + cpu.Y); cpu.A = static_cast<byte>(cpu.A | bus.read(ea)); SetNZ(cpu, cpu.A); cpu.totalCycles += 5 + (((ea & 0xFF00) != (pointer & 0xFF00)) ? 1 : 0); }
+    // D995  BEQ $D99D
+    RecompiledBegin(ctx, 0xD995); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xD99D; return; }
+    // D997  BVS $D99D
+    RecompiledBegin(ctx, 0xD997); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xD99D; return; }
+    // D999  BCC $D99D
+    RecompiledBegin(ctx, 0xD999); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xD99D; return; }
+    // D99B  BMI $D99F
+    RecompiledBegin(ctx, 0xD99B); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xD99F; return; }
+    cpu.PC = 0xD99D;
+}
+
+static void Block_D99D(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D99D  STX $00
+    RecompiledBegin(ctx, 0xD99D); bus.write(0x0000, cpu.X); cpu.totalCycles += 3;
+    cpu.PC = 0xD99F;
+}
+
+static void Block_D99F(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D99F  INX
+    RecompiledBegin(ctx, 0xD99F); cpu.X++; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // D9A0  CLC
+    RecompiledBegin(ctx, 0xD9A0); SetFlag(cpu, Flags::C, false); cpu.totalCycles += 2;
+    // D9A1  BIT $01
+    RecompiledBegin(ctx, 0xD9A1); BitTest(cpu, bus.read(0x0001)); cpu.totalCycles += 3;
+    // D9A3  LDA #$55
+    RecompiledBegin(ctx, 0xD9A3); cpu.A = 0x55; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D9A5  AND ($33),Y
+    { RecompiledBegin(ctx, 0xD9A5); const memAddress pointer = RecompiledWord(bus.read(0x33), bus.read(0x34)); const memAddress ea = static_cast<memAddress>(pointer + cpu.Y); cpu.A = static_cast<byte>(cpu.A & bus.read(ea)); SetNZ(cpu, cpu.A); cpu.totalCycles += 5 + (((ea & 0xFF00) != (pointer & 0xFF00)) ? 1 : 0); }
+    // D9A7  BNE $D9AF
+    RecompiledBegin(ctx, 0xD9A7); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xD9AF; return; }
+    // D9A9  BVC $D9AF
+    RecompiledBegin(ctx, 0xD9A9); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xD9AF; return; }
+    // D9AB  BCS $D9AF
+    RecompiledBegin(ctx, 0xD9AB); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xD9AF; return; }
+    // D9AD  BPL $D9B1
+    RecompiledBegin(ctx, 0xD9AD); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xD9B1; return; }
+    cpu.PC = 0xD9AF;
+}
+
+static void Block_D9AF(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D9AF  STX $00
+    RecompiledBegin(ctx, 0xD9AF); bus.write(0x0000, cpu.X); cpu.totalCycles += 3;
+    cpu.PC = 0xD9B1;
+}
+
+static void Block_D9B1(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D9B1  INX
+    RecompiledBegin(ctx, 0xD9B1); cpu.X++; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // D9B2  SEC
+    RecompiledBegin(ctx, 0xD9B2); SetFlag(cpu, Flags::C, true); cpu.totalCycles += 2;
+    // D9B3  CLV
+    RecompiledBegin(ctx, 0xD9B3); SetFlag(cpu, Flags::V, false); cpu.totalCycles += 2;
+    // D9B4  LDA #$EF
+    RecompiledBegin(ctx, 0xD9B4); cpu.A = 0xEF; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D9B6  STA $0400
+    RecompiledBegin(ctx, 0xD9B6); bus.write(0x0400, cpu.A); cpu.totalCycles += 4;
+    // D9B9  LDA #$F8
+    RecompiledBegin(ctx, 0xD9B9); cpu.A = 0xF8; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D9BB  AND ($33),Y
+    { RecompiledBegin(ctx, 0xD9BB); const memAddress pointer = RecompiledWord(bus.read(0x33), bus.read(0x34)); const memAddress ea = static_cast<memAddress>(pointer + cpu.Y); cpu.A = static_cast<byte>(cpu.A & bus.read(ea)); SetNZ(cpu, cpu.A); cpu.totalCycles += 5 + (((ea & 0xFF00) != (pointer & 0xFF00)) ? 1 : 0); }
+    // D9BD  BCC $D9C7
+    RecompiledBegin(ctx, 0xD9BD); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xD9C7; return; }
+    // D9BF  BPL $D9C7
+    RecompiledBegin(ctx, 0xD9BF); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xD9C7; return; }
+    // D9C1  CMP #$E8
+    RecompiledBegin(ctx, 0xD9C1); Compare(cpu, cpu.A, 0xE8); cpu.totalCycles += 2;
+    // D9C3  BNE $D9C7
+    RecompiledBegin(ctx, 0xD9C3); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xD9C7; return; }
+    // D9C5  BVC $D9C9
+    RecompiledBegin(ctx, 0xD9C5); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xD9C9; return; }
+    cpu.PC = 0xD9C7;
+}
+
+static void Block_D9C7(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D9C7  STX $00
+    RecompiledBegin(ctx, 0xD9C7); bus.write(0x0000, cpu.X); cpu.totalCycles += 3;
+    cpu.PC = 0xD9C9;
+}
+
+static void Block_D9C9(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D9C9  INX
+    RecompiledBegin(ctx, 0xD9C9); cpu.X++; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // D9CA  CLC
+    RecompiledBegin(ctx, 0xD9CA); SetFlag(cpu, Flags::C, false); cpu.totalCycles += 2;
+    // D9CB  BIT $01
+    RecompiledBegin(ctx, 0xD9CB); BitTest(cpu, bus.read(0x0001)); cpu.totalCycles += 3;
+    // D9CD  LDA #$AA
+    RecompiledBegin(ctx, 0xD9CD); cpu.A = 0xAA; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D9CF  STA $0400
+    RecompiledBegin(ctx, 0xD9CF); bus.write(0x0400, cpu.A); cpu.totalCycles += 4;
+    // D9D2  LDA #$5F
+    RecompiledBegin(ctx, 0xD9D2); cpu.A = 0x5F; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D9D4  EOR ($33),Y
+    { RecompiledBegin(ctx, 0xD9D4); const memAddress pointer = RecompiledWord(bus.read(0x33), bus.read(0x34)); const memAddress ea = static_cast<memAddress>(pointer + cpu.Y); cpu.A = static_cast<byte>(cpu.A ^ bus.read(ea)); SetNZ(cpu, cpu.A); cpu.totalCycles += 5 + (((ea & 0xFF00) != (pointer & 0xFF00)) ? 1 : 0); }
+    // D9D6  BCS $D9E0
+    RecompiledBegin(ctx, 0xD9D6); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xD9E0; return; }
+    // D9D8  BPL $D9E0
+    RecompiledBegin(ctx, 0xD9D8); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xD9E0; return; }
+    // D9DA  CMP #$F5
+    RecompiledBegin(ctx, 0xD9DA); Compare(cpu, cpu.A, 0xF5); cpu.totalCycles += 2;
+    // D9DC  BNE $D9E0
+    RecompiledBegin(ctx, 0xD9DC); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xD9E0; return; }
+    // D9DE  BVS $D9E2
+    RecompiledBegin(ctx, 0xD9DE); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xD9E2; return; }
+    cpu.PC = 0xD9E0;
+}
+
+static void Block_D9E0(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D9E0  STX $00
+    RecompiledBegin(ctx, 0xD9E0); bus.write(0x0000, cpu.X); cpu.totalCycles += 3;
+    cpu.PC = 0xD9E2;
+}
+
+static void Block_D9E2(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D9E2  INX
+    RecompiledBegin(ctx, 0xD9E2); cpu.X++; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // D9E3  SEC
+    RecompiledBegin(ctx, 0xD9E3); SetFlag(cpu, Flags::C, true); cpu.totalCycles += 2;
+    // D9E4  CLV
+    RecompiledBegin(ctx, 0xD9E4); SetFlag(cpu, Flags::V, false); cpu.totalCycles += 2;
+    // D9E5  LDA #$70
+    RecompiledBegin(ctx, 0xD9E5); cpu.A = 0x70; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D9E7  STA $0400
+    RecompiledBegin(ctx, 0xD9E7); bus.write(0x0400, cpu.A); cpu.totalCycles += 4;
+    // D9EA  EOR ($33),Y
+    { RecompiledBegin(ctx, 0xD9EA); const memAddress pointer = RecompiledWord(bus.read(0x33), bus.read(0x34)); const memAddress ea = static_cast<memAddress>(pointer + cpu.Y); cpu.A = static_cast<byte>(cpu.A ^ bus.read(ea)); SetNZ(cpu, cpu.A); cpu.totalCycles += 5 + (((ea & 0xFF00) != (pointer & 0xFF00)) ? 1 : 0); }
+    // D9EC  BNE $D9F4
+    RecompiledBegin(ctx, 0xD9EC); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xD9F4; return; }
+    // D9EE  BVS $D9F4
+    RecompiledBegin(ctx, 0xD9EE); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xD9F4; return; }
+    // D9F0  BCC $D9F4
+    RecompiledBegin(ctx, 0xD9F0); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xD9F4; return; }
+    // D9F2  BPL $D9F6
+    RecompiledBegin(ctx, 0xD9F2); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xD9F6; return; }
+    cpu.PC = 0xD9F4;
+}
+
+static void Block_D9F4(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D9F4  STX $00
+    RecompiledBegin(ctx, 0xD9F4); bus.write(0x0000, cpu.X); cpu.totalCycles += 3;
+    cpu.PC = 0xD9F6;
+}
+
+static void Block_D9F6(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // D9F6  INX
+    RecompiledBegin(ctx, 0xD9F6); cpu.X++; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // D9F7  CLC
+    RecompiledBegin(ctx, 0xD9F7); SetFlag(cpu, Flags::C, false); cpu.totalCycles += 2;
+    // D9F8  BIT $01
+    RecompiledBegin(ctx, 0xD9F8); BitTest(cpu, bus.read(0x0001)); cpu.totalCycles += 3;
+    // D9FA  LDA #$69
+    RecompiledBegin(ctx, 0xD9FA); cpu.A = 0x69; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // D9FC  STA $0400
+    RecompiledBegin(ctx, 0xD9FC); bus.write(0x0400, cpu.A); cpu.totalCycles += 4;
+    // D9FF  LDA #$00
+    RecompiledBegin(ctx, 0xD9FF); cpu.A = 0x00; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // DA01  ADC ($33),Y
+    { RecompiledBegin(ctx, 0xDA01); const memAddress pointer = RecompiledWord(bus.read(0x33), bus.read(0x34)); const memAddress ea = static_cast<memAddress>(pointer + cpu.Y); AddBinary(cpu, bus.read(ea)); cpu.totalCycles += 5 + (((ea & 0xFF00) != (pointer & 0xFF00)) ? 1 : 0); }
+    // DA03  BMI $DA0D
+    RecompiledBegin(ctx, 0xDA03); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xDA0D; return; }
+    // DA05  BCS $DA0D
+    RecompiledBegin(ctx, 0xDA05); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xDA0D; return; }
+    // DA07  CMP #$69
+    RecompiledBegin(ctx, 0xDA07); Compare(cpu, cpu.A, 0x69); cpu.totalCycles += 2;
+    // DA09  BNE $DA0D
+    RecompiledBegin(ctx, 0xDA09); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xDA0D; return; }
+    // DA0B  BVC $DA0F
+    RecompiledBegin(ctx, 0xDA0B); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xDA0F; return; }
+    cpu.PC = 0xDA0D;
+}
+
+static void Block_DA0D(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // DA0D  STX $00
+    RecompiledBegin(ctx, 0xDA0D); bus.write(0x0000, cpu.X); cpu.totalCycles += 3;
+    cpu.PC = 0xDA0F;
+}
+
+static void Block_DA0F(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // DA0F  INX
+    RecompiledBegin(ctx, 0xDA0F); cpu.X++; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // DA10  SEC
+    RecompiledBegin(ctx, 0xDA10); SetFlag(cpu, Flags::C, true); cpu.totalCycles += 2;
+    // DA11  BIT $01
+    RecompiledBegin(ctx, 0xDA11); BitTest(cpu, bus.read(0x0001)); cpu.totalCycles += 3;
+    // DA13  LDA #$00
+    RecompiledBegin(ctx, 0xDA13); cpu.A = 0x00; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // DA15  ADC ($33),Y
+    { RecompiledBegin(ctx, 0xDA15); const memAddress pointer = RecompiledWord(bus.read(0x33), bus.read(0x34)); const memAddress ea = static_cast<memAddress>(pointer + cpu.Y); AddBinary(cpu, bus.read(ea)); cpu.totalCycles += 5 + (((ea & 0xFF00) != (pointer & 0xFF00)) ? 1 : 0); }
+    // DA17  BMI $DA21
+    RecompiledBegin(ctx, 0xDA17); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xDA21; return; }
+    // DA19  BCS $DA21
+    RecompiledBegin(ctx, 0xDA19); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xDA21; return; }
+    // DA1B  CMP #$6A
+    RecompiledBegin(ctx, 0xDA1B); Compare(cpu, cpu.A, 0x6A); cpu.totalCycles += 2;
+    // DA1D  BNE $DA21
+    RecompiledBegin(ctx, 0xDA1D); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xDA21; return; }
+    // DA1F  BVC $DA23
+    RecompiledBegin(ctx, 0xDA1F); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xDA23; return; }
+    cpu.PC = 0xDA21;
+}
+
+static void Block_DA21(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // DA21  STX $00
+    RecompiledBegin(ctx, 0xDA21); bus.write(0x0000, cpu.X); cpu.totalCycles += 3;
+    cpu.PC = 0xDA23;
+}
+
+static void Block_DA23(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // DA23  INX
+    RecompiledBegin(ctx, 0xDA23); cpu.X++; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // DA24  SEC
+    RecompiledBegin(ctx, 0xDA24); SetFlag(cpu, Flags::C, true); cpu.totalCycles += 2;
+    // DA25  CLV
+    RecompiledBegin(ctx, 0xDA25); SetFlag(cpu, Flags::V, false); cpu.totalCycles += 2;
+    // DA26  LDA #$7F
+    RecompiledBegin(ctx, 0xDA26); cpu.A = 0x7F; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // DA28  STA $0400
+    RecompiledBegin(ctx, 0xDA28); bus.write(0x0400, cpu.A); cpu.totalCycles += 4;
+    // DA2B  ADC ($33),Y
+    { RecompiledBegin(ctx, 0xDA2B); const memAddress pointer = RecompiledWord(bus.read(0x33), bus.read(0x34)); const memAddress ea = static_cast<memAddress>(pointer + cpu.Y); AddBinary(cpu, bus.read(ea)); cpu.totalCycles += 5 + (((ea & 0xFF00) != (pointer & 0xFF00)) ? 1 : 0); }
+    // DA2D  BPL $DA37
+    RecompiledBegin(ctx, 0xDA2D); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xDA37; return; }
+    // DA2F  BCS $DA37
+    RecompiledBegin(ctx, 0xDA2F); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xDA37; return; }
+    // DA31  CMP #$FF
+    RecompiledBegin(ctx, 0xDA31); Compare(cpu, cpu.A, 0xFF); cpu.totalCycles += 2;
+    // DA33  BNE $DA37
+    RecompiledBegin(ctx, 0xDA33); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xDA37; return; }
+    // DA35  BVS $DA39
+    RecompiledBegin(ctx, 0xDA35); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xDA39; return; }
+    cpu.PC = 0xDA37;
+}
+
+static void Block_DA37(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // DA37  STX $00
+    RecompiledBegin(ctx, 0xDA37); bus.write(0x0000, cpu.X); cpu.totalCycles += 3;
+    cpu.PC = 0xDA39;
+}
+
+static void Block_DA39(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // DA39  INX
+    RecompiledBegin(ctx, 0xDA39); cpu.X++; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // DA3A  CLC
+    RecompiledBegin(ctx, 0xDA3A); SetFlag(cpu, Flags::C, false); cpu.totalCycles += 2;
+    // DA3B  BIT $01
+    RecompiledBegin(ctx, 0xDA3B); BitTest(cpu, bus.read(0x0001)); cpu.totalCycles += 3;
+    // DA3D  LDA #$80
+    RecompiledBegin(ctx, 0xDA3D); cpu.A = 0x80; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // DA3F  STA $0400
+    RecompiledBegin(ctx, 0xDA3F); bus.write(0x0400, cpu.A); cpu.totalCycles += 4;
+    // DA42  LDA #$7F
+    RecompiledBegin(ctx, 0xDA42); cpu.A = 0x7F; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // DA44  ADC ($33),Y
+    { RecompiledBegin(ctx, 0xDA44); const memAddress pointer = RecompiledWord(bus.read(0x33), bus.read(0x34)); const memAddress ea = static_cast<memAddress>(pointer + cpu.Y); AddBinary(cpu, bus.read(ea)); cpu.totalCycles += 5 + (((ea & 0xFF00) != (pointer & 0xFF00)) ? 1 : 0); }
+    // DA46  BPL $DA50
+    RecompiledBegin(ctx, 0xDA46); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xDA50; return; }
+    // DA48  BCS $DA50
+    RecompiledBegin(ctx, 0xDA48); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xDA50; return; }
+    // DA4A  CMP #$FF
+    RecompiledBegin(ctx, 0xDA4A); Compare(cpu, cpu.A, 0xFF); cpu.totalCycles += 2;
+    // DA4C  BNE $DA50
+    RecompiledBegin(ctx, 0xDA4C); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xDA50; return; }
+    // DA4E  BVC $DA52
+    RecompiledBegin(ctx, 0xDA4E); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xDA52; return; }
+    cpu.PC = 0xDA50;
+}
+
+static void Block_DA50(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // DA50  STX $00
+    RecompiledBegin(ctx, 0xDA50); bus.write(0x0000, cpu.X); cpu.totalCycles += 3;
+    cpu.PC = 0xDA52;
+}
+
+static void Block_DA52(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // DA52  INX
+    RecompiledBegin(ctx, 0xDA52); cpu.X++; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // DA53  SEC
+    RecompiledBegin(ctx, 0xDA53); SetFlag(cpu, Flags::C, true); cpu.totalCycles += 2;
+    // DA54  CLV
+    RecompiledBegin(ctx, 0xDA54); SetFlag(cpu, Flags::V, false); cpu.totalCycles += 2;
+    // DA55  LDA #$80
+    RecompiledBegin(ctx, 0xDA55); cpu.A = 0x80; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // DA57  STA $0400
+    RecompiledBegin(ctx, 0xDA57); bus.write(0x0400, cpu.A); cpu.totalCycles += 4;
+    // DA5A  LDA #$7F
+    RecompiledBegin(ctx, 0xDA5A); cpu.A = 0x7F; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // DA5C  ADC ($33),Y
+    { RecompiledBegin(ctx, 0xDA5C); const memAddress pointer = RecompiledWord(bus.read(0x33), bus.read(0x34)); const memAddress ea = static_cast<memAddress>(pointer + cpu.Y); AddBinary(cpu, bus.read(ea)); cpu.totalCycles += 5 + (((ea & 0xFF00) != (pointer & 0xFF00)) ? 1 : 0); }
+    // DA5E  BNE $DA66
+    RecompiledBegin(ctx, 0xDA5E); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xDA66; return; }
+    // DA60  BMI $DA66
+    RecompiledBegin(ctx, 0xDA60); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xDA66; return; }
+    // DA62  BVS $DA66
+    RecompiledBegin(ctx, 0xDA62); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xDA66; return; }
+    // DA64  BCS $DA68
+    RecompiledBegin(ctx, 0xDA64); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xDA68; return; }
+    cpu.PC = 0xDA66;
+}
+
+static void Block_DA66(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // DA66  STX $00
+    RecompiledBegin(ctx, 0xDA66); bus.write(0x0000, cpu.X); cpu.totalCycles += 3;
+    cpu.PC = 0xDA68;
+}
+
+static void Block_DA68(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // DA68  INX
+    RecompiledBegin(ctx, 0xDA68); cpu.X++; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // DA69  BIT $01
+    RecompiledBegin(ctx, 0xDA69); BitTest(cpu, bus.read(0x0001)); cpu.totalCycles += 3;
+    // DA6B  LDA #$40
+    RecompiledBegin(ctx, 0xDA6B); cpu.A = 0x40; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // DA6D  STA $0400
+    RecompiledBegin(ctx, 0xDA6D); bus.write(0x0400, cpu.A); cpu.totalCycles += 4;
+    // DA70  CMP ($33),Y
+    { RecompiledBegin(ctx, 0xDA70); const memAddress pointer = RecompiledWord(bus.read(0x33), bus.read(0x34)); const memAddress ea = static_cast<memAddress>(pointer + cpu.Y); Compare(cpu, cpu.A, bus.read(ea)); cpu.totalCycles += 5 + (((ea & 0xFF00) != (pointer & 0xFF00)) ? 1 : 0); }
+    // DA72  BMI $DA7A
+    RecompiledBegin(ctx, 0xDA72); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xDA7A; return; }
+    // DA74  BCC $DA7A
+    RecompiledBegin(ctx, 0xDA74); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xDA7A; return; }
+    // DA76  BNE $DA7A
+    RecompiledBegin(ctx, 0xDA76); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xDA7A; return; }
+    // DA78  BVS $DA7C
+    RecompiledBegin(ctx, 0xDA78); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xDA7C; return; }
+    cpu.PC = 0xDA7A;
+}
+
+static void Block_DA7A(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // DA7A  STX $00
+    RecompiledBegin(ctx, 0xDA7A); bus.write(0x0000, cpu.X); cpu.totalCycles += 3;
+    cpu.PC = 0xDA7C;
+}
+
+static void Block_DA7C(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // DA7C  INX
+    RecompiledBegin(ctx, 0xDA7C); cpu.X++; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // DA7D  CLV
+    RecompiledBegin(ctx, 0xDA7D); SetFlag(cpu, Flags::V, false); cpu.totalCycles += 2;
+    // DA7E  DEC $0400
+    { RecompiledBegin(ctx, 0xDA7E); const byte result = static_cast<byte>(bus.read(0x0400) - 1); bus.write(0x0400, result); SetNZ(cpu, result); cpu.totalCycles += 6; }
+    // DA81  CMP ($33),Y
+    { RecompiledBegin(ctx, 0xDA81); const memAddress pointer = RecompiledWord(bus.read(0x33), bus.read(0x34)); const memAddress ea = static_cast<memAddress>(pointer + cpu.Y); Compare(cpu, cpu.A, bus.read(ea)); cpu.totalCycles += 5 + (((ea & 0xFF00) != (pointer & 0xFF00)) ? 1 : 0); }
+    // DA83  BEQ $DA8B
+    RecompiledBegin(ctx, 0xDA83); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xDA8B; return; }
+    // DA85  BMI $DA8B
+    RecompiledBegin(ctx, 0xDA85); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xDA8B; return; }
+    // DA87  BCC $DA8B
+    RecompiledBegin(ctx, 0xDA87); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xDA8B; return; }
+    // DA89  BVC $DA8D
+    RecompiledBegin(ctx, 0xDA89); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xDA8D; return; }
+    cpu.PC = 0xDA8B;
+}
+
+static void Block_DA8B(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // DA8B  STX $00
+    RecompiledBegin(ctx, 0xDA8B); bus.write(0x0000, cpu.X); cpu.totalCycles += 3;
+    cpu.PC = 0xDA8D;
+}
+
+static void Block_DA8D(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // DA8D  INX
+    RecompiledBegin(ctx, 0xDA8D); cpu.X++; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // DA8E  INC $0400
+    { RecompiledBegin(ctx, 0xDA8E); const byte result = static_cast<byte>(bus.read(0x0400) + 1); bus.write(0x0400, result); SetNZ(cpu, result); cpu.totalCycles += 6; }
+    // DA91  INC $0400
+    { RecompiledBegin(ctx, 0xDA91); const byte result = static_cast<byte>(bus.read(0x0400) + 1); bus.write(0x0400, result); SetNZ(cpu, result); cpu.totalCycles += 6; }
+    // DA94  CMP ($33),Y
+    { RecompiledBegin(ctx, 0xDA94); const memAddress pointer = RecompiledWord(bus.read(0x33), bus.read(0x34)); const memAddress ea = static_cast<memAddress>(pointer + cpu.Y); Compare(cpu, cpu.A, bus.read(ea)); cpu.totalCycles += 5 + (((ea & 0xFF00) != (pointer & 0xFF00)) ? 1 : 0); }
+    // DA96  BEQ $DA9A
+    RecompiledBegin(ctx, 0xDA96); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xDA9A; return; }
+    // DA98  BMI $DA9C
+    RecompiledBegin(ctx, 0xDA98); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xDA9C; return; }
+    cpu.PC = 0xDA9A;
+}
+
+static void Block_DA9A(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // DA9A  STX $00
+    RecompiledBegin(ctx, 0xDA9A); bus.write(0x0000, cpu.X); cpu.totalCycles += 3;
+    cpu.PC = 0xDA9C;
+}
+
+static void Block_DA9C(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // DA9C  INX
+    RecompiledBegin(ctx, 0xDA9C); cpu.X++; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // DA9D  LDA #$00
+    RecompiledBegin(ctx, 0xDA9D); cpu.A = 0x00; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // DA9F  STA $0400
+    RecompiledBegin(ctx, 0xDA9F); bus.write(0x0400, cpu.A); cpu.totalCycles += 4;
+    // DAA2  LDA #$80
+    RecompiledBegin(ctx, 0xDAA2); cpu.A = 0x80; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // DAA4  CMP ($33),Y
+    { RecompiledBegin(ctx, 0xDAA4); const memAddress pointer = RecompiledWord(bus.read(0x33), bus.read(0x34)); const memAddress ea = static_cast<memAddress>(pointer + cpu.Y); Compare(cpu, cpu.A, bus.read(ea)); cpu.totalCycles += 5 + (((ea & 0xFF00) != (pointer & 0xFF00)) ? 1 : 0); }
+    // DAA6  BEQ $DAAC
+    RecompiledBegin(ctx, 0xDAA6); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xDAAC; return; }
+    // DAA8  BPL $DAAC
+    RecompiledBegin(ctx, 0xDAA8); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xDAAC; return; }
+    // DAAA  BCS $DAAE
+    RecompiledBegin(ctx, 0xDAAA); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xDAAE; return; }
+    cpu.PC = 0xDAAC;
+}
+
+static void Block_DAAC(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // DAAC  STX $00
+    RecompiledBegin(ctx, 0xDAAC); bus.write(0x0000, cpu.X); cpu.totalCycles += 3;
+    cpu.PC = 0xDAAE;
+}
+
+static void Block_DAAE(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // DAAE  INX
+    RecompiledBegin(ctx, 0xDAAE); cpu.X++; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // DAAF  LDY #$80
+    RecompiledBegin(ctx, 0xDAAF); cpu.Y = 0x80; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // DAB1  STY $0400
+    RecompiledBegin(ctx, 0xDAB1); bus.write(0x0400, cpu.Y); cpu.totalCycles += 4;
+    // DAB4  LDY #$00
+    RecompiledBegin(ctx, 0xDAB4); cpu.Y = 0x00; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // DAB6  CMP ($33),Y
+    { RecompiledBegin(ctx, 0xDAB6); const memAddress pointer = RecompiledWord(bus.read(0x33), bus.read(0x34)); const memAddress ea = static_cast<memAddress>(pointer + cpu.Y); Compare(cpu, cpu.A, bus.read(ea)); cpu.totalCycles += 5 + (((ea & 0xFF00) != (pointer & 0xFF00)) ? 1 : 0); }
+    // DAB8  BNE $DABE
+    RecompiledBegin(ctx, 0xDAB8); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xDABE; return; }
+    // DABA  BMI $DABE
+    RecompiledBegin(ctx, 0xDABA); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xDABE; return; }
+    // DABC  BCS $DAC0
+    RecompiledBegin(ctx, 0xDABC); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xDAC0; return; }
+    cpu.PC = 0xDABE;
+}
+
+static void Block_DABE(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // DABE  STX $00
+    RecompiledBegin(ctx, 0xDABE); bus.write(0x0000, cpu.X); cpu.totalCycles += 3;
+    cpu.PC = 0xDAC0;
+}
+
+static void Block_DAC0(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // DAC0  INX
+    RecompiledBegin(ctx, 0xDAC0); cpu.X++; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // DAC1  INC $0400
+    { RecompiledBegin(ctx, 0xDAC1); const byte result = static_cast<byte>(bus.read(0x0400) + 1); bus.write(0x0400, result); SetNZ(cpu, result); cpu.totalCycles += 6; }
+    // DAC4  CMP ($33),Y
+    { RecompiledBegin(ctx, 0xDAC4); const memAddress pointer = RecompiledWord(bus.read(0x33), bus.read(0x34)); const memAddress ea = static_cast<memAddress>(pointer + cpu.Y); Compare(cpu, cpu.A, bus.read(ea)); cpu.totalCycles += 5 + (((ea & 0xFF00) != (pointer & 0xFF00)) ? 1 : 0); }
+    // DAC6  BCS $DACC
+    RecompiledBegin(ctx, 0xDAC6); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xDACC; return; }
+    // DAC8  BEQ $DACC
+    RecompiledBegin(ctx, 0xDAC8); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xDACC; return; }
+    // DACA  BMI $DACE
+    RecompiledBegin(ctx, 0xDACA); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xDACE; return; }
+    cpu.PC = 0xDACC;
+}
+
+static void Block_DACC(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // DACC  STX $00
+    RecompiledBegin(ctx, 0xDACC); bus.write(0x0000, cpu.X); cpu.totalCycles += 3;
+    cpu.PC = 0xDACE;
+}
+
+static void Block_DACE(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // DACE  INX
+    RecompiledBegin(ctx, 0xDACE); cpu.X++; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // DACF  DEC $0400
+    { RecompiledBegin(ctx, 0xDACF); const byte result = static_cast<byte>(bus.read(0x0400) - 1); bus.write(0x0400, result); SetNZ(cpu, result); cpu.totalCycles += 6; }
+    // DAD2  DEC $0400
+    { RecompiledBegin(ctx, 0xDAD2); const byte result = static_cast<byte>(bus.read(0x0400) - 1); bus.write(0x0400, result); SetNZ(cpu, result); cpu.totalCycles += 6; }
+    // DAD5  CMP ($33),Y
+    { RecompiledBegin(ctx, 0xDAD5); const memAddress pointer = RecompiledWord(bus.read(0x33), bus.read(0x34)); const memAddress ea = static_cast<memAddress>(pointer + cpu.Y); Compare(cpu, cpu.A, bus.read(ea)); cpu.totalCycles += 5 + (((ea & 0xFF00) != (pointer & 0xFF00)) ? 1 : 0); }
+    // DAD7  BCC $DADD
+    RecompiledBegin(ctx, 0xDAD7); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xDADD; return; }
+    // DAD9  BEQ $DADD
+    RecompiledBegin(ctx, 0xDAD9); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xDADD; return; }
+    // DADB  BPL $DADF
+    RecompiledBegin(ctx, 0xDADB); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xDADF; return; }
+    cpu.PC = 0xDADD;
+}
+
+static void Block_DADD(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // DADD  STX $00
+    RecompiledBegin(ctx, 0xDADD); bus.write(0x0000, cpu.X); cpu.totalCycles += 3;
+    cpu.PC = 0xDADF;
+}
+
+static void Block_DADF(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // DADF  RTS
+    { RecompiledBegin(ctx, 0xDADF); cpu.SP++; const byte low = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); const byte high = bus.read(static_cast<memAddress>(0x0100 + cpu.SP + 1)); cpu.SP++; cpu.totalCycles += 6; cpu.PC = static_cast<memAddress>(RecompiledWord(low, high) + 1); return; }
+}
+
+static void Block_DAE0(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // DAE0  LDA #$00
+    RecompiledBegin(ctx, 0xDAE0); cpu.A = 0x00; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // DAE2  STA $33
+    RecompiledBegin(ctx, 0xDAE2); bus.write(0x0033, cpu.A); cpu.totalCycles += 3;
+    // DAE4  LDA #$04
+    RecompiledBegin(ctx, 0xDAE4); cpu.A = 0x04; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // DAE6  STA $34
+    RecompiledBegin(ctx, 0xDAE6); bus.write(0x0034, cpu.A); cpu.totalCycles += 3;
+    // DAE8  LDY #$00
+    RecompiledBegin(ctx, 0xDAE8); cpu.Y = 0x00; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // DAEA  LDX #$01
+    RecompiledBegin(ctx, 0xDAEA); cpu.X = 0x01; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // DAEC  BIT $01
+    RecompiledBegin(ctx, 0xDAEC); BitTest(cpu, bus.read(0x0001)); cpu.totalCycles += 3;
+    // DAEE  LDA #$40
+    RecompiledBegin(ctx, 0xDAEE); cpu.A = 0x40; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // DAF0  STA $0400
+    RecompiledBegin(ctx, 0xDAF0); bus.write(0x0400, cpu.A); cpu.totalCycles += 4;
+    // DAF3  SEC
+    RecompiledBegin(ctx, 0xDAF3); SetFlag(cpu, Flags::C, true); cpu.totalCycles += 2;
+    // DAF4  SBC ($33),Y
+    { RecompiledBegin(ctx, 0xDAF4); const memAddress pointer = RecompiledWord(bus.read(0x33), bus.read(0x34)); const memAddress ea = static_cast<memAddress>(pointer + cpu.Y); SubtractBinary(cpu, bus.read(ea)); cpu.totalCycles += 5 + (((ea & 0xFF00) != (pointer & 0xFF00)) ? 1 : 0); }
+    // DAF6  BMI $DB02
+    RecompiledBegin(ctx, 0xDAF6); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::N)) { cpu.totalCycles += 2; cpu.PC = 0xDB02; return; }
+    // DAF8  BCC $DB02
+    RecompiledBegin(ctx, 0xDAF8); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::C)) { cpu.totalCycles += 2; cpu.PC = 0xDB02; return; }
+    // DAFA  BNE $DB02
+    RecompiledBegin(ctx, 0xDAFA); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 2; cpu.PC = 0xDB02; return; }
+    // DAFC  BVS $DB02
+    RecompiledBegin(ctx, 0xDAFC); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::V)) { cpu.totalCycles += 2; cpu.PC = 0xDB02; return; }
+    // DAFE  CMP #$00
+    RecompiledBegin(ctx, 0xDAFE); Compare(cpu, cpu.A, 0x00); cpu.totalCycles += 2;
+    // DB00  BEQ $DB04
+    RecompiledBegin(ctx, 0xDB00); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xDB04; return; }
+    cpu.PC = 0xDB02;
+}
+
+static void Block_DB02(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // DB02  STX $00
+    RecompiledBegin(ctx, 0xDB02); bus.write(0x0000, cpu.X); cpu.totalCycles += 3;
+    cpu.PC = 0xDB04;
+}
+
+static void Block_DB04(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // DB04  INX
+    RecompiledBegin(ctx, 0xDB04); cpu.X++; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // DB05  CLV
+    RecompiledBegin(ctx, 0xDB05); SetFlag(cpu, Flags::V, false); cpu.totalCycles += 2;
+    // DB06  SEC
+    RecompiledBegin(ctx, 0xDB06); SetFlag(cpu, Flags::C, true); cpu.totalCycles += 2;
+    // DB07  LDA #$40
+    RecompiledBegin(ctx, 0xDB07); cpu.A = 0x40; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // DB09  DEC $0400
+    { RecompiledBegin(ctx, 0xDB09); const byte result = static_cast<byte>(bus.read(0x0400) - 1); bus.write(0x0400, result); SetNZ(cpu, result); cpu.totalCycles += 6; }
+    // DB0C  SBC ($33),Y
+    { RecompiledBegin(ctx, 0xDB0C); const memAddress pointer = RecompiledWord(bus.read(0x33), bus.read(0x34)); const memAddress ea = static_cast<memAddress>(pointer + cpu.Y); SubtractBinary(cpu, bus.read(ea)); cpu.totalCycles += 5 + (((ea & 0xFF00) != (pointer & 0xFF00)) ? 1 : 0); }
+    // DB0E  BEQ $DB1A
+    RecompiledBegin(ctx, 0xDB0E); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xDB1A; return; }
+    // DB10  BMI $DB1A
+    RecompiledBegin(ctx, 0xDB10); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xDB1A; return; }
+    // DB12  BCC $DB1A
+    RecompiledBegin(ctx, 0xDB12); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xDB1A; return; }
+    // DB14  BVS $DB1A
+    RecompiledBegin(ctx, 0xDB14); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xDB1A; return; }
+    // DB16  CMP #$01
+    RecompiledBegin(ctx, 0xDB16); Compare(cpu, cpu.A, 0x01); cpu.totalCycles += 2;
+    // DB18  BEQ $DB1C
+    RecompiledBegin(ctx, 0xDB18); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xDB1C; return; }
+    cpu.PC = 0xDB1A;
+}
+
+static void Block_DB1A(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // DB1A  STX $00
+    RecompiledBegin(ctx, 0xDB1A); bus.write(0x0000, cpu.X); cpu.totalCycles += 3;
+    cpu.PC = 0xDB1C;
+}
+
+static void Block_DB1C(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // DB1C  INX
+    RecompiledBegin(ctx, 0xDB1C); cpu.X++; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // DB1D  LDA #$40
+    RecompiledBegin(ctx, 0xDB1D); cpu.A = 0x40; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // DB1F  SEC
+    RecompiledBegin(ctx, 0xDB1F); SetFlag(cpu, Flags::C, true); cpu.totalCycles += 2;
+    // DB20  BIT $01
+    RecompiledBegin(ctx, 0xDB20); BitTest(cpu, bus.read(0x0001)); cpu.totalCycles += 3;
+    // DB22  INC $0400
+    { RecompiledBegin(ctx, 0xDB22); const byte result = static_cast<byte>(bus.read(0x0400) + 1); bus.write(0x0400, result); SetNZ(cpu, result); cpu.totalCycles += 6; }
+    // DB25  INC $0400
+    { RecompiledBegin(ctx, 0xDB25); const byte result = static_cast<byte>(bus.read(0x0400) + 1); bus.write(0x0400, result); SetNZ(cpu, result); cpu.totalCycles += 6; }
+    // DB28  SBC ($33),Y
+    { RecompiledBegin(ctx, 0xDB28); const memAddress pointer = RecompiledWord(bus.read(0x33), bus.read(0x34)); const memAddress ea = static_cast<memAddress>(pointer + cpu.Y); SubtractBinary(cpu, bus.read(ea)); cpu.totalCycles += 5 + (((ea & 0xFF00) != (pointer & 0xFF00)) ? 1 : 0); }
+    // DB2A  BCS $DB36
+    RecompiledBegin(ctx, 0xDB2A); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xDB36; return; }
+    // DB2C  BEQ $DB36
+    RecompiledBegin(ctx, 0xDB2C); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xDB36; return; }
+    // DB2E  BPL $DB36
+    RecompiledBegin(ctx, 0xDB2E); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xDB36; return; }
+    // DB30  BVS $DB36
+    RecompiledBegin(ctx, 0xDB30); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xDB36; return; }
+    // DB32  CMP #$FF
+    RecompiledBegin(ctx, 0xDB32); Compare(cpu, cpu.A, 0xFF); cpu.totalCycles += 2;
+    // DB34  BEQ $DB38
+    RecompiledBegin(ctx, 0xDB34); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xDB38; return; }
+    cpu.PC = 0xDB36;
+}
+
+static void Block_DB36(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // DB36  STX $00
+    RecompiledBegin(ctx, 0xDB36); bus.write(0x0000, cpu.X); cpu.totalCycles += 3;
+    cpu.PC = 0xDB38;
+}
+
+static void Block_DB38(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // DB38  INX
+    RecompiledBegin(ctx, 0xDB38); cpu.X++; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // DB39  CLC
+    RecompiledBegin(ctx, 0xDB39); SetFlag(cpu, Flags::C, false); cpu.totalCycles += 2;
+    // DB3A  LDA #$00
+    RecompiledBegin(ctx, 0xDB3A); cpu.A = 0x00; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // DB3C  STA $0400
+    RecompiledBegin(ctx, 0xDB3C); bus.write(0x0400, cpu.A); cpu.totalCycles += 4;
+    // DB3F  LDA #$80
+    RecompiledBegin(ctx, 0xDB3F); cpu.A = 0x80; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // DB41  SBC ($33),Y
+    { RecompiledBegin(ctx, 0xDB41); const memAddress pointer = RecompiledWord(bus.read(0x33), bus.read(0x34)); const memAddress ea = static_cast<memAddress>(pointer + cpu.Y); SubtractBinary(cpu, bus.read(ea)); cpu.totalCycles += 5 + (((ea & 0xFF00) != (pointer & 0xFF00)) ? 1 : 0); }
+    // DB43  BCC $DB49
+    RecompiledBegin(ctx, 0xDB43); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xDB49; return; }
+    // DB45  CMP #$7F
+    RecompiledBegin(ctx, 0xDB45); Compare(cpu, cpu.A, 0x7F); cpu.totalCycles += 2;
+    // DB47  BEQ $DB4B
+    RecompiledBegin(ctx, 0xDB47); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xDB4B; return; }
+    cpu.PC = 0xDB49;
+}
+
+static void Block_DB49(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // DB49  STX $00
+    RecompiledBegin(ctx, 0xDB49); bus.write(0x0000, cpu.X); cpu.totalCycles += 3;
+    cpu.PC = 0xDB4B;
+}
+
+static void Block_DB4B(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // DB4B  INX
+    RecompiledBegin(ctx, 0xDB4B); cpu.X++; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // DB4C  SEC
+    RecompiledBegin(ctx, 0xDB4C); SetFlag(cpu, Flags::C, true); cpu.totalCycles += 2;
+    // DB4D  LDA #$7F
+    RecompiledBegin(ctx, 0xDB4D); cpu.A = 0x7F; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // DB4F  STA $0400
+    RecompiledBegin(ctx, 0xDB4F); bus.write(0x0400, cpu.A); cpu.totalCycles += 4;
+    // DB52  LDA #$81
+    RecompiledBegin(ctx, 0xDB52); cpu.A = 0x81; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // DB54  SBC ($33),Y
+    { RecompiledBegin(ctx, 0xDB54); const memAddress pointer = RecompiledWord(bus.read(0x33), bus.read(0x34)); const memAddress ea = static_cast<memAddress>(pointer + cpu.Y); SubtractBinary(cpu, bus.read(ea)); cpu.totalCycles += 5 + (((ea & 0xFF00) != (pointer & 0xFF00)) ? 1 : 0); }
+    // DB56  BVC $DB5E
+    RecompiledBegin(ctx, 0xDB56); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xDB5E; return; }
+    // DB58  BCC $DB5E
+    RecompiledBegin(ctx, 0xDB58); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xDB5E; return; }
+    // DB5A  CMP #$02
+    RecompiledBegin(ctx, 0xDB5A); Compare(cpu, cpu.A, 0x02); cpu.totalCycles += 2;
+    // DB5C  BEQ $DB60
+    RecompiledBegin(ctx, 0xDB5C); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xDB60; return; }
+    cpu.PC = 0xDB5E;
+}
+
+static void Block_DB5E(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // DB5E  STX $00
+    RecompiledBegin(ctx, 0xDB5E); bus.write(0x0000, cpu.X); cpu.totalCycles += 3;
+    cpu.PC = 0xDB60;
+}
+
+static void Block_DB60(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // DB60  INX
+    RecompiledBegin(ctx, 0xDB60); cpu.X++; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // DB61  LDA #$00
+    RecompiledBegin(ctx, 0xDB61); cpu.A = 0x00; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // DB63  LDA #$87
+    RecompiledBegin(ctx, 0xDB63); cpu.A = 0x87; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // DB65  STA ($33),Y
+    { RecompiledBegin(ctx, 0xDB65); const memAddress pointer = RecompiledWord(bus.read(0x33), bus.read(0x34)); const memAddress ea = static_cast<memAddress>(pointer + cpu.Y); bus.write(ea, cpu.A); cpu.totalCycles += 6; if (ctx.bus.codeWritten) { cpu.PC = 0xDB67; return; } }
+    // DB67  LDA $0400
+    RecompiledBegin(ctx, 0xDB67); cpu.A = bus.read(0x0400); SetNZ(cpu, cpu.A); cpu.totalCycles += 4;
+    // DB6A  CMP #$87
+    RecompiledBegin(ctx, 0xDB6A); Compare(cpu, cpu.A, 0x87); cpu.totalCycles += 2;
+    // DB6C  BEQ $DB70
+    RecompiledBegin(ctx, 0xDB6C); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xDB70; return; }
+    // DB6E  STX $00
+    RecompiledBegin(ctx, 0xDB6E); bus.write(0x0000, cpu.X); cpu.totalCycles += 3;
+    cpu.PC = 0xDB70;
+}
+
+static void Block_DB70(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // DB70  INX
+    RecompiledBegin(ctx, 0xDB70); cpu.X++; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // DB71  LDA #$7E
+    RecompiledBegin(ctx, 0xDB71); cpu.A = 0x7E; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // DB73  STA $0200
+    RecompiledBegin(ctx, 0xDB73); bus.write(0x0200, cpu.A); cpu.totalCycles += 4;
+    // DB76  LDA #$DB
+    RecompiledBegin(ctx, 0xDB76); cpu.A = 0xDB; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // DB78  STA $0201
+    RecompiledBegin(ctx, 0xDB78); bus.write(0x0201, cpu.A); cpu.totalCycles += 4;
+    // DB7B  JMP ($0200)
+    RecompiledBegin(ctx, 0xDB7B); cpu.totalCycles += 5; cpu.PC = RecompiledWord(bus.read(0x0200), bus.read(0x0201)); return;
+}
+
+static void Block_DBB8(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // DBB8  LDA #$FF
+    RecompiledBegin(ctx, 0xDBB8); cpu.A = 0xFF; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // DBBA  STA $01
+    RecompiledBegin(ctx, 0xDBBA); bus.write(0x0001, cpu.A); cpu.totalCycles += 3;
+    // DBBC  LDA #$AA
+    RecompiledBegin(ctx, 0xDBBC); cpu.A = 0xAA; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // DBBE  STA $33
+    RecompiledBegin(ctx, 0xDBBE); bus.write(0x0033, cpu.A); cpu.totalCycles += 3;
+    // DBC0  LDA #$BB
+    RecompiledBegin(ctx, 0xDBC0); cpu.A = 0xBB; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // DBC2  STA $89
+    RecompiledBegin(ctx, 0xDBC2); bus.write(0x0089, cpu.A); cpu.totalCycles += 3;
+    // DBC4  LDX #$00
+    RecompiledBegin(ctx, 0xDBC4); cpu.X = 0x00; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // DBC6  LDA #$66
+    RecompiledBegin(ctx, 0xDBC6); cpu.A = 0x66; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // DBC8  BIT $01
+    RecompiledBegin(ctx, 0xDBC8); BitTest(cpu, bus.read(0x0001)); cpu.totalCycles += 3;
+    // DBCA  SEC
+    RecompiledBegin(ctx, 0xDBCA); SetFlag(cpu, Flags::C, true); cpu.totalCycles += 2;
+    // DBCB  LDY #$00
+    RecompiledBegin(ctx, 0xDBCB); cpu.Y = 0x00; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // DBCD  LDY $33,X
+    { RecompiledBegin(ctx, 0xDBCD); const memAddress ea = static_cast<byte>(0x33 + cpu.X); cpu.Y = bus.read(ea); SetNZ(cpu, cpu.Y); cpu.totalCycles += 4; }
+    // DBCF  BPL $DBE3
+    RecompiledBegin(ctx, 0xDBCF); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xDBE3; return; }
+    // DBD1  BEQ $DBE3
+    RecompiledBegin(ctx, 0xDBD1); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xDBE3; return; }
+    // DBD3  BVC $DBE3
+    RecompiledBegin(ctx, 0xDBD3); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xDBE3; return; }
+    // DBD5  BCC $DBE3
+    RecompiledBegin(ctx, 0xDBD5); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xDBE3; return; }
+    // DBD7  CMP #$66
+    RecompiledBegin(ctx, 0xDBD7); Compare(cpu, cpu.A, 0x66); cpu.totalCycles += 2;
+    // DBD9  BNE $DBE3
+    RecompiledBegin(ctx, 0xDBD9); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xDBE3; return; }
+    // DBDB  CPX #$00
+    RecompiledBegin(ctx, 0xDBDB); Compare(cpu, cpu.X, 0x00); cpu.totalCycles += 2;
+    // DBDD  BNE $DBE3
+    RecompiledBegin(ctx, 0xDBDD); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xDBE3; return; }
+    // DBDF  CPY #$AA
+    RecompiledBegin(ctx, 0xDBDF); Compare(cpu, cpu.Y, 0xAA); cpu.totalCycles += 2;
+    // DBE1  BEQ $DBE7
+    RecompiledBegin(ctx, 0xDBE1); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xDBE7; return; }
+    cpu.PC = 0xDBE3;
+}
+
+static void Block_DBE3(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // DBE3  LDA #$08
+    RecompiledBegin(ctx, 0xDBE3); cpu.A = 0x08; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // DBE5  STA $00
+    RecompiledBegin(ctx, 0xDBE5); bus.write(0x0000, cpu.A); cpu.totalCycles += 3;
+    cpu.PC = 0xDBE7;
+}
+
+static void Block_DBE7(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // DBE7  LDX #$8A
+    RecompiledBegin(ctx, 0xDBE7); cpu.X = 0x8A; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // DBE9  LDA #$66
+    RecompiledBegin(ctx, 0xDBE9); cpu.A = 0x66; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // DBEB  CLV
+    RecompiledBegin(ctx, 0xDBEB); SetFlag(cpu, Flags::V, false); cpu.totalCycles += 2;
+    // DBEC  CLC
+    RecompiledBegin(ctx, 0xDBEC); SetFlag(cpu, Flags::C, false); cpu.totalCycles += 2;
+    // DBED  LDY #$00
+    RecompiledBegin(ctx, 0xDBED); cpu.Y = 0x00; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // DBEF  LDY $FF,X
+    { RecompiledBegin(ctx, 0xDBEF); const memAddress ea = static_cast<byte>(0xFF + cpu.X); cpu.Y = bus.read(ea); SetNZ(cpu, cpu.Y); cpu.totalCycles += 4; }
+    // DBF1  BPL $DC05
+    RecompiledBegin(ctx, 0xDBF1); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::N)) { cpu.totalCycles += 2; cpu.PC = 0xDC05; return; }
+    // DBF3  BEQ $DC05
+    RecompiledBegin(ctx, 0xDBF3); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 2; cpu.PC = 0xDC05; return; }
+    // DBF5  BVS $DC05
+    RecompiledBegin(ctx, 0xDBF5); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::V)) { cpu.totalCycles += 2; cpu.PC = 0xDC05; return; }
+    // DBF7  BCS $DC05
+    RecompiledBegin(ctx, 0xDBF7); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::C)) { cpu.totalCycles += 2; cpu.PC = 0xDC05; return; }
+    // DBF9  CPY #$BB
+    RecompiledBegin(ctx, 0xDBF9); Compare(cpu, cpu.Y, 0xBB); cpu.totalCycles += 2;
+    // DBFB  BNE $DC05
+    RecompiledBegin(ctx, 0xDBFB); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 2; cpu.PC = 0xDC05; return; }
+    // DBFD  CMP #$66
+    RecompiledBegin(ctx, 0xDBFD); Compare(cpu, cpu.A, 0x66); cpu.totalCycles += 2;
+    // DBFF  BNE $DC05
+    RecompiledBegin(ctx, 0xDBFF); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xDC05; return; }
+    // DC01  CPX #$8A
+    RecompiledBegin(ctx, 0xDC01); Compare(cpu, cpu.X, 0x8A); cpu.totalCycles += 2;
+    // DC03  BEQ $DC09
+    RecompiledBegin(ctx, 0xDC03); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xDC09; return; }
+    cpu.PC = 0xDC05;
+}
+
+static void Block_DC05(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // DC05  LDA #$09
+    RecompiledBegin(ctx, 0xDC05); cpu.A = 0x09; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // DC07  STA $00
+    RecompiledBegin(ctx, 0xDC07); bus.write(0x0000, cpu.A); cpu.totalCycles += 3;
+    cpu.PC = 0xDC09;
+}
+
+static void Block_DC09(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // DC09  BIT $01
+    RecompiledBegin(ctx, 0xDC09); BitTest(cpu, bus.read(0x0001)); cpu.totalCycles += 3;
+    // DC0B  SEC
+    RecompiledBegin(ctx, 0xDC0B); SetFlag(cpu, Flags::C, true); cpu.totalCycles += 2;
+    // DC0C  LDY #$44
+    RecompiledBegin(ctx, 0xDC0C); cpu.Y = 0x44; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // DC0E  LDX #$00
+    RecompiledBegin(ctx, 0xDC0E); cpu.X = 0x00; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // DC10  STY $33,X
+    { RecompiledBegin(ctx, 0xDC10); const memAddress ea = static_cast<byte>(0x33 + cpu.X); bus.write(ea, cpu.Y); cpu.totalCycles += 4; }
+    // DC12  LDA $33
+    RecompiledBegin(ctx, 0xDC12); cpu.A = bus.read(0x0033); SetNZ(cpu, cpu.A); cpu.totalCycles += 3;
+    // DC14  BCC $DC2E
+    RecompiledBegin(ctx, 0xDC14); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xDC2E; return; }
+    // DC16  CMP #$44
+    RecompiledBegin(ctx, 0xDC16); Compare(cpu, cpu.A, 0x44); cpu.totalCycles += 2;
+    // DC18  BNE $DC2E
+    RecompiledBegin(ctx, 0xDC18); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xDC2E; return; }
+    // DC1A  BVC $DC2E
+    RecompiledBegin(ctx, 0xDC1A); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xDC2E; return; }
+    // DC1C  CLC
+    RecompiledBegin(ctx, 0xDC1C); SetFlag(cpu, Flags::C, false); cpu.totalCycles += 2;
+    // DC1D  CLV
+    RecompiledBegin(ctx, 0xDC1D); SetFlag(cpu, Flags::V, false); cpu.totalCycles += 2;
+    // DC1E  LDY #$99
+    RecompiledBegin(ctx, 0xDC1E); cpu.Y = 0x99; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // DC20  LDX #$80
+    RecompiledBegin(ctx, 0xDC20); cpu.X = 0x80; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // DC22  STY $85,X
+    { RecompiledBegin(ctx, 0xDC22); const memAddress ea = static_cast<byte>(0x85 + cpu.X); bus.write(ea, cpu.Y); cpu.totalCycles += 4; }
+    // DC24  LDA $05
+    RecompiledBegin(ctx, 0xDC24); cpu.A = bus.read(0x0005); SetNZ(cpu, cpu.A); cpu.totalCycles += 3;
+    // DC26  BCS $DC2E
+    RecompiledBegin(ctx, 0xDC26); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xDC2E; return; }
+    // DC28  CMP #$99
+    RecompiledBegin(ctx, 0xDC28); Compare(cpu, cpu.A, 0x99); cpu.totalCycles += 2;
+    // DC2A  BNE $DC2E
+    RecompiledBegin(ctx, 0xDC2A); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xDC2E; return; }
+    // DC2C  BVC $DC32
+    RecompiledBegin(ctx, 0xDC2C); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xDC32; return; }
+    cpu.PC = 0xDC2E;
+}
+
+static void Block_DC2E(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // DC2E  LDA #$0A
+    RecompiledBegin(ctx, 0xDC2E); cpu.A = 0x0A; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // DC30  STA $00
+    RecompiledBegin(ctx, 0xDC30); bus.write(0x0000, cpu.A); cpu.totalCycles += 3;
+    cpu.PC = 0xDC32;
+}
+
+static void Block_DC32(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // DC32  LDY #$0B
+    RecompiledBegin(ctx, 0xDC32); cpu.Y = 0x0B; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // DC34  LDA #$AA
+    RecompiledBegin(ctx, 0xDC34); cpu.A = 0xAA; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // DC36  LDX #$78
+    RecompiledBegin(ctx, 0xDC36); cpu.X = 0x78; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // DC38  STA $78
+    RecompiledBegin(ctx, 0xDC38); bus.write(0x0078, cpu.A); cpu.totalCycles += 3;
+    // DC3A  JSR $F7B6
+    RecompiledBegin(ctx, 0xDC3A); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xDC); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x3C); cpu.totalCycles += 6; cpu.PC = 0xF7B6; return;
+}
+
+static void Block_DC3D(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // DC3D  ORA $00,X
+    { RecompiledBegin(ctx, 0xDC3D); const memAddress ea = static_cast<byte>(0x00 + cpu.X); cpu.A = static_cast<byte>(cpu.A | bus.read(ea)); SetNZ(cpu, cpu.A); cpu.totalCycles += 4; }
+    // DC3F  JSR $F7C0
+    RecompiledBegin(ctx, 0xDC3F); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xDC); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x41); cpu.totalCycles += 6; cpu.PC = 0xF7C0; return;
+}
+
+static void Block_DC42(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // DC42  INY
+    RecompiledBegin(ctx, 0xDC42); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // DC43  LDA #$00
+    RecompiledBegin(ctx, 0xDC43); cpu.A = 0x00; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // DC45  STA $78
+    RecompiledBegin(ctx, 0xDC45); bus.write(0x0078, cpu.A); cpu.totalCycles += 3;
+    // DC47  JSR $F7CE
+    RecompiledBegin(ctx, 0xDC47); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xDC); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x49); cpu.totalCycles += 6; cpu.PC = 0xF7CE; return;
+}
+
+static void Block_DC4A(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // DC4A  ORA $00,X
+    { RecompiledBegin(ctx, 0xDC4A); const memAddress ea = static_cast<byte>(0x00 + cpu.X); cpu.A = static_cast<byte>(cpu.A | bus.read(ea)); SetNZ(cpu, cpu.A); cpu.totalCycles += 4; }
+    // DC4C  JSR $F7D3
+    RecompiledBegin(ctx, 0xDC4C); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xDC); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x4E); cpu.totalCycles += 6; cpu.PC = 0xF7D3; return;
+}
+
+static void Block_DC4F(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // DC4F  INY
+    RecompiledBegin(ctx, 0xDC4F); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // DC50  LDA #$AA
+    RecompiledBegin(ctx, 0xDC50); cpu.A = 0xAA; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // DC52  STA $78
+    RecompiledBegin(ctx, 0xDC52); bus.write(0x0078, cpu.A); cpu.totalCycles += 3;
+    // DC54  JSR $F7DF
+    RecompiledBegin(ctx, 0xDC54); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xDC); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x56); cpu.totalCycles += 6; cpu.PC = 0xF7DF; return;
+}
+
+static void Block_DC57(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // DC57  AND $00,X
+    { RecompiledBegin(ctx, 0xDC57); const memAddress ea = static_cast<byte>(0x00 + cpu.X); cpu.A = static_cast<byte>(cpu.A & bus.read(ea)); SetNZ(cpu, cpu.A); cpu.totalCycles += 4; }
+    // DC59  JSR $F7E5
+    RecompiledBegin(ctx, 0xDC59); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xDC); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x5B); cpu.totalCycles += 6; cpu.PC = 0xF7E5; return;
+}
+
+static void Block_DC5C(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // DC5C  INY
+    RecompiledBegin(ctx, 0xDC5C); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // DC5D  LDA #$EF
+    RecompiledBegin(ctx, 0xDC5D); cpu.A = 0xEF; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // DC5F  STA $78
+    RecompiledBegin(ctx, 0xDC5F); bus.write(0x0078, cpu.A); cpu.totalCycles += 3;
+    // DC61  JSR $F7F1
+    RecompiledBegin(ctx, 0xDC61); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xDC); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x63); cpu.totalCycles += 6; cpu.PC = 0xF7F1; return;
+}
+
+static void Block_DC64(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // DC64  AND $00,X
+    { RecompiledBegin(ctx, 0xDC64); const memAddress ea = static_cast<byte>(0x00 + cpu.X); cpu.A = static_cast<byte>(cpu.A & bus.read(ea)); SetNZ(cpu, cpu.A); cpu.totalCycles += 4; }
+    // DC66  JSR $F7F6
+    RecompiledBegin(ctx, 0xDC66); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xDC); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x68); cpu.totalCycles += 6; cpu.PC = 0xF7F6; return;
+}
+
+static void Block_DC69(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // DC69  INY
+    RecompiledBegin(ctx, 0xDC69); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // DC6A  LDA #$AA
+    RecompiledBegin(ctx, 0xDC6A); cpu.A = 0xAA; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // DC6C  STA $78
+    RecompiledBegin(ctx, 0xDC6C); bus.write(0x0078, cpu.A); cpu.totalCycles += 3;
+    // DC6E  JSR $F804
+    RecompiledBegin(ctx, 0xDC6E); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xDC); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x70); cpu.totalCycles += 6; cpu.PC = 0xF804; return;
+}
+
+static void Block_DC71(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // DC71  EOR $00,X
+    { RecompiledBegin(ctx, 0xDC71); const memAddress ea = static_cast<byte>(0x00 + cpu.X); cpu.A = static_cast<byte>(cpu.A ^ bus.read(ea)); SetNZ(cpu, cpu.A); cpu.totalCycles += 4; }
+    // DC73  JSR $F80A
+    RecompiledBegin(ctx, 0xDC73); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xDC); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x75); cpu.totalCycles += 6; cpu.PC = 0xF80A; return;
+}
+
+static void Block_DC76(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // DC76  INY
+    RecompiledBegin(ctx, 0xDC76); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // DC77  LDA #$70
+    RecompiledBegin(ctx, 0xDC77); cpu.A = 0x70; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // DC79  STA $78
+    RecompiledBegin(ctx, 0xDC79); bus.write(0x0078, cpu.A); cpu.totalCycles += 3;
+    // DC7B  JSR $F818
+    RecompiledBegin(ctx, 0xDC7B); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xDC); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x7D); cpu.totalCycles += 6; cpu.PC = 0xF818; return;
+}
+
+static void Block_DC7E(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // DC7E  EOR $00,X
+    { RecompiledBegin(ctx, 0xDC7E); const memAddress ea = static_cast<byte>(0x00 + cpu.X); cpu.A = static_cast<byte>(cpu.A ^ bus.read(ea)); SetNZ(cpu, cpu.A); cpu.totalCycles += 4; }
+    // DC80  JSR $F81D
+    RecompiledBegin(ctx, 0xDC80); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xDC); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x82); cpu.totalCycles += 6; cpu.PC = 0xF81D; return;
+}
+
+static void Block_DC83(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // DC83  INY
+    RecompiledBegin(ctx, 0xDC83); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // DC84  LDA #$69
+    RecompiledBegin(ctx, 0xDC84); cpu.A = 0x69; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // DC86  STA $78
+    RecompiledBegin(ctx, 0xDC86); bus.write(0x0078, cpu.A); cpu.totalCycles += 3;
+    // DC88  JSR $F829
+    RecompiledBegin(ctx, 0xDC88); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xDC); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x8A); cpu.totalCycles += 6; cpu.PC = 0xF829; return;
+}
+
+static void Block_DC8B(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // DC8B  ADC $00,X
+    { RecompiledBegin(ctx, 0xDC8B); const memAddress ea = static_cast<byte>(0x00 + cpu.X); AddBinary(cpu, bus.read(ea)); cpu.totalCycles += 4; }
+    // DC8D  JSR $F82F
+    RecompiledBegin(ctx, 0xDC8D); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xDC); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x8F); cpu.totalCycles += 6; cpu.PC = 0xF82F; return;
+}
+
+static void Block_DC90(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // DC90  INY
+    RecompiledBegin(ctx, 0xDC90); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // DC91  JSR $F83D
+    RecompiledBegin(ctx, 0xDC91); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xDC); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x93); cpu.totalCycles += 6; cpu.PC = 0xF83D; return;
+}
+
+static void Block_DC94(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // DC94  ADC $00,X
+    { RecompiledBegin(ctx, 0xDC94); const memAddress ea = static_cast<byte>(0x00 + cpu.X); AddBinary(cpu, bus.read(ea)); cpu.totalCycles += 4; }
+    // DC96  JSR $F843
+    RecompiledBegin(ctx, 0xDC96); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xDC); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x98); cpu.totalCycles += 6; cpu.PC = 0xF843; return;
+}
+
+static void Block_DC99(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // DC99  INY
+    RecompiledBegin(ctx, 0xDC99); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // DC9A  LDA #$7F
+    RecompiledBegin(ctx, 0xDC9A); cpu.A = 0x7F; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // DC9C  STA $78
+    RecompiledBegin(ctx, 0xDC9C); bus.write(0x0078, cpu.A); cpu.totalCycles += 3;
+    // DC9E  JSR $F851
+    RecompiledBegin(ctx, 0xDC9E); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xDC); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xA0); cpu.totalCycles += 6; cpu.PC = 0xF851; return;
+}
+
+static void Block_DCA1(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // DCA1  ADC $00,X
+    { RecompiledBegin(ctx, 0xDCA1); const memAddress ea = static_cast<byte>(0x00 + cpu.X); AddBinary(cpu, bus.read(ea)); cpu.totalCycles += 4; }
+    // DCA3  JSR $F856
+    RecompiledBegin(ctx, 0xDCA3); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xDC); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xA5); cpu.totalCycles += 6; cpu.PC = 0xF856; return;
+}
+
+static void Block_DCA6(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // DCA6  INY
+    RecompiledBegin(ctx, 0xDCA6); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // DCA7  LDA #$80
+    RecompiledBegin(ctx, 0xDCA7); cpu.A = 0x80; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // DCA9  STA $78
+    RecompiledBegin(ctx, 0xDCA9); bus.write(0x0078, cpu.A); cpu.totalCycles += 3;
+    // DCAB  JSR $F864
+    RecompiledBegin(ctx, 0xDCAB); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xDC); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xAD); cpu.totalCycles += 6; cpu.PC = 0xF864; return;
+}
+
+static void Block_DCAE(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // DCAE  ADC $00,X
+    { RecompiledBegin(ctx, 0xDCAE); const memAddress ea = static_cast<byte>(0x00 + cpu.X); AddBinary(cpu, bus.read(ea)); cpu.totalCycles += 4; }
+    // DCB0  JSR $F86A
+    RecompiledBegin(ctx, 0xDCB0); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xDC); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xB2); cpu.totalCycles += 6; cpu.PC = 0xF86A; return;
+}
+
+static void Block_DCB3(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // DCB3  INY
+    RecompiledBegin(ctx, 0xDCB3); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // DCB4  JSR $F878
+    RecompiledBegin(ctx, 0xDCB4); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xDC); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xB6); cpu.totalCycles += 6; cpu.PC = 0xF878; return;
+}
+
+static void Block_DCB7(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // DCB7  ADC $00,X
+    { RecompiledBegin(ctx, 0xDCB7); const memAddress ea = static_cast<byte>(0x00 + cpu.X); AddBinary(cpu, bus.read(ea)); cpu.totalCycles += 4; }
+    // DCB9  JSR $F87D
+    RecompiledBegin(ctx, 0xDCB9); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xDC); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xBB); cpu.totalCycles += 6; cpu.PC = 0xF87D; return;
+}
+
+static void Block_DCBC(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // DCBC  INY
+    RecompiledBegin(ctx, 0xDCBC); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // DCBD  LDA #$40
+    RecompiledBegin(ctx, 0xDCBD); cpu.A = 0x40; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // DCBF  STA $78
+    RecompiledBegin(ctx, 0xDCBF); bus.write(0x0078, cpu.A); cpu.totalCycles += 3;
+    // DCC1  JSR $F889
+    RecompiledBegin(ctx, 0xDCC1); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xDC); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xC3); cpu.totalCycles += 6; cpu.PC = 0xF889; return;
+}
+
+static void Block_DCC4(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // DCC4  CMP $00,X
+    { RecompiledBegin(ctx, 0xDCC4); const memAddress ea = static_cast<byte>(0x00 + cpu.X); Compare(cpu, cpu.A, bus.read(ea)); cpu.totalCycles += 4; }
+    // DCC6  JSR $F88E
+    RecompiledBegin(ctx, 0xDCC6); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xDC); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xC8); cpu.totalCycles += 6; cpu.PC = 0xF88E; return;
+}
+
+static void Block_DCC9(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // DCC9  INY
+    RecompiledBegin(ctx, 0xDCC9); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // DCCA  PHA
+    RecompiledBegin(ctx, 0xDCCA); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), cpu.A); cpu.totalCycles += 3;
+    // DCCB  LDA #$3F
+    RecompiledBegin(ctx, 0xDCCB); cpu.A = 0x3F; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // DCCD  STA $78
+    RecompiledBegin(ctx, 0xDCCD); bus.write(0x0078, cpu.A); cpu.totalCycles += 3;
+    // DCCF  PLA
+    RecompiledBegin(ctx, 0xDCCF); cpu.SP++; cpu.A = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); SetNZ(cpu, cpu.A); cpu.totalCycles += 4;
+    // DCD0  JSR $F89A
+    RecompiledBegin(ctx, 0xDCD0); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xDC); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD2); cpu.totalCycles += 6; cpu.PC = 0xF89A; return;
+}
+
+static void Block_DCD3(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // DCD3  CMP $00,X
+    { RecompiledBegin(ctx, 0xDCD3); const memAddress ea = static_cast<byte>(0x00 + cpu.X); Compare(cpu, cpu.A, bus.read(ea)); cpu.totalCycles += 4; }
+    // DCD5  JSR $F89C
+    RecompiledBegin(ctx, 0xDCD5); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xDC); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD7); cpu.totalCycles += 6; cpu.PC = 0xF89C; return;
+}
+
+static void Block_DCD8(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // DCD8  INY
+    RecompiledBegin(ctx, 0xDCD8); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // DCD9  PHA
+    RecompiledBegin(ctx, 0xDCD9); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), cpu.A); cpu.totalCycles += 3;
+    // DCDA  LDA #$41
+    RecompiledBegin(ctx, 0xDCDA); cpu.A = 0x41; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // DCDC  STA $78
+    RecompiledBegin(ctx, 0xDCDC); bus.write(0x0078, cpu.A); cpu.totalCycles += 3;
+    // DCDE  PLA
+    RecompiledBegin(ctx, 0xDCDE); cpu.SP++; cpu.A = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); SetNZ(cpu, cpu.A); cpu.totalCycles += 4;
+    // DCDF  CMP $00,X
+    { RecompiledBegin(ctx, 0xDCDF); const memAddress ea = static_cast<byte>(0x00 + cpu.X); Compare(cpu, cpu.A, bus.read(ea)); cpu.totalCycles += 4; }
+    // DCE1  JSR $F8A8
+    RecompiledBegin(ctx, 0xDCE1); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xDC); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xE3); cpu.totalCycles += 6; cpu.PC = 0xF8A8; return;
+}
+
+static void Block_DCE4(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // DCE4  INY
+    RecompiledBegin(ctx, 0xDCE4); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // DCE5  PHA
+    RecompiledBegin(ctx, 0xDCE5); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), cpu.A); cpu.totalCycles += 3;
+    // DCE6  LDA #$00
+    RecompiledBegin(ctx, 0xDCE6); cpu.A = 0x00; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // DCE8  STA $78
+    RecompiledBegin(ctx, 0xDCE8); bus.write(0x0078, cpu.A); cpu.totalCycles += 3;
+    // DCEA  PLA
+    RecompiledBegin(ctx, 0xDCEA); cpu.SP++; cpu.A = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); SetNZ(cpu, cpu.A); cpu.totalCycles += 4;
+    // DCEB  JSR $F8B2
+    RecompiledBegin(ctx, 0xDCEB); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xDC); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xED); cpu.totalCycles += 6; cpu.PC = 0xF8B2; return;
+}
+
+static void Block_DCEE(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // DCEE  CMP $00,X
+    { RecompiledBegin(ctx, 0xDCEE); const memAddress ea = static_cast<byte>(0x00 + cpu.X); Compare(cpu, cpu.A, bus.read(ea)); cpu.totalCycles += 4; }
+    // DCF0  JSR $F8B5
+    RecompiledBegin(ctx, 0xDCF0); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xDC); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xF2); cpu.totalCycles += 6; cpu.PC = 0xF8B5; return;
+}
+
+static void Block_DCF3(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // DCF3  INY
+    RecompiledBegin(ctx, 0xDCF3); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // DCF4  PHA
+    RecompiledBegin(ctx, 0xDCF4); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), cpu.A); cpu.totalCycles += 3;
+    // DCF5  LDA #$80
+    RecompiledBegin(ctx, 0xDCF5); cpu.A = 0x80; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // DCF7  STA $78
+    RecompiledBegin(ctx, 0xDCF7); bus.write(0x0078, cpu.A); cpu.totalCycles += 3;
+    // DCF9  PLA
+    RecompiledBegin(ctx, 0xDCF9); cpu.SP++; cpu.A = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); SetNZ(cpu, cpu.A); cpu.totalCycles += 4;
+    // DCFA  CMP $00,X
+    { RecompiledBegin(ctx, 0xDCFA); const memAddress ea = static_cast<byte>(0x00 + cpu.X); Compare(cpu, cpu.A, bus.read(ea)); cpu.totalCycles += 4; }
+    // DCFC  JSR $F8BF
+    RecompiledBegin(ctx, 0xDCFC); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xDC); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xFE); cpu.totalCycles += 6; cpu.PC = 0xF8BF; return;
+}
+
+static void Block_DCFF(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // DCFF  INY
+    RecompiledBegin(ctx, 0xDCFF); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // DD00  PHA
+    RecompiledBegin(ctx, 0xDD00); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), cpu.A); cpu.totalCycles += 3;
+    // DD01  LDA #$81
+    RecompiledBegin(ctx, 0xDD01); cpu.A = 0x81; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // DD03  STA $78
+    RecompiledBegin(ctx, 0xDD03); bus.write(0x0078, cpu.A); cpu.totalCycles += 3;
+    // DD05  PLA
+    RecompiledBegin(ctx, 0xDD05); cpu.SP++; cpu.A = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); SetNZ(cpu, cpu.A); cpu.totalCycles += 4;
+    // DD06  CMP $00,X
+    { RecompiledBegin(ctx, 0xDD06); const memAddress ea = static_cast<byte>(0x00 + cpu.X); Compare(cpu, cpu.A, bus.read(ea)); cpu.totalCycles += 4; }
+    // DD08  JSR $F8C9
+    RecompiledBegin(ctx, 0xDD08); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xDD); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x0A); cpu.totalCycles += 6; cpu.PC = 0xF8C9; return;
+}
+
+static void Block_DD0B(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // DD0B  INY
+    RecompiledBegin(ctx, 0xDD0B); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // DD0C  PHA
+    RecompiledBegin(ctx, 0xDD0C); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), cpu.A); cpu.totalCycles += 3;
+    // DD0D  LDA #$7F
+    RecompiledBegin(ctx, 0xDD0D); cpu.A = 0x7F; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // DD0F  STA $78
+    RecompiledBegin(ctx, 0xDD0F); bus.write(0x0078, cpu.A); cpu.totalCycles += 3;
+    // DD11  PLA
+    RecompiledBegin(ctx, 0xDD11); cpu.SP++; cpu.A = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); SetNZ(cpu, cpu.A); cpu.totalCycles += 4;
+    // DD12  CMP $00,X
+    { RecompiledBegin(ctx, 0xDD12); const memAddress ea = static_cast<byte>(0x00 + cpu.X); Compare(cpu, cpu.A, bus.read(ea)); cpu.totalCycles += 4; }
+    // DD14  JSR $F8D3
+    RecompiledBegin(ctx, 0xDD14); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xDD); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x16); cpu.totalCycles += 6; cpu.PC = 0xF8D3; return;
+}
+
+static void Block_DD17(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // DD17  INY
+    RecompiledBegin(ctx, 0xDD17); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // DD18  LDA #$40
+    RecompiledBegin(ctx, 0xDD18); cpu.A = 0x40; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // DD1A  STA $78
+    RecompiledBegin(ctx, 0xDD1A); bus.write(0x0078, cpu.A); cpu.totalCycles += 3;
+    // DD1C  JSR $F931
+    RecompiledBegin(ctx, 0xDD1C); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xDD); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x1E); cpu.totalCycles += 6; cpu.PC = 0xF931; return;
+}
+
+static void Block_DD1F(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // DD1F  SBC $00,X
+    { RecompiledBegin(ctx, 0xDD1F); const memAddress ea = static_cast<byte>(0x00 + cpu.X); SubtractBinary(cpu, bus.read(ea)); cpu.totalCycles += 4; }
+    // DD21  JSR $F937
+    RecompiledBegin(ctx, 0xDD21); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xDD); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x23); cpu.totalCycles += 6; cpu.PC = 0xF937; return;
+}
+
+static void Block_DD24(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // DD24  INY
+    RecompiledBegin(ctx, 0xDD24); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // DD25  LDA #$3F
+    RecompiledBegin(ctx, 0xDD25); cpu.A = 0x3F; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // DD27  STA $78
+    RecompiledBegin(ctx, 0xDD27); bus.write(0x0078, cpu.A); cpu.totalCycles += 3;
+    // DD29  JSR $F947
+    RecompiledBegin(ctx, 0xDD29); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xDD); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x2B); cpu.totalCycles += 6; cpu.PC = 0xF947; return;
+}
+
+static void Block_DD2C(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // DD2C  SBC $00,X
+    { RecompiledBegin(ctx, 0xDD2C); const memAddress ea = static_cast<byte>(0x00 + cpu.X); SubtractBinary(cpu, bus.read(ea)); cpu.totalCycles += 4; }
+    // DD2E  JSR $F94C
+    RecompiledBegin(ctx, 0xDD2E); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xDD); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x30); cpu.totalCycles += 6; cpu.PC = 0xF94C; return;
+}
+
+static void Block_DD31(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // DD31  INY
+    RecompiledBegin(ctx, 0xDD31); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // DD32  LDA #$41
+    RecompiledBegin(ctx, 0xDD32); cpu.A = 0x41; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // DD34  STA $78
+    RecompiledBegin(ctx, 0xDD34); bus.write(0x0078, cpu.A); cpu.totalCycles += 3;
+    // DD36  JSR $F95C
+    RecompiledBegin(ctx, 0xDD36); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xDD); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x38); cpu.totalCycles += 6; cpu.PC = 0xF95C; return;
+}
+
+static void Block_DD39(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // DD39  SBC $00,X
+    { RecompiledBegin(ctx, 0xDD39); const memAddress ea = static_cast<byte>(0x00 + cpu.X); SubtractBinary(cpu, bus.read(ea)); cpu.totalCycles += 4; }
+    // DD3B  JSR $F962
+    RecompiledBegin(ctx, 0xDD3B); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xDD); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x3D); cpu.totalCycles += 6; cpu.PC = 0xF962; return;
+}
+
+static void Block_DD3E(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // DD3E  INY
+    RecompiledBegin(ctx, 0xDD3E); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // DD3F  LDA #$00
+    RecompiledBegin(ctx, 0xDD3F); cpu.A = 0x00; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // DD41  STA $78
+    RecompiledBegin(ctx, 0xDD41); bus.write(0x0078, cpu.A); cpu.totalCycles += 3;
+    // DD43  JSR $F972
+    RecompiledBegin(ctx, 0xDD43); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xDD); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x45); cpu.totalCycles += 6; cpu.PC = 0xF972; return;
+}
+
+static void Block_DD46(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // DD46  SBC $00,X
+    { RecompiledBegin(ctx, 0xDD46); const memAddress ea = static_cast<byte>(0x00 + cpu.X); SubtractBinary(cpu, bus.read(ea)); cpu.totalCycles += 4; }
+    // DD48  JSR $F976
+    RecompiledBegin(ctx, 0xDD48); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xDD); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x4A); cpu.totalCycles += 6; cpu.PC = 0xF976; return;
+}
+
+static void Block_DD4B(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // DD4B  INY
+    RecompiledBegin(ctx, 0xDD4B); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // DD4C  LDA #$7F
+    RecompiledBegin(ctx, 0xDD4C); cpu.A = 0x7F; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // DD4E  STA $78
+    RecompiledBegin(ctx, 0xDD4E); bus.write(0x0078, cpu.A); cpu.totalCycles += 3;
+    // DD50  JSR $F980
+    RecompiledBegin(ctx, 0xDD50); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xDD); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x52); cpu.totalCycles += 6; cpu.PC = 0xF980; return;
+}
+
+static void Block_DD53(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // DD53  SBC $00,X
+    { RecompiledBegin(ctx, 0xDD53); const memAddress ea = static_cast<byte>(0x00 + cpu.X); SubtractBinary(cpu, bus.read(ea)); cpu.totalCycles += 4; }
+    // DD55  JSR $F984
+    RecompiledBegin(ctx, 0xDD55); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xDD); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x57); cpu.totalCycles += 6; cpu.PC = 0xF984; return;
+}
+
+static void Block_DD58(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // DD58  LDA #$AA
+    RecompiledBegin(ctx, 0xDD58); cpu.A = 0xAA; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // DD5A  STA $33
+    RecompiledBegin(ctx, 0xDD5A); bus.write(0x0033, cpu.A); cpu.totalCycles += 3;
+    // DD5C  LDA #$BB
+    RecompiledBegin(ctx, 0xDD5C); cpu.A = 0xBB; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // DD5E  STA $89
+    RecompiledBegin(ctx, 0xDD5E); bus.write(0x0089, cpu.A); cpu.totalCycles += 3;
+    // DD60  LDX #$00
+    RecompiledBegin(ctx, 0xDD60); cpu.X = 0x00; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // DD62  LDY #$66
+    RecompiledBegin(ctx, 0xDD62); cpu.Y = 0x66; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // DD64  BIT $01
+    RecompiledBegin(ctx, 0xDD64); BitTest(cpu, bus.read(0x0001)); cpu.totalCycles += 3;
+    // DD66  SEC
+    RecompiledBegin(ctx, 0xDD66); SetFlag(cpu, Flags::C, true); cpu.totalCycles += 2;
+    // DD67  LDA #$00
+    RecompiledBegin(ctx, 0xDD67); cpu.A = 0x00; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // DD69  LDA $33,X
+    { RecompiledBegin(ctx, 0xDD69); const memAddress ea = static_cast<byte>(0x33 + cpu.X); cpu.A = bus.read(ea); SetNZ(cpu, cpu.A); cpu.totalCycles += 4; }
+    // DD6B  BPL $DD7F
+    RecompiledBegin(ctx, 0xDD6B); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xDD7F; return; }
+    // DD6D  BEQ $DD7F
+    RecompiledBegin(ctx, 0xDD6D); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xDD7F; return; }
+    // DD6F  BVC $DD7F
+    RecompiledBegin(ctx, 0xDD6F); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xDD7F; return; }
+    // DD71  BCC $DD7F
+    RecompiledBegin(ctx, 0xDD71); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xDD7F; return; }
+    // DD73  CPY #$66
+    RecompiledBegin(ctx, 0xDD73); Compare(cpu, cpu.Y, 0x66); cpu.totalCycles += 2;
+    // DD75  BNE $DD7F
+    RecompiledBegin(ctx, 0xDD75); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xDD7F; return; }
+    // DD77  CPX #$00
+    RecompiledBegin(ctx, 0xDD77); Compare(cpu, cpu.X, 0x00); cpu.totalCycles += 2;
+    // DD79  BNE $DD7F
+    RecompiledBegin(ctx, 0xDD79); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xDD7F; return; }
+    // DD7B  CMP #$AA
+    RecompiledBegin(ctx, 0xDD7B); Compare(cpu, cpu.A, 0xAA); cpu.totalCycles += 2;
+    // DD7D  BEQ $DD83
+    RecompiledBegin(ctx, 0xDD7D); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xDD83; return; }
+    cpu.PC = 0xDD7F;
+}
+
+static void Block_DD7F(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // DD7F  LDA #$22
+    RecompiledBegin(ctx, 0xDD7F); cpu.A = 0x22; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // DD81  STA $00
+    RecompiledBegin(ctx, 0xDD81); bus.write(0x0000, cpu.A); cpu.totalCycles += 3;
+    cpu.PC = 0xDD83;
+}
+
+static void Block_DD83(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // DD83  LDX #$8A
+    RecompiledBegin(ctx, 0xDD83); cpu.X = 0x8A; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // DD85  LDY #$66
+    RecompiledBegin(ctx, 0xDD85); cpu.Y = 0x66; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // DD87  CLV
+    RecompiledBegin(ctx, 0xDD87); SetFlag(cpu, Flags::V, false); cpu.totalCycles += 2;
+    // DD88  CLC
+    RecompiledBegin(ctx, 0xDD88); SetFlag(cpu, Flags::C, false); cpu.totalCycles += 2;
+    // DD89  LDA #$00
+    RecompiledBegin(ctx, 0xDD89); cpu.A = 0x00; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // DD8B  LDA $FF,X
+    { RecompiledBegin(ctx, 0xDD8B); const memAddress ea = static_cast<byte>(0xFF + cpu.X); cpu.A = bus.read(ea); SetNZ(cpu, cpu.A); cpu.totalCycles += 4; }
+    // DD8D  BPL $DDA1
+    RecompiledBegin(ctx, 0xDD8D); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xDDA1; return; }
+    // DD8F  BEQ $DDA1
+    RecompiledBegin(ctx, 0xDD8F); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xDDA1; return; }
+    // DD91  BVS $DDA1
+    RecompiledBegin(ctx, 0xDD91); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xDDA1; return; }
+    // DD93  BCS $DDA1
+    RecompiledBegin(ctx, 0xDD93); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xDDA1; return; }
+    // DD95  CMP #$BB
+    RecompiledBegin(ctx, 0xDD95); Compare(cpu, cpu.A, 0xBB); cpu.totalCycles += 2;
+    // DD97  BNE $DDA1
+    RecompiledBegin(ctx, 0xDD97); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xDDA1; return; }
+    // DD99  CPY #$66
+    RecompiledBegin(ctx, 0xDD99); Compare(cpu, cpu.Y, 0x66); cpu.totalCycles += 2;
+    // DD9B  BNE $DDA1
+    RecompiledBegin(ctx, 0xDD9B); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xDDA1; return; }
+    // DD9D  CPX #$8A
+    RecompiledBegin(ctx, 0xDD9D); Compare(cpu, cpu.X, 0x8A); cpu.totalCycles += 2;
+    // DD9F  BEQ $DDA5
+    RecompiledBegin(ctx, 0xDD9F); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xDDA5; return; }
+    cpu.PC = 0xDDA1;
+}
+
+static void Block_DDA1(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // DDA1  LDA #$23
+    RecompiledBegin(ctx, 0xDDA1); cpu.A = 0x23; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // DDA3  STA $00
+    RecompiledBegin(ctx, 0xDDA3); bus.write(0x0000, cpu.A); cpu.totalCycles += 3;
+    cpu.PC = 0xDDA5;
+}
+
+static void Block_DDA5(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // DDA5  BIT $01
+    RecompiledBegin(ctx, 0xDDA5); BitTest(cpu, bus.read(0x0001)); cpu.totalCycles += 3;
+    // DDA7  SEC
+    RecompiledBegin(ctx, 0xDDA7); SetFlag(cpu, Flags::C, true); cpu.totalCycles += 2;
+    // DDA8  LDA #$44
+    RecompiledBegin(ctx, 0xDDA8); cpu.A = 0x44; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // DDAA  LDX #$00
+    RecompiledBegin(ctx, 0xDDAA); cpu.X = 0x00; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // DDAC  STA $33,X
+    { RecompiledBegin(ctx, 0xDDAC); const memAddress ea = static_cast<byte>(0x33 + cpu.X); bus.write(ea, cpu.A); cpu.totalCycles += 4; }
+    // DDAE  LDA $33
+    RecompiledBegin(ctx, 0xDDAE); cpu.A = bus.read(0x0033); SetNZ(cpu, cpu.A); cpu.totalCycles += 3;
+    // DDB0  BCC $DDCA
+    RecompiledBegin(ctx, 0xDDB0); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xDDCA; return; }
+    // DDB2  CMP #$44
+    RecompiledBegin(ctx, 0xDDB2); Compare(cpu, cpu.A, 0x44); cpu.totalCycles += 2;
+    // DDB4  BNE $DDCA
+    RecompiledBegin(ctx, 0xDDB4); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xDDCA; return; }
+    // DDB6  BVC $DDCA
+    RecompiledBegin(ctx, 0xDDB6); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xDDCA; return; }
+    // DDB8  CLC
+    RecompiledBegin(ctx, 0xDDB8); SetFlag(cpu, Flags::C, false); cpu.totalCycles += 2;
+    // DDB9  CLV
+    RecompiledBegin(ctx, 0xDDB9); SetFlag(cpu, Flags::V, false); cpu.totalCycles += 2;
+    // DDBA  LDA #$99
+    RecompiledBegin(ctx, 0xDDBA); cpu.A = 0x99; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // DDBC  LDX #$80
+    RecompiledBegin(ctx, 0xDDBC); cpu.X = 0x80; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // DDBE  STA $85,X
+    { RecompiledBegin(ctx, 0xDDBE); const memAddress ea = static_cast<byte>(0x85 + cpu.X); bus.write(ea, cpu.A); cpu.totalCycles += 4; }
+    // DDC0  LDA $05
+    RecompiledBegin(ctx, 0xDDC0); cpu.A = bus.read(0x0005); SetNZ(cpu, cpu.A); cpu.totalCycles += 3;
+    // DDC2  BCS $DDCA
+    RecompiledBegin(ctx, 0xDDC2); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xDDCA; return; }
+    // DDC4  CMP #$99
+    RecompiledBegin(ctx, 0xDDC4); Compare(cpu, cpu.A, 0x99); cpu.totalCycles += 2;
+    // DDC6  BNE $DDCA
+    RecompiledBegin(ctx, 0xDDC6); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xDDCA; return; }
+    // DDC8  BVC $DDCE
+    RecompiledBegin(ctx, 0xDDC8); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xDDCE; return; }
+    cpu.PC = 0xDDCA;
+}
+
+static void Block_DDCA(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // DDCA  LDA #$24
+    RecompiledBegin(ctx, 0xDDCA); cpu.A = 0x24; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // DDCC  STA $00
+    RecompiledBegin(ctx, 0xDDCC); bus.write(0x0000, cpu.A); cpu.totalCycles += 3;
+    cpu.PC = 0xDDCE;
+}
+
+static void Block_DDCE(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // DDCE  LDY #$25
+    RecompiledBegin(ctx, 0xDDCE); cpu.Y = 0x25; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // DDD0  LDX #$78
+    RecompiledBegin(ctx, 0xDDD0); cpu.X = 0x78; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // DDD2  JSR $F990
+    RecompiledBegin(ctx, 0xDDD2); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xDD); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD4); cpu.totalCycles += 6; cpu.PC = 0xF990; return;
+}
+
+static void Block_DDD5(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // DDD5  STA $00,X
+    { RecompiledBegin(ctx, 0xDDD5); const memAddress ea = static_cast<byte>(0x00 + cpu.X); bus.write(ea, cpu.A); cpu.totalCycles += 4; }
+    // DDD7  LSR $00,X
+    { RecompiledBegin(ctx, 0xDDD7); const memAddress ea = static_cast<byte>(0x00 + cpu.X); bus.write(ea, ShiftRight(cpu, bus.read(ea))); cpu.totalCycles += 6; }
+    // DDD9  LDA $00,X
+    { RecompiledBegin(ctx, 0xDDD9); const memAddress ea = static_cast<byte>(0x00 + cpu.X); cpu.A = bus.read(ea); SetNZ(cpu, cpu.A); cpu.totalCycles += 4; }
+    // DDDB  JSR $F99D
+    RecompiledBegin(ctx, 0xDDDB); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xDD); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xDD); cpu.totalCycles += 6; cpu.PC = 0xF99D; return;
+}
+
+static void Block_DDDE(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // DDDE  INY
+    RecompiledBegin(ctx, 0xDDDE); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // DDDF  STA $00,X
+    { RecompiledBegin(ctx, 0xDDDF); const memAddress ea = static_cast<byte>(0x00 + cpu.X); bus.write(ea, cpu.A); cpu.totalCycles += 4; }
+    // DDE1  LSR $00,X
+    { RecompiledBegin(ctx, 0xDDE1); const memAddress ea = static_cast<byte>(0x00 + cpu.X); bus.write(ea, ShiftRight(cpu, bus.read(ea))); cpu.totalCycles += 6; }
+    // DDE3  LDA $00,X
+    { RecompiledBegin(ctx, 0xDDE3); const memAddress ea = static_cast<byte>(0x00 + cpu.X); cpu.A = bus.read(ea); SetNZ(cpu, cpu.A); cpu.totalCycles += 4; }
+    // DDE5  JSR $F9AD
+    RecompiledBegin(ctx, 0xDDE5); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xDD); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xE7); cpu.totalCycles += 6; cpu.PC = 0xF9AD; return;
+}
+
+static void Block_DDE8(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // DDE8  INY
+    RecompiledBegin(ctx, 0xDDE8); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // DDE9  JSR $F9BD
+    RecompiledBegin(ctx, 0xDDE9); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xDD); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xEB); cpu.totalCycles += 6; cpu.PC = 0xF9BD; return;
+}
+
+static void Block_DDEC(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // DDEC  STA $00,X
+    { RecompiledBegin(ctx, 0xDDEC); const memAddress ea = static_cast<byte>(0x00 + cpu.X); bus.write(ea, cpu.A); cpu.totalCycles += 4; }
+    // DDEE  ASL $00,X
+    { RecompiledBegin(ctx, 0xDDEE); const memAddress ea = static_cast<byte>(0x00 + cpu.X); bus.write(ea, ShiftLeft(cpu, bus.read(ea))); cpu.totalCycles += 6; }
+    // DDF0  LDA $00,X
+    { RecompiledBegin(ctx, 0xDDF0); const memAddress ea = static_cast<byte>(0x00 + cpu.X); cpu.A = bus.read(ea); SetNZ(cpu, cpu.A); cpu.totalCycles += 4; }
+    // DDF2  JSR $F9C3
+    RecompiledBegin(ctx, 0xDDF2); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xDD); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xF4); cpu.totalCycles += 6; cpu.PC = 0xF9C3; return;
+}
+
+static void Block_DDF5(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // DDF5  INY
+    RecompiledBegin(ctx, 0xDDF5); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // DDF6  STA $00,X
+    { RecompiledBegin(ctx, 0xDDF6); const memAddress ea = static_cast<byte>(0x00 + cpu.X); bus.write(ea, cpu.A); cpu.totalCycles += 4; }
+    // DDF8  ASL $00,X
+    { RecompiledBegin(ctx, 0xDDF8); const memAddress ea = static_cast<byte>(0x00 + cpu.X); bus.write(ea, ShiftLeft(cpu, bus.read(ea))); cpu.totalCycles += 6; }
+    // DDFA  LDA $00,X
+    { RecompiledBegin(ctx, 0xDDFA); const memAddress ea = static_cast<byte>(0x00 + cpu.X); cpu.A = bus.read(ea); SetNZ(cpu, cpu.A); cpu.totalCycles += 4; }
+    // DDFC  JSR $F9D4
+    RecompiledBegin(ctx, 0xDDFC); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xDD); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xFE); cpu.totalCycles += 6; cpu.PC = 0xF9D4; return;
+}
+
+static void Block_DDFF(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // DDFF  INY
+    RecompiledBegin(ctx, 0xDDFF); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // DE00  JSR $F9E4
+    RecompiledBegin(ctx, 0xDE00); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xDE); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x02); cpu.totalCycles += 6; cpu.PC = 0xF9E4; return;
+}
+
+static void Block_DE03(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // DE03  STA $00,X
+    { RecompiledBegin(ctx, 0xDE03); const memAddress ea = static_cast<byte>(0x00 + cpu.X); bus.write(ea, cpu.A); cpu.totalCycles += 4; }
+    // DE05  ROR $00,X
+    { RecompiledBegin(ctx, 0xDE05); const memAddress ea = static_cast<byte>(0x00 + cpu.X); bus.write(ea, RotateRight(cpu, bus.read(ea))); cpu.totalCycles += 6; }
+    // DE07  LDA $00,X
+    { RecompiledBegin(ctx, 0xDE07); const memAddress ea = static_cast<byte>(0x00 + cpu.X); cpu.A = bus.read(ea); SetNZ(cpu, cpu.A); cpu.totalCycles += 4; }
+    // DE09  JSR $F9EA
+    RecompiledBegin(ctx, 0xDE09); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xDE); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x0B); cpu.totalCycles += 6; cpu.PC = 0xF9EA; return;
+}
+
+static void Block_DE0C(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // DE0C  INY
+    RecompiledBegin(ctx, 0xDE0C); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // DE0D  STA $00,X
+    { RecompiledBegin(ctx, 0xDE0D); const memAddress ea = static_cast<byte>(0x00 + cpu.X); bus.write(ea, cpu.A); cpu.totalCycles += 4; }
+    // DE0F  ROR $00,X
+    { RecompiledBegin(ctx, 0xDE0F); const memAddress ea = static_cast<byte>(0x00 + cpu.X); bus.write(ea, RotateRight(cpu, bus.read(ea))); cpu.totalCycles += 6; }
+    // DE11  LDA $00,X
+    { RecompiledBegin(ctx, 0xDE11); const memAddress ea = static_cast<byte>(0x00 + cpu.X); cpu.A = bus.read(ea); SetNZ(cpu, cpu.A); cpu.totalCycles += 4; }
+    // DE13  JSR $F9FB
+    RecompiledBegin(ctx, 0xDE13); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xDE); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x15); cpu.totalCycles += 6; cpu.PC = 0xF9FB; return;
+}
+
+static void Block_DE16(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // DE16  INY
+    RecompiledBegin(ctx, 0xDE16); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // DE17  JSR $FA0A
+    RecompiledBegin(ctx, 0xDE17); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xDE); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x19); cpu.totalCycles += 6; cpu.PC = 0xFA0A; return;
+}
+
+static void Block_DE1A(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // DE1A  STA $00,X
+    { RecompiledBegin(ctx, 0xDE1A); const memAddress ea = static_cast<byte>(0x00 + cpu.X); bus.write(ea, cpu.A); cpu.totalCycles += 4; }
+    // DE1C  ROL $00,X
+    { RecompiledBegin(ctx, 0xDE1C); const memAddress ea = static_cast<byte>(0x00 + cpu.X); bus.write(ea, RotateLeft(cpu, bus.read(ea))); cpu.totalCycles += 6; }
+    // DE1E  LDA $00,X
+    { RecompiledBegin(ctx, 0xDE1E); const memAddress ea = static_cast<byte>(0x00 + cpu.X); cpu.A = bus.read(ea); SetNZ(cpu, cpu.A); cpu.totalCycles += 4; }
+    // DE20  JSR $FA10
+    RecompiledBegin(ctx, 0xDE20); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xDE); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x22); cpu.totalCycles += 6; cpu.PC = 0xFA10; return;
+}
+
+static void Block_DE23(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // DE23  INY
+    RecompiledBegin(ctx, 0xDE23); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // DE24  STA $00,X
+    { RecompiledBegin(ctx, 0xDE24); const memAddress ea = static_cast<byte>(0x00 + cpu.X); bus.write(ea, cpu.A); cpu.totalCycles += 4; }
+    // DE26  ROL $00,X
+    { RecompiledBegin(ctx, 0xDE26); const memAddress ea = static_cast<byte>(0x00 + cpu.X); bus.write(ea, RotateLeft(cpu, bus.read(ea))); cpu.totalCycles += 6; }
+    // DE28  LDA $00,X
+    { RecompiledBegin(ctx, 0xDE28); const memAddress ea = static_cast<byte>(0x00 + cpu.X); cpu.A = bus.read(ea); SetNZ(cpu, cpu.A); cpu.totalCycles += 4; }
+    // DE2A  JSR $FA21
+    RecompiledBegin(ctx, 0xDE2A); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xDE); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x2C); cpu.totalCycles += 6; cpu.PC = 0xFA21; return;
+}
+
+static void Block_DE2D(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // DE2D  LDA #$FF
+    RecompiledBegin(ctx, 0xDE2D); cpu.A = 0xFF; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // DE2F  STA $00,X
+    { RecompiledBegin(ctx, 0xDE2F); const memAddress ea = static_cast<byte>(0x00 + cpu.X); bus.write(ea, cpu.A); cpu.totalCycles += 4; }
+    // DE31  STA $01
+    RecompiledBegin(ctx, 0xDE31); bus.write(0x0001, cpu.A); cpu.totalCycles += 3;
+    // DE33  BIT $01
+    RecompiledBegin(ctx, 0xDE33); BitTest(cpu, bus.read(0x0001)); cpu.totalCycles += 3;
+    // DE35  SEC
+    RecompiledBegin(ctx, 0xDE35); SetFlag(cpu, Flags::C, true); cpu.totalCycles += 2;
+    // DE36  INC $00,X
+    { RecompiledBegin(ctx, 0xDE36); const memAddress ea = static_cast<byte>(0x00 + cpu.X); const byte result = static_cast<byte>(bus.read(ea) + 1); bus.write(ea, result); SetNZ(cpu, result); cpu.totalCycles += 6; }
+    // DE38  BNE $DE46
+    RecompiledBegin(ctx, 0xDE38); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xDE46; return; }
+    // DE3A  BMI $DE46
+    RecompiledBegin(ctx, 0xDE3A); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xDE46; return; }
+    // DE3C  BVC $DE46
+    RecompiledBegin(ctx, 0xDE3C); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xDE46; return; }
+    // DE3E  BCC $DE46
+    RecompiledBegin(ctx, 0xDE3E); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xDE46; return; }
+    // DE40  LDA $00,X
+    { RecompiledBegin(ctx, 0xDE40); const memAddress ea = static_cast<byte>(0x00 + cpu.X); cpu.A = bus.read(ea); SetNZ(cpu, cpu.A); cpu.totalCycles += 4; }
+    // DE42  CMP #$00
+    RecompiledBegin(ctx, 0xDE42); Compare(cpu, cpu.A, 0x00); cpu.totalCycles += 2;
+    // DE44  BEQ $DE4A
+    RecompiledBegin(ctx, 0xDE44); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xDE4A; return; }
+    cpu.PC = 0xDE46;
+}
+
+static void Block_DE46(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // DE46  LDA #$2D
+    RecompiledBegin(ctx, 0xDE46); cpu.A = 0x2D; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // DE48  STA $00
+    RecompiledBegin(ctx, 0xDE48); bus.write(0x0000, cpu.A); cpu.totalCycles += 3;
+    cpu.PC = 0xDE4A;
+}
+
+static void Block_DE4A(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // DE4A  LDA #$7F
+    RecompiledBegin(ctx, 0xDE4A); cpu.A = 0x7F; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // DE4C  STA $00,X
+    { RecompiledBegin(ctx, 0xDE4C); const memAddress ea = static_cast<byte>(0x00 + cpu.X); bus.write(ea, cpu.A); cpu.totalCycles += 4; }
+    // DE4E  CLV
+    RecompiledBegin(ctx, 0xDE4E); SetFlag(cpu, Flags::V, false); cpu.totalCycles += 2;
+    // DE4F  CLC
+    RecompiledBegin(ctx, 0xDE4F); SetFlag(cpu, Flags::C, false); cpu.totalCycles += 2;
+    // DE50  INC $00,X
+    { RecompiledBegin(ctx, 0xDE50); const memAddress ea = static_cast<byte>(0x00 + cpu.X); const byte result = static_cast<byte>(bus.read(ea) + 1); bus.write(ea, result); SetNZ(cpu, result); cpu.totalCycles += 6; }
+    // DE52  BEQ $DE60
+    RecompiledBegin(ctx, 0xDE52); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xDE60; return; }
+    // DE54  BPL $DE60
+    RecompiledBegin(ctx, 0xDE54); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xDE60; return; }
+    // DE56  BVS $DE60
+    RecompiledBegin(ctx, 0xDE56); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xDE60; return; }
+    // DE58  BCS $DE60
+    RecompiledBegin(ctx, 0xDE58); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xDE60; return; }
+    // DE5A  LDA $00,X
+    { RecompiledBegin(ctx, 0xDE5A); const memAddress ea = static_cast<byte>(0x00 + cpu.X); cpu.A = bus.read(ea); SetNZ(cpu, cpu.A); cpu.totalCycles += 4; }
+    // DE5C  CMP #$80
+    RecompiledBegin(ctx, 0xDE5C); Compare(cpu, cpu.A, 0x80); cpu.totalCycles += 2;
+    // DE5E  BEQ $DE64
+    RecompiledBegin(ctx, 0xDE5E); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xDE64; return; }
+    cpu.PC = 0xDE60;
+}
+
+static void Block_DE60(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // DE60  LDA #$2E
+    RecompiledBegin(ctx, 0xDE60); cpu.A = 0x2E; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // DE62  STA $00
+    RecompiledBegin(ctx, 0xDE62); bus.write(0x0000, cpu.A); cpu.totalCycles += 3;
+    cpu.PC = 0xDE64;
+}
+
+static void Block_DE64(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // DE64  LDA #$00
+    RecompiledBegin(ctx, 0xDE64); cpu.A = 0x00; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // DE66  STA $00,X
+    { RecompiledBegin(ctx, 0xDE66); const memAddress ea = static_cast<byte>(0x00 + cpu.X); bus.write(ea, cpu.A); cpu.totalCycles += 4; }
+    // DE68  BIT $01
+    RecompiledBegin(ctx, 0xDE68); BitTest(cpu, bus.read(0x0001)); cpu.totalCycles += 3;
+    // DE6A  SEC
+    RecompiledBegin(ctx, 0xDE6A); SetFlag(cpu, Flags::C, true); cpu.totalCycles += 2;
+    // DE6B  DEC $00,X
+    { RecompiledBegin(ctx, 0xDE6B); const memAddress ea = static_cast<byte>(0x00 + cpu.X); const byte result = static_cast<byte>(bus.read(ea) - 1); bus.write(ea, result); SetNZ(cpu, result); cpu.totalCycles += 6; }
+    // DE6D  BEQ $DE7B
+    RecompiledBegin(ctx, 0xDE6D); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xDE7B; return; }
+    // DE6F  BPL $DE7B
+    RecompiledBegin(ctx, 0xDE6F); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xDE7B; return; }
+    // DE71  BVC $DE7B
+    RecompiledBegin(ctx, 0xDE71); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xDE7B; return; }
+    // DE73  BCC $DE7B
+    RecompiledBegin(ctx, 0xDE73); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xDE7B; return; }
+    // DE75  LDA $00,X
+    { RecompiledBegin(ctx, 0xDE75); const memAddress ea = static_cast<byte>(0x00 + cpu.X); cpu.A = bus.read(ea); SetNZ(cpu, cpu.A); cpu.totalCycles += 4; }
+    // DE77  CMP #$FF
+    RecompiledBegin(ctx, 0xDE77); Compare(cpu, cpu.A, 0xFF); cpu.totalCycles += 2;
+    // DE79  BEQ $DE7F
+    RecompiledBegin(ctx, 0xDE79); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xDE7F; return; }
+    cpu.PC = 0xDE7B;
+}
+
+static void Block_DE7B(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // DE7B  LDA #$2F
+    RecompiledBegin(ctx, 0xDE7B); cpu.A = 0x2F; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // DE7D  STA $00
+    RecompiledBegin(ctx, 0xDE7D); bus.write(0x0000, cpu.A); cpu.totalCycles += 3;
+    cpu.PC = 0xDE7F;
+}
+
+static void Block_DE7F(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // DE7F  LDA #$80
+    RecompiledBegin(ctx, 0xDE7F); cpu.A = 0x80; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // DE81  STA $00,X
+    { RecompiledBegin(ctx, 0xDE81); const memAddress ea = static_cast<byte>(0x00 + cpu.X); bus.write(ea, cpu.A); cpu.totalCycles += 4; }
+    // DE83  CLV
+    RecompiledBegin(ctx, 0xDE83); SetFlag(cpu, Flags::V, false); cpu.totalCycles += 2;
+    // DE84  CLC
+    RecompiledBegin(ctx, 0xDE84); SetFlag(cpu, Flags::C, false); cpu.totalCycles += 2;
+    // DE85  DEC $00,X
+    { RecompiledBegin(ctx, 0xDE85); const memAddress ea = static_cast<byte>(0x00 + cpu.X); const byte result = static_cast<byte>(bus.read(ea) - 1); bus.write(ea, result); SetNZ(cpu, result); cpu.totalCycles += 6; }
+    // DE87  BEQ $DE95
+    RecompiledBegin(ctx, 0xDE87); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xDE95; return; }
+    // DE89  BMI $DE95
+    RecompiledBegin(ctx, 0xDE89); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xDE95; return; }
+    // DE8B  BVS $DE95
+    RecompiledBegin(ctx, 0xDE8B); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xDE95; return; }
+    // DE8D  BCS $DE95
+    RecompiledBegin(ctx, 0xDE8D); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xDE95; return; }
+    // DE8F  LDA $00,X
+    { RecompiledBegin(ctx, 0xDE8F); const memAddress ea = static_cast<byte>(0x00 + cpu.X); cpu.A = bus.read(ea); SetNZ(cpu, cpu.A); cpu.totalCycles += 4; }
+    // DE91  CMP #$7F
+    RecompiledBegin(ctx, 0xDE91); Compare(cpu, cpu.A, 0x7F); cpu.totalCycles += 2;
+    // DE93  BEQ $DE99
+    RecompiledBegin(ctx, 0xDE93); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xDE99; return; }
+    cpu.PC = 0xDE95;
+}
+
+static void Block_DE95(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // DE95  LDA #$30
+    RecompiledBegin(ctx, 0xDE95); cpu.A = 0x30; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // DE97  STA $00
+    RecompiledBegin(ctx, 0xDE97); bus.write(0x0000, cpu.A); cpu.totalCycles += 3;
+    cpu.PC = 0xDE99;
+}
+
+static void Block_DE99(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // DE99  LDA #$01
+    RecompiledBegin(ctx, 0xDE99); cpu.A = 0x01; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // DE9B  STA $00,X
+    { RecompiledBegin(ctx, 0xDE9B); const memAddress ea = static_cast<byte>(0x00 + cpu.X); bus.write(ea, cpu.A); cpu.totalCycles += 4; }
+    // DE9D  DEC $00,X
+    { RecompiledBegin(ctx, 0xDE9D); const memAddress ea = static_cast<byte>(0x00 + cpu.X); const byte result = static_cast<byte>(bus.read(ea) - 1); bus.write(ea, result); SetNZ(cpu, result); cpu.totalCycles += 6; }
+    // DE9F  BEQ $DEA5
+    RecompiledBegin(ctx, 0xDE9F); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xDEA5; return; }
+    // DEA1  LDA #$31
+    RecompiledBegin(ctx, 0xDEA1); cpu.A = 0x31; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // DEA3  STA $00
+    RecompiledBegin(ctx, 0xDEA3); bus.write(0x0000, cpu.A); cpu.totalCycles += 3;
+    cpu.PC = 0xDEA5;
+}
+
+static void Block_DEA5(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // DEA5  LDA #$33
+    RecompiledBegin(ctx, 0xDEA5); cpu.A = 0x33; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // DEA7  STA $78
+    RecompiledBegin(ctx, 0xDEA7); bus.write(0x0078, cpu.A); cpu.totalCycles += 3;
+    // DEA9  LDA #$44
+    RecompiledBegin(ctx, 0xDEA9); cpu.A = 0x44; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // DEAB  LDY #$78
+    RecompiledBegin(ctx, 0xDEAB); cpu.Y = 0x78; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // DEAD  LDX #$00
+    RecompiledBegin(ctx, 0xDEAD); cpu.X = 0x00; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // DEAF  SEC
+    RecompiledBegin(ctx, 0xDEAF); SetFlag(cpu, Flags::C, true); cpu.totalCycles += 2;
+    // DEB0  BIT $01
+    RecompiledBegin(ctx, 0xDEB0); BitTest(cpu, bus.read(0x0001)); cpu.totalCycles += 3;
+    // DEB2  LDX $00,Y
+    { RecompiledBegin(ctx, 0xDEB2); const memAddress ea = static_cast<byte>(0x00 + cpu.Y); cpu.X = bus.read(ea); SetNZ(cpu, cpu.X); cpu.totalCycles += 4; }
+    // DEB4  BCC $DEC8
+    RecompiledBegin(ctx, 0xDEB4); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xDEC8; return; }
+    // DEB6  BVC $DEC8
+    RecompiledBegin(ctx, 0xDEB6); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xDEC8; return; }
+    // DEB8  BMI $DEC8
+    RecompiledBegin(ctx, 0xDEB8); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xDEC8; return; }
+    // DEBA  BEQ $DEC8
+    RecompiledBegin(ctx, 0xDEBA); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xDEC8; return; }
+    // DEBC  CPX #$33
+    RecompiledBegin(ctx, 0xDEBC); Compare(cpu, cpu.X, 0x33); cpu.totalCycles += 2;
+    // DEBE  BNE $DEC8
+    RecompiledBegin(ctx, 0xDEBE); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xDEC8; return; }
+    // DEC0  CPY #$78
+    RecompiledBegin(ctx, 0xDEC0); Compare(cpu, cpu.Y, 0x78); cpu.totalCycles += 2;
+    // DEC2  BNE $DEC8
+    RecompiledBegin(ctx, 0xDEC2); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xDEC8; return; }
+    // DEC4  CMP #$44
+    RecompiledBegin(ctx, 0xDEC4); Compare(cpu, cpu.A, 0x44); cpu.totalCycles += 2;
+    // DEC6  BEQ $DECC
+    RecompiledBegin(ctx, 0xDEC6); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xDECC; return; }
+    cpu.PC = 0xDEC8;
+}
+
+static void Block_DEC8(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // DEC8  LDA #$32
+    RecompiledBegin(ctx, 0xDEC8); cpu.A = 0x32; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // DECA  STA $00
+    RecompiledBegin(ctx, 0xDECA); bus.write(0x0000, cpu.A); cpu.totalCycles += 3;
+    cpu.PC = 0xDECC;
+}
+
+static void Block_DECC(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // DECC  LDA #$97
+    RecompiledBegin(ctx, 0xDECC); cpu.A = 0x97; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // DECE  STA $7F
+    RecompiledBegin(ctx, 0xDECE); bus.write(0x007F, cpu.A); cpu.totalCycles += 3;
+    // DED0  LDA #$47
+    RecompiledBegin(ctx, 0xDED0); cpu.A = 0x47; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // DED2  LDY #$FF
+    RecompiledBegin(ctx, 0xDED2); cpu.Y = 0xFF; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // DED4  LDX #$00
+    RecompiledBegin(ctx, 0xDED4); cpu.X = 0x00; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // DED6  CLC
+    RecompiledBegin(ctx, 0xDED6); SetFlag(cpu, Flags::C, false); cpu.totalCycles += 2;
+    // DED7  CLV
+    RecompiledBegin(ctx, 0xDED7); SetFlag(cpu, Flags::V, false); cpu.totalCycles += 2;
+    // DED8  LDX $80,Y
+    { RecompiledBegin(ctx, 0xDED8); const memAddress ea = static_cast<byte>(0x80 + cpu.Y); cpu.X = bus.read(ea); SetNZ(cpu, cpu.X); cpu.totalCycles += 4; }
+    // DEDA  BCS $DEEE
+    RecompiledBegin(ctx, 0xDEDA); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xDEEE; return; }
+    // DEDC  BVS $DEEE
+    RecompiledBegin(ctx, 0xDEDC); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xDEEE; return; }
+    // DEDE  BPL $DEEE
+    RecompiledBegin(ctx, 0xDEDE); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xDEEE; return; }
+    // DEE0  BEQ $DEEE
+    RecompiledBegin(ctx, 0xDEE0); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xDEEE; return; }
+    // DEE2  CPX #$97
+    RecompiledBegin(ctx, 0xDEE2); Compare(cpu, cpu.X, 0x97); cpu.totalCycles += 2;
+    // DEE4  BNE $DEEE
+    RecompiledBegin(ctx, 0xDEE4); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xDEEE; return; }
+    // DEE6  CPY #$FF
+    RecompiledBegin(ctx, 0xDEE6); Compare(cpu, cpu.Y, 0xFF); cpu.totalCycles += 2;
+    // DEE8  BNE $DEEE
+    RecompiledBegin(ctx, 0xDEE8); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xDEEE; return; }
+    // DEEA  CMP #$47
+    RecompiledBegin(ctx, 0xDEEA); Compare(cpu, cpu.A, 0x47); cpu.totalCycles += 2;
+    // DEEC  BEQ $DEF2
+    RecompiledBegin(ctx, 0xDEEC); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xDEF2; return; }
+    cpu.PC = 0xDEEE;
+}
+
+static void Block_DEEE(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // DEEE  LDA #$33
+    RecompiledBegin(ctx, 0xDEEE); cpu.A = 0x33; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // DEF0  STA $00
+    RecompiledBegin(ctx, 0xDEF0); bus.write(0x0000, cpu.A); cpu.totalCycles += 3;
+    cpu.PC = 0xDEF2;
+}
+
+static void Block_DEF2(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // DEF2  LDA #$00
+    RecompiledBegin(ctx, 0xDEF2); cpu.A = 0x00; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // DEF4  STA $7F
+    RecompiledBegin(ctx, 0xDEF4); bus.write(0x007F, cpu.A); cpu.totalCycles += 3;
+    // DEF6  LDA #$47
+    RecompiledBegin(ctx, 0xDEF6); cpu.A = 0x47; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // DEF8  LDY #$FF
+    RecompiledBegin(ctx, 0xDEF8); cpu.Y = 0xFF; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // DEFA  LDX #$69
+    RecompiledBegin(ctx, 0xDEFA); cpu.X = 0x69; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // DEFC  CLC
+    RecompiledBegin(ctx, 0xDEFC); SetFlag(cpu, Flags::C, false); cpu.totalCycles += 2;
+    // DEFD  CLV
+    RecompiledBegin(ctx, 0xDEFD); SetFlag(cpu, Flags::V, false); cpu.totalCycles += 2;
+    // DEFE  STX $80,Y
+    { RecompiledBegin(ctx, 0xDEFE); const memAddress ea = static_cast<byte>(0x80 + cpu.Y); bus.write(ea, cpu.X); cpu.totalCycles += 4; }
+    // DF00  BCS $DF1A
+    RecompiledBegin(ctx, 0xDF00); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xDF1A; return; }
+    // DF02  BVS $DF1A
+    RecompiledBegin(ctx, 0xDF02); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xDF1A; return; }
+    // DF04  BMI $DF1A
+    RecompiledBegin(ctx, 0xDF04); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xDF1A; return; }
+    // DF06  BEQ $DF1A
+    RecompiledBegin(ctx, 0xDF06); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xDF1A; return; }
+    // DF08  CPX #$69
+    RecompiledBegin(ctx, 0xDF08); Compare(cpu, cpu.X, 0x69); cpu.totalCycles += 2;
+    // DF0A  BNE $DF1A
+    RecompiledBegin(ctx, 0xDF0A); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xDF1A; return; }
+    // DF0C  CPY #$FF
+    RecompiledBegin(ctx, 0xDF0C); Compare(cpu, cpu.Y, 0xFF); cpu.totalCycles += 2;
+    // DF0E  BNE $DF1A
+    RecompiledBegin(ctx, 0xDF0E); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xDF1A; return; }
+    // DF10  CMP #$47
+    RecompiledBegin(ctx, 0xDF10); Compare(cpu, cpu.A, 0x47); cpu.totalCycles += 2;
+    // DF12  BNE $DF1A
+    RecompiledBegin(ctx, 0xDF12); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xDF1A; return; }
+    // DF14  LDA $7F
+    RecompiledBegin(ctx, 0xDF14); cpu.A = bus.read(0x007F); SetNZ(cpu, cpu.A); cpu.totalCycles += 3;
+    // DF16  CMP #$69
+    RecompiledBegin(ctx, 0xDF16); Compare(cpu, cpu.A, 0x69); cpu.totalCycles += 2;
+    // DF18  BEQ $DF1E
+    RecompiledBegin(ctx, 0xDF18); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xDF1E; return; }
+    cpu.PC = 0xDF1A;
+}
+
+static void Block_DF1A(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // DF1A  LDA #$34
+    RecompiledBegin(ctx, 0xDF1A); cpu.A = 0x34; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // DF1C  STA $00
+    RecompiledBegin(ctx, 0xDF1C); bus.write(0x0000, cpu.A); cpu.totalCycles += 3;
+    cpu.PC = 0xDF1E;
+}
+
+static void Block_DF1E(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // DF1E  LDA #$F5
+    RecompiledBegin(ctx, 0xDF1E); cpu.A = 0xF5; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // DF20  STA $4F
+    RecompiledBegin(ctx, 0xDF20); bus.write(0x004F, cpu.A); cpu.totalCycles += 3;
+    // DF22  LDA #$47
+    RecompiledBegin(ctx, 0xDF22); cpu.A = 0x47; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // DF24  LDY #$4F
+    RecompiledBegin(ctx, 0xDF24); cpu.Y = 0x4F; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // DF26  BIT $01
+    RecompiledBegin(ctx, 0xDF26); BitTest(cpu, bus.read(0x0001)); cpu.totalCycles += 3;
+    // DF28  LDX #$00
+    RecompiledBegin(ctx, 0xDF28); cpu.X = 0x00; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // DF2A  SEC
+    RecompiledBegin(ctx, 0xDF2A); SetFlag(cpu, Flags::C, true); cpu.totalCycles += 2;
+    // DF2B  STX $00,Y
+    { RecompiledBegin(ctx, 0xDF2B); const memAddress ea = static_cast<byte>(0x00 + cpu.Y); bus.write(ea, cpu.X); cpu.totalCycles += 4; }
+    // DF2D  BCC $DF45
+    RecompiledBegin(ctx, 0xDF2D); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xDF45; return; }
+    // DF2F  BVC $DF45
+    RecompiledBegin(ctx, 0xDF2F); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xDF45; return; }
+    // DF31  BMI $DF45
+    RecompiledBegin(ctx, 0xDF31); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xDF45; return; }
+    // DF33  BNE $DF45
+    RecompiledBegin(ctx, 0xDF33); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xDF45; return; }
+    // DF35  CPX #$00
+    RecompiledBegin(ctx, 0xDF35); Compare(cpu, cpu.X, 0x00); cpu.totalCycles += 2;
+    // DF37  BNE $DF45
+    RecompiledBegin(ctx, 0xDF37); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xDF45; return; }
+    // DF39  CPY #$4F
+    RecompiledBegin(ctx, 0xDF39); Compare(cpu, cpu.Y, 0x4F); cpu.totalCycles += 2;
+    // DF3B  BNE $DF45
+    RecompiledBegin(ctx, 0xDF3B); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xDF45; return; }
+    // DF3D  CMP #$47
+    RecompiledBegin(ctx, 0xDF3D); Compare(cpu, cpu.A, 0x47); cpu.totalCycles += 2;
+    // DF3F  BNE $DF45
+    RecompiledBegin(ctx, 0xDF3F); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xDF45; return; }
+    // DF41  LDA $4F
+    RecompiledBegin(ctx, 0xDF41); cpu.A = bus.read(0x004F); SetNZ(cpu, cpu.A); cpu.totalCycles += 3;
+    // DF43  BEQ $DF49
+    RecompiledBegin(ctx, 0xDF43); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xDF49; return; }
+    cpu.PC = 0xDF45;
+}
+
+static void Block_DF45(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // DF45  LDA #$35
+    RecompiledBegin(ctx, 0xDF45); cpu.A = 0x35; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // DF47  STA $00
+    RecompiledBegin(ctx, 0xDF47); bus.write(0x0000, cpu.A); cpu.totalCycles += 3;
+    cpu.PC = 0xDF49;
+}
+
+static void Block_DF49(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // DF49  RTS
+    { RecompiledBegin(ctx, 0xDF49); cpu.SP++; const byte low = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); const byte high = bus.read(static_cast<memAddress>(0x0100 + cpu.SP + 1)); cpu.SP++; cpu.totalCycles += 6; cpu.PC = static_cast<memAddress>(RecompiledWord(low, high) + 1); return; }
+}
+
+static void Block_DF4A(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // DF4A  LDA #$89
+    RecompiledBegin(ctx, 0xDF4A); cpu.A = 0x89; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // DF4C  STA $0300
+    RecompiledBegin(ctx, 0xDF4C); bus.write(0x0300, cpu.A); cpu.totalCycles += 4;
+    // DF4F  LDA #$A3
+    RecompiledBegin(ctx, 0xDF4F); cpu.A = 0xA3; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // DF51  STA $33
+    RecompiledBegin(ctx, 0xDF51); bus.write(0x0033, cpu.A); cpu.totalCycles += 3;
+    // DF53  LDA #$12
+    RecompiledBegin(ctx, 0xDF53); cpu.A = 0x12; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // DF55  STA $0245
+    RecompiledBegin(ctx, 0xDF55); bus.write(0x0245, cpu.A); cpu.totalCycles += 4;
+    // DF58  LDX #$65
+    RecompiledBegin(ctx, 0xDF58); cpu.X = 0x65; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // DF5A  LDY #$00
+    RecompiledBegin(ctx, 0xDF5A); cpu.Y = 0x00; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // DF5C  SEC
+    RecompiledBegin(ctx, 0xDF5C); SetFlag(cpu, Flags::C, true); cpu.totalCycles += 2;
+    // DF5D  LDA #$00
+    RecompiledBegin(ctx, 0xDF5D); cpu.A = 0x00; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // DF5F  CLV
+    RecompiledBegin(ctx, 0xDF5F); SetFlag(cpu, Flags::V, false); cpu.totalCycles += 2;
+    // DF60  LDA $0300,Y
+    { RecompiledBegin(ctx, 0xDF60); const memAddress ea = static_cast<memAddress>(0x0300 + cpu.Y); cpu.A = bus.read(ea); SetNZ(cpu, cpu.A); cpu.totalCycles += 4 + (((ea & 0xFF00) != 0x0300) ? 1 : 0); }
+    // DF63  BEQ $DF71
+    RecompiledBegin(ctx, 0xDF63); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xDF71; return; }
+    // DF65  BCC $DF71
+    RecompiledBegin(ctx, 0xDF65); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xDF71; return; }
+    // DF67  BVS $DF71
+    RecompiledBegin(ctx, 0xDF67); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xDF71; return; }
+    // DF69  CMP #$89
+    RecompiledBegin(ctx, 0xDF69); Compare(cpu, cpu.A, 0x89); cpu.totalCycles += 2;
+    // DF6B  BNE $DF71
+    RecompiledBegin(ctx, 0xDF6B); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xDF71; return; }
+    // DF6D  CPX #$65
+    RecompiledBegin(ctx, 0xDF6D); Compare(cpu, cpu.X, 0x65); cpu.totalCycles += 2;
+    // DF6F  BEQ $DF75
+    RecompiledBegin(ctx, 0xDF6F); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xDF75; return; }
+    cpu.PC = 0xDF71;
+}
+
+static void Block_DF71(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // DF71  LDA #$36
+    RecompiledBegin(ctx, 0xDF71); cpu.A = 0x36; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // DF73  STA $00
+    RecompiledBegin(ctx, 0xDF73); bus.write(0x0000, cpu.A); cpu.totalCycles += 3;
+    cpu.PC = 0xDF75;
+}
+
+static void Block_DF75(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // DF75  LDA #$FF
+    RecompiledBegin(ctx, 0xDF75); cpu.A = 0xFF; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // DF77  STA $01
+    RecompiledBegin(ctx, 0xDF77); bus.write(0x0001, cpu.A); cpu.totalCycles += 3;
+    // DF79  BIT $01
+    RecompiledBegin(ctx, 0xDF79); BitTest(cpu, bus.read(0x0001)); cpu.totalCycles += 3;
+    // DF7B  LDY #$34
+    RecompiledBegin(ctx, 0xDF7B); cpu.Y = 0x34; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // DF7D  LDA $FFFF,Y
+    { RecompiledBegin(ctx, 0xDF7D); const memAddress ea = static_cast<memAddress>(0xFFFF + cpu.Y); cpu.A = bus.read(ea); SetNZ(cpu, cpu.A); cpu.totalCycles += 4 + (((ea & 0xFF00) != 0xFF00) ? 1 : 0); }
+    // DF80  CMP #$A3
+    RecompiledBegin(ctx, 0xDF80); Compare(cpu, cpu.A, 0xA3); cpu.totalCycles += 2;
+    // DF82  BNE $DF86
+    RecompiledBegin(ctx, 0xDF82); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xDF86; return; }
+    // DF84  BCS $DF8A
+    RecompiledBegin(ctx, 0xDF84); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xDF8A; return; }
+    cpu.PC = 0xDF86;
+}
+
+static void Block_DF86(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // DF86  LDA #$37
+    RecompiledBegin(ctx, 0xDF86); cpu.A = 0x37; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // DF88  STA $00
+    RecompiledBegin(ctx, 0xDF88); bus.write(0x0000, cpu.A); cpu.totalCycles += 3;
+    cpu.PC = 0xDF8A;
+}
+
+static void Block_DF8A(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // DF8A  LDA #$46
+    RecompiledBegin(ctx, 0xDF8A); cpu.A = 0x46; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // DF8C  STA $FF
+    RecompiledBegin(ctx, 0xDF8C); bus.write(0x00FF, cpu.A); cpu.totalCycles += 3;
+    // DF8E  LDY #$FF
+    RecompiledBegin(ctx, 0xDF8E); cpu.Y = 0xFF; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // DF90  LDA $0146,Y
+    { RecompiledBegin(ctx, 0xDF90); const memAddress ea = static_cast<memAddress>(0x0146 + cpu.Y); cpu.A = bus.read(ea); SetNZ(cpu, cpu.A); cpu.totalCycles += 4 + (((ea & 0xFF00) != 0x0100) ? 1 : 0); }
+    // DF93  CMP #$12
+    RecompiledBegin(ctx, 0xDF93); Compare(cpu, cpu.A, 0x12); cpu.totalCycles += 2;
+    // DF95  BEQ $DF9B
+    RecompiledBegin(ctx, 0xDF95); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xDF9B; return; }
+    // DF97  LDA #$38
+    RecompiledBegin(ctx, 0xDF97); cpu.A = 0x38; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // DF99  STA $00
+    RecompiledBegin(ctx, 0xDF99); bus.write(0x0000, cpu.A); cpu.totalCycles += 3;
+    cpu.PC = 0xDF9B;
+}
+
+static void Block_DF9B(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // DF9B  LDX #$39
+    RecompiledBegin(ctx, 0xDF9B); cpu.X = 0x39; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // DF9D  CLC
+    RecompiledBegin(ctx, 0xDF9D); SetFlag(cpu, Flags::C, false); cpu.totalCycles += 2;
+    // DF9E  LDA #$FF
+    RecompiledBegin(ctx, 0xDF9E); cpu.A = 0xFF; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // DFA0  STA $01
+    RecompiledBegin(ctx, 0xDFA0); bus.write(0x0001, cpu.A); cpu.totalCycles += 3;
+    // DFA2  BIT $01
+    RecompiledBegin(ctx, 0xDFA2); BitTest(cpu, bus.read(0x0001)); cpu.totalCycles += 3;
+    // DFA4  LDA #$AA
+    RecompiledBegin(ctx, 0xDFA4); cpu.A = 0xAA; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // DFA6  STA $0400
+    RecompiledBegin(ctx, 0xDFA6); bus.write(0x0400, cpu.A); cpu.totalCycles += 4;
+    // DFA9  LDA #$55
+    RecompiledBegin(ctx, 0xDFA9); cpu.A = 0x55; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // DFAB  LDY #$00
+    RecompiledBegin(ctx, 0xDFAB); cpu.Y = 0x00; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // DFAD  ORA $0400,Y
+    { RecompiledBegin(ctx, 0xDFAD); const memAddress ea = static_cast<memAddress>(0x0400 + cpu.Y); cpu.A = static_cast<byte>(cpu.A | bus.read(ea)); SetNZ(cpu, cpu.A); cpu.totalCycles += 4 + (((ea & 0xFF00) != 0x0400) ? 1 : 0); }
+    // DFB0  BCS $DFBA
+    RecompiledBegin(ctx, 0xDFB0); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xDFBA; return; }
+    // DFB2  BPL $DFBA
+    RecompiledBegin(ctx, 0xDFB2); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xDFBA; return; }
+    // DFB4  CMP #$FF
+    RecompiledBegin(ctx, 0xDFB4); Compare(cpu, cpu.A, 0xFF); cpu.totalCycles += 2;
+    // DFB6  BNE $DFBA
+    RecompiledBegin(ctx, 0xDFB6); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xDFBA; return; }
+    // DFB8  BVS $DFBC
+    RecompiledBegin(ctx, 0xDFB8); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xDFBC; return; }
+    cpu.PC = 0xDFBA;
+}
+
+static void Block_DFBA(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // DFBA  STX $00
+    RecompiledBegin(ctx, 0xDFBA); bus.write(0x0000, cpu.X); cpu.totalCycles += 3;
+    cpu.PC = 0xDFBC;
+}
+
+static void Block_DFBC(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // DFBC  INX
+    RecompiledBegin(ctx, 0xDFBC); cpu.X++; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // DFBD  SEC
+    RecompiledBegin(ctx, 0xDFBD); SetFlag(cpu, Flags::C, true); cpu.totalCycles += 2;
+    // DFBE  CLV
+    RecompiledBegin(ctx, 0xDFBE); SetFlag(cpu, Flags::V, false); cpu.totalCycles += 2;
+    // DFBF  LDA #$00
+    RecompiledBegin(ctx, 0xDFBF); cpu.A = 0x00; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // DFC1  ORA $0400,Y
+    { RecompiledBegin(ctx, 0xDFC1); const memAddress ea = static_cast<memAddress>(0x0400 + cpu.Y); cpu.A = static_cast<byte>(cpu.A | bus.read(ea)); SetNZ(cpu, cpu.A); cpu.totalCycles += 4 + (((ea & 0xFF00) != 0x0400) ? 1 : 0); }
+    // DFC4  BEQ $DFCC
+    RecompiledBegin(ctx, 0xDFC4); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xDFCC; return; }
+    // DFC6  BVS $DFCC
+    RecompiledBegin(ctx, 0xDFC6); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xDFCC; return; }
+    // DFC8  BCC $DFCC
+    RecompiledBegin(ctx, 0xDFC8); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xDFCC; return; }
+    // DFCA  BMI $DFCE
+    RecompiledBegin(ctx, 0xDFCA); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xDFCE; return; }
+    cpu.PC = 0xDFCC;
+}
+
+static void Block_DFCC(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // DFCC  STX $00
+    RecompiledBegin(ctx, 0xDFCC); bus.write(0x0000, cpu.X); cpu.totalCycles += 3;
+    cpu.PC = 0xDFCE;
+}
+
+static void Block_DFCE(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // DFCE  INX
+    RecompiledBegin(ctx, 0xDFCE); cpu.X++; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // DFCF  CLC
+    RecompiledBegin(ctx, 0xDFCF); SetFlag(cpu, Flags::C, false); cpu.totalCycles += 2;
+    // DFD0  BIT $01
+    RecompiledBegin(ctx, 0xDFD0); BitTest(cpu, bus.read(0x0001)); cpu.totalCycles += 3;
+    // DFD2  LDA #$55
+    RecompiledBegin(ctx, 0xDFD2); cpu.A = 0x55; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // DFD4  AND $0400,Y
+    { RecompiledBegin(ctx, 0xDFD4); const memAddress ea = static_cast<memAddress>(0x0400 + cpu.Y); cpu.A = static_cast<byte>(cpu.A & bus.read(ea)); SetNZ(cpu, cpu.A); cpu.totalCycles += 4 + (((ea & 0xFF00) != 0x0400) ? 1 : 0); }
+    // DFD7  BNE $DFDF
+    RecompiledBegin(ctx, 0xDFD7); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xDFDF; return; }
+    // DFD9  BVC $DFDF
+    RecompiledBegin(ctx, 0xDFD9); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xDFDF; return; }
+    // DFDB  BCS $DFDF
+    RecompiledBegin(ctx, 0xDFDB); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xDFDF; return; }
+    // DFDD  BPL $DFE1
+    RecompiledBegin(ctx, 0xDFDD); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xDFE1; return; }
+    cpu.PC = 0xDFDF;
+}
+
+static void Block_DFDF(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // DFDF  STX $00
+    RecompiledBegin(ctx, 0xDFDF); bus.write(0x0000, cpu.X); cpu.totalCycles += 3;
+    cpu.PC = 0xDFE1;
+}
+
+static void Block_DFE1(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // DFE1  INX
+    RecompiledBegin(ctx, 0xDFE1); cpu.X++; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // DFE2  SEC
+    RecompiledBegin(ctx, 0xDFE2); SetFlag(cpu, Flags::C, true); cpu.totalCycles += 2;
+    // DFE3  CLV
+    RecompiledBegin(ctx, 0xDFE3); SetFlag(cpu, Flags::V, false); cpu.totalCycles += 2;
+    // DFE4  LDA #$EF
+    RecompiledBegin(ctx, 0xDFE4); cpu.A = 0xEF; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // DFE6  STA $0400
+    RecompiledBegin(ctx, 0xDFE6); bus.write(0x0400, cpu.A); cpu.totalCycles += 4;
+    // DFE9  LDA #$F8
+    RecompiledBegin(ctx, 0xDFE9); cpu.A = 0xF8; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // DFEB  AND $0400,Y
+    { RecompiledBegin(ctx, 0xDFEB); const memAddress ea = static_cast<memAddress>(0x0400 + cpu.Y); cpu.A = static_cast<byte>(cpu.A & bus.read(ea)); SetNZ(cpu, cpu.A); cpu.totalCycles += 4 + (((ea & 0xFF00) != 0x0400) ? 1 : 0); }
+    // DFEE  BCC $DFF8
+    RecompiledBegin(ctx, 0xDFEE); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xDFF8; return; }
+    // DFF0  BPL $DFF8
+    RecompiledBegin(ctx, 0xDFF0); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xDFF8; return; }
+    // DFF2  CMP #$E8
+    RecompiledBegin(ctx, 0xDFF2); Compare(cpu, cpu.A, 0xE8); cpu.totalCycles += 2;
+    // DFF4  BNE $DFF8
+    RecompiledBegin(ctx, 0xDFF4); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xDFF8; return; }
+    // DFF6  BVC $DFFA
+    RecompiledBegin(ctx, 0xDFF6); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xDFFA; return; }
+    cpu.PC = 0xDFF8;
+}
+
+static void Block_DFF8(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // DFF8  STX $00
+    RecompiledBegin(ctx, 0xDFF8); bus.write(0x0000, cpu.X); cpu.totalCycles += 3;
+    cpu.PC = 0xDFFA;
+}
+
+static void Block_DFFA(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // DFFA  INX
+    RecompiledBegin(ctx, 0xDFFA); cpu.X++; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // DFFB  CLC
+    RecompiledBegin(ctx, 0xDFFB); SetFlag(cpu, Flags::C, false); cpu.totalCycles += 2;
+    // DFFC  BIT $01
+    RecompiledBegin(ctx, 0xDFFC); BitTest(cpu, bus.read(0x0001)); cpu.totalCycles += 3;
+    // DFFE  LDA #$AA
+    RecompiledBegin(ctx, 0xDFFE); cpu.A = 0xAA; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // E000  STA $0400
+    RecompiledBegin(ctx, 0xE000); bus.write(0x0400, cpu.A); cpu.totalCycles += 4;
+    // E003  LDA #$5F
+    RecompiledBegin(ctx, 0xE003); cpu.A = 0x5F; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // E005  EOR $0400,Y
+    { RecompiledBegin(ctx, 0xE005); const memAddress ea = static_cast<memAddress>(0x0400 + cpu.Y); cpu.A = static_cast<byte>(cpu.A ^ bus.read(ea)); SetNZ(cpu, cpu.A); cpu.totalCycles += 4 + (((ea & 0xFF00) != 0x0400) ? 1 : 0); }
+    // E008  BCS $E012
+    RecompiledBegin(ctx, 0xE008); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xE012; return; }
+    // E00A  BPL $E012
+    RecompiledBegin(ctx, 0xE00A); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xE012; return; }
+    // E00C  CMP #$F5
+    RecompiledBegin(ctx, 0xE00C); Compare(cpu, cpu.A, 0xF5); cpu.totalCycles += 2;
+    // E00E  BNE $E012
+    RecompiledBegin(ctx, 0xE00E); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xE012; return; }
+    // E010  BVS $E014
+    RecompiledBegin(ctx, 0xE010); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xE014; return; }
+    cpu.PC = 0xE012;
+}
+
+static void Block_E012(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // E012  STX $00
+    RecompiledBegin(ctx, 0xE012); bus.write(0x0000, cpu.X); cpu.totalCycles += 3;
+    cpu.PC = 0xE014;
+}
+
+static void Block_E014(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // E014  INX
+    RecompiledBegin(ctx, 0xE014); cpu.X++; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // E015  SEC
+    RecompiledBegin(ctx, 0xE015); SetFlag(cpu, Flags::C, true); cpu.totalCycles += 2;
+    // E016  CLV
+    RecompiledBegin(ctx, 0xE016); SetFlag(cpu, Flags::V, false); cpu.totalCycles += 2;
+    // E017  LDA #$70
+    RecompiledBegin(ctx, 0xE017); cpu.A = 0x70; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // E019  STA $0400
+    RecompiledBegin(ctx, 0xE019); bus.write(0x0400, cpu.A); cpu.totalCycles += 4;
+    // E01C  EOR $0400,Y
+    { RecompiledBegin(ctx, 0xE01C); const memAddress ea = static_cast<memAddress>(0x0400 + cpu.Y); cpu.A = static_cast<byte>(cpu.A ^ bus.read(ea)); SetNZ(cpu, cpu.A); cpu.totalCycles += 4 + (((ea & 0xFF00) != 0x0400) ? 1 : 0); }
+    // E01F  BNE $E027
+    RecompiledBegin(ctx, 0xE01F); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xE027; return; }
+    // E021  BVS $E027
+    RecompiledBegin(ctx, 0xE021); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xE027; return; }
+    // E023  BCC $E027
+    RecompiledBegin(ctx, 0xE023); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xE027; return; }
+    // E025  BPL $E029
+    RecompiledBegin(ctx, 0xE025); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xE029; return; }
+    cpu.PC = 0xE027;
+}
+
+static void Block_E027(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // E027  STX $00
+    RecompiledBegin(ctx, 0xE027); bus.write(0x0000, cpu.X); cpu.totalCycles += 3;
+    cpu.PC = 0xE029;
+}
+
+static void Block_E029(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // E029  INX
+    RecompiledBegin(ctx, 0xE029); cpu.X++; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // E02A  CLC
+    RecompiledBegin(ctx, 0xE02A); SetFlag(cpu, Flags::C, false); cpu.totalCycles += 2;
+    // E02B  BIT $01
+    RecompiledBegin(ctx, 0xE02B); BitTest(cpu, bus.read(0x0001)); cpu.totalCycles += 3;
+    // E02D  LDA #$69
+    RecompiledBegin(ctx, 0xE02D); cpu.A = 0x69; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // E02F  STA $0400
+    RecompiledBegin(ctx, 0xE02F); bus.write(0x0400, cpu.A); cpu.totalCycles += 4;
+    // E032  LDA #$00
+    RecompiledBegin(ctx, 0xE032); cpu.A = 0x00; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // E034  ADC $0400,Y
+    { RecompiledBegin(ctx, 0xE034); const memAddress ea = static_cast<memAddress>(0x0400 + cpu.Y); AddBinary(cpu, bus.read(ea)); cpu.totalCycles += 4 + (((ea & 0xFF00) != 0x0400) ? 1 : 0); }
+    // E037  BMI $E041
+    RecompiledBegin(ctx, 0xE037); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xE041; return; }
+    // E039  BCS $E041
+    RecompiledBegin(ctx, 0xE039); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xE041; return; }
+    // E03B  CMP #$69
+    RecompiledBegin(ctx, 0xE03B); Compare(cpu, cpu.A, 0x69); cpu.totalCycles += 2;
+    // E03D  BNE $E041
+    RecompiledBegin(ctx, 0xE03D); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xE041; return; }
+    // E03F  BVC $E043
+    RecompiledBegin(ctx, 0xE03F); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xE043; return; }
+    cpu.PC = 0xE041;
+}
+
+static void Block_E041(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // E041  STX $00
+    RecompiledBegin(ctx, 0xE041); bus.write(0x0000, cpu.X); cpu.totalCycles += 3;
+    cpu.PC = 0xE043;
+}
+
+static void Block_E043(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // E043  INX
+    RecompiledBegin(ctx, 0xE043); cpu.X++; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // E044  SEC
+    RecompiledBegin(ctx, 0xE044); SetFlag(cpu, Flags::C, true); cpu.totalCycles += 2;
+    // E045  BIT $01
+    RecompiledBegin(ctx, 0xE045); BitTest(cpu, bus.read(0x0001)); cpu.totalCycles += 3;
+    // E047  LDA #$00
+    RecompiledBegin(ctx, 0xE047); cpu.A = 0x00; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // E049  ADC $0400,Y
+    { RecompiledBegin(ctx, 0xE049); const memAddress ea = static_cast<memAddress>(0x0400 + cpu.Y); AddBinary(cpu, bus.read(ea)); cpu.totalCycles += 4 + (((ea & 0xFF00) != 0x0400) ? 1 : 0); }
+    // E04C  BMI $E056
+    RecompiledBegin(ctx, 0xE04C); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xE056; return; }
+    // E04E  BCS $E056
+    RecompiledBegin(ctx, 0xE04E); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xE056; return; }
+    // E050  CMP #$6A
+    RecompiledBegin(ctx, 0xE050); Compare(cpu, cpu.A, 0x6A); cpu.totalCycles += 2;
+    // E052  BNE $E056
+    RecompiledBegin(ctx, 0xE052); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xE056; return; }
+    // E054  BVC $E058
+    RecompiledBegin(ctx, 0xE054); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xE058; return; }
+    cpu.PC = 0xE056;
+}
+
+static void Block_E056(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // E056  STX $00
+    RecompiledBegin(ctx, 0xE056); bus.write(0x0000, cpu.X); cpu.totalCycles += 3;
+    cpu.PC = 0xE058;
+}
+
+static void Block_E058(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // E058  INX
+    RecompiledBegin(ctx, 0xE058); cpu.X++; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // E059  SEC
+    RecompiledBegin(ctx, 0xE059); SetFlag(cpu, Flags::C, true); cpu.totalCycles += 2;
+    // E05A  CLV
+    RecompiledBegin(ctx, 0xE05A); SetFlag(cpu, Flags::V, false); cpu.totalCycles += 2;
+    // E05B  LDA #$7F
+    RecompiledBegin(ctx, 0xE05B); cpu.A = 0x7F; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // E05D  STA $0400
+    RecompiledBegin(ctx, 0xE05D); bus.write(0x0400, cpu.A); cpu.totalCycles += 4;
+    // E060  ADC $0400,Y
+    { RecompiledBegin(ctx, 0xE060); const memAddress ea = static_cast<memAddress>(0x0400 + cpu.Y); AddBinary(cpu, bus.read(ea)); cpu.totalCycles += 4 + (((ea & 0xFF00) != 0x0400) ? 1 : 0); }
+    // E063  BPL $E06D
+    RecompiledBegin(ctx, 0xE063); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xE06D; return; }
+    // E065  BCS $E06D
+    RecompiledBegin(ctx, 0xE065); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xE06D; return; }
+    // E067  CMP #$FF
+    RecompiledBegin(ctx, 0xE067); Compare(cpu, cpu.A, 0xFF); cpu.totalCycles += 2;
+    // E069  BNE $E06D
+    RecompiledBegin(ctx, 0xE069); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xE06D; return; }
+    // E06B  BVS $E06F
+    RecompiledBegin(ctx, 0xE06B); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xE06F; return; }
+    cpu.PC = 0xE06D;
+}
+
+static void Block_E06D(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // E06D  STX $00
+    RecompiledBegin(ctx, 0xE06D); bus.write(0x0000, cpu.X); cpu.totalCycles += 3;
+    cpu.PC = 0xE06F;
+}
+
+static void Block_E06F(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // E06F  INX
+    RecompiledBegin(ctx, 0xE06F); cpu.X++; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // E070  CLC
+    RecompiledBegin(ctx, 0xE070); SetFlag(cpu, Flags::C, false); cpu.totalCycles += 2;
+    // E071  BIT $01
+    RecompiledBegin(ctx, 0xE071); BitTest(cpu, bus.read(0x0001)); cpu.totalCycles += 3;
+    // E073  LDA #$80
+    RecompiledBegin(ctx, 0xE073); cpu.A = 0x80; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // E075  STA $0400
+    RecompiledBegin(ctx, 0xE075); bus.write(0x0400, cpu.A); cpu.totalCycles += 4;
+    // E078  LDA #$7F
+    RecompiledBegin(ctx, 0xE078); cpu.A = 0x7F; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // E07A  ADC $0400,Y
+    { RecompiledBegin(ctx, 0xE07A); const memAddress ea = static_cast<memAddress>(0x0400 + cpu.Y); AddBinary(cpu, bus.read(ea)); cpu.totalCycles += 4 + (((ea & 0xFF00) != 0x0400) ? 1 : 0); }
+    // E07D  BPL $E087
+    RecompiledBegin(ctx, 0xE07D); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xE087; return; }
+    // E07F  BCS $E087
+    RecompiledBegin(ctx, 0xE07F); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xE087; return; }
+    // E081  CMP #$FF
+    RecompiledBegin(ctx, 0xE081); Compare(cpu, cpu.A, 0xFF); cpu.totalCycles += 2;
+    // E083  BNE $E087
+    RecompiledBegin(ctx, 0xE083); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xE087; return; }
+    // E085  BVC $E089
+    RecompiledBegin(ctx, 0xE085); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xE089; return; }
+    cpu.PC = 0xE087;
+}
+
+static void Block_E087(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // E087  STX $00
+    RecompiledBegin(ctx, 0xE087); bus.write(0x0000, cpu.X); cpu.totalCycles += 3;
+    cpu.PC = 0xE089;
+}
+
+static void Block_E089(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // E089  INX
+    RecompiledBegin(ctx, 0xE089); cpu.X++; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // E08A  SEC
+    RecompiledBegin(ctx, 0xE08A); SetFlag(cpu, Flags::C, true); cpu.totalCycles += 2;
+    // E08B  CLV
+    RecompiledBegin(ctx, 0xE08B); SetFlag(cpu, Flags::V, false); cpu.totalCycles += 2;
+    // E08C  LDA #$80
+    RecompiledBegin(ctx, 0xE08C); cpu.A = 0x80; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // E08E  STA $0400
+    RecompiledBegin(ctx, 0xE08E); bus.write(0x0400, cpu.A); cpu.totalCycles += 4;
+    // E091  LDA #$7F
+    RecompiledBegin(ctx, 0xE091); cpu.A = 0x7F; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // E093  ADC $0400,Y
+    { RecompiledBegin(ctx, 0xE093); const memAddress ea = static_cast<memAddress>(0x0400 + cpu.Y); AddBinary(cpu, bus.read(ea)); cpu.totalCycles += 4 + (((ea & 0xFF00) != 0x0400) ? 1 : 0); }
+    // E096  BNE $E09E
+    RecompiledBegin(ctx, 0xE096); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xE09E; return; }
+    // E098  BMI $E09E
+    RecompiledBegin(ctx, 0xE098); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xE09E; return; }
+    // E09A  BVS $E09E
+    RecompiledBegin(ctx, 0xE09A); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xE09E; return; }
+    // E09C  BCS $E0A0
+    RecompiledBegin(ctx, 0xE09C); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xE0A0; return; }
+    cpu.PC = 0xE09E;
+}
+
+static void Block_E09E(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // E09E  STX $00
+    RecompiledBegin(ctx, 0xE09E); bus.write(0x0000, cpu.X); cpu.totalCycles += 3;
+    cpu.PC = 0xE0A0;
+}
+
+static void Block_E0A0(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // E0A0  INX
+    RecompiledBegin(ctx, 0xE0A0); cpu.X++; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // E0A1  BIT $01
+    RecompiledBegin(ctx, 0xE0A1); BitTest(cpu, bus.read(0x0001)); cpu.totalCycles += 3;
+    // E0A3  LDA #$40
+    RecompiledBegin(ctx, 0xE0A3); cpu.A = 0x40; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // E0A5  STA $0400
+    RecompiledBegin(ctx, 0xE0A5); bus.write(0x0400, cpu.A); cpu.totalCycles += 4;
+    // E0A8  CMP $0400,Y
+    { RecompiledBegin(ctx, 0xE0A8); const memAddress ea = static_cast<memAddress>(0x0400 + cpu.Y); Compare(cpu, cpu.A, bus.read(ea)); cpu.totalCycles += 4 + (((ea & 0xFF00) != 0x0400) ? 1 : 0); }
+    // E0AB  BMI $E0B3
+    RecompiledBegin(ctx, 0xE0AB); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xE0B3; return; }
+    // E0AD  BCC $E0B3
+    RecompiledBegin(ctx, 0xE0AD); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xE0B3; return; }
+    // E0AF  BNE $E0B3
+    RecompiledBegin(ctx, 0xE0AF); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xE0B3; return; }
+    // E0B1  BVS $E0B5
+    RecompiledBegin(ctx, 0xE0B1); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xE0B5; return; }
+    cpu.PC = 0xE0B3;
+}
+
+static void Block_E0B3(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // E0B3  STX $00
+    RecompiledBegin(ctx, 0xE0B3); bus.write(0x0000, cpu.X); cpu.totalCycles += 3;
+    cpu.PC = 0xE0B5;
+}
+
+static void Block_E0B5(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // E0B5  INX
+    RecompiledBegin(ctx, 0xE0B5); cpu.X++; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // E0B6  CLV
+    RecompiledBegin(ctx, 0xE0B6); SetFlag(cpu, Flags::V, false); cpu.totalCycles += 2;
+    // E0B7  DEC $0400
+    { RecompiledBegin(ctx, 0xE0B7); const byte result = static_cast<byte>(bus.read(0x0400) - 1); bus.write(0x0400, result); SetNZ(cpu, result); cpu.totalCycles += 6; }
+    // E0BA  CMP $0400,Y
+    { RecompiledBegin(ctx, 0xE0BA); const memAddress ea = static_cast<memAddress>(0x0400 + cpu.Y); Compare(cpu, cpu.A, bus.read(ea)); cpu.totalCycles += 4 + (((ea & 0xFF00) != 0x0400) ? 1 : 0); }
+    // E0BD  BEQ $E0C5
+    RecompiledBegin(ctx, 0xE0BD); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xE0C5; return; }
+    // E0BF  BMI $E0C5
+    RecompiledBegin(ctx, 0xE0BF); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xE0C5; return; }
+    // E0C1  BCC $E0C5
+    RecompiledBegin(ctx, 0xE0C1); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xE0C5; return; }
+    // E0C3  BVC $E0C7
+    RecompiledBegin(ctx, 0xE0C3); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xE0C7; return; }
+    cpu.PC = 0xE0C5;
+}
+
+static void Block_E0C5(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // E0C5  STX $00
+    RecompiledBegin(ctx, 0xE0C5); bus.write(0x0000, cpu.X); cpu.totalCycles += 3;
+    cpu.PC = 0xE0C7;
+}
+
+static void Block_E0C7(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // E0C7  INX
+    RecompiledBegin(ctx, 0xE0C7); cpu.X++; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // E0C8  INC $0400
+    { RecompiledBegin(ctx, 0xE0C8); const byte result = static_cast<byte>(bus.read(0x0400) + 1); bus.write(0x0400, result); SetNZ(cpu, result); cpu.totalCycles += 6; }
+    // E0CB  INC $0400
+    { RecompiledBegin(ctx, 0xE0CB); const byte result = static_cast<byte>(bus.read(0x0400) + 1); bus.write(0x0400, result); SetNZ(cpu, result); cpu.totalCycles += 6; }
+    // E0CE  CMP $0400,Y
+    { RecompiledBegin(ctx, 0xE0CE); const memAddress ea = static_cast<memAddress>(0x0400 + cpu.Y); Compare(cpu, cpu.A, bus.read(ea)); cpu.totalCycles += 4 + (((ea & 0xFF00) != 0x0400) ? 1 : 0); }
+    // E0D1  BEQ $E0D5
+    RecompiledBegin(ctx, 0xE0D1); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xE0D5; return; }
+    // E0D3  BMI $E0D7
+    RecompiledBegin(ctx, 0xE0D3); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xE0D7; return; }
+    cpu.PC = 0xE0D5;
+}
+
+static void Block_E0D5(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // E0D5  STX $00
+    RecompiledBegin(ctx, 0xE0D5); bus.write(0x0000, cpu.X); cpu.totalCycles += 3;
+    cpu.PC = 0xE0D7;
+}
+
+static void Block_E0D7(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // E0D7  INX
+    RecompiledBegin(ctx, 0xE0D7); cpu.X++; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // E0D8  LDA #$00
+    RecompiledBegin(ctx, 0xE0D8); cpu.A = 0x00; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // E0DA  STA $0400
+    RecompiledBegin(ctx, 0xE0DA); bus.write(0x0400, cpu.A); cpu.totalCycles += 4;
+    // E0DD  LDA #$80
+    RecompiledBegin(ctx, 0xE0DD); cpu.A = 0x80; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // E0DF  CMP $0400,Y
+    { RecompiledBegin(ctx, 0xE0DF); const memAddress ea = static_cast<memAddress>(0x0400 + cpu.Y); Compare(cpu, cpu.A, bus.read(ea)); cpu.totalCycles += 4 + (((ea & 0xFF00) != 0x0400) ? 1 : 0); }
+    // E0E2  BEQ $E0E8
+    RecompiledBegin(ctx, 0xE0E2); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xE0E8; return; }
+    // E0E4  BPL $E0E8
+    RecompiledBegin(ctx, 0xE0E4); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xE0E8; return; }
+    // E0E6  BCS $E0EA
+    RecompiledBegin(ctx, 0xE0E6); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xE0EA; return; }
+    cpu.PC = 0xE0E8;
+}
+
+static void Block_E0E8(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // E0E8  STX $00
+    RecompiledBegin(ctx, 0xE0E8); bus.write(0x0000, cpu.X); cpu.totalCycles += 3;
+    cpu.PC = 0xE0EA;
+}
+
+static void Block_E0EA(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // E0EA  INX
+    RecompiledBegin(ctx, 0xE0EA); cpu.X++; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // E0EB  LDY #$80
+    RecompiledBegin(ctx, 0xE0EB); cpu.Y = 0x80; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // E0ED  STY $0400
+    RecompiledBegin(ctx, 0xE0ED); bus.write(0x0400, cpu.Y); cpu.totalCycles += 4;
+    // E0F0  LDY #$00
+    RecompiledBegin(ctx, 0xE0F0); cpu.Y = 0x00; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // E0F2  CMP $0400,Y
+    { RecompiledBegin(ctx, 0xE0F2); const memAddress ea = static_cast<memAddress>(0x0400 + cpu.Y); Compare(cpu, cpu.A, bus.read(ea)); cpu.totalCycles += 4 + (((ea & 0xFF00) != 0x0400) ? 1 : 0); }
+    // E0F5  BNE $E0FB
+    RecompiledBegin(ctx, 0xE0F5); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xE0FB; return; }
+    // E0F7  BMI $E0FB
+    RecompiledBegin(ctx, 0xE0F7); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xE0FB; return; }
+    // E0F9  BCS $E0FD
+    RecompiledBegin(ctx, 0xE0F9); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xE0FD; return; }
+    cpu.PC = 0xE0FB;
+}
+
+static void Block_E0FB(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // E0FB  STX $00
+    RecompiledBegin(ctx, 0xE0FB); bus.write(0x0000, cpu.X); cpu.totalCycles += 3;
+    cpu.PC = 0xE0FD;
+}
+
+static void Block_E0FD(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // E0FD  INX
+    RecompiledBegin(ctx, 0xE0FD); cpu.X++; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // E0FE  INC $0400
+    { RecompiledBegin(ctx, 0xE0FE); const byte result = static_cast<byte>(bus.read(0x0400) + 1); bus.write(0x0400, result); SetNZ(cpu, result); cpu.totalCycles += 6; }
+    // E101  CMP $0400,Y
+    { RecompiledBegin(ctx, 0xE101); const memAddress ea = static_cast<memAddress>(0x0400 + cpu.Y); Compare(cpu, cpu.A, bus.read(ea)); cpu.totalCycles += 4 + (((ea & 0xFF00) != 0x0400) ? 1 : 0); }
+    // E104  BCS $E10A
+    RecompiledBegin(ctx, 0xE104); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xE10A; return; }
+    // E106  BEQ $E10A
+    RecompiledBegin(ctx, 0xE106); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xE10A; return; }
+    // E108  BMI $E10C
+    RecompiledBegin(ctx, 0xE108); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xE10C; return; }
+    cpu.PC = 0xE10A;
+}
+
+static void Block_E10A(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // E10A  STX $00
+    RecompiledBegin(ctx, 0xE10A); bus.write(0x0000, cpu.X); cpu.totalCycles += 3;
+    cpu.PC = 0xE10C;
+}
+
+static void Block_E10C(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // E10C  INX
+    RecompiledBegin(ctx, 0xE10C); cpu.X++; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // E10D  DEC $0400
+    { RecompiledBegin(ctx, 0xE10D); const byte result = static_cast<byte>(bus.read(0x0400) - 1); bus.write(0x0400, result); SetNZ(cpu, result); cpu.totalCycles += 6; }
+    // E110  DEC $0400
+    { RecompiledBegin(ctx, 0xE110); const byte result = static_cast<byte>(bus.read(0x0400) - 1); bus.write(0x0400, result); SetNZ(cpu, result); cpu.totalCycles += 6; }
+    // E113  CMP $0400,Y
+    { RecompiledBegin(ctx, 0xE113); const memAddress ea = static_cast<memAddress>(0x0400 + cpu.Y); Compare(cpu, cpu.A, bus.read(ea)); cpu.totalCycles += 4 + (((ea & 0xFF00) != 0x0400) ? 1 : 0); }
+    // E116  BCC $E11C
+    RecompiledBegin(ctx, 0xE116); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xE11C; return; }
+    // E118  BEQ $E11C
+    RecompiledBegin(ctx, 0xE118); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xE11C; return; }
+    // E11A  BPL $E11E
+    RecompiledBegin(ctx, 0xE11A); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xE11E; return; }
+    cpu.PC = 0xE11C;
+}
+
+static void Block_E11C(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // E11C  STX $00
+    RecompiledBegin(ctx, 0xE11C); bus.write(0x0000, cpu.X); cpu.totalCycles += 3;
+    cpu.PC = 0xE11E;
+}
+
+static void Block_E11E(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // E11E  INX
+    RecompiledBegin(ctx, 0xE11E); cpu.X++; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // E11F  BIT $01
+    RecompiledBegin(ctx, 0xE11F); BitTest(cpu, bus.read(0x0001)); cpu.totalCycles += 3;
+    // E121  LDA #$40
+    RecompiledBegin(ctx, 0xE121); cpu.A = 0x40; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // E123  STA $0400
+    RecompiledBegin(ctx, 0xE123); bus.write(0x0400, cpu.A); cpu.totalCycles += 4;
+    // E126  SEC
+    RecompiledBegin(ctx, 0xE126); SetFlag(cpu, Flags::C, true); cpu.totalCycles += 2;
+    // E127  SBC $0400,Y
+    { RecompiledBegin(ctx, 0xE127); const memAddress ea = static_cast<memAddress>(0x0400 + cpu.Y); SubtractBinary(cpu, bus.read(ea)); cpu.totalCycles += 4 + (((ea & 0xFF00) != 0x0400) ? 1 : 0); }
+    // E12A  BMI $E136
+    RecompiledBegin(ctx, 0xE12A); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xE136; return; }
+    // E12C  BCC $E136
+    RecompiledBegin(ctx, 0xE12C); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xE136; return; }
+    // E12E  BNE $E136
+    RecompiledBegin(ctx, 0xE12E); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xE136; return; }
+    // E130  BVS $E136
+    RecompiledBegin(ctx, 0xE130); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xE136; return; }
+    // E132  CMP #$00
+    RecompiledBegin(ctx, 0xE132); Compare(cpu, cpu.A, 0x00); cpu.totalCycles += 2;
+    // E134  BEQ $E138
+    RecompiledBegin(ctx, 0xE134); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xE138; return; }
+    cpu.PC = 0xE136;
+}
+
+static void Block_E136(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // E136  STX $00
+    RecompiledBegin(ctx, 0xE136); bus.write(0x0000, cpu.X); cpu.totalCycles += 3;
+    cpu.PC = 0xE138;
+}
+
+static void Block_E138(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // E138  INX
+    RecompiledBegin(ctx, 0xE138); cpu.X++; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // E139  CLV
+    RecompiledBegin(ctx, 0xE139); SetFlag(cpu, Flags::V, false); cpu.totalCycles += 2;
+    // E13A  SEC
+    RecompiledBegin(ctx, 0xE13A); SetFlag(cpu, Flags::C, true); cpu.totalCycles += 2;
+    // E13B  LDA #$40
+    RecompiledBegin(ctx, 0xE13B); cpu.A = 0x40; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // E13D  DEC $0400
+    { RecompiledBegin(ctx, 0xE13D); const byte result = static_cast<byte>(bus.read(0x0400) - 1); bus.write(0x0400, result); SetNZ(cpu, result); cpu.totalCycles += 6; }
+    // E140  SBC $0400,Y
+    { RecompiledBegin(ctx, 0xE140); const memAddress ea = static_cast<memAddress>(0x0400 + cpu.Y); SubtractBinary(cpu, bus.read(ea)); cpu.totalCycles += 4 + (((ea & 0xFF00) != 0x0400) ? 1 : 0); }
+    // E143  BEQ $E14F
+    RecompiledBegin(ctx, 0xE143); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xE14F; return; }
+    // E145  BMI $E14F
+    RecompiledBegin(ctx, 0xE145); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xE14F; return; }
+    // E147  BCC $E14F
+    RecompiledBegin(ctx, 0xE147); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xE14F; return; }
+    // E149  BVS $E14F
+    RecompiledBegin(ctx, 0xE149); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xE14F; return; }
+    // E14B  CMP #$01
+    RecompiledBegin(ctx, 0xE14B); Compare(cpu, cpu.A, 0x01); cpu.totalCycles += 2;
+    // E14D  BEQ $E151
+    RecompiledBegin(ctx, 0xE14D); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xE151; return; }
+    cpu.PC = 0xE14F;
+}
+
+static void Block_E14F(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // E14F  STX $00
+    RecompiledBegin(ctx, 0xE14F); bus.write(0x0000, cpu.X); cpu.totalCycles += 3;
+    cpu.PC = 0xE151;
+}
+
+static void Block_E151(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // E151  INX
+    RecompiledBegin(ctx, 0xE151); cpu.X++; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // E152  LDA #$40
+    RecompiledBegin(ctx, 0xE152); cpu.A = 0x40; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // E154  SEC
+    RecompiledBegin(ctx, 0xE154); SetFlag(cpu, Flags::C, true); cpu.totalCycles += 2;
+    // E155  BIT $01
+    RecompiledBegin(ctx, 0xE155); BitTest(cpu, bus.read(0x0001)); cpu.totalCycles += 3;
+    // E157  INC $0400
+    { RecompiledBegin(ctx, 0xE157); const byte result = static_cast<byte>(bus.read(0x0400) + 1); bus.write(0x0400, result); SetNZ(cpu, result); cpu.totalCycles += 6; }
+    // E15A  INC $0400
+    { RecompiledBegin(ctx, 0xE15A); const byte result = static_cast<byte>(bus.read(0x0400) + 1); bus.write(0x0400, result); SetNZ(cpu, result); cpu.totalCycles += 6; }
+    // E15D  SBC $0400,Y
+    { RecompiledBegin(ctx, 0xE15D); const memAddress ea = static_cast<memAddress>(0x0400 + cpu.Y); SubtractBinary(cpu, bus.read(ea)); cpu.totalCycles += 4 + (((ea & 0xFF00) != 0x0400) ? 1 : 0); }
+    // E160  BCS $E16C
+    RecompiledBegin(ctx, 0xE160); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xE16C; return; }
+    // E162  BEQ $E16C
+    RecompiledBegin(ctx, 0xE162); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xE16C; return; }
+    // E164  BPL $E16C
+    RecompiledBegin(ctx, 0xE164); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xE16C; return; }
+    // E166  BVS $E16C
+    RecompiledBegin(ctx, 0xE166); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xE16C; return; }
+    // E168  CMP #$FF
+    RecompiledBegin(ctx, 0xE168); Compare(cpu, cpu.A, 0xFF); cpu.totalCycles += 2;
+    // E16A  BEQ $E16E
+    RecompiledBegin(ctx, 0xE16A); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xE16E; return; }
+    cpu.PC = 0xE16C;
+}
+
+static void Block_E16C(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // E16C  STX $00
+    RecompiledBegin(ctx, 0xE16C); bus.write(0x0000, cpu.X); cpu.totalCycles += 3;
+    cpu.PC = 0xE16E;
+}
+
+static void Block_E16E(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // E16E  INX
+    RecompiledBegin(ctx, 0xE16E); cpu.X++; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // E16F  CLC
+    RecompiledBegin(ctx, 0xE16F); SetFlag(cpu, Flags::C, false); cpu.totalCycles += 2;
+    // E170  LDA #$00
+    RecompiledBegin(ctx, 0xE170); cpu.A = 0x00; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // E172  STA $0400
+    RecompiledBegin(ctx, 0xE172); bus.write(0x0400, cpu.A); cpu.totalCycles += 4;
+    // E175  LDA #$80
+    RecompiledBegin(ctx, 0xE175); cpu.A = 0x80; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // E177  SBC $0400,Y
+    { RecompiledBegin(ctx, 0xE177); const memAddress ea = static_cast<memAddress>(0x0400 + cpu.Y); SubtractBinary(cpu, bus.read(ea)); cpu.totalCycles += 4 + (((ea & 0xFF00) != 0x0400) ? 1 : 0); }
+    // E17A  BCC $E180
+    RecompiledBegin(ctx, 0xE17A); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xE180; return; }
+    // E17C  CMP #$7F
+    RecompiledBegin(ctx, 0xE17C); Compare(cpu, cpu.A, 0x7F); cpu.totalCycles += 2;
+    // E17E  BEQ $E182
+    RecompiledBegin(ctx, 0xE17E); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xE182; return; }
+    cpu.PC = 0xE180;
+}
+
+static void Block_E180(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // E180  STX $00
+    RecompiledBegin(ctx, 0xE180); bus.write(0x0000, cpu.X); cpu.totalCycles += 3;
+    cpu.PC = 0xE182;
+}
+
+static void Block_E182(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // E182  INX
+    RecompiledBegin(ctx, 0xE182); cpu.X++; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // E183  SEC
+    RecompiledBegin(ctx, 0xE183); SetFlag(cpu, Flags::C, true); cpu.totalCycles += 2;
+    // E184  LDA #$7F
+    RecompiledBegin(ctx, 0xE184); cpu.A = 0x7F; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // E186  STA $0400
+    RecompiledBegin(ctx, 0xE186); bus.write(0x0400, cpu.A); cpu.totalCycles += 4;
+    // E189  LDA #$81
+    RecompiledBegin(ctx, 0xE189); cpu.A = 0x81; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // E18B  SBC $0400,Y
+    { RecompiledBegin(ctx, 0xE18B); const memAddress ea = static_cast<memAddress>(0x0400 + cpu.Y); SubtractBinary(cpu, bus.read(ea)); cpu.totalCycles += 4 + (((ea & 0xFF00) != 0x0400) ? 1 : 0); }
+    // E18E  BVC $E196
+    RecompiledBegin(ctx, 0xE18E); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xE196; return; }
+    // E190  BCC $E196
+    RecompiledBegin(ctx, 0xE190); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xE196; return; }
+    // E192  CMP #$02
+    RecompiledBegin(ctx, 0xE192); Compare(cpu, cpu.A, 0x02); cpu.totalCycles += 2;
+    // E194  BEQ $E198
+    RecompiledBegin(ctx, 0xE194); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xE198; return; }
+    cpu.PC = 0xE196;
+}
+
+static void Block_E196(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // E196  STX $00
+    RecompiledBegin(ctx, 0xE196); bus.write(0x0000, cpu.X); cpu.totalCycles += 3;
+    cpu.PC = 0xE198;
+}
+
+static void Block_E198(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // E198  INX
+    RecompiledBegin(ctx, 0xE198); cpu.X++; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // E199  LDA #$00
+    RecompiledBegin(ctx, 0xE199); cpu.A = 0x00; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // E19B  LDA #$87
+    RecompiledBegin(ctx, 0xE19B); cpu.A = 0x87; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // E19D  STA $0400,Y
+    { RecompiledBegin(ctx, 0xE19D); const memAddress ea = static_cast<memAddress>(0x0400 + cpu.Y); bus.write(ea, cpu.A); cpu.totalCycles += 5; }
+    // E1A0  LDA $0400
+    RecompiledBegin(ctx, 0xE1A0); cpu.A = bus.read(0x0400); SetNZ(cpu, cpu.A); cpu.totalCycles += 4;
+    // E1A3  CMP #$87
+    RecompiledBegin(ctx, 0xE1A3); Compare(cpu, cpu.A, 0x87); cpu.totalCycles += 2;
+    // E1A5  BEQ $E1A9
+    RecompiledBegin(ctx, 0xE1A5); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xE1A9; return; }
+    // E1A7  STX $00
+    RecompiledBegin(ctx, 0xE1A7); bus.write(0x0000, cpu.X); cpu.totalCycles += 3;
+    cpu.PC = 0xE1A9;
+}
+
+static void Block_E1A9(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // E1A9  RTS
+    { RecompiledBegin(ctx, 0xE1A9); cpu.SP++; const byte low = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); const byte high = bus.read(static_cast<memAddress>(0x0100 + cpu.SP + 1)); cpu.SP++; cpu.totalCycles += 6; cpu.PC = static_cast<memAddress>(RecompiledWord(low, high) + 1); return; }
+}
+
+static void Block_E1AA(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // E1AA  LDA #$FF
+    RecompiledBegin(ctx, 0xE1AA); cpu.A = 0xFF; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // E1AC  STA $01
+    RecompiledBegin(ctx, 0xE1AC); bus.write(0x0001, cpu.A); cpu.totalCycles += 3;
+    // E1AE  LDA #$AA
+    RecompiledBegin(ctx, 0xE1AE); cpu.A = 0xAA; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // E1B0  STA $0633
+    RecompiledBegin(ctx, 0xE1B0); bus.write(0x0633, cpu.A); cpu.totalCycles += 4;
+    // E1B3  LDA #$BB
+    RecompiledBegin(ctx, 0xE1B3); cpu.A = 0xBB; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // E1B5  STA $0689
+    RecompiledBegin(ctx, 0xE1B5); bus.write(0x0689, cpu.A); cpu.totalCycles += 4;
+    // E1B8  LDX #$00
+    RecompiledBegin(ctx, 0xE1B8); cpu.X = 0x00; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // E1BA  LDA #$66
+    RecompiledBegin(ctx, 0xE1BA); cpu.A = 0x66; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // E1BC  BIT $01
+    RecompiledBegin(ctx, 0xE1BC); BitTest(cpu, bus.read(0x0001)); cpu.totalCycles += 3;
+    // E1BE  SEC
+    RecompiledBegin(ctx, 0xE1BE); SetFlag(cpu, Flags::C, true); cpu.totalCycles += 2;
+    // E1BF  LDY #$00
+    RecompiledBegin(ctx, 0xE1BF); cpu.Y = 0x00; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // E1C1  LDY $0633,X
+    { RecompiledBegin(ctx, 0xE1C1); const memAddress ea = static_cast<memAddress>(0x0633 + cpu.X); cpu.Y = bus.read(ea); SetNZ(cpu, cpu.Y); cpu.totalCycles += 4 + (((ea & 0xFF00) != 0x0600) ? 1 : 0); }
+    // E1C4  BPL $E1D8
+    RecompiledBegin(ctx, 0xE1C4); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xE1D8; return; }
+    // E1C6  BEQ $E1D8
+    RecompiledBegin(ctx, 0xE1C6); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xE1D8; return; }
+    // E1C8  BVC $E1D8
+    RecompiledBegin(ctx, 0xE1C8); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xE1D8; return; }
+    // E1CA  BCC $E1D8
+    RecompiledBegin(ctx, 0xE1CA); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xE1D8; return; }
+    // E1CC  CMP #$66
+    RecompiledBegin(ctx, 0xE1CC); Compare(cpu, cpu.A, 0x66); cpu.totalCycles += 2;
+    // E1CE  BNE $E1D8
+    RecompiledBegin(ctx, 0xE1CE); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xE1D8; return; }
+    // E1D0  CPX #$00
+    RecompiledBegin(ctx, 0xE1D0); Compare(cpu, cpu.X, 0x00); cpu.totalCycles += 2;
+    // E1D2  BNE $E1D8
+    RecompiledBegin(ctx, 0xE1D2); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xE1D8; return; }
+    // E1D4  CPY #$AA
+    RecompiledBegin(ctx, 0xE1D4); Compare(cpu, cpu.Y, 0xAA); cpu.totalCycles += 2;
+    // E1D6  BEQ $E1DC
+    RecompiledBegin(ctx, 0xE1D6); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xE1DC; return; }
+    cpu.PC = 0xE1D8;
+}
+
+static void Block_E1D8(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // E1D8  LDA #$51
+    RecompiledBegin(ctx, 0xE1D8); cpu.A = 0x51; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // E1DA  STA $00
+    RecompiledBegin(ctx, 0xE1DA); bus.write(0x0000, cpu.A); cpu.totalCycles += 3;
+    cpu.PC = 0xE1DC;
+}
+
+static void Block_E1DC(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // E1DC  LDX #$8A
+    RecompiledBegin(ctx, 0xE1DC); cpu.X = 0x8A; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // E1DE  LDA #$66
+    RecompiledBegin(ctx, 0xE1DE); cpu.A = 0x66; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // E1E0  CLV
+    RecompiledBegin(ctx, 0xE1E0); SetFlag(cpu, Flags::V, false); cpu.totalCycles += 2;
+    // E1E1  CLC
+    RecompiledBegin(ctx, 0xE1E1); SetFlag(cpu, Flags::C, false); cpu.totalCycles += 2;
+    // E1E2  LDY #$00
+    RecompiledBegin(ctx, 0xE1E2); cpu.Y = 0x00; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // E1E4  LDY $05FF,X
+    { RecompiledBegin(ctx, 0xE1E4); const memAddress ea = static_cast<memAddress>(0x05FF + cpu.X); cpu.Y = bus.read(ea); SetNZ(cpu, cpu.Y); cpu.totalCycles += 4 + (((ea & 0xFF00) != 0x0500) ? 1 : 0); }
+    // E1E7  BPL $E1FB
+    RecompiledBegin(ctx, 0xE1E7); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xE1FB; return; }
+    // E1E9  BEQ $E1FB
+    RecompiledBegin(ctx, 0xE1E9); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xE1FB; return; }
+    // E1EB  BVS $E1FB
+    RecompiledBegin(ctx, 0xE1EB); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xE1FB; return; }
+    // E1ED  BCS $E1FB
+    RecompiledBegin(ctx, 0xE1ED); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xE1FB; return; }
+    // E1EF  CPY #$BB
+    RecompiledBegin(ctx, 0xE1EF); Compare(cpu, cpu.Y, 0xBB); cpu.totalCycles += 2;
+    // E1F1  BNE $E1FB
+    RecompiledBegin(ctx, 0xE1F1); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xE1FB; return; }
+    // E1F3  CMP #$66
+    RecompiledBegin(ctx, 0xE1F3); Compare(cpu, cpu.A, 0x66); cpu.totalCycles += 2;
+    // E1F5  BNE $E1FB
+    RecompiledBegin(ctx, 0xE1F5); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xE1FB; return; }
+    // E1F7  CPX #$8A
+    RecompiledBegin(ctx, 0xE1F7); Compare(cpu, cpu.X, 0x8A); cpu.totalCycles += 2;
+    // E1F9  BEQ $E1FF
+    RecompiledBegin(ctx, 0xE1F9); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xE1FF; return; }
+    cpu.PC = 0xE1FB;
+}
+
+static void Block_E1FB(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // E1FB  LDA #$52
+    RecompiledBegin(ctx, 0xE1FB); cpu.A = 0x52; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // E1FD  STA $00
+    RecompiledBegin(ctx, 0xE1FD); bus.write(0x0000, cpu.A); cpu.totalCycles += 3;
+    cpu.PC = 0xE1FF;
+}
+
+static void Block_E1FF(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // E1FF  LDY #$53
+    RecompiledBegin(ctx, 0xE1FF); cpu.Y = 0x53; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // E201  LDA #$AA
+    RecompiledBegin(ctx, 0xE201); cpu.A = 0xAA; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // E203  LDX #$78
+    RecompiledBegin(ctx, 0xE203); cpu.X = 0x78; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // E205  STA $0678
+    RecompiledBegin(ctx, 0xE205); bus.write(0x0678, cpu.A); cpu.totalCycles += 4;
+    // E208  JSR $F7B6
+    RecompiledBegin(ctx, 0xE208); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xE2); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x0A); cpu.totalCycles += 6; cpu.PC = 0xF7B6; return;
+}
+
+static void Block_E20B(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // E20B  ORA $0600,X
+    { RecompiledBegin(ctx, 0xE20B); const memAddress ea = static_cast<memAddress>(0x0600 + cpu.X); cpu.A = static_cast<byte>(cpu.A | bus.read(ea)); SetNZ(cpu, cpu.A); cpu.totalCycles += 4 + (((ea & 0xFF00) != 0x0600) ? 1 : 0); }
+    // E20E  JSR $F7C0
+    RecompiledBegin(ctx, 0xE20E); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xE2); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x10); cpu.totalCycles += 6; cpu.PC = 0xF7C0; return;
+}
+
+static void Block_E211(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // E211  INY
+    RecompiledBegin(ctx, 0xE211); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // E212  LDA #$00
+    RecompiledBegin(ctx, 0xE212); cpu.A = 0x00; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // E214  STA $0678
+    RecompiledBegin(ctx, 0xE214); bus.write(0x0678, cpu.A); cpu.totalCycles += 4;
+    // E217  JSR $F7CE
+    RecompiledBegin(ctx, 0xE217); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xE2); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x19); cpu.totalCycles += 6; cpu.PC = 0xF7CE; return;
+}
+
+static void Block_E21A(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // E21A  ORA $0600,X
+    { RecompiledBegin(ctx, 0xE21A); const memAddress ea = static_cast<memAddress>(0x0600 + cpu.X); cpu.A = static_cast<byte>(cpu.A | bus.read(ea)); SetNZ(cpu, cpu.A); cpu.totalCycles += 4 + (((ea & 0xFF00) != 0x0600) ? 1 : 0); }
+    // E21D  JSR $F7D3
+    RecompiledBegin(ctx, 0xE21D); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xE2); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x1F); cpu.totalCycles += 6; cpu.PC = 0xF7D3; return;
+}
+
+static void Block_E220(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // E220  INY
+    RecompiledBegin(ctx, 0xE220); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // E221  LDA #$AA
+    RecompiledBegin(ctx, 0xE221); cpu.A = 0xAA; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // E223  STA $0678
+    RecompiledBegin(ctx, 0xE223); bus.write(0x0678, cpu.A); cpu.totalCycles += 4;
+    // E226  JSR $F7DF
+    RecompiledBegin(ctx, 0xE226); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xE2); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x28); cpu.totalCycles += 6; cpu.PC = 0xF7DF; return;
+}
+
+static void Block_E229(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // E229  AND $0600,X
+    { RecompiledBegin(ctx, 0xE229); const memAddress ea = static_cast<memAddress>(0x0600 + cpu.X); cpu.A = static_cast<byte>(cpu.A & bus.read(ea)); SetNZ(cpu, cpu.A); cpu.totalCycles += 4 + (((ea & 0xFF00) != 0x0600) ? 1 : 0); }
+    // E22C  JSR $F7E5
+    RecompiledBegin(ctx, 0xE22C); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xE2); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x2E); cpu.totalCycles += 6; cpu.PC = 0xF7E5; return;
+}
+
+static void Block_E22F(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // E22F  INY
+    RecompiledBegin(ctx, 0xE22F); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // E230  LDA #$EF
+    RecompiledBegin(ctx, 0xE230); cpu.A = 0xEF; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // E232  STA $0678
+    RecompiledBegin(ctx, 0xE232); bus.write(0x0678, cpu.A); cpu.totalCycles += 4;
+    // E235  JSR $F7F1
+    RecompiledBegin(ctx, 0xE235); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xE2); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x37); cpu.totalCycles += 6; cpu.PC = 0xF7F1; return;
+}
+
+static void Block_E238(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // E238  AND $0600,X
+    { RecompiledBegin(ctx, 0xE238); const memAddress ea = static_cast<memAddress>(0x0600 + cpu.X); cpu.A = static_cast<byte>(cpu.A & bus.read(ea)); SetNZ(cpu, cpu.A); cpu.totalCycles += 4 + (((ea & 0xFF00) != 0x0600) ? 1 : 0); }
+    // E23B  JSR $F7F6
+    RecompiledBegin(ctx, 0xE23B); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xE2); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x3D); cpu.totalCycles += 6; cpu.PC = 0xF7F6; return;
+}
+
+static void Block_E23E(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // E23E  INY
+    RecompiledBegin(ctx, 0xE23E); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // E23F  LDA #$AA
+    RecompiledBegin(ctx, 0xE23F); cpu.A = 0xAA; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // E241  STA $0678
+    RecompiledBegin(ctx, 0xE241); bus.write(0x0678, cpu.A); cpu.totalCycles += 4;
+    // E244  JSR $F804
+    RecompiledBegin(ctx, 0xE244); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xE2); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x46); cpu.totalCycles += 6; cpu.PC = 0xF804; return;
+}
+
+static void Block_E247(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // E247  EOR $0600,X
+    { RecompiledBegin(ctx, 0xE247); const memAddress ea = static_cast<memAddress>(0x0600 + cpu.X); cpu.A = static_cast<byte>(cpu.A ^ bus.read(ea)); SetNZ(cpu, cpu.A); cpu.totalCycles += 4 + (((ea & 0xFF00) != 0x0600) ? 1 : 0); }
+    // E24A  JSR $F80A
+    RecompiledBegin(ctx, 0xE24A); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xE2); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x4C); cpu.totalCycles += 6; cpu.PC = 0xF80A; return;
+}
+
+static void Block_E24D(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // E24D  INY
+    RecompiledBegin(ctx, 0xE24D); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // E24E  LDA #$70
+    RecompiledBegin(ctx, 0xE24E); cpu.A = 0x70; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // E250  STA $0678
+    RecompiledBegin(ctx, 0xE250); bus.write(0x0678, cpu.A); cpu.totalCycles += 4;
+    // E253  JSR $F818
+    RecompiledBegin(ctx, 0xE253); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xE2); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x55); cpu.totalCycles += 6; cpu.PC = 0xF818; return;
+}
+
+static void Block_E256(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // E256  EOR $0600,X
+    { RecompiledBegin(ctx, 0xE256); const memAddress ea = static_cast<memAddress>(0x0600 + cpu.X); cpu.A = static_cast<byte>(cpu.A ^ bus.read(ea)); SetNZ(cpu, cpu.A); cpu.totalCycles += 4 + (((ea & 0xFF00) != 0x0600) ? 1 : 0); }
+    // E259  JSR $F81D
+    RecompiledBegin(ctx, 0xE259); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xE2); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x5B); cpu.totalCycles += 6; cpu.PC = 0xF81D; return;
+}
+
+static void Block_E25C(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // E25C  INY
+    RecompiledBegin(ctx, 0xE25C); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // E25D  LDA #$69
+    RecompiledBegin(ctx, 0xE25D); cpu.A = 0x69; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // E25F  STA $0678
+    RecompiledBegin(ctx, 0xE25F); bus.write(0x0678, cpu.A); cpu.totalCycles += 4;
+    // E262  JSR $F829
+    RecompiledBegin(ctx, 0xE262); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xE2); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x64); cpu.totalCycles += 6; cpu.PC = 0xF829; return;
+}
+
+static void Block_E265(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // E265  ADC $0600,X
+    { RecompiledBegin(ctx, 0xE265); const memAddress ea = static_cast<memAddress>(0x0600 + cpu.X); AddBinary(cpu, bus.read(ea)); cpu.totalCycles += 4 + (((ea & 0xFF00) != 0x0600) ? 1 : 0); }
+    // E268  JSR $F82F
+    RecompiledBegin(ctx, 0xE268); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xE2); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x6A); cpu.totalCycles += 6; cpu.PC = 0xF82F; return;
+}
+
+static void Block_E26B(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // E26B  INY
+    RecompiledBegin(ctx, 0xE26B); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // E26C  JSR $F83D
+    RecompiledBegin(ctx, 0xE26C); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xE2); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x6E); cpu.totalCycles += 6; cpu.PC = 0xF83D; return;
+}
+
+static void Block_E26F(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // E26F  ADC $0600,X
+    { RecompiledBegin(ctx, 0xE26F); const memAddress ea = static_cast<memAddress>(0x0600 + cpu.X); AddBinary(cpu, bus.read(ea)); cpu.totalCycles += 4 + (((ea & 0xFF00) != 0x0600) ? 1 : 0); }
+    // E272  JSR $F843
+    RecompiledBegin(ctx, 0xE272); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xE2); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x74); cpu.totalCycles += 6; cpu.PC = 0xF843; return;
+}
+
+static void Block_E275(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // E275  INY
+    RecompiledBegin(ctx, 0xE275); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // E276  LDA #$7F
+    RecompiledBegin(ctx, 0xE276); cpu.A = 0x7F; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // E278  STA $0678
+    RecompiledBegin(ctx, 0xE278); bus.write(0x0678, cpu.A); cpu.totalCycles += 4;
+    // E27B  JSR $F851
+    RecompiledBegin(ctx, 0xE27B); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xE2); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x7D); cpu.totalCycles += 6; cpu.PC = 0xF851; return;
+}
+
+static void Block_E27E(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // E27E  ADC $0600,X
+    { RecompiledBegin(ctx, 0xE27E); const memAddress ea = static_cast<memAddress>(0x0600 + cpu.X); AddBinary(cpu, bus.read(ea)); cpu.totalCycles += 4 + (((ea & 0xFF00) != 0x0600) ? 1 : 0); }
+    // E281  JSR $F856
+    RecompiledBegin(ctx, 0xE281); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xE2); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x83); cpu.totalCycles += 6; cpu.PC = 0xF856; return;
+}
+
+static void Block_E284(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // E284  INY
+    RecompiledBegin(ctx, 0xE284); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // E285  LDA #$80
+    RecompiledBegin(ctx, 0xE285); cpu.A = 0x80; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // E287  STA $0678
+    RecompiledBegin(ctx, 0xE287); bus.write(0x0678, cpu.A); cpu.totalCycles += 4;
+    // E28A  JSR $F864
+    RecompiledBegin(ctx, 0xE28A); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xE2); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x8C); cpu.totalCycles += 6; cpu.PC = 0xF864; return;
+}
+
+static void Block_E28D(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // E28D  ADC $0600,X
+    { RecompiledBegin(ctx, 0xE28D); const memAddress ea = static_cast<memAddress>(0x0600 + cpu.X); AddBinary(cpu, bus.read(ea)); cpu.totalCycles += 4 + (((ea & 0xFF00) != 0x0600) ? 1 : 0); }
+    // E290  JSR $F86A
+    RecompiledBegin(ctx, 0xE290); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xE2); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x92); cpu.totalCycles += 6; cpu.PC = 0xF86A; return;
+}
+
+static void Block_E293(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // E293  INY
+    RecompiledBegin(ctx, 0xE293); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // E294  JSR $F878
+    RecompiledBegin(ctx, 0xE294); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xE2); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x96); cpu.totalCycles += 6; cpu.PC = 0xF878; return;
+}
+
+static void Block_E297(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // E297  ADC $0600,X
+    { RecompiledBegin(ctx, 0xE297); const memAddress ea = static_cast<memAddress>(0x0600 + cpu.X); AddBinary(cpu, bus.read(ea)); cpu.totalCycles += 4 + (((ea & 0xFF00) != 0x0600) ? 1 : 0); }
+    // E29A  JSR $F87D
+    RecompiledBegin(ctx, 0xE29A); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xE2); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x9C); cpu.totalCycles += 6; cpu.PC = 0xF87D; return;
+}
+
+static void Block_E29D(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // E29D  INY
+    RecompiledBegin(ctx, 0xE29D); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // E29E  LDA #$40
+    RecompiledBegin(ctx, 0xE29E); cpu.A = 0x40; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // E2A0  STA $0678
+    RecompiledBegin(ctx, 0xE2A0); bus.write(0x0678, cpu.A); cpu.totalCycles += 4;
+    // E2A3  JSR $F889
+    RecompiledBegin(ctx, 0xE2A3); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xE2); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xA5); cpu.totalCycles += 6; cpu.PC = 0xF889; return;
+}
+
+static void Block_E2A6(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // E2A6  CMP $0600,X
+    { RecompiledBegin(ctx, 0xE2A6); const memAddress ea = static_cast<memAddress>(0x0600 + cpu.X); Compare(cpu, cpu.A, bus.read(ea)); cpu.totalCycles += 4 + (((ea & 0xFF00) != 0x0600) ? 1 : 0); }
+    // E2A9  JSR $F88E
+    RecompiledBegin(ctx, 0xE2A9); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xE2); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xAB); cpu.totalCycles += 6; cpu.PC = 0xF88E; return;
+}
+
+static void Block_E2AC(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // E2AC  INY
+    RecompiledBegin(ctx, 0xE2AC); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // E2AD  PHA
+    RecompiledBegin(ctx, 0xE2AD); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), cpu.A); cpu.totalCycles += 3;
+    // E2AE  LDA #$3F
+    RecompiledBegin(ctx, 0xE2AE); cpu.A = 0x3F; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // E2B0  STA $0678
+    RecompiledBegin(ctx, 0xE2B0); bus.write(0x0678, cpu.A); cpu.totalCycles += 4;
+    // E2B3  PLA
+    RecompiledBegin(ctx, 0xE2B3); cpu.SP++; cpu.A = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); SetNZ(cpu, cpu.A); cpu.totalCycles += 4;
+    // E2B4  JSR $F89A
+    RecompiledBegin(ctx, 0xE2B4); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xE2); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xB6); cpu.totalCycles += 6; cpu.PC = 0xF89A; return;
+}
+
+static void Block_E2B7(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // E2B7  CMP $0600,X
+    { RecompiledBegin(ctx, 0xE2B7); const memAddress ea = static_cast<memAddress>(0x0600 + cpu.X); Compare(cpu, cpu.A, bus.read(ea)); cpu.totalCycles += 4 + (((ea & 0xFF00) != 0x0600) ? 1 : 0); }
+    // E2BA  JSR $F89C
+    RecompiledBegin(ctx, 0xE2BA); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xE2); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xBC); cpu.totalCycles += 6; cpu.PC = 0xF89C; return;
+}
+
+static void Block_E2BD(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // E2BD  INY
+    RecompiledBegin(ctx, 0xE2BD); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // E2BE  PHA
+    RecompiledBegin(ctx, 0xE2BE); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), cpu.A); cpu.totalCycles += 3;
+    // E2BF  LDA #$41
+    RecompiledBegin(ctx, 0xE2BF); cpu.A = 0x41; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // E2C1  STA $0678
+    RecompiledBegin(ctx, 0xE2C1); bus.write(0x0678, cpu.A); cpu.totalCycles += 4;
+    // E2C4  PLA
+    RecompiledBegin(ctx, 0xE2C4); cpu.SP++; cpu.A = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); SetNZ(cpu, cpu.A); cpu.totalCycles += 4;
+    // E2C5  CMP $0600,X
+    { RecompiledBegin(ctx, 0xE2C5); const memAddress ea = static_cast<memAddress>(0x0600 + cpu.X); Compare(cpu, cpu.A, bus.read(ea)); cpu.totalCycles += 4 + (((ea & 0xFF00) != 0x0600) ? 1 : 0); }
+    // E2C8  JSR $F8A8
+    RecompiledBegin(ctx, 0xE2C8); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xE2); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xCA); cpu.totalCycles += 6; cpu.PC = 0xF8A8; return;
+}
+
+static void Block_E2CB(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // E2CB  INY
+    RecompiledBegin(ctx, 0xE2CB); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // E2CC  PHA
+    RecompiledBegin(ctx, 0xE2CC); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), cpu.A); cpu.totalCycles += 3;
+    // E2CD  LDA #$00
+    RecompiledBegin(ctx, 0xE2CD); cpu.A = 0x00; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // E2CF  STA $0678
+    RecompiledBegin(ctx, 0xE2CF); bus.write(0x0678, cpu.A); cpu.totalCycles += 4;
+    // E2D2  PLA
+    RecompiledBegin(ctx, 0xE2D2); cpu.SP++; cpu.A = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); SetNZ(cpu, cpu.A); cpu.totalCycles += 4;
+    // E2D3  JSR $F8B2
+    RecompiledBegin(ctx, 0xE2D3); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xE2); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD5); cpu.totalCycles += 6; cpu.PC = 0xF8B2; return;
+}
+
+static void Block_E2D6(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // E2D6  CMP $0600,X
+    { RecompiledBegin(ctx, 0xE2D6); const memAddress ea = static_cast<memAddress>(0x0600 + cpu.X); Compare(cpu, cpu.A, bus.read(ea)); cpu.totalCycles += 4 + (((ea & 0xFF00) != 0x0600) ? 1 : 0); }
+    // E2D9  JSR $F8B5
+    RecompiledBegin(ctx, 0xE2D9); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xE2); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xDB); cpu.totalCycles += 6; cpu.PC = 0xF8B5; return;
+}
+
+static void Block_E2DC(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // E2DC  INY
+    RecompiledBegin(ctx, 0xE2DC); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // E2DD  PHA
+    RecompiledBegin(ctx, 0xE2DD); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), cpu.A); cpu.totalCycles += 3;
+    // E2DE  LDA #$80
+    RecompiledBegin(ctx, 0xE2DE); cpu.A = 0x80; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // E2E0  STA $0678
+    RecompiledBegin(ctx, 0xE2E0); bus.write(0x0678, cpu.A); cpu.totalCycles += 4;
+    // E2E3  PLA
+    RecompiledBegin(ctx, 0xE2E3); cpu.SP++; cpu.A = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); SetNZ(cpu, cpu.A); cpu.totalCycles += 4;
+    // E2E4  CMP $0600,X
+    { RecompiledBegin(ctx, 0xE2E4); const memAddress ea = static_cast<memAddress>(0x0600 + cpu.X); Compare(cpu, cpu.A, bus.read(ea)); cpu.totalCycles += 4 + (((ea & 0xFF00) != 0x0600) ? 1 : 0); }
+    // E2E7  JSR $F8BF
+    RecompiledBegin(ctx, 0xE2E7); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xE2); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xE9); cpu.totalCycles += 6; cpu.PC = 0xF8BF; return;
+}
+
+static void Block_E2EA(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // E2EA  INY
+    RecompiledBegin(ctx, 0xE2EA); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // E2EB  PHA
+    RecompiledBegin(ctx, 0xE2EB); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), cpu.A); cpu.totalCycles += 3;
+    // E2EC  LDA #$81
+    RecompiledBegin(ctx, 0xE2EC); cpu.A = 0x81; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // E2EE  STA $0678
+    RecompiledBegin(ctx, 0xE2EE); bus.write(0x0678, cpu.A); cpu.totalCycles += 4;
+    // E2F1  PLA
+    RecompiledBegin(ctx, 0xE2F1); cpu.SP++; cpu.A = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); SetNZ(cpu, cpu.A); cpu.totalCycles += 4;
+    // E2F2  CMP $0600,X
+    { RecompiledBegin(ctx, 0xE2F2); const memAddress ea = static_cast<memAddress>(0x0600 + cpu.X); Compare(cpu, cpu.A, bus.read(ea)); cpu.totalCycles += 4 + (((ea & 0xFF00) != 0x0600) ? 1 : 0); }
+    // E2F5  JSR $F8C9
+    RecompiledBegin(ctx, 0xE2F5); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xE2); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xF7); cpu.totalCycles += 6; cpu.PC = 0xF8C9; return;
+}
+
+static void Block_E2F8(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // E2F8  INY
+    RecompiledBegin(ctx, 0xE2F8); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // E2F9  PHA
+    RecompiledBegin(ctx, 0xE2F9); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), cpu.A); cpu.totalCycles += 3;
+    // E2FA  LDA #$7F
+    RecompiledBegin(ctx, 0xE2FA); cpu.A = 0x7F; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // E2FC  STA $0678
+    RecompiledBegin(ctx, 0xE2FC); bus.write(0x0678, cpu.A); cpu.totalCycles += 4;
+    // E2FF  PLA
+    RecompiledBegin(ctx, 0xE2FF); cpu.SP++; cpu.A = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); SetNZ(cpu, cpu.A); cpu.totalCycles += 4;
+    // E300  CMP $0600,X
+    { RecompiledBegin(ctx, 0xE300); const memAddress ea = static_cast<memAddress>(0x0600 + cpu.X); Compare(cpu, cpu.A, bus.read(ea)); cpu.totalCycles += 4 + (((ea & 0xFF00) != 0x0600) ? 1 : 0); }
+    // E303  JSR $F8D3
+    RecompiledBegin(ctx, 0xE303); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xE3); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x05); cpu.totalCycles += 6; cpu.PC = 0xF8D3; return;
+}
+
+static void Block_E306(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // E306  INY
+    RecompiledBegin(ctx, 0xE306); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // E307  LDA #$40
+    RecompiledBegin(ctx, 0xE307); cpu.A = 0x40; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // E309  STA $0678
+    RecompiledBegin(ctx, 0xE309); bus.write(0x0678, cpu.A); cpu.totalCycles += 4;
+    // E30C  JSR $F931
+    RecompiledBegin(ctx, 0xE30C); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xE3); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x0E); cpu.totalCycles += 6; cpu.PC = 0xF931; return;
+}
+
+static void Block_E30F(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // E30F  SBC $0600,X
+    { RecompiledBegin(ctx, 0xE30F); const memAddress ea = static_cast<memAddress>(0x0600 + cpu.X); SubtractBinary(cpu, bus.read(ea)); cpu.totalCycles += 4 + (((ea & 0xFF00) != 0x0600) ? 1 : 0); }
+    // E312  JSR $F937
+    RecompiledBegin(ctx, 0xE312); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xE3); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x14); cpu.totalCycles += 6; cpu.PC = 0xF937; return;
+}
+
+static void Block_E315(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // E315  INY
+    RecompiledBegin(ctx, 0xE315); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // E316  LDA #$3F
+    RecompiledBegin(ctx, 0xE316); cpu.A = 0x3F; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // E318  STA $0678
+    RecompiledBegin(ctx, 0xE318); bus.write(0x0678, cpu.A); cpu.totalCycles += 4;
+    // E31B  JSR $F947
+    RecompiledBegin(ctx, 0xE31B); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xE3); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x1D); cpu.totalCycles += 6; cpu.PC = 0xF947; return;
+}
+
+static void Block_E31E(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // E31E  SBC $0600,X
+    { RecompiledBegin(ctx, 0xE31E); const memAddress ea = static_cast<memAddress>(0x0600 + cpu.X); SubtractBinary(cpu, bus.read(ea)); cpu.totalCycles += 4 + (((ea & 0xFF00) != 0x0600) ? 1 : 0); }
+    // E321  JSR $F94C
+    RecompiledBegin(ctx, 0xE321); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xE3); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x23); cpu.totalCycles += 6; cpu.PC = 0xF94C; return;
+}
+
+static void Block_E324(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // E324  INY
+    RecompiledBegin(ctx, 0xE324); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // E325  LDA #$41
+    RecompiledBegin(ctx, 0xE325); cpu.A = 0x41; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // E327  STA $0678
+    RecompiledBegin(ctx, 0xE327); bus.write(0x0678, cpu.A); cpu.totalCycles += 4;
+    // E32A  JSR $F95C
+    RecompiledBegin(ctx, 0xE32A); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xE3); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x2C); cpu.totalCycles += 6; cpu.PC = 0xF95C; return;
+}
+
+static void Block_E32D(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // E32D  SBC $0600,X
+    { RecompiledBegin(ctx, 0xE32D); const memAddress ea = static_cast<memAddress>(0x0600 + cpu.X); SubtractBinary(cpu, bus.read(ea)); cpu.totalCycles += 4 + (((ea & 0xFF00) != 0x0600) ? 1 : 0); }
+    // E330  JSR $F962
+    RecompiledBegin(ctx, 0xE330); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xE3); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x32); cpu.totalCycles += 6; cpu.PC = 0xF962; return;
+}
+
+static void Block_E333(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // E333  INY
+    RecompiledBegin(ctx, 0xE333); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // E334  LDA #$00
+    RecompiledBegin(ctx, 0xE334); cpu.A = 0x00; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // E336  STA $0678
+    RecompiledBegin(ctx, 0xE336); bus.write(0x0678, cpu.A); cpu.totalCycles += 4;
+    // E339  JSR $F972
+    RecompiledBegin(ctx, 0xE339); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xE3); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x3B); cpu.totalCycles += 6; cpu.PC = 0xF972; return;
+}
+
+static void Block_E33C(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // E33C  SBC $0600,X
+    { RecompiledBegin(ctx, 0xE33C); const memAddress ea = static_cast<memAddress>(0x0600 + cpu.X); SubtractBinary(cpu, bus.read(ea)); cpu.totalCycles += 4 + (((ea & 0xFF00) != 0x0600) ? 1 : 0); }
+    // E33F  JSR $F976
+    RecompiledBegin(ctx, 0xE33F); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xE3); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x41); cpu.totalCycles += 6; cpu.PC = 0xF976; return;
+}
+
+static void Block_E342(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // E342  INY
+    RecompiledBegin(ctx, 0xE342); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // E343  LDA #$7F
+    RecompiledBegin(ctx, 0xE343); cpu.A = 0x7F; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // E345  STA $0678
+    RecompiledBegin(ctx, 0xE345); bus.write(0x0678, cpu.A); cpu.totalCycles += 4;
+    // E348  JSR $F980
+    RecompiledBegin(ctx, 0xE348); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xE3); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x4A); cpu.totalCycles += 6; cpu.PC = 0xF980; return;
+}
+
+static void Block_E34B(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // E34B  SBC $0600,X
+    { RecompiledBegin(ctx, 0xE34B); const memAddress ea = static_cast<memAddress>(0x0600 + cpu.X); SubtractBinary(cpu, bus.read(ea)); cpu.totalCycles += 4 + (((ea & 0xFF00) != 0x0600) ? 1 : 0); }
+    // E34E  JSR $F984
+    RecompiledBegin(ctx, 0xE34E); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xE3); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x50); cpu.totalCycles += 6; cpu.PC = 0xF984; return;
+}
+
+static void Block_E351(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // E351  LDA #$AA
+    RecompiledBegin(ctx, 0xE351); cpu.A = 0xAA; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // E353  STA $0633
+    RecompiledBegin(ctx, 0xE353); bus.write(0x0633, cpu.A); cpu.totalCycles += 4;
+    // E356  LDA #$BB
+    RecompiledBegin(ctx, 0xE356); cpu.A = 0xBB; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // E358  STA $0689
+    RecompiledBegin(ctx, 0xE358); bus.write(0x0689, cpu.A); cpu.totalCycles += 4;
+    // E35B  LDX #$00
+    RecompiledBegin(ctx, 0xE35B); cpu.X = 0x00; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // E35D  LDY #$66
+    RecompiledBegin(ctx, 0xE35D); cpu.Y = 0x66; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // E35F  BIT $01
+    RecompiledBegin(ctx, 0xE35F); BitTest(cpu, bus.read(0x0001)); cpu.totalCycles += 3;
+    // E361  SEC
+    RecompiledBegin(ctx, 0xE361); SetFlag(cpu, Flags::C, true); cpu.totalCycles += 2;
+    // E362  LDA #$00
+    RecompiledBegin(ctx, 0xE362); cpu.A = 0x00; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // E364  LDA $0633,X
+    { RecompiledBegin(ctx, 0xE364); const memAddress ea = static_cast<memAddress>(0x0633 + cpu.X); cpu.A = bus.read(ea); SetNZ(cpu, cpu.A); cpu.totalCycles += 4 + (((ea & 0xFF00) != 0x0600) ? 1 : 0); }
+    // E367  BPL $E37B
+    RecompiledBegin(ctx, 0xE367); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xE37B; return; }
+    // E369  BEQ $E37B
+    RecompiledBegin(ctx, 0xE369); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xE37B; return; }
+    // E36B  BVC $E37B
+    RecompiledBegin(ctx, 0xE36B); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xE37B; return; }
+    // E36D  BCC $E37B
+    RecompiledBegin(ctx, 0xE36D); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xE37B; return; }
+    // E36F  CPY #$66
+    RecompiledBegin(ctx, 0xE36F); Compare(cpu, cpu.Y, 0x66); cpu.totalCycles += 2;
+    // E371  BNE $E37B
+    RecompiledBegin(ctx, 0xE371); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xE37B; return; }
+    // E373  CPX #$00
+    RecompiledBegin(ctx, 0xE373); Compare(cpu, cpu.X, 0x00); cpu.totalCycles += 2;
+    // E375  BNE $E37B
+    RecompiledBegin(ctx, 0xE375); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xE37B; return; }
+    // E377  CMP #$AA
+    RecompiledBegin(ctx, 0xE377); Compare(cpu, cpu.A, 0xAA); cpu.totalCycles += 2;
+    // E379  BEQ $E37F
+    RecompiledBegin(ctx, 0xE379); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xE37F; return; }
+    cpu.PC = 0xE37B;
+}
+
+static void Block_E37B(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // E37B  LDA #$6A
+    RecompiledBegin(ctx, 0xE37B); cpu.A = 0x6A; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // E37D  STA $00
+    RecompiledBegin(ctx, 0xE37D); bus.write(0x0000, cpu.A); cpu.totalCycles += 3;
+    cpu.PC = 0xE37F;
+}
+
+static void Block_E37F(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // E37F  LDX #$8A
+    RecompiledBegin(ctx, 0xE37F); cpu.X = 0x8A; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // E381  LDY #$66
+    RecompiledBegin(ctx, 0xE381); cpu.Y = 0x66; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // E383  CLV
+    RecompiledBegin(ctx, 0xE383); SetFlag(cpu, Flags::V, false); cpu.totalCycles += 2;
+    // E384  CLC
+    RecompiledBegin(ctx, 0xE384); SetFlag(cpu, Flags::C, false); cpu.totalCycles += 2;
+    // E385  LDA #$00
+    RecompiledBegin(ctx, 0xE385); cpu.A = 0x00; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // E387  LDA $05FF,X
+    { RecompiledBegin(ctx, 0xE387); const memAddress ea = static_cast<memAddress>(0x05FF + cpu.X); cpu.A = bus.read(ea); SetNZ(cpu, cpu.A); cpu.totalCycles += 4 + (((ea & 0xFF00) != 0x0500) ? 1 : 0); }
+    // E38A  BPL $E39E
+    RecompiledBegin(ctx, 0xE38A); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xE39E; return; }
+    // E38C  BEQ $E39E
+    RecompiledBegin(ctx, 0xE38C); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xE39E; return; }
+    // E38E  BVS $E39E
+    RecompiledBegin(ctx, 0xE38E); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xE39E; return; }
+    // E390  BCS $E39E
+    RecompiledBegin(ctx, 0xE390); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xE39E; return; }
+    // E392  CMP #$BB
+    RecompiledBegin(ctx, 0xE392); Compare(cpu, cpu.A, 0xBB); cpu.totalCycles += 2;
+    // E394  BNE $E39E
+    RecompiledBegin(ctx, 0xE394); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xE39E; return; }
+    // E396  CPY #$66
+    RecompiledBegin(ctx, 0xE396); Compare(cpu, cpu.Y, 0x66); cpu.totalCycles += 2;
+    // E398  BNE $E39E
+    RecompiledBegin(ctx, 0xE398); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xE39E; return; }
+    // E39A  CPX #$8A
+    RecompiledBegin(ctx, 0xE39A); Compare(cpu, cpu.X, 0x8A); cpu.totalCycles += 2;
+    // E39C  BEQ $E3A2
+    RecompiledBegin(ctx, 0xE39C); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xE3A2; return; }
+    cpu.PC = 0xE39E;
+}
+
+static void Block_E39E(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // E39E  LDA #$6B
+    RecompiledBegin(ctx, 0xE39E); cpu.A = 0x6B; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // E3A0  STA $00
+    RecompiledBegin(ctx, 0xE3A0); bus.write(0x0000, cpu.A); cpu.totalCycles += 3;
+    cpu.PC = 0xE3A2;
+}
+
+static void Block_E3A2(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // E3A2  BIT $01
+    RecompiledBegin(ctx, 0xE3A2); BitTest(cpu, bus.read(0x0001)); cpu.totalCycles += 3;
+    // E3A4  SEC
+    RecompiledBegin(ctx, 0xE3A4); SetFlag(cpu, Flags::C, true); cpu.totalCycles += 2;
+    // E3A5  LDA #$44
+    RecompiledBegin(ctx, 0xE3A5); cpu.A = 0x44; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // E3A7  LDX #$00
+    RecompiledBegin(ctx, 0xE3A7); cpu.X = 0x00; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // E3A9  STA $0633,X
+    { RecompiledBegin(ctx, 0xE3A9); const memAddress ea = static_cast<memAddress>(0x0633 + cpu.X); bus.write(ea, cpu.A); cpu.totalCycles += 5; }
+    // E3AC  LDA $0633
+    RecompiledBegin(ctx, 0xE3AC); cpu.A = bus.read(0x0633); SetNZ(cpu, cpu.A); cpu.totalCycles += 4;
+    // E3AF  BCC $E3CB
+    RecompiledBegin(ctx, 0xE3AF); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xE3CB; return; }
+    // E3B1  CMP #$44
+    RecompiledBegin(ctx, 0xE3B1); Compare(cpu, cpu.A, 0x44); cpu.totalCycles += 2;
+    // E3B3  BNE $E3CB
+    RecompiledBegin(ctx, 0xE3B3); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xE3CB; return; }
+    // E3B5  BVC $E3CB
+    RecompiledBegin(ctx, 0xE3B5); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xE3CB; return; }
+    // E3B7  CLC
+    RecompiledBegin(ctx, 0xE3B7); SetFlag(cpu, Flags::C, false); cpu.totalCycles += 2;
+    // E3B8  CLV
+    RecompiledBegin(ctx, 0xE3B8); SetFlag(cpu, Flags::V, false); cpu.totalCycles += 2;
+    // E3B9  LDA #$99
+    RecompiledBegin(ctx, 0xE3B9); cpu.A = 0x99; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // E3BB  LDX #$80
+    RecompiledBegin(ctx, 0xE3BB); cpu.X = 0x80; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // E3BD  STA $0585,X
+    { RecompiledBegin(ctx, 0xE3BD); const memAddress ea = static_cast<memAddress>(0x0585 + cpu.X); bus.write(ea, cpu.A); cpu.totalCycles += 5; }
+    // E3C0  LDA $0605
+    RecompiledBegin(ctx, 0xE3C0); cpu.A = bus.read(0x0605); SetNZ(cpu, cpu.A); cpu.totalCycles += 4;
+    // E3C3  BCS $E3CB
+    RecompiledBegin(ctx, 0xE3C3); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xE3CB; return; }
+    // E3C5  CMP #$99
+    RecompiledBegin(ctx, 0xE3C5); Compare(cpu, cpu.A, 0x99); cpu.totalCycles += 2;
+    // E3C7  BNE $E3CB
+    RecompiledBegin(ctx, 0xE3C7); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xE3CB; return; }
+    // E3C9  BVC $E3CF
+    RecompiledBegin(ctx, 0xE3C9); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xE3CF; return; }
+    cpu.PC = 0xE3CB;
+}
+
+static void Block_E3CB(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // E3CB  LDA #$6C
+    RecompiledBegin(ctx, 0xE3CB); cpu.A = 0x6C; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // E3CD  STA $00
+    RecompiledBegin(ctx, 0xE3CD); bus.write(0x0000, cpu.A); cpu.totalCycles += 3;
+    cpu.PC = 0xE3CF;
+}
+
+static void Block_E3CF(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // E3CF  LDY #$6D
+    RecompiledBegin(ctx, 0xE3CF); cpu.Y = 0x6D; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // E3D1  LDX #$6D
+    RecompiledBegin(ctx, 0xE3D1); cpu.X = 0x6D; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // E3D3  JSR $F990
+    RecompiledBegin(ctx, 0xE3D3); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xE3); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD5); cpu.totalCycles += 6; cpu.PC = 0xF990; return;
+}
+
+static void Block_E3D6(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // E3D6  STA $0600,X
+    { RecompiledBegin(ctx, 0xE3D6); const memAddress ea = static_cast<memAddress>(0x0600 + cpu.X); bus.write(ea, cpu.A); cpu.totalCycles += 5; }
+    // E3D9  LSR $0600,X
+    { RecompiledBegin(ctx, 0xE3D9); const memAddress ea = static_cast<memAddress>(0x0600 + cpu.X); bus.write(ea, ShiftRight(cpu, bus.read(ea))); cpu.totalCycles += 7; }
+    // E3DC  LDA $0600,X
+    { RecompiledBegin(ctx, 0xE3DC); const memAddress ea = static_cast<memAddress>(0x0600 + cpu.X); cpu.A = bus.read(ea); SetNZ(cpu, cpu.A); cpu.totalCycles += 4 + (((ea & 0xFF00) != 0x0600) ? 1 : 0); }
+    // E3DF  JSR $F99D
+    RecompiledBegin(ctx, 0xE3DF); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xE3); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xE1); cpu.totalCycles += 6; cpu.PC = 0xF99D; return;
+}
+
+static void Block_E3E2(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // E3E2  INY
+    RecompiledBegin(ctx, 0xE3E2); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // E3E3  STA $0600,X
+    { RecompiledBegin(ctx, 0xE3E3); const memAddress ea = static_cast<memAddress>(0x0600 + cpu.X); bus.write(ea, cpu.A); cpu.totalCycles += 5; }
+    // E3E6  LSR $0600,X
+    { RecompiledBegin(ctx, 0xE3E6); const memAddress ea = static_cast<memAddress>(0x0600 + cpu.X); bus.write(ea, ShiftRight(cpu, bus.read(ea))); cpu.totalCycles += 7; }
+    // E3E9  LDA $0600,X
+    { RecompiledBegin(ctx, 0xE3E9); const memAddress ea = static_cast<memAddress>(0x0600 + cpu.X); cpu.A = bus.read(ea); SetNZ(cpu, cpu.A); cpu.totalCycles += 4 + (((ea & 0xFF00) != 0x0600) ? 1 : 0); }
+    // E3EC  JSR $F9AD
+    RecompiledBegin(ctx, 0xE3EC); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xE3); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xEE); cpu.totalCycles += 6; cpu.PC = 0xF9AD; return;
+}
+
+static void Block_E3EF(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // E3EF  INY
+    RecompiledBegin(ctx, 0xE3EF); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // E3F0  JSR $F9BD
+    RecompiledBegin(ctx, 0xE3F0); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xE3); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xF2); cpu.totalCycles += 6; cpu.PC = 0xF9BD; return;
+}
+
+static void Block_E3F3(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // E3F3  STA $0600,X
+    { RecompiledBegin(ctx, 0xE3F3); const memAddress ea = static_cast<memAddress>(0x0600 + cpu.X); bus.write(ea, cpu.A); cpu.totalCycles += 5; }
+    // E3F6  ASL $0600,X
+    { RecompiledBegin(ctx, 0xE3F6); const memAddress ea = static_cast<memAddress>(0x0600 + cpu.X); bus.write(ea, ShiftLeft(cpu, bus.read(ea))); cpu.totalCycles += 7; }
+    // E3F9  LDA $0600,X
+    { RecompiledBegin(ctx, 0xE3F9); const memAddress ea = static_cast<memAddress>(0x0600 + cpu.X); cpu.A = bus.read(ea); SetNZ(cpu, cpu.A); cpu.totalCycles += 4 + (((ea & 0xFF00) != 0x0600) ? 1 : 0); }
+    // E3FC  JSR $F9C3
+    RecompiledBegin(ctx, 0xE3FC); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xE3); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xFE); cpu.totalCycles += 6; cpu.PC = 0xF9C3; return;
+}
+
+static void Block_E3FF(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // E3FF  INY
+    RecompiledBegin(ctx, 0xE3FF); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // E400  STA $0600,X
+    { RecompiledBegin(ctx, 0xE400); const memAddress ea = static_cast<memAddress>(0x0600 + cpu.X); bus.write(ea, cpu.A); cpu.totalCycles += 5; }
+    // E403  ASL $0600,X
+    { RecompiledBegin(ctx, 0xE403); const memAddress ea = static_cast<memAddress>(0x0600 + cpu.X); bus.write(ea, ShiftLeft(cpu, bus.read(ea))); cpu.totalCycles += 7; }
+    // E406  LDA $0600,X
+    { RecompiledBegin(ctx, 0xE406); const memAddress ea = static_cast<memAddress>(0x0600 + cpu.X); cpu.A = bus.read(ea); SetNZ(cpu, cpu.A); cpu.totalCycles += 4 + (((ea & 0xFF00) != 0x0600) ? 1 : 0); }
+    // E409  JSR $F9D4
+    RecompiledBegin(ctx, 0xE409); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xE4); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x0B); cpu.totalCycles += 6; cpu.PC = 0xF9D4; return;
+}
+
+static void Block_E40C(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // E40C  INY
+    RecompiledBegin(ctx, 0xE40C); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // E40D  JSR $F9E4
+    RecompiledBegin(ctx, 0xE40D); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xE4); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x0F); cpu.totalCycles += 6; cpu.PC = 0xF9E4; return;
+}
+
+static void Block_E410(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // E410  STA $0600,X
+    { RecompiledBegin(ctx, 0xE410); const memAddress ea = static_cast<memAddress>(0x0600 + cpu.X); bus.write(ea, cpu.A); cpu.totalCycles += 5; }
+    // E413  ROR $0600,X
+    { RecompiledBegin(ctx, 0xE413); const memAddress ea = static_cast<memAddress>(0x0600 + cpu.X); bus.write(ea, RotateRight(cpu, bus.read(ea))); cpu.totalCycles += 7; }
+    // E416  LDA $0600,X
+    { RecompiledBegin(ctx, 0xE416); const memAddress ea = static_cast<memAddress>(0x0600 + cpu.X); cpu.A = bus.read(ea); SetNZ(cpu, cpu.A); cpu.totalCycles += 4 + (((ea & 0xFF00) != 0x0600) ? 1 : 0); }
+    // E419  JSR $F9EA
+    RecompiledBegin(ctx, 0xE419); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xE4); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x1B); cpu.totalCycles += 6; cpu.PC = 0xF9EA; return;
+}
+
+static void Block_E41C(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // E41C  INY
+    RecompiledBegin(ctx, 0xE41C); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // E41D  STA $0600,X
+    { RecompiledBegin(ctx, 0xE41D); const memAddress ea = static_cast<memAddress>(0x0600 + cpu.X); bus.write(ea, cpu.A); cpu.totalCycles += 5; }
+    // E420  ROR $0600,X
+    { RecompiledBegin(ctx, 0xE420); const memAddress ea = static_cast<memAddress>(0x0600 + cpu.X); bus.write(ea, RotateRight(cpu, bus.read(ea))); cpu.totalCycles += 7; }
+    // E423  LDA $0600,X
+    { RecompiledBegin(ctx, 0xE423); const memAddress ea = static_cast<memAddress>(0x0600 + cpu.X); cpu.A = bus.read(ea); SetNZ(cpu, cpu.A); cpu.totalCycles += 4 + (((ea & 0xFF00) != 0x0600) ? 1 : 0); }
+    // E426  JSR $F9FB
+    RecompiledBegin(ctx, 0xE426); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xE4); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x28); cpu.totalCycles += 6; cpu.PC = 0xF9FB; return;
+}
+
+static void Block_E429(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // E429  INY
+    RecompiledBegin(ctx, 0xE429); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // E42A  JSR $FA0A
+    RecompiledBegin(ctx, 0xE42A); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xE4); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x2C); cpu.totalCycles += 6; cpu.PC = 0xFA0A; return;
+}
+
+static void Block_E42D(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // E42D  STA $0600,X
+    { RecompiledBegin(ctx, 0xE42D); const memAddress ea = static_cast<memAddress>(0x0600 + cpu.X); bus.write(ea, cpu.A); cpu.totalCycles += 5; }
+    // E430  ROL $0600,X
+    { RecompiledBegin(ctx, 0xE430); const memAddress ea = static_cast<memAddress>(0x0600 + cpu.X); bus.write(ea, RotateLeft(cpu, bus.read(ea))); cpu.totalCycles += 7; }
+    // E433  LDA $0600,X
+    { RecompiledBegin(ctx, 0xE433); const memAddress ea = static_cast<memAddress>(0x0600 + cpu.X); cpu.A = bus.read(ea); SetNZ(cpu, cpu.A); cpu.totalCycles += 4 + (((ea & 0xFF00) != 0x0600) ? 1 : 0); }
+    // E436  JSR $FA10
+    RecompiledBegin(ctx, 0xE436); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xE4); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x38); cpu.totalCycles += 6; cpu.PC = 0xFA10; return;
+}
+
+static void Block_E439(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // E439  INY
+    RecompiledBegin(ctx, 0xE439); cpu.Y++; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // E43A  STA $0600,X
+    { RecompiledBegin(ctx, 0xE43A); const memAddress ea = static_cast<memAddress>(0x0600 + cpu.X); bus.write(ea, cpu.A); cpu.totalCycles += 5; }
+    // E43D  ROL $0600,X
+    { RecompiledBegin(ctx, 0xE43D); const memAddress ea = static_cast<memAddress>(0x0600 + cpu.X); bus.write(ea, RotateLeft(cpu, bus.read(ea))); cpu.totalCycles += 7; }
+    // E440  LDA $0600,X
+    { RecompiledBegin(ctx, 0xE440); const memAddress ea = static_cast<memAddress>(0x0600 + cpu.X); cpu.A = bus.read(ea); SetNZ(cpu, cpu.A); cpu.totalCycles += 4 + (((ea & 0xFF00) != 0x0600) ? 1 : 0); }
+    // E443  JSR $FA21
+    RecompiledBegin(ctx, 0xE443); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xE4); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x45); cpu.totalCycles += 6; cpu.PC = 0xFA21; return;
+}
+
+static void Block_E446(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // E446  LDA #$FF
+    RecompiledBegin(ctx, 0xE446); cpu.A = 0xFF; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // E448  STA $0600,X
+    { RecompiledBegin(ctx, 0xE448); const memAddress ea = static_cast<memAddress>(0x0600 + cpu.X); bus.write(ea, cpu.A); cpu.totalCycles += 5; }
+    // E44B  STA $01
+    RecompiledBegin(ctx, 0xE44B); bus.write(0x0001, cpu.A); cpu.totalCycles += 3;
+    // E44D  BIT $01
+    RecompiledBegin(ctx, 0xE44D); BitTest(cpu, bus.read(0x0001)); cpu.totalCycles += 3;
+    // E44F  SEC
+    RecompiledBegin(ctx, 0xE44F); SetFlag(cpu, Flags::C, true); cpu.totalCycles += 2;
+    // E450  INC $0600,X
+    { RecompiledBegin(ctx, 0xE450); const memAddress ea = static_cast<memAddress>(0x0600 + cpu.X); const byte result = static_cast<byte>(bus.read(ea) + 1); bus.write(ea, result); SetNZ(cpu, result); cpu.totalCycles += 7; }
+    // E453  BNE $E462
+    RecompiledBegin(ctx, 0xE453); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xE462; return; }
+    // E455  BMI $E462
+    RecompiledBegin(ctx, 0xE455); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xE462; return; }
+    // E457  BVC $E462
+    RecompiledBegin(ctx, 0xE457); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xE462; return; }
+    // E459  BCC $E462
+    RecompiledBegin(ctx, 0xE459); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xE462; return; }
+    // E45B  LDA $0600,X
+    { RecompiledBegin(ctx, 0xE45B); const memAddress ea = static_cast<memAddress>(0x0600 + cpu.X); cpu.A = bus.read(ea); SetNZ(cpu, cpu.A); cpu.totalCycles += 4 + (((ea & 0xFF00) != 0x0600) ? 1 : 0); }
+    // E45E  CMP #$00
+    RecompiledBegin(ctx, 0xE45E); Compare(cpu, cpu.A, 0x00); cpu.totalCycles += 2;
+    // E460  BEQ $E466
+    RecompiledBegin(ctx, 0xE460); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xE466; return; }
+    cpu.PC = 0xE462;
+}
+
+static void Block_E462(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // E462  LDA #$75
+    RecompiledBegin(ctx, 0xE462); cpu.A = 0x75; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // E464  STA $00
+    RecompiledBegin(ctx, 0xE464); bus.write(0x0000, cpu.A); cpu.totalCycles += 3;
+    cpu.PC = 0xE466;
+}
+
+static void Block_E466(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // E466  LDA #$7F
+    RecompiledBegin(ctx, 0xE466); cpu.A = 0x7F; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // E468  STA $0600,X
+    { RecompiledBegin(ctx, 0xE468); const memAddress ea = static_cast<memAddress>(0x0600 + cpu.X); bus.write(ea, cpu.A); cpu.totalCycles += 5; }
+    // E46B  CLV
+    RecompiledBegin(ctx, 0xE46B); SetFlag(cpu, Flags::V, false); cpu.totalCycles += 2;
+    // E46C  CLC
+    RecompiledBegin(ctx, 0xE46C); SetFlag(cpu, Flags::C, false); cpu.totalCycles += 2;
+    // E46D  INC $0600,X
+    { RecompiledBegin(ctx, 0xE46D); const memAddress ea = static_cast<memAddress>(0x0600 + cpu.X); const byte result = static_cast<byte>(bus.read(ea) + 1); bus.write(ea, result); SetNZ(cpu, result); cpu.totalCycles += 7; }
+    // E470  BEQ $E47F
+    RecompiledBegin(ctx, 0xE470); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xE47F; return; }
+    // E472  BPL $E47F
+    RecompiledBegin(ctx, 0xE472); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xE47F; return; }
+    // E474  BVS $E47F
+    RecompiledBegin(ctx, 0xE474); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xE47F; return; }
+    // E476  BCS $E47F
+    RecompiledBegin(ctx, 0xE476); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xE47F; return; }
+    // E478  LDA $0600,X
+    { RecompiledBegin(ctx, 0xE478); const memAddress ea = static_cast<memAddress>(0x0600 + cpu.X); cpu.A = bus.read(ea); SetNZ(cpu, cpu.A); cpu.totalCycles += 4 + (((ea & 0xFF00) != 0x0600) ? 1 : 0); }
+    // E47B  CMP #$80
+    RecompiledBegin(ctx, 0xE47B); Compare(cpu, cpu.A, 0x80); cpu.totalCycles += 2;
+    // E47D  BEQ $E483
+    RecompiledBegin(ctx, 0xE47D); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xE483; return; }
+    cpu.PC = 0xE47F;
+}
+
+static void Block_E47F(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // E47F  LDA #$76
+    RecompiledBegin(ctx, 0xE47F); cpu.A = 0x76; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // E481  STA $00
+    RecompiledBegin(ctx, 0xE481); bus.write(0x0000, cpu.A); cpu.totalCycles += 3;
+    cpu.PC = 0xE483;
+}
+
+static void Block_E483(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // E483  LDA #$00
+    RecompiledBegin(ctx, 0xE483); cpu.A = 0x00; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // E485  STA $0600,X
+    { RecompiledBegin(ctx, 0xE485); const memAddress ea = static_cast<memAddress>(0x0600 + cpu.X); bus.write(ea, cpu.A); cpu.totalCycles += 5; }
+    // E488  BIT $01
+    RecompiledBegin(ctx, 0xE488); BitTest(cpu, bus.read(0x0001)); cpu.totalCycles += 3;
+    // E48A  SEC
+    RecompiledBegin(ctx, 0xE48A); SetFlag(cpu, Flags::C, true); cpu.totalCycles += 2;
+    // E48B  DEC $0600,X
+    { RecompiledBegin(ctx, 0xE48B); const memAddress ea = static_cast<memAddress>(0x0600 + cpu.X); const byte result = static_cast<byte>(bus.read(ea) - 1); bus.write(ea, result); SetNZ(cpu, result); cpu.totalCycles += 7; }
+    // E48E  BEQ $E49D
+    RecompiledBegin(ctx, 0xE48E); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xE49D; return; }
+    // E490  BPL $E49D
+    RecompiledBegin(ctx, 0xE490); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xE49D; return; }
+    // E492  BVC $E49D
+    RecompiledBegin(ctx, 0xE492); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xE49D; return; }
+    // E494  BCC $E49D
+    RecompiledBegin(ctx, 0xE494); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xE49D; return; }
+    // E496  LDA $0600,X
+    { RecompiledBegin(ctx, 0xE496); const memAddress ea = static_cast<memAddress>(0x0600 + cpu.X); cpu.A = bus.read(ea); SetNZ(cpu, cpu.A); cpu.totalCycles += 4 + (((ea & 0xFF00) != 0x0600) ? 1 : 0); }
+    // E499  CMP #$FF
+    RecompiledBegin(ctx, 0xE499); Compare(cpu, cpu.A, 0xFF); cpu.totalCycles += 2;
+    // E49B  BEQ $E4A1
+    RecompiledBegin(ctx, 0xE49B); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xE4A1; return; }
+    cpu.PC = 0xE49D;
+}
+
+static void Block_E49D(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // E49D  LDA #$77
+    RecompiledBegin(ctx, 0xE49D); cpu.A = 0x77; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // E49F  STA $00
+    RecompiledBegin(ctx, 0xE49F); bus.write(0x0000, cpu.A); cpu.totalCycles += 3;
+    cpu.PC = 0xE4A1;
+}
+
+static void Block_E4A1(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // E4A1  LDA #$80
+    RecompiledBegin(ctx, 0xE4A1); cpu.A = 0x80; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // E4A3  STA $0600,X
+    { RecompiledBegin(ctx, 0xE4A3); const memAddress ea = static_cast<memAddress>(0x0600 + cpu.X); bus.write(ea, cpu.A); cpu.totalCycles += 5; }
+    // E4A6  CLV
+    RecompiledBegin(ctx, 0xE4A6); SetFlag(cpu, Flags::V, false); cpu.totalCycles += 2;
+    // E4A7  CLC
+    RecompiledBegin(ctx, 0xE4A7); SetFlag(cpu, Flags::C, false); cpu.totalCycles += 2;
+    // E4A8  DEC $0600,X
+    { RecompiledBegin(ctx, 0xE4A8); const memAddress ea = static_cast<memAddress>(0x0600 + cpu.X); const byte result = static_cast<byte>(bus.read(ea) - 1); bus.write(ea, result); SetNZ(cpu, result); cpu.totalCycles += 7; }
+    // E4AB  BEQ $E4BA
+    RecompiledBegin(ctx, 0xE4AB); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xE4BA; return; }
+    // E4AD  BMI $E4BA
+    RecompiledBegin(ctx, 0xE4AD); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xE4BA; return; }
+    // E4AF  BVS $E4BA
+    RecompiledBegin(ctx, 0xE4AF); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xE4BA; return; }
+    // E4B1  BCS $E4BA
+    RecompiledBegin(ctx, 0xE4B1); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xE4BA; return; }
+    // E4B3  LDA $0600,X
+    { RecompiledBegin(ctx, 0xE4B3); const memAddress ea = static_cast<memAddress>(0x0600 + cpu.X); cpu.A = bus.read(ea); SetNZ(cpu, cpu.A); cpu.totalCycles += 4 + (((ea & 0xFF00) != 0x0600) ? 1 : 0); }
+    // E4B6  CMP #$7F
+    RecompiledBegin(ctx, 0xE4B6); Compare(cpu, cpu.A, 0x7F); cpu.totalCycles += 2;
+    // E4B8  BEQ $E4BE
+    RecompiledBegin(ctx, 0xE4B8); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xE4BE; return; }
+    cpu.PC = 0xE4BA;
+}
+
+static void Block_E4BA(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // E4BA  LDA #$78
+    RecompiledBegin(ctx, 0xE4BA); cpu.A = 0x78; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // E4BC  STA $00
+    RecompiledBegin(ctx, 0xE4BC); bus.write(0x0000, cpu.A); cpu.totalCycles += 3;
+    cpu.PC = 0xE4BE;
+}
+
+static void Block_E4BE(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // E4BE  LDA #$01
+    RecompiledBegin(ctx, 0xE4BE); cpu.A = 0x01; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // E4C0  STA $0600,X
+    { RecompiledBegin(ctx, 0xE4C0); const memAddress ea = static_cast<memAddress>(0x0600 + cpu.X); bus.write(ea, cpu.A); cpu.totalCycles += 5; }
+    // E4C3  DEC $0600,X
+    { RecompiledBegin(ctx, 0xE4C3); const memAddress ea = static_cast<memAddress>(0x0600 + cpu.X); const byte result = static_cast<byte>(bus.read(ea) - 1); bus.write(ea, result); SetNZ(cpu, result); cpu.totalCycles += 7; }
+    // E4C6  BEQ $E4CC
+    RecompiledBegin(ctx, 0xE4C6); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xE4CC; return; }
+    // E4C8  LDA #$79
+    RecompiledBegin(ctx, 0xE4C8); cpu.A = 0x79; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // E4CA  STA $00
+    RecompiledBegin(ctx, 0xE4CA); bus.write(0x0000, cpu.A); cpu.totalCycles += 3;
+    cpu.PC = 0xE4CC;
+}
+
+static void Block_E4CC(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // E4CC  LDA #$33
+    RecompiledBegin(ctx, 0xE4CC); cpu.A = 0x33; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // E4CE  STA $0678
+    RecompiledBegin(ctx, 0xE4CE); bus.write(0x0678, cpu.A); cpu.totalCycles += 4;
+    // E4D1  LDA #$44
+    RecompiledBegin(ctx, 0xE4D1); cpu.A = 0x44; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // E4D3  LDY #$78
+    RecompiledBegin(ctx, 0xE4D3); cpu.Y = 0x78; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // E4D5  LDX #$00
+    RecompiledBegin(ctx, 0xE4D5); cpu.X = 0x00; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // E4D7  SEC
+    RecompiledBegin(ctx, 0xE4D7); SetFlag(cpu, Flags::C, true); cpu.totalCycles += 2;
+    // E4D8  BIT $01
+    RecompiledBegin(ctx, 0xE4D8); BitTest(cpu, bus.read(0x0001)); cpu.totalCycles += 3;
+    // E4DA  LDX $0600,Y
+    { RecompiledBegin(ctx, 0xE4DA); const memAddress ea = static_cast<memAddress>(0x0600 + cpu.Y); cpu.X = bus.read(ea); SetNZ(cpu, cpu.X); cpu.totalCycles += 4 + (((ea & 0xFF00) != 0x0600) ? 1 : 0); }
+    // E4DD  BCC $E4F1
+    RecompiledBegin(ctx, 0xE4DD); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xE4F1; return; }
+    // E4DF  BVC $E4F1
+    RecompiledBegin(ctx, 0xE4DF); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xE4F1; return; }
+    // E4E1  BMI $E4F1
+    RecompiledBegin(ctx, 0xE4E1); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xE4F1; return; }
+    // E4E3  BEQ $E4F1
+    RecompiledBegin(ctx, 0xE4E3); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xE4F1; return; }
+    // E4E5  CPX #$33
+    RecompiledBegin(ctx, 0xE4E5); Compare(cpu, cpu.X, 0x33); cpu.totalCycles += 2;
+    // E4E7  BNE $E4F1
+    RecompiledBegin(ctx, 0xE4E7); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xE4F1; return; }
+    // E4E9  CPY #$78
+    RecompiledBegin(ctx, 0xE4E9); Compare(cpu, cpu.Y, 0x78); cpu.totalCycles += 2;
+    // E4EB  BNE $E4F1
+    RecompiledBegin(ctx, 0xE4EB); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xE4F1; return; }
+    // E4ED  CMP #$44
+    RecompiledBegin(ctx, 0xE4ED); Compare(cpu, cpu.A, 0x44); cpu.totalCycles += 2;
+    // E4EF  BEQ $E4F5
+    RecompiledBegin(ctx, 0xE4EF); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xE4F5; return; }
+    cpu.PC = 0xE4F1;
+}
+
+static void Block_E4F1(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // E4F1  LDA #$7A
+    RecompiledBegin(ctx, 0xE4F1); cpu.A = 0x7A; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // E4F3  STA $00
+    RecompiledBegin(ctx, 0xE4F3); bus.write(0x0000, cpu.A); cpu.totalCycles += 3;
+    cpu.PC = 0xE4F5;
+}
+
+static void Block_E4F5(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // E4F5  LDA #$97
+    RecompiledBegin(ctx, 0xE4F5); cpu.A = 0x97; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // E4F7  STA $067F
+    RecompiledBegin(ctx, 0xE4F7); bus.write(0x067F, cpu.A); cpu.totalCycles += 4;
+    // E4FA  LDA #$47
+    RecompiledBegin(ctx, 0xE4FA); cpu.A = 0x47; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // E4FC  LDY #$FF
+    RecompiledBegin(ctx, 0xE4FC); cpu.Y = 0xFF; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // E4FE  LDX #$00
+    RecompiledBegin(ctx, 0xE4FE); cpu.X = 0x00; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // E500  CLC
+    RecompiledBegin(ctx, 0xE500); SetFlag(cpu, Flags::C, false); cpu.totalCycles += 2;
+    // E501  CLV
+    RecompiledBegin(ctx, 0xE501); SetFlag(cpu, Flags::V, false); cpu.totalCycles += 2;
+    // E502  LDX $0580,Y
+    { RecompiledBegin(ctx, 0xE502); const memAddress ea = static_cast<memAddress>(0x0580 + cpu.Y); cpu.X = bus.read(ea); SetNZ(cpu, cpu.X); cpu.totalCycles += 4 + (((ea & 0xFF00) != 0x0500) ? 1 : 0); }
+    // E505  BCS $E519
+    RecompiledBegin(ctx, 0xE505); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xE519; return; }
+    // E507  BVS $E519
+    RecompiledBegin(ctx, 0xE507); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xE519; return; }
+    // E509  BPL $E519
+    RecompiledBegin(ctx, 0xE509); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xE519; return; }
+    // E50B  BEQ $E519
+    RecompiledBegin(ctx, 0xE50B); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xE519; return; }
+    // E50D  CPX #$97
+    RecompiledBegin(ctx, 0xE50D); Compare(cpu, cpu.X, 0x97); cpu.totalCycles += 2;
+    // E50F  BNE $E519
+    RecompiledBegin(ctx, 0xE50F); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xE519; return; }
+    // E511  CPY #$FF
+    RecompiledBegin(ctx, 0xE511); Compare(cpu, cpu.Y, 0xFF); cpu.totalCycles += 2;
+    // E513  BNE $E519
+    RecompiledBegin(ctx, 0xE513); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xE519; return; }
+    // E515  CMP #$47
+    RecompiledBegin(ctx, 0xE515); Compare(cpu, cpu.A, 0x47); cpu.totalCycles += 2;
+    // E517  BEQ $E51D
+    RecompiledBegin(ctx, 0xE517); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xE51D; return; }
+    cpu.PC = 0xE519;
+}
+
+static void Block_E519(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // E519  LDA #$7B
+    RecompiledBegin(ctx, 0xE519); cpu.A = 0x7B; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // E51B  STA $00
+    RecompiledBegin(ctx, 0xE51B); bus.write(0x0000, cpu.A); cpu.totalCycles += 3;
+    cpu.PC = 0xE51D;
+}
+
+static void Block_E51D(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // E51D  RTS
+    { RecompiledBegin(ctx, 0xE51D); cpu.SP++; const byte low = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); const byte high = bus.read(static_cast<memAddress>(0x0100 + cpu.SP + 1)); cpu.SP++; cpu.totalCycles += 6; cpu.PC = static_cast<memAddress>(RecompiledWord(low, high) + 1); return; }
+}
+
+static void Block_E51E(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // E51E  LDA #$55
+    RecompiledBegin(ctx, 0xE51E); cpu.A = 0x55; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // E520  STA $0580
+    RecompiledBegin(ctx, 0xE520); bus.write(0x0580, cpu.A); cpu.totalCycles += 4;
+    // E523  LDA #$AA
+    RecompiledBegin(ctx, 0xE523); cpu.A = 0xAA; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // E525  STA $0432
+    RecompiledBegin(ctx, 0xE525); bus.write(0x0432, cpu.A); cpu.totalCycles += 4;
+    // E528  LDA #$80
+    RecompiledBegin(ctx, 0xE528); cpu.A = 0x80; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // E52A  STA $43
+    RecompiledBegin(ctx, 0xE52A); bus.write(0x0043, cpu.A); cpu.totalCycles += 3;
+    // E52C  LDA #$05
+    RecompiledBegin(ctx, 0xE52C); cpu.A = 0x05; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // E52E  STA $44
+    RecompiledBegin(ctx, 0xE52E); bus.write(0x0044, cpu.A); cpu.totalCycles += 3;
+    // E530  LDA #$32
+    RecompiledBegin(ctx, 0xE530); cpu.A = 0x32; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // E532  STA $45
+    RecompiledBegin(ctx, 0xE532); bus.write(0x0045, cpu.A); cpu.totalCycles += 3;
+    // E534  LDA #$04
+    RecompiledBegin(ctx, 0xE534); cpu.A = 0x04; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // E536  STA $46
+    RecompiledBegin(ctx, 0xE536); bus.write(0x0046, cpu.A); cpu.totalCycles += 3;
+    // E538  LDX #$03
+    RecompiledBegin(ctx, 0xE538); cpu.X = 0x03; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // E53A  LDY #$77
+    RecompiledBegin(ctx, 0xE53A); cpu.Y = 0x77; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // E53C  LDA #$FF
+    RecompiledBegin(ctx, 0xE53C); cpu.A = 0xFF; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // E53E  STA $01
+    RecompiledBegin(ctx, 0xE53E); bus.write(0x0001, cpu.A); cpu.totalCycles += 3;
+    // E540  BIT $01
+    RecompiledBegin(ctx, 0xE540); BitTest(cpu, bus.read(0x0001)); cpu.totalCycles += 3;
+    // E542  SEC
+    RecompiledBegin(ctx, 0xE542); SetFlag(cpu, Flags::C, true); cpu.totalCycles += 2;
+    // E543  LDA #$00
+    RecompiledBegin(ctx, 0xE543); cpu.A = 0x00; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    cpu.PC = 0xE545;
+}
+
+static void Block_E73D(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // E73D  LDA #$C0
+    RecompiledBegin(ctx, 0xE73D); cpu.A = 0xC0; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // E73F  STA $01
+    RecompiledBegin(ctx, 0xE73F); bus.write(0x0001, cpu.A); cpu.totalCycles += 3;
+    // E741  LDA #$00
+    RecompiledBegin(ctx, 0xE741); cpu.A = 0x00; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // E743  STA $0489
+    RecompiledBegin(ctx, 0xE743); bus.write(0x0489, cpu.A); cpu.totalCycles += 4;
+    // E746  LDA #$89
+    RecompiledBegin(ctx, 0xE746); cpu.A = 0x89; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // E748  STA $60
+    RecompiledBegin(ctx, 0xE748); bus.write(0x0060, cpu.A); cpu.totalCycles += 3;
+    // E74A  LDA #$04
+    RecompiledBegin(ctx, 0xE74A); cpu.A = 0x04; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // E74C  STA $61
+    RecompiledBegin(ctx, 0xE74C); bus.write(0x0061, cpu.A); cpu.totalCycles += 3;
+    // E74E  LDY #$44
+    RecompiledBegin(ctx, 0xE74E); cpu.Y = 0x44; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // E750  LDX #$17
+    RecompiledBegin(ctx, 0xE750); cpu.X = 0x17; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // E752  LDA #$3E
+    RecompiledBegin(ctx, 0xE752); cpu.A = 0x3E; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // E754  BIT $01
+    RecompiledBegin(ctx, 0xE754); BitTest(cpu, bus.read(0x0001)); cpu.totalCycles += 3;
+    // E756  CLC
+    RecompiledBegin(ctx, 0xE756); SetFlag(cpu, Flags::C, false); cpu.totalCycles += 2;
+    cpu.PC = 0xE757;
+}
+
+static void Block_E8D3(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // E8D3  LDY #$90
+    RecompiledBegin(ctx, 0xE8D3); cpu.Y = 0x90; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // E8D5  JSR $F931
+    RecompiledBegin(ctx, 0xE8D5); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xE8); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xD7); cpu.totalCycles += 6; cpu.PC = 0xF931; return;
+}
+
+static void Block_E916(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // E916  LDA #$FF
+    RecompiledBegin(ctx, 0xE916); cpu.A = 0xFF; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // E918  STA $01
+    RecompiledBegin(ctx, 0xE918); bus.write(0x0001, cpu.A); cpu.totalCycles += 3;
+    // E91A  LDY #$95
+    RecompiledBegin(ctx, 0xE91A); cpu.Y = 0x95; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // E91C  LDX #$02
+    RecompiledBegin(ctx, 0xE91C); cpu.X = 0x02; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // E91E  LDA #$47
+    RecompiledBegin(ctx, 0xE91E); cpu.A = 0x47; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // E920  STA $47
+    RecompiledBegin(ctx, 0xE920); bus.write(0x0047, cpu.A); cpu.totalCycles += 3;
+    // E922  LDA #$06
+    RecompiledBegin(ctx, 0xE922); cpu.A = 0x06; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // E924  STA $48
+    RecompiledBegin(ctx, 0xE924); bus.write(0x0048, cpu.A); cpu.totalCycles += 3;
+    // E926  LDA #$EB
+    RecompiledBegin(ctx, 0xE926); cpu.A = 0xEB; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // E928  STA $0647
+    RecompiledBegin(ctx, 0xE928); bus.write(0x0647, cpu.A); cpu.totalCycles += 4;
+    // E92B  JSR $FA31
+    RecompiledBegin(ctx, 0xE92B); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xE9); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x2D); cpu.totalCycles += 6; cpu.PC = 0xFA31; return;
+}
+
+static void Block_EB86(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // EB86  LDA #$FF
+    RecompiledBegin(ctx, 0xEB86); cpu.A = 0xFF; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // EB88  STA $01
+    RecompiledBegin(ctx, 0xEB88); bus.write(0x0001, cpu.A); cpu.totalCycles += 3;
+    // EB8A  LDY #$AA
+    RecompiledBegin(ctx, 0xEB8A); cpu.Y = 0xAA; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // EB8C  LDX #$02
+    RecompiledBegin(ctx, 0xEB8C); cpu.X = 0x02; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // EB8E  LDA #$47
+    RecompiledBegin(ctx, 0xEB8E); cpu.A = 0x47; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // EB90  STA $47
+    RecompiledBegin(ctx, 0xEB90); bus.write(0x0047, cpu.A); cpu.totalCycles += 3;
+    // EB92  LDA #$06
+    RecompiledBegin(ctx, 0xEB92); cpu.A = 0x06; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // EB94  STA $48
+    RecompiledBegin(ctx, 0xEB94); bus.write(0x0048, cpu.A); cpu.totalCycles += 3;
+    // EB96  LDA #$EB
+    RecompiledBegin(ctx, 0xEB96); cpu.A = 0xEB; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // EB98  STA $0647
+    RecompiledBegin(ctx, 0xEB98); bus.write(0x0647, cpu.A); cpu.totalCycles += 4;
+    // EB9B  JSR $FAB1
+    RecompiledBegin(ctx, 0xEB9B); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xEB); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x9D); cpu.totalCycles += 6; cpu.PC = 0xFAB1; return;
+}
+
+static void Block_EDF6(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // EDF6  LDA #$FF
+    RecompiledBegin(ctx, 0xEDF6); cpu.A = 0xFF; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // EDF8  STA $01
+    RecompiledBegin(ctx, 0xEDF8); bus.write(0x0001, cpu.A); cpu.totalCycles += 3;
+    // EDFA  LDY #$BF
+    RecompiledBegin(ctx, 0xEDFA); cpu.Y = 0xBF; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // EDFC  LDX #$02
+    RecompiledBegin(ctx, 0xEDFC); cpu.X = 0x02; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // EDFE  LDA #$47
+    RecompiledBegin(ctx, 0xEDFE); cpu.A = 0x47; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // EE00  STA $47
+    RecompiledBegin(ctx, 0xEE00); bus.write(0x0047, cpu.A); cpu.totalCycles += 3;
+    // EE02  LDA #$06
+    RecompiledBegin(ctx, 0xEE02); cpu.A = 0x06; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // EE04  STA $48
+    RecompiledBegin(ctx, 0xEE04); bus.write(0x0048, cpu.A); cpu.totalCycles += 3;
+    // EE06  LDA #$A5
+    RecompiledBegin(ctx, 0xEE06); cpu.A = 0xA5; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // EE08  STA $0647
+    RecompiledBegin(ctx, 0xEE08); bus.write(0x0647, cpu.A); cpu.totalCycles += 4;
+    // EE0B  JSR $FA7B
+    RecompiledBegin(ctx, 0xEE0B); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xEE); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x0D); cpu.totalCycles += 6; cpu.PC = 0xFA7B; return;
+}
+
+static void Block_F066(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // F066  LDA #$FF
+    RecompiledBegin(ctx, 0xF066); cpu.A = 0xFF; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // F068  STA $01
+    RecompiledBegin(ctx, 0xF068); bus.write(0x0001, cpu.A); cpu.totalCycles += 3;
+    // F06A  LDY #$D4
+    RecompiledBegin(ctx, 0xF06A); cpu.Y = 0xD4; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // F06C  LDX #$02
+    RecompiledBegin(ctx, 0xF06C); cpu.X = 0x02; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // F06E  LDA #$47
+    RecompiledBegin(ctx, 0xF06E); cpu.A = 0x47; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // F070  STA $47
+    RecompiledBegin(ctx, 0xF070); bus.write(0x0047, cpu.A); cpu.totalCycles += 3;
+    // F072  LDA #$06
+    RecompiledBegin(ctx, 0xF072); cpu.A = 0x06; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // F074  STA $48
+    RecompiledBegin(ctx, 0xF074); bus.write(0x0048, cpu.A); cpu.totalCycles += 3;
+    // F076  LDA #$A5
+    RecompiledBegin(ctx, 0xF076); cpu.A = 0xA5; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // F078  STA $0647
+    RecompiledBegin(ctx, 0xF078); bus.write(0x0647, cpu.A); cpu.totalCycles += 4;
+    // F07B  JSR $FB53
+    RecompiledBegin(ctx, 0xF07B); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xF0); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x7D); cpu.totalCycles += 6; cpu.PC = 0xFB53; return;
+}
+
+static void Block_F2D6(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // F2D6  LDA #$FF
+    RecompiledBegin(ctx, 0xF2D6); cpu.A = 0xFF; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // F2D8  STA $01
+    RecompiledBegin(ctx, 0xF2D8); bus.write(0x0001, cpu.A); cpu.totalCycles += 3;
+    // F2DA  LDY #$E9
+    RecompiledBegin(ctx, 0xF2DA); cpu.Y = 0xE9; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // F2DC  LDX #$02
+    RecompiledBegin(ctx, 0xF2DC); cpu.X = 0x02; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // F2DE  LDA #$47
+    RecompiledBegin(ctx, 0xF2DE); cpu.A = 0x47; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // F2E0  STA $47
+    RecompiledBegin(ctx, 0xF2E0); bus.write(0x0047, cpu.A); cpu.totalCycles += 3;
+    // F2E2  LDA #$06
+    RecompiledBegin(ctx, 0xF2E2); cpu.A = 0x06; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // F2E4  STA $48
+    RecompiledBegin(ctx, 0xF2E4); bus.write(0x0048, cpu.A); cpu.totalCycles += 3;
+    // F2E6  LDA #$A5
+    RecompiledBegin(ctx, 0xF2E6); cpu.A = 0xA5; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // F2E8  STA $0647
+    RecompiledBegin(ctx, 0xF2E8); bus.write(0x0647, cpu.A); cpu.totalCycles += 4;
+    // F2EB  JSR $FB1D
+    RecompiledBegin(ctx, 0xF2EB); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xF2); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xED); cpu.totalCycles += 6; cpu.PC = 0xFB1D; return;
+}
+
+static void Block_F546(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // F546  LDA #$FF
+    RecompiledBegin(ctx, 0xF546); cpu.A = 0xFF; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // F548  STA $01
+    RecompiledBegin(ctx, 0xF548); bus.write(0x0001, cpu.A); cpu.totalCycles += 3;
+    // F54A  LDY #$01
+    RecompiledBegin(ctx, 0xF54A); cpu.Y = 0x01; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // F54C  LDX #$02
+    RecompiledBegin(ctx, 0xF54C); cpu.X = 0x02; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // F54E  LDA #$47
+    RecompiledBegin(ctx, 0xF54E); cpu.A = 0x47; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // F550  STA $47
+    RecompiledBegin(ctx, 0xF550); bus.write(0x0047, cpu.A); cpu.totalCycles += 3;
+    // F552  LDA #$06
+    RecompiledBegin(ctx, 0xF552); cpu.A = 0x06; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // F554  STA $48
+    RecompiledBegin(ctx, 0xF554); bus.write(0x0048, cpu.A); cpu.totalCycles += 3;
+    // F556  LDA #$A5
+    RecompiledBegin(ctx, 0xF556); cpu.A = 0xA5; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // F558  STA $0647
+    RecompiledBegin(ctx, 0xF558); bus.write(0x0647, cpu.A); cpu.totalCycles += 4;
+    // F55B  JSR $FAE9
+    RecompiledBegin(ctx, 0xF55B); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0xF5); bus.write(static_cast<memAddress>(0x0100 + cpu.SP--), 0x5D); cpu.totalCycles += 6; cpu.PC = 0xFAE9; return;
+}
+
+static void Block_F7B6(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // F7B6  CLC
+    RecompiledBegin(ctx, 0xF7B6); SetFlag(cpu, Flags::C, false); cpu.totalCycles += 2;
+    // F7B7  LDA #$FF
+    RecompiledBegin(ctx, 0xF7B7); cpu.A = 0xFF; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // F7B9  STA $01
+    RecompiledBegin(ctx, 0xF7B9); bus.write(0x0001, cpu.A); cpu.totalCycles += 3;
+    // F7BB  BIT $01
+    RecompiledBegin(ctx, 0xF7BB); BitTest(cpu, bus.read(0x0001)); cpu.totalCycles += 3;
+    // F7BD  LDA #$55
+    RecompiledBegin(ctx, 0xF7BD); cpu.A = 0x55; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // F7BF  RTS
+    { RecompiledBegin(ctx, 0xF7BF); cpu.SP++; const byte low = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); const byte high = bus.read(static_cast<memAddress>(0x0100 + cpu.SP + 1)); cpu.SP++; cpu.totalCycles += 6; cpu.PC = static_cast<memAddress>(RecompiledWord(low, high) + 1); return; }
+}
+
+static void Block_F7C0(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // F7C0  BCS $F7CB
+    RecompiledBegin(ctx, 0xF7C0); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xF7CB; return; }
+    // F7C2  BPL $F7CB
+    RecompiledBegin(ctx, 0xF7C2); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xF7CB; return; }
+    // F7C4  CMP #$FF
+    RecompiledBegin(ctx, 0xF7C4); Compare(cpu, cpu.A, 0xFF); cpu.totalCycles += 2;
+    // F7C6  BNE $F7CB
+    RecompiledBegin(ctx, 0xF7C6); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xF7CB; return; }
+    // F7C8  BVC $F7CB
+    RecompiledBegin(ctx, 0xF7C8); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xF7CB; return; }
+    // F7CA  RTS
+    { RecompiledBegin(ctx, 0xF7CA); cpu.SP++; const byte low = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); const byte high = bus.read(static_cast<memAddress>(0x0100 + cpu.SP + 1)); cpu.SP++; cpu.totalCycles += 6; cpu.PC = static_cast<memAddress>(RecompiledWord(low, high) + 1); return; }
+}
+
+static void Block_F7CB(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // F7CB  STY $00
+    RecompiledBegin(ctx, 0xF7CB); bus.write(0x0000, cpu.Y); cpu.totalCycles += 3;
+    // F7CD  RTS
+    { RecompiledBegin(ctx, 0xF7CD); cpu.SP++; const byte low = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); const byte high = bus.read(static_cast<memAddress>(0x0100 + cpu.SP + 1)); cpu.SP++; cpu.totalCycles += 6; cpu.PC = static_cast<memAddress>(RecompiledWord(low, high) + 1); return; }
+}
+
+static void Block_F7CE(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // F7CE  SEC
+    RecompiledBegin(ctx, 0xF7CE); SetFlag(cpu, Flags::C, true); cpu.totalCycles += 2;
+    // F7CF  CLV
+    RecompiledBegin(ctx, 0xF7CF); SetFlag(cpu, Flags::V, false); cpu.totalCycles += 2;
+    // F7D0  LDA #$00
+    RecompiledBegin(ctx, 0xF7D0); cpu.A = 0x00; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // F7D2  RTS
+    { RecompiledBegin(ctx, 0xF7D2); cpu.SP++; const byte low = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); const byte high = bus.read(static_cast<memAddress>(0x0100 + cpu.SP + 1)); cpu.SP++; cpu.totalCycles += 6; cpu.PC = static_cast<memAddress>(RecompiledWord(low, high) + 1); return; }
+}
+
+static void Block_F7D3(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // F7D3  BNE $F7DC
+    RecompiledBegin(ctx, 0xF7D3); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xF7DC; return; }
+    // F7D5  BVS $F7DC
+    RecompiledBegin(ctx, 0xF7D5); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xF7DC; return; }
+    // F7D7  BCC $F7DC
+    RecompiledBegin(ctx, 0xF7D7); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xF7DC; return; }
+    // F7D9  BMI $F7DC
+    RecompiledBegin(ctx, 0xF7D9); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xF7DC; return; }
+    // F7DB  RTS
+    { RecompiledBegin(ctx, 0xF7DB); cpu.SP++; const byte low = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); const byte high = bus.read(static_cast<memAddress>(0x0100 + cpu.SP + 1)); cpu.SP++; cpu.totalCycles += 6; cpu.PC = static_cast<memAddress>(RecompiledWord(low, high) + 1); return; }
+}
+
+static void Block_F7DC(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // F7DC  STY $00
+    RecompiledBegin(ctx, 0xF7DC); bus.write(0x0000, cpu.Y); cpu.totalCycles += 3;
+    // F7DE  RTS
+    { RecompiledBegin(ctx, 0xF7DE); cpu.SP++; const byte low = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); const byte high = bus.read(static_cast<memAddress>(0x0100 + cpu.SP + 1)); cpu.SP++; cpu.totalCycles += 6; cpu.PC = static_cast<memAddress>(RecompiledWord(low, high) + 1); return; }
+}
+
+static void Block_F7DF(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // F7DF  CLC
+    RecompiledBegin(ctx, 0xF7DF); SetFlag(cpu, Flags::C, false); cpu.totalCycles += 2;
+    // F7E0  BIT $01
+    RecompiledBegin(ctx, 0xF7E0); BitTest(cpu, bus.read(0x0001)); cpu.totalCycles += 3;
+    // F7E2  LDA #$55
+    RecompiledBegin(ctx, 0xF7E2); cpu.A = 0x55; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // F7E4  RTS
+    { RecompiledBegin(ctx, 0xF7E4); cpu.SP++; const byte low = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); const byte high = bus.read(static_cast<memAddress>(0x0100 + cpu.SP + 1)); cpu.SP++; cpu.totalCycles += 6; cpu.PC = static_cast<memAddress>(RecompiledWord(low, high) + 1); return; }
+}
+
+static void Block_F7E5(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // F7E5  BNE $F7EE
+    RecompiledBegin(ctx, 0xF7E5); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xF7EE; return; }
+    // F7E7  BVC $F7EE
+    RecompiledBegin(ctx, 0xF7E7); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xF7EE; return; }
+    // F7E9  BCS $F7EE
+    RecompiledBegin(ctx, 0xF7E9); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xF7EE; return; }
+    // F7EB  BMI $F7EE
+    RecompiledBegin(ctx, 0xF7EB); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xF7EE; return; }
+    // F7ED  RTS
+    { RecompiledBegin(ctx, 0xF7ED); cpu.SP++; const byte low = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); const byte high = bus.read(static_cast<memAddress>(0x0100 + cpu.SP + 1)); cpu.SP++; cpu.totalCycles += 6; cpu.PC = static_cast<memAddress>(RecompiledWord(low, high) + 1); return; }
+}
+
+static void Block_F7EE(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // F7EE  STY $00
+    RecompiledBegin(ctx, 0xF7EE); bus.write(0x0000, cpu.Y); cpu.totalCycles += 3;
+    // F7F0  RTS
+    { RecompiledBegin(ctx, 0xF7F0); cpu.SP++; const byte low = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); const byte high = bus.read(static_cast<memAddress>(0x0100 + cpu.SP + 1)); cpu.SP++; cpu.totalCycles += 6; cpu.PC = static_cast<memAddress>(RecompiledWord(low, high) + 1); return; }
+}
+
+static void Block_F7F1(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // F7F1  SEC
+    RecompiledBegin(ctx, 0xF7F1); SetFlag(cpu, Flags::C, true); cpu.totalCycles += 2;
+    // F7F2  CLV
+    RecompiledBegin(ctx, 0xF7F2); SetFlag(cpu, Flags::V, false); cpu.totalCycles += 2;
+    // F7F3  LDA #$F8
+    RecompiledBegin(ctx, 0xF7F3); cpu.A = 0xF8; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // F7F5  RTS
+    { RecompiledBegin(ctx, 0xF7F5); cpu.SP++; const byte low = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); const byte high = bus.read(static_cast<memAddress>(0x0100 + cpu.SP + 1)); cpu.SP++; cpu.totalCycles += 6; cpu.PC = static_cast<memAddress>(RecompiledWord(low, high) + 1); return; }
+}
+
+static void Block_F7F6(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // F7F6  BCC $F801
+    RecompiledBegin(ctx, 0xF7F6); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::C)) { cpu.totalCycles += 2; cpu.PC = 0xF801; return; }
+    // F7F8  BPL $F801
+    RecompiledBegin(ctx, 0xF7F8); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::N)) { cpu.totalCycles += 2; cpu.PC = 0xF801; return; }
+    // F7FA  CMP #$E8
+    RecompiledBegin(ctx, 0xF7FA); Compare(cpu, cpu.A, 0xE8); cpu.totalCycles += 2;
+    // F7FC  BNE $F801
+    RecompiledBegin(ctx, 0xF7FC); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 2; cpu.PC = 0xF801; return; }
+    // F7FE  BVS $F801
+    RecompiledBegin(ctx, 0xF7FE); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xF801; return; }
+    // F800  RTS
+    { RecompiledBegin(ctx, 0xF800); cpu.SP++; const byte low = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); const byte high = bus.read(static_cast<memAddress>(0x0100 + cpu.SP + 1)); cpu.SP++; cpu.totalCycles += 6; cpu.PC = static_cast<memAddress>(RecompiledWord(low, high) + 1); return; }
+}
+
+static void Block_F801(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // F801  STY $00
+    RecompiledBegin(ctx, 0xF801); bus.write(0x0000, cpu.Y); cpu.totalCycles += 3;
+    // F803  RTS
+    { RecompiledBegin(ctx, 0xF803); cpu.SP++; const byte low = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); const byte high = bus.read(static_cast<memAddress>(0x0100 + cpu.SP + 1)); cpu.SP++; cpu.totalCycles += 6; cpu.PC = static_cast<memAddress>(RecompiledWord(low, high) + 1); return; }
+}
+
+static void Block_F804(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // F804  CLC
+    RecompiledBegin(ctx, 0xF804); SetFlag(cpu, Flags::C, false); cpu.totalCycles += 2;
+    // F805  BIT $01
+    RecompiledBegin(ctx, 0xF805); BitTest(cpu, bus.read(0x0001)); cpu.totalCycles += 3;
+    // F807  LDA #$5F
+    RecompiledBegin(ctx, 0xF807); cpu.A = 0x5F; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // F809  RTS
+    { RecompiledBegin(ctx, 0xF809); cpu.SP++; const byte low = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); const byte high = bus.read(static_cast<memAddress>(0x0100 + cpu.SP + 1)); cpu.SP++; cpu.totalCycles += 6; cpu.PC = static_cast<memAddress>(RecompiledWord(low, high) + 1); return; }
+}
+
+static void Block_F80A(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // F80A  BCS $F815
+    RecompiledBegin(ctx, 0xF80A); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xF815; return; }
+    // F80C  BPL $F815
+    RecompiledBegin(ctx, 0xF80C); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xF815; return; }
+    // F80E  CMP #$F5
+    RecompiledBegin(ctx, 0xF80E); Compare(cpu, cpu.A, 0xF5); cpu.totalCycles += 2;
+    // F810  BNE $F815
+    RecompiledBegin(ctx, 0xF810); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xF815; return; }
+    // F812  BVC $F815
+    RecompiledBegin(ctx, 0xF812); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xF815; return; }
+    // F814  RTS
+    { RecompiledBegin(ctx, 0xF814); cpu.SP++; const byte low = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); const byte high = bus.read(static_cast<memAddress>(0x0100 + cpu.SP + 1)); cpu.SP++; cpu.totalCycles += 6; cpu.PC = static_cast<memAddress>(RecompiledWord(low, high) + 1); return; }
+}
+
+static void Block_F815(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // F815  STY $00
+    RecompiledBegin(ctx, 0xF815); bus.write(0x0000, cpu.Y); cpu.totalCycles += 3;
+    // F817  RTS
+    { RecompiledBegin(ctx, 0xF817); cpu.SP++; const byte low = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); const byte high = bus.read(static_cast<memAddress>(0x0100 + cpu.SP + 1)); cpu.SP++; cpu.totalCycles += 6; cpu.PC = static_cast<memAddress>(RecompiledWord(low, high) + 1); return; }
+}
+
+static void Block_F818(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // F818  SEC
+    RecompiledBegin(ctx, 0xF818); SetFlag(cpu, Flags::C, true); cpu.totalCycles += 2;
+    // F819  CLV
+    RecompiledBegin(ctx, 0xF819); SetFlag(cpu, Flags::V, false); cpu.totalCycles += 2;
+    // F81A  LDA #$70
+    RecompiledBegin(ctx, 0xF81A); cpu.A = 0x70; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // F81C  RTS
+    { RecompiledBegin(ctx, 0xF81C); cpu.SP++; const byte low = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); const byte high = bus.read(static_cast<memAddress>(0x0100 + cpu.SP + 1)); cpu.SP++; cpu.totalCycles += 6; cpu.PC = static_cast<memAddress>(RecompiledWord(low, high) + 1); return; }
+}
+
+static void Block_F81D(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // F81D  BNE $F826
+    RecompiledBegin(ctx, 0xF81D); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xF826; return; }
+    // F81F  BVS $F826
+    RecompiledBegin(ctx, 0xF81F); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xF826; return; }
+    // F821  BCC $F826
+    RecompiledBegin(ctx, 0xF821); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xF826; return; }
+    // F823  BMI $F826
+    RecompiledBegin(ctx, 0xF823); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xF826; return; }
+    // F825  RTS
+    { RecompiledBegin(ctx, 0xF825); cpu.SP++; const byte low = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); const byte high = bus.read(static_cast<memAddress>(0x0100 + cpu.SP + 1)); cpu.SP++; cpu.totalCycles += 6; cpu.PC = static_cast<memAddress>(RecompiledWord(low, high) + 1); return; }
+}
+
+static void Block_F826(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // F826  STY $00
+    RecompiledBegin(ctx, 0xF826); bus.write(0x0000, cpu.Y); cpu.totalCycles += 3;
+    // F828  RTS
+    { RecompiledBegin(ctx, 0xF828); cpu.SP++; const byte low = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); const byte high = bus.read(static_cast<memAddress>(0x0100 + cpu.SP + 1)); cpu.SP++; cpu.totalCycles += 6; cpu.PC = static_cast<memAddress>(RecompiledWord(low, high) + 1); return; }
+}
+
+static void Block_F829(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // F829  CLC
+    RecompiledBegin(ctx, 0xF829); SetFlag(cpu, Flags::C, false); cpu.totalCycles += 2;
+    // F82A  BIT $01
+    RecompiledBegin(ctx, 0xF82A); BitTest(cpu, bus.read(0x0001)); cpu.totalCycles += 3;
+    // F82C  LDA #$00
+    RecompiledBegin(ctx, 0xF82C); cpu.A = 0x00; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // F82E  RTS
+    { RecompiledBegin(ctx, 0xF82E); cpu.SP++; const byte low = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); const byte high = bus.read(static_cast<memAddress>(0x0100 + cpu.SP + 1)); cpu.SP++; cpu.totalCycles += 6; cpu.PC = static_cast<memAddress>(RecompiledWord(low, high) + 1); return; }
+}
+
+static void Block_F82F(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // F82F  BMI $F83A
+    RecompiledBegin(ctx, 0xF82F); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xF83A; return; }
+    // F831  BCS $F83A
+    RecompiledBegin(ctx, 0xF831); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xF83A; return; }
+    // F833  CMP #$69
+    RecompiledBegin(ctx, 0xF833); Compare(cpu, cpu.A, 0x69); cpu.totalCycles += 2;
+    // F835  BNE $F83A
+    RecompiledBegin(ctx, 0xF835); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xF83A; return; }
+    // F837  BVS $F83A
+    RecompiledBegin(ctx, 0xF837); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xF83A; return; }
+    // F839  RTS
+    { RecompiledBegin(ctx, 0xF839); cpu.SP++; const byte low = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); const byte high = bus.read(static_cast<memAddress>(0x0100 + cpu.SP + 1)); cpu.SP++; cpu.totalCycles += 6; cpu.PC = static_cast<memAddress>(RecompiledWord(low, high) + 1); return; }
+}
+
+static void Block_F83A(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // F83A  STY $00
+    RecompiledBegin(ctx, 0xF83A); bus.write(0x0000, cpu.Y); cpu.totalCycles += 3;
+    // F83C  RTS
+    { RecompiledBegin(ctx, 0xF83C); cpu.SP++; const byte low = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); const byte high = bus.read(static_cast<memAddress>(0x0100 + cpu.SP + 1)); cpu.SP++; cpu.totalCycles += 6; cpu.PC = static_cast<memAddress>(RecompiledWord(low, high) + 1); return; }
+}
+
+static void Block_F83D(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // F83D  SEC
+    RecompiledBegin(ctx, 0xF83D); SetFlag(cpu, Flags::C, true); cpu.totalCycles += 2;
+    // F83E  BIT $01
+    RecompiledBegin(ctx, 0xF83E); BitTest(cpu, bus.read(0x0001)); cpu.totalCycles += 3;
+    // F840  LDA #$00
+    RecompiledBegin(ctx, 0xF840); cpu.A = 0x00; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // F842  RTS
+    { RecompiledBegin(ctx, 0xF842); cpu.SP++; const byte low = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); const byte high = bus.read(static_cast<memAddress>(0x0100 + cpu.SP + 1)); cpu.SP++; cpu.totalCycles += 6; cpu.PC = static_cast<memAddress>(RecompiledWord(low, high) + 1); return; }
+}
+
+static void Block_F843(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // F843  BMI $F84E
+    RecompiledBegin(ctx, 0xF843); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xF84E; return; }
+    // F845  BCS $F84E
+    RecompiledBegin(ctx, 0xF845); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xF84E; return; }
+    // F847  CMP #$6A
+    RecompiledBegin(ctx, 0xF847); Compare(cpu, cpu.A, 0x6A); cpu.totalCycles += 2;
+    // F849  BNE $F84E
+    RecompiledBegin(ctx, 0xF849); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xF84E; return; }
+    // F84B  BVS $F84E
+    RecompiledBegin(ctx, 0xF84B); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xF84E; return; }
+    // F84D  RTS
+    { RecompiledBegin(ctx, 0xF84D); cpu.SP++; const byte low = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); const byte high = bus.read(static_cast<memAddress>(0x0100 + cpu.SP + 1)); cpu.SP++; cpu.totalCycles += 6; cpu.PC = static_cast<memAddress>(RecompiledWord(low, high) + 1); return; }
+}
+
+static void Block_F84E(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // F84E  STY $00
+    RecompiledBegin(ctx, 0xF84E); bus.write(0x0000, cpu.Y); cpu.totalCycles += 3;
+    // F850  RTS
+    { RecompiledBegin(ctx, 0xF850); cpu.SP++; const byte low = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); const byte high = bus.read(static_cast<memAddress>(0x0100 + cpu.SP + 1)); cpu.SP++; cpu.totalCycles += 6; cpu.PC = static_cast<memAddress>(RecompiledWord(low, high) + 1); return; }
+}
+
+static void Block_F851(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // F851  SEC
+    RecompiledBegin(ctx, 0xF851); SetFlag(cpu, Flags::C, true); cpu.totalCycles += 2;
+    // F852  CLV
+    RecompiledBegin(ctx, 0xF852); SetFlag(cpu, Flags::V, false); cpu.totalCycles += 2;
+    // F853  LDA #$7F
+    RecompiledBegin(ctx, 0xF853); cpu.A = 0x7F; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // F855  RTS
+    { RecompiledBegin(ctx, 0xF855); cpu.SP++; const byte low = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); const byte high = bus.read(static_cast<memAddress>(0x0100 + cpu.SP + 1)); cpu.SP++; cpu.totalCycles += 6; cpu.PC = static_cast<memAddress>(RecompiledWord(low, high) + 1); return; }
+}
+
+static void Block_F856(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // F856  BPL $F861
+    RecompiledBegin(ctx, 0xF856); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xF861; return; }
+    // F858  BCS $F861
+    RecompiledBegin(ctx, 0xF858); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xF861; return; }
+    // F85A  CMP #$FF
+    RecompiledBegin(ctx, 0xF85A); Compare(cpu, cpu.A, 0xFF); cpu.totalCycles += 2;
+    // F85C  BNE $F861
+    RecompiledBegin(ctx, 0xF85C); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xF861; return; }
+    // F85E  BVC $F861
+    RecompiledBegin(ctx, 0xF85E); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xF861; return; }
+    // F860  RTS
+    { RecompiledBegin(ctx, 0xF860); cpu.SP++; const byte low = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); const byte high = bus.read(static_cast<memAddress>(0x0100 + cpu.SP + 1)); cpu.SP++; cpu.totalCycles += 6; cpu.PC = static_cast<memAddress>(RecompiledWord(low, high) + 1); return; }
+}
+
+static void Block_F861(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // F861  STY $00
+    RecompiledBegin(ctx, 0xF861); bus.write(0x0000, cpu.Y); cpu.totalCycles += 3;
+    // F863  RTS
+    { RecompiledBegin(ctx, 0xF863); cpu.SP++; const byte low = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); const byte high = bus.read(static_cast<memAddress>(0x0100 + cpu.SP + 1)); cpu.SP++; cpu.totalCycles += 6; cpu.PC = static_cast<memAddress>(RecompiledWord(low, high) + 1); return; }
+}
+
+static void Block_F864(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // F864  CLC
+    RecompiledBegin(ctx, 0xF864); SetFlag(cpu, Flags::C, false); cpu.totalCycles += 2;
+    // F865  BIT $01
+    RecompiledBegin(ctx, 0xF865); BitTest(cpu, bus.read(0x0001)); cpu.totalCycles += 3;
+    // F867  LDA #$7F
+    RecompiledBegin(ctx, 0xF867); cpu.A = 0x7F; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // F869  RTS
+    { RecompiledBegin(ctx, 0xF869); cpu.SP++; const byte low = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); const byte high = bus.read(static_cast<memAddress>(0x0100 + cpu.SP + 1)); cpu.SP++; cpu.totalCycles += 6; cpu.PC = static_cast<memAddress>(RecompiledWord(low, high) + 1); return; }
+}
+
+static void Block_F86A(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // F86A  BPL $F875
+    RecompiledBegin(ctx, 0xF86A); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xF875; return; }
+    // F86C  BCS $F875
+    RecompiledBegin(ctx, 0xF86C); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xF875; return; }
+    // F86E  CMP #$FF
+    RecompiledBegin(ctx, 0xF86E); Compare(cpu, cpu.A, 0xFF); cpu.totalCycles += 2;
+    // F870  BNE $F875
+    RecompiledBegin(ctx, 0xF870); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xF875; return; }
+    // F872  BVS $F875
+    RecompiledBegin(ctx, 0xF872); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xF875; return; }
+    // F874  RTS
+    { RecompiledBegin(ctx, 0xF874); cpu.SP++; const byte low = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); const byte high = bus.read(static_cast<memAddress>(0x0100 + cpu.SP + 1)); cpu.SP++; cpu.totalCycles += 6; cpu.PC = static_cast<memAddress>(RecompiledWord(low, high) + 1); return; }
+}
+
+static void Block_F875(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // F875  STY $00
+    RecompiledBegin(ctx, 0xF875); bus.write(0x0000, cpu.Y); cpu.totalCycles += 3;
+    // F877  RTS
+    { RecompiledBegin(ctx, 0xF877); cpu.SP++; const byte low = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); const byte high = bus.read(static_cast<memAddress>(0x0100 + cpu.SP + 1)); cpu.SP++; cpu.totalCycles += 6; cpu.PC = static_cast<memAddress>(RecompiledWord(low, high) + 1); return; }
+}
+
+static void Block_F878(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // F878  SEC
+    RecompiledBegin(ctx, 0xF878); SetFlag(cpu, Flags::C, true); cpu.totalCycles += 2;
+    // F879  CLV
+    RecompiledBegin(ctx, 0xF879); SetFlag(cpu, Flags::V, false); cpu.totalCycles += 2;
+    // F87A  LDA #$7F
+    RecompiledBegin(ctx, 0xF87A); cpu.A = 0x7F; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // F87C  RTS
+    { RecompiledBegin(ctx, 0xF87C); cpu.SP++; const byte low = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); const byte high = bus.read(static_cast<memAddress>(0x0100 + cpu.SP + 1)); cpu.SP++; cpu.totalCycles += 6; cpu.PC = static_cast<memAddress>(RecompiledWord(low, high) + 1); return; }
+}
+
+static void Block_F87D(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // F87D  BNE $F886
+    RecompiledBegin(ctx, 0xF87D); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xF886; return; }
+    // F87F  BMI $F886
+    RecompiledBegin(ctx, 0xF87F); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xF886; return; }
+    // F881  BVS $F886
+    RecompiledBegin(ctx, 0xF881); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xF886; return; }
+    // F883  BCC $F886
+    RecompiledBegin(ctx, 0xF883); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xF886; return; }
+    // F885  RTS
+    { RecompiledBegin(ctx, 0xF885); cpu.SP++; const byte low = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); const byte high = bus.read(static_cast<memAddress>(0x0100 + cpu.SP + 1)); cpu.SP++; cpu.totalCycles += 6; cpu.PC = static_cast<memAddress>(RecompiledWord(low, high) + 1); return; }
+}
+
+static void Block_F886(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // F886  STY $00
+    RecompiledBegin(ctx, 0xF886); bus.write(0x0000, cpu.Y); cpu.totalCycles += 3;
+    // F888  RTS
+    { RecompiledBegin(ctx, 0xF888); cpu.SP++; const byte low = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); const byte high = bus.read(static_cast<memAddress>(0x0100 + cpu.SP + 1)); cpu.SP++; cpu.totalCycles += 6; cpu.PC = static_cast<memAddress>(RecompiledWord(low, high) + 1); return; }
+}
+
+static void Block_F889(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // F889  BIT $01
+    RecompiledBegin(ctx, 0xF889); BitTest(cpu, bus.read(0x0001)); cpu.totalCycles += 3;
+    // F88B  LDA #$40
+    RecompiledBegin(ctx, 0xF88B); cpu.A = 0x40; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // F88D  RTS
+    { RecompiledBegin(ctx, 0xF88D); cpu.SP++; const byte low = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); const byte high = bus.read(static_cast<memAddress>(0x0100 + cpu.SP + 1)); cpu.SP++; cpu.totalCycles += 6; cpu.PC = static_cast<memAddress>(RecompiledWord(low, high) + 1); return; }
+}
+
+static void Block_F88E(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // F88E  BMI $F897
+    RecompiledBegin(ctx, 0xF88E); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xF897; return; }
+    // F890  BCC $F897
+    RecompiledBegin(ctx, 0xF890); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xF897; return; }
+    // F892  BNE $F897
+    RecompiledBegin(ctx, 0xF892); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xF897; return; }
+    // F894  BVC $F897
+    RecompiledBegin(ctx, 0xF894); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xF897; return; }
+    // F896  RTS
+    { RecompiledBegin(ctx, 0xF896); cpu.SP++; const byte low = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); const byte high = bus.read(static_cast<memAddress>(0x0100 + cpu.SP + 1)); cpu.SP++; cpu.totalCycles += 6; cpu.PC = static_cast<memAddress>(RecompiledWord(low, high) + 1); return; }
+}
+
+static void Block_F897(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // F897  STY $00
+    RecompiledBegin(ctx, 0xF897); bus.write(0x0000, cpu.Y); cpu.totalCycles += 3;
+    // F899  RTS
+    { RecompiledBegin(ctx, 0xF899); cpu.SP++; const byte low = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); const byte high = bus.read(static_cast<memAddress>(0x0100 + cpu.SP + 1)); cpu.SP++; cpu.totalCycles += 6; cpu.PC = static_cast<memAddress>(RecompiledWord(low, high) + 1); return; }
+}
+
+static void Block_F89A(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // F89A  CLV
+    RecompiledBegin(ctx, 0xF89A); SetFlag(cpu, Flags::V, false); cpu.totalCycles += 2;
+    // F89B  RTS
+    { RecompiledBegin(ctx, 0xF89B); cpu.SP++; const byte low = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); const byte high = bus.read(static_cast<memAddress>(0x0100 + cpu.SP + 1)); cpu.SP++; cpu.totalCycles += 6; cpu.PC = static_cast<memAddress>(RecompiledWord(low, high) + 1); return; }
+}
+
+static void Block_F89C(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // F89C  BEQ $F8A5
+    RecompiledBegin(ctx, 0xF89C); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xF8A5; return; }
+    // F89E  BMI $F8A5
+    RecompiledBegin(ctx, 0xF89E); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xF8A5; return; }
+    // F8A0  BCC $F8A5
+    RecompiledBegin(ctx, 0xF8A0); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xF8A5; return; }
+    // F8A2  BVS $F8A5
+    RecompiledBegin(ctx, 0xF8A2); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xF8A5; return; }
+    // F8A4  RTS
+    { RecompiledBegin(ctx, 0xF8A4); cpu.SP++; const byte low = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); const byte high = bus.read(static_cast<memAddress>(0x0100 + cpu.SP + 1)); cpu.SP++; cpu.totalCycles += 6; cpu.PC = static_cast<memAddress>(RecompiledWord(low, high) + 1); return; }
+}
+
+static void Block_F8A5(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // F8A5  STY $00
+    RecompiledBegin(ctx, 0xF8A5); bus.write(0x0000, cpu.Y); cpu.totalCycles += 3;
+    // F8A7  RTS
+    { RecompiledBegin(ctx, 0xF8A7); cpu.SP++; const byte low = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); const byte high = bus.read(static_cast<memAddress>(0x0100 + cpu.SP + 1)); cpu.SP++; cpu.totalCycles += 6; cpu.PC = static_cast<memAddress>(RecompiledWord(low, high) + 1); return; }
+}
+
+static void Block_F8A8(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // F8A8  BEQ $F8AF
+    RecompiledBegin(ctx, 0xF8A8); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xF8AF; return; }
+    // F8AA  BPL $F8AF
+    RecompiledBegin(ctx, 0xF8AA); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xF8AF; return; }
+    // F8AC  BPL $F8AF
+    RecompiledBegin(ctx, 0xF8AC); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xF8AF; return; }
+    // F8AE  RTS
+    { RecompiledBegin(ctx, 0xF8AE); cpu.SP++; const byte low = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); const byte high = bus.read(static_cast<memAddress>(0x0100 + cpu.SP + 1)); cpu.SP++; cpu.totalCycles += 6; cpu.PC = static_cast<memAddress>(RecompiledWord(low, high) + 1); return; }
+}
+
+static void Block_F8AF(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // F8AF  STY $00
+    RecompiledBegin(ctx, 0xF8AF); bus.write(0x0000, cpu.Y); cpu.totalCycles += 3;
+    // F8B1  RTS
+    { RecompiledBegin(ctx, 0xF8B1); cpu.SP++; const byte low = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); const byte high = bus.read(static_cast<memAddress>(0x0100 + cpu.SP + 1)); cpu.SP++; cpu.totalCycles += 6; cpu.PC = static_cast<memAddress>(RecompiledWord(low, high) + 1); return; }
+}
+
+static void Block_F8B2(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // F8B2  LDA #$80
+    RecompiledBegin(ctx, 0xF8B2); cpu.A = 0x80; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // F8B4  RTS
+    { RecompiledBegin(ctx, 0xF8B4); cpu.SP++; const byte low = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); const byte high = bus.read(static_cast<memAddress>(0x0100 + cpu.SP + 1)); cpu.SP++; cpu.totalCycles += 6; cpu.PC = static_cast<memAddress>(RecompiledWord(low, high) + 1); return; }
+}
+
+static void Block_F8B5(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // F8B5  BEQ $F8BC
+    RecompiledBegin(ctx, 0xF8B5); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xF8BC; return; }
+    // F8B7  BPL $F8BC
+    RecompiledBegin(ctx, 0xF8B7); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xF8BC; return; }
+    // F8B9  BCC $F8BC
+    RecompiledBegin(ctx, 0xF8B9); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xF8BC; return; }
+    // F8BB  RTS
+    { RecompiledBegin(ctx, 0xF8BB); cpu.SP++; const byte low = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); const byte high = bus.read(static_cast<memAddress>(0x0100 + cpu.SP + 1)); cpu.SP++; cpu.totalCycles += 6; cpu.PC = static_cast<memAddress>(RecompiledWord(low, high) + 1); return; }
+}
+
+static void Block_F8BC(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // F8BC  STY $00
+    RecompiledBegin(ctx, 0xF8BC); bus.write(0x0000, cpu.Y); cpu.totalCycles += 3;
+    // F8BE  RTS
+    { RecompiledBegin(ctx, 0xF8BE); cpu.SP++; const byte low = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); const byte high = bus.read(static_cast<memAddress>(0x0100 + cpu.SP + 1)); cpu.SP++; cpu.totalCycles += 6; cpu.PC = static_cast<memAddress>(RecompiledWord(low, high) + 1); return; }
+}
+
+static void Block_F8BF(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // F8BF  BNE $F8C6
+    RecompiledBegin(ctx, 0xF8BF); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xF8C6; return; }
+    // F8C1  BMI $F8C6
+    RecompiledBegin(ctx, 0xF8C1); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xF8C6; return; }
+    // F8C3  BCC $F8C6
+    RecompiledBegin(ctx, 0xF8C3); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xF8C6; return; }
+    // F8C5  RTS
+    { RecompiledBegin(ctx, 0xF8C5); cpu.SP++; const byte low = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); const byte high = bus.read(static_cast<memAddress>(0x0100 + cpu.SP + 1)); cpu.SP++; cpu.totalCycles += 6; cpu.PC = static_cast<memAddress>(RecompiledWord(low, high) + 1); return; }
+}
+
+static void Block_F8C6(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // F8C6  STY $00
+    RecompiledBegin(ctx, 0xF8C6); bus.write(0x0000, cpu.Y); cpu.totalCycles += 3;
+    // F8C8  RTS
+    { RecompiledBegin(ctx, 0xF8C8); cpu.SP++; const byte low = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); const byte high = bus.read(static_cast<memAddress>(0x0100 + cpu.SP + 1)); cpu.SP++; cpu.totalCycles += 6; cpu.PC = static_cast<memAddress>(RecompiledWord(low, high) + 1); return; }
+}
+
+static void Block_F8C9(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // F8C9  BCS $F8D0
+    RecompiledBegin(ctx, 0xF8C9); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xF8D0; return; }
+    // F8CB  BEQ $F8D0
+    RecompiledBegin(ctx, 0xF8CB); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xF8D0; return; }
+    // F8CD  BPL $F8D0
+    RecompiledBegin(ctx, 0xF8CD); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xF8D0; return; }
+    // F8CF  RTS
+    { RecompiledBegin(ctx, 0xF8CF); cpu.SP++; const byte low = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); const byte high = bus.read(static_cast<memAddress>(0x0100 + cpu.SP + 1)); cpu.SP++; cpu.totalCycles += 6; cpu.PC = static_cast<memAddress>(RecompiledWord(low, high) + 1); return; }
+}
+
+static void Block_F8D0(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // F8D0  STY $00
+    RecompiledBegin(ctx, 0xF8D0); bus.write(0x0000, cpu.Y); cpu.totalCycles += 3;
+    // F8D2  RTS
+    { RecompiledBegin(ctx, 0xF8D2); cpu.SP++; const byte low = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); const byte high = bus.read(static_cast<memAddress>(0x0100 + cpu.SP + 1)); cpu.SP++; cpu.totalCycles += 6; cpu.PC = static_cast<memAddress>(RecompiledWord(low, high) + 1); return; }
+}
+
+static void Block_F8D3(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // F8D3  BCC $F8DA
+    RecompiledBegin(ctx, 0xF8D3); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xF8DA; return; }
+    // F8D5  BEQ $F8DA
+    RecompiledBegin(ctx, 0xF8D5); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xF8DA; return; }
+    // F8D7  BMI $F8DA
+    RecompiledBegin(ctx, 0xF8D7); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xF8DA; return; }
+    // F8D9  RTS
+    { RecompiledBegin(ctx, 0xF8D9); cpu.SP++; const byte low = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); const byte high = bus.read(static_cast<memAddress>(0x0100 + cpu.SP + 1)); cpu.SP++; cpu.totalCycles += 6; cpu.PC = static_cast<memAddress>(RecompiledWord(low, high) + 1); return; }
+}
+
+static void Block_F8DA(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // F8DA  STY $00
+    RecompiledBegin(ctx, 0xF8DA); bus.write(0x0000, cpu.Y); cpu.totalCycles += 3;
+    // F8DC  RTS
+    { RecompiledBegin(ctx, 0xF8DC); cpu.SP++; const byte low = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); const byte high = bus.read(static_cast<memAddress>(0x0100 + cpu.SP + 1)); cpu.SP++; cpu.totalCycles += 6; cpu.PC = static_cast<memAddress>(RecompiledWord(low, high) + 1); return; }
+}
+
+static void Block_F8DD(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // F8DD  BIT $01
+    RecompiledBegin(ctx, 0xF8DD); BitTest(cpu, bus.read(0x0001)); cpu.totalCycles += 3;
+    // F8DF  LDY #$40
+    RecompiledBegin(ctx, 0xF8DF); cpu.Y = 0x40; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // F8E1  RTS
+    { RecompiledBegin(ctx, 0xF8E1); cpu.SP++; const byte low = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); const byte high = bus.read(static_cast<memAddress>(0x0100 + cpu.SP + 1)); cpu.SP++; cpu.totalCycles += 6; cpu.PC = static_cast<memAddress>(RecompiledWord(low, high) + 1); return; }
+}
+
+static void Block_F8E2(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // F8E2  BMI $F8EB
+    RecompiledBegin(ctx, 0xF8E2); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xF8EB; return; }
+    // F8E4  BCC $F8EB
+    RecompiledBegin(ctx, 0xF8E4); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xF8EB; return; }
+    // F8E6  BNE $F8EB
+    RecompiledBegin(ctx, 0xF8E6); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xF8EB; return; }
+    // F8E8  BVC $F8EB
+    RecompiledBegin(ctx, 0xF8E8); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xF8EB; return; }
+    // F8EA  RTS
+    { RecompiledBegin(ctx, 0xF8EA); cpu.SP++; const byte low = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); const byte high = bus.read(static_cast<memAddress>(0x0100 + cpu.SP + 1)); cpu.SP++; cpu.totalCycles += 6; cpu.PC = static_cast<memAddress>(RecompiledWord(low, high) + 1); return; }
+}
+
+static void Block_F8EB(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // F8EB  STX $00
+    RecompiledBegin(ctx, 0xF8EB); bus.write(0x0000, cpu.X); cpu.totalCycles += 3;
+    // F8ED  RTS
+    { RecompiledBegin(ctx, 0xF8ED); cpu.SP++; const byte low = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); const byte high = bus.read(static_cast<memAddress>(0x0100 + cpu.SP + 1)); cpu.SP++; cpu.totalCycles += 6; cpu.PC = static_cast<memAddress>(RecompiledWord(low, high) + 1); return; }
+}
+
+static void Block_F8EE(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // F8EE  CLV
+    RecompiledBegin(ctx, 0xF8EE); SetFlag(cpu, Flags::V, false); cpu.totalCycles += 2;
+    // F8EF  RTS
+    { RecompiledBegin(ctx, 0xF8EF); cpu.SP++; const byte low = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); const byte high = bus.read(static_cast<memAddress>(0x0100 + cpu.SP + 1)); cpu.SP++; cpu.totalCycles += 6; cpu.PC = static_cast<memAddress>(RecompiledWord(low, high) + 1); return; }
+}
+
+static void Block_F8F0(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // F8F0  BEQ $F8F9
+    RecompiledBegin(ctx, 0xF8F0); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xF8F9; return; }
+    // F8F2  BMI $F8F9
+    RecompiledBegin(ctx, 0xF8F2); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xF8F9; return; }
+    // F8F4  BCC $F8F9
+    RecompiledBegin(ctx, 0xF8F4); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xF8F9; return; }
+    // F8F6  BVS $F8F9
+    RecompiledBegin(ctx, 0xF8F6); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xF8F9; return; }
+    // F8F8  RTS
+    { RecompiledBegin(ctx, 0xF8F8); cpu.SP++; const byte low = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); const byte high = bus.read(static_cast<memAddress>(0x0100 + cpu.SP + 1)); cpu.SP++; cpu.totalCycles += 6; cpu.PC = static_cast<memAddress>(RecompiledWord(low, high) + 1); return; }
+}
+
+static void Block_F8F9(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // F8F9  STX $00
+    RecompiledBegin(ctx, 0xF8F9); bus.write(0x0000, cpu.X); cpu.totalCycles += 3;
+    // F8FB  RTS
+    { RecompiledBegin(ctx, 0xF8FB); cpu.SP++; const byte low = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); const byte high = bus.read(static_cast<memAddress>(0x0100 + cpu.SP + 1)); cpu.SP++; cpu.totalCycles += 6; cpu.PC = static_cast<memAddress>(RecompiledWord(low, high) + 1); return; }
+}
+
+static void Block_F8FC(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // F8FC  BEQ $F903
+    RecompiledBegin(ctx, 0xF8FC); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 2; cpu.PC = 0xF903; return; }
+    // F8FE  BPL $F903
+    RecompiledBegin(ctx, 0xF8FE); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xF903; return; }
+    // F900  BPL $F903
+    RecompiledBegin(ctx, 0xF900); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xF903; return; }
+    // F902  RTS
+    { RecompiledBegin(ctx, 0xF902); cpu.SP++; const byte low = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); const byte high = bus.read(static_cast<memAddress>(0x0100 + cpu.SP + 1)); cpu.SP++; cpu.totalCycles += 6; cpu.PC = static_cast<memAddress>(RecompiledWord(low, high) + 1); return; }
+}
+
+static void Block_F903(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // F903  STX $00
+    RecompiledBegin(ctx, 0xF903); bus.write(0x0000, cpu.X); cpu.totalCycles += 3;
+    // F905  RTS
+    { RecompiledBegin(ctx, 0xF905); cpu.SP++; const byte low = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); const byte high = bus.read(static_cast<memAddress>(0x0100 + cpu.SP + 1)); cpu.SP++; cpu.totalCycles += 6; cpu.PC = static_cast<memAddress>(RecompiledWord(low, high) + 1); return; }
+}
+
+static void Block_F906(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // F906  LDY #$80
+    RecompiledBegin(ctx, 0xF906); cpu.Y = 0x80; SetNZ(cpu, cpu.Y); cpu.totalCycles += 2;
+    // F908  RTS
+    { RecompiledBegin(ctx, 0xF908); cpu.SP++; const byte low = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); const byte high = bus.read(static_cast<memAddress>(0x0100 + cpu.SP + 1)); cpu.SP++; cpu.totalCycles += 6; cpu.PC = static_cast<memAddress>(RecompiledWord(low, high) + 1); return; }
+}
+
+static void Block_F909(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // F909  BEQ $F910
+    RecompiledBegin(ctx, 0xF909); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xF910; return; }
+    // F90B  BPL $F910
+    RecompiledBegin(ctx, 0xF90B); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xF910; return; }
+    // F90D  BCC $F910
+    RecompiledBegin(ctx, 0xF90D); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xF910; return; }
+    // F90F  RTS
+    { RecompiledBegin(ctx, 0xF90F); cpu.SP++; const byte low = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); const byte high = bus.read(static_cast<memAddress>(0x0100 + cpu.SP + 1)); cpu.SP++; cpu.totalCycles += 6; cpu.PC = static_cast<memAddress>(RecompiledWord(low, high) + 1); return; }
+}
+
+static void Block_F910(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // F910  STX $00
+    RecompiledBegin(ctx, 0xF910); bus.write(0x0000, cpu.X); cpu.totalCycles += 3;
+    // F912  RTS
+    { RecompiledBegin(ctx, 0xF912); cpu.SP++; const byte low = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); const byte high = bus.read(static_cast<memAddress>(0x0100 + cpu.SP + 1)); cpu.SP++; cpu.totalCycles += 6; cpu.PC = static_cast<memAddress>(RecompiledWord(low, high) + 1); return; }
+}
+
+static void Block_F913(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // F913  BNE $F91A
+    RecompiledBegin(ctx, 0xF913); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xF91A; return; }
+    // F915  BMI $F91A
+    RecompiledBegin(ctx, 0xF915); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xF91A; return; }
+    // F917  BCC $F91A
+    RecompiledBegin(ctx, 0xF917); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xF91A; return; }
+    // F919  RTS
+    { RecompiledBegin(ctx, 0xF919); cpu.SP++; const byte low = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); const byte high = bus.read(static_cast<memAddress>(0x0100 + cpu.SP + 1)); cpu.SP++; cpu.totalCycles += 6; cpu.PC = static_cast<memAddress>(RecompiledWord(low, high) + 1); return; }
+}
+
+static void Block_F91A(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // F91A  STX $00
+    RecompiledBegin(ctx, 0xF91A); bus.write(0x0000, cpu.X); cpu.totalCycles += 3;
+    // F91C  RTS
+    { RecompiledBegin(ctx, 0xF91C); cpu.SP++; const byte low = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); const byte high = bus.read(static_cast<memAddress>(0x0100 + cpu.SP + 1)); cpu.SP++; cpu.totalCycles += 6; cpu.PC = static_cast<memAddress>(RecompiledWord(low, high) + 1); return; }
+}
+
+static void Block_F91D(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // F91D  BCS $F924
+    RecompiledBegin(ctx, 0xF91D); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xF924; return; }
+    // F91F  BEQ $F924
+    RecompiledBegin(ctx, 0xF91F); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xF924; return; }
+    // F921  BPL $F924
+    RecompiledBegin(ctx, 0xF921); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xF924; return; }
+    // F923  RTS
+    { RecompiledBegin(ctx, 0xF923); cpu.SP++; const byte low = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); const byte high = bus.read(static_cast<memAddress>(0x0100 + cpu.SP + 1)); cpu.SP++; cpu.totalCycles += 6; cpu.PC = static_cast<memAddress>(RecompiledWord(low, high) + 1); return; }
+}
+
+static void Block_F924(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // F924  STX $00
+    RecompiledBegin(ctx, 0xF924); bus.write(0x0000, cpu.X); cpu.totalCycles += 3;
+    // F926  RTS
+    { RecompiledBegin(ctx, 0xF926); cpu.SP++; const byte low = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); const byte high = bus.read(static_cast<memAddress>(0x0100 + cpu.SP + 1)); cpu.SP++; cpu.totalCycles += 6; cpu.PC = static_cast<memAddress>(RecompiledWord(low, high) + 1); return; }
+}
+
+static void Block_F927(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // F927  BCC $F92E
+    RecompiledBegin(ctx, 0xF927); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xF92E; return; }
+    // F929  BEQ $F92E
+    RecompiledBegin(ctx, 0xF929); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xF92E; return; }
+    // F92B  BMI $F92E
+    RecompiledBegin(ctx, 0xF92B); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xF92E; return; }
+    // F92D  RTS
+    { RecompiledBegin(ctx, 0xF92D); cpu.SP++; const byte low = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); const byte high = bus.read(static_cast<memAddress>(0x0100 + cpu.SP + 1)); cpu.SP++; cpu.totalCycles += 6; cpu.PC = static_cast<memAddress>(RecompiledWord(low, high) + 1); return; }
+}
+
+static void Block_F92E(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // F92E  STX $00
+    RecompiledBegin(ctx, 0xF92E); bus.write(0x0000, cpu.X); cpu.totalCycles += 3;
+    // F930  RTS
+    { RecompiledBegin(ctx, 0xF930); cpu.SP++; const byte low = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); const byte high = bus.read(static_cast<memAddress>(0x0100 + cpu.SP + 1)); cpu.SP++; cpu.totalCycles += 6; cpu.PC = static_cast<memAddress>(RecompiledWord(low, high) + 1); return; }
+}
+
+static void Block_F931(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // F931  BIT $01
+    RecompiledBegin(ctx, 0xF931); BitTest(cpu, bus.read(0x0001)); cpu.totalCycles += 3;
+    // F933  LDA #$40
+    RecompiledBegin(ctx, 0xF933); cpu.A = 0x40; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // F935  SEC
+    RecompiledBegin(ctx, 0xF935); SetFlag(cpu, Flags::C, true); cpu.totalCycles += 2;
+    // F936  RTS
+    { RecompiledBegin(ctx, 0xF936); cpu.SP++; const byte low = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); const byte high = bus.read(static_cast<memAddress>(0x0100 + cpu.SP + 1)); cpu.SP++; cpu.totalCycles += 6; cpu.PC = static_cast<memAddress>(RecompiledWord(low, high) + 1); return; }
+}
+
+static void Block_F937(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // F937  BMI $F944
+    RecompiledBegin(ctx, 0xF937); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xF944; return; }
+    // F939  BCC $F944
+    RecompiledBegin(ctx, 0xF939); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xF944; return; }
+    // F93B  BNE $F944
+    RecompiledBegin(ctx, 0xF93B); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xF944; return; }
+    // F93D  BVS $F944
+    RecompiledBegin(ctx, 0xF93D); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xF944; return; }
+    // F93F  CMP #$00
+    RecompiledBegin(ctx, 0xF93F); Compare(cpu, cpu.A, 0x00); cpu.totalCycles += 2;
+    // F941  BNE $F944
+    RecompiledBegin(ctx, 0xF941); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xF944; return; }
+    // F943  RTS
+    { RecompiledBegin(ctx, 0xF943); cpu.SP++; const byte low = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); const byte high = bus.read(static_cast<memAddress>(0x0100 + cpu.SP + 1)); cpu.SP++; cpu.totalCycles += 6; cpu.PC = static_cast<memAddress>(RecompiledWord(low, high) + 1); return; }
+}
+
+static void Block_F944(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // F944  STY $00
+    RecompiledBegin(ctx, 0xF944); bus.write(0x0000, cpu.Y); cpu.totalCycles += 3;
+    // F946  RTS
+    { RecompiledBegin(ctx, 0xF946); cpu.SP++; const byte low = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); const byte high = bus.read(static_cast<memAddress>(0x0100 + cpu.SP + 1)); cpu.SP++; cpu.totalCycles += 6; cpu.PC = static_cast<memAddress>(RecompiledWord(low, high) + 1); return; }
+}
+
+static void Block_F947(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // F947  CLV
+    RecompiledBegin(ctx, 0xF947); SetFlag(cpu, Flags::V, false); cpu.totalCycles += 2;
+    // F948  SEC
+    RecompiledBegin(ctx, 0xF948); SetFlag(cpu, Flags::C, true); cpu.totalCycles += 2;
+    // F949  LDA #$40
+    RecompiledBegin(ctx, 0xF949); cpu.A = 0x40; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // F94B  RTS
+    { RecompiledBegin(ctx, 0xF94B); cpu.SP++; const byte low = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); const byte high = bus.read(static_cast<memAddress>(0x0100 + cpu.SP + 1)); cpu.SP++; cpu.totalCycles += 6; cpu.PC = static_cast<memAddress>(RecompiledWord(low, high) + 1); return; }
+}
+
+static void Block_F94C(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // F94C  BEQ $F959
+    RecompiledBegin(ctx, 0xF94C); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xF959; return; }
+    // F94E  BMI $F959
+    RecompiledBegin(ctx, 0xF94E); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xF959; return; }
+    // F950  BCC $F959
+    RecompiledBegin(ctx, 0xF950); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xF959; return; }
+    // F952  BVS $F959
+    RecompiledBegin(ctx, 0xF952); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xF959; return; }
+    // F954  CMP #$01
+    RecompiledBegin(ctx, 0xF954); Compare(cpu, cpu.A, 0x01); cpu.totalCycles += 2;
+    // F956  BNE $F959
+    RecompiledBegin(ctx, 0xF956); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xF959; return; }
+    // F958  RTS
+    { RecompiledBegin(ctx, 0xF958); cpu.SP++; const byte low = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); const byte high = bus.read(static_cast<memAddress>(0x0100 + cpu.SP + 1)); cpu.SP++; cpu.totalCycles += 6; cpu.PC = static_cast<memAddress>(RecompiledWord(low, high) + 1); return; }
+}
+
+static void Block_F959(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // F959  STY $00
+    RecompiledBegin(ctx, 0xF959); bus.write(0x0000, cpu.Y); cpu.totalCycles += 3;
+    // F95B  RTS
+    { RecompiledBegin(ctx, 0xF95B); cpu.SP++; const byte low = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); const byte high = bus.read(static_cast<memAddress>(0x0100 + cpu.SP + 1)); cpu.SP++; cpu.totalCycles += 6; cpu.PC = static_cast<memAddress>(RecompiledWord(low, high) + 1); return; }
+}
+
+static void Block_F95C(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // F95C  LDA #$40
+    RecompiledBegin(ctx, 0xF95C); cpu.A = 0x40; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // F95E  SEC
+    RecompiledBegin(ctx, 0xF95E); SetFlag(cpu, Flags::C, true); cpu.totalCycles += 2;
+    // F95F  BIT $01
+    RecompiledBegin(ctx, 0xF95F); BitTest(cpu, bus.read(0x0001)); cpu.totalCycles += 3;
+    // F961  RTS
+    { RecompiledBegin(ctx, 0xF961); cpu.SP++; const byte low = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); const byte high = bus.read(static_cast<memAddress>(0x0100 + cpu.SP + 1)); cpu.SP++; cpu.totalCycles += 6; cpu.PC = static_cast<memAddress>(RecompiledWord(low, high) + 1); return; }
+}
+
+static void Block_F962(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // F962  BCS $F96F
+    RecompiledBegin(ctx, 0xF962); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xF96F; return; }
+    // F964  BEQ $F96F
+    RecompiledBegin(ctx, 0xF964); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xF96F; return; }
+    // F966  BPL $F96F
+    RecompiledBegin(ctx, 0xF966); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xF96F; return; }
+    // F968  BVS $F96F
+    RecompiledBegin(ctx, 0xF968); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xF96F; return; }
+    // F96A  CMP #$FF
+    RecompiledBegin(ctx, 0xF96A); Compare(cpu, cpu.A, 0xFF); cpu.totalCycles += 2;
+    // F96C  BNE $F96F
+    RecompiledBegin(ctx, 0xF96C); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xF96F; return; }
+    // F96E  RTS
+    { RecompiledBegin(ctx, 0xF96E); cpu.SP++; const byte low = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); const byte high = bus.read(static_cast<memAddress>(0x0100 + cpu.SP + 1)); cpu.SP++; cpu.totalCycles += 6; cpu.PC = static_cast<memAddress>(RecompiledWord(low, high) + 1); return; }
+}
+
+static void Block_F96F(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // F96F  STY $00
+    RecompiledBegin(ctx, 0xF96F); bus.write(0x0000, cpu.Y); cpu.totalCycles += 3;
+    // F971  RTS
+    { RecompiledBegin(ctx, 0xF971); cpu.SP++; const byte low = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); const byte high = bus.read(static_cast<memAddress>(0x0100 + cpu.SP + 1)); cpu.SP++; cpu.totalCycles += 6; cpu.PC = static_cast<memAddress>(RecompiledWord(low, high) + 1); return; }
+}
+
+static void Block_F972(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // F972  CLC
+    RecompiledBegin(ctx, 0xF972); SetFlag(cpu, Flags::C, false); cpu.totalCycles += 2;
+    // F973  LDA #$80
+    RecompiledBegin(ctx, 0xF973); cpu.A = 0x80; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // F975  RTS
+    { RecompiledBegin(ctx, 0xF975); cpu.SP++; const byte low = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); const byte high = bus.read(static_cast<memAddress>(0x0100 + cpu.SP + 1)); cpu.SP++; cpu.totalCycles += 6; cpu.PC = static_cast<memAddress>(RecompiledWord(low, high) + 1); return; }
+}
+
+static void Block_F976(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // F976  BCC $F97D
+    RecompiledBegin(ctx, 0xF976); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xF97D; return; }
+    // F978  CMP #$7F
+    RecompiledBegin(ctx, 0xF978); Compare(cpu, cpu.A, 0x7F); cpu.totalCycles += 2;
+    // F97A  BNE $F97D
+    RecompiledBegin(ctx, 0xF97A); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xF97D; return; }
+    // F97C  RTS
+    { RecompiledBegin(ctx, 0xF97C); cpu.SP++; const byte low = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); const byte high = bus.read(static_cast<memAddress>(0x0100 + cpu.SP + 1)); cpu.SP++; cpu.totalCycles += 6; cpu.PC = static_cast<memAddress>(RecompiledWord(low, high) + 1); return; }
+}
+
+static void Block_F97D(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // F97D  STY $00
+    RecompiledBegin(ctx, 0xF97D); bus.write(0x0000, cpu.Y); cpu.totalCycles += 3;
+    // F97F  RTS
+    { RecompiledBegin(ctx, 0xF97F); cpu.SP++; const byte low = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); const byte high = bus.read(static_cast<memAddress>(0x0100 + cpu.SP + 1)); cpu.SP++; cpu.totalCycles += 6; cpu.PC = static_cast<memAddress>(RecompiledWord(low, high) + 1); return; }
+}
+
+static void Block_F980(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // F980  SEC
+    RecompiledBegin(ctx, 0xF980); SetFlag(cpu, Flags::C, true); cpu.totalCycles += 2;
+    // F981  LDA #$81
+    RecompiledBegin(ctx, 0xF981); cpu.A = 0x81; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // F983  RTS
+    { RecompiledBegin(ctx, 0xF983); cpu.SP++; const byte low = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); const byte high = bus.read(static_cast<memAddress>(0x0100 + cpu.SP + 1)); cpu.SP++; cpu.totalCycles += 6; cpu.PC = static_cast<memAddress>(RecompiledWord(low, high) + 1); return; }
+}
+
+static void Block_F984(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // F984  BVC $F98D
+    RecompiledBegin(ctx, 0xF984); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xF98D; return; }
+    // F986  BCC $F98D
+    RecompiledBegin(ctx, 0xF986); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xF98D; return; }
+    // F988  CMP #$02
+    RecompiledBegin(ctx, 0xF988); Compare(cpu, cpu.A, 0x02); cpu.totalCycles += 2;
+    // F98A  BNE $F98D
+    RecompiledBegin(ctx, 0xF98A); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xF98D; return; }
+    // F98C  RTS
+    { RecompiledBegin(ctx, 0xF98C); cpu.SP++; const byte low = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); const byte high = bus.read(static_cast<memAddress>(0x0100 + cpu.SP + 1)); cpu.SP++; cpu.totalCycles += 6; cpu.PC = static_cast<memAddress>(RecompiledWord(low, high) + 1); return; }
+}
+
+static void Block_F98D(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // F98D  STY $00
+    RecompiledBegin(ctx, 0xF98D); bus.write(0x0000, cpu.Y); cpu.totalCycles += 3;
+    // F98F  RTS
+    { RecompiledBegin(ctx, 0xF98F); cpu.SP++; const byte low = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); const byte high = bus.read(static_cast<memAddress>(0x0100 + cpu.SP + 1)); cpu.SP++; cpu.totalCycles += 6; cpu.PC = static_cast<memAddress>(RecompiledWord(low, high) + 1); return; }
+}
+
+static void Block_F990(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // F990  LDX #$55
+    RecompiledBegin(ctx, 0xF990); cpu.X = 0x55; SetNZ(cpu, cpu.X); cpu.totalCycles += 2;
+    // F992  LDA #$FF
+    RecompiledBegin(ctx, 0xF992); cpu.A = 0xFF; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // F994  STA $01
+    RecompiledBegin(ctx, 0xF994); bus.write(0x0001, cpu.A); cpu.totalCycles += 3;
+    // F996  NOP
+    RecompiledBegin(ctx, 0xF996); cpu.totalCycles += 2;
+    // F997  BIT $01
+    RecompiledBegin(ctx, 0xF997); BitTest(cpu, bus.read(0x0001)); cpu.totalCycles += 3;
+    // F999  SEC
+    RecompiledBegin(ctx, 0xF999); SetFlag(cpu, Flags::C, true); cpu.totalCycles += 2;
+    // F99A  LDA #$01
+    RecompiledBegin(ctx, 0xF99A); cpu.A = 0x01; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // F99C  RTS
+    { RecompiledBegin(ctx, 0xF99C); cpu.SP++; const byte low = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); const byte high = bus.read(static_cast<memAddress>(0x0100 + cpu.SP + 1)); cpu.SP++; cpu.totalCycles += 6; cpu.PC = static_cast<memAddress>(RecompiledWord(low, high) + 1); return; }
+}
+
+static void Block_F99D(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // F99D  BCC $F9BA
+    RecompiledBegin(ctx, 0xF99D); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xF9BA; return; }
+    // F99F  BNE $F9BA
+    RecompiledBegin(ctx, 0xF99F); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xF9BA; return; }
+    // F9A1  BMI $F9BA
+    RecompiledBegin(ctx, 0xF9A1); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xF9BA; return; }
+    // F9A3  BVC $F9BA
+    RecompiledBegin(ctx, 0xF9A3); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xF9BA; return; }
+    // F9A5  CMP #$00
+    RecompiledBegin(ctx, 0xF9A5); Compare(cpu, cpu.A, 0x00); cpu.totalCycles += 2;
+    // F9A7  BNE $F9BA
+    RecompiledBegin(ctx, 0xF9A7); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xF9BA; return; }
+    // F9A9  CLV
+    RecompiledBegin(ctx, 0xF9A9); SetFlag(cpu, Flags::V, false); cpu.totalCycles += 2;
+    // F9AA  LDA #$AA
+    RecompiledBegin(ctx, 0xF9AA); cpu.A = 0xAA; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // F9AC  RTS
+    { RecompiledBegin(ctx, 0xF9AC); cpu.SP++; const byte low = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); const byte high = bus.read(static_cast<memAddress>(0x0100 + cpu.SP + 1)); cpu.SP++; cpu.totalCycles += 6; cpu.PC = static_cast<memAddress>(RecompiledWord(low, high) + 1); return; }
+}
+
+static void Block_F9AD(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // F9AD  BCS $F9BA
+    RecompiledBegin(ctx, 0xF9AD); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xF9BA; return; }
+    // F9AF  BEQ $F9BA
+    RecompiledBegin(ctx, 0xF9AF); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xF9BA; return; }
+    // F9B1  BMI $F9BA
+    RecompiledBegin(ctx, 0xF9B1); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xF9BA; return; }
+    // F9B3  BVS $F9BA
+    RecompiledBegin(ctx, 0xF9B3); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xF9BA; return; }
+    // F9B5  CMP #$55
+    RecompiledBegin(ctx, 0xF9B5); Compare(cpu, cpu.A, 0x55); cpu.totalCycles += 2;
+    // F9B7  BNE $F9BA
+    RecompiledBegin(ctx, 0xF9B7); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xF9BA; return; }
+    // F9B9  RTS
+    { RecompiledBegin(ctx, 0xF9B9); cpu.SP++; const byte low = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); const byte high = bus.read(static_cast<memAddress>(0x0100 + cpu.SP + 1)); cpu.SP++; cpu.totalCycles += 6; cpu.PC = static_cast<memAddress>(RecompiledWord(low, high) + 1); return; }
+}
+
+static void Block_F9BA(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // F9BA  STY $00
+    RecompiledBegin(ctx, 0xF9BA); bus.write(0x0000, cpu.Y); cpu.totalCycles += 3;
+    // F9BC  RTS
+    { RecompiledBegin(ctx, 0xF9BC); cpu.SP++; const byte low = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); const byte high = bus.read(static_cast<memAddress>(0x0100 + cpu.SP + 1)); cpu.SP++; cpu.totalCycles += 6; cpu.PC = static_cast<memAddress>(RecompiledWord(low, high) + 1); return; }
+}
+
+static void Block_F9BD(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // F9BD  BIT $01
+    RecompiledBegin(ctx, 0xF9BD); BitTest(cpu, bus.read(0x0001)); cpu.totalCycles += 3;
+    // F9BF  SEC
+    RecompiledBegin(ctx, 0xF9BF); SetFlag(cpu, Flags::C, true); cpu.totalCycles += 2;
+    // F9C0  LDA #$80
+    RecompiledBegin(ctx, 0xF9C0); cpu.A = 0x80; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // F9C2  RTS
+    { RecompiledBegin(ctx, 0xF9C2); cpu.SP++; const byte low = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); const byte high = bus.read(static_cast<memAddress>(0x0100 + cpu.SP + 1)); cpu.SP++; cpu.totalCycles += 6; cpu.PC = static_cast<memAddress>(RecompiledWord(low, high) + 1); return; }
+}
+
+static void Block_F9C3(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // F9C3  BCC $F9E1
+    RecompiledBegin(ctx, 0xF9C3); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xF9E1; return; }
+    // F9C5  BNE $F9E1
+    RecompiledBegin(ctx, 0xF9C5); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xF9E1; return; }
+    // F9C7  BMI $F9E1
+    RecompiledBegin(ctx, 0xF9C7); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xF9E1; return; }
+    // F9C9  BVC $F9E1
+    RecompiledBegin(ctx, 0xF9C9); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xF9E1; return; }
+    // F9CB  CMP #$00
+    RecompiledBegin(ctx, 0xF9CB); Compare(cpu, cpu.A, 0x00); cpu.totalCycles += 2;
+    // F9CD  BNE $F9E1
+    RecompiledBegin(ctx, 0xF9CD); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xF9E1; return; }
+    // F9CF  CLV
+    RecompiledBegin(ctx, 0xF9CF); SetFlag(cpu, Flags::V, false); cpu.totalCycles += 2;
+    // F9D0  LDA #$55
+    RecompiledBegin(ctx, 0xF9D0); cpu.A = 0x55; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // F9D2  SEC
+    RecompiledBegin(ctx, 0xF9D2); SetFlag(cpu, Flags::C, true); cpu.totalCycles += 2;
+    // F9D3  RTS
+    { RecompiledBegin(ctx, 0xF9D3); cpu.SP++; const byte low = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); const byte high = bus.read(static_cast<memAddress>(0x0100 + cpu.SP + 1)); cpu.SP++; cpu.totalCycles += 6; cpu.PC = static_cast<memAddress>(RecompiledWord(low, high) + 1); return; }
+}
+
+static void Block_F9D4(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // F9D4  BCS $F9E1
+    RecompiledBegin(ctx, 0xF9D4); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xF9E1; return; }
+    // F9D6  BEQ $F9E1
+    RecompiledBegin(ctx, 0xF9D6); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xF9E1; return; }
+    // F9D8  BPL $F9E1
+    RecompiledBegin(ctx, 0xF9D8); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xF9E1; return; }
+    // F9DA  BVS $F9E1
+    RecompiledBegin(ctx, 0xF9DA); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xF9E1; return; }
+    // F9DC  CMP #$AA
+    RecompiledBegin(ctx, 0xF9DC); Compare(cpu, cpu.A, 0xAA); cpu.totalCycles += 2;
+    // F9DE  BNE $F9E1
+    RecompiledBegin(ctx, 0xF9DE); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xF9E1; return; }
+    // F9E0  RTS
+    { RecompiledBegin(ctx, 0xF9E0); cpu.SP++; const byte low = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); const byte high = bus.read(static_cast<memAddress>(0x0100 + cpu.SP + 1)); cpu.SP++; cpu.totalCycles += 6; cpu.PC = static_cast<memAddress>(RecompiledWord(low, high) + 1); return; }
+}
+
+static void Block_F9E1(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // F9E1  STY $00
+    RecompiledBegin(ctx, 0xF9E1); bus.write(0x0000, cpu.Y); cpu.totalCycles += 3;
+    // F9E3  RTS
+    { RecompiledBegin(ctx, 0xF9E3); cpu.SP++; const byte low = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); const byte high = bus.read(static_cast<memAddress>(0x0100 + cpu.SP + 1)); cpu.SP++; cpu.totalCycles += 6; cpu.PC = static_cast<memAddress>(RecompiledWord(low, high) + 1); return; }
+}
+
+static void Block_F9E4(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // F9E4  BIT $01
+    RecompiledBegin(ctx, 0xF9E4); BitTest(cpu, bus.read(0x0001)); cpu.totalCycles += 3;
+    // F9E6  SEC
+    RecompiledBegin(ctx, 0xF9E6); SetFlag(cpu, Flags::C, true); cpu.totalCycles += 2;
+    // F9E7  LDA #$01
+    RecompiledBegin(ctx, 0xF9E7); cpu.A = 0x01; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // F9E9  RTS
+    { RecompiledBegin(ctx, 0xF9E9); cpu.SP++; const byte low = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); const byte high = bus.read(static_cast<memAddress>(0x0100 + cpu.SP + 1)); cpu.SP++; cpu.totalCycles += 6; cpu.PC = static_cast<memAddress>(RecompiledWord(low, high) + 1); return; }
+}
+
+static void Block_F9EA(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // F9EA  BCC $FA08
+    RecompiledBegin(ctx, 0xF9EA); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::C)) { cpu.totalCycles += 2; cpu.PC = 0xFA08; return; }
+    // F9EC  BEQ $FA08
+    RecompiledBegin(ctx, 0xF9EC); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 2; cpu.PC = 0xFA08; return; }
+    // F9EE  BPL $FA08
+    RecompiledBegin(ctx, 0xF9EE); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::N)) { cpu.totalCycles += 2; cpu.PC = 0xFA08; return; }
+    // F9F0  BVC $FA08
+    RecompiledBegin(ctx, 0xF9F0); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::V)) { cpu.totalCycles += 2; cpu.PC = 0xFA08; return; }
+    // F9F2  CMP #$80
+    RecompiledBegin(ctx, 0xF9F2); Compare(cpu, cpu.A, 0x80); cpu.totalCycles += 2;
+    // F9F4  BNE $FA08
+    RecompiledBegin(ctx, 0xF9F4); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 2; cpu.PC = 0xFA08; return; }
+    // F9F6  CLV
+    RecompiledBegin(ctx, 0xF9F6); SetFlag(cpu, Flags::V, false); cpu.totalCycles += 2;
+    // F9F7  CLC
+    RecompiledBegin(ctx, 0xF9F7); SetFlag(cpu, Flags::C, false); cpu.totalCycles += 2;
+    // F9F8  LDA #$55
+    RecompiledBegin(ctx, 0xF9F8); cpu.A = 0x55; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // F9FA  RTS
+    { RecompiledBegin(ctx, 0xF9FA); cpu.SP++; const byte low = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); const byte high = bus.read(static_cast<memAddress>(0x0100 + cpu.SP + 1)); cpu.SP++; cpu.totalCycles += 6; cpu.PC = static_cast<memAddress>(RecompiledWord(low, high) + 1); return; }
+}
+
+static void Block_F9FB(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // F9FB  BCC $FA08
+    RecompiledBegin(ctx, 0xF9FB); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::C)) { cpu.totalCycles += 2; cpu.PC = 0xFA08; return; }
+    // F9FD  BEQ $FA08
+    RecompiledBegin(ctx, 0xF9FD); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 2; cpu.PC = 0xFA08; return; }
+    // F9FF  BMI $FA08
+    RecompiledBegin(ctx, 0xF9FF); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xFA08; return; }
+    // FA01  BVS $FA08
+    RecompiledBegin(ctx, 0xFA01); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xFA08; return; }
+    // FA03  CMP #$2A
+    RecompiledBegin(ctx, 0xFA03); Compare(cpu, cpu.A, 0x2A); cpu.totalCycles += 2;
+    // FA05  BNE $FA08
+    RecompiledBegin(ctx, 0xFA05); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xFA08; return; }
+    // FA07  RTS
+    { RecompiledBegin(ctx, 0xFA07); cpu.SP++; const byte low = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); const byte high = bus.read(static_cast<memAddress>(0x0100 + cpu.SP + 1)); cpu.SP++; cpu.totalCycles += 6; cpu.PC = static_cast<memAddress>(RecompiledWord(low, high) + 1); return; }
+}
+
+static void Block_FA08(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // FA08  STY $00
+    RecompiledBegin(ctx, 0xFA08); bus.write(0x0000, cpu.Y); cpu.totalCycles += 3;
+    cpu.PC = 0xFA0A;
+}
+
+static void Block_FA0A(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // FA0A  BIT $01
+    RecompiledBegin(ctx, 0xFA0A); BitTest(cpu, bus.read(0x0001)); cpu.totalCycles += 3;
+    // FA0C  SEC
+    RecompiledBegin(ctx, 0xFA0C); SetFlag(cpu, Flags::C, true); cpu.totalCycles += 2;
+    // FA0D  LDA #$80
+    RecompiledBegin(ctx, 0xFA0D); cpu.A = 0x80; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // FA0F  RTS
+    { RecompiledBegin(ctx, 0xFA0F); cpu.SP++; const byte low = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); const byte high = bus.read(static_cast<memAddress>(0x0100 + cpu.SP + 1)); cpu.SP++; cpu.totalCycles += 6; cpu.PC = static_cast<memAddress>(RecompiledWord(low, high) + 1); return; }
+}
+
+static void Block_FA10(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // FA10  BCC $FA2E
+    RecompiledBegin(ctx, 0xFA10); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xFA2E; return; }
+    // FA12  BEQ $FA2E
+    RecompiledBegin(ctx, 0xFA12); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xFA2E; return; }
+    // FA14  BMI $FA2E
+    RecompiledBegin(ctx, 0xFA14); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xFA2E; return; }
+    // FA16  BVC $FA2E
+    RecompiledBegin(ctx, 0xFA16); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xFA2E; return; }
+    // FA18  CMP #$01
+    RecompiledBegin(ctx, 0xFA18); Compare(cpu, cpu.A, 0x01); cpu.totalCycles += 2;
+    // FA1A  BNE $FA2E
+    RecompiledBegin(ctx, 0xFA1A); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xFA2E; return; }
+    // FA1C  CLV
+    RecompiledBegin(ctx, 0xFA1C); SetFlag(cpu, Flags::V, false); cpu.totalCycles += 2;
+    // FA1D  CLC
+    RecompiledBegin(ctx, 0xFA1D); SetFlag(cpu, Flags::C, false); cpu.totalCycles += 2;
+    // FA1E  LDA #$55
+    RecompiledBegin(ctx, 0xFA1E); cpu.A = 0x55; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // FA20  RTS
+    { RecompiledBegin(ctx, 0xFA20); cpu.SP++; const byte low = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); const byte high = bus.read(static_cast<memAddress>(0x0100 + cpu.SP + 1)); cpu.SP++; cpu.totalCycles += 6; cpu.PC = static_cast<memAddress>(RecompiledWord(low, high) + 1); return; }
+}
+
+static void Block_FA21(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // FA21  BCS $FA2E
+    RecompiledBegin(ctx, 0xFA21); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::C)) { cpu.totalCycles += 1; cpu.PC = 0xFA2E; return; }
+    // FA23  BEQ $FA2E
+    RecompiledBegin(ctx, 0xFA23); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xFA2E; return; }
+    // FA25  BPL $FA2E
+    RecompiledBegin(ctx, 0xFA25); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::N)) { cpu.totalCycles += 1; cpu.PC = 0xFA2E; return; }
+    // FA27  BVS $FA2E
+    RecompiledBegin(ctx, 0xFA27); cpu.totalCycles += 2; if (GetFlag(cpu, Flags::V)) { cpu.totalCycles += 1; cpu.PC = 0xFA2E; return; }
+    // FA29  CMP #$AA
+    RecompiledBegin(ctx, 0xFA29); Compare(cpu, cpu.A, 0xAA); cpu.totalCycles += 2;
+    // FA2B  BNE $FA2E
+    RecompiledBegin(ctx, 0xFA2B); cpu.totalCycles += 2; if (!GetFlag(cpu, Flags::Z)) { cpu.totalCycles += 1; cpu.PC = 0xFA2E; return; }
+    // FA2D  RTS
+    { RecompiledBegin(ctx, 0xFA2D); cpu.SP++; const byte low = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); const byte high = bus.read(static_cast<memAddress>(0x0100 + cpu.SP + 1)); cpu.SP++; cpu.totalCycles += 6; cpu.PC = static_cast<memAddress>(RecompiledWord(low, high) + 1); return; }
+}
+
+static void Block_FA2E(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // FA2E  STY $00
+    RecompiledBegin(ctx, 0xFA2E); bus.write(0x0000, cpu.Y); cpu.totalCycles += 3;
+    // FA30  RTS
+    { RecompiledBegin(ctx, 0xFA30); cpu.SP++; const byte low = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); const byte high = bus.read(static_cast<memAddress>(0x0100 + cpu.SP + 1)); cpu.SP++; cpu.totalCycles += 6; cpu.PC = static_cast<memAddress>(RecompiledWord(low, high) + 1); return; }
+}
+
+static void Block_FA31(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // FA31  BIT $01
+    RecompiledBegin(ctx, 0xFA31); BitTest(cpu, bus.read(0x0001)); cpu.totalCycles += 3;
+    // FA33  CLC
+    RecompiledBegin(ctx, 0xFA33); SetFlag(cpu, Flags::C, false); cpu.totalCycles += 2;
+    // FA34  LDA #$40
+    RecompiledBegin(ctx, 0xFA34); cpu.A = 0x40; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // FA36  RTS
+    { RecompiledBegin(ctx, 0xFA36); cpu.SP++; const byte low = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); const byte high = bus.read(static_cast<memAddress>(0x0100 + cpu.SP + 1)); cpu.SP++; cpu.totalCycles += 6; cpu.PC = static_cast<memAddress>(RecompiledWord(low, high) + 1); return; }
+}
+
+static void Block_FA7B(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // FA7B  BIT $01
+    RecompiledBegin(ctx, 0xFA7B); BitTest(cpu, bus.read(0x0001)); cpu.totalCycles += 3;
+    // FA7D  CLC
+    RecompiledBegin(ctx, 0xFA7D); SetFlag(cpu, Flags::C, false); cpu.totalCycles += 2;
+    // FA7E  LDA #$B3
+    RecompiledBegin(ctx, 0xFA7E); cpu.A = 0xB3; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // FA80  RTS
+    { RecompiledBegin(ctx, 0xFA80); cpu.SP++; const byte low = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); const byte high = bus.read(static_cast<memAddress>(0x0100 + cpu.SP + 1)); cpu.SP++; cpu.totalCycles += 6; cpu.PC = static_cast<memAddress>(RecompiledWord(low, high) + 1); return; }
+}
+
+static void Block_FAB1(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // FAB1  BIT $01
+    RecompiledBegin(ctx, 0xFAB1); BitTest(cpu, bus.read(0x0001)); cpu.totalCycles += 3;
+    // FAB3  CLC
+    RecompiledBegin(ctx, 0xFAB3); SetFlag(cpu, Flags::C, false); cpu.totalCycles += 2;
+    // FAB4  LDA #$40
+    RecompiledBegin(ctx, 0xFAB4); cpu.A = 0x40; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // FAB6  RTS
+    { RecompiledBegin(ctx, 0xFAB6); cpu.SP++; const byte low = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); const byte high = bus.read(static_cast<memAddress>(0x0100 + cpu.SP + 1)); cpu.SP++; cpu.totalCycles += 6; cpu.PC = static_cast<memAddress>(RecompiledWord(low, high) + 1); return; }
+}
+
+static void Block_FAE9(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // FAE9  BIT $01
+    RecompiledBegin(ctx, 0xFAE9); BitTest(cpu, bus.read(0x0001)); cpu.totalCycles += 3;
+    // FAEB  CLC
+    RecompiledBegin(ctx, 0xFAEB); SetFlag(cpu, Flags::C, false); cpu.totalCycles += 2;
+    // FAEC  LDA #$B2
+    RecompiledBegin(ctx, 0xFAEC); cpu.A = 0xB2; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // FAEE  RTS
+    { RecompiledBegin(ctx, 0xFAEE); cpu.SP++; const byte low = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); const byte high = bus.read(static_cast<memAddress>(0x0100 + cpu.SP + 1)); cpu.SP++; cpu.totalCycles += 6; cpu.PC = static_cast<memAddress>(RecompiledWord(low, high) + 1); return; }
+}
+
+static void Block_FB1D(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // FB1D  BIT $01
+    RecompiledBegin(ctx, 0xFB1D); BitTest(cpu, bus.read(0x0001)); cpu.totalCycles += 3;
+    // FB1F  CLC
+    RecompiledBegin(ctx, 0xFB1F); SetFlag(cpu, Flags::C, false); cpu.totalCycles += 2;
+    // FB20  LDA #$B3
+    RecompiledBegin(ctx, 0xFB20); cpu.A = 0xB3; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // FB22  RTS
+    { RecompiledBegin(ctx, 0xFB22); cpu.SP++; const byte low = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); const byte high = bus.read(static_cast<memAddress>(0x0100 + cpu.SP + 1)); cpu.SP++; cpu.totalCycles += 6; cpu.PC = static_cast<memAddress>(RecompiledWord(low, high) + 1); return; }
+}
+
+static void Block_FB53(Context& ctx)
+{
+    Cpu& cpu = ctx.cpu;
+    CodeGuardBus& bus = ctx.bus;
+    // FB53  BIT $01
+    RecompiledBegin(ctx, 0xFB53); BitTest(cpu, bus.read(0x0001)); cpu.totalCycles += 3;
+    // FB55  CLC
+    RecompiledBegin(ctx, 0xFB55); SetFlag(cpu, Flags::C, false); cpu.totalCycles += 2;
+    // FB56  LDA #$B3
+    RecompiledBegin(ctx, 0xFB56); cpu.A = 0xB3; SetNZ(cpu, cpu.A); cpu.totalCycles += 2;
+    // FB58  RTS
+    { RecompiledBegin(ctx, 0xFB58); cpu.SP++; const byte low = bus.read(static_cast<memAddress>(0x0100 + cpu.SP)); const byte high = bus.read(static_cast<memAddress>(0x0100 + cpu.SP + 1)); cpu.SP++; cpu.totalCycles += 6; cpu.PC = static_cast<memAddress>(RecompiledWord(low, high) + 1); return; }
+}
+
+static const RecompiledBlock<Cpu> BLOCKS[] = {
+    { 0xC000, 0xC002, 0x5A7D7176110D12D4ull, &Block_C000 },
+    { 0xC004, 0xC008, 0x1C771931CF6B1ED6ull, &Block_C004 },
+    { 0xC009, 0xC00D, 0x8000B588DA871FFFull, &Block_C009 },
+    { 0xC00E, 0xC033, 0xCA4F15CC006F79E8ull, &Block_C00E },
+    { 0xC034, 0xC048, 0x83A37BFACF8D836Eull, &Block_C034 },
+    { 0xC049, 0xC071, 0xC4CF78AE0172E4EAull, &Block_C049 },
+    { 0xC072, 0xC080, 0x8DFA99C45AE7F56Eull, &Block_C072 },
+    { 0xC081, 0xC083, 0x1F0EEEF808E39379ull, &Block_C081 },
+    { 0xC084, 0xC088, 0xA2BFC3BAEBABAE5Aull, &Block_C084 },
+    { 0xC089, 0xC09B, 0x8D5BEFF68D072B45ull, &Block_C089 },
+    { 0xC09C, 0xC09E, 0x7F2C3F1A9BF791A5ull, &Block_C09C },
+    { 0xC09F, 0xC0A1, 0x31AA06E45585CE27ull, &Block_C09F },
+    { 0xC0A2, 0xC0AB, 0x9C6A6E4297572398ull, &Block_C0A2 },
+    { 0xC0AC, 0xC0AE, 0x31AA06E45585CE27ull, &Block_C0AC },
+    { 0xC0AF, 0xC0BC, 0x8B4C0626EF64CCB3ull, &Block_C0AF },
+    { 0xC0BD, 0xC0BF, 0x59F95943862189E8ull, &Block_C0BD },
+    { 0xC0C0, 0xC0C6, 0xC52932BB15C5B6AEull, &Block_C0C0 },
+    { 0xC0C7, 0xC0C9, 0x97F3AC68FD182CA9ull, &Block_C0C7 },
+    { 0xC0CA, 0xC0CF, 0xD6F9299226279B07ull, &Block_C0CA },
+    { 0xC0D0, 0xC0D2, 0x7149E17F713A066Full, &Block_C0D0 },
+    { 0xC0D3, 0xC0E4, 0xD1D7AC7746812275ull, &Block_C0D3 },
+    { 0xC0E5, 0xC0E9, 0x285A992F02259571ull, &Block_C0E5 },
+    { 0xC0EA, 0xC0EC, 0x97F3AC68FD182CA9ull, &Block_C0EA },
+    { 0xC0ED, 0xC109, 0x09EC0A069A61FEEDull, &Block_C0ED },
+    { 0xC126, 0xC134, 0x31AAB15521334514ull, &Block_C126 },
+    { 0xC135, 0xC137, 0x1F0EEEF808E39379ull, &Block_C135 },
+    { 0xC138, 0xC13C, 0xE97B645C7168B3ADull, &Block_C138 },
+    { 0xC13D, 0xC14F, 0xCFF8C40F673E320Cull, &Block_C13D },
+    { 0xC150, 0xC152, 0x1FEF679B0F1E2C63ull, &Block_C150 },
+    { 0xC153, 0xC155, 0x31AA06E45585CE27ull, &Block_C153 },
+    { 0xC156, 0xC15F, 0xD92570A0FD6F345Aull, &Block_C156 },
+    { 0xC160, 0xC162, 0x31AA06E45585CE27ull, &Block_C160 },
+    { 0xC163, 0xC170, 0x6392FAA735819FE0ull, &Block_C163 },
+    { 0xC171, 0xC173, 0x59F95943862189E8ull, &Block_C171 },
+    { 0xC174, 0xC17A, 0xB9E0CCFF44AC076Eull, &Block_C174 },
+    { 0xC17B, 0xC17D, 0xB71B3249F83C60F6ull, &Block_C17B },
+    { 0xC17E, 0xC183, 0xD6F9299226279B07ull, &Block_C17E },
+    { 0xC184, 0xC186, 0xC72EF5AF930F5E71ull, &Block_C184 },
+    { 0xC187, 0xC198, 0x342559EA736E0BA4ull, &Block_C187 },
+    { 0xC199, 0xC19D, 0x285A992F02259571ull, &Block_C199 },
+    { 0xC19E, 0xC1A0, 0xB71B3249F83C60F6ull, &Block_C19E },
+    { 0xC1A1, 0xC1BD, 0x79F6733AEC590CB5ull, &Block_C1A1 },
+    { 0xC1ED, 0xC1EF, 0x1F0EEEF808E39379ull, &Block_C1ED },
+    { 0xC1F0, 0xC236, 0x49A8DF9683354282ull, &Block_C1F0 },
+    { 0xC237, 0xC243, 0xA3ABCFB3FB028368ull, &Block_C237 },
+    { 0xC244, 0xC250, 0xF5EA7A824C71F8E0ull, &Block_C244 },
+    { 0xC261, 0xC275, 0x8338A9A38D86B503ull, &Block_C261 },
+    { 0xC276, 0xC27D, 0xD757FB4B722E9153ull, &Block_C276 },
+    { 0xC27E, 0xC28C, 0x919A5CCA229658ECull, &Block_C27E },
+    { 0xC28D, 0xC28E, 0xC6768A09D90DC791ull, &Block_C28D },
+    { 0xC28F, 0xC293, 0xF7A202964EF71CD1ull, &Block_C28F },
+    { 0xC294, 0xC2A6, 0x819785AC7590DBA3ull, &Block_C294 },
+    { 0xC2A7, 0xC2B1, 0xB7CB98F9508B3827ull, &Block_C2A7 },
+    { 0xC2B2, 0xC2BB, 0xD0434CADEB27EE3Dull, &Block_C2B2 },
+    { 0xC2BC, 0xC2BD, 0x3263BE12FBA36432ull, &Block_C2BC },
+    { 0xC2BE, 0xC2CD, 0x34B76FAC8529679Aull, &Block_C2BE },
+    { 0xC2CE, 0xC2D2, 0xD86D870C80F3BCFCull, &Block_C2CE },
+    { 0xC2D3, 0xC2D7, 0x44BA63E5575758AFull, &Block_C2D3 },
+    { 0xC2D8, 0xC2E1, 0x522AB102866E0A48ull, &Block_C2D8 },
+    { 0xC2E2, 0xC2EC, 0x8F528064CE998401ull, &Block_C2E2 },
+    { 0xC2ED, 0xC2FA, 0xCB1F8AF3A9ABE503ull, &Block_C2ED },
+    { 0xC2FB, 0xC2FC, 0x595A066AE4488E46ull, &Block_C2FB },
+    { 0xC2FD, 0xC306, 0x7D9F2D8D056A5773ull, &Block_C2FD },
+    { 0xC5AF, 0xC5DB, 0x1C396AE3131ED9D4ull, &Block_C5AF },
+    { 0xC5DC, 0xC5F3, 0x39F0AF9B5F2F32A6ull, &Block_C5DC },
+    { 0xC5F4, 0xC5F4, 0x8EF849D614013634ull, &Block_C5F4 },
+    { 0xC5F5, 0xC5FF, 0x485427F40F0336F3ull, &Block_C5F5 },
+    { 0xC600, 0xC602, 0xA228E8DD9B9B1488ull, &Block_C600 },
+    { 0xC603, 0xC605, 0xAD21E021E3419E38ull, &Block_C603 },
+    { 0xC606, 0xC608, 0x7678701A75B429B6ull, &Block_C606 },
+    { 0xC609, 0xC60B, 0xEAFF4A813761E7E7ull, &Block_C609 },
+    { 0xC60C, 0xC60E, 0x539EC8F1E5807CBFull, &Block_C60C },
+    { 0xC60F, 0xC611, 0x38EAB4FC4A79E0A3ull, &Block_C60F },
+    { 0xC612, 0xC614, 0xCD3113A7272BCFC8ull, &Block_C612 },
+    { 0xC615, 0xC617, 0xCDE63B0C188830A6ull, &Block_C615 },
+    { 0xC618, 0xC61A, 0xEA69C25FD1647C32ull, &Block_C618 },
+    { 0xC61B, 0xC625, 0x543CBF043EC3F70Aull, &Block_C61B },
+    { 0xC626, 0xC628, 0x8F6EA4C0D3C7C4C3ull, &Block_C626 },
+    { 0xC629, 0xC62B, 0x0F2B5C8691338AA3ull, &Block_C629 },
+    { 0xC62C, 0xC62E, 0xE5929C421FBF4728ull, &Block_C62C },
+    { 0xC62F, 0xC631, 0x15A8789A07AC8AA2ull, &Block_C62F },
+    { 0xC632, 0xC634, 0x4052F0217121939Dull, &Block_C632 },
+    { 0xC635, 0xC637, 0x4549561D024DFB37ull, &Block_C635 },
+    { 0xC638, 0xC63A, 0xC0FC811FAAAB4CFAull, &Block_C638 },
+    { 0xC63B, 0xC63D, 0xCC0752BA95B66DCEull, &Block_C63B },
+    { 0xC63E, 0xC640, 0xC471446241431FDCull, &Block_C63E },
+    { 0xC641, 0xC643, 0x9C5DE793347D4ADCull, &Block_C641 },
+    { 0xC644, 0xC646, 0x0A17044C4FCA80BFull, &Block_C644 },
+    { 0xC647, 0xC649, 0x4594B3C1FB7A6A00ull, &Block_C647 },
+    { 0xC64A, 0xC654, 0xA1A5704F505A05A1ull, &Block_C64A },
+    { 0xC655, 0xC65F, 0x5F2AFC20FA3F2C79ull, &Block_C655 },
+    { 0xC660, 0xC66A, 0x949274DF63E37220ull, &Block_C660 },
+    { 0xC66B, 0xC66D, 0x59F95943862189E8ull, &Block_C66B },
+    { 0xC66E, 0xC66E, 0xC7DFAFCE5338CA47ull, &Block_C66E },
+    { 0xC66F, 0xC688, 0x15AFA255E2070313ull, &Block_C66F },
+    { 0xC689, 0xC6A2, 0xC1028F1D25D04CBAull, &Block_C689 },
+    { 0xC6A3, 0xC6AB, 0x2DD9B75F9EC51913ull, &Block_C6A3 },
+    { 0xC6AC, 0xC6AE, 0x1FB2083F992AFB21ull, &Block_C6AC },
+    { 0xC6AF, 0xC6AF, 0xC7DFAFCE5338CA47ull, &Block_C6AF },
+    { 0xC6B0, 0xC6B6, 0xC8EB530CCBE02EE3ull, &Block_C6B0 },
+    { 0xC6B7, 0xC6BB, 0xAF9DD822203673F0ull, &Block_C6B7 },
+    { 0xC6BC, 0xC6BC, 0xC42CEF3B5A968BC5ull, &Block_C6BC },
+    { 0xC72D, 0xC734, 0x17FFBC6C9B7131B5ull, &Block_C72D },
+    { 0xC735, 0xC73B, 0xB51AC0F6C35B502Bull, &Block_C735 },
+    { 0xC73C, 0xC73F, 0xCF135133522865C1ull, &Block_C73C },
+    { 0xC740, 0xC746, 0x30F9762A763AC3E2ull, &Block_C740 },
+    { 0xC747, 0xC74A, 0xBC7CBC566E517D69ull, &Block_C747 },
+    { 0xC74B, 0xC752, 0x4790C1DE82B3085Bull, &Block_C74B },
+    { 0xC753, 0xC75B, 0x9F3BF7673D69229Aull, &Block_C753 },
+    { 0xC75C, 0xC763, 0xE1A2C308307BA575ull, &Block_C75C },
+    { 0xC764, 0xC767, 0xAFC1CA2378BF7E39ull, &Block_C764 },
+    { 0xC768, 0xC770, 0x43EDCF1FEE9FCCD8ull, &Block_C768 },
+    { 0xC771, 0xC778, 0x30189907D45D6BD4ull, &Block_C771 },
+    { 0xC779, 0xC77C, 0xACC20B37F0B883FAull, &Block_C779 },
+    { 0xC77D, 0xC789, 0xEA28AEEC6B53BE97ull, &Block_C77D },
+    { 0xC78A, 0xC791, 0x3D98E76781D4D28Full, &Block_C78A },
+    { 0xC792, 0xC795, 0x0BAE52320D186C52ull, &Block_C792 },
+    { 0xC796, 0xC7A2, 0x993FCB9A75B9ADAFull, &Block_C796 },
+    { 0xC7A3, 0xC7AA, 0xB90C64FE24843161ull, &Block_C7A3 },
+    { 0xC7AB, 0xC7AE, 0x9F0F292F43C972F5ull, &Block_C7AB },
+    { 0xC7AF, 0xC7B7, 0xC03CA4815348BA31ull, &Block_C7AF },
+    { 0xC7B8, 0xC7BF, 0x3273064540C49752ull, &Block_C7B8 },
+    { 0xC7C0, 0xC7CC, 0x37B8B7023572D584ull, &Block_C7C0 },
+    { 0xC7CD, 0xC7D4, 0x10ABFB1880DC46B6ull, &Block_C7CD },
+    { 0xC7D5, 0xC7D8, 0x3CF9C8430A404AC0ull, &Block_C7D5 },
+    { 0xC7D9, 0xC7DA, 0x1F291F0D571BBBEEull, &Block_C7D9 },
+    { 0xC7DB, 0xC7F2, 0x9487A16BF6914945ull, &Block_C7DB },
+    { 0xC7F3, 0xC809, 0x4C801175151CC2ACull, &Block_C7F3 },
+    { 0xC80A, 0xC820, 0xFE8768F369AB2031ull, &Block_C80A },
+    { 0xC821, 0xC830, 0x6DED0327CAD03817ull, &Block_C821 },
+    { 0xC831, 0xC834, 0xA60DC1A4BED833C4ull, &Block_C831 },
+    { 0xC835, 0xC844, 0xCD84A1DC760D5766ull, &Block_C835 },
+    { 0xC845, 0xC848, 0x573146A76A1FD6A4ull, &Block_C845 },
+    { 0xC849, 0xC862, 0xAFA8E5AEDB1E08E5ull, &Block_C849 },
+    { 0xC863, 0xC866, 0xF6CF082BA9A5B3D2ull, &Block_C863 },
+    { 0xC867, 0xC87F, 0xCE845D2FBD19809Bull, &Block_C867 },
+    { 0xC880, 0xC883, 0x3ED6486EE378AAC3ull, &Block_C880 },
+    { 0xC884, 0xC884, 0xC7DFAFCE5338CA47ull, &Block_C884 },
+    { 0xC885, 0xC89D, 0x81DD1A71FC5BF4BAull, &Block_C885 },
+    { 0xC89E, 0xC8A1, 0x34ADD5E5C9931254ull, &Block_C89E },
+    { 0xC8A2, 0xC8B3, 0x2A82C79AA7AB8C20ull, &Block_C8A2 },
+    { 0xC8B4, 0xC8B7, 0xE2927CF23047DF1Aull, &Block_C8B4 },
+    { 0xC8B8, 0xC8CA, 0xFAE7E503BB1C86C3ull, &Block_C8B8 },
+    { 0xC8CB, 0xC8CE, 0x2E4E816B09B5A4EDull, &Block_C8CB },
+    { 0xC8CF, 0xC8E2, 0x7F085C279F98C48Full, &Block_C8CF },
+    { 0xC8E3, 0xC8E6, 0xAEDEF95EC732D599ull, &Block_C8E3 },
+    { 0xC8E7, 0xC8FB, 0x81160E595593A274ull, &Block_C8E7 },
+    { 0xC8FC, 0xC8FF, 0x2A7FED64FFC434BBull, &Block_C8FC },
+    { 0xC900, 0xC911, 0x93035A855C5F0D7Cull, &Block_C900 },
+    { 0xC912, 0xC915, 0x5B5AB20BFBE1D6A3ull, &Block_C912 },
+    { 0xC916, 0xC92A, 0x14225932B78F836Full, &Block_C916 },
+    { 0xC92B, 0xC92E, 0x4DF8C252A7862F32ull, &Block_C92B },
+    { 0xC92F, 0xC944, 0x4EDB209C39B8D92Eull, &Block_C92F },
+    { 0xC945, 0xC948, 0xF8789B0A6B9C5112ull, &Block_C945 },
+    { 0xC949, 0xC95D, 0x43672523A309A007ull, &Block_C949 },
+    { 0xC95E, 0xC961, 0x50123BDA08DC54B1ull, &Block_C95E },
+    { 0xC962, 0xC976, 0x6B2DDD1D932CBA40ull, &Block_C962 },
+    { 0xC977, 0xC97A, 0x0492CDFFB2387E20ull, &Block_C977 },
+    { 0xC97B, 0xC98C, 0x2FB6E3CFAF8C2C4Bull, &Block_C97B },
+    { 0xC98D, 0xC990, 0x1D7048DF730739EBull, &Block_C98D },
+    { 0xC991, 0xC9A0, 0x376137F7F893E779ull, &Block_C991 },
+    { 0xC9A1, 0xC9A4, 0x4C103502AAE566FCull, &Block_C9A1 },
+    { 0xC9A5, 0xC9B5, 0x4DFBBA1DF2E91B51ull, &Block_C9A5 },
+    { 0xC9B6, 0xC9B9, 0x4C103502AAE566FCull, &Block_C9B6 },
+    { 0xC9BA, 0xC9CB, 0x46E33A395CF5AD8Full, &Block_C9BA },
+    { 0xC9CC, 0xC9CF, 0xF7B3232D035BEB81ull, &Block_C9CC },
+    { 0xC9D0, 0xC9DE, 0x78B8FF95F36110DAull, &Block_C9D0 },
+    { 0xC9DF, 0xC9E2, 0x668927432AC1FBD2ull, &Block_C9DF },
+    { 0xC9E3, 0xC9EE, 0x74C0C93892805941ull, &Block_C9E3 },
+    { 0xC9EF, 0xC9F2, 0xD4AE378740256269ull, &Block_C9EF },
+    { 0xC9F3, 0xCA00, 0x304C771D25C6AB06ull, &Block_C9F3 },
+    { 0xCA01, 0xCA04, 0xE02B50CD6A3EEDE5ull, &Block_CA01 },
+    { 0xCA05, 0xCA10, 0x25069F997E409CEDull, &Block_CA05 },
+    { 0xCA11, 0xCA14, 0xBF8F5CD7BDB85ADEull, &Block_CA11 },
+    { 0xCA15, 0xCA20, 0xACAE17712F23027Bull, &Block_CA15 },
+    { 0xCA21, 0xCA24, 0x5603F7AD30FDADA1ull, &Block_CA21 },
+    { 0xCA25, 0xCA30, 0x75BEAB44130F35F4ull, &Block_CA25 },
+    { 0xCA31, 0xCA34, 0xCF56CD878B250490ull, &Block_CA31 },
+    { 0xCA35, 0xCA46, 0x8A64B3D375F37976ull, &Block_CA35 },
+    { 0xCA47, 0xCA4A, 0xF25DB54112390A8Bull, &Block_CA47 },
+    { 0xCA4B, 0xCA59, 0xB36B1CE97430C03Aull, &Block_CA4B },
+    { 0xCA5A, 0xCA5D, 0xBBA84C57D2E4483Aull, &Block_CA5A },
+    { 0xCA5E, 0xCA69, 0x0753129ABEFBB1FCull, &Block_CA5E },
+    { 0xCA6A, 0xCA6D, 0x2888117A9B410040ull, &Block_CA6A },
+    { 0xCA6E, 0xCA7B, 0x052CE779B5F7FE2Eull, &Block_CA6E },
+    { 0xCA7C, 0xCA7F, 0x34CF01D842A5A084ull, &Block_CA7C },
+    { 0xCA80, 0xCA8B, 0xE7442391C11F9EEDull, &Block_CA80 },
+    { 0xCA8C, 0xCA8F, 0x7B6993E56CB2EF1Dull, &Block_CA8C },
+    { 0xCA90, 0xCA9B, 0x4F7DC13EAF51EC86ull, &Block_CA90 },
+    { 0xCA9C, 0xCA9F, 0xABDD59448CE5D20Eull, &Block_CA9C },
+    { 0xCAA0, 0xCAAB, 0x31E9CA6D9E454F7Eull, &Block_CAA0 },
+    { 0xCAAC, 0xCAAF, 0xE09C7D30982E12C2ull, &Block_CAAC },
+    { 0xCAB0, 0xCAC1, 0x373613569DF960CBull, &Block_CAB0 },
+    { 0xCAC2, 0xCAC5, 0x466B0142B93F9808ull, &Block_CAC2 },
+    { 0xCAC6, 0xCAD4, 0xF13D3E1F5EFD9767ull, &Block_CAC6 },
+    { 0xCAD5, 0xCAD8, 0x6186EAAE069489F2ull, &Block_CAD5 },
+    { 0xCAD9, 0xCAE4, 0x2D1124D424E52A9Bull, &Block_CAD9 },
+    { 0xCAE5, 0xCAE8, 0xE3668A1AD4B2DCA7ull, &Block_CAE5 },
+    { 0xCAE9, 0xCAF6, 0x18B465CDE2148223ull, &Block_CAE9 },
+    { 0xCAF7, 0xCAFA, 0x5E32A68AB18049A6ull, &Block_CAF7 },
+    { 0xCAFB, 0xCB06, 0x21AC52A878AA2B39ull, &Block_CAFB },
+    { 0xCB07, 0xCB0A, 0xF003DD26EAE83A07ull, &Block_CB07 },
+    { 0xCB0B, 0xCB16, 0xE9C275D43C89165Full, &Block_CB0B },
+    { 0xCB17, 0xCB1A, 0x0246F56E81512430ull, &Block_CB17 },
+    { 0xCB1B, 0xCB26, 0xBC2D3B9135EF5414ull, &Block_CB1B },
+    { 0xCB27, 0xCB2A, 0xB3CDA1614A380FDFull, &Block_CB27 },
+    { 0xCB2B, 0xCB3A, 0x259210014BB9B282ull, &Block_CB2B },
+    { 0xCB3B, 0xCB3E, 0x0F6B7901CDEC3945ull, &Block_CB3B },
+    { 0xCB3F, 0xCB4F, 0xB0C29EFF071EEB2Dull, &Block_CB3F },
+    { 0xCB50, 0xCB53, 0x2BC19FCE512BD8FAull, &Block_CB50 },
+    { 0xCB54, 0xCB63, 0xAE3E9FC0F5509A84ull, &Block_CB54 },
+    { 0xCB64, 0xCB67, 0x3431DF9358969ABFull, &Block_CB64 },
+    { 0xCB68, 0xCB78, 0x0F7FE8C91556119Bull, &Block_CB68 },
+    { 0xCB79, 0xCB7C, 0xDAE1575D9B5F9933ull, &Block_CB79 },
+    { 0xCB7D, 0xCBAA, 0xE811C2C1C5D599FAull, &Block_CB7D },
+    { 0xCBAB, 0xCBAE, 0x650B452B30E8F4F2ull, &Block_CBAB },
+    { 0xCBAF, 0xCBB3, 0x7DEDE9D91C38902Eull, &Block_CBAF },
+    { 0xCBB4, 0xCBB8, 0x85C9E7412870DF4Cull, &Block_CBB4 },
+    { 0xCBB9, 0xCBBC, 0x615B36550D539EC3ull, &Block_CBB9 },
+    { 0xCBBD, 0xCBC1, 0x053027481C6D29D1ull, &Block_CBBD },
+    { 0xCBC2, 0xCBC5, 0x4BEB7F01BE6C3B9Bull, &Block_CBC2 },
+    { 0xCBC6, 0xCBCA, 0xF956F0270CBFB3A6ull, &Block_CBC6 },
+    { 0xCBCB, 0xCBCE, 0x0B4998E9E8AB5957ull, &Block_CBCB },
+    { 0xCBCF, 0xCBD3, 0x950848C29408EA55ull, &Block_CBCF },
+    { 0xCBD4, 0xCBD7, 0x809B967ED0CD6F83ull, &Block_CBD4 },
+    { 0xCBD8, 0xCBDC, 0x0DC61E3C96E31FCBull, &Block_CBD8 },
+    { 0xCBDD, 0xCBDD, 0xC7DFAFCE5338CA47ull, &Block_CBDD },
+    { 0xCBDE, 0xCC0F, 0x3F3BF90264AA4254ull, &Block_CBDE },
+    { 0xCC10, 0xCC13, 0xC3E97AAAB9FF00B7ull, &Block_CC10 },
+    { 0xCC14, 0xCC5D, 0xD19BABE620DEC516ull, &Block_CC14 },
+    { 0xCC5E, 0xCC61, 0xB56E1D691923E077ull, &Block_CC5E },
+    { 0xCC62, 0xCCAB, 0x9545847F68388F62ull, &Block_CC62 },
+    { 0xCCAC, 0xCCAF, 0x6D21BF3A519B8C7Dull, &Block_CCAC },
+    { 0xCCB0, 0xCCEA, 0xA0E07CF501DB22B8ull, &Block_CCB0 },
+    { 0xCCEB, 0xCCEE, 0xCAC71D1F6801CDD6ull, &Block_CCEB },
+    { 0xCCEF, 0xCD29, 0x5CB489987E369A95ull, &Block_CCEF },
+    { 0xCD2A, 0xCD2D, 0xA22331A18986B4BDull, &Block_CD2A },
+    { 0xCD2E, 0xCD68, 0xB634C6D2AE351BFBull, &Block_CD2E },
+    { 0xCD69, 0xCD6C, 0xCCEDEC6448D355ACull, &Block_CD69 },
+    { 0xCD6D, 0xCDA7, 0x025696464393D108ull, &Block_CD6D },
+    { 0xCDA8, 0xCDAB, 0xA194C56E004FBC20ull, &Block_CDA8 },
+    { 0xCDAC, 0xCDEE, 0x64BE97BC338DBBBFull, &Block_CDAC },
+    { 0xCDEF, 0xCDF2, 0x6417F9C432353A2Cull, &Block_CDEF },
+    { 0xCDF3, 0xCDF7, 0x8BDDC1421D74E483ull, &Block_CDF3 },
+    { 0xCDF8, 0xCE2E, 0x69B1A0581FDF2908ull, &Block_CDF8 },
+    { 0xCE2F, 0xCE32, 0x3E626C09E7452C3Dull, &Block_CE2F },
+    { 0xCE33, 0xCE39, 0x1313DFF8867E6216ull, &Block_CE33 },
+    { 0xCE3A, 0xCE3C, 0x0A923CA54B6BFFCAull, &Block_CE3A },
+    { 0xCE3D, 0xCE4D, 0x07F56D3F69D71967ull, &Block_CE3D },
+    { 0xCE4E, 0xCE5A, 0x69C1D9088FDCAF9Full, &Block_CE4E },
+    { 0xCE5B, 0xCE5E, 0x3FDE743D4120CAFBull, &Block_CE5B },
+    { 0xCE5F, 0xCE66, 0x8C16B2DDED101F8Eull, &Block_CE5F },
+    { 0xCEEE, 0xCF1B, 0xA070096C5F057379ull, &Block_CEEE },
+    { 0xCF1C, 0xCF1F, 0xE22DCD8424F1BFB9ull, &Block_CF1C },
+    { 0xCF20, 0xCF46, 0xAC7416772EC19849ull, &Block_CF20 },
+    { 0xCF47, 0xCF4A, 0xDFAB39C48DD8265Eull, &Block_CF47 },
+    { 0xCF4B, 0xCF71, 0xAFB3F145321B1861ull, &Block_CF4B },
+    { 0xCF72, 0xCF75, 0xB9736F0BA05404F8ull, &Block_CF72 },
+    { 0xCF76, 0xCF9C, 0xCB7742C026CFB04Full, &Block_CF76 },
+    { 0xCF9D, 0xCFA0, 0x74E6C1B81FB0C606ull, &Block_CF9D },
+    { 0xCFA1, 0xCFA1, 0xC7DFAFCE5338CA47ull, &Block_CFA1 },
+    { 0xCFA2, 0xCFFF, 0x60B65980CC9C5B12ull, &Block_CFA2 },
+    { 0xD000, 0xD004, 0x2E7985A5BB5DDC8Cull, &Block_D000 },
+    { 0xD005, 0xD037, 0x8BDF758DE426C4BEull, &Block_D005 },
+    { 0xD038, 0xD03C, 0xA74E078965A7914Aull, &Block_D038 },
+    { 0xD03D, 0xD052, 0x521D0E2FF2B7D7F7ull, &Block_D03D },
+    { 0xD053, 0xD057, 0x28CFA9D25F451253ull, &Block_D053 },
+    { 0xD058, 0xD05B, 0xBA9D08A8280A710Bull, &Block_D058 },
+    { 0xD05C, 0xD060, 0x579C063A6C648526ull, &Block_D05C },
+    { 0xD061, 0xD064, 0x2F62D1D0ECB46F90ull, &Block_D061 },
+    { 0xD065, 0xD069, 0x2D5BF9204DB01287ull, &Block_D065 },
+    { 0xD06A, 0xD072, 0xF2474F704577E86Full, &Block_D06A },
+    { 0xD073, 0xD077, 0x1EACDC0726BD8175ull, &Block_D073 },
+    { 0xD078, 0xD07B, 0x604D8E95A81BFB51ull, &Block_D078 },
+    { 0xD07C, 0xD080, 0x6C95A3821CCBA34Full, &Block_D07C },
+    { 0xD081, 0xD089, 0x2BED69F61B13E0CDull, &Block_D081 },
+    { 0xD08A, 0xD08E, 0xF64BB3F28E4FC0F8ull, &Block_D08A },
+    { 0xD08F, 0xD097, 0x48A79FD07D6D0A84ull, &Block_D08F },
+    { 0xD098, 0xD09C, 0x56CEA40E40AE88C2ull, &Block_D098 },
+    { 0xD09D, 0xD0A0, 0xB0E0C6FDF1A3AA47ull, &Block_D09D },
+    { 0xD0A1, 0xD0A5, 0x01365579C04E1512ull, &Block_D0A1 },
+    { 0xD0A6, 0xD0AE, 0xD8D2FC0606F47733ull, &Block_D0A6 },
+    { 0xD0AF, 0xD0B3, 0xE0D06C1039566C45ull, &Block_D0AF },
+    { 0xD0B4, 0xD0BC, 0xC837BDA47FDA3DD8ull, &Block_D0B4 },
+    { 0xD0BD, 0xD0C1, 0xAF0963D798261C23ull, &Block_D0BD },
+    { 0xD0C2, 0xD0C5, 0xC390538EA4B608EFull, &Block_D0C2 },
+    { 0xD0C6, 0xD0CA, 0x52430C925CF248FDull, &Block_D0C6 },
+    { 0xD0CB, 0xD0D3, 0x2D0A6AE19719A808ull, &Block_D0CB },
+    { 0xD0D4, 0xD0D8, 0x6521F2B276E4C331ull, &Block_D0D4 },
+    { 0xD0D9, 0xD0E3, 0xE89F9D0ADD6B3A04ull, &Block_D0D9 },
+    { 0xD0E4, 0xD0E8, 0x8B8150FDDFD41CA9ull, &Block_D0E4 },
+    { 0xD0E9, 0xD0F5, 0xE51B0F2BCB9A6E18ull, &Block_D0E9 },
+    { 0xD0F6, 0xD100, 0xCD05C92C712C4906ull, &Block_D0F6 },
+    { 0xD101, 0xD105, 0x6C2DA53D786425B1ull, &Block_D101 },
+    { 0xD106, 0xD112, 0x6A51383B257513A1ull, &Block_D106 },
+    { 0xD113, 0xD11F, 0x0E0BD1B84764FD46ull, &Block_D113 },
+    { 0xD120, 0xD12C, 0x2AEA94DE085012CFull, &Block_D120 },
+    { 0xD12D, 0xD135, 0x2054CA5E2287AA88ull, &Block_D12D },
+    { 0xD136, 0xD13A, 0xBA95EDEB6E333D5Dull, &Block_D136 },
+    { 0xD13B, 0xD143, 0xE69008ECB725D665ull, &Block_D13B },
+    { 0xD144, 0xD148, 0x24EE29FEA2292402ull, &Block_D144 },
+    { 0xD149, 0xD151, 0x6E0CC33BDA08BFA0ull, &Block_D149 },
+    { 0xD152, 0xD156, 0x195ED58AB960E122ull, &Block_D152 },
+    { 0xD157, 0xD15F, 0xF2B79403625EAC2Full, &Block_D157 },
+    { 0xD160, 0xD164, 0x6A9DA34392FFF386ull, &Block_D160 },
+    { 0xD165, 0xD16D, 0xC4ADFBFDFD1817A7ull, &Block_D165 },
+    { 0xD16E, 0xD172, 0x34A63F58F70E8226ull, &Block_D16E },
+    { 0xD173, 0xD173, 0xC7DFAFCE5338CA47ull, &Block_D173 },
+    { 0xD174, 0xD197, 0x7DD031E5F740AD8Full, &Block_D174 },
+    { 0xD198, 0xD19B, 0xD0234A9B056E86EEull, &Block_D198 },
+    { 0xD19C, 0xD1AD, 0xF6237AB07D7F3DB5ull, &Block_D19C },
+    { 0xD1AE, 0xD1B1, 0xB73BC2C65666C2E7ull, &Block_D1AE },
+    { 0xD1B2, 0xD1D1, 0xA07DB0BB3482E545ull, &Block_D1B2 },
+    { 0xD1D2, 0xD1D5, 0x0FD088C26CE8FAEDull, &Block_D1D2 },
+    { 0xD1D6, 0xD1E7, 0xA0DAD5A2DF30B4ECull, &Block_D1D6 },
+    { 0xD1E8, 0xD1EB, 0x9ECE82B38D4FE266ull, &Block_D1E8 },
+    { 0xD1EC, 0xD20B, 0xB93161A02DD4B935ull, &Block_D1EC },
+    { 0xD20C, 0xD20F, 0x6D5D12DC963603CAull, &Block_D20C },
+    { 0xD210, 0xD221, 0xC93F3F0E7F0D430Cull, &Block_D210 },
+    { 0xD222, 0xD225, 0x9E86486EC775483Bull, &Block_D222 },
+    { 0xD226, 0xD243, 0x0CA9B6FB5516A2A8ull, &Block_D226 },
+    { 0xD244, 0xD247, 0x46CC788D98529A23ull, &Block_D244 },
+    { 0xD248, 0xD259, 0x0BE00B637FF3BB2Bull, &Block_D248 },
+    { 0xD25A, 0xD25D, 0x2C805E7CDE499656ull, &Block_D25A },
+    { 0xD25E, 0xD266, 0xC8027E6D8D86F0B8ull, &Block_D25E },
+    { 0xD267, 0xD26B, 0x744C1CC1C8DDA200ull, &Block_D267 },
+    { 0xD26C, 0xD273, 0x9C7389054321FA1Bull, &Block_D26C },
+    { 0xD274, 0xD278, 0x942936CAA9D167DAull, &Block_D274 },
+    { 0xD279, 0xD280, 0x393726A63F19FC3Cull, &Block_D279 },
+    { 0xD281, 0xD285, 0x726604E133DEB927ull, &Block_D281 },
+    { 0xD286, 0xD28D, 0x8343CEECACF1451Aull, &Block_D286 },
+    { 0xD28E, 0xD292, 0x718864F78A7BDC5Full, &Block_D28E },
+    { 0xD293, 0xD29A, 0x1AC99DA13DB5F7C6ull, &Block_D293 },
+    { 0xD29B, 0xD29F, 0x225A5B2096C7FEE4ull, &Block_D29B },
+    { 0xD2A0, 0xD2A7, 0x23C4C63616E8C246ull, &Block_D2A0 },
+    { 0xD2A8, 0xD2AC, 0x40D1A5F076119DD6ull, &Block_D2A8 },
+    { 0xD2AD, 0xD2B4, 0x2647A2DE8A130B6Aull, &Block_D2AD },
+    { 0xD2B5, 0xD2B9, 0xE501008F9A02A8D5ull, &Block_D2B5 },
+    { 0xD2BA, 0xD2BD, 0xB0E0C6FDF1A3AA47ull, &Block_D2BA },
+    { 0xD2BE, 0xD2C2, 0xF36F5A157FBC5703ull, &Block_D2BE },
+    { 0xD2C3, 0xD2CA, 0xBA9AA5BD37BE5A4Dull, &Block_D2C3 },
+    { 0xD2CB, 0xD2CF, 0x53720D675AC84133ull, &Block_D2CB },
+    { 0xD2D0, 0xD2D7, 0xAF9914CB019C1B99ull, &Block_D2D0 },
+    { 0xD2D8, 0xD2DC, 0xBE1F70D91066E2BCull, &Block_D2D8 },
+    { 0xD2DD, 0xD2E0, 0xC390538EA4B608EFull, &Block_D2DD },
+    { 0xD2E1, 0xD2E5, 0x4D0C9A6FAC8C41C6ull, &Block_D2E1 },
+    { 0xD2E6, 0xD2ED, 0xE304E105BB5DFA7Full, &Block_D2E6 },
+    { 0xD2EE, 0xD2F2, 0xCE8A192A0126F12Full, &Block_D2EE },
+    { 0xD2F3, 0xD2FC, 0x707B017E6FCCAACBull, &Block_D2F3 },
+    { 0xD2FD, 0xD301, 0x9038782D53CBAAAAull, &Block_D2FD },
+    { 0xD302, 0xD30D, 0xBA1CC763D4A2E71Bull, &Block_D302 },
+    { 0xD30E, 0xD317, 0x40493327036F7EAAull, &Block_D30E },
+    { 0xD318, 0xD31C, 0x03A003DCBC9D9F99ull, &Block_D318 },
+    { 0xD31D, 0xD328, 0xF43328A389120A4Dull, &Block_D31D },
+    { 0xD329, 0xD334, 0x116DC33ABCE95957ull, &Block_D329 },
+    { 0xD335, 0xD340, 0x97CA48B62EFDAE1Aull, &Block_D335 },
+    { 0xD341, 0xD348, 0x6DA4CEBB09154EE9ull, &Block_D341 },
+    { 0xD349, 0xD34D, 0xCFA077431196B0ABull, &Block_D349 },
+    { 0xD34E, 0xD355, 0x2989D825F22F8AB2ull, &Block_D34E },
+    { 0xD356, 0xD35A, 0xDD981F5A49324EF6ull, &Block_D356 },
+    { 0xD35B, 0xD362, 0x349E90C23CE40027ull, &Block_D35B },
+    { 0xD363, 0xD367, 0xD28CC5260A7FF504ull, &Block_D363 },
+    { 0xD368, 0xD36F, 0x53B0E96515080CA4ull, &Block_D368 },
+    { 0xD370, 0xD374, 0x6C7C9BDA8E3183F4ull, &Block_D370 },
+    { 0xD375, 0xD37C, 0xB36F679F09B0CFA4ull, &Block_D375 },
+    { 0xD37D, 0xD381, 0xD3D4961E936351C1ull, &Block_D37D },
+    { 0xD382, 0xD389, 0xE304E105BB5DFA7Full, &Block_D382 },
+    { 0xD38A, 0xD38F, 0x9D17338EB17FA843ull, &Block_D38A },
+    { 0xD390, 0xD397, 0x539FA0A4D16983BDull, &Block_D390 },
+    { 0xD398, 0xD39C, 0xC228A2609B860F17ull, &Block_D398 },
+    { 0xD39D, 0xD3A6, 0xF8CE2B71AA89676Full, &Block_D39D },
+    { 0xD3A7, 0xD3AE, 0x00CF5C69F0D692E1ull, &Block_D3A7 },
+    { 0xD3AF, 0xD3B4, 0x9EFF37A480412C6Dull, &Block_D3AF },
+    { 0xD3B5, 0xD3BE, 0x1D696416CCD500A3ull, &Block_D3B5 },
+    { 0xD3BF, 0xD3C8, 0x492EC63CE9809E30ull, &Block_D3BF },
+    { 0xD3C9, 0xD3D2, 0x16B590CA54E91EF9ull, &Block_D3C9 },
+    { 0xD3D3, 0xD3DC, 0x4E55D1D45BAB583Full, &Block_D3D3 },
+    { 0xD3DD, 0xD3E1, 0xAE516E8B8F2140A5ull, &Block_D3DD },
+    { 0xD3E2, 0xD3E9, 0xF8CD135B62F108BEull, &Block_D3E2 },
+    { 0xD3EA, 0xD3EE, 0xB1F26810EC1B32C2ull, &Block_D3EA },
+    { 0xD3EF, 0xD3F8, 0x00049D862F74A6EEull, &Block_D3EF },
+    { 0xD3F9, 0xD400, 0xE5E787855F6204C4ull, &Block_D3F9 },
+    { 0xD401, 0xD405, 0xC05CA1AE7585B9A6ull, &Block_D401 },
+    { 0xD406, 0xD40F, 0xF57D9EE4346A9CC3ull, &Block_D406 },
+    { 0xD410, 0xD419, 0xD3D37396FC3133EEull, &Block_D410 },
+    { 0xD41A, 0xD423, 0x3557FA7CE8EC163Dull, &Block_D41A },
+    { 0xD424, 0xD429, 0x0A7FE4D59EA9643Eull, &Block_D424 },
+    { 0xD42A, 0xD432, 0x2078CAF37BE52CA5ull, &Block_D42A },
+    { 0xD433, 0xD43C, 0x6D674C2C62F99863ull, &Block_D433 },
+    { 0xD43D, 0xD440, 0xE3D95376C95ADFB6ull, &Block_D43D },
+    { 0xD441, 0xD449, 0x92FF69AD5070FA31ull, &Block_D441 },
+    { 0xD44A, 0xD453, 0xFAA3462A1F8E8B4Dull, &Block_D44A },
+    { 0xD454, 0xD457, 0x4C3958DEF9F6035Dull, &Block_D454 },
+    { 0xD458, 0xD460, 0x330CACC7445A80B5ull, &Block_D458 },
+    { 0xD461, 0xD46A, 0x09F04C07386661DEull, &Block_D461 },
+    { 0xD46B, 0xD46E, 0x9B5D62A6C121C8C6ull, &Block_D46B },
+    { 0xD46F, 0xD477, 0x3DFEC8A7256E2048ull, &Block_D46F },
+    { 0xD478, 0xD481, 0xB273230F343998E4ull, &Block_D478 },
+    { 0xD482, 0xD49A, 0xB54D41B354D626C8ull, &Block_D482 },
+    { 0xD49B, 0xD49E, 0x009525C9BBFCAAB6ull, &Block_D49B },
+    { 0xD49F, 0xD4B4, 0x1DDFB6243CE2E84Eull, &Block_D49F },
+    { 0xD4B5, 0xD4B8, 0x0BC5DA1254B7AE82ull, &Block_D4B5 },
+    { 0xD4B9, 0xD4CF, 0x7D3C4A366B569D58ull, &Block_D4B9 },
+    { 0xD4D0, 0xD4D3, 0x562D9C431DD675B5ull, &Block_D4D0 },
+    { 0xD4D4, 0xD4E9, 0xCCAC180CA17C16C5ull, &Block_D4D4 },
+    { 0xD4EA, 0xD4ED, 0x8713B5E8E58B2015ull, &Block_D4EA },
+    { 0xD4EE, 0xD4F9, 0x233AF95D5E9DA5B3ull, &Block_D4EE },
+    { 0xD4FA, 0xD4FA, 0xC7DFAFCE5338CA47ull, &Block_D4FA },
+    { 0xD4FB, 0xD520, 0x6E47E834FCA60A34ull, &Block_D4FB },
+    { 0xD521, 0xD524, 0x54A12A80E4CD336Full, &Block_D521 },
+    { 0xD525, 0xD538, 0x6FCBE6EE2728DCBFull, &Block_D525 },
+    { 0xD539, 0xD53C, 0x8AF12ABE48213216ull, &Block_D539 },
+    { 0xD53D, 0xD55E, 0x5DD47A85F9FD3438ull, &Block_D53D },
+    { 0xD55F, 0xD562, 0xAEF60213E2F00C1Bull, &Block_D55F },
+    { 0xD563, 0xD576, 0x8691EB31D3ED5F5Cull, &Block_D563 },
+    { 0xD577, 0xD57A, 0x670E33CCC0FC6C1Bull, &Block_D577 },
+    { 0xD57B, 0xD59C, 0x11BF6D92EBB1E890ull, &Block_D57B },
+    { 0xD59D, 0xD5A0, 0x41B3B2BAECD01E12ull, &Block_D59D },
+    { 0xD5A1, 0xD5B4, 0xFE771F194412D2BFull, &Block_D5A1 },
+    { 0xD5B5, 0xD5B8, 0x7E87A6D7C5FDA4EAull, &Block_D5B5 },
+    { 0xD5B9, 0xD5D8, 0xFC505682F0E27505ull, &Block_D5B9 },
+    { 0xD5D9, 0xD5DC, 0x0DDEAEAE93BA5DCAull, &Block_D5D9 },
+    { 0xD5DD, 0xD5F0, 0x5C5C4BD93673B594ull, &Block_D5DD },
+    { 0xD5F1, 0xD5F4, 0x34FA6F9D762F7D5Dull, &Block_D5F1 },
+    { 0xD5F5, 0xD5FE, 0x99097B2B79830D9Cull, &Block_D5F5 },
+    { 0xD5FF, 0xD604, 0xCFE02AB9FC9E89E8ull, &Block_D5FF },
+    { 0xD605, 0xD60D, 0xF93B841BFF5D5E1Eull, &Block_D605 },
+    { 0xD60E, 0xD613, 0xFF518AA15FB2755Bull, &Block_D60E },
+    { 0xD614, 0xD61C, 0x1726599BF88D25E9ull, &Block_D614 },
+    { 0xD61D, 0xD622, 0xF62DAFBBD7163438ull, &Block_D61D },
+    { 0xD623, 0xD62B, 0x17217A497210A186ull, &Block_D623 },
+    { 0xD62C, 0xD631, 0xFBBA3F573A7BED7Eull, &Block_D62C },
+    { 0xD632, 0xD63A, 0x3A40D4138A9E3AFCull, &Block_D632 },
+    { 0xD63B, 0xD640, 0x8D9EE834AD3927D9ull, &Block_D63B },
+    { 0xD641, 0xD649, 0x7AA474E6949B3A41ull, &Block_D641 },
+    { 0xD64A, 0xD64F, 0x288E276FEA0E3984ull, &Block_D64A },
+    { 0xD650, 0xD658, 0x344D47F1D35F0B7Eull, &Block_D650 },
+    { 0xD659, 0xD65E, 0x879C48D16388E44Dull, &Block_D659 },
+    { 0xD65F, 0xD662, 0xB0E0C6FDF1A3AA47ull, &Block_D65F },
+    { 0xD663, 0xD668, 0x665F1AD33EE00E6Full, &Block_D663 },
+    { 0xD669, 0xD671, 0xDA6BAF22CA42D203ull, &Block_D669 },
+    { 0xD672, 0xD677, 0x0B8B42D1C95E508Cull, &Block_D672 },
+    { 0xD678, 0xD680, 0xC9E927D73E59E288ull, &Block_D678 },
+    { 0xD681, 0xD686, 0x728EB0827D4DDD98ull, &Block_D681 },
+    { 0xD687, 0xD68A, 0xC390538EA4B608EFull, &Block_D687 },
+    { 0xD68B, 0xD690, 0xADF59F33C03A7ACCull, &Block_D68B },
+    { 0xD691, 0xD699, 0x756D4E64308EA35Cull, &Block_D691 },
+    { 0xD69A, 0xD69F, 0x922338698FC34D9Cull, &Block_D69A },
+    { 0xD6A0, 0xD6AA, 0xEA8CDCAE1D56AFE4ull, &Block_D6A0 },
+    { 0xD6AB, 0xD6B0, 0xE983D642B2FF2C9Aull, &Block_D6AB },
+    { 0xD6B1, 0xD6BE, 0x7CC2D020E6E60753ull, &Block_D6B1 },
+    { 0xD6BF, 0xD6C9, 0x8752980CEA48DE88ull, &Block_D6BF },
+    { 0xD6CA, 0xD6CF, 0x069C7363D944BA19ull, &Block_D6CA },
+    { 0xD6D0, 0xD6DD, 0x9D885160C37D3052ull, &Block_D6D0 },
+    { 0xD6DE, 0xD6EB, 0x997A956EC5185DF5ull, &Block_D6DE },
+    { 0xD6EC, 0xD6F9, 0xC5B04C6510A4933Eull, &Block_D6EC },
+    { 0xD6FA, 0xD702, 0xC4EFD61501AE9944ull, &Block_D6FA },
+    { 0xD703, 0xD708, 0xF9B4C5BF72022C90ull, &Block_D703 },
+    { 0xD709, 0xD711, 0x92D92D805310B07Eull, &Block_D709 },
+    { 0xD712, 0xD717, 0x501BD08D5BF1F645ull, &Block_D712 },
+    { 0xD718, 0xD720, 0xE07BD99EED7B6B3Cull, &Block_D718 },
+    { 0xD721, 0xD726, 0x275322137D62255Full, &Block_D721 },
+    { 0xD727, 0xD72F, 0x03FEE0A0FF56A128ull, &Block_D727 },
+    { 0xD730, 0xD735, 0xBB5E4F28BD8741E5ull, &Block_D730 },
+    { 0xD736, 0xD73E, 0xEF5008A6C43CCF04ull, &Block_D736 },
+    { 0xD73F, 0xD744, 0x13BFBB3E15946204ull, &Block_D73F },
+    { 0xD745, 0xD74D, 0x756D4E64308EA35Cull, &Block_D745 },
+    { 0xD74E, 0xD754, 0x2BC33C1BD43F8B59ull, &Block_D74E },
+    { 0xD755, 0xD75D, 0x316CC6B39CB250AAull, &Block_D755 },
+    { 0xD75E, 0xD763, 0x8124759F82D900B6ull, &Block_D75E },
+    { 0xD764, 0xD76F, 0x28B4493FF4D5323Bull, &Block_D764 },
+    { 0xD770, 0xD778, 0xED22E1A03594D4B1ull, &Block_D770 },
+    { 0xD779, 0xD77F, 0x033A1022AA4F20FBull, &Block_D779 },
+    { 0xD780, 0xD78B, 0xA57DDAA5588CED47ull, &Block_D780 },
+    { 0xD78C, 0xD797, 0x8458D705D30840E7ull, &Block_D78C },
+    { 0xD798, 0xD7A3, 0x9AB0392224EEFB8Cull, &Block_D798 },
+    { 0xD7A4, 0xD7AE, 0xA04EB71CB3A4B945ull, &Block_D7A4 },
+    { 0xD7AF, 0xD7B4, 0x2DDFD5BC7BEAC7AAull, &Block_D7AF },
+    { 0xD7B5, 0xD7BD, 0xB3B7736D7DC95A3Dull, &Block_D7B5 },
+    { 0xD7BE, 0xD7C3, 0xD76CC496582569A9ull, &Block_D7BE },
+    { 0xD7C4, 0xD7CF, 0x053723F14C04E873ull, &Block_D7C4 },
+    { 0xD7D0, 0xD7D8, 0x7760D0FEEC30D4C3ull, &Block_D7D0 },
+    { 0xD7D9, 0xD7DE, 0x6F211112BD69D308ull, &Block_D7D9 },
+    { 0xD7DF, 0xD7EA, 0x0DC0151526E431E9ull, &Block_D7DF },
+    { 0xD7EB, 0xD7F6, 0x80E4295437C375A9ull, &Block_D7EB },
+    { 0xD7F7, 0xD802, 0x449D8FA79287FFA8ull, &Block_D7F7 },
+    { 0xD803, 0xD808, 0x0A7FE4D59EA9643Eull, &Block_D803 },
+    { 0xD809, 0xD814, 0x4C0983E5DE9A47E3ull, &Block_D809 },
+    { 0xD815, 0xD821, 0x6D75AFBBB2AF2B37ull, &Block_D815 },
+    { 0xD822, 0xD825, 0xE3D95376C95ADFB6ull, &Block_D822 },
+    { 0xD826, 0xD831, 0x24BBDF4B20E85711ull, &Block_D826 },
+    { 0xD832, 0xD83E, 0x11F7F258E4F27254ull, &Block_D832 },
+    { 0xD83F, 0xD842, 0x4C3958DEF9F6035Dull, &Block_D83F },
+    { 0xD843, 0xD84E, 0x9A93BB6427F0A29Bull, &Block_D843 },
+    { 0xD84F, 0xD85B, 0x785AE94C60DF2E44ull, &Block_D84F },
+    { 0xD85C, 0xD85F, 0x9B5D62A6C121C8C6ull, &Block_D85C },
+    { 0xD860, 0xD86B, 0x2740ED88BB95B8FBull, &Block_D860 },
+    { 0xD86C, 0xD878, 0x24A4A0DA27A9558Dull, &Block_D86C },
+    { 0xD879, 0xD894, 0x38341800267B67D9ull, &Block_D879 },
+    { 0xD895, 0xD898, 0x1DAD2BA9473B980Eull, &Block_D895 },
+    { 0xD899, 0xD8B1, 0xBBF042A88F96B7F7ull, &Block_D899 },
+    { 0xD8B2, 0xD8B5, 0xD51F5719D138FA76ull, &Block_D8B2 },
+    { 0xD8B6, 0xD8CF, 0xA019693D04C03100ull, &Block_D8B6 },
+    { 0xD8D0, 0xD8D3, 0x628BED04D1ADB3C2ull, &Block_D8D0 },
+    { 0xD8D4, 0xD8EC, 0x9C0E5B3D037543ABull, &Block_D8D4 },
+    { 0xD8ED, 0xD8F0, 0x29ED60C4F797DA65ull, &Block_D8ED },
+    { 0xD8F1, 0xD8FE, 0xA81CB43639DD1D0Eull, &Block_D8F1 },
+    { 0xD8FF, 0xD8FF, 0xC7DFAFCE5338CA47ull, &Block_D8FF },
+    { 0xD900, 0xD931, 0x17FB7332A16B4E46ull, &Block_D900 },
+    { 0xD932, 0xD935, 0xAEF84BC2D2829E90ull, &Block_D932 },
+    { 0xD936, 0xD947, 0x3E8B0C381D5DE34Dull, &Block_D936 },
+    { 0xD948, 0xD94B, 0xEF57FFCD4136CF0Aull, &Block_D948 },
+    { 0xD94C, 0xD962, 0xF3C7A6EDEACD9AA6ull, &Block_D94C },
+    { 0xD963, 0xD98B, 0x484D87374056FD92ull, &Block_D963 },
+    { 0xD98C, 0xD98D, 0x0B890A814708309Dull, &Block_D98C },
+    { 0xD98E, 0xD99C, 0xDE9613DA2D8C469Bull, &Block_D98E },
+    { 0xD99D, 0xD99E, 0x0B890A814708309Dull, &Block_D99D },
+    { 0xD99F, 0xD9AE, 0x1BC2EFB8A584EBDAull, &Block_D99F },
+    { 0xD9AF, 0xD9B0, 0x0B890A814708309Dull, &Block_D9AF },
+    { 0xD9B1, 0xD9C6, 0x4DD3280F44790DD3ull, &Block_D9B1 },
+    { 0xD9C7, 0xD9C8, 0x0B890A814708309Dull, &Block_D9C7 },
+    { 0xD9C9, 0xD9DF, 0x95FA72BADD31EAB8ull, &Block_D9C9 },
+    { 0xD9E0, 0xD9E1, 0x0B890A814708309Dull, &Block_D9E0 },
+    { 0xD9E2, 0xD9F3, 0xB57844E0EB43A9F6ull, &Block_D9E2 },
+    { 0xD9F4, 0xD9F5, 0x0B890A814708309Dull, &Block_D9F4 },
+    { 0xD9F6, 0xDA0C, 0xFA9CC771D36BA3DEull, &Block_D9F6 },
+    { 0xDA0D, 0xDA0E, 0x0B890A814708309Dull, &Block_DA0D },
+    { 0xDA0F, 0xDA20, 0xC12971EC478EF1B8ull, &Block_DA0F },
+    { 0xDA21, 0xDA22, 0x0B890A814708309Dull, &Block_DA21 },
+    { 0xDA23, 0xDA36, 0x99C0CB5E7111538Cull, &Block_DA23 },
+    { 0xDA37, 0xDA38, 0x0B890A814708309Dull, &Block_DA37 },
+    { 0xDA39, 0xDA4F, 0x83E4E4000554D554ull, &Block_DA39 },
+    { 0xDA50, 0xDA51, 0x0B890A814708309Dull, &Block_DA50 },
+    { 0xDA52, 0xDA65, 0x1B37678FFD06BEBDull, &Block_DA52 },
+    { 0xDA66, 0xDA67, 0x0B890A814708309Dull, &Block_DA66 },
+    { 0xDA68, 0xDA79, 0x5C19C65D12AB6A35ull, &Block_DA68 },
+    { 0xDA7A, 0xDA7B, 0x0B890A814708309Dull, &Block_DA7A },
+    { 0xDA7C, 0xDA8A, 0x64896998DC408E89ull, &Block_DA7C },
+    { 0xDA8B, 0xDA8C, 0x0B890A814708309Dull, &Block_DA8B },
+    { 0xDA8D, 0xDA99, 0xEA217689F261CB6Aull, &Block_DA8D },
+    { 0xDA9A, 0xDA9B, 0x0B890A814708309Dull, &Block_DA9A },
+    { 0xDA9C, 0xDAAB, 0xE026E32FD830B35Aull, &Block_DA9C },
+    { 0xDAAC, 0xDAAD, 0x0B890A814708309Dull, &Block_DAAC },
+    { 0xDAAE, 0xDABD, 0x93165DF7852F7675ull, &Block_DAAE },
+    { 0xDABE, 0xDABF, 0x0B890A814708309Dull, &Block_DABE },
+    { 0xDAC0, 0xDACB, 0xD9B74E314555B595ull, &Block_DAC0 },
+    { 0xDACC, 0xDACD, 0x0B890A814708309Dull, &Block_DACC },
+    { 0xDACE, 0xDADC, 0x89F89040DFDC263Cull, &Block_DACE },
+    { 0xDADD, 0xDADE, 0x0B890A814708309Dull, &Block_DADD },
+    { 0xDADF, 0xDADF, 0xC7DFAFCE5338CA47ull, &Block_DADF },
+    { 0xDAE0, 0xDB01, 0x224DF84CC00B38BEull, &Block_DAE0 },
+    { 0xDB02, 0xDB03, 0x0B890A814708309Dull, &Block_DB02 },
+    { 0xDB04, 0xDB19, 0xC0DBBACA9FB3B96Eull, &Block_DB04 },
+    { 0xDB1A, 0xDB1B, 0x0B890A814708309Dull, &Block_DB1A },
+    { 0xDB1C, 0xDB35, 0xCDE6E33FBE45DE38ull, &Block_DB1C },
+    { 0xDB36, 0xDB37, 0x0B890A814708309Dull, &Block_DB36 },
+    { 0xDB38, 0xDB48, 0x2B67AB4320711D4Aull, &Block_DB38 },
+    { 0xDB49, 0xDB4A, 0x0B890A814708309Dull, &Block_DB49 },
+    { 0xDB4B, 0xDB5D, 0x5DAF07FCFCA45C41ull, &Block_DB4B },
+    { 0xDB5E, 0xDB5F, 0x0B890A814708309Dull, &Block_DB5E },
+    { 0xDB60, 0xDB6F, 0xCB3FD16B100AC4EDull, &Block_DB60 },
+    { 0xDB70, 0xDB7D, 0x3F83AA09367C4D32ull, &Block_DB70 },
+    { 0xDBB8, 0xDBE2, 0xC528BECCD5E9079Cull, &Block_DBB8 },
+    { 0xDBE3, 0xDBE6, 0x9D167B47CDB681DBull, &Block_DBE3 },
+    { 0xDBE7, 0xDC04, 0xBA6869BB44280F66ull, &Block_DBE7 },
+    { 0xDC05, 0xDC08, 0xDF61E62D6C3A1160ull, &Block_DC05 },
+    { 0xDC09, 0xDC2D, 0xDEC8C0E2643A979Bull, &Block_DC09 },
+    { 0xDC2E, 0xDC31, 0x082E68046B0C93CAull, &Block_DC2E },
+    { 0xDC32, 0xDC3C, 0x39A2A4A1D962A468ull, &Block_DC32 },
+    { 0xDC3D, 0xDC41, 0x97C6D41D9A3D4B99ull, &Block_DC3D },
+    { 0xDC42, 0xDC49, 0x9C7389054321FA1Bull, &Block_DC42 },
+    { 0xDC4A, 0xDC4E, 0x424FA0197ECE270Cull, &Block_DC4A },
+    { 0xDC4F, 0xDC56, 0x393726A63F19FC3Cull, &Block_DC4F },
+    { 0xDC57, 0xDC5B, 0x79511B148DBBCFB7ull, &Block_DC57 },
+    { 0xDC5C, 0xDC63, 0x8343CEECACF1451Aull, &Block_DC5C },
+    { 0xDC64, 0xDC68, 0xCC1B3E51E79684D1ull, &Block_DC64 },
+    { 0xDC69, 0xDC70, 0x1AC99DA13DB5F7C6ull, &Block_DC69 },
+    { 0xDC71, 0xDC75, 0xC340189EF6B3D749ull, &Block_DC71 },
+    { 0xDC76, 0xDC7D, 0x23C4C63616E8C246ull, &Block_DC76 },
+    { 0xDC7E, 0xDC82, 0xCB0C1B90AA4349FCull, &Block_DC7E },
+    { 0xDC83, 0xDC8A, 0x2647A2DE8A130B6Aull, &Block_DC83 },
+    { 0xDC8B, 0xDC8F, 0xAF23CBD6702FE2E9ull, &Block_DC8B },
+    { 0xDC90, 0xDC93, 0xB0E0C6FDF1A3AA47ull, &Block_DC90 },
+    { 0xDC94, 0xDC98, 0x9D933A22B97771BCull, &Block_DC94 },
+    { 0xDC99, 0xDCA0, 0xBA9AA5BD37BE5A4Dull, &Block_DC99 },
+    { 0xDCA1, 0xDCA5, 0xF0FB394DAD893B6Aull, &Block_DCA1 },
+    { 0xDCA6, 0xDCAD, 0xAF9914CB019C1B99ull, &Block_DCA6 },
+    { 0xDCAE, 0xDCB2, 0xB0191B2A137E0EE2ull, &Block_DCAE },
+    { 0xDCB3, 0xDCB6, 0xC390538EA4B608EFull, &Block_DCB3 },
+    { 0xDCB7, 0xDCBB, 0xC0685C719A499D41ull, &Block_DCB7 },
+    { 0xDCBC, 0xDCC3, 0xE304E105BB5DFA7Full, &Block_DCBC },
+    { 0xDCC4, 0xDCC8, 0x3CD60A782A2B46E2ull, &Block_DCC4 },
+    { 0xDCC9, 0xDCD2, 0x707B017E6FCCAACBull, &Block_DCC9 },
+    { 0xDCD3, 0xDCD7, 0x0E25E7BFFA7CD412ull, &Block_DCD3 },
+    { 0xDCD8, 0xDCE3, 0xB9108CAA32663EDFull, &Block_DCD8 },
+    { 0xDCE4, 0xDCED, 0x40493327036F7EAAull, &Block_DCE4 },
+    { 0xDCEE, 0xDCF2, 0xE14822AB9DAAA87Eull, &Block_DCEE },
+    { 0xDCF3, 0xDCFE, 0xD512983A71AA9BD5ull, &Block_DCF3 },
+    { 0xDCFF, 0xDD0A, 0x45B5CEA41D7F3E6Dull, &Block_DCFF },
+    { 0xDD0B, 0xDD16, 0x404DB285F50D27ABull, &Block_DD0B },
+    { 0xDD17, 0xDD1E, 0x6DA4CEBB09154EE9ull, &Block_DD17 },
+    { 0xDD1F, 0xDD23, 0xB94A044D42E0D2D2ull, &Block_DD1F },
+    { 0xDD24, 0xDD2B, 0x2989D825F22F8AB2ull, &Block_DD24 },
+    { 0xDD2C, 0xDD30, 0xC7C604EE5F737070ull, &Block_DD2C },
+    { 0xDD31, 0xDD38, 0x349E90C23CE40027ull, &Block_DD31 },
+    { 0xDD39, 0xDD3D, 0x1E13DCE05A764407ull, &Block_DD39 },
+    { 0xDD3E, 0xDD45, 0x53B0E96515080CA4ull, &Block_DD3E },
+    { 0xDD46, 0xDD4A, 0x6805D4F70B95358Full, &Block_DD46 },
+    { 0xDD4B, 0xDD52, 0xB36F679F09B0CFA4ull, &Block_DD4B },
+    { 0xDD53, 0xDD57, 0xE74BB8E2742B5B26ull, &Block_DD53 },
+    { 0xDD58, 0xDD7E, 0xE445364DA663778Full, &Block_DD58 },
+    { 0xDD7F, 0xDD82, 0xCE072B9763BBBEE7ull, &Block_DD7F },
+    { 0xDD83, 0xDDA0, 0xF9640A82C75FB088ull, &Block_DD83 },
+    { 0xDDA1, 0xDDA4, 0x09FFF9E6B960D2BCull, &Block_DDA1 },
+    { 0xDDA5, 0xDDC9, 0xC740299DC22BF44Cull, &Block_DDA5 },
+    { 0xDDCA, 0xDDCD, 0xC722426E7F3A51D2ull, &Block_DDCA },
+    { 0xDDCE, 0xDDD4, 0x6C36504E2E6F98D8ull, &Block_DDCE },
+    { 0xDDD5, 0xDDDD, 0x47CE795CC1274ECBull, &Block_DDD5 },
+    { 0xDDDE, 0xDDE7, 0x3BBF7297A453A3E8ull, &Block_DDDE },
+    { 0xDDE8, 0xDDEB, 0xE3D95376C95ADFB6ull, &Block_DDE8 },
+    { 0xDDEC, 0xDDF4, 0x493161A14F08EA9Full, &Block_DDEC },
+    { 0xDDF5, 0xDDFE, 0xEFC0B736985A31C4ull, &Block_DDF5 },
+    { 0xDDFF, 0xDE02, 0x4C3958DEF9F6035Dull, &Block_DDFF },
+    { 0xDE03, 0xDE0B, 0x044521DFCB7C26A3ull, &Block_DE03 },
+    { 0xDE0C, 0xDE15, 0x7E8610253F960586ull, &Block_DE0C },
+    { 0xDE16, 0xDE19, 0x9B5D62A6C121C8C6ull, &Block_DE16 },
+    { 0xDE1A, 0xDE22, 0x55DB48D75016237Bull, &Block_DE1A },
+    { 0xDE23, 0xDE2C, 0x6747568C7720B52Eull, &Block_DE23 },
+    { 0xDE2D, 0xDE45, 0x0ACCB7466540D1DCull, &Block_DE2D },
+    { 0xDE46, 0xDE49, 0x9599DA43A55E9435ull, &Block_DE46 },
+    { 0xDE4A, 0xDE5F, 0xE0F27B9F4A96B99Bull, &Block_DE4A },
+    { 0xDE60, 0xDE63, 0xF2BFA27081A29EF3ull, &Block_DE60 },
+    { 0xDE64, 0xDE7A, 0xD4F662CDAF4225E4ull, &Block_DE64 },
+    { 0xDE7B, 0xDE7E, 0xFC4FB10AB9E10735ull, &Block_DE7B },
+    { 0xDE7F, 0xDE94, 0x62D498D51C0B7AB9ull, &Block_DE7F },
+    { 0xDE95, 0xDE98, 0xF69C9CED6EC75E55ull, &Block_DE95 },
+    { 0xDE99, 0xDEA4, 0x739507A9203A75C0ull, &Block_DE99 },
+    { 0xDEA5, 0xDEC7, 0x236F0ED16985DF28ull, &Block_DEA5 },
+    { 0xDEC8, 0xDECB, 0x466B0142B93F9808ull, &Block_DEC8 },
+    { 0xDECC, 0xDEED, 0x302DAFF4C0362578ull, &Block_DECC },
+    { 0xDEEE, 0xDEF1, 0x6186EAAE069489F2ull, &Block_DEEE },
+    { 0xDEF2, 0xDF19, 0x72E25D7C70E1DE2Eull, &Block_DEF2 },
+    { 0xDF1A, 0xDF1D, 0xE3668A1AD4B2DCA7ull, &Block_DF1A },
+    { 0xDF1E, 0xDF44, 0x87D8851D81ABA197ull, &Block_DF1E },
+    { 0xDF45, 0xDF48, 0x5E32A68AB18049A6ull, &Block_DF45 },
+    { 0xDF49, 0xDF49, 0xC7DFAFCE5338CA47ull, &Block_DF49 },
+    { 0xDF4A, 0xDF70, 0x1C02606499B432E9ull, &Block_DF4A },
+    { 0xDF71, 0xDF74, 0xF003DD26EAE83A07ull, &Block_DF71 },
+    { 0xDF75, 0xDF85, 0xDD5E9A0A18E56706ull, &Block_DF75 },
+    { 0xDF86, 0xDF89, 0x0246F56E81512430ull, &Block_DF86 },
+    { 0xDF8A, 0xDF9A, 0x1496634EC27E116Eull, &Block_DF8A },
+    { 0xDF9B, 0xDFB9, 0x0D60A9955A8009FCull, &Block_DF9B },
+    { 0xDFBA, 0xDFBB, 0x0B890A814708309Dull, &Block_DFBA },
+    { 0xDFBC, 0xDFCB, 0xB4055FCC220BA732ull, &Block_DFBC },
+    { 0xDFCC, 0xDFCD, 0x0B890A814708309Dull, &Block_DFCC },
+    { 0xDFCE, 0xDFDE, 0xB4709F9F705B5AF3ull, &Block_DFCE },
+    { 0xDFDF, 0xDFE0, 0x0B890A814708309Dull, &Block_DFDF },
+    { 0xDFE1, 0xDFF7, 0xDBE0D105C0887967ull, &Block_DFE1 },
+    { 0xDFF8, 0xDFF9, 0x0B890A814708309Dull, &Block_DFF8 },
+    { 0xDFFA, 0xE011, 0x2C8585BF6E56D267ull, &Block_DFFA },
+    { 0xE012, 0xE013, 0x0B890A814708309Dull, &Block_E012 },
+    { 0xE014, 0xE026, 0xA2D92617516CF74Eull, &Block_E014 },
+    { 0xE027, 0xE028, 0x0B890A814708309Dull, &Block_E027 },
+    { 0xE029, 0xE040, 0xF0E4FE2318128E2Dull, &Block_E029 },
+    { 0xE041, 0xE042, 0x0B890A814708309Dull, &Block_E041 },
+    { 0xE043, 0xE055, 0x7CB8899EF66C3B04ull, &Block_E043 },
+    { 0xE056, 0xE057, 0x0B890A814708309Dull, &Block_E056 },
+    { 0xE058, 0xE06C, 0x75D34F66CB0C2353ull, &Block_E058 },
+    { 0xE06D, 0xE06E, 0x0B890A814708309Dull, &Block_E06D },
+    { 0xE06F, 0xE086, 0x2DCD1CB6358350C2ull, &Block_E06F },
+    { 0xE087, 0xE088, 0x0B890A814708309Dull, &Block_E087 },
+    { 0xE089, 0xE09D, 0xC9A7B69E2BBC10D0ull, &Block_E089 },
+    { 0xE09E, 0xE09F, 0x0B890A814708309Dull, &Block_E09E },
+    { 0xE0A0, 0xE0B2, 0x4D4984A07EFE329Full, &Block_E0A0 },
+    { 0xE0B3, 0xE0B4, 0x0B890A814708309Dull, &Block_E0B3 },
+    { 0xE0B5, 0xE0C4, 0x00F01BF7D109B997ull, &Block_E0B5 },
+    { 0xE0C5, 0xE0C6, 0x0B890A814708309Dull, &Block_E0C5 },
+    { 0xE0C7, 0xE0D4, 0xC3975EBC77B3A325ull, &Block_E0C7 },
+    { 0xE0D5, 0xE0D6, 0x0B890A814708309Dull, &Block_E0D5 },
+    { 0xE0D7, 0xE0E7, 0x1190C4E059C0CDBBull, &Block_E0D7 },
+    { 0xE0E8, 0xE0E9, 0x0B890A814708309Dull, &Block_E0E8 },
+    { 0xE0EA, 0xE0FA, 0xF8CC66D6F5B7123Eull, &Block_E0EA },
+    { 0xE0FB, 0xE0FC, 0x0B890A814708309Dull, &Block_E0FB },
+    { 0xE0FD, 0xE109, 0x7EF05C18F252CBA7ull, &Block_E0FD },
+    { 0xE10A, 0xE10B, 0x0B890A814708309Dull, &Block_E10A },
+    { 0xE10C, 0xE11B, 0xEDC85555273D361Full, &Block_E10C },
+    { 0xE11C, 0xE11D, 0x0B890A814708309Dull, &Block_E11C },
+    { 0xE11E, 0xE135, 0x52B8310C1B1A79C3ull, &Block_E11E },
+    { 0xE136, 0xE137, 0x0B890A814708309Dull, &Block_E136 },
+    { 0xE138, 0xE14E, 0x3B2B9764CA24EB64ull, &Block_E138 },
+    { 0xE14F, 0xE150, 0x0B890A814708309Dull, &Block_E14F },
+    { 0xE151, 0xE16B, 0x80A14CC778F8FA63ull, &Block_E151 },
+    { 0xE16C, 0xE16D, 0x0B890A814708309Dull, &Block_E16C },
+    { 0xE16E, 0xE17F, 0x60E8E42D49AC0349ull, &Block_E16E },
+    { 0xE180, 0xE181, 0x0B890A814708309Dull, &Block_E180 },
+    { 0xE182, 0xE195, 0xB5ECEAB321C69D8Dull, &Block_E182 },
+    { 0xE196, 0xE197, 0x0B890A814708309Dull, &Block_E196 },
+    { 0xE198, 0xE1A8, 0x9A7F997119745874ull, &Block_E198 },
+    { 0xE1A9, 0xE1A9, 0xC7DFAFCE5338CA47ull, &Block_E1A9 },
+    { 0xE1AA, 0xE1D7, 0x1FFB1CD40B271623ull, &Block_E1AA },
+    { 0xE1D8, 0xE1DB, 0x9FEDF6BFA682109Eull, &Block_E1D8 },
+    { 0xE1DC, 0xE1FA, 0xC6470BE9C31DCD9Bull, &Block_E1DC },
+    { 0xE1FB, 0xE1FE, 0x44943C4A1A02E5EBull, &Block_E1FB },
+    { 0xE1FF, 0xE20A, 0x4CC98E486C9CDF5Full, &Block_E1FF },
+    { 0xE20B, 0xE210, 0xA899B5ACEC95D393ull, &Block_E20B },
+    { 0xE211, 0xE219, 0xF93B841BFF5D5E1Eull, &Block_E211 },
+    { 0xE21A, 0xE21F, 0x37D5C6809C474B36ull, &Block_E21A },
+    { 0xE220, 0xE228, 0x1726599BF88D25E9ull, &Block_E220 },
+    { 0xE229, 0xE22E, 0xDC3695770FC2C595ull, &Block_E229 },
+    { 0xE22F, 0xE237, 0x17217A497210A186ull, &Block_E22F },
+    { 0xE238, 0xE23D, 0xA0F217173CB629B5ull, &Block_E238 },
+    { 0xE23E, 0xE246, 0x3A40D4138A9E3AFCull, &Block_E23E },
+    { 0xE247, 0xE24C, 0xFBD4F24DA5412BDEull, &Block_E247 },
+    { 0xE24D, 0xE255, 0x7AA474E6949B3A41ull, &Block_E24D },
+    { 0xE256, 0xE25B, 0x0EAA673FF50F391Cull, &Block_E256 },
+    { 0xE25C, 0xE264, 0x344D47F1D35F0B7Eull, &Block_E25C },
+    { 0xE265, 0xE26A, 0x1217C0AADAF32400ull, &Block_E265 },
+    { 0xE26B, 0xE26E, 0xB0E0C6FDF1A3AA47ull, &Block_E26B },
+    { 0xE26F, 0xE274, 0x80D781AAA69574E6ull, &Block_E26F },
+    { 0xE275, 0xE27D, 0xDA6BAF22CA42D203ull, &Block_E275 },
+    { 0xE27E, 0xE283, 0xE930338DD97E54D9ull, &Block_E27E },
+    { 0xE284, 0xE28C, 0xC9E927D73E59E288ull, &Block_E284 },
+    { 0xE28D, 0xE292, 0xAAD6B3C2A91F941Dull, &Block_E28D },
+    { 0xE293, 0xE296, 0xC390538EA4B608EFull, &Block_E293 },
+    { 0xE297, 0xE29C, 0x11B69EE253512093ull, &Block_E297 },
+    { 0xE29D, 0xE2A5, 0x756D4E64308EA35Cull, &Block_E29D },
+    { 0xE2A6, 0xE2AB, 0xDA18B85CD9265DA3ull, &Block_E2A6 },
+    { 0xE2AC, 0xE2B6, 0xEA8CDCAE1D56AFE4ull, &Block_E2AC },
+    { 0xE2B7, 0xE2BC, 0xE83CBF8482EBEC1Full, &Block_E2B7 },
+    { 0xE2BD, 0xE2CA, 0x1B47928BEEF0BF21ull, &Block_E2BD },
+    { 0xE2CB, 0xE2D5, 0x8752980CEA48DE88ull, &Block_E2CB },
+    { 0xE2D6, 0xE2DB, 0xDF17C947AD3188A7ull, &Block_E2D6 },
+    { 0xE2DC, 0xE2E9, 0xFCF51CCAF26AC3C6ull, &Block_E2DC },
+    { 0xE2EA, 0xE2F7, 0x8B818D0435379D8Eull, &Block_E2EA },
+    { 0xE2F8, 0xE305, 0x397AAE5D543FC63Cull, &Block_E2F8 },
+    { 0xE306, 0xE30E, 0xC4EFD61501AE9944ull, &Block_E306 },
+    { 0xE30F, 0xE314, 0x6C6804385B3748ABull, &Block_E30F },
+    { 0xE315, 0xE31D, 0x92D92D805310B07Eull, &Block_E315 },
+    { 0xE31E, 0xE323, 0x6DFD14787C7FBB95ull, &Block_E31E },
+    { 0xE324, 0xE32C, 0xE07BD99EED7B6B3Cull, &Block_E324 },
+    { 0xE32D, 0xE332, 0x019863A7DF395685ull, &Block_E32D },
+    { 0xE333, 0xE33B, 0x03FEE0A0FF56A128ull, &Block_E333 },
+    { 0xE33C, 0xE341, 0x2EDA17B36BD02E43ull, &Block_E33C },
+    { 0xE342, 0xE34A, 0xEF5008A6C43CCF04ull, &Block_E342 },
+    { 0xE34B, 0xE350, 0x53B9922CBE69D993ull, &Block_E34B },
+    { 0xE351, 0xE37A, 0xE38E67483B69E4BDull, &Block_E351 },
+    { 0xE37B, 0xE37E, 0x734BF67964C6A23Eull, &Block_E37B },
+    { 0xE37F, 0xE39D, 0x8CCA2FCA38760B42ull, &Block_E37F },
+    { 0xE39E, 0xE3A1, 0x831EA1FC83277E07ull, &Block_E39E },
+    { 0xE3A2, 0xE3CA, 0x3E502039775118EFull, &Block_E3A2 },
+    { 0xE3CB, 0xE3CE, 0x0FDE4B380ED1739Aull, &Block_E3CB },
+    { 0xE3CF, 0xE3D5, 0x69D5AAE9D483FED1ull, &Block_E3CF },
+    { 0xE3D6, 0xE3E1, 0xB4B62881B4286238ull, &Block_E3D6 },
+    { 0xE3E2, 0xE3EE, 0xB3A9DA065B16D643ull, &Block_E3E2 },
+    { 0xE3EF, 0xE3F2, 0xE3D95376C95ADFB6ull, &Block_E3EF },
+    { 0xE3F3, 0xE3FE, 0x9B5992B0D1FD0663ull, &Block_E3F3 },
+    { 0xE3FF, 0xE40B, 0x6113B7FF0F354916ull, &Block_E3FF },
+    { 0xE40C, 0xE40F, 0x4C3958DEF9F6035Dull, &Block_E40C },
+    { 0xE410, 0xE41B, 0x35C9C8BEE4DCAC28ull, &Block_E410 },
+    { 0xE41C, 0xE428, 0xD417FE8803BA08C5ull, &Block_E41C },
+    { 0xE429, 0xE42C, 0x9B5D62A6C121C8C6ull, &Block_E429 },
+    { 0xE42D, 0xE438, 0x80579BCEB9DE5C03ull, &Block_E42D },
+    { 0xE439, 0xE445, 0xFCA3A2F03727B484ull, &Block_E439 },
+    { 0xE446, 0xE461, 0x7CFBB1F0A961546Full, &Block_E446 },
+    { 0xE462, 0xE465, 0xBB36E6CAAEA6A26Bull, &Block_E462 },
+    { 0xE466, 0xE47E, 0xC3326F83C52380D5ull, &Block_E466 },
+    { 0xE47F, 0xE482, 0xD0234A9B056E86EEull, &Block_E47F },
+    { 0xE483, 0xE49C, 0x3FF314006734556Dull, &Block_E483 },
+    { 0xE49D, 0xE4A0, 0xB73BC2C65666C2E7ull, &Block_E49D },
+    { 0xE4A1, 0xE4B9, 0xCF428CC45FFCC043ull, &Block_E4A1 },
+    { 0xE4BA, 0xE4BD, 0x0FD088C26CE8FAEDull, &Block_E4BA },
+    { 0xE4BE, 0xE4CB, 0x6707848E07531856ull, &Block_E4BE },
+    { 0xE4CC, 0xE4F0, 0x78295DF39DA7771Dull, &Block_E4CC },
+    { 0xE4F1, 0xE4F4, 0x6D5D12DC963603CAull, &Block_E4F1 },
+    { 0xE4F5, 0xE518, 0x7BB9D6ED87077C6Cull, &Block_E4F5 },
+    { 0xE519, 0xE51C, 0x9E86486EC775483Bull, &Block_E519 },
+    { 0xE51D, 0xE51D, 0xC7DFAFCE5338CA47ull, &Block_E51D },
+    { 0xE51E, 0xE544, 0xAA44B4B96E90596Eull, &Block_E51E },
+    { 0xE73D, 0xE756, 0xC57D4917135CD220ull, &Block_E73D },
+    { 0xE8D3, 0xE8D7, 0xAB0F56338B97AD39ull, &Block_E8D3 },
+    { 0xE916, 0xE92D, 0x70FC317DD90ADD0Dull, &Block_E916 },
+    { 0xEB86, 0xEB9D, 0x4ECB82E115686A7Bull, &Block_EB86 },
+    { 0xEDF6, 0xEE0D, 0xF322E3A2471DB76Full, &Block_EDF6 },
+    { 0xF066, 0xF07D, 0x2A566B68E7DB468Dull, &Block_F066 },
+    { 0xF2D6, 0xF2ED, 0x259FD8D9068E49A5ull, &Block_F2D6 },
+    { 0xF546, 0xF55D, 0x755E5B03F1F5B490ull, &Block_F546 },
+    { 0xF7B6, 0xF7BF, 0xAD31859AA28CC298ull, &Block_F7B6 },
+    { 0xF7C0, 0xF7CA, 0xC5088EBB4D9881ACull, &Block_F7C0 },
+    { 0xF7CB, 0xF7CD, 0x661530E08DE645DBull, &Block_F7CB },
+    { 0xF7CE, 0xF7D2, 0x5C9F82ECC0490C05ull, &Block_F7CE },
+    { 0xF7D3, 0xF7DB, 0x534E92F1BEE7A0F2ull, &Block_F7D3 },
+    { 0xF7DC, 0xF7DE, 0x661530E08DE645DBull, &Block_F7DC },
+    { 0xF7DF, 0xF7E4, 0x5F4BD23C89751B61ull, &Block_F7DF },
+    { 0xF7E5, 0xF7ED, 0x6CCAA0DB291AB7B7ull, &Block_F7E5 },
+    { 0xF7EE, 0xF7F0, 0x661530E08DE645DBull, &Block_F7EE },
+    { 0xF7F1, 0xF7F5, 0x2C111E002173C915ull, &Block_F7F1 },
+    { 0xF7F6, 0xF800, 0xBA0A6806A9657535ull, &Block_F7F6 },
+    { 0xF801, 0xF803, 0x661530E08DE645DBull, &Block_F801 },
+    { 0xF804, 0xF809, 0xEF6149B6A817DE61ull, &Block_F804 },
+    { 0xF80A, 0xF814, 0x01E4202213ACD1FCull, &Block_F80A },
+    { 0xF815, 0xF817, 0x661530E08DE645DBull, &Block_F815 },
+    { 0xF818, 0xF81C, 0x8C30855BCF900EB4ull, &Block_F818 },
+    { 0xF81D, 0xF825, 0x534E92F1BEE7A0F2ull, &Block_F81D },
+    { 0xF826, 0xF828, 0x661530E08DE645DBull, &Block_F826 },
+    { 0xF829, 0xF82E, 0xE971E293B0B6F5ECull, &Block_F829 },
+    { 0xF82F, 0xF839, 0xBC77E13202C25481ull, &Block_F82F },
+    { 0xF83A, 0xF83C, 0x661530E08DE645DBull, &Block_F83A },
+    { 0xF83D, 0xF842, 0x9EEF0034B26B1760ull, &Block_F83D },
+    { 0xF843, 0xF84D, 0xD2C5FD2E443A106Full, &Block_F843 },
+    { 0xF84E, 0xF850, 0x661530E08DE645DBull, &Block_F84E },
+    { 0xF851, 0xF855, 0x272C26DF567D5ECBull, &Block_F851 },
+    { 0xF856, 0xF860, 0xF9C5976A13CBFD21ull, &Block_F856 },
+    { 0xF861, 0xF863, 0x661530E08DE645DBull, &Block_F861 },
+    { 0xF864, 0xF869, 0xED5A1C2744EB8E05ull, &Block_F864 },
+    { 0xF86A, 0xF874, 0x8ACBB24EAC26B88Full, &Block_F86A },
+    { 0xF875, 0xF877, 0x661530E08DE645DBull, &Block_F875 },
+    { 0xF878, 0xF87C, 0x272C26DF567D5ECBull, &Block_F878 },
+    { 0xF87D, 0xF885, 0xE760B0F9331F4F8Eull, &Block_F87D },
+    { 0xF886, 0xF888, 0x661530E08DE645DBull, &Block_F886 },
+    { 0xF889, 0xF88D, 0x8B01551978492D7Dull, &Block_F889 },
+    { 0xF88E, 0xF896, 0xC1099BFD08C3BB99ull, &Block_F88E },
+    { 0xF897, 0xF899, 0x661530E08DE645DBull, &Block_F897 },
+    { 0xF89A, 0xF89B, 0x41FE8F1E6C85FB68ull, &Block_F89A },
+    { 0xF89C, 0xF8A4, 0xA68C14F724E1C530ull, &Block_F89C },
+    { 0xF8A5, 0xF8A7, 0x661530E08DE645DBull, &Block_F8A5 },
+    { 0xF8A8, 0xF8AE, 0xC3A3ED34AEF793D5ull, &Block_F8A8 },
+    { 0xF8AF, 0xF8B1, 0x661530E08DE645DBull, &Block_F8AF },
+    { 0xF8B2, 0xF8B4, 0xB36371559A288470ull, &Block_F8B2 },
+    { 0xF8B5, 0xF8BB, 0xCAEFEB4C93F5A31Dull, &Block_F8B5 },
+    { 0xF8BC, 0xF8BE, 0x661530E08DE645DBull, &Block_F8BC },
+    { 0xF8BF, 0xF8C5, 0xB047E2E9F1B3F0FFull, &Block_F8BF },
+    { 0xF8C6, 0xF8C8, 0x661530E08DE645DBull, &Block_F8C6 },
+    { 0xF8C9, 0xF8CF, 0x21BEE234C5D27386ull, &Block_F8C9 },
+    { 0xF8D0, 0xF8D2, 0x661530E08DE645DBull, &Block_F8D0 },
+    { 0xF8D3, 0xF8D9, 0x9B55E8F07405EE19ull, &Block_F8D3 },
+    { 0xF8DA, 0xF8DC, 0x661530E08DE645DBull, &Block_F8DA },
+    { 0xF8DD, 0xF8E1, 0x627046DED468EE7Dull, &Block_F8DD },
+    { 0xF8E2, 0xF8EA, 0xC1099BFD08C3BB99ull, &Block_F8E2 },
+    { 0xF8EB, 0xF8ED, 0x07FC6A39A7737F05ull, &Block_F8EB },
+    { 0xF8EE, 0xF8EF, 0x41FE8F1E6C85FB68ull, &Block_F8EE },
+    { 0xF8F0, 0xF8F8, 0xA68C14F724E1C530ull, &Block_F8F0 },
+    { 0xF8F9, 0xF8FB, 0x07FC6A39A7737F05ull, &Block_F8F9 },
+    { 0xF8FC, 0xF902, 0xC3A3ED34AEF793D5ull, &Block_F8FC },
+    { 0xF903, 0xF905, 0x07FC6A39A7737F05ull, &Block_F903 },
+    { 0xF906, 0xF908, 0x6474F892D739D8DFull, &Block_F906 },
+    { 0xF909, 0xF90F, 0xCAEFEB4C93F5A31Dull, &Block_F909 },
+    { 0xF910, 0xF912, 0x07FC6A39A7737F05ull, &Block_F910 },
+    { 0xF913, 0xF919, 0xB047E2E9F1B3F0FFull, &Block_F913 },
+    { 0xF91A, 0xF91C, 0x07FC6A39A7737F05ull, &Block_F91A },
+    { 0xF91D, 0xF923, 0x21BEE234C5D27386ull, &Block_F91D },
+    { 0xF924, 0xF926, 0x07FC6A39A7737F05ull, &Block_F924 },
+    { 0xF927, 0xF92D, 0x9B55E8F07405EE19ull, &Block_F927 },
+    { 0xF92E, 0xF930, 0x07FC6A39A7737F05ull, &Block_F92E },
+    { 0xF931, 0xF936, 0x68B1F618A2312A3Full, &Block_F931 },
+    { 0xF937, 0xF943, 0xC4D62D7B8122282Aull, &Block_F937 },
+    { 0xF944, 0xF946, 0x661530E08DE645DBull, &Block_F944 },
+    { 0xF947, 0xF94B, 0xA8D2B57187E1A35Eull, &Block_F947 },
+    { 0xF94C, 0xF958, 0x2796E9C321B8820Dull, &Block_F94C },
+    { 0xF959, 0xF95B, 0x661530E08DE645DBull, &Block_F959 },
+    { 0xF95C, 0xF961, 0xE58BEE663374F51Cull, &Block_F95C },
+    { 0xF962, 0xF96E, 0x8D491F96A35C30F5ull, &Block_F962 },
+    { 0xF96F, 0xF971, 0x661530E08DE645DBull, &Block_F96F },
+    { 0xF972, 0xF975, 0xBC520C94AEADB057ull, &Block_F972 },
+    { 0xF976, 0xF97C, 0x5808DBCB03076A47ull, &Block_F976 },
+    { 0xF97D, 0xF97F, 0x661530E08DE645DBull, &Block_F97D },
+    { 0xF980, 0xF983, 0x1E57388642174CFFull, &Block_F980 },
+    { 0xF984, 0xF98C, 0x17657763BEF3506Bull, &Block_F984 },
+    { 0xF98D, 0xF98F, 0x661530E08DE645DBull, &Block_F98D },
+    { 0xF990, 0xF99C, 0x3150CC8DF7875CE1ull, &Block_F990 },
+    { 0xF99D, 0xF9AC, 0x60882213048CEA57ull, &Block_F99D },
+    { 0xF9AD, 0xF9B9, 0x18B77A5599913BF1ull, &Block_F9AD },
+    { 0xF9BA, 0xF9BC, 0x661530E08DE645DBull, &Block_F9BA },
+    { 0xF9BD, 0xF9C2, 0x4ACDCE11B8AFE958ull, &Block_F9BD },
+    { 0xF9C3, 0xF9D3, 0x4B806A3FDBF88BB9ull, &Block_F9C3 },
+    { 0xF9D4, 0xF9E0, 0x735C617195F8D42Dull, &Block_F9D4 },
+    { 0xF9E1, 0xF9E3, 0x661530E08DE645DBull, &Block_F9E1 },
+    { 0xF9E4, 0xF9E9, 0xF822BA7D62D85F52ull, &Block_F9E4 },
+    { 0xF9EA, 0xF9FA, 0x9161D6D3DC5BFB31ull, &Block_F9EA },
+    { 0xF9FB, 0xFA07, 0x585CCF8EB9CC5A9Aull, &Block_F9FB },
+    { 0xFA08, 0xFA09, 0x520D65EF2147B1DAull, &Block_FA08 },
+    { 0xFA0A, 0xFA0F, 0x4ACDCE11B8AFE958ull, &Block_FA0A },
+    { 0xFA10, 0xFA20, 0x5BA74F74EFE1A53Bull, &Block_FA10 },
+    { 0xFA21, 0xFA2D, 0x735C617195F8D42Dull, &Block_FA21 },
+    { 0xFA2E, 0xFA30, 0x661530E08DE645DBull, &Block_FA2E },
+    { 0xFA31, 0xFA36, 0x83755B6153BED5E6ull, &Block_FA31 },
+    { 0xFA7B, 0xFA80, 0xF8D11E9CC3B5F048ull, &Block_FA7B },
+    { 0xFAB1, 0xFAB6, 0x83755B6153BED5E6ull, &Block_FAB1 },
+    { 0xFAE9, 0xFAEE, 0xE4D0CABFEBA138AEull, &Block_FAE9 },
+    { 0xFB1D, 0xFB22, 0xF8D11E9CC3B5F048ull, &Block_FB1D },
+    { 0xFB53, 0xFB58, 0xF8D11E9CC3B5F048ull, &Block_FB53 },
+};
+
+extern const RecompiledProgram<Cpu> NESTEST_RECOMPILED = { BLOCKS, std::size(BLOCKS) };
@@ -1,23 +1,97 @@
 #include "Cpu6502.h"
 #include "Opcodes.h"
 
-const std::array<Opcode6502, 256> OPCODES_6502 = {
-	Opcode6502{"BRK", 7, &Cpu6502::BRK, &Cpu6502::IMM}, Opcode6502{"ORA", 6, &Cpu6502::ORA, &Cpu6502::IZX}, Opcode6502{"???", 2, &Cpu6502::XXX, &Cpu6502::IMP}, Opcode6502{"???", 8, &Cpu6502::XXX, &Cpu6502::IMP}, Opcode6502{"???", 2, &Cpu6502::XXX, &Cpu6502::IMP}, Opcode6502{"ORA", 3, &Cpu6502::ORA, &Cpu6502::ZP0}, Opcode6502{"ASL", 5, &Cpu6502::ASL, &Cpu6502::ZP0}, Opcode6502{"???", 2, &Cpu6502::XXX, &Cpu6502::IMP}, Opcode6502{"PHP", 3, &Cpu6502::PHP, &Cpu6502::IMP}, Opcode6502{"ORA", 2, &Cpu6502::ORA, &Cpu6502::IMM}, Opcode6502{"ASL", 2, &Cpu6502::ASL, &Cpu6502::IMP}, Opcode6502{"???", 2, &Cpu6502::XXX, &Cpu6502::IMP}, Opcode6502{"???", 2, &Cpu6502::XXX, &Cpu6502::IMP}, Opcode6502{"ORA", 4, &Cpu6502::ORA, &Cpu6502::ABS}, Opcode6502{"ASL", 6, &Cpu6502::ASL, &Cpu6502::ABS}, Opcode6502{"???", 2, &Cpu6502::XXX, &Cpu6502::IMP},
-	Opcode6502{"BPL", 2, &Cpu6502::BPL, &Cpu6502::REL}, Opcode6502{"ORA", 5, &Cpu6502::ORA, &Cpu6502::IZY}, Opcode6502{"???", 2, &Cpu6502::XXX, &Cpu6502::IMP}, Opcode6502{"???", 8, &Cpu6502::XXX, &Cpu6502::IMP}, Opcode6502{"???", 2, &Cpu6502::XXX, &Cpu6502::IMP}, Opcode6502{"ORA", 4, &Cpu6502::ORA, &Cpu6502::ZPX}, Opcode6502{"ASL", 6, &Cpu6502::ASL, &Cpu6502::ZPX}, Opcode6502{"???", 2, &Cpu6502::XXX, &Cpu6502::IMP}, Opcode6502{"CLC", 2, &Cpu6502::CLC, &Cpu6502::IMP}, Opcode6502{"ORA", 4, &Cpu6502::ORA, &Cpu6502::ABY}, Opcode6502{"???", 2, &Cpu6502::NOP, &Cpu6502::IMP}, Opcode6502{"???", 7, &Cpu6502::XXX, &Cpu6502::IMP}, Opcode6502{"???", 2, &Cpu6502::XXX, &Cpu6502::IMP}, Opcode6502{"ORA", 4, &Cpu6502::ORA, &Cpu6502::ABX}, Opcode6502{"ASL", 7, &Cpu6502::ASL, &Cpu6502::ABX}, Opcode6502{"???", 2, &Cpu6502::XXX, &Cpu6502::IMP},
-	Opcode6502{"JSR", 6, &Cpu6502::JSR, &Cpu6502::ABS}, Opcode6502{"AND", 6, &Cpu6502::AND, &Cpu6502::IZX}, Opcode6502{"???", 2, &Cpu6502::XXX, &Cpu6502::IMP}, Opcode6502{"???", 2, &Cpu6502::XXX, &Cpu6502::IMP}, Opcode6502{"BIT", 3, &Cpu6502::BIT, &Cpu6502::ZP0}, Opcode6502{"AND", 3, &Cpu6502::AND, &Cpu6502::ZP0}, Opcode6502{"ROL", 5, &Cpu6502::ROL, &Cpu6502::ZP0}, Opcode6502{"???", 2, &Cpu6502::XXX, &Cpu6502::IMP}, Opcode6502{"PLP", 4, &Cpu6502::PLP, &Cpu6502::IMP}, Opcode6502{"AND", 2, &Cpu6502::AND, &Cpu6502::IMM}, Opcode6502{"ROL", 2, &Cpu6502::ROL, &Cpu6502::IMP}, Opcode6502{"???", 2, &Cpu6502::XXX, &Cpu6502::IMP}, Opcode6502{"BIT", 4, &Cpu6502::BIT, &Cpu6502::ABS}, Opcode6502{"AND", 4, &Cpu6502::AND, &Cpu6502::ABS}, Opcode6502{"ROL", 6, &Cpu6502::ROL, &Cpu6502::ABS}, Opcode6502{"???", 2, &Cpu6502::XXX, &Cpu6502::IMP},
-	Opcode6502{"BMI", 2, &Cpu6502::BMI, &Cpu6502::REL}, Opcode6502{"AND", 5, &Cpu6502::AND, &Cpu6502::IZY}, Opcode6502{"???", 2, &Cpu6502::XXX, &Cpu6502::IMP}, Opcode6502{"???", 8, &Cpu6502::XXX, &Cpu6502::IMP}, Opcode6502{"???", 2, &Cpu6502::XXX, &Cpu6502::IMP}, Opcode6502{"AND", 4, &Cpu6502::AND, &Cpu6502::ZPX}, Opcode6502{"ROL", 6, &Cpu6502::ROL, &Cpu6502::ZPX}, Opcode6502{"???", 2, &Cpu6502::XXX, &Cpu6502::IMP}, Opcode6502{"SEC", 2, &Cpu6502::SEC, &Cpu6502::IMP}, Opcode6502{"AND", 4, &Cpu6502::AND, &Cpu6502::ABY}, Opcode6502{"???", 2, &Cpu6502::NOP, &Cpu6502::IMP}, Opcode6502{"???", 7, &Cpu6502::XXX, &Cpu6502::IMP}, Opcode6502{"???", 2, &Cpu6502::XXX, &Cpu6502::IMP}, Opcode6502{"AND", 4, &Cpu6502::AND, &Cpu6502::ABX}, Opcode6502{"ROL", 7, &Cpu6502::ROL, &Cpu6502::ABX}, Opcode6502{"???", 2, &Cpu6502::XXX, &Cpu6502::IMP},
-	Opcode6502{"RTI", 6, &Cpu6502::RTI, &Cpu6502::IMP}, Opcode6502{"EOR", 6, &Cpu6502::EOR, &Cpu6502::IZX}, Opcode6502{"???", 2, &Cpu6502::XXX, &Cpu6502::IMP}, Opcode6502{"???", 8, &Cpu6502::XXX, &Cpu6502::IMP}, Opcode6502{"???", 2, &Cpu6502::XXX, &Cpu6502::IMP}, Opcode6502{"EOR", 3, &Cpu6502::EOR, &Cpu6502::ZP0}, Opcode6502{"LSR", 5, &Cpu6502::LSR, &Cpu6502::ZP0}, Opcode6502{"???", 2, &Cpu6502::XXX, &Cpu6502::IMP}, Opcode6502{"PHA", 3, &Cpu6502::PHA, &Cpu6502::IMP}, Opcode6502{"EOR", 2, &Cpu6502::EOR, &Cpu6502::IMM}, Opcode6502{"LSR", 2, &Cpu6502::LSR, &Cpu6502::IMP}, Opcode6502{"???", 2, &Cpu6502::XXX, &Cpu6502::IMP}, Opcode6502{"JMP", 3, &Cpu6502::JMP, &Cpu6502::ABS}, Opcode6502{"EOR", 4, &Cpu6502::EOR, &Cpu6502::ABS}, Opcode6502{"LSR", 6, &Cpu6502::LSR, &Cpu6502::ABS}, Opcode6502{"???", 2, &Cpu6502::XXX, &Cpu6502::IMP},
-	Opcode6502{"BVC", 2, &Cpu6502::BVC, &Cpu6502::REL}, Opcode6502{"EOR", 5, &Cpu6502::EOR, &Cpu6502::IZY}, Opcode6502{"???", 2, &Cpu6502::XXX, &Cpu6502::IMP}, Opcode6502{"???", 8, &Cpu6502::XXX, &Cpu6502::IMP}, Opcode6502{"???", 2, &Cpu6502::XXX, &Cpu6502::IMP}, Opcode6502{"EOR", 4, &Cpu6502::EOR, &Cpu6502::ZPX}, Opcode6502{"LSR", 6, &Cpu6502::LSR, &Cpu6502::ZPX}, Opcode6502{"???", 2, &Cpu6502::XXX, &Cpu6502::IMP}, Opcode6502{"CLI", 2, &Cpu6502::CLI, &Cpu6502::IMP}, Opcode6502{"EOR", 4, &Cpu6502::EOR, &Cpu6502::ABY}, Opcode6502{"???", 2, &Cpu6502::NOP, &Cpu6502::IMP}, Opcode6502{"???", 7, &Cpu6502::XXX, &Cpu6502::IMP}, Opcode6502{"???", 2, &Cpu6502::XXX, &Cpu6502::IMP}, Opcode6502{"EOR", 4, &Cpu6502::EOR, &Cpu6502::ABX}, Opcode6502{"LSR", 7, &Cpu6502::LSR, &Cpu6502::ABX}, Opcode6502{"???", 2, &Cpu6502::XXX, &Cpu6502::IMP},
-	Opcode6502{"RTS", 6, &Cpu6502::RTS, &Cpu6502::IMP}, Opcode6502{"ADC", 6, &Cpu6502::ADC, &Cpu6502::IZX}, Opcode6502{"???", 2, &Cpu6502::XXX, &Cpu6502::IMP}, Opcode6502{"???", 8, &Cpu6502::XXX, &Cpu6502::IMP}, Opcode6502{"???", 2, &Cpu6502::XXX, &Cpu6502::IMP}, Opcode6502{"ADC", 3, &Cpu6502::ADC, &Cpu6502::ZP0}, Opcode6502{"ROR", 5, &Cpu6502::ROR, &Cpu6502::ZP0}, Opcode6502{"???", 2, &Cpu6502::XXX, &Cpu6502::IMP}, Opcode6502{"PLA", 4, &Cpu6502::PLA, &Cpu6502::IMP}, Opcode6502{"ADC", 2, &Cpu6502::ADC, &Cpu6502::IMM}, Opcode6502{"ROR", 2, &Cpu6502::ROR, &Cpu6502::IMP}, Opcode6502{"???", 2, &Cpu6502::XXX, &Cpu6502::IMP}, Opcode6502{"JMP", 5, &Cpu6502::JMP, &Cpu6502::IND}, Opcode6502{"ADC", 4, &Cpu6502::ADC, &Cpu6502::ABS}, Opcode6502{"ROR", 6, &Cpu6502::ROR, &Cpu6502::ABS}, Opcode6502{"???", 2, &Cpu6502::XXX, &Cpu6502::IMP},
-	Opcode6502{"BVS", 2, &Cpu6502::BVS, &Cpu6502::REL}, Opcode6502{"ADC", 5, &Cpu6502::ADC, &Cpu6502::IZY}, Opcode6502{"???", 2, &Cpu6502::XXX, &Cpu6502::IMP}, Opcode6502{"???", 8, &Cpu6502::XXX, &Cpu6502::IMP}, Opcode6502{"???", 2, &Cpu6502::XXX, &Cpu6502::IMP}, Opcode6502{"ADC", 4, &Cpu6502::ADC, &Cpu6502::ZPX}, Opcode6502{"ROR", 6, &Cpu6502::ROR, &Cpu6502::ZPX}, Opcode6502{"???", 2, &Cpu6502::XXX, &Cpu6502::IMP}, Opcode6502{"SEI", 2, &Cpu6502::SEI, &Cpu6502::IMP}, Opcode6502{"ADC", 4, &Cpu6502::ADC, &Cpu6502::ABY}, Opcode6502{"???", 2, &Cpu6502::NOP, &Cpu6502::IMP}, Opcode6502{"???", 7, &Cpu6502::XXX, &Cpu6502::IMP}, Opcode6502{"???", 2, &Cpu6502::XXX, &Cpu6502::IMP}, Opcode6502{"ADC", 4, &Cpu6502::ADC, &Cpu6502::ABX}, Opcode6502{"ROR", 7, &Cpu6502::ROR, &Cpu6502::ABX}, Opcode6502{"???", 2, &Cpu6502::XXX, &Cpu6502::IMP},
-	Opcode6502{"???", 2, &Cpu6502::XXX, &Cpu6502::IMP}, Opcode6502{"STA", 6, &Cpu6502::STA, &Cpu6502::IZX}, Opcode6502{"???", 2, &Cpu6502::NOP, &Cpu6502::IMP}, Opcode6502{"???", 2, &Cpu6502::XXX, &Cpu6502::IMP}, Opcode6502{"STY", 3, &Cpu6502::STY, &Cpu6502::ZP0}, Opcode6502{"STA", 3, &Cpu6502::STA, &Cpu6502::ZP0}, Opcode6502{"STX", 3, &Cpu6502::STX, &Cpu6502::ZP0}, Opcode6502{"???", 2, &Cpu6502::XXX, &Cpu6502::IMP}, Opcode6502{"DEY", 2, &Cpu6502::DEY, &Cpu6502::IMP}, Opcode6502{"???", 2, &Cpu6502::XXX, &Cpu6502::IMP}, Opcode6502{"TXA", 2, &Cpu6502::TXA, &Cpu6502::IMP}, Opcode6502{"???", 2, &Cpu6502::XXX, &Cpu6502::IMP}, Opcode6502{"STY", 4, &Cpu6502::STY, &Cpu6502::ABS}, Opcode6502{"STA", 4, &Cpu6502::STA, &Cpu6502::ABS}, Opcode6502{"STX", 4, &Cpu6502::STX, &Cpu6502::ABS}, Opcode6502{"???", 2, &Cpu6502::XXX, &Cpu6502::IMP},
-	Opcode6502{"BCC", 2, &Cpu6502::BCC, &Cpu6502::REL}, Opcode6502{"STA", 6, &Cpu6502::STA, &Cpu6502::IZY}, Opcode6502{"???", 2, &Cpu6502::XXX, &Cpu6502::IMP}, Opcode6502{"???", 2, &Cpu6502::XXX, &Cpu6502::IMP}, Opcode6502{"STY", 4, &Cpu6502::STY, &Cpu6502::ZPX}, Opcode6502{"STA", 4, &Cpu6502::STA, &Cpu6502::ZPX}, Opcode6502{"STX", 4, &Cpu6502::STX, &Cpu6502::ZPY}, Opcode6502{"???", 2, &Cpu6502::XXX, &Cpu6502::IMP}, Opcode6502{"TYA", 2, &Cpu6502::TYA, &Cpu6502::IMP}, Opcode6502{"STA", 5, &Cpu6502::STA, &Cpu6502::ABY}, Opcode6502{"TXS", 2, &Cpu6502::TXS, &Cpu6502::IMP}, Opcode6502{"???", 5, &Cpu6502::XXX, &Cpu6502::IMP}, Opcode6502{"???", 2, &Cpu6502::XXX, &Cpu6502::IMP}, Opcode6502{"STA", 5, &Cpu6502::STA, &Cpu6502::ABX}, Opcode6502{"???", 5, &Cpu6502::XXX, &Cpu6502::IMP}, Opcode6502{"???", 2, &Cpu6502::XXX, &Cpu6502::IMP},
-	Opcode6502{"LDY", 2, &Cpu6502::LDY, &Cpu6502::IMM}, Opcode6502{"LDA", 6, &Cpu6502::LDA, &Cpu6502::IZX}, Opcode6502{"LDX", 2, &Cpu6502::LDX, &Cpu6502::IMM}, Opcode6502{"???", 2, &Cpu6502::XXX, &Cpu6502::IMP}, Opcode6502{"LDY", 3, &Cpu6502::LDY, &Cpu6502::ZP0}, Opcode6502{"LDA", 3, &Cpu6502::LDA, &Cpu6502::ZP0}, Opcode6502{"LDX", 3, &Cpu6502::LDX, &Cpu6502::ZP0}, Opcode6502{"???", 2, &Cpu6502::XXX, &Cpu6502::IMP}, Opcode6502{"TAY", 2, &Cpu6502::TAY, &Cpu6502::IMP}, Opcode6502{"LDA", 2, &Cpu6502::LDA, &Cpu6502::IMM}, Opcode6502{"TAX", 2, &Cpu6502::TAX, &Cpu6502::IMP}, Opcode6502{"???", 2, &Cpu6502::XXX, &Cpu6502::IMP}, Opcode6502{"LDY", 4, &Cpu6502::LDY, &Cpu6502::ABS}, Opcode6502{"LDA", 4, &Cpu6502::LDA, &Cpu6502::ABS}, Opcode6502{"LDX", 4, &Cpu6502::LDX, &Cpu6502::ABS}, Opcode6502{"???", 2, &Cpu6502::XXX, &Cpu6502::IMP},
-	Opcode6502{"BCS", 2, &Cpu6502::BCS, &Cpu6502::REL}, Opcode6502{"LDA", 5, &Cpu6502::LDA, &Cpu6502::IZY}, Opcode6502{"???", 2, &Cpu6502::XXX, &Cpu6502::IMP}, Opcode6502{"???", 2, &Cpu6502::XXX, &Cpu6502::IMP}, Opcode6502{"LDY", 4, &Cpu6502::LDY, &Cpu6502::ZPX}, Opcode6502{"LDA", 4, &Cpu6502::LDA, &Cpu6502::ZPX}, Opcode6502{"LDX", 4, &Cpu6502::LDX, &Cpu6502::ZPY}, Opcode6502{"???", 2, &Cpu6502::XXX, &Cpu6502::IMP}, Opcode6502{"CLV", 2, &Cpu6502::CLV, &Cpu6502::IMP}, Opcode6502{"LDA", 4, &Cpu6502::LDA, &Cpu6502::ABY}, Opcode6502{"TSX", 2, &Cpu6502::TSX, &Cpu6502::IMP}, Opcode6502{"???", 2, &Cpu6502::XXX, &Cpu6502::IMP}, Opcode6502{"LDY", 4, &Cpu6502::LDY, &Cpu6502::ABX}, Opcode6502{"LDA", 4, &Cpu6502::LDA, &Cpu6502::ABX}, Opcode6502{"LDX", 4, &Cpu6502::LDX, &Cpu6502::ABY}, Opcode6502{"???", 2, &Cpu6502::XXX, &Cpu6502::IMP},
-	Opcode6502{"CPY", 2, &Cpu6502::CPY, &Cpu6502::IMM}, Opcode6502{"CMP", 6, &Cpu6502::CMP, &Cpu6502::IZX}, Opcode6502{"???", 2, &Cpu6502::NOP, &Cpu6502::IMP}, Opcode6502{"???", 2, &Cpu6502::XXX, &Cpu6502::IMP}, Opcode6502{"CPY", 3, &Cpu6502::CPY, &Cpu6502::ZP0}, Opcode6502{"CMP", 3, &Cpu6502::CMP, &Cpu6502::ZP0}, Opcode6502{"DEC", 5, &Cpu6502::DEC, &Cpu6502::ZP0}, Opcode6502{"???", 2, &Cpu6502::XXX, &Cpu6502::IMP}, Opcode6502{"INY", 2, &Cpu6502::INY, &Cpu6502::IMP}, Opcode6502{"CMP", 2, &Cpu6502::CMP, &Cpu6502::IMM}, Opcode6502{"DEX", 2, &Cpu6502::DEX, &Cpu6502::IMP}, Opcode6502{"???", 2, &Cpu6502::XXX, &Cpu6502::IMP}, Opcode6502{"CPY", 4, &Cpu6502::CPY, &Cpu6502::ABS}, Opcode6502{"CMP", 4, &Cpu6502::CMP, &Cpu6502::ABS}, Opcode6502{"DEC", 6, &Cpu6502::DEC, &Cpu6502::ABS}, Opcode6502{"???", 2, &Cpu6502::XXX, &Cpu6502::IMP},
-	Opcode6502{"BNE", 2, &Cpu6502::BNE, &Cpu6502::REL}, Opcode6502{"CMP", 5, &Cpu6502::CMP, &Cpu6502::IZY}, Opcode6502{"???", 2, &Cpu6502::XXX, &Cpu6502::IMP}, Opcode6502{"???", 8, &Cpu6502::XXX, &Cpu6502::IMP}, Opcode6502{"???", 2, &Cpu6502::XXX, &Cpu6502::IMP}, Opcode6502{"CMP", 4, &Cpu6502::CMP, &Cpu6502::ZPX}, Opcode6502{"DEC", 6, &Cpu6502::DEC, &Cpu6502::ZPX}, Opcode6502{"???", 2, &Cpu6502::XXX, &Cpu6502::IMP}, Opcode6502{"CLD", 2, &Cpu6502::CLD, &Cpu6502::IMP}, Opcode6502{"CMP", 4, &Cpu6502::CMP, &Cpu6502::ABY}, Opcode6502{"NOP", 2, &Cpu6502::NOP, &Cpu6502::IMP}, Opcode6502{"???", 7, &Cpu6502::XXX, &Cpu6502::IMP}, Opcode6502{"???", 2, &Cpu6502::XXX, &Cpu6502::IMP}, Opcode6502{"CMP", 4, &Cpu6502::CMP, &Cpu6502::ABX}, Opcode6502{"DEC", 7, &Cpu6502::DEC, &Cpu6502::ABX}, Opcode6502{"???", 2, &Cpu6502::XXX, &Cpu6502::IMP},
-	Opcode6502{"CPX", 2, &Cpu6502::CPX, &Cpu6502::IMM}, Opcode6502{"SBC", 6, &Cpu6502::SBC, &Cpu6502::IZX}, Opcode6502{"???", 2, &Cpu6502::NOP, &Cpu6502::IMP}, Opcode6502{"???", 2, &Cpu6502::XXX, &Cpu6502::IMP}, Opcode6502{"CPX", 3, &Cpu6502::CPX, &Cpu6502::ZP0}, Opcode6502{"SBC", 3, &Cpu6502::SBC, &Cpu6502::ZP0}, Opcode6502{"INC", 5, &Cpu6502::INC, &Cpu6502::ZP0}, Opcode6502{"???", 2, &Cpu6502::XXX, &Cpu6502::IMP}, Opcode6502{"INX", 2, &Cpu6502::INX, &Cpu6502::IMP}, Opcode6502{"SBC", 2, &Cpu6502::SBC, &Cpu6502::IMM}, Opcode6502{"NOP", 2, &Cpu6502::NOP, &Cpu6502::IMP}, Opcode6502{"???", 2, &Cpu6502::XXX, &Cpu6502::IMP}, Opcode6502{"CPX", 4, &Cpu6502::CPX, &Cpu6502::ABS}, Opcode6502{"SBC", 4, &Cpu6502::SBC, &Cpu6502::ABS}, Opcode6502{"INC", 6, &Cpu6502::INC, &Cpu6502::ABS}, Opcode6502{"???", 2, &Cpu6502::XXX, &Cpu6502::IMP},
-	Opcode6502{"BEQ", 2, &Cpu6502::BEQ, &Cpu6502::REL}, Opcode6502{"SBC", 5, &Cpu6502::SBC, &Cpu6502::IZY}, Opcode6502{"???", 2, &Cpu6502::XXX, &Cpu6502::IMP}, Opcode6502{"???", 8, &Cpu6502::XXX, &Cpu6502::IMP}, Opcode6502{"???", 2, &Cpu6502::XXX, &Cpu6502::IMP}, Opcode6502{"SBC", 4, &Cpu6502::SBC, &Cpu6502::ZPX}, Opcode6502{"INC", 6, &Cpu6502::INC, &Cpu6502::ZPX}, Opcode6502{"???", 2, &Cpu6502::XXX, &Cpu6502::IMP}, Opcode6502{"SED", 2, &Cpu6502::SED, &Cpu6502::IMP}, Opcode6502{"SBC", 4, &Cpu6502::SBC, &Cpu6502::ABY}, Opcode6502{"NOP", 2, &Cpu6502::NOP, &Cpu6502::IMP}, Opcode6502{"???", 7, &Cpu6502::XXX, &Cpu6502::IMP}, Opcode6502{"???", 2, &Cpu6502::XXX, &Cpu6502::IMP}, Opcode6502{"SBC", 4, &Cpu6502::SBC, &Cpu6502::ABX}, Opcode6502{"INC", 7, &Cpu6502::INC, &Cpu6502::ABX}, Opcode6502{"???", 2, &Cpu6502::XXX, &Cpu6502::IMP},
-};
+// NMOS opcode matrix, shared by the 6502 and the 2A03 - they only differ in decimal mode handling inside ADC/SBC
+template <typename Cpu>
+static std::array<OpcodeEntry<Cpu>, 256> makeNmosTable()
+{
+	using O = OpcodeEntry<Cpu>;
+	return {
+		O{"BRK", 7, &Cpu::BRK, &Cpu::IMM}, O{"ORA", 6, &Cpu::ORA, &Cpu::IZX}, O{"???", 2, &Cpu::XXX, &Cpu::IMP}, O{"???", 8, &Cpu::XXX, &Cpu::IMP}, O{"???", 2, &Cpu::XXX, &Cpu::IMP}, O{"ORA", 3, &Cpu::ORA, &Cpu::ZP0}, O{"ASL", 5, &Cpu::ASL, &Cpu::ZP0}, O{"???", 2, &Cpu::XXX, &Cpu::IMP}, O{"PHP", 3, &Cpu::PHP, &Cpu::IMP}, O{"ORA", 2, &Cpu::ORA, &Cpu::IMM}, O{"ASL", 2, &Cpu::ASL, &Cpu::IMP}, O{"???", 2, &Cpu::XXX, &Cpu::IMP}, O{"???", 2, &Cpu::XXX, &Cpu::IMP}, O{"ORA", 4, &Cpu::ORA, &Cpu::ABS}, O{"ASL", 6, &Cpu::ASL, &Cpu::ABS}, O{"???", 2, &Cpu::XXX, &Cpu::IMP},
+		O{"BPL", 2, &Cpu::BPL, &Cpu::REL}, O{"ORA", 5, &Cpu::ORA, &Cpu::IZY}, O{"???", 2, &Cpu::XXX, &Cpu::IMP}, O{"???", 8, &Cpu::XXX, &Cpu::IMP}, O{"???", 2, &Cpu::XXX, &Cpu::IMP}, O{"ORA", 4, &Cpu::ORA, &Cpu::ZPX}, O{"ASL", 6, &Cpu::ASL, &Cpu::ZPX}, O{"???", 2, &Cpu::XXX, &Cpu::IMP}, O{"CLC", 2, &Cpu::CLC, &Cpu::IMP}, O{"ORA", 4, &Cpu::ORA, &Cpu::ABY}, O{"???", 2, &Cpu::NOP, &Cpu::IMP}, O{"???", 7, &Cpu::XXX, &Cpu::IMP}, O{"???", 2, &Cpu::XXX, &Cpu::IMP}, O{"ORA", 4, &Cpu::ORA, &Cpu::ABX}, O{"ASL", 7, &Cpu::ASL, &Cpu::ABX}, O{"???", 2, &Cpu::XXX, &Cpu::IMP},
+		O{"JSR", 6, &Cpu::JSR, &Cpu::ABS}, O{"AND", 6, &Cpu::AND, &Cpu::IZX}, O{"???", 2, &Cpu::XXX, &Cpu::IMP}, O{"???", 2, &Cpu::XXX, &Cpu::IMP}, O{"BIT", 3, &Cpu::BIT, &Cpu::ZP0}, O{"AND", 3, &Cpu::AND, &Cpu::ZP0}, O{"ROL", 5, &Cpu::ROL, &Cpu::ZP0}, O{"???", 2, &Cpu::XXX, &Cpu::IMP}, O{"PLP", 4, &Cpu::PLP, &Cpu::IMP}, O{"AND", 2, &Cpu::AND, &Cpu::IMM}, O{"ROL", 2, &Cpu::ROL, &Cpu::IMP}, O{"???", 2, &Cpu::XXX, &Cpu::IMP}, O{"BIT", 4, &Cpu::BIT, &Cpu::ABS}, O{"AND", 4, &Cpu::AND, &Cpu::ABS}, O{"ROL", 6, &Cpu::ROL, &Cpu::ABS}, O{"???", 2, &Cpu::XXX, &Cpu::IMP},
+		O{"BMI", 2, &Cpu::BMI, &Cpu::REL}, O{"AND", 5, &Cpu::AND, &Cpu::IZY}, O{"???", 2, &Cpu::XXX, &Cpu::IMP}, O{"???", 8, &Cpu::XXX, &Cpu::IMP}, O{"???", 2, &Cpu::XXX, &Cpu::IMP}, O{"AND", 4, &Cpu::AND, &Cpu::ZPX}, O{"ROL", 6, &Cpu::ROL, &Cpu::ZPX}, O{"???", 2, &Cpu::XXX, &Cpu::IMP}, O{"SEC", 2, &Cpu::SEC, &Cpu::IMP}, O{"AND", 4, &Cpu::AND, &Cpu::ABY}, O{"???", 2, &Cpu::NOP, &Cpu::IMP}, O{"???", 7, &Cpu::XXX, &Cpu::IMP}, O{"???", 2, &Cpu::XXX, &Cpu::IMP}, O{"AND", 4, &Cpu::AND, &Cpu::ABX}, O{"ROL", 7, &Cpu::ROL, &Cpu::ABX}, O{"???", 2, &Cpu::XXX, &Cpu::IMP},
+		O{"RTI", 6, &Cpu::RTI, &Cpu::IMP}, O{"EOR", 6, &Cpu::EOR, &Cpu::IZX}, O{"???", 2, &Cpu::XXX, &Cpu::IMP}, O{"???", 8, &Cpu::XXX, &Cpu::IMP}, O{"???", 2, &Cpu::XXX, &Cpu::IMP}, O{"EOR", 3, &Cpu::EOR, &Cpu::ZP0}, O{"LSR", 5, &Cpu::LSR, &Cpu::ZP0}, O{"???", 2, &Cpu::XXX, &Cpu::IMP}, O{"PHA", 3, &Cpu::PHA, &Cpu::IMP}, O{"EOR", 2, &Cpu::EOR, &Cpu::IMM}, O{"LSR", 2, &Cpu::LSR, &Cpu::IMP}, O{"???", 2, &Cpu::XXX, &Cpu::IMP}, O{"JMP", 3, &Cpu::JMP, &Cpu::ABS}, O{"EOR", 4, &Cpu::EOR, &Cpu::ABS}, O{"LSR", 6, &Cpu::LSR, &Cpu::ABS}, O{"???", 2, &Cpu::XXX, &Cpu::IMP},
+		O{"BVC", 2, &Cpu::BVC, &Cpu::REL}, O{"EOR", 5, &Cpu::EOR, &Cpu::IZY}, O{"???", 2, &Cpu::XXX, &Cpu::IMP}, O{"???", 8, &Cpu::XXX, &Cpu::IMP}, O{"???", 2, &Cpu::XXX, &Cpu::IMP}, O{"EOR", 4, &Cpu::EOR, &Cpu::ZPX}, O{"LSR", 6, &Cpu::LSR, &Cpu::ZPX}, O{"???", 2, &Cpu::XXX, &Cpu::IMP}, O{"CLI", 2, &Cpu::CLI, &Cpu::IMP}, O{"EOR", 4, &Cpu::EOR, &Cpu::ABY}, O{"???", 2, &Cpu::NOP, &Cpu::IMP}, O{"???", 7, &Cpu::XXX, &Cpu::IMP}, O{"???", 2, &Cpu::XXX, &Cpu::IMP}, O{"EOR", 4, &Cpu::EOR, &Cpu::ABX}, O{"LSR", 7, &Cpu::LSR, &Cpu::ABX}, O{"???", 2, &Cpu::XXX, &Cpu::IMP},
+		O{"RTS", 6, &Cpu::RTS, &Cpu::IMP}, O{"ADC", 6, &Cpu::ADC, &Cpu::IZX}, O{"???", 2, &Cpu::XXX, &Cpu::IMP}, O{"???", 8, &Cpu::XXX, &Cpu::IMP}, O{"???", 2, &Cpu::XXX, &Cpu::IMP}, O{"ADC", 3, &Cpu::ADC, &Cpu::ZP0}, O{"ROR", 5, &Cpu::ROR, &Cpu::ZP0}, O{"???", 2, &Cpu::XXX, &Cpu::IMP}, O{"PLA", 4, &Cpu::PLA, &Cpu::IMP}, O{"ADC", 2, &Cpu::ADC, &Cpu::IMM}, O{"ROR", 2, &Cpu::ROR, &Cpu::IMP}, O{"???", 2, &Cpu::XXX, &Cpu::IMP}, O{"JMP", 5, &Cpu::JMP, &Cpu::IND}, O{"ADC", 4, &Cpu::ADC, &Cpu::ABS}, O{"ROR", 6, &Cpu::ROR, &Cpu::ABS}, O{"???", 2, &Cpu::XXX, &Cpu::IMP},
+		O{"BVS", 2, &Cpu::BVS, &Cpu::REL}, O{"ADC", 5, &Cpu::ADC, &Cpu::IZY}, O{"???", 2, &Cpu::XXX, &Cpu::IMP}, O{"???", 8, &Cpu::XXX, &Cpu::IMP}, O{"???", 2, &Cpu::XXX, &Cpu::IMP}, O{"ADC", 4, &Cpu::ADC, &Cpu::ZPX}, O{"ROR", 6, &Cpu::ROR, &Cpu::ZPX}, O{"???", 2, &Cpu::XXX, &Cpu::IMP}, O{"SEI", 2, &Cpu::SEI, &Cpu::IMP}, O{"ADC", 4, &Cpu::ADC, &Cpu::ABY}, O{"???", 2, &Cpu::NOP, &Cpu::IMP}, O{"???", 7, &Cpu::XXX, &Cpu::IMP}, O{"???", 2, &Cpu::XXX, &Cpu::IMP}, O{"ADC", 4, &Cpu::ADC, &Cpu::ABX}, O{"ROR", 7, &Cpu::ROR, &Cpu::ABX}, O{"???", 2, &Cpu::XXX, &Cpu::IMP},
+		O{"???", 2, &Cpu::XXX, &Cpu::IMP}, O{"STA", 6, &Cpu::STA, &Cpu::IZX}, O{"???", 2, &Cpu::NOP, &Cpu::IMP}, O{"???", 2, &Cpu::XXX, &Cpu::IMP}, O{"STY", 3, &Cpu::STY, &Cpu::ZP0}, O{"STA", 3, &Cpu::STA, &Cpu::ZP0}, O{"STX", 3, &Cpu::STX, &Cpu::ZP0}, O{"???", 2, &Cpu::XXX, &Cpu::IMP}, O{"DEY", 2, &Cpu::DEY, &Cpu::IMP}, O{"???", 2, &Cpu::XXX, &Cpu::IMP}, O{"TXA", 2, &Cpu::TXA, &Cpu::IMP}, O{"???", 2, &Cpu::XXX, &Cpu::IMP}, O{"STY", 4, &Cpu::STY, &Cpu::ABS}, O{"STA", 4, &Cpu::STA, &Cpu::ABS}, O{"STX", 4, &Cpu::STX, &Cpu::ABS}, O{"???", 2, &Cpu::XXX, &Cpu::IMP},
+		O{"BCC", 2, &Cpu::BCC, &Cpu::REL}, O{"STA", 6, &Cpu::STA, &Cpu::IZY}, O{"???", 2, &Cpu::XXX, &Cpu::IMP}, O{"???", 2, &Cpu::XXX, &Cpu::IMP}, O{"STY", 4, &Cpu::STY, &Cpu::ZPX}, O{"STA", 4, &Cpu::STA, &Cpu::ZPX}, O{"STX", 4, &Cpu::STX, &Cpu::ZPY}, O{"???", 2, &Cpu::XXX, &Cpu::IMP}, O{"TYA", 2, &Cpu::TYA, &Cpu::IMP}, O{"STA", 5, &Cpu::STA, &Cpu::ABY}, O{"TXS", 2, &Cpu::TXS, &Cpu::IMP}, O{"???", 5, &Cpu::XXX, &Cpu::IMP}, O{"???", 2, &Cpu::XXX, &Cpu::IMP}, O{"STA", 5, &Cpu::STA, &Cpu::ABX}, O{"???", 5, &Cpu::XXX, &Cpu::IMP}, O{"???", 2, &Cpu::XXX, &Cpu::IMP},
+		O{"LDY", 2, &Cpu::LDY, &Cpu::IMM}, O{"LDA", 6, &Cpu::LDA, &Cpu::IZX}, O{"LDX", 2, &Cpu::LDX, &Cpu::IMM}, O{"???", 2, &Cpu::XXX, &Cpu::IMP}, O{"LDY", 3, &Cpu::LDY, &Cpu::ZP0}, O{"LDA", 3, &Cpu::LDA, &Cpu::ZP0}, O{"LDX", 3, &Cpu::LDX, &Cpu::ZP0}, O{"???", 2, &Cpu::XXX, &Cpu::IMP}, O{"TAY", 2, &Cpu::TAY, &Cpu::IMP}, O{"LDA", 2, &Cpu::LDA, &Cpu::IMM}, O{"TAX", 2, &Cpu::TAX, &Cpu::IMP}, O{"???", 2, &Cpu::XXX, &Cpu::IMP}, O{"LDY", 4, &Cpu::LDY, &Cpu::ABS}, O{"LDA", 4, &Cpu::LDA, &Cpu::ABS}, O{"LDX", 4, &Cpu::LDX, &Cpu::ABS}, O{"???", 2, &Cpu::XXX, &Cpu::IMP},
+		O{"BCS", 2, &Cpu::BCS, &Cpu::REL}, O{"LDA", 5, &Cpu::LDA, &Cpu::IZY}, O{"???", 2, &Cpu::XXX, &Cpu::IMP}, O{"???", 2, &Cpu::XXX, &Cpu::IMP}, O{"LDY", 4, &Cpu::LDY, &Cpu::ZPX}, O{"LDA", 4, &Cpu::LDA, &Cpu::ZPX}, O{"LDX", 4, &Cpu::LDX, &Cpu::ZPY}, O{"???", 2, &Cpu::XXX, &Cpu::IMP}, O{"CLV", 2, &Cpu::CLV, &Cpu::IMP}, O{"LDA", 4, &Cpu::LDA, &Cpu::ABY}, O{"TSX", 2, &Cpu::TSX, &Cpu::IMP}, O{"???", 2, &Cpu::XXX, &Cpu::IMP}, O{"LDY", 4, &Cpu::LDY, &Cpu::ABX}, O{"LDA", 4, &Cpu::LDA, &Cpu::ABX}, O{"LDX", 4, &Cpu::LDX, &Cpu::ABY}, O{"???", 2, &Cpu::XXX, &Cpu::IMP},
+		O{"CPY", 2, &Cpu::CPY, &Cpu::IMM}, O{"CMP", 6, &Cpu::CMP, &Cpu::IZX}, O{"???", 2, &Cpu::NOP, &Cpu::IMP}, O{"???", 2, &Cpu::XXX, &Cpu::IMP}, O{"CPY", 3, &Cpu::CPY, &Cpu::ZP0}, O{"CMP", 3, &Cpu::CMP, &Cpu::ZP0}, O{"DEC", 5, &Cpu::DEC, &Cpu::ZP0}, O{"???", 2, &Cpu::XXX, &Cpu::IMP}, O{"INY", 2, &Cpu::INY, &Cpu::IMP}, O{"CMP", 2, &Cpu::CMP, &Cpu::IMM}, O{"DEX", 2, &Cpu::DEX, &Cpu::IMP}, O{"???", 2, &Cpu::XXX, &Cpu::IMP}, O{"CPY", 4, &Cpu::CPY, &Cpu::ABS}, O{"CMP", 4, &Cpu::CMP, &Cpu::ABS}, O{"DEC", 6, &Cpu::DEC, &Cpu::ABS}, O{"???", 2, &Cpu::XXX, &Cpu::IMP},
+		O{"BNE", 2, &Cpu::BNE, &Cpu::REL}, O{"CMP", 5, &Cpu::CMP, &Cpu::IZY}, O{"???", 2, &Cpu::XXX, &Cpu::IMP}, O{"???", 8, &Cpu::XXX, &Cpu::IMP}, O{"???", 2, &Cpu::XXX, &Cpu::IMP}, O{"CMP", 4, &Cpu::CMP, &Cpu::ZPX}, O{"DEC", 6, &Cpu::DEC, &Cpu::ZPX}, O{"???", 2, &Cpu::XXX, &Cpu::IMP}, O{"CLD", 2, &Cpu::CLD, &Cpu::IMP}, O{"CMP", 4, &Cpu::CMP, &Cpu::ABY}, O{"NOP", 2, &Cpu::NOP, &Cpu::IMP}, O{"???", 7, &Cpu::XXX, &Cpu::IMP}, O{"???", 2, &Cpu::XXX, &Cpu::IMP}, O{"CMP", 4, &Cpu::CMP, &Cpu::ABX}, O{"DEC", 7, &Cpu::DEC, &Cpu::ABX}, O{"???", 2, &Cpu::XXX, &Cpu::IMP},
+		O{"CPX", 2, &Cpu::CPX, &Cpu::IMM}, O{"SBC", 6, &Cpu::SBC, &Cpu::IZX}, O{"???", 2, &Cpu::NOP, &Cpu::IMP}, O{"???", 2, &Cpu::XXX, &Cpu::IMP}, O{"CPX", 3, &Cpu::CPX, &Cpu::ZP0}, O{"SBC", 3, &Cpu::SBC, &Cpu::ZP0}, O{"INC", 5, &Cpu::INC, &Cpu::ZP0}, O{"???", 2, &Cpu::XXX, &Cpu::IMP}, O{"INX", 2, &Cpu::INX, &Cpu::IMP}, O{"SBC", 2, &Cpu::SBC, &Cpu::IMM}, O{"NOP", 2, &Cpu::NOP, &Cpu::IMP}, O{"???", 2, &Cpu::XXX, &Cpu::IMP}, O{"CPX", 4, &Cpu::CPX, &Cpu::ABS}, O{"SBC", 4, &Cpu::SBC, &Cpu::ABS}, O{"INC", 6, &Cpu::INC, &Cpu::ABS}, O{"???", 2, &Cpu::XXX, &Cpu::IMP},
+		O{"BEQ", 2, &Cpu::BEQ, &Cpu::REL}, O{"SBC", 5, &Cpu::SBC, &Cpu::IZY}, O{"???", 2, &Cpu::XXX, &Cpu::IMP}, O{"???", 8, &Cpu::XXX, &Cpu::IMP}, O{"???", 2, &Cpu::XXX, &Cpu::IMP}, O{"SBC", 4, &Cpu::SBC, &Cpu::ZPX}, O{"INC", 6, &Cpu::INC, &Cpu::ZPX}, O{"???", 2, &Cpu::XXX, &Cpu::IMP}, O{"SED", 2, &Cpu::SED, &Cpu::IMP}, O{"SBC", 4, &Cpu::SBC, &Cpu::ABY}, O{"NOP", 2, &Cpu::NOP, &Cpu::IMP}, O{"???", 7, &Cpu::XXX, &Cpu::IMP}, O{"???", 2, &Cpu::XXX, &Cpu::IMP}, O{"SBC", 4, &Cpu::SBC, &Cpu::ABX}, O{"INC", 7, &Cpu::INC, &Cpu::ABX}, O{"???", 2, &Cpu::XXX, &Cpu::IMP},
+	};
+}
+
+// 65C02 opcode matrix - NMOS layout plus the CMOS additions. Every undefined opcode is a NOP
+// of a fixed size and duration, and x7/xF are single cycle NOPs (no Rockwell bit instructions)
+template <typename Cpu>
+static std::array<OpcodeEntry<Cpu>, 256> make65C02Table()
+{
+	using O = OpcodeEntry<Cpu>;
+	std::array<OpcodeEntry<Cpu>, 256> table = makeNmosTable<Cpu>();
+
+	for (size_t op = 0; op < table.size(); ++op)
+	{
+		if (table[op].operate == &Cpu::XXX || (op & 0x03) == 0x03)
+			table[op] = O{"NOP", 1, &Cpu::NOP, &Cpu::IMP};
+	}
+	for (uint8_t op : {0x02, 0x22, 0x42, 0x62, 0x82, 0xC2, 0xE2})
+		table[op] = O{"NOP", 2, &Cpu::NOP, &Cpu::IMM};
+	table[0x44] = O{"NOP", 3, &Cpu::NOP, &Cpu::ZP0};
+	for (uint8_t op : {0x54, 0xD4, 0xF4})
+		table[op] = O{"NOP", 4, &Cpu::NOP, &Cpu::ZPX};
+	table[0x5C] = O{"NOP", 8, &Cpu::NOP, &Cpu::ABS};
+	table[0xDC] = O{"NOP", 4, &Cpu::NOP, &Cpu::ABS};
+	table[0xFC] = O{"NOP", 4, &Cpu::NOP, &Cpu::ABS};
+
+	// (zp) addressing
+	table[0x12] = O{"ORA", 5, &Cpu::ORA, &Cpu::ZPI};
+	table[0x32] = O{"AND", 5, &Cpu::AND, &Cpu::ZPI};
+	table[0x52] = O{"EOR", 5, &Cpu::EOR, &Cpu::ZPI};
+	table[0x72] = O{"ADC", 5, &Cpu::ADC, &Cpu::ZPI};
+	table[0x92] = O{"STA", 5, &Cpu::STA, &Cpu::ZPI};
+	table[0xB2] = O{"LDA", 5, &Cpu::LDA, &Cpu::ZPI};
+	table[0xD2] = O{"CMP", 5, &Cpu::CMP, &Cpu::ZPI};
+	table[0xF2] = O{"SBC", 5, &Cpu::SBC, &Cpu::ZPI};
+
+	// New instructions
+	table[0x04] = O{"TSB", 5, &Cpu::TSB, &Cpu::ZP0};
+	table[0x0C] = O{"TSB", 6, &Cpu::TSB, &Cpu::ABS};
+	table[0x14] = O{"TRB", 5, &Cpu::TRB, &Cpu::ZP0};
+	table[0x1C] = O{"TRB", 6, &Cpu::TRB, &Cpu::ABS};
+	table[0x1A] = O{"INC", 2, &Cpu::INC, &Cpu::IMP};
+	table[0x3A] = O{"DEC", 2, &Cpu::DEC, &Cpu::IMP};
+	table[0x34] = O{"BIT", 4, &Cpu::BIT, &Cpu::ZPX};
+	table[0x3C] = O{"BIT", 4, &Cpu::BIT, &Cpu::ABX};
+	table[0x89] = O{"BIT", 2, &Cpu::BIT, &Cpu::IMM};
+	table[0x5A] = O{"PHY", 3, &Cpu::PHY, &Cpu::IMP};
+	table[0x7A] = O{"PLY", 4, &Cpu::PLY, &Cpu::IMP};
+	table[0xDA] = O{"PHX", 3, &Cpu::PHX, &Cpu::IMP};
+	table[0xFA] = O{"PLX", 4, &Cpu::PLX, &Cpu::IMP};
+	table[0x64] = O{"STZ", 3, &Cpu::STZ, &Cpu::ZP0};
+	table[0x74] = O{"STZ", 4, &Cpu::STZ, &Cpu::ZPX};
+	table[0x9C] = O{"STZ", 4, &Cpu::STZ, &Cpu::ABS};
+	table[0x9E] = O{"STZ", 5, &Cpu::STZ, &Cpu::ABX};
+	table[0x80] = O{"BRA", 2, &Cpu::BRA, &Cpu::REL};
+	table[0x7C] = O{"JMP", 6, &Cpu::JMP, &Cpu::IAX};
+
+	// Changed cycle counts - JMP ($xxxx) got one cycle slower with the page wrap fix,
+	// shifts and rotates on abs,X only take the 7th cycle when a page is crossed
+	table[0x6C].cycles = 6;
+	table[0x1E].cycles = 6;
+	table[0x3E].cycles = 6;
+	table[0x5E].cycles = 6;
+	table[0x7E].cycles = 6;
+
+	return table;
+}
+
+const std::array<Opcode6502, 256> OPCODES_6502 = makeNmosTable<Cpu6502>();
+const std::array<Opcode2A03, 256> OPCODES_2A03 = makeNmosTable<Cpu2A03>();
+const std::array<Opcode65C02, 256> OPCODES_65C02 = make65C02Table<Cpu65C02>();
 
 static_assert(OPCODES_6502.size() == 256, "OPCODES_6502 must have 256 entries");
\ No newline at end of file
@@ -1,14 +1,44 @@
 #pragma once
 #include <array>
+#include <utility>
 #include "AddressingMode.h"
+#include "Cpu6502.h"
 
-class Cpu6502;
-
-struct Opcode6502 {
+template <typename Cpu>
+struct OpcodeEntry {
     const char* name;
     uint8_t cycles;
-    bool (Cpu6502::* operate)();
-    bool (Cpu6502::* addrmode)();
+    void (Cpu::* operate)(Operand);
+    Operand (Cpu::* addrmode)();
 };
 
+using Opcode6502 = OpcodeEntry<Cpu6502>;
+using Opcode2A03 = OpcodeEntry<Cpu2A03>;
+using Opcode65C02 = OpcodeEntry<Cpu65C02>;
+
 extern const std::array<Opcode6502, 256> OPCODES_6502;
+extern const std::array<Opcode2A03, 256> OPCODES_2A03;
+extern const std::array<Opcode65C02, 256> OPCODES_65C02;
+
+// Variant tag -> opcode table, resolved by overload at compile time
+inline const std::array<Opcode6502, 256>& opcodeTable(Nmos6502) { return OPCODES_6502; }
+inline const std::array<Opcode2A03, 256>& opcodeTable(Ricoh2A03) { return OPCODES_2A03; }
+inline const std::array<Opcode65C02, 256>& opcodeTable(Cmos65C02) { return OPCODES_65C02; }
+
+// Addressing mode of a table entry, told by its addressing mode function
+template <typename Cpu>
+AddressingMode AddressingModeOf(const OpcodeEntry<Cpu>& entry)
+{
+    const std::pair<Operand (Cpu::*)(), AddressingMode> modes[] = {
+        { &Cpu::IMP, AddressingMode::IMP }, { &Cpu::IMM, AddressingMode::IMM }, { &Cpu::ZP0, AddressingMode::ZP0 },
+        { &Cpu::ZPX, AddressingMode::ZPX }, { &Cpu::ZPY, AddressingMode::ZPY }, { &Cpu::REL, AddressingMode::REL },
+        { &Cpu::ABS, AddressingMode::ABS }, { &Cpu::ABX, AddressingMode::ABX }, { &Cpu::ABY, AddressingMode::ABY },
+        { &Cpu::IND, AddressingMode::IND }, { &Cpu::IZX, AddressingMode::IZX }, { &Cpu::IZY, AddressingMode::IZY },
+        { &Cpu::ZPI, AddressingMode::ZPI }, { &Cpu::IAX, AddressingMode::IAX },
+    };
+    for (const auto& m : modes) {
+        if (entry.addrmode == m.first)
+            return m.second;
+    }
+    return AddressingMode::IMP;
+}
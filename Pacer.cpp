@@ -0,0 +1,131 @@
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <iostream>
+#include <thread>
+
+#include "Cpu6502.h"
+#include "DeviceBus.h"
+#include "Pacer.h"
+
+// Frames the pacer may fall behind before it drops the backlog instead of running it at full speed
+static constexpr uint64_t MAX_BACKLOG_FRAMES = 4;
+
+Pacer::Pacer(double cpuHz, double frameHz) : cpuHz(cpuHz), frameHz(frameHz)
+{
+    // The deadlines divide by both, a zero or negative rate would put every frame at the same instant or in the past
+    assert(cpuHz > 0 && frameHz > 0);
+}
+
+void Pacer::start(uint64_t cycle)
+{
+    startCycle = cycle;
+    frame = 0;
+    stats = PacingStats{};
+    waitedFrames = 0;
+    jitterMean = 0;
+    jitterM2 = 0;
+    startTime = Clock::now();
+    anchor(0, cycle, startTime);
+}
+
+void Pacer::setTurbo(bool enabled)
+{
+    if (turbo && !enabled)
+        anchor(frame, startCycle + static_cast<uint64_t>(std::llround(static_cast<double>(frame) * cpuHz / frameHz)), Clock::now());
+    turbo = enabled;
+}
+
+// Deadlines from nextFrame on are counted from now, with the CPU at cycle
+void Pacer::anchor(uint64_t nextFrame, uint64_t cycle, Clock::time_point now)
+{
+    anchorFrame = nextFrame;
+    anchorCycle = cycle;
+    anchorTime = now;
+}
+
+uint64_t Pacer::frameEndCycle() const
+{
+    // Rounded from the frame count, so fractional cycles per frame do not drift
+    return startCycle + static_cast<uint64_t>(std::llround(static_cast<double>(frame + 1) * cpuHz / frameHz));
+}
+
+Pacer::Clock::time_point Pacer::deadline(uint64_t frameIndex) const
+{
+    const double seconds = static_cast<double>(frameIndex + 1 - anchorFrame) / frameHz;
+    return anchorTime + std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(seconds));
+}
+
+void Pacer::endFrame(uint64_t cycle)
+{
+    Clock::time_point now = Clock::now();
+
+    if (!turbo) {
+        const Clock::time_point due = deadline(frame);
+        if (now < due) {
+            if (due - now > spin)
+                std::this_thread::sleep_until(due - spin);
+            while ((now = Clock::now()) < due)
+                std::this_thread::yield();
+
+            const double jitterUs = std::chrono::duration<double, std::micro>(now - due).count();
+            ++waitedFrames;
+            const double delta = jitterUs - jitterMean;
+            jitterMean += delta / static_cast<double>(waitedFrames);
+            jitterM2 += delta * (jitterUs - jitterMean);
+            stats.maxJitterUs = std::max(stats.maxJitterUs, jitterUs);
+        } else {
+            ++stats.lateFrames;
+            if (now - due > std::chrono::duration<double>(static_cast<double>(MAX_BACKLOG_FRAMES) / frameHz)) {
+                // Host stalled (or a slow frame) - running the backlog flat out would only be a burst of fast frames
+                ++stats.resyncs;
+                anchor(frame + 1, cycle, now);
+            }
+        }
+
+        const double wallUs = std::chrono::duration<double, std::micro>(now - anchorTime).count();
+        const double emulatedUs = static_cast<double>(cycle - anchorCycle) / cpuHz * 1e6;
+        stats.driftUs = wallUs - emulatedUs;
+        stats.maxDriftUs = std::max(stats.maxDriftUs, std::abs(stats.driftUs));
+    }
+
+    ++frame;
+    ++stats.frames;
+    stats.meanJitterUs = jitterMean;
+    stats.stddevJitterUs = waitedFrames > 1 ? std::sqrt(jitterM2 / static_cast<double>(waitedFrames - 1)) : 0.0;
+    const double wallSeconds = std::chrono::duration<double>(now - startTime).count();
+    stats.speed = wallSeconds > 0 ? static_cast<double>(cycle - startCycle) / cpuHz / wallSeconds : 0.0;
+}
+
+int RunPaceDemo(double cpuHz, double frameHz, double seconds, bool turbo)
+{
+    // Busy guest at $0200: INX / BNE -2 / INY / JMP $0200
+    DeviceBus bus;
+    const uint8_t program[] = { 0xE8, 0xD0, 0xFD, 0xC8, 0x4C, 0x00, 0x02 };
+    for (size_t i = 0; i < sizeof(program); ++i)
+        bus.write(static_cast<uint16_t>(0x0200 + i), program[i]);
+
+    Cpu2A03 cpu(&bus);
+    cpu.PC = 0x0200;
+    cpu.SP = 0xFD;
+    cpu.status = 0x24;
+
+    Pacer pacer(cpuHz, frameHz);
+    pacer.setTurbo(turbo);
+    pacer.start(cpu.totalCycles);
+
+    const uint64_t frames = static_cast<uint64_t>(seconds * frameHz);
+    RunPaced(pacer, frames, [&](uint64_t cycle) {
+        RunSynced(cpu, bus, cycle);
+        return cpu.totalCycles;
+    });
+
+    const PacingStats& s = pacer.getStats();
+    std::cout << s.frames << " frame(s) at " << cpuHz / 1e6 << " MHz / " << frameHz << " Hz" << (turbo ? " (turbo)" : "") << "\n";
+    std::cout << "speed " << s.speed << "x, " << s.lateFrames << " late frame(s), " << s.resyncs << " resync(s)\n";
+    if (!turbo) {
+        std::cout << "drift " << s.driftUs << " us (max " << s.maxDriftUs << " us)\n";
+        std::cout << "jitter mean " << s.meanJitterUs << " us, stddev " << s.stddevJitterUs << " us, max " << s.maxJitterUs << " us" << std::endl;
+    }
+    return 0;
+}
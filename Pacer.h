@@ -0,0 +1,85 @@
+#pragma once
+#include <chrono>
+#include <cstdint>
+
+// Real-time pacing - holds the emulated CPU to a wall-clock frequency, one frame at a time. The machine runs
+// a frame's worth of cycles as fast as it can, then the pacer waits for that frame's absolute deadline: a
+// sleep that wakes a little early followed by a short spin, so OS timer granularity does not turn into jitter.
+// Deadlines are computed from the start of the run, never from the previous wake-up, so errors do not add up.
+// In turbo mode frames are not waited for and the same loop runs flat out.
+
+constexpr double NTSC_CPU_HZ = 1789773.0;
+constexpr double PAL_CPU_HZ = 1662607.0;
+constexpr double NTSC_FRAME_HZ = 60.0988;
+constexpr double PAL_FRAME_HZ = 50.0070;
+
+struct PacingStats {
+    uint64_t frames = 0;
+    uint64_t lateFrames = 0; // Frames that were finished after their deadline
+    uint64_t resyncs = 0;    // Times the pacer fell too far behind and gave up catching up
+    double meanJitterUs = 0; // Wake-up time minus deadline over the frames that were waited for
+    double maxJitterUs = 0;
+    double stddevJitterUs = 0;
+    double driftUs = 0;      // Wall clock minus emulated time at the last frame (since the last resync)
+    double maxDriftUs = 0;   // Largest |drift| seen
+    double speed = 0;        // Emulated seconds per wall-clock second
+};
+
+class Pacer {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    explicit Pacer(double cpuHz = NTSC_CPU_HZ, double frameHz = NTSC_FRAME_HZ);
+
+    // Turbo runs unthrottled, switching back re-anchors the deadlines at the current frame
+    void setTurbo(bool enabled);
+    bool getTurbo() const { return turbo; }
+
+    // How long before a deadline the sleep ends and the spin starts
+    void setSpin(std::chrono::microseconds margin) { spin = margin; }
+
+    // Begins pacing at the CPU's current cycle
+    void start(uint64_t cycle);
+
+    // Cycle the current frame ends at - run the machine up to it, then call endFrame()
+    uint64_t frameEndCycle() const;
+
+    // Finishes the frame, cycle is where the CPU actually stopped (instructions may overshoot the frame end)
+    void endFrame(uint64_t cycle);
+
+    const PacingStats& getStats() const { return stats; }
+
+private:
+    // Wall-clock deadline of the end of frame
+    Clock::time_point deadline(uint64_t frameIndex) const;
+    void anchor(uint64_t nextFrame, uint64_t cycle, Clock::time_point now);
+
+    double cpuHz;
+    double frameHz;
+    bool turbo = false;
+    std::chrono::microseconds spin{ 2000 };
+
+    uint64_t startCycle = 0;
+    uint64_t frame = 0;         // Frames since start
+    uint64_t anchorFrame = 0;   // Frame the deadlines are counted from
+    uint64_t anchorCycle = 0;
+    Clock::time_point anchorTime;
+    Clock::time_point startTime;
+
+    PacingStats stats;
+    uint64_t waitedFrames = 0;
+    double jitterMean = 0; // Welford's running mean and sum of squares
+    double jitterM2 = 0;
+};
+
+// Runs frames paced frames. runUntil(cycle) advances the machine to at least cycle and returns its cycle counter,
+// e.g. [&](uint64_t c) { RunSynced(cpu, bus, c); return cpu.totalCycles; }
+template <typename RunUntil>
+void RunPaced(Pacer& pacer, uint64_t frames, RunUntil&& runUntil)
+{
+    for (uint64_t i = 0; i < frames; ++i)
+        pacer.endFrame(runUntil(pacer.frameEndCycle()));
+}
+
+// pace [ntsc|pal|hz] [seconds] [turbo] - paces a busy loop and prints the drift and jitter statistics
+int RunPaceDemo(double cpuHz, double frameHz, double seconds, bool turbo);
@@ -0,0 +1,128 @@
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "Cpu6502.h"
+#include "MappedBus.h"
+#include "PerfBench.h"
+#include "PerfCounters.h"
+
+// 2 KB RAM mirrored to $1FFF, the programs in ROM at $8000 so a stray store cannot change them
+using BenchBus = MappedBus<Region<0x0000, 0x2000, 0x07FF, RamBacking<0x800>>,
+                           Region<0x8000, 0x10000, 0x7FFF, RomBacking<0x8000>>>;
+
+struct BenchProgram {
+    const char* group;
+    std::vector<uint8_t> code; // Loaded at $8000, ends in JMP $8000
+};
+
+static const std::vector<BenchProgram>& BenchPrograms()
+{
+    static const std::vector<BenchProgram> programs = {
+        // LDA $10 / STA $11 / LDX $12 / STX $13 / LDY #$05 / STY $14 / LDA $0300,X / STA $0400,Y / LDA ($20),Y / STA ($22,X)
+        { "load/store", { 0xA5, 0x10, 0x85, 0x11, 0xA6, 0x12, 0x86, 0x13, 0xA0, 0x05, 0x84, 0x14, 0xBD, 0x00, 0x03,
+                          0x99, 0x00, 0x04, 0xB1, 0x20, 0x81, 0x22, 0x4C, 0x00, 0x80 } },
+        // ADC #$13 / SBC $10 / AND #$F7 / ORA $11 / EOR #$5A / CMP #$40 / CPX $12 / CPY #$03 / ADC $0300,X / BIT $10
+        { "alu", { 0x69, 0x13, 0xE5, 0x10, 0x29, 0xF7, 0x05, 0x11, 0x49, 0x5A, 0xC9, 0x40, 0xE4, 0x12, 0xC0, 0x03,
+                   0x7D, 0x00, 0x03, 0x24, 0x10, 0x4C, 0x00, 0x80 } },
+        // INC $10 / DEC $11 / ASL $12 / LSR $13 / ROL $14 / ROR $15 / ASL A / ROR A / INC $0300,X / INX / DEY
+        { "rmw", { 0xE6, 0x10, 0xC6, 0x11, 0x06, 0x12, 0x46, 0x13, 0x26, 0x14, 0x66, 0x15, 0x0A, 0x6A, 0xFE, 0x00, 0x03,
+                   0xE8, 0x88, 0x4C, 0x00, 0x80 } },
+        // Galois LFSR in $10 drives data-dependent branches, then always-taken ones:
+        // LDA $10 / ASL A / BCC +2 / EOR #$1D / STA $10 / BMI +1 / NOP / AND #$04 / BEQ +1 / NOP / SEC / BCS +0 / CLC / BCC +0
+        { "branch", { 0xA5, 0x10, 0x0A, 0x90, 0x02, 0x49, 0x1D, 0x85, 0x10, 0x30, 0x01, 0xEA, 0x29, 0x04, 0xF0, 0x01,
+                      0xEA, 0x38, 0xB0, 0x00, 0x18, 0x90, 0x00, 0x4C, 0x00, 0x80 } },
+        // CLC / SEC / CLI / SEI / CLV / CLD / TAX / TAY / TXA / TYA / TSX / TXS / INX / INY
+        { "flags/transfer", { 0x18, 0x38, 0x58, 0x78, 0xB8, 0xD8, 0xAA, 0xA8, 0x8A, 0x98, 0xBA, 0x9A, 0xE8, 0xC8,
+                              0x4C, 0x00, 0x80 } },
+        // PHA / PLA / PHP / PLP / JSR $800A / JMP $8000 / $800A: JSR $800E / RTS / $800E: RTS
+        { "stack/flow", { 0x48, 0x68, 0x08, 0x28, 0x20, 0x0A, 0x80, 0x4C, 0x00, 0x80, 0x20, 0x0E, 0x80, 0x60, 0x60 } },
+        // LDX #$00 / loop: LDA $0300,X / CLC / ADC #$01 / STA $0400,X / INX / BNE loop
+        { "mixed", { 0xA2, 0x00, 0xBD, 0x00, 0x03, 0x18, 0x69, 0x01, 0x9D, 0x00, 0x04, 0xE8, 0xD0, 0xF4, 0x4C, 0x00, 0x80 } },
+    };
+    return programs;
+}
+
+static uint64_t RunInstructions(Cpu6502& cpu, uint64_t instructions)
+{
+    for (uint64_t i = 0; i < instructions; ++i) {
+        do {
+            cpu.clock();
+        } while (!cpu.instructionComplete());
+    }
+    return cpu.totalCycles;
+}
+
+// Counter value per emulated instruction, "-" where the host does not provide it
+static std::string PerInstruction(const PerfCounters::Sample& sample, PerfCounters::Counter counter, uint64_t instructions)
+{
+    if (!sample.valid[counter])
+        return "-";
+    std::ostringstream out;
+    out << std::fixed << std::setprecision(counter >= PerfCounters::BRANCH_MISSES ? 4 : 1)
+        << static_cast<double>(sample.values[counter]) / static_cast<double>(instructions);
+    return out.str();
+}
+
+int RunPerfBench(uint64_t instructions)
+{
+    PerfCounters counters;
+    if (!counters.open())
+        std::cout << "hardware counters unavailable (" << counters.getError() << "), wall time only\n";
+    else if (!counters.has(PerfCounters::INSTRUCTIONS))
+        std::cout << "hardware counters unavailable on this host, software counters only\n";
+
+    std::cout << instructions << " emulated instruction(s) per group, per emulated instruction:\n";
+    std::cout << std::left << std::setw(16) << "group" << std::right
+              << std::setw(8) << "ns" << std::setw(8) << "cyc6502" << std::setw(8) << "cpu-ns"
+              << std::setw(8) << "instr" << std::setw(8) << "cycles" << std::setw(7) << "IPC"
+              << std::setw(10) << "br-miss" << std::setw(10) << "L1d-miss" << std::setw(10) << "LLC-miss" << "\n";
+
+    for (const BenchProgram& program : BenchPrograms()) {
+        auto bus = std::make_unique<BenchBus>();
+        std::copy(program.code.begin(), program.code.end(), bus->backing<1>().data.begin());
+        bus->write(0x0010, 0x01); // LFSR seed, must not be zero
+
+        Cpu6502 cpu(bus.get());
+        cpu.PC = 0x8000;
+        cpu.SP = 0xFD;
+        cpu.status = 0x24;
+
+        // Warm the host caches and branch predictors before counting
+        RunInstructions(cpu, instructions / 10);
+        const uint64_t startCycles = cpu.totalCycles;
+
+        const auto begin = std::chrono::steady_clock::now();
+        counters.start();
+        const uint64_t endCycles = RunInstructions(cpu, instructions);
+        const PerfCounters::Sample sample = counters.stop();
+        const double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - begin).count();
+
+        const double perInstruction = static_cast<double>(instructions);
+        std::string ipc = "-";
+        if (sample.valid[PerfCounters::INSTRUCTIONS] && sample.valid[PerfCounters::CYCLES] && sample.values[PerfCounters::CYCLES] != 0) {
+            std::ostringstream out;
+            out << std::fixed << std::setprecision(2)
+                << static_cast<double>(sample.values[PerfCounters::INSTRUCTIONS]) / static_cast<double>(sample.values[PerfCounters::CYCLES]);
+            ipc = out.str();
+        }
+
+        std::cout << std::left << std::setw(16) << program.group << std::right << std::fixed << std::setprecision(1)
+                  << std::setw(8) << ns / perInstruction
+                  << std::setw(8) << static_cast<double>(endCycles - startCycles) / perInstruction
+                  << std::setw(8) << PerInstruction(sample, PerfCounters::TASK_CLOCK, instructions)
+                  << std::setw(8) << PerInstruction(sample, PerfCounters::INSTRUCTIONS, instructions)
+                  << std::setw(8) << PerInstruction(sample, PerfCounters::CYCLES, instructions)
+                  << std::setw(7) << ipc
+                  << std::setw(10) << PerInstruction(sample, PerfCounters::BRANCH_MISSES, instructions)
+                  << std::setw(10) << PerInstruction(sample, PerfCounters::L1D_MISSES, instructions)
+                  << std::setw(10) << PerInstruction(sample, PerfCounters::LLC_MISSES, instructions) << "\n";
+    }
+    std::cout << std::flush;
+    return 0;
+}
@@ -0,0 +1,8 @@
+#pragma once
+#include <cstdint>
+
+// Runs one synthetic guest loop per opcode group (loads/stores, ALU, read-modify-write, branches, flags and
+// transfers, stack and subroutines, a mixed copy loop) on Cpu6502 and reports the host cost per emulated
+// instruction: wall time and, where perf_event_open is available (PerfCounters.h), host instructions, cycles,
+// IPC, branch mispredictions and L1/LLC misses
+int RunPerfBench(uint64_t instructions = 20000000);
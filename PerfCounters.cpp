@@ -0,0 +1,131 @@
+#include <cerrno>
+#include <cstring>
+#include <vector>
+
+#include "PerfCounters.h"
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+const char* PerfCounters::name(Counter counter)
+{
+    static const char* const names[COUNTERS] = { "task-clock", "cycles", "instructions", "branch-misses", "L1d-misses", "LLC-misses" };
+    return names[counter];
+}
+
+#if defined(__linux__)
+
+static int PerfEventOpen(perf_event_attr& attr, int groupFd)
+{
+    return static_cast<int>(syscall(__NR_perf_event_open, &attr, 0, -1, groupFd, 0));
+}
+
+bool PerfCounters::open()
+{
+    struct Event {
+        uint32_t type;
+        uint64_t config;
+    };
+    const Event events[COUNTERS] = {
+        { PERF_TYPE_SOFTWARE, PERF_COUNT_SW_TASK_CLOCK },
+        { PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES },
+        { PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS },
+        { PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES },
+        { PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16) },
+        { PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES },
+    };
+
+    for (int i = 0; i < COUNTERS; ++i) {
+        perf_event_attr attr;
+        std::memset(&attr, 0, sizeof(attr));
+        attr.size = sizeof(attr);
+        attr.type = events[i].type;
+        attr.config = events[i].config;
+        attr.disabled = leader < 0 ? 1 : 0; // The group follows its leader
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_ID | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+        const int fd = PerfEventOpen(attr, leader);
+        if (fd < 0) {
+            if (leader < 0 && i == COUNTERS - 1)
+                error = std::string("perf_event_open: ") + std::strerror(errno);
+            continue;
+        }
+        if (leader < 0)
+            leader = fd;
+        fds[i] = fd;
+        ioctl(fd, PERF_EVENT_IOC_ID, &ids[i]);
+    }
+    if (leader < 0 && error.empty())
+        error = "perf_event_open: no counters available";
+    return leader >= 0;
+}
+
+PerfCounters::~PerfCounters()
+{
+    for (int fd : fds) {
+        if (fd >= 0)
+            close(fd);
+    }
+}
+
+void PerfCounters::start()
+{
+    if (leader < 0)
+        return;
+    ioctl(leader, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+    ioctl(leader, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+}
+
+PerfCounters::Sample PerfCounters::stop()
+{
+    Sample sample;
+    if (leader < 0)
+        return sample;
+    ioctl(leader, PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+
+    // { nr, time_enabled, time_running, { value, id } * nr }
+    std::vector<uint64_t> buffer(3 + 2 * COUNTERS);
+    if (read(leader, buffer.data(), buffer.size() * sizeof(uint64_t)) < static_cast<ssize_t>(3 * sizeof(uint64_t)))
+        return sample;
+
+    const uint64_t count = buffer[0];
+    const double scale = buffer[2] != 0 ? static_cast<double>(buffer[1]) / static_cast<double>(buffer[2]) : 1.0;
+    for (uint64_t n = 0; n < count && n < COUNTERS; ++n) {
+        const uint64_t value = buffer[3 + 2 * n];
+        const uint64_t id = buffer[4 + 2 * n];
+        for (int i = 0; i < COUNTERS; ++i) {
+            if (fds[i] >= 0 && ids[i] == id) {
+                sample.values[i] = static_cast<uint64_t>(static_cast<double>(value) * scale);
+                sample.valid[i] = true;
+            }
+        }
+    }
+    return sample;
+}
+
+#else
+
+bool PerfCounters::open()
+{
+    error = "hardware counters need Linux perf_event_open";
+    return false;
+}
+
+PerfCounters::~PerfCounters() = default;
+
+void PerfCounters::start()
+{
+}
+
+PerfCounters::Sample PerfCounters::stop()
+{
+    return Sample{};
+}
+
+#endif
@@ -0,0 +1,49 @@
+#pragma once
+#include <array>
+#include <cstdint>
+#include <string>
+
+// Host performance counters of the calling thread through Linux perf_event_open, opened as one group so all of
+// them count over exactly the same interval. Counters the host does not provide (no PMU in a VM, a cache event
+// the CPU lacks) are left out individually. Everywhere else open() fails and benchmarks fall back to wall time.
+class PerfCounters {
+public:
+    enum Counter {
+        TASK_CLOCK,    // Software, nanoseconds on the CPU - present whenever perf_event_open works at all
+        CYCLES,
+        INSTRUCTIONS,
+        BRANCH_MISSES,
+        L1D_MISSES,    // L1 data cache read misses
+        LLC_MISSES,    // Last level cache misses
+        COUNTERS
+    };
+
+    struct Sample {
+        std::array<uint64_t, COUNTERS> values{};
+        std::array<bool, COUNTERS> valid{};
+    };
+
+    PerfCounters() = default;
+    ~PerfCounters();
+    PerfCounters(const PerfCounters&) = delete;
+    PerfCounters& operator=(const PerfCounters&) = delete;
+
+    // Opens every counter the host supports, false if none could be opened (see getError())
+    bool open();
+    bool isOpen() const { return leader >= 0; }
+    bool has(Counter counter) const { return fds[counter] >= 0; }
+    const std::string& getError() const { return error; }
+
+    // Resets and enables the group
+    void start();
+    // Disables the group and reads it, scaled up if the kernel had to multiplex the counters
+    Sample stop();
+
+    static const char* name(Counter counter);
+
+private:
+    int leader = -1;
+    std::array<int, COUNTERS> fds{ -1, -1, -1, -1, -1, -1 };
+    std::array<uint64_t, COUNTERS> ids{};
+    std::string error;
+};
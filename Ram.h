@@ -1,5 +1,6 @@
 #pragma once
 #include <array>
+#include <cstddef>
 #include <cstdint>
 
 class RAM {
@@ -9,6 +10,10 @@ public:
     uint8_t read(uint16_t addr) const;
     void write(uint16_t addr, uint8_t data);
 
+    // Backing storage for bulk access (images, snapshots)
+    const uint8_t* data() const { return memory.data(); }
+    uint8_t* data() { return memory.data(); }
+
 private:
     std::array<uint8_t, SIZE> memory{};
 };
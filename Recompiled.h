@@ -0,0 +1,244 @@
+#pragma once
+#include <array>
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "Bus.h"
+#include "Cpu6502.h"
+#include "Flags.h"
+#include "StateHash.h"
+
+// Runtime for code translated ahead of time by the static recompiler (Recompiler.h). Translated blocks are
+// plain C++ functions working on the CPU registers and the bus, the runner dispatches to them by PC and falls
+// back to the interpreter for everything that was not translated or has been overwritten since.
+
+// Forwards to the machine's bus and watches writes to translated code. A write that changes a translated byte
+// sets codeWritten, the runner then retires every block on that page and the interpreter takes over there.
+class CodeGuardBus final : public Bus {
+public:
+    explicit CodeGuardBus(Bus& inner) : inner(inner) {}
+
+    uint8_t read(uint16_t addr) override { return inner.read(addr); }
+    uint8_t fetch(uint16_t addr) override { return inner.fetch(addr); }
+    void write(uint16_t addr, uint8_t data) override {
+        if (codeBytes.test(addr) && data != original[addr]) {
+            dirtyPages.set(addr >> 8);
+            codeWritten = true;
+        }
+        inner.write(addr, data);
+    }
+    bool isPlainMemory(uint16_t addr) const override { return inner.isPlainMemory(addr); }
+    uint8_t peek(uint16_t addr) override { return inner.peek(addr); }
+
+    // Marks addr as translated code, value is the byte the translation was made from
+    void protect(uint16_t addr, uint8_t value) { codeBytes.set(addr); original[addr] = value; }
+
+    bool codeWritten = false;
+    std::bitset<256> dirtyPages;
+
+private:
+    Bus& inner;
+    std::bitset<0x10000> codeBytes;
+    std::array<uint8_t, 0x10000> original{};
+};
+
+template <typename Cpu>
+struct RecompiledContext {
+    Cpu& cpu;
+    CodeGuardBus& bus;
+    void (*trace)(const Cpu& cpu, void* user) = nullptr; // Called before every instruction, e.g. for nestest logs
+    void* traceUser = nullptr;
+};
+
+// A translated block - entered at begin, covers the instruction bytes [begin, end]. It runs until a jump, a
+// taken branch or the next block and leaves PC at the instruction to continue with.
+template <typename Cpu>
+struct RecompiledBlock {
+    uint16_t begin;
+    uint16_t end;
+    uint64_t hash; // HashBytes of [begin, end] at translation time
+    void (*run)(RecompiledContext<Cpu>& ctx);
+};
+
+template <typename Cpu>
+struct RecompiledProgram {
+    const RecompiledBlock<Cpu>* blocks;
+    size_t count;
+};
+
+// === Helpers used by translated code ===
+
+inline memAddress RecompiledWord(byte low, byte high)
+{
+    return static_cast<memAddress>(low | (high << 8));
+}
+
+inline bool GetFlag(const CpuState& cpu, Flags flag)
+{
+    return (cpu.status & static_cast<uint8_t>(flag)) != 0;
+}
+
+inline void SetFlag(CpuState& cpu, Flags flag, bool value)
+{
+    cpu.status = value ? static_cast<byte>(cpu.status | static_cast<uint8_t>(flag))
+                       : static_cast<byte>(cpu.status & ~static_cast<uint8_t>(flag));
+}
+
+inline void SetNZ(CpuState& cpu, byte value)
+{
+    cpu.status = static_cast<byte>((cpu.status & ~(static_cast<uint8_t>(Flags::N) | static_cast<uint8_t>(Flags::Z))) |
+        (value & static_cast<uint8_t>(Flags::N)) | (value == 0 ? static_cast<uint8_t>(Flags::Z) : 0));
+}
+
+inline void Compare(CpuState& cpu, byte reg, byte value)
+{
+    SetFlag(cpu, Flags::C, reg >= value);
+    SetNZ(cpu, static_cast<byte>(reg - value));
+}
+
+inline void BitTest(CpuState& cpu, byte value)
+{
+    SetFlag(cpu, Flags::Z, (cpu.A & value) == 0);
+    SetFlag(cpu, Flags::N, (value & 0x80) != 0);
+    SetFlag(cpu, Flags::V, (value & 0x40) != 0);
+}
+
+// Binary ADC/SBC, decimal mode goes through the CPU's own ADC/SBC
+inline void AddBinary(CpuState& cpu, byte value)
+{
+    const uint16_t result = cpu.A + value + (GetFlag(cpu, Flags::C) ? 1 : 0);
+    SetFlag(cpu, Flags::C, result > 0xFF);
+    SetFlag(cpu, Flags::V, (~(cpu.A ^ value) & (cpu.A ^ result) & 0x80) != 0);
+    cpu.A = static_cast<byte>(result);
+    SetNZ(cpu, cpu.A);
+}
+
+inline void SubtractBinary(CpuState& cpu, byte value)
+{
+    AddBinary(cpu, static_cast<byte>(~value));
+}
+
+inline byte ShiftLeft(CpuState& cpu, byte value)
+{
+    SetFlag(cpu, Flags::C, (value & 0x80) != 0);
+    value = static_cast<byte>(value << 1);
+    SetNZ(cpu, value);
+    return value;
+}
+
+inline byte ShiftRight(CpuState& cpu, byte value)
+{
+    SetFlag(cpu, Flags::C, (value & 0x01) != 0);
+    value = static_cast<byte>(value >> 1);
+    SetNZ(cpu, value);
+    return value;
+}
+
+inline byte RotateLeft(CpuState& cpu, byte value)
+{
+    const bool carry = GetFlag(cpu, Flags::C);
+    SetFlag(cpu, Flags::C, (value & 0x80) != 0);
+    value = static_cast<byte>((value << 1) | (carry ? 0x01 : 0x00));
+    SetNZ(cpu, value);
+    return value;
+}
+
+inline byte RotateRight(CpuState& cpu, byte value)
+{
+    const bool carry = GetFlag(cpu, Flags::C);
+    SetFlag(cpu, Flags::C, (value & 0x01) != 0);
+    value = static_cast<byte>((value >> 1) | (carry ? 0x80 : 0x00));
+    SetNZ(cpu, value);
+    return value;
+}
+
+// Start of a translated instruction - what the interpreter does at its opcode fetch
+template <typename Cpu>
+inline void RecompiledBegin(RecompiledContext<Cpu>& ctx, memAddress pc)
+{
+    if (ctx.trace != nullptr) {
+        ctx.cpu.PC = pc;
+        ctx.trace(ctx.cpu, ctx.traceUser);
+    }
+    ctx.bus.setCycle(ctx.cpu.totalCycles);
+}
+
+// === Dispatch ===
+
+// Runs a machine on translated code where it can. The CPU is connected to the guard bus for as long as the
+// runner lives and back to memory when it is destroyed. Blocks whose bytes in memory differ from the translated
+// ones are never entered.
+template <typename Cpu>
+class RecompiledRunner {
+public:
+    RecompiledRunner(Cpu& cpu, Bus& memory, const RecompiledProgram<Cpu>& program)
+        : memory(memory), guard(memory), ctx{ cpu, guard }, program(program), entries(0x10000, nullptr) {
+        std::vector<uint8_t> bytes;
+        for (size_t i = 0; i < program.count; ++i) {
+            const RecompiledBlock<Cpu>& block = program.blocks[i];
+            bytes.clear();
+            for (uint32_t addr = block.begin; addr <= block.end; ++addr)
+                bytes.push_back(memory.read(static_cast<uint16_t>(addr)));
+            if (HashBytes(bytes.data(), bytes.size()) != block.hash)
+                continue;
+            for (uint32_t addr = block.begin; addr <= block.end; ++addr)
+                guard.protect(static_cast<uint16_t>(addr), bytes[addr - block.begin]);
+            entries[block.begin] = &block;
+        }
+        cpu.connectBus(&guard);
+    }
+    ~RecompiledRunner() { ctx.cpu.connectBus(&memory); }
+
+    // The CPU points at guard, which lives in the runner
+    RecompiledRunner(const RecompiledRunner&) = delete;
+    RecompiledRunner& operator=(const RecompiledRunner&) = delete;
+
+    void setTrace(void (*trace)(const Cpu&, void*), void* user) { ctx.trace = trace; ctx.traceUser = user; }
+
+    // Runs until totalCycles reaches cycleLimit, whole blocks at a time
+    void run(uint64_t cycleLimit) {
+        Cpu& cpu = ctx.cpu;
+        while (cpu.totalCycles < cycleLimit) {
+            if (guard.codeWritten)
+                retireDirtyBlocks();
+
+            const RecompiledBlock<Cpu>* block = cpu.instructionComplete() ? entries[cpu.PC] : nullptr;
+            if (block != nullptr) {
+                cpu.status |= static_cast<uint8_t>(Flags::U);
+                block->run(ctx);
+                ++translatedBlocks;
+                continue;
+            }
+
+            // Interpreter - finishes an interrupt sequence or runs one instruction
+            if (cpu.instructionComplete() && ctx.trace != nullptr)
+                ctx.trace(cpu, ctx.traceUser);
+            do {
+                cpu.clock();
+            } while (!cpu.instructionComplete());
+            ++interpretedInstructions;
+        }
+    }
+
+    uint64_t translatedBlocks = 0;
+    uint64_t interpretedInstructions = 0;
+
+private:
+    void retireDirtyBlocks() {
+        guard.codeWritten = false;
+        for (size_t i = 0; i < program.count; ++i) {
+            const RecompiledBlock<Cpu>& block = program.blocks[i];
+            for (uint32_t page = block.begin >> 8; page <= static_cast<uint32_t>(block.end >> 8); ++page) {
+                if (guard.dirtyPages.test(page))
+                    entries[block.begin] = nullptr;
+            }
+        }
+    }
+
+    Bus& memory;
+    CodeGuardBus guard;
+    RecompiledContext<Cpu> ctx;
+    RecompiledProgram<Cpu> program;
+    std::vector<const RecompiledBlock<Cpu>*> entries; // by address, null where the interpreter runs
+};
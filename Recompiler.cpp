@@ -0,0 +1,621 @@
+#include <array>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "Coverage.h"
+#include "Cpu6502.h"
+#include "MemoryImage.h"
+#include "Opcodes.h"
+#include "Recompiler.h"
+#include "StateHash.h"
+
+static std::string Hex2(unsigned value)
+{
+    char text[8];
+    std::snprintf(text, sizeof(text), "%02X", value & 0xFF);
+    return text;
+}
+
+static std::string Hex4(unsigned value)
+{
+    char text[8];
+    std::snprintf(text, sizeof(text), "%04X", value & 0xFFFF);
+    return text;
+}
+
+static const char* AddressingModeName(AddressingMode mode)
+{
+    static const char* const names[] = { "IMP", "IMM", "ZP0", "ZPX", "ZPY", "REL", "ABS", "ABX", "ABY", "IND", "IZX", "IZY", "ZPI", "IAX" };
+    return names[static_cast<int>(mode)];
+}
+
+template <typename Variant>
+class Translator {
+public:
+    using Cpu = Cpu6502Core<Variant>;
+    using Entry = OpcodeEntry<Cpu>;
+
+    Translator(const std::vector<uint8_t>& image, uint16_t base, const RecompilerOptions& options)
+        : image(image), base(base), options(options), table(opcodeTable(Variant{})) {}
+
+    CodeMap discover();
+    std::string emit(const CodeMap& map);
+
+private:
+    // Decoded instruction at an address of the image
+    struct Instruction {
+        uint16_t pc;
+        uint8_t opcode;
+        const Entry* entry;
+        AddressingMode mode;
+        int length;
+        uint8_t b1, b2;
+        const char* name; // Name of the operation member, e.g. "ADC" for the fallback call
+    };
+
+    bool inImage(uint32_t addr) const { return addr >= base && addr < base + image.size(); }
+    uint8_t at(uint32_t addr) const { return image[addr - base]; }
+
+    bool decode(uint16_t pc, Instruction& ins) const;
+    const char* operationName(const Entry& entry) const;
+    std::string disassemble(const Instruction& ins) const;
+
+    bool chargesPageCross(const Instruction& ins) const;
+    bool mayWriteCode(uint32_t first, uint32_t count) const;
+    void emitInstruction(const Instruction& ins, std::vector<std::string>& statements, bool& ends);
+
+    const std::vector<uint8_t>& image;
+    const uint16_t base;
+    const RecompilerOptions& options;
+    const std::array<Entry, 256>& table;
+    std::vector<bool> codeBytes = std::vector<bool>(0x10000, false);
+};
+
+// Member name of the operation, the table's names do not tell documented and undocumented NOPs apart
+template <typename Variant>
+const char* Translator<Variant>::operationName(const Entry& entry) const
+{
+    const std::pair<void (Cpu::*)(Operand), const char*> operations[] = {
+        { &Cpu::ADC, "ADC" }, { &Cpu::AND, "AND" }, { &Cpu::ASL, "ASL" }, { &Cpu::BCC, "BCC" }, { &Cpu::BCS, "BCS" },
+        { &Cpu::BEQ, "BEQ" }, { &Cpu::BIT, "BIT" }, { &Cpu::BMI, "BMI" }, { &Cpu::BNE, "BNE" }, { &Cpu::BPL, "BPL" },
+        { &Cpu::BRK, "BRK" }, { &Cpu::BVC, "BVC" }, { &Cpu::BVS, "BVS" }, { &Cpu::CLC, "CLC" }, { &Cpu::CLD, "CLD" },
+        { &Cpu::CLI, "CLI" }, { &Cpu::CLV, "CLV" }, { &Cpu::CMP, "CMP" }, { &Cpu::CPX, "CPX" }, { &Cpu::CPY, "CPY" },
+        { &Cpu::DEC, "DEC" }, { &Cpu::DEX, "DEX" }, { &Cpu::DEY, "DEY" }, { &Cpu::EOR, "EOR" }, { &Cpu::INC, "INC" },
+        { &Cpu::INX, "INX" }, { &Cpu::INY, "INY" }, { &Cpu::JMP, "JMP" }, { &Cpu::JSR, "JSR" }, { &Cpu::LDA, "LDA" },
+        { &Cpu::LDX, "LDX" }, { &Cpu::LDY, "LDY" }, { &Cpu::LSR, "LSR" }, { &Cpu::NOP, "NOP" }, { &Cpu::ORA, "ORA" },
+        { &Cpu::PHA, "PHA" }, { &Cpu::PHP, "PHP" }, { &Cpu::PLA, "PLA" }, { &Cpu::PLP, "PLP" }, { &Cpu::ROL, "ROL" },
+        { &Cpu::ROR, "ROR" }, { &Cpu::RTI, "RTI" }, { &Cpu::RTS, "RTS" }, { &Cpu::SBC, "SBC" }, { &Cpu::SEC, "SEC" },
+        { &Cpu::SED, "SED" }, { &Cpu::SEI, "SEI" }, { &Cpu::STA, "STA" }, { &Cpu::STX, "STX" }, { &Cpu::STY, "STY" },
+        { &Cpu::TAX, "TAX" }, { &Cpu::TAY, "TAY" }, { &Cpu::TSX, "TSX" }, { &Cpu::TXA, "TXA" }, { &Cpu::TXS, "TXS" },
+        { &Cpu::TYA, "TYA" }, { &Cpu::BRA, "BRA" }, { &Cpu::PHX, "PHX" }, { &Cpu::PHY, "PHY" }, { &Cpu::PLX, "PLX" },
+        { &Cpu::PLY, "PLY" }, { &Cpu::STZ, "STZ" }, { &Cpu::TRB, "TRB" }, { &Cpu::TSB, "TSB" },
+    };
+    for (const auto& o : operations) {
+        if (entry.operate == o.first)
+            return o.second;
+    }
+    return "XXX";
+}
+
+// Undocumented opcodes and instructions running off the image are left to the interpreter
+template <typename Variant>
+bool Translator<Variant>::decode(uint16_t pc, Instruction& ins) const
+{
+    if (!inImage(pc))
+        return false;
+    ins.pc = pc;
+    ins.opcode = at(pc);
+    ins.entry = &table[ins.opcode];
+    if (ins.entry->operate == &Cpu::XXX)
+        return false;
+    ins.mode = AddressingModeOf(*ins.entry);
+    ins.name = operationName(*ins.entry);
+    ins.length = InstructionLength(ins.mode);
+    if (!inImage(pc + ins.length - 1))
+        return false;
+    ins.b1 = ins.length > 1 ? at(pc + 1) : 0;
+    ins.b2 = ins.length > 2 ? at(pc + 2) : 0;
+    return true;
+}
+
+template <typename Variant>
+CodeMap Translator<Variant>::discover()
+{
+    CodeMap map;
+    std::vector<uint16_t> work;
+    auto addLeader = [&](uint16_t addr) {
+        if (map.leaders.insert(addr).second)
+            work.push_back(addr);
+    };
+
+    addLeader(base);
+    for (uint32_t vector : { 0xFFFAu, 0xFFFCu, 0xFFFEu }) {
+        if (inImage(vector) && inImage(vector + 1))
+            addLeader(static_cast<uint16_t>(at(vector) | (at(vector + 1) << 8)));
+    }
+    for (uint16_t entry : options.entries)
+        addLeader(entry);
+
+    while (!work.empty()) {
+        uint16_t pc = work.back();
+        work.pop_back();
+
+        Instruction ins;
+        while (!map.instructions.count(pc) && decode(pc, ins)) {
+            map.instructions.insert(pc);
+            for (int i = 0; i < ins.length; ++i)
+                codeBytes[pc + i] = true;
+
+            const std::string name = ins.name;
+            const uint16_t next = static_cast<uint16_t>(pc + ins.length);
+            const uint16_t absolute = static_cast<uint16_t>(ins.b1 | (ins.b2 << 8));
+            if (ins.mode == AddressingMode::REL) {
+                addLeader(static_cast<uint16_t>(next + static_cast<int8_t>(ins.b1)));
+                if (name == "BRA")
+                    break;
+            } else if (name == "JMP") {
+                if (ins.mode == AddressingMode::ABS)
+                    addLeader(absolute);
+                break;
+            } else if (name == "JSR") {
+                addLeader(absolute);
+                addLeader(next);
+                break;
+            } else if (name == "RTS" || name == "RTI" || name == "BRK") {
+                break;
+            }
+            pc = next;
+        }
+    }
+
+    // Leaders that turned out not to be code are entered through the interpreter
+    for (auto it = map.leaders.begin(); it != map.leaders.end();) {
+        it = map.instructions.count(*it) ? std::next(it) : map.leaders.erase(it);
+    }
+    return map;
+}
+
+template <typename Variant>
+std::string Translator<Variant>::disassemble(const Instruction& ins) const
+{
+    const std::string byteOperand = "$" + Hex2(ins.b1);
+    const std::string wordOperand = "$" + Hex4(ins.b1 | (ins.b2 << 8));
+    std::string text = ins.entry->name;
+    switch (ins.mode) {
+    case AddressingMode::IMP: break;
+    case AddressingMode::IMM: text += " #" + byteOperand; break;
+    case AddressingMode::ZP0: text += " " + byteOperand; break;
+    case AddressingMode::ZPX: text += " " + byteOperand + ",X"; break;
+    case AddressingMode::ZPY: text += " " + byteOperand + ",Y"; break;
+    case AddressingMode::REL: text += " $" + Hex4(ins.pc + 2 + static_cast<int8_t>(ins.b1)); break;
+    case AddressingMode::ABS: text += " " + wordOperand; break;
+    case AddressingMode::ABX: text += " " + wordOperand + ",X"; break;
+    case AddressingMode::ABY: text += " " + wordOperand + ",Y"; break;
+    case AddressingMode::IND: text += " (" + wordOperand + ")"; break;
+    case AddressingMode::IZX: text += " (" + byteOperand + ",X)"; break;
+    case AddressingMode::IZY: text += " (" + byteOperand + "),Y"; break;
+    case AddressingMode::ZPI: text += " (" + byteOperand + ")"; break;
+    case AddressingMode::IAX: text += " (" + wordOperand + ",X)"; break;
+    }
+    return text;
+}
+
+// Same rule as Cpu6502Core::clock() - stores and read-modify-write instructions already pay the indexed worst case
+template <typename Variant>
+bool Translator<Variant>::chargesPageCross(const Instruction& ins) const
+{
+    const std::string name = ins.name;
+    if (name == "STA" || name == "STX" || name == "STY" || name == "INC" || name == "DEC")
+        return false;
+    if (Variant::cmosExtensions)
+        return name != "STZ";
+    return name != "ASL" && name != "LSR" && name != "ROL" && name != "ROR";
+}
+
+// True if a write somewhere in [first, first + count) could change translated code, only those pay for the check
+template <typename Variant>
+bool Translator<Variant>::mayWriteCode(uint32_t first, uint32_t count) const
+{
+    for (uint32_t i = 0; i < count; ++i) {
+        if (codeBytes[(first + i) & 0xFFFF])
+            return true;
+    }
+    return false;
+}
+
+// Emits the statements of one instruction. Operands are resolved at translation time where the interpreter would read them from
+// the instruction bytes, everything that depends on registers or memory is computed at run time with the same bus
+// accesses. Sets ends if the block cannot continue after it.
+template <typename Variant>
+void Translator<Variant>::emitInstruction(const Instruction& ins, std::vector<std::string>& statements, bool& ends)
+{
+    const std::string name = ins.name;
+    const uint16_t next = static_cast<uint16_t>(ins.pc + ins.length);
+    const unsigned absolute = ins.b1 | (ins.b2 << 8);
+    const std::string nextPc = "0x" + Hex4(next);
+    unsigned cycles = ins.entry->cycles;
+
+    auto line = [&](const std::string& text) { statements.push_back(text); };
+    auto leave = [&](const std::string& pc) {
+        line("cpu.PC = " + pc + ";");
+        line("return;");
+        ends = true;
+    };
+    auto addCycles = [&](const std::string& extra = "") {
+        line("cpu.totalCycles += " + std::to_string(cycles) + extra + ";");
+    };
+
+    // Effective address, page crossing and the range of addresses a write could hit
+    std::string ea = "0x" + Hex4(absolute);
+    std::string crossed = "false";
+    uint32_t writeFirst = 0, writeCount = 0x10000;
+    const bool needsOperand = name != "NOP" && ins.mode != AddressingMode::IMP && ins.mode != AddressingMode::REL;
+    if (needsOperand) {
+        switch (ins.mode) {
+        case AddressingMode::IMM:
+            ea = "0x" + Hex4(ins.pc + 1);
+            break;
+        case AddressingMode::ZP0:
+            ea = "0x" + Hex4(ins.b1);
+            writeFirst = ins.b1; writeCount = 1;
+            break;
+        case AddressingMode::ZPX:
+        case AddressingMode::ZPY:
+            line(std::string("const memAddress ea = static_cast<byte>(0x") + Hex2(ins.b1) +
+                 (ins.mode == AddressingMode::ZPX ? " + cpu.X);" : " + cpu.Y);"));
+            ea = "ea";
+            writeFirst = 0; writeCount = 0x100;
+            break;
+        case AddressingMode::ABS:
+            writeFirst = absolute; writeCount = 1;
+            break;
+        case AddressingMode::ABX:
+        case AddressingMode::ABY:
+            line("const memAddress ea = static_cast<memAddress>(0x" + Hex4(absolute) +
+                 (ins.mode == AddressingMode::ABX ? " + cpu.X);" : " + cpu.Y);"));
+            ea = "ea";
+            crossed = "(ea & 0xFF00) != 0x" + Hex4(absolute & 0xFF00);
+            writeFirst = absolute; writeCount = 0x100;
+            break;
+        case AddressingMode::IZX:
+            line("const byte pointer = static_cast<byte>(0x" + Hex2(ins.b1) + " + cpu.X);");
+            line("const memAddress ea = RecompiledWord(bus.read(pointer), bus.read(static_cast<byte>(pointer + 1)));");
+            ea = "ea";
+            break;
+        case AddressingMode::IZY:
+            line("const memAddress pointer = RecompiledWord(bus.read(0x" + Hex2(ins.b1) + "), bus.read(0x" +
+                 Hex2(ins.b1 + 1) + "));");
+            line("const memAddress ea = static_cast<memAddress>(pointer + cpu.Y);");
+            ea = "ea";
+            crossed = "(ea & 0xFF00) != (pointer & 0xFF00)";
+            break;
+        case AddressingMode::ZPI:
+            line("const memAddress ea = RecompiledWord(bus.read(0x" + Hex2(ins.b1) + "), bus.read(0x" +
+                 Hex2(ins.b1 + 1) + "));");
+            ea = "ea";
+            break;
+        default:
+            break;
+        }
+    }
+    const bool accumulator = ins.mode == AddressingMode::IMP;
+    const std::string value = ins.mode == AddressingMode::IMM ? "0x" + Hex2(ins.b1) : accumulator ? "cpu.A" : "bus.read(" + ea + ")";
+    const std::string penalty = (crossed != "false" && chargesPageCross(ins)) ? " + ((" + crossed + ") ? 1 : 0)" : "";
+    const std::string stack = "static_cast<memAddress>(0x0100 + cpu.SP--)";
+
+    // Leaves the block after a write that changed translated code
+    auto guardWrite = [&](uint32_t first, uint32_t count) {
+        if (mayWriteCode(first, count))
+            line("if (ctx.bus.codeWritten) { cpu.PC = " + nextPc + "; return; }");
+    };
+    // Operations without an inline form run through the interpreter's own implementation
+    auto callOperation = [&]() {
+        line("cpu.PC = " + nextPc + ";");
+        line(std::string("cpu.") + name + "({ " + ea + ", AddressingMode::" + AddressingModeName(ins.mode) + ", " + crossed + " });");
+        addCycles(penalty + " + cpu.cycles");
+        line("cpu.cycles = 0;");
+    };
+
+    const char* reg = name.size() == 3 ? (name[2] == 'X' ? "cpu.X" : name[2] == 'Y' ? "cpu.Y" : "cpu.A") : "cpu.A";
+
+    if (ins.mode == AddressingMode::REL) {
+        // Bxx - opcode xxy10000 branches on flag xx being y, BRA always
+        const uint16_t target = static_cast<uint16_t>(next + static_cast<int8_t>(ins.b1));
+        const unsigned taken = 1 + (((target ^ next) & 0xFF00) != 0 ? 1 : 0);
+        if (name == "BRA") {
+            cycles += taken;
+            addCycles();
+            leave("0x" + Hex4(target));
+            return;
+        }
+        static const char* const flags[] = { "N", "V", "C", "Z" };
+        addCycles();
+        line(std::string("if (") + ((ins.opcode & 0x20) ? "" : "!") + "GetFlag(cpu, Flags::" + flags[ins.opcode >> 6] +
+             ")) { cpu.totalCycles += " + std::to_string(taken) + "; cpu.PC = 0x" + Hex4(target) + "; return; }");
+        return;
+    }
+
+    if (name == "LDA" || name == "LDX" || name == "LDY") {
+        line(std::string(reg) + " = " + value + ";");
+        line(std::string("SetNZ(cpu, ") + reg + ");");
+        addCycles(penalty);
+    } else if (name == "STA" || name == "STX" || name == "STY" || name == "STZ") {
+        line("bus.write(" + ea + ", " + (name == "STZ" ? std::string("0x00") : std::string(reg)) + ");");
+        addCycles();
+        guardWrite(writeFirst, writeCount);
+    } else if (name == "AND" || name == "ORA" || name == "EOR") {
+        const char* op = name == "AND" ? " & " : name == "ORA" ? " | " : " ^ ";
+        line("cpu.A = static_cast<byte>(cpu.A" + std::string(op) + value + ");");
+        line("SetNZ(cpu, cpu.A);");
+        addCycles(penalty);
+    } else if (name == "CMP" || name == "CPX" || name == "CPY") {
+        line(std::string("Compare(cpu, ") + reg + ", " + value + ");");
+        addCycles(penalty);
+    } else if (name == "BIT") {
+        if (Variant::cmosExtensions && ins.mode == AddressingMode::IMM)
+            line("SetFlag(cpu, Flags::Z, (cpu.A & " + value + ") == 0);");
+        else
+            line("BitTest(cpu, " + value + ");");
+        addCycles(penalty);
+    } else if (name == "ADC" || name == "SBC") {
+        const std::string binary = (name == "ADC" ? "AddBinary(cpu, " : "SubtractBinary(cpu, ") + value + ");";
+        if (Variant::decimalMode) {
+            // Decimal arithmetic (and its extra 65C02 cycle) stays in the core
+            line("if (GetFlag(cpu, Flags::D)) { cpu." + name + "({ " + ea + ", AddressingMode::" + AddressingModeName(ins.mode) +
+                 ", " + crossed + " }); cpu.totalCycles += cpu.cycles; cpu.cycles = 0; } else { " + binary + " }");
+        } else {
+            line(binary);
+        }
+        addCycles(penalty);
+    } else if (name == "INC" || name == "DEC") {
+        const char* delta = name == "INC" ? " + 1" : " - 1";
+        if (accumulator) {
+            line(std::string("cpu.A = static_cast<byte>(cpu.A") + delta + ");");
+            line("SetNZ(cpu, cpu.A);");
+            addCycles();
+        } else {
+            line("const byte result = static_cast<byte>(" + value + delta + ");");
+            line("bus.write(" + ea + ", result);");
+            line("SetNZ(cpu, result);");
+            addCycles();
+            guardWrite(writeFirst, writeCount);
+        }
+    } else if (name == "ASL" || name == "LSR" || name == "ROL" || name == "ROR") {
+        const std::string shift = name == "ASL" ? "ShiftLeft" : name == "LSR" ? "ShiftRight" : name == "ROL" ? "RotateLeft" : "RotateRight";
+        if (accumulator) {
+            line("cpu.A = " + shift + "(cpu, cpu.A);");
+            addCycles();
+        } else {
+            line("bus.write(" + ea + ", " + shift + "(cpu, " + value + "));");
+            addCycles(penalty);
+            guardWrite(writeFirst, writeCount);
+        }
+    } else if (name == "TAX" || name == "TAY" || name == "TXA" || name == "TYA" || name == "TSX") {
+        const std::string from = name == "TSX" ? "cpu.SP" : std::string("cpu.") + name[1];
+        const std::string to = std::string("cpu.") + name[2];
+        line(to + " = " + from + ";");
+        line("SetNZ(cpu, " + to + ");");
+        addCycles();
+    } else if (name == "TXS") {
+        line("cpu.SP = cpu.X;");
+        addCycles();
+    } else if (name == "INX" || name == "INY" || name == "DEX" || name == "DEY") {
+        const std::string r = std::string("cpu.") + name[2];
+        line(r + (name[0] == 'I' ? "++;" : "--;"));
+        line("SetNZ(cpu, " + r + ");");
+        addCycles();
+    } else if (name == "CLC" || name == "SEC" || name == "CLI" || name == "SEI" || name == "CLV" || name == "CLD" || name == "SED") {
+        line(std::string("SetFlag(cpu, Flags::") + name[2] + ", " + (name[0] == 'S' ? "true" : "false") + ");");
+        addCycles();
+    } else if (name == "PHA" || name == "PHX" || name == "PHY" || name == "PHP") {
+        const std::string pushed = name == "PHP" ? "static_cast<byte>(cpu.status | 0x30)" : std::string("cpu.") + name[2];
+        line("bus.write(" + stack + ", " + pushed + ");");
+        addCycles();
+        guardWrite(0x100, 0x100);
+    } else if (name == "PLA" || name == "PLX" || name == "PLY") {
+        const std::string r = std::string("cpu.") + name[2];
+        line("cpu.SP++;");
+        line(r + " = bus.read(static_cast<memAddress>(0x0100 + cpu.SP));");
+        line("SetNZ(cpu, " + r + ");");
+        addCycles();
+    } else if (name == "PLP") {
+        line("cpu.SP++;");
+        line("cpu.status = static_cast<byte>((bus.read(static_cast<memAddress>(0x0100 + cpu.SP)) & 0xEF) | 0x20);");
+        addCycles();
+    } else if (name == "NOP") {
+        addCycles();
+    } else if (name == "JMP") {
+        addCycles();
+        if (ins.mode == AddressingMode::ABS) {
+            leave("0x" + Hex4(absolute));
+        } else if (ins.mode == AddressingMode::IND) {
+            // NMOS JMP ($xxFF) takes the high byte from the start of the same page
+            const unsigned high = (!Variant::cmosExtensions && (absolute & 0xFF) == 0xFF) ? (absolute & 0xFF00) : ((absolute + 1) & 0xFFFF);
+            leave("RecompiledWord(bus.read(0x" + Hex4(absolute) + "), bus.read(0x" + Hex4(high) + "))");
+        } else {
+            line("const memAddress pointer = static_cast<memAddress>(0x" + Hex4(absolute) + " + cpu.X);");
+            leave("RecompiledWord(bus.read(pointer), bus.read(static_cast<memAddress>(pointer + 1)))");
+        }
+    } else if (name == "JSR") {
+        const uint16_t ret = static_cast<uint16_t>(ins.pc + 2);
+        line("bus.write(" + stack + ", 0x" + Hex2(ret >> 8) + ");");
+        line("bus.write(" + stack + ", 0x" + Hex2(ret & 0xFF) + ");");
+        addCycles();
+        leave("0x" + Hex4(absolute));
+    } else if (name == "RTS") {
+        line("cpu.SP++;");
+        line("const byte low = bus.read(static_cast<memAddress>(0x0100 + cpu.SP));");
+        line("const byte high = bus.read(static_cast<memAddress>(0x0100 + cpu.SP + 1));");
+        line("cpu.SP++;");
+        addCycles();
+        leave("static_cast<memAddress>(RecompiledWord(low, high) + 1)");
+    } else {
+        // BRK, RTI, TRB, TSB
+        callOperation();
+        if (name == "BRK" || name == "RTI") {
+            line("return;");
+            ends = true;
+        } else {
+            guardWrite(writeFirst, writeCount);
+        }
+    }
+}
+
+template <typename Variant>
+std::string Translator<Variant>::emit(const CodeMap& map)
+{
+    static const char* const cpuNames[] = { "Cpu6502", "Cpu2A03", "Cpu65C02" };
+    const char* cpuName = Variant::cmosExtensions ? cpuNames[2] : Variant::decimalMode ? cpuNames[0] : cpuNames[1];
+
+    std::ostringstream blocks;
+    std::ostringstream list;
+    for (uint16_t leader : map.leaders) {
+        std::ostringstream body;
+        uint16_t pc = leader;
+        uint16_t end = leader;
+        bool ends = false;
+        Instruction ins;
+        while (!ends) {
+            if ((pc != leader && map.leaders.count(pc)) || !map.instructions.count(pc) || !decode(pc, ins)) {
+                // Continues in the next block, or in the interpreter
+                body << "    cpu.PC = 0x" << Hex4(pc) << ";\n";
+                break;
+            }
+            // One line per instruction, in its own scope if it declares locals
+            std::vector<std::string> statements{ "RecompiledBegin(ctx, 0x" + Hex4(pc) + ");" };
+            emitInstruction(ins, statements, ends);
+            bool locals = false;
+            std::string text;
+            for (const std::string& statement : statements) {
+                locals = locals || statement.rfind("const ", 0) == 0;
+                text += (text.empty() ? "" : " ") + statement;
+            }
+            body << "    // " << Hex4(pc) << "  " << disassemble(ins) << "\n";
+            body << "    " << (locals ? "{ " + text + " }" : text) << "\n";
+            end = static_cast<uint16_t>(pc + ins.length - 1);
+            pc = static_cast<uint16_t>(pc + ins.length);
+        }
+
+        const std::string text = body.str();
+        const std::string function = "Block_" + Hex4(leader);
+        blocks << "static void " << function << "(Context& ctx)\n{\n    Cpu& cpu = ctx.cpu;\n";
+        if (text.find("bus.") != std::string::npos)
+            blocks << "    CodeGuardBus& bus = ctx.bus;\n";
+        blocks << text << "}\n\n";
+
+        std::vector<uint8_t> bytes;
+        for (uint32_t addr = leader; addr <= end; ++addr)
+            bytes.push_back(at(addr));
+        char hash[24];
+        std::snprintf(hash, sizeof(hash), "0x%016llXull", static_cast<unsigned long long>(HashBytes(bytes.data(), bytes.size())));
+        list << "    { 0x" << Hex4(leader) << ", 0x" << Hex4(end) << ", " << hash << ", &" << function << " },\n";
+    }
+
+    std::ostringstream out;
+    out << "// Generated by the static recompiler (Recompiler.h) - " << map.instructions.size() << " instruction(s) in "
+        << map.leaders.size() << " block(s),\n// translated from a " << image.size() << " byte image at $" << Hex4(base)
+        << ". Regenerate instead of editing.\n";
+    out << "#include <iterator>\n#include \"Recompiled.h\"\n\n";
+    out << "using Cpu = " << cpuName << ";\nusing Context = RecompiledContext<Cpu>;\n\n";
+    out << blocks.str();
+    out << "static const RecompiledBlock<Cpu> BLOCKS[] = {\n" << list.str() << "};\n\n";
+    out << "extern const RecompiledProgram<Cpu> " << options.symbol << " = { BLOCKS, std::size(BLOCKS) };\n";
+    return out.str();
+}
+
+template <typename Variant>
+static std::string Translate(const std::vector<uint8_t>& image, uint16_t base, const RecompilerOptions& options, CodeMap* map)
+{
+    Translator<Variant> translator(image, base, options);
+    const CodeMap discovered = translator.discover();
+    if (map != nullptr)
+        *map = discovered;
+    return translator.emit(discovered);
+}
+
+std::string RecompileImage(const std::vector<uint8_t>& image, uint16_t base, const RecompilerOptions& options, CodeMap* map)
+{
+    if (options.variant == "6502")
+        return Translate<Nmos6502>(image, base, options, map);
+    if (options.variant == "2a03")
+        return Translate<Ricoh2A03>(image, base, options, map);
+    if (options.variant == "65c02")
+        return Translate<Cmos65C02>(image, base, options, map);
+    return "";
+}
+
+int RunRecompile(int argc, char** argv)
+{
+    if (argc < 5) {
+        std::cerr << "usage: recompile image.bin base out.cpp [symbol] [variant] [entry...]" << std::endl;
+        return 2;
+    }
+
+    std::vector<uint8_t> image;
+    if (!LoadMemoryImage(argv[2], image) || image.empty()) {
+        std::cerr << "Failed to load " << argv[2] << std::endl;
+        return 2;
+    }
+    const uint16_t base = static_cast<uint16_t>(std::stoul(argv[3], nullptr, 16));
+    if (base + image.size() > 0x10000) {
+        std::cerr << "Image does not fit at $" << Hex4(base) << std::endl;
+        return 2;
+    }
+
+    RecompilerOptions options;
+    if (argc > 5)
+        options.symbol = argv[5];
+    if (argc > 6)
+        options.variant = argv[6];
+    std::vector<std::string> coveragePaths;
+    for (int i = 7; i < argc; ++i) {
+        if (argv[i][0] == '@')
+            coveragePaths.push_back(argv[i] + 1);
+        else
+            options.entries.push_back(static_cast<uint16_t>(std::stoul(argv[i], nullptr, 16)));
+    }
+
+    CodeMap map;
+    std::string source = RecompileImage(image, base, options, &map);
+
+    // Instructions a run executed that recursive descent missed (jump tables, RTS tricks) become extra entries.
+    // Ones already discovered are left alone so they do not split blocks.
+    if (!source.empty() && !coveragePaths.empty()) {
+        auto coverage = std::make_unique<Coverage>();
+        size_t added = 0;
+        for (const std::string& path : coveragePaths) {
+            if (!LoadCoverage(path, *coverage)) {
+                std::cerr << "Failed to load coverage " << path << std::endl;
+                return 2;
+            }
+            for (uint32_t addr = base; addr < base + image.size(); ++addr) {
+                if (coverage->opcodes.test(addr) && map.instructions.count(static_cast<uint16_t>(addr)) == 0) {
+                    options.entries.push_back(static_cast<uint16_t>(addr));
+                    ++added;
+                }
+            }
+        }
+        std::cout << added << " entry point(s) from coverage" << std::endl;
+        if (added != 0)
+            source = RecompileImage(image, base, options, &map);
+    }
+    if (source.empty()) {
+        std::cerr << "Unknown variant " << options.variant << std::endl;
+        return 2;
+    }
+
+    std::ofstream out(argv[4], std::ios::trunc);
+    if (!(out << source)) {
+        std::cerr << "Failed to write " << argv[4] << std::endl;
+        return 2;
+    }
+    std::cout << map.instructions.size() << " instruction(s) in " << map.leaders.size() << " block(s)" << std::endl;
+    return 0;
+}
@@ -0,0 +1,29 @@
+#pragma once
+#include <cstdint>
+#include <set>
+#include <string>
+#include <vector>
+
+// Static recompiler - translates a ROM image into C++ source ahead of time. Code is discovered by recursive
+// descent from the image base, the NMI/reset/IRQ vectors and every JSR/JMP/branch target. Each discovered
+// entry point becomes a function that runs the instructions with the interpreter's exact cycle accounting
+// (Recompiled.h); indirect jumps into undiscovered code and overwritten code fall back to the interpreter.
+
+struct RecompilerOptions {
+    std::string variant = "2a03"; // 6502, 2a03 or 65c02
+    std::string symbol = "RECOMPILED_PROGRAM"; // Name of the RecompiledProgram the source defines
+    std::vector<uint16_t> entries; // Extra entry points, e.g. targets of jump tables
+};
+
+// Discovered code - every reachable instruction address and the block entry points among them
+struct CodeMap {
+    std::set<uint16_t> instructions;
+    std::set<uint16_t> leaders;
+};
+
+// Translates image (loaded at base) and returns the generated source, empty if the variant is unknown
+std::string RecompileImage(const std::vector<uint8_t>& image, uint16_t base, const RecompilerOptions& options,
+                           CodeMap* map = nullptr);
+
+// recompile image.bin base out.cpp [symbol] [variant] [entry...]
+int RunRecompile(int argc, char** argv);
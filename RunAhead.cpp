@@ -0,0 +1,217 @@
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "Assembler.h"
+#include "Cpu6502.h"
+#include "DeviceBus.h"
+#include "GuestBench.h"
+#include "RunAhead.h"
+#include "StateHash.h"
+#include "Via.h"
+
+// NTSC frame - the VIA's free-running T1 expires every PERIOD + 2 cycles
+constexpr uint64_t FRAME_CYCLES = 29781;
+constexpr uint16_t JOYPAD = 0x6100;
+
+// A game with the usual two frames of lag: the vblank IRQ shows pos and latches the joypad, the frame after
+// moves pos by the buttons latched the frame before (bit 0 right, bit 1 left) and redraws a 1 KB frame buffer
+static const char* const RUNAHEAD_SOURCE = R"(
+VIA     = $6000
+PAD     = $6100
+PERIOD  = 29779
+FB      = $0200
+PAGES   = 4
+frames  = $00
+ready   = $02
+pad     = $03
+held    = $04
+pos     = $05
+screen  = $06
+ptr     = $08
+
+        .org $8000
+reset:  sei
+        ldx #$FF
+        txs
+        lda #$80
+        sta pos
+        sta screen
+        lda #0
+        sta ready
+        sta pad
+        sta held
+        lda #$40                ; T1 free-running, interrupt enabled
+        sta VIA+$B
+        lda #<PERIOD
+        sta VIA+4
+        lda #>PERIOD
+        sta VIA+5
+        lda #$C0
+        sta VIA+$E
+        cli
+
+wait:   lda ready
+        beq wait
+        lda #0
+        sta ready
+        lda held
+        lsr
+        bcc right
+        inc pos
+right:  lsr
+        bcc left
+        dec pos
+left:   lda pad                 ; Acted on next frame
+        sta held
+        lda #<FB
+        sta ptr
+        lda #>FB
+        sta ptr+1
+        ldx #PAGES
+        ldy #0
+        lda pos
+draw:   sta (ptr),y
+        iny
+        bne draw
+        inc ptr+1
+        dex
+        bne draw
+        jmp wait
+
+irq:    pha
+        lda VIA+4
+        lda pos
+        sta screen
+        lda PAD
+        sta pad
+        lda #1
+        sta ready
+        inc frames
+        bne done
+        inc frames+1
+done:   pla
+nmi:    rti
+
+        .org $FFFA
+        .word nmi, reset, irq
+)";
+
+// Buttons held on the host - input, not machine state, so it has nothing to save
+class JoypadDevice final : public Device {
+public:
+    uint8_t buttons = 0;
+
+    uint8_t readRegister(uint16_t) override { return buttons; }
+    void writeRegister(uint16_t, uint8_t) override {}
+
+protected:
+    void advance(uint64_t, uint64_t) override {}
+};
+
+// Runs to the end of the current frame
+static void RunFrame(Cpu6502& cpu, DeviceBus& bus)
+{
+    RunSynced(cpu, bus, (cpu.totalCycles / FRAME_CYCLES + 1) * FRAME_CYCLES);
+}
+
+int RunRunAheadDemo(int maxAhead)
+{
+    AssembledProgram program;
+    std::string error;
+    if (!Assemble(RUNAHEAD_SOURCE, program, error)) {
+        std::cerr << "runahead: " << error << std::endl;
+        return 2;
+    }
+    const uint16_t screen = program.symbols.at("screen");
+    constexpr int FRAMES = 600;
+    constexpr int PRESS_FRAME = 10;
+    constexpr int GAME_LAG = 2;
+
+    struct Result {
+        int lag = -1;       // Frames from the press to the first frame presented with it
+        double frameUs = 0; // Host time per frame
+        uint64_t hash = 0;  // Real machine state at the end
+        uint64_t ticks = 0;
+    };
+    auto play = [&](int ahead) {
+        DeviceBus bus;
+        ViaDevice via;
+        JoypadDevice joypad;
+        bus.attach(&via, GUEST_VIA, 16);
+        bus.attach(&joypad, JOYPAD, 1);
+        LoadProgram(bus, program);
+        Cpu6502 cpu(&bus);
+        cpu.reset();
+        MachineSnapshot snapshot;
+
+        Result result;
+        const auto begin = std::chrono::steady_clock::now();
+        for (int frame = 0; frame < FRAMES; ++frame) {
+            if (frame == PRESS_FRAME)
+                joypad.buttons = 0x01;
+            RunAheadFrame(cpu, bus, snapshot, ahead, RunFrame, [&](DeviceBus& b) {
+                if (result.lag < 0 && frame >= PRESS_FRAME && b.getRam().read(screen) != 0x80)
+                    result.lag = frame - PRESS_FRAME;
+            });
+        }
+        result.frameUs = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - begin).count() / FRAMES;
+        result.hash = bus.hashState(HashCpuRegisters(cpu));
+        result.ticks = via.getT1Expiries();
+        return result;
+    };
+
+    bool pass = true;
+    const Result reference = play(0);
+    for (int ahead = 0; ahead <= maxAhead; ++ahead) {
+        const Result r = ahead == 0 ? reference : play(ahead);
+        // Run-ahead must not change what the real machine does, only what is shown
+        const bool same = r.hash == reference.hash && r.ticks == reference.ticks;
+        const bool expected = r.lag == std::max(0, GAME_LAG - ahead);
+        pass = pass && same && expected;
+        std::cout << "ahead " << ahead << ": " << r.lag << " frame(s) of lag, " << r.frameUs << " us per frame"
+                  << (same ? "" : ", real state DIFFERS") << (expected ? "" : ", UNEXPECTED lag") << "\n";
+    }
+
+    // Save and restore around one frame, as a run-ahead frame does
+    auto measure = [&](bool incremental) {
+        DeviceBus bus;
+        ViaDevice via;
+        JoypadDevice joypad;
+        bus.attach(&via, GUEST_VIA, 16);
+        bus.attach(&joypad, JOYPAD, 1);
+        LoadProgram(bus, program);
+        Cpu6502 cpu(&bus);
+        cpu.reset();
+        MachineSnapshot snapshot;
+        snapshot.setIncremental(incremental);
+        RunFrame(cpu, bus);
+
+        constexpr int ROUNDS = 2000;
+        std::chrono::steady_clock::duration save{}, restore{};
+        uint64_t pages = 0;
+        for (int i = 0; i < ROUNDS; ++i) {
+            RunFrame(cpu, bus);
+            auto t = std::chrono::steady_clock::now();
+            snapshot.save(cpu, bus);
+            save += std::chrono::steady_clock::now() - t;
+            pages += snapshot.getPagesCopied();
+            RunFrame(cpu, bus);
+            t = std::chrono::steady_clock::now();
+            snapshot.restore(cpu, bus);
+            restore += std::chrono::steady_clock::now() - t;
+            pages += snapshot.getPagesCopied();
+        }
+        const double saveUs = std::chrono::duration<double, std::micro>(save).count() / ROUNDS;
+        const double restoreUs = std::chrono::duration<double, std::micro>(restore).count() / ROUNDS;
+        std::cout << (incremental ? "written pages: " : "full copy:     ") << saveUs << " us save, " << restoreUs << " us restore, "
+                  << static_cast<double>(pages) / (2 * ROUNDS) << " page(s) each, "
+                  << static_cast<uint64_t>(1e6 / (saveUs + restoreUs)) << " save+restore/s\n";
+    };
+    measure(true);
+    measure(false);
+    std::cout << std::flush;
+    return pass ? 0 : 1;
+}
@@ -0,0 +1,32 @@
+#pragma once
+#include "DeviceBus.h"
+#include "Snapshot.h"
+
+// Run-ahead - hides the input lag a game has by design (input read at vblank, acted on one or more frames later).
+// Every host frame runs the real frame with the latest input, saves the machine, runs ahead more frames with the
+// same input, presents the output of the last one and restores the saved state. With ahead at least the game's
+// own lag, a button press shows up in the frame it was pressed in. Costs ahead + 1 frames of emulation plus a
+// snapshot save and restore per host frame.
+//
+// runFrame(cpu, bus) emulates one frame, present(bus) shows the machine's output. A machine with a device that
+// cannot save its state runs without run-ahead. The frames run ahead are undone, so they run with the bus's hooks
+// and input log suspended - monitors, stats and recordings only see the real frames.
+template <typename Cpu, typename RunFrame, typename Present>
+void RunAheadFrame(Cpu& cpu, DeviceBus& bus, MachineSnapshot& snapshot, int ahead, RunFrame&& runFrame, Present&& present)
+{
+    runFrame(cpu, bus);
+    if (ahead <= 0 || !snapshot.save(cpu, bus)) {
+        present(bus);
+        return;
+    }
+    bus.suspendHooks();
+    for (int i = 0; i < ahead; ++i)
+        runFrame(cpu, bus);
+    present(bus);
+    snapshot.restore(cpu, bus);
+    bus.resumeHooks();
+}
+
+// runahead [frames] - input latency of a guest with two frames of lag when running 0 to frames ahead, host cost
+// per frame and the snapshot save and restore rate
+int RunRunAheadDemo(int maxAhead);
@@ -0,0 +1,30 @@
+#pragma once
+#include <cstdint>
+#include "CpuState.h"
+
+class DeviceBus;
+
+// Counts of the current RunSynced call - an interrupt sequence is not an instruction
+struct RunCounts {
+    uint64_t instructions = 0;
+    uint64_t interrupts = 0;
+    uint64_t idleCycles = 0; // Fast-forwarded by idle loop skipping
+};
+
+// Work the run loop does every so many cycles - monitor publications, stats updates, input log checkpoints.
+// Hooks are added to a DeviceBus, which folds their next cycles into its next event, so the loop makes one
+// compare per instruction however many hooks there are and only calls into them once that cycle is reached.
+class RunHook {
+public:
+    virtual ~RunHook() = default;
+
+    // Earliest cycle the hook wants to run at. Read when the hook is added and after every call of runHook,
+    // so it may only move from within runHook.
+    virtual uint64_t nextHookCycle() const = 0;
+
+    // At the first instruction boundary at or past nextHookCycle()
+    virtual void runHook(const CpuState& cpu, DeviceBus& bus, const RunCounts& counts) = 0;
+
+    // End of a RunSynced call
+    virtual void endRunHook(const CpuState&, const RunCounts&) {}
+};
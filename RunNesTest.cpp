@@ -5,10 +5,15 @@
 #include <iostream>
 #include <iomanip>
 #include <cctype>
+#include <chrono>
 
+#include "Coverage.h"
 #include "Cpu6502.h"
 #include "FlatBus.h"
+#include "MemoryImage.h"
+#include "RunNesTest.h"
 #include "Opcodes.h"
+#include "Recompiled.h"
 
 static bool LoadBinaryToBus(Bus& bus, const std::string& path, uint16_t baseAddr)
 {
@@ -30,46 +35,23 @@ static bool LoadBinaryToBus(Bus& bus, const std::string& path, uint16_t baseAddr
     return true;
 }
 
-static bool DumpMemoryToLog(Bus& bus, const std::string& outPath)
-{
-    std::ofstream out(outPath, std::ios::out | std::ios::trunc);
-    if (!out) {
-        return false;
-    }
-
-    out << std::hex << std::uppercase << std::setfill('0');
-
-    for (uint32_t base = 0; base <= 0xFFFF; base += 16) {
-        out << std::setw(4) << base << ":";
-        for (uint32_t i = 0; i < 16; ++i) {
-            uint16_t addr = static_cast<uint16_t>(base + i);
-            uint8_t val = bus.read(addr);
-            out << " " << std::setw(2) << static_cast<unsigned>(val);
-        }
-        out << "\n";
-    }
-
-    out.flush();
-    return true;
-}
-
-static void PrintCpuStateLine(const Cpu6502& cpu, Bus& bus, uint64_t cycAtFetch)
+static void PrintCpuStateLine(std::ostream& out, const Cpu2A03& cpu, Bus& bus, uint64_t cycAtFetch)
 {
     const uint16_t pc = cpu.PC;
     const uint8_t op = bus.read(pc);
-    const Opcode6502& ins = OPCODES_6502[op];
+    const Opcode2A03& ins = OPCODES_2A03[op];
 
     const uint8_t b1 = bus.read(static_cast<uint16_t>(pc + 1));
     const uint8_t b2 = bus.read(static_cast<uint16_t>(pc + 2));
     const uint16_t word = static_cast<uint16_t>(b1) | (static_cast<uint16_t>(b2) << 8);
 
     int byteCount = 1;
-    if (ins.addrmode == &Cpu6502::IMM || ins.addrmode == &Cpu6502::ZP0 || ins.addrmode == &Cpu6502::ZPX ||
-        ins.addrmode == &Cpu6502::ZPY || ins.addrmode == &Cpu6502::REL || ins.addrmode == &Cpu6502::IZX ||
-        ins.addrmode == &Cpu6502::IZY) {
+    if (ins.addrmode == &Cpu2A03::IMM || ins.addrmode == &Cpu2A03::ZP0 || ins.addrmode == &Cpu2A03::ZPX ||
+        ins.addrmode == &Cpu2A03::ZPY || ins.addrmode == &Cpu2A03::REL || ins.addrmode == &Cpu2A03::IZX ||
+        ins.addrmode == &Cpu2A03::IZY) {
         byteCount = 2;
-    } else if (ins.addrmode == &Cpu6502::ABS || ins.addrmode == &Cpu6502::ABX ||
-               ins.addrmode == &Cpu6502::ABY || ins.addrmode == &Cpu6502::IND) {
+    } else if (ins.addrmode == &Cpu2A03::ABS || ins.addrmode == &Cpu2A03::ABX ||
+               ins.addrmode == &Cpu2A03::ABY || ins.addrmode == &Cpu2A03::IND) {
         byteCount = 3;
     } else {
         byteCount = 1;
@@ -78,44 +60,44 @@ static void PrintCpuStateLine(const Cpu6502& cpu, Bus& bus, uint64_t cycAtFetch)
     auto hex2 = [&](uint8_t v) { std::ostringstream s; s << std::hex << std::uppercase << std::setfill('0') << std::setw(2) << static_cast<unsigned>(v); return s.str(); };
     auto hex4 = [&](uint16_t v) { std::ostringstream s; s << std::hex << std::uppercase << std::setfill('0') << std::setw(4) << v; return s.str(); };
 
-    std::cout << std::hex << std::uppercase << std::setfill('0')
-              << std::setw(4) << pc << "  ";
+    out << std::hex << std::uppercase << std::setfill('0')
+        << std::setw(4) << pc << "  ";
 
-    std::cout << std::setw(2) << static_cast<unsigned>(op) << " ";
+    out << std::setw(2) << static_cast<unsigned>(op) << " ";
     if (byteCount >= 2) {
-        std::cout << std::setw(2) << static_cast<unsigned>(b1) << " ";
+        out << std::setw(2) << static_cast<unsigned>(b1) << " ";
     } else {
-        std::cout << "   ";
+        out << "   ";
     }
     if (byteCount >= 3) {
-        std::cout << std::setw(2) << static_cast<unsigned>(b2) << " ";
+        out << std::setw(2) << static_cast<unsigned>(b2) << " ";
     } else {
-        std::cout << "   ";
+        out << "   ";
     }
 
     std::ostringstream mnem;
     mnem << ins.name << " ";
-    if (ins.addrmode == &Cpu6502::IMM) {
+    if (ins.addrmode == &Cpu2A03::IMM) {
         mnem << "#$" << hex2(b1);
-    } else if (ins.addrmode == &Cpu6502::ZP0) {
+    } else if (ins.addrmode == &Cpu2A03::ZP0) {
         mnem << "$" << hex2(b1);
-    } else if (ins.addrmode == &Cpu6502::ZPX) {
+    } else if (ins.addrmode == &Cpu2A03::ZPX) {
         mnem << "$" << hex2(b1) << ",X";
-    } else if (ins.addrmode == &Cpu6502::ZPY) {
+    } else if (ins.addrmode == &Cpu2A03::ZPY) {
         mnem << "$" << hex2(b1) << ",Y";
-    } else if (ins.addrmode == &Cpu6502::ABS) {
+    } else if (ins.addrmode == &Cpu2A03::ABS) {
         mnem << "$" << hex4(word);
-    } else if (ins.addrmode == &Cpu6502::ABX) {
+    } else if (ins.addrmode == &Cpu2A03::ABX) {
         mnem << "$" << hex4(word) << ",X";
-    } else if (ins.addrmode == &Cpu6502::ABY) {
+    } else if (ins.addrmode == &Cpu2A03::ABY) {
         mnem << "$" << hex4(word) << ",Y";
-    } else if (ins.addrmode == &Cpu6502::IND) {
+    } else if (ins.addrmode == &Cpu2A03::IND) {
         mnem << "($" << hex4(word) << ")";
-    } else if (ins.addrmode == &Cpu6502::IZX) {
+    } else if (ins.addrmode == &Cpu2A03::IZX) {
         mnem << "($" << hex2(b1) << ",X)";
-    } else if (ins.addrmode == &Cpu6502::IZY) {
+    } else if (ins.addrmode == &Cpu2A03::IZY) {
         mnem << "($" << hex2(b1) << "),Y";
-    } else if (ins.addrmode == &Cpu6502::REL) {
+    } else if (ins.addrmode == &Cpu2A03::REL) {
         int8_t rel = static_cast<int8_t>(b1);
         uint16_t target = static_cast<uint16_t>(pc + 2 + rel);
         mnem << "$" << hex4(target);
@@ -123,21 +105,23 @@ static void PrintCpuStateLine(const Cpu6502& cpu, Bus& bus, uint64_t cycAtFetch)
 
     std::string m = mnem.str();
     if (m.size() < 28) m.append(28 - m.size(), ' ');
-    std::cout << m;
-
-    std::cout << "A:" << std::setw(2) << static_cast<unsigned>(cpu.A)
-              << " X:" << std::setw(2) << static_cast<unsigned>(cpu.X)
-              << " Y:" << std::setw(2) << static_cast<unsigned>(cpu.Y)
-              << " P:" << std::setw(2) << static_cast<unsigned>(cpu.status)
-              << " SP:" << std::setw(2) << static_cast<unsigned>(cpu.SP)
-              << " CYC:" << std::dec << static_cast<unsigned long long>(cycAtFetch)
-              << std::endl;
+    out << m;
+
+    out << "A:" << std::setw(2) << static_cast<unsigned>(cpu.A)
+        << " X:" << std::setw(2) << static_cast<unsigned>(cpu.X)
+        << " Y:" << std::setw(2) << static_cast<unsigned>(cpu.Y)
+        << " P:" << std::setw(2) << static_cast<unsigned>(cpu.status)
+        << " SP:" << std::setw(2) << static_cast<unsigned>(cpu.SP)
+        << " CYC:" << std::dec << static_cast<unsigned long long>(cycAtFetch)
+        << std::endl;
 }
 
-bool RunNestest(const std::string& binPath, size_t maxInstructions)
+extern const RecompiledProgram<Cpu2A03> NESTEST_RECOMPILED;
+
+// Interpreter trace of the first maxInstructions instructions
+static bool TraceNestest(const std::string& binPath, size_t maxInstructions, std::ostream& out, FlatBus& bus)
 {
-    FlatBus bus;
-    Cpu6502 cpu(&bus);
+    Cpu2A03 cpu(&bus);
 
     const uint16_t programBase = 0xC000;
     if (!LoadBinaryToBus(bus, binPath, programBase)) {
@@ -153,21 +137,239 @@ bool RunNestest(const std::string& binPath, size_t maxInstructions)
     uint64_t totalCycles = 7;
 
     for (size_t i = 0; i < instructionBudget; ++i) {
-        PrintCpuStateLine(cpu, bus, totalCycles);
+        PrintCpuStateLine(out, cpu, bus, totalCycles);
 
         do {
             cpu.clock();
             ++totalCycles;
         } while (!cpu.instructionComplete());
     }
+    return true;
+}
+
+bool RunNestest(const std::string& binPath, size_t maxInstructions, const std::string& imagePath)
+{
+    FlatBus bus;
+    if (!TraceNestest(binPath, maxInstructions, std::cout, bus)) {
+        return false;
+    }
+
+    if (!imagePath.empty() && !DumpMemoryImage(bus.getRam(), imagePath)) {
+        std::cerr << "Failed to write " << imagePath << std::endl;
+        return false;
+    }
+    return true;
+}
+
+struct RecompiledTrace {
+    std::ostream* out;
+    Bus* bus;
+    size_t lines;
+    size_t maxLines;
+};
+
+static void PrintRecompiledLine(const Cpu2A03& cpu, void* user)
+{
+    RecompiledTrace& trace = *static_cast<RecompiledTrace*>(user);
+    if (trace.lines < trace.maxLines)
+        PrintCpuStateLine(*trace.out, cpu, *trace.bus, cpu.totalCycles + 7);
+    ++trace.lines;
+}
+
+// Translated trace of the first maxLines instructions
+static bool TraceNestestRecompiled(const std::string& binPath, size_t maxLines, std::ostream& out)
+{
+    FlatBus bus;
+    Cpu2A03 cpu(&bus);
+    if (!LoadBinaryToBus(bus, binPath, 0xC000)) {
+        return false;
+    }
+    cpu.PC = 0xC000;
+    cpu.SP = 0xFD;
+    cpu.status = 0x24;
+
+    RecompiledRunner<Cpu2A03> runner(cpu, bus, NESTEST_RECOMPILED);
+    RecompiledTrace trace{ &out, &bus, 0, maxLines };
+    runner.setTrace(&PrintRecompiledLine, &trace);
 
-    //if (!DumpMemoryToLog(bus, "results.log")) {
-    //    std::cerr << "Failed to write results.log" << std::endl;
-    //    return false;
-    //}
+    // A block at a time, the trace stops printing at maxLines
+    while (trace.lines < maxLines) {
+        runner.run(cpu.totalCycles + 1);
+    }
     return true;
 }
 
+bool RunNestestRecompiled(const std::string& binPath, size_t maxLines)
+{
+    return TraceNestestRecompiled(binPath, maxLines, std::cout);
+}
+
+// What nestest.log and our trace have in common - PC, registers and cycle count. The disassembly and the PPU
+// position are formatted differently or not emulated.
+static std::string NestestTraceKey(const std::string& line)
+{
+    const size_t registers = line.find(" A:");
+    const size_t cycles = line.find("CYC:");
+    if (line.size() < 4 || registers == std::string::npos || cycles == std::string::npos)
+        return line;
+    std::string cyc = line.substr(cycles);
+    while (!cyc.empty() && std::isspace(static_cast<unsigned char>(cyc.back())))
+        cyc.pop_back();
+    return line.substr(0, 4) + line.substr(registers, 26) + " " + cyc;
+}
+
+// Compares trace line by line with the log, prints the first difference
+static bool MatchesNestestLog(const char* name, const std::string& trace, const std::vector<std::string>& log, size_t maxLines)
+{
+    std::istringstream lines(trace);
+    std::string line;
+    size_t n = 0;
+    for (; n < maxLines && std::getline(lines, line); ++n) {
+        if (n >= log.size() || NestestTraceKey(line) != NestestTraceKey(log[n])) {
+            std::cout << name << ": line " << n + 1 << " differs\n"
+                      << "  expected: " << (n < log.size() ? log[n] : "(end of log)") << "\n"
+                      << "  got:      " << line << std::endl;
+            return false;
+        }
+    }
+    if (n < maxLines) {
+        std::cout << name << ": trace ended after " << n << " line(s)" << std::endl;
+        return false;
+    }
+    std::cout << name << ": " << n << " line(s) match" << std::endl;
+    return true;
+}
+
+int RunNestestCheck(const std::string& binPath, const std::string& logPath, size_t maxLines)
+{
+    std::ifstream file(logPath);
+    if (!file) {
+        std::cerr << "Failed to load " << logPath << std::endl;
+        return 2;
+    }
+    std::vector<std::string> log;
+    for (std::string line; std::getline(file, line);)
+        log.push_back(line);
+
+    std::ostringstream interpreted;
+    std::ostringstream translated;
+    FlatBus bus;
+    if (!TraceNestest(binPath, maxLines, interpreted, bus) || !TraceNestestRecompiled(binPath, maxLines, translated)) {
+        std::cerr << "Failed to load " << binPath << std::endl;
+        return 2;
+    }
+    const bool interpreterOk = MatchesNestestLog("interpreter", interpreted.str(), log, maxLines);
+    const bool translatedOk = MatchesNestestLog("translated", translated.str(), log, maxLines);
+    return interpreterOk && translatedOk ? 0 : 1;
+}
+
+int RunRecompiledBench(const std::string& binPath, unsigned runs)
+{
+    // Cycles of the complete test, up to the final RTS
+    constexpr uint64_t testCycles = 26554 - 7;
+
+    // Fresh memory and registers for every run
+    auto prepare = [&](FlatBus& bus, Cpu2A03& cpu) {
+        bus.getRam() = RAM{};
+        cpu.totalCycles = 0;
+        cpu.PC = 0xC000;
+        cpu.SP = 0xFD;
+        cpu.status = 0x24;
+        return LoadBinaryToBus(bus, binPath, 0xC000);
+    };
+
+    FlatBus bus;
+    Cpu2A03 cpu(&bus);
+    if (!prepare(bus, cpu)) {
+        std::cerr << "Failed to load " << binPath << std::endl;
+        return 2;
+    }
+
+    auto begin = std::chrono::steady_clock::now();
+    uint64_t interpretedCycles = 0;
+    for (unsigned run = 0; run < runs; ++run) {
+        prepare(bus, cpu);
+        while (cpu.totalCycles < testCycles) {
+            do {
+                cpu.clock();
+            } while (!cpu.instructionComplete());
+        }
+        interpretedCycles += cpu.totalCycles;
+    }
+    const double interpretedSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+
+    begin = std::chrono::steady_clock::now();
+    uint64_t translatedCycles = 0;
+    RecompiledRunner<Cpu2A03> runner(cpu, bus, NESTEST_RECOMPILED);
+    for (unsigned run = 0; run < runs; ++run) {
+        prepare(bus, cpu);
+        runner.run(testCycles);
+        translatedCycles += cpu.totalCycles;
+    }
+    const double translatedSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+
+    std::cout << runs << " nestest run(s)\n";
+    std::cout << "interpreter: " << interpretedSeconds << " s (" << interpretedCycles / interpretedSeconds / 1e6 << " MHz)\n";
+    std::cout << "translated:  " << translatedSeconds << " s (" << translatedCycles / translatedSeconds / 1e6 << " MHz), "
+              << runner.translatedBlocks / runs << " block(s) and " << runner.interpretedInstructions / runs << " interpreted instruction(s) per run" << std::endl;
+    return 0;
+}
+
+int RunNestestCoverage(const std::string& binPath, const std::string& outPath, unsigned runs)
+{
+    constexpr uint64_t testCycles = 26554 - 7;
+
+    FlatBus bus;
+    Cpu2A03 cpu(&bus);
+    CoverageBus coverage(bus);
+    auto run = [&](Bus& attached) {
+        bus.getRam() = RAM{};
+        LoadBinaryToBus(bus, binPath, 0xC000);
+        cpu.connectBus(&attached);
+        cpu.totalCycles = 0;
+        cpu.PC = 0xC000;
+        cpu.SP = 0xFD;
+        cpu.status = 0x24;
+        while (cpu.totalCycles < testCycles) {
+            do {
+                cpu.clock();
+            } while (!cpu.instructionComplete());
+        }
+    };
+
+    if (!LoadBinaryToBus(bus, binPath, 0xC000)) {
+        std::cerr << "Failed to load " << binPath << std::endl;
+        return 2;
+    }
+
+    // The same runs with the CPU on the bare bus and on the counting one
+    auto begin = std::chrono::steady_clock::now();
+    for (unsigned i = 0; i < runs; ++i)
+        run(bus);
+    const double plainSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+
+    begin = std::chrono::steady_clock::now();
+    for (unsigned i = 0; i < runs; ++i)
+        run(coverage);
+    const double countedSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+
+    // The map of a single run
+    coverage.clear();
+    run(coverage);
+    PrintCoverageSummary(coverage.getCoverage());
+    std::cout << runs << " run(s): " << plainSeconds << " s without coverage, " << countedSeconds << " s with ("
+              << (countedSeconds / plainSeconds - 1.0) * 100.0 << "% overhead)" << std::endl;
+
+    if (outPath.empty())
+        return 0;
+    const bool csv = outPath.size() >= 4 && outPath.compare(outPath.size() - 4, 4, ".csv") == 0;
+    if (!(csv ? SaveCoverageCsv(coverage.getCoverage(), outPath) : SaveCoverage(coverage.getCoverage(), outPath))) {
+        std::cerr << "Failed to write " << outPath << std::endl;
+        return 2;
+    }
+    return 0;
+}
+
 int RunNestestMain()
 {
     const std::string binPath = "6502_65C02_functional_tests\\bin_files\\nestest.prg.bin";
@@ -1,4 +1,18 @@
 #pragma once
 #include <string>
 
-bool RunNestest(const std::string& binPath, size_t maxLines = 5003);
\ No newline at end of file
+// Traces nestest to stdout, optionally dumping the final memory image to imagePath
+bool RunNestest(const std::string& binPath, size_t maxLines = 5003, const std::string& imagePath = "");
+
+// Same trace from the ahead-of-time translation of nestest (NestestRecompiled.cpp), interpreter as fallback
+bool RunNestestRecompiled(const std::string& binPath, size_t maxLines = 5003);
+
+// Both traces against the reference log (PC, registers including every bit of P, cycles). 0 if both match,
+// 1 with the first differing line if not, 2 if a file is missing.
+int RunNestestCheck(const std::string& binPath, const std::string& logPath, size_t maxLines = 5003);
+
+// Runs the whole of nestest `runs` times on the interpreter and on the translated code and compares the speed
+int RunRecompiledBench(const std::string& binPath, unsigned runs = 2000);
+// Per-address coverage of one nestest run (Coverage.h), saved to outPath as CSV if it ends in .csv, else binary.
+// Also times `runs` runs with and without the counting bus.
+int RunNestestCoverage(const std::string& binPath, const std::string& outPath = "", unsigned runs = 500);
@@ -0,0 +1,67 @@
+#include <bit>
+#include <cstring>
+
+#include "DeviceBus.h"
+#include "Snapshot.h"
+
+void MachineSnapshot::copyRam(DeviceBus& bus, bool toBus)
+{
+    uint8_t* const memory = bus.getRam().data();
+    if (ram.size() != RAM::SIZE)
+        ram.resize(RAM::SIZE);
+
+    // Unwritten pages are still the same on both sides
+    if (incremental && mirrored == &bus && bus.isSnapshotOwner(this)) {
+        const std::array<uint64_t, 4> written = bus.getWrittenPages();
+        pagesCopied = 0;
+        for (uint32_t word = 0; word < written.size(); ++word) {
+            for (uint64_t bits = written[word]; bits != 0; bits &= bits - 1) {
+                const uint32_t offset = (word * 64 + static_cast<uint32_t>(std::countr_zero(bits))) * 256;
+                if (toBus) {
+                    std::memcpy(memory + offset, ram.data() + offset, 256);
+                    bus.markDirty(static_cast<uint16_t>(offset), 256);
+                } else {
+                    std::memcpy(ram.data() + offset, memory + offset, 256);
+                }
+                ++pagesCopied;
+            }
+        }
+    } else {
+        if (toBus) {
+            std::memcpy(memory, ram.data(), RAM::SIZE);
+            bus.markDirty(0, RAM::SIZE);
+        } else {
+            std::memcpy(ram.data(), memory, RAM::SIZE);
+        }
+        pagesCopied = RAM::SIZE / 256;
+    }
+
+    // Both sides are the same again
+    bus.setSnapshotOwner(this);
+    mirrored = &bus;
+}
+
+bool MachineSnapshot::save(const CpuState& cpu, DeviceBus& bus)
+{
+    valid = false;
+    if (!bus.canSaveDevices())
+        return false;
+    cpuState = cpu;
+    copyRam(bus, false);
+    devices.resize(bus.deviceStateSize());
+    bus.saveDevices(devices.data());
+    valid = true;
+    return true;
+}
+
+bool MachineSnapshot::restore(CpuState& cpu, DeviceBus& bus)
+{
+    // Not saved from a bus with these devices
+    if (!valid || devices.size() != bus.deviceStateSize())
+        return false;
+    copyRam(bus, true);
+    bus.loadDevices(devices.data());
+    bus.setCycle(cpuState.totalCycles);
+    cpu = cpuState;
+    return true;
+}
@@ -0,0 +1,50 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "CpuState.h"
+
+class DeviceBus;
+
+// In-memory snapshot of a whole machine - CPU registers, the 64 KB of RAM and every device's state (see
+// Device::saveState) - for run-ahead, rewind and the like, where a snapshot is saved and restored every frame.
+// Only taken between instructions (after RunSynced returns). Host side effects of devices (console output, disk
+// writes) are not undone by a restore, and neither is anything the bus's hooks and input log saw: a run that will
+// be restored away must go with them suspended (DeviceBus::suspendHooks), as RunAheadFrame does, or a recording
+// logs reads and IRQ changes that never happen.
+//
+// A snapshot that saved or restored a bus last owns it: the bus tracks the RAM pages written since, and the next
+// save or restore on that bus only copies those. Any other snapshot saving or restoring the bus takes ownership
+// away and the following copy is a full 64 KB.
+class MachineSnapshot {
+public:
+    MachineSnapshot() = default;
+    MachineSnapshot(const MachineSnapshot&) = delete;
+    MachineSnapshot& operator=(const MachineSnapshot&) = delete;
+
+    // False, and nothing saved, if a device on bus cannot save its state
+    bool save(const CpuState& cpu, DeviceBus& bus);
+
+    // False if nothing was saved yet or bus has other devices than the ones saved
+    bool restore(CpuState& cpu, DeviceBus& bus);
+
+    bool isValid() const { return valid; }
+
+    // Off - every save and restore copies all of RAM (for comparison)
+    void setIncremental(bool enabled) { incremental = enabled; }
+
+    // RAM pages copied by the last save or restore
+    uint32_t getPagesCopied() const { return pagesCopied; }
+
+private:
+    // Copies the pages written since the last save or restore, or all of them
+    void copyRam(DeviceBus& bus, bool toBus);
+
+    CpuState cpuState;
+    std::vector<uint8_t> ram;
+    std::vector<uint8_t> devices;
+    const DeviceBus* mirrored = nullptr; // Bus the RAM copy was last synchronised with
+    bool valid = false;
+    bool incremental = true;
+    uint32_t pagesCopied = 0;
+};
@@ -0,0 +1,56 @@
+#include <bit>
+#include <cstring>
+
+#include "StateHash.h"
+
+static inline uint64_t Mix(uint64_t h)
+{
+    h ^= h >> 33;
+    h *= 0xFF51AFD7ED558CCDull;
+    h ^= h >> 33;
+    h *= 0xC4CEB9FE1A85EC53ull;
+    h ^= h >> 33;
+    return h;
+}
+
+uint64_t HashBytes(const uint8_t* data, size_t size, uint64_t seed)
+{
+    uint64_t h = seed ^ (size * 0x9E3779B97F4A7C15ull);
+    size_t i = 0;
+    for (; i + 8 <= size; i += 8) {
+        uint64_t word;
+        std::memcpy(&word, data + i, 8);
+        h = (h ^ Mix(word)) * 0x9E3779B97F4A7C15ull;
+        h = (h << 29) | (h >> 35);
+    }
+    for (; i < size; ++i) {
+        h = (h ^ data[i]) * 0x100000001B3ull;
+    }
+    return Mix(h);
+}
+
+void StateHasher::markDirty(uint16_t begin, uint32_t size)
+{
+    if (size == 0) {
+        return;
+    }
+    const uint32_t last = begin + size - 1;
+    for (uint32_t page = begin >> 8; page <= (last >> 8) && page < PAGES; ++page) {
+        dirty[page >> 6] |= 1ull << (page & 63);
+    }
+}
+
+uint64_t StateHasher::hash(const RAM& ram, uint64_t registerHash)
+{
+    for (size_t word = 0; word < dirty.size(); ++word) {
+        uint64_t bits = dirty[word];
+        while (bits != 0) {
+            const size_t bit = static_cast<size_t>(std::countr_zero(bits));
+            const size_t page = word * 64 + bit;
+            pageHashes[page] = HashBytes(ram.data() + page * 256, 256, page);
+            bits &= bits - 1;
+        }
+        dirty[word] = 0;
+    }
+    return HashBytes(reinterpret_cast<const uint8_t*>(pageHashes.data()), sizeof(pageHashes), registerHash);
+}
@@ -0,0 +1,40 @@
+#pragma once
+#include <array>
+#include <cstdint>
+#include "Ram.h"
+
+// Incremental machine state hash - RAM is hashed per 256 byte page and only pages written since the
+// previous hash are rehashed, so a checkpoint costs roughly the number of dirty pages.
+class StateHasher {
+public:
+    static constexpr size_t PAGES = RAM::SIZE / 256;
+
+    StateHasher() { dirty.fill(~0ull); }
+
+    void markDirty(uint16_t addr) { dirty[addr >> 14] |= 1ull << ((addr >> 8) & 63); }
+    void markDirty(uint16_t begin, uint32_t size);
+
+    // Combined hash of the registers (already hashed by the caller) and all RAM pages
+    uint64_t hash(const RAM& ram, uint64_t registerHash);
+
+private:
+    std::array<uint64_t, PAGES> pageHashes{};
+    std::array<uint64_t, PAGES / 64> dirty{};
+};
+
+uint64_t HashBytes(const uint8_t* data, size_t size, uint64_t seed = 0);
+
+// Registers and cycle counter of a CPU
+template <typename Cpu>
+uint64_t HashCpuRegisters(const Cpu& cpu)
+{
+    const uint8_t regs[16] = {
+        cpu.A, cpu.X, cpu.Y, cpu.SP, cpu.status,
+        static_cast<uint8_t>(cpu.PC), static_cast<uint8_t>(cpu.PC >> 8), 0,
+        static_cast<uint8_t>(cpu.totalCycles), static_cast<uint8_t>(cpu.totalCycles >> 8),
+        static_cast<uint8_t>(cpu.totalCycles >> 16), static_cast<uint8_t>(cpu.totalCycles >> 24),
+        static_cast<uint8_t>(cpu.totalCycles >> 32), static_cast<uint8_t>(cpu.totalCycles >> 40),
+        static_cast<uint8_t>(cpu.totalCycles >> 48), static_cast<uint8_t>(cpu.totalCycles >> 56),
+    };
+    return HashBytes(regs, sizeof(regs));
+}
@@ -0,0 +1,295 @@
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include <new>
+#include <thread>
+
+#include "Assembler.h"
+#include "Cpu6502.h"
+#include "DeviceBus.h"
+#include "GuestBench.h"
+#include "StatsSegment.h"
+#include "Via.h"
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+#endif
+
+#if !defined(_WIN32)
+
+StatsSegment::~StatsSegment()
+{
+    if (layout != nullptr) {
+        munmap(layout, sizeof(StatsLayout));
+        shm_unlink(name.c_str());
+    }
+}
+
+bool StatsSegment::create(const std::string& label, uint64_t intervalCycles, const std::string& segmentName)
+{
+    name = segmentName.empty() ? STATS_SEGMENT_PREFIX + std::to_string(getpid()) : segmentName;
+    const int fd = shm_open(name.c_str(), O_CREAT | O_RDWR | O_TRUNC, 0644);
+    if (fd < 0) {
+        error = "shm_open " + name + ": " + std::strerror(errno);
+        return false;
+    }
+    void* memory = MAP_FAILED;
+    if (ftruncate(fd, sizeof(StatsLayout)) == 0)
+        memory = mmap(nullptr, sizeof(StatsLayout), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (memory == MAP_FAILED) {
+        error = "mapping " + name + ": " + std::strerror(errno);
+        close(fd);
+        shm_unlink(name.c_str());
+        return false;
+    }
+    close(fd);
+
+    layout = new (memory) StatsLayout{};
+    layout->version = STATS_VERSION;
+    layout->size = sizeof(StatsLayout);
+    layout->pid = static_cast<uint32_t>(getpid());
+    std::strncpy(layout->name, label.c_str(), sizeof(layout->name) - 1);
+    interval = intervalCycles;
+    nextCycle = 0;
+    start = std::chrono::steady_clock::now();
+    layout->magic.store(STATS_MAGIC, std::memory_order_release);
+    return true;
+}
+
+void StatsSegment::update(uint64_t cycle, uint64_t instructions, uint64_t interrupts, uint64_t idleCycles)
+{
+    nextCycle = cycle + interval;
+
+    timespec cpu{};
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &cpu);
+    const auto wall = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+
+    // Single writer - plain load and store, no read-modify-write
+    constexpr auto relaxed = std::memory_order_relaxed;
+    layout->wallNs.store(static_cast<uint64_t>(wall.count()), relaxed);
+    layout->hostCpuNs.store(static_cast<uint64_t>(cpu.tv_sec) * 1000000000ull + static_cast<uint64_t>(cpu.tv_nsec), relaxed);
+    layout->cycles.store(cycle, relaxed);
+    layout->instructions.store(baseInstructions + instructions, relaxed);
+    layout->interrupts.store(baseInterrupts + interrupts, relaxed);
+    layout->idleCycles.store(baseIdleCycles + idleCycles, relaxed);
+    layout->updates.store(layout->updates.load(relaxed) + 1, relaxed);
+}
+
+StatsReader::~StatsReader()
+{
+    if (layout != nullptr)
+        munmap(const_cast<StatsLayout*>(layout), mappedSize);
+}
+
+bool StatsReader::attach(const std::string& name, std::string& error)
+{
+    const int fd = shm_open(name.c_str(), O_RDONLY, 0);
+    if (fd < 0) {
+        error = name + ": " + std::strerror(errno);
+        return false;
+    }
+    struct stat info {};
+    void* memory = MAP_FAILED;
+    if (fstat(fd, &info) == 0 && info.st_size >= static_cast<off_t>(sizeof(StatsLayout)))
+        memory = mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (memory == MAP_FAILED) {
+        error = name + ": not a stats segment";
+        return false;
+    }
+
+    const StatsLayout* candidate = static_cast<const StatsLayout*>(memory);
+    // Magic is stored last, a writer that is still filling in the header is not read
+    if (candidate->magic.load(std::memory_order_acquire) != STATS_MAGIC) {
+        munmap(memory, static_cast<size_t>(info.st_size));
+        error = name + ": not a stats segment";
+        return false;
+    }
+    layout = candidate;
+    mappedSize = static_cast<size_t>(info.st_size);
+    segment = name;
+    return true;
+}
+
+bool StatsReader::read(StatsSample& sample) const
+{
+    if (layout == nullptr)
+        return false;
+    constexpr auto relaxed = std::memory_order_relaxed;
+    sample.name.assign(layout->name, strnlen(layout->name, sizeof(layout->name)));
+    sample.pid = layout->pid;
+    sample.alive = kill(static_cast<pid_t>(layout->pid), 0) == 0 || errno == EPERM;
+    sample.wallNs = layout->wallNs.load(relaxed);
+    sample.hostCpuNs = layout->hostCpuNs.load(relaxed);
+    sample.cycles = layout->cycles.load(relaxed);
+    sample.instructions = layout->instructions.load(relaxed);
+    sample.interrupts = layout->interrupts.load(relaxed);
+    sample.idleCycles = layout->idleCycles.load(relaxed);
+    sample.updates = layout->updates.load(relaxed);
+    return true;
+}
+
+#else
+
+StatsSegment::~StatsSegment() = default;
+
+bool StatsSegment::create(const std::string&, uint64_t, const std::string&)
+{
+    error = "stats segments need POSIX shared memory";
+    return false;
+}
+
+void StatsSegment::update(uint64_t, uint64_t, uint64_t, uint64_t)
+{
+}
+
+StatsReader::~StatsReader() = default;
+
+bool StatsReader::attach(const std::string& name, std::string& error)
+{
+    error = name + ": stats segments need POSIX shared memory";
+    return false;
+}
+
+bool StatsReader::read(StatsSample&) const
+{
+    return false;
+}
+
+#endif
+
+StatsReader::StatsReader(StatsReader&& other) noexcept
+    : layout(other.layout), mappedSize(other.mappedSize), segment(std::move(other.segment))
+{
+    other.layout = nullptr;
+}
+
+void StatsSegment::endRun(uint64_t, uint64_t instructions, uint64_t interrupts, uint64_t idleCycles)
+{
+    baseInstructions += instructions;
+    baseInterrupts += interrupts;
+    baseIdleCycles += idleCycles;
+}
+
+std::vector<std::string> ListStatsSegments()
+{
+    std::vector<std::string> segments;
+    const std::string prefix = std::string(STATS_SEGMENT_PREFIX).substr(1);
+    std::error_code ec;
+    for (const auto& entry : std::filesystem::directory_iterator("/dev/shm", ec)) {
+        const std::string file = entry.path().filename().string();
+        if (file.compare(0, prefix.size(), prefix) == 0)
+            segments.push_back("/" + file);
+    }
+    std::sort(segments.begin(), segments.end());
+    return segments;
+}
+
+int RunStatsDemo(const std::string& kernelName, double seconds, const std::string& name)
+{
+    const auto& kernels = GuestKernels();
+    const auto kernel = std::find_if(kernels.begin(), kernels.end(), [&](const GuestKernel& k) { return kernelName == k.name; });
+    if (kernel == kernels.end()) {
+        std::cerr << "Unknown kernel " << kernelName << std::endl;
+        return 2;
+    }
+    AssembledProgram program;
+    std::string error;
+    if (!Assemble(kernel->source, program, error)) {
+        std::cerr << kernel->name << ": " << error << std::endl;
+        return 2;
+    }
+
+    StatsSegment stats;
+    if (!stats.create(kernel->name, 1000000, name)) {
+        std::cerr << stats.getError() << std::endl;
+        return 2;
+    }
+    std::cout << kernel->name << " publishing to " << stats.getName() << " for " << seconds << " s" << std::endl;
+
+    DeviceBus bus;
+    ViaDevice via;
+    bus.attach(&via, GUEST_VIA, 16);
+    LoadProgram(bus, program);
+    bus.addHook(&stats);
+    Cpu6502 cpu(&bus);
+    cpu.reset();
+
+    // Slices of 10M cycles, so the wall clock is only looked at between them
+    const auto begin = std::chrono::steady_clock::now();
+    while (std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count() < seconds)
+        RunSynced(cpu, bus, cpu.totalCycles + 10000000);
+
+    const bool pass = kernel->check(bus, program.symbols, cpu.totalCycles);
+    std::cout << kernel->name << ": " << cpu.totalCycles << " cycles" << (pass ? "" : " - FAILED") << std::endl;
+    return pass ? 0 : 1;
+}
+
+int RunStatsView(double seconds, const std::vector<std::string>& names)
+{
+    std::vector<StatsReader> readers;
+    for (const std::string& name : names.empty() ? ListStatsSegments() : names) {
+        StatsReader reader;
+        std::string error;
+        if (reader.attach(name, error))
+            readers.push_back(std::move(reader));
+        else
+            std::cerr << error << std::endl;
+    }
+    if (readers.empty()) {
+        std::cerr << "No stats segments" << std::endl;
+        return 1;
+    }
+
+    std::vector<StatsSample> first(readers.size());
+    std::vector<StatsSample> last(readers.size());
+    for (size_t i = 0; i < readers.size(); ++i)
+        readers[i].read(first[i]);
+    std::this_thread::sleep_for(std::chrono::duration<double>(seconds));
+    for (size_t i = 0; i < readers.size(); ++i)
+        readers[i].read(last[i]);
+
+    // Rates over the writers' own clock, between their updates nearest to the two samples
+    std::cout << std::left << std::setw(20) << "segment" << std::setw(10) << "name" << std::right << std::setw(8) << "pid"
+              << std::setw(10) << "MHz" << std::setw(10) << "MIPS" << std::setw(10) << "IRQ/s" << std::setw(8) << "idle%"
+              << std::setw(8) << "cpu%" << "\n" << std::fixed << std::setprecision(2);
+    StatsSample total;
+    double totalCycles = 0;
+    for (size_t i = 0; i < readers.size(); ++i) {
+        const StatsSample& a = first[i];
+        const StatsSample& b = last[i];
+        const double wall = static_cast<double>(b.wallNs - a.wallNs) / 1e9;
+        const uint64_t cycles = b.cycles - a.cycles;
+        const uint64_t idle = b.idleCycles - a.idleCycles;
+        auto rate = [&](uint64_t count, double scale) { return wall > 0 ? static_cast<double>(count) / wall / scale : 0.0; };
+        std::cout << std::left << std::setw(20) << readers[i].getSegment() << std::setw(10) << b.name << std::right << std::setw(8) << b.pid
+                  << std::setw(10) << rate(cycles, 1e6) << std::setw(10) << rate(b.instructions - a.instructions, 1e6)
+                  << std::setw(10) << rate(b.interrupts - a.interrupts, 1.0)
+                  << std::setw(8) << (cycles > 0 ? 100.0 * static_cast<double>(idle) / static_cast<double>(cycles) : 0.0)
+                  << std::setw(8) << rate(b.hostCpuNs - a.hostCpuNs, 1e7) << (b.alive ? "" : "  (exited)") << "\n";
+
+        // Totals are summed over each instance's own interval - the intervals are the same sampling window
+        if (wall > 0) {
+            total.cycles += static_cast<uint64_t>(static_cast<double>(cycles) / wall);
+            total.instructions += static_cast<uint64_t>(static_cast<double>(b.instructions - a.instructions) / wall);
+            total.interrupts += static_cast<uint64_t>(static_cast<double>(b.interrupts - a.interrupts) / wall);
+            total.hostCpuNs += static_cast<uint64_t>(static_cast<double>(b.hostCpuNs - a.hostCpuNs) / wall);
+            total.idleCycles += idle;
+            totalCycles += static_cast<double>(cycles);
+        }
+    }
+    std::cout << std::left << std::setw(20) << "total" << std::setw(10) << readers.size() << std::right << std::setw(8) << ""
+              << std::setw(10) << static_cast<double>(total.cycles) / 1e6 << std::setw(10) << static_cast<double>(total.instructions) / 1e6
+              << std::setw(10) << static_cast<double>(total.interrupts)
+              << std::setw(8) << (totalCycles > 0 ? 100.0 * static_cast<double>(total.idleCycles) / totalCycles : 0.0)
+              << std::setw(8) << static_cast<double>(total.hostCpuNs) / 1e7 << std::endl;
+    return 0;
+}
@@ -0,0 +1,125 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "RunHook.h"
+
+// Live runtime metrics in a POSIX shared memory segment, one per emulator instance, for monitoring tools on the
+// same host. The emulator only stores counters: as a hook of the machine's bus (DeviceBus::addHook) the run loop
+// updates them every interval cycles from counts it already keeps, with relaxed atomic stores and no
+// per-instruction work. Readers map the segment read-only and derive rates - emulated MHz, instructions and
+// interrupts per second, idle fast-forward ratio and host CPU load - from two samples. The counters are stored
+// independently, so a sample may mix neighbouring updates, which only matters for rates over a handful of
+// updates.
+//
+// Segments are named STATS_SEGMENT_PREFIX<pid> unless the instance picks a name. Layout version 1, 128 bytes,
+// host byte order. Fields are only ever appended: readers accept any version with their magic that is at least
+// as large as their own layout.
+
+constexpr uint32_t STATS_MAGIC = 0x54533645; // "E6ST"
+constexpr uint32_t STATS_VERSION = 1;
+constexpr const char* STATS_SEGMENT_PREFIX = "/emu6502.";
+
+struct StatsLayout {
+    std::atomic<uint32_t> magic;     // STATS_MAGIC, stored last once the header is filled in
+    uint32_t version;
+    uint32_t size;                   // sizeof(StatsLayout) of the writer
+    uint32_t pid;
+    char name[48];                   // Instance label, NUL terminated
+
+    // Totals since the segment was created, at the last update
+    std::atomic<uint64_t> wallNs;
+    std::atomic<uint64_t> hostCpuNs; // CPU time of the emulation thread
+    std::atomic<uint64_t> cycles;    // The CPU's cycle counter
+    std::atomic<uint64_t> instructions;
+    std::atomic<uint64_t> interrupts;
+    std::atomic<uint64_t> idleCycles; // Cycles skipped by idle loop fast-forward (part of cycles)
+    std::atomic<uint64_t> updates;
+    uint64_t reserved;
+};
+
+static_assert(std::atomic<uint64_t>::is_always_lock_free, "Shared counters must be lock-free to be address-free");
+static_assert(sizeof(StatsLayout) == 128, "StatsLayout is a fixed format");
+
+// Writer side, owned by the emulation thread
+class StatsSegment final : public RunHook {
+public:
+    StatsSegment() = default;
+    ~StatsSegment(); // Unmaps and removes the segment
+    StatsSegment(const StatsSegment&) = delete;
+    StatsSegment& operator=(const StatsSegment&) = delete;
+
+    // Creates the segment, name empty for STATS_SEGMENT_PREFIX<pid>
+    bool create(const std::string& label, uint64_t intervalCycles = 1000000, const std::string& name = "");
+    const std::string& getName() const { return name; }
+    const std::string& getError() const { return error; }
+
+    // Stores the counters - instructions, interrupts and idle cycles are the ones of the current run call
+    void update(uint64_t cycle, uint64_t instructions, uint64_t interrupts, uint64_t idleCycles);
+
+    // End of a run call, folds its counts into the totals - they are stored with the next update
+    void endRun(uint64_t cycle, uint64_t instructions, uint64_t interrupts, uint64_t idleCycles);
+
+    uint64_t nextHookCycle() const override { return nextCycle; }
+    void runHook(const CpuState& cpu, DeviceBus&, const RunCounts& counts) override {
+        update(cpu.totalCycles, counts.instructions, counts.interrupts, counts.idleCycles);
+    }
+    void endRunHook(const CpuState& cpu, const RunCounts& counts) override {
+        endRun(cpu.totalCycles, counts.instructions, counts.interrupts, counts.idleCycles);
+    }
+
+private:
+    StatsLayout* layout = nullptr;
+    std::string name;
+    std::string error;
+    uint64_t interval = 0;
+    uint64_t nextCycle = ~0ull;
+    std::chrono::steady_clock::time_point start;
+    uint64_t baseInstructions = 0; // Totals up to the current run call
+    uint64_t baseInterrupts = 0;
+    uint64_t baseIdleCycles = 0;
+};
+
+struct StatsSample {
+    std::string name;   // Instance label
+    uint32_t pid = 0;
+    bool alive = false; // The writing process still exists
+    uint64_t wallNs = 0;
+    uint64_t hostCpuNs = 0;
+    uint64_t cycles = 0;
+    uint64_t instructions = 0;
+    uint64_t interrupts = 0;
+    uint64_t idleCycles = 0;
+    uint64_t updates = 0;
+};
+
+// Reader side - maps a segment read-only
+class StatsReader {
+public:
+    StatsReader() = default;
+    ~StatsReader();
+    StatsReader(StatsReader&& other) noexcept;
+    StatsReader(const StatsReader&) = delete;
+    StatsReader& operator=(const StatsReader&) = delete;
+
+    // False if the segment does not exist or is not a stats segment
+    bool attach(const std::string& segment, std::string& error);
+    bool read(StatsSample& sample) const;
+    const std::string& getSegment() const { return segment; }
+
+private:
+    const StatsLayout* layout = nullptr;
+    size_t mappedSize = 0;
+    std::string segment;
+};
+
+// Names of the stats segments on this host (Linux lists them under /dev/shm)
+std::vector<std::string> ListStatsSegments();
+
+// statsrun [kernel] [seconds] [name] - runs a guest kernel (GuestBench.h) flat out while publishing its stats
+int RunStatsDemo(const std::string& kernel, double seconds, const std::string& name);
+
+// statsview [seconds] [segment...] - samples every (or the given) segment twice, per-instance and total rates
+int RunStatsView(double seconds, const std::vector<std::string>& segments);
@@ -0,0 +1,200 @@
+#include <fstream>
+#include <iostream>
+#include <thread>
+
+#include "Cpu6502.h"
+#include "DeviceBus.h"
+#include "Uart.h"
+
+UartDevice::UartDevice(std::ostream& output) : output(output) {}
+
+UartDevice::~UartDevice()
+{
+    flush();
+    if (input)
+        input->stop = true;
+}
+
+bool UartDevice::setInput(const std::string& path)
+{
+    auto state = std::make_shared<Input>();
+    std::istream* stream = &std::cin;
+    if (path != "-") {
+        state->file = std::make_unique<std::ifstream>(path, std::ios::binary);
+        if (!*state->file)
+            return false;
+        stream = state->file.get();
+    }
+    if (input)
+        input->stop = true;
+    input = state;
+
+    // Blocks on the stream, not on the emulator - detached because a read from stdin cannot be interrupted
+    std::thread([state, stream]() {
+        for (int c; !state->stop && (c = stream->get()) != std::char_traits<char>::eof();) {
+            const size_t head = state->head.load(std::memory_order_relaxed);
+            while (head - state->tail.load(std::memory_order_acquire) == Input::SIZE) {
+                if (state->stop)
+                    return;
+                std::this_thread::yield();
+            }
+            state->ring[head % Input::SIZE] = static_cast<uint8_t>(c);
+            state->head.store(head + 1, std::memory_order_release);
+        }
+        state->eof = true;
+    }).detach();
+    return true;
+}
+
+void UartDevice::feed(const std::string& bytes)
+{
+    fed += bytes;
+    pollInput();
+}
+
+void UartDevice::pollInput()
+{
+    if (rxReady)
+        return;
+    if (fedRead < fed.size()) {
+        rxData = static_cast<uint8_t>(fed[fedRead++]);
+        rxReady = true;
+        return;
+    }
+    if (!input)
+        return;
+    const size_t tail = input->tail.load(std::memory_order_relaxed);
+    if (tail != input->head.load(std::memory_order_acquire)) {
+        rxData = input->ring[tail % Input::SIZE];
+        input->tail.store(tail + 1, std::memory_order_release);
+        rxReady = true;
+    }
+}
+
+void UartDevice::advance(uint64_t, uint64_t)
+{
+    if (control & CONTROL_RX_IRQ)
+        pollInput();
+}
+
+size_t UartDevice::stateSize() const
+{
+    return sizeof(rxData) + sizeof(rxReady) + sizeof(control) + sizeof(fedRead);
+}
+
+void UartDevice::saveState(uint8_t* out) const
+{
+    out = putState(out, rxData);
+    out = putState(out, rxReady);
+    out = putState(out, control);
+    putState(out, fedRead);
+}
+
+void UartDevice::loadState(const uint8_t* in)
+{
+    in = getState(in, rxData);
+    in = getState(in, rxReady);
+    in = getState(in, control);
+    getState(in, fedRead);
+}
+
+uint64_t UartDevice::nextDeadline() const
+{
+    // Nothing to wait for while a byte is pending (the IRQ is already up) or the input is over
+    if (!(control & CONTROL_RX_IRQ) || rxReady || (!input && fedRead == fed.size()))
+        return NO_DEADLINE;
+    return syncedCycle + RX_POLL_CYCLES;
+}
+
+uint8_t UartDevice::readRegister(uint16_t offset)
+{
+    switch (offset) {
+    case 0: {
+        pollInput();
+        if (!rxReady)
+            return 0;
+        const uint8_t data = rxData;
+        rxReady = false;
+        ++bytesReceived;
+        pollInput();
+        return data;
+    }
+    case 1: {
+        pollInput();
+        uint8_t status = STATUS_TX_READY;
+        if (rxReady)
+            status |= STATUS_RX_READY;
+        else if (fedRead == fed.size() && (!input || (input->eof && input->tail.load() == input->head.load())))
+            status |= STATUS_RX_EOF;
+        if (irqAsserted())
+            status |= STATUS_IRQ;
+        return status;
+    }
+    case 2:
+        return control;
+    default:
+        return 0;
+    }
+}
+
+void UartDevice::writeRegister(uint16_t offset, uint8_t data)
+{
+    if (offset == 2) {
+        control = data;
+        return;
+    }
+    if (offset != 0)
+        return;
+
+    txBuffer.push_back(static_cast<char>(data));
+    if (capture)
+        transcript.push_back(static_cast<char>(data));
+    ++bytesSent;
+    if ((flushOnNewline && data == '\n') || txBuffer.size() >= TX_BATCH)
+        flush();
+}
+
+void UartDevice::flush()
+{
+    if (txBuffer.empty())
+        return;
+    output.write(txBuffer.data(), static_cast<std::streamsize>(txBuffer.size()));
+    output.flush();
+    txBuffer.clear();
+    ++hostWrites;
+}
+
+int RunUartDemo(const std::string& inputPath)
+{
+    constexpr uint16_t DONE = 0x0220;
+
+    DeviceBus bus;
+    UartDevice uart(std::cout);
+    bus.attach(&uart, 0x5000, 3);
+    if (!uart.setInput(inputPath)) {
+        std::cerr << "Failed to open " << inputPath << std::endl;
+        return 2;
+    }
+
+    // loop: LDA STATUS / LSR / BCS got / LSR / LSR / BCS done / JMP loop
+    // got:  LDA DATA / CMP #'a' / BCC out / CMP #'z'+1 / BCS out / AND #$DF
+    // out:  STA DATA / JMP loop
+    // done: JMP *
+    const uint8_t program[] = { 0xAD, 0x01, 0x50, 0x4A, 0xB0, 0x07, 0x4A, 0x4A, 0xB0, 0x16, 0x4C, 0x00, 0x02,
+                                0xAD, 0x00, 0x50, 0xC9, 0x61, 0x90, 0x06, 0xC9, 0x7B, 0xB0, 0x02, 0x29, 0xDF,
+                                0x8D, 0x00, 0x50, 0x4C, 0x00, 0x02, 0x4C, 0x20, 0x02 };
+    for (size_t i = 0; i < sizeof(program); ++i)
+        bus.write(static_cast<uint16_t>(0x0200 + i), program[i]);
+
+    Cpu6502 cpu(&bus);
+    cpu.PC = 0x0200;
+    cpu.SP = 0xFD;
+    cpu.status = 0x24;
+    while (cpu.PC != DONE)
+        RunSynced(cpu, bus, cpu.totalCycles + 10000);
+    uart.flush();
+
+    std::cerr << uart.getBytesReceived() << " byte(s) in, " << uart.getBytesSent() << " byte(s) out in "
+              << uart.getHostWrites() << " host write(s), " << cpu.totalCycles << " cycle(s)" << std::endl;
+    return 0;
+}
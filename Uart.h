@@ -0,0 +1,100 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <iosfwd>
+#include <memory>
+#include <string>
+#include "Device.h"
+
+// Serial console. Transmitted bytes collect in a host-side buffer that is written out a line or a batch at a
+// time, never a host call per character. Received bytes come from a host stream (a file or stdin) that a
+// reader thread drains into a lock-free ring, so the emulation thread never waits for input, and from feed().
+//
+// Registers:
+//   +0 DATA     write: transmit. read: next received byte (0 if none)
+//   +1 STATUS   STATUS_RX_READY, STATUS_TX_READY (always set), STATUS_RX_EOF, STATUS_IRQ
+//   +2 CONTROL  CONTROL_RX_IRQ - raise IRQ while a received byte is waiting
+//
+// Input from the reader thread arrives asynchronously. With the RX interrupt enabled the device polls the ring
+// every RX_POLL_CYCLES through its deadline, otherwise the guest sees new bytes when it reads STATUS.
+class UartDevice final : public Device {
+public:
+    static constexpr uint8_t STATUS_RX_READY = 0x01;
+    static constexpr uint8_t STATUS_TX_READY = 0x02;
+    static constexpr uint8_t STATUS_RX_EOF = 0x04;   // Host input ended and every byte was read
+    static constexpr uint8_t STATUS_IRQ = 0x80;
+    static constexpr uint8_t CONTROL_RX_IRQ = 0x01;
+    static constexpr size_t TX_BATCH = 4096;         // Bytes buffered before a write without a newline
+    static constexpr uint64_t RX_POLL_CYCLES = 1000;
+
+    // Transmitted bytes go to output, nothing is received until setInput() or feed()
+    explicit UartDevice(std::ostream& output);
+    ~UartDevice() override;
+
+    uint8_t readRegister(uint16_t offset) override;
+    void writeRegister(uint16_t offset, uint8_t data) override;
+    uint64_t nextDeadline() const override;
+    bool irqAsserted() const override { return (control & CONTROL_RX_IRQ) && rxReady; }
+    // Input from the reader thread cannot be given back, so only a UART without setInput() can be saved. Fed
+    // bytes are kept, a restore delivers the ones read since the save again.
+    bool canSaveState() const override { return !input; }
+    size_t stateSize() const override;
+    void saveState(uint8_t* out) const override;
+    void loadState(const uint8_t* in) override;
+
+    // Starts the reader thread on a file, or on stdin for "-". False if the file cannot be opened.
+    bool setInput(const std::string& path);
+    // Queues bytes as received from the emulation thread, e.g. scripted input in a test
+    void feed(const std::string& bytes);
+
+    // Writes the buffer on every newline (default) or only in TX_BATCH blocks and on flush()
+    void setFlushOnNewline(bool enabled) { flushOnNewline = enabled; }
+    void flush();
+
+    // Keeps a copy of all transmitted bytes, for harnesses that check a guest's output
+    void setCapture(bool enabled) { capture = enabled; }
+    const std::string& getTranscript() const { return transcript; }
+
+    uint64_t getBytesSent() const { return bytesSent; }
+    uint64_t getBytesReceived() const { return bytesReceived; }
+    uint64_t getHostWrites() const { return hostWrites; }
+
+protected:
+    void advance(uint64_t fromCycle, uint64_t toCycle) override;
+
+private:
+    // Single producer (reader thread), single consumer (emulation thread)
+    struct Input {
+        static constexpr size_t SIZE = 4096;
+        std::array<uint8_t, SIZE> ring{};
+        std::atomic<size_t> head{ 0 }; // Written by the reader thread
+        std::atomic<size_t> tail{ 0 }; // Written by the emulation thread
+        std::atomic<bool> eof{ false };
+        std::atomic<bool> stop{ false };
+        std::unique_ptr<std::istream> file;
+    };
+
+    // Moves the next received byte into rxData if there is none waiting
+    void pollInput();
+
+    std::ostream& output;
+    std::string txBuffer;
+    bool flushOnNewline = true;
+    bool capture = false;
+    std::string transcript;
+
+    std::shared_ptr<Input> input; // Shared with the reader thread, which may outlive the device on stdin
+    std::string fed;     // Every byte fed, kept for snapshots - fed[fedRead] is the next one
+    size_t fedRead = 0;
+    uint8_t rxData = 0;
+    bool rxReady = false;
+    uint8_t control = 0;
+
+    uint64_t bytesSent = 0;
+    uint64_t bytesReceived = 0;
+    uint64_t hostWrites = 0;
+};
+
+// uart [input|-] - a guest echoes its input in upper case until the input ends
+int RunUartDemo(const std::string& inputPath);
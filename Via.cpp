@@ -0,0 +1,213 @@
+#include <chrono>
+#include <iostream>
+
+#include "Cpu6502.h"
+#include "DeviceBus.h"
+#include "Via.h"
+
+void ViaDevice::load(Timer& timer, uint64_t cycle)
+{
+    timer.loaded = timer.latch;
+    timer.before = timer.latch;
+    timer.start = cycle + 1;
+    timer.expiry = timer.start + timer.loaded + 1;
+}
+
+uint16_t ViaDevice::counter(const Timer& timer, bool freeRun, uint64_t cycle) const
+{
+    if (cycle < timer.start)
+        return timer.before;
+    const uint64_t elapsed = cycle - timer.start;
+    if (!freeRun || timer.expiry == NO_DEADLINE)
+        return static_cast<uint16_t>(timer.loaded - elapsed); // Keeps counting down through $FFFF
+    // Free-running: N ... 0, $FFFF, then N again
+    const uint64_t phase = elapsed % (static_cast<uint64_t>(timer.loaded) + 2);
+    return phase <= timer.loaded ? static_cast<uint16_t>(timer.loaded - phase) : 0xFFFF;
+}
+
+void ViaDevice::advance(uint64_t, uint64_t toCycle)
+{
+    if (t1.expiry <= toCycle) {
+        ifr |= IRQ_T1;
+        ++t1Expiries;
+        if (freeRunning()) {
+            // Reload from the latch (which may have changed), then skip whole periods in one step
+            t1.start = t1.expiry + 1;
+            t1.loaded = t1.latch;
+            t1.before = 0xFFFF;
+            t1.expiry = t1.start + t1.loaded + 1;
+            if (t1.expiry <= toCycle) {
+                const uint64_t period = static_cast<uint64_t>(t1.loaded) + 2;
+                const uint64_t periods = (toCycle - t1.expiry) / period + 1;
+                t1.start += periods * period;
+                t1.expiry += periods * period;
+                t1Expiries += periods;
+            }
+        } else {
+            t1.expiry = NO_DEADLINE;
+        }
+    }
+    if (t2.expiry <= toCycle) {
+        ifr |= IRQ_T2;
+        t2.expiry = NO_DEADLINE;
+    }
+}
+
+size_t ViaDevice::stateSize() const
+{
+    return sizeof(t1) + sizeof(t2) + sizeof(acr) + sizeof(ifr) + sizeof(ier) + sizeof(plain) + sizeof(t1Expiries);
+}
+
+void ViaDevice::saveState(uint8_t* out) const
+{
+    out = putState(out, t1);
+    out = putState(out, t2);
+    out = putState(out, acr);
+    out = putState(out, ifr);
+    out = putState(out, ier);
+    out = putState(out, plain);
+    putState(out, t1Expiries);
+}
+
+void ViaDevice::loadState(const uint8_t* in)
+{
+    in = getState(in, t1);
+    in = getState(in, t2);
+    in = getState(in, acr);
+    in = getState(in, ifr);
+    in = getState(in, ier);
+    in = getState(in, plain);
+    getState(in, t1Expiries);
+}
+
+uint64_t ViaDevice::nextDeadline() const
+{
+    // Only expiries that can raise IRQ need the run loop to stop, flags alone are caught up on the next read
+    uint64_t next = NO_DEADLINE;
+    if (ier & IRQ_T1)
+        next = t1.expiry;
+    if ((ier & IRQ_T2) && t2.expiry < next)
+        next = t2.expiry;
+    return next;
+}
+
+uint8_t ViaDevice::readRegister(uint16_t offset)
+{
+    const uint64_t cycle = syncedCycle;
+    switch (offset & 0x0F) {
+    case 0x4:
+        ifr &= ~IRQ_T1;
+        return static_cast<uint8_t>(counter(t1, freeRunning(), cycle));
+    case 0x5:
+        return static_cast<uint8_t>(counter(t1, freeRunning(), cycle) >> 8);
+    case 0x6:
+        return static_cast<uint8_t>(t1.latch);
+    case 0x7:
+        return static_cast<uint8_t>(t1.latch >> 8);
+    case 0x8:
+        ifr &= ~IRQ_T2;
+        return static_cast<uint8_t>(counter(t2, false, cycle));
+    case 0x9:
+        return static_cast<uint8_t>(counter(t2, false, cycle) >> 8);
+    case 0xB:
+        return acr;
+    case 0xD:
+        return static_cast<uint8_t>(ifr | (irqAsserted() ? IRQ_ANY : 0));
+    case 0xE:
+        return static_cast<uint8_t>(ier | IRQ_ANY);
+    default:
+        return plain[offset & 0x0F];
+    }
+}
+
+void ViaDevice::writeRegister(uint16_t offset, uint8_t data)
+{
+    const uint64_t cycle = syncedCycle;
+    switch (offset & 0x0F) {
+    case 0x4:
+    case 0x6:
+        t1.latch = static_cast<uint16_t>((t1.latch & 0xFF00) | data);
+        break;
+    case 0x5:
+        t1.latch = static_cast<uint16_t>((t1.latch & 0x00FF) | (data << 8));
+        ifr &= ~IRQ_T1;
+        load(t1, cycle);
+        break;
+    case 0x7:
+        t1.latch = static_cast<uint16_t>((t1.latch & 0x00FF) | (data << 8));
+        ifr &= ~IRQ_T1;
+        break;
+    case 0x8:
+        t2.latch = static_cast<uint16_t>((t2.latch & 0xFF00) | data);
+        break;
+    case 0x9:
+        t2.latch = static_cast<uint16_t>((t2.latch & 0x00FF) | (data << 8));
+        ifr &= ~IRQ_T2;
+        load(t2, cycle);
+        break;
+    case 0xB:
+        acr = data;
+        break;
+    case 0xD:
+        ifr &= ~(data & 0x7F);
+        break;
+    case 0xE:
+        ier = (data & IRQ_ANY) ? static_cast<uint8_t>(ier | (data & 0x7F)) : static_cast<uint8_t>(ier & ~data);
+        break;
+    default:
+        plain[offset & 0x0F] = data;
+        break;
+    }
+}
+
+int RunViaDemo(uint64_t cycles)
+{
+    constexpr uint16_t VIA = 0x6000;
+    constexpr uint16_t PERIOD = 998; // Latch value, interrupts every PERIOD + 2 cycles
+
+    bool ok = true;
+    for (int busy = 0; busy < 2; ++busy) {
+        DeviceBus bus;
+        ViaDevice via;
+        bus.attach(&via, VIA, 16);
+
+        // LDA #$40 / STA ACR / LDA #<PERIOD / STA T1C-L / LDA #>PERIOD / STA T1C-H / LDA #$C0 / STA IER / CLI,
+        // then JMP * (idle) or INX / BNE * / JMP (busy)
+        const uint8_t setup[] = { 0xA9, 0x40, 0x8D, 0x0B, 0x60, 0xA9, PERIOD & 0xFF, 0x8D, 0x04, 0x60,
+                                  0xA9, PERIOD >> 8, 0x8D, 0x05, 0x60, 0xA9, 0xC0, 0x8D, 0x0E, 0x60, 0x58 };
+        const uint8_t idle[] = { 0x4C, 0x15, 0x02 };
+        const uint8_t spin[] = { 0xE8, 0xD0, 0xFD, 0x4C, 0x15, 0x02 };
+        // IRQ at $0300: PHA / LDA T1C-L (acknowledge) / INC $10 / BNE +2 / INC $11 / PLA / RTI
+        const uint8_t handler[] = { 0x48, 0xAD, 0x04, 0x60, 0xE6, 0x10, 0xD0, 0x02, 0xE6, 0x11, 0x68, 0x40 };
+
+        uint16_t pc = 0x0200;
+        for (uint8_t b : setup)
+            bus.write(pc++, b);
+        for (size_t i = 0; i < (busy ? sizeof(spin) : sizeof(idle)); ++i)
+            bus.write(pc++, busy ? spin[i] : idle[i]);
+        for (size_t i = 0; i < sizeof(handler); ++i)
+            bus.write(static_cast<uint16_t>(0x0300 + i), handler[i]);
+        bus.write(0xFFFE, 0x00);
+        bus.write(0xFFFF, 0x03);
+
+        Cpu6502 cpu(&bus);
+        cpu.PC = 0x0200;
+        cpu.SP = 0xFD;
+        cpu.status = 0x24;
+
+        const auto begin = std::chrono::steady_clock::now();
+        RunSynced(cpu, bus, cycles);
+        const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+
+        const uint64_t ticks = bus.read(0x10) | (bus.read(0x11) << 8);
+        // T1 is started by the STA T1C-H at cycle 14 and expires every PERIOD + 2 cycles after it
+        const uint64_t expected = (cycles - 14) / (PERIOD + 2u);
+        const bool match = ticks + 1 >= expected && ticks <= expected;
+        ok = ok && match;
+        std::cout << (busy ? "busy" : "idle") << " guest: " << ticks << " timer interrupt(s) in " << cpu.totalCycles
+                  << " cycles (" << expected << " expected), " << cpu.totalCycles / seconds / 1e6 << " MHz"
+                  << (match ? "" : " - MISMATCH") << "\n";
+    }
+    std::cout << std::flush;
+    return ok ? 0 : 1;
+}
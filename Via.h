@@ -0,0 +1,68 @@
+#pragma once
+#include <array>
+#include <cstdint>
+#include "Device.h"
+
+// Timer and interrupt controller modelled on the 6522 VIA - timer 1 (one-shot or free-running), timer 2
+// (one-shot), the interrupt flag and enable registers and the IRQ output. The timers never count: a timer
+// remembers the cycle it was loaded at, its counter is computed from that on a read and its expiry is a
+// deadline, so the device costs nothing between accesses and the run loop stops exactly at each expiry.
+//
+// Registers (6522 layout, the ports, shift register and PCR are plain storage):
+//   +4 T1C-L  write: latch low. read: counter low, clears the T1 flag
+//   +5 T1C-H  write: latch high, loads the counter from the latch and starts T1, clears the T1 flag
+//   +6 T1L-L  latch low
+//   +7 T1L-H  latch high, clears the T1 flag
+//   +8 T2C-L  write: latch low. read: counter low, clears the T2 flag
+//   +9 T2C-H  write: loads and starts T2, clears the T2 flag
+//   +B ACR    bit 6 - T1 free-running, reloaded from the latch at every expiry
+//   +D IFR    bit 6 T1, bit 5 T2, bit 7 set while an enabled flag is set. Writing 1s clears flags
+//   +E IER    write: bit 7 set enables, clear disables the other 1 bits. read: bit 7 reads 1
+//
+// Timing follows the 6522: a counter loaded with N at cycle w holds N at w + 1, reaches 0 at w + N + 1 and sets
+// its flag at w + N + 2, a free-running T1 then reloads and expires every N + 2 cycles. Cycles are the bus
+// cycles of the accessing instructions (their start, see Bus::setCycle).
+class ViaDevice final : public Device {
+public:
+    static constexpr uint8_t IRQ_T1 = 0x40;
+    static constexpr uint8_t IRQ_T2 = 0x20;
+    static constexpr uint8_t IRQ_ANY = 0x80;
+    static constexpr uint8_t ACR_T1_FREE_RUN = 0x40;
+
+    uint8_t readRegister(uint16_t offset) override;
+    void writeRegister(uint16_t offset, uint8_t data) override;
+    uint64_t nextDeadline() const override;
+    bool irqAsserted() const override { return (ifr & ier & 0x7F) != 0; }
+    size_t stateSize() const override;
+    void saveState(uint8_t* out) const override;
+    void loadState(const uint8_t* in) override;
+
+    uint64_t getT1Expiries() const { return t1Expiries; }
+
+protected:
+    void advance(uint64_t fromCycle, uint64_t toCycle) override;
+
+private:
+    struct Timer {
+        uint16_t latch = 0;
+        uint16_t loaded = 0;   // Value the counter started from
+        uint64_t start = 0;    // Cycle the counter held loaded
+        uint16_t before = 0;   // Counter before start - the loaded value, or $FFFF on the cycle before a reload
+        uint64_t expiry = NO_DEADLINE; // Cycle the flag is set at, NO_DEADLINE once a one-shot has fired
+    };
+
+    void load(Timer& timer, uint64_t cycle);
+    uint16_t counter(const Timer& timer, bool freeRun, uint64_t cycle) const;
+    bool freeRunning() const { return (acr & ACR_T1_FREE_RUN) != 0; }
+
+    Timer t1;
+    Timer t2;
+    uint8_t acr = 0;
+    uint8_t ifr = 0;
+    uint8_t ier = 0;
+    std::array<uint8_t, 16> plain{}; // Registers without a function here
+    uint64_t t1Expiries = 0;
+};
+
+// via [cycles] - a guest takes free-running timer interrupts while idling and while busy, checks the tick count
+int RunViaDemo(uint64_t cycles = 10000000);